@@ -14,8 +14,10 @@
 
 #include "open_spiel/action_view.h"
 
+#include <cstdint>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 
@@ -41,6 +43,23 @@ ActionView::ActionView(const Player current_player,
 ActionView::ActionView(const State& state)
     : ActionView(state.CurrentPlayer(), CollectActions(state)) {}
 
+uint64_t ActionView::legal_mask(Player player) const {
+  uint64_t mask = 0;
+  for (Action action : legal_actions.at(player)) {
+    SPIEL_CHECK_GE(action, 0);
+    SPIEL_CHECK_LT(action, 64);
+    mask |= uint64_t{1} << action;
+  }
+  return mask;
+}
+
+void ActionView::legal_masks(absl::Span<uint64_t> masks) const {
+  SPIEL_CHECK_EQ(masks.size(), legal_actions.size());
+  for (int pl = 0; pl < legal_actions.size(); ++pl) {
+    masks[pl] = legal_mask(pl);
+  }
+}
+
 // FlatJointActions
 
 FlatJointActions ActionView::flat_joint_actions() const {
@@ -73,6 +92,61 @@ Action FlatJointActionsIterator::operator*() const { return current_action_; }
 FlatJointActionsIterator::FlatJointActionsIterator(int current_action)
     : current_action_(current_action) {}
 
+// JointActions
+
+JointActions ActionView::joint_actions() const {
+  int num_joint_actions = 1;
+  for (const std::vector<Action>& actions : legal_actions) {
+    if (!actions.empty()) num_joint_actions *= actions.size();
+  }
+  return JointActions{&legal_actions, num_joint_actions};
+}
+
+JointActionsIterator JointActions::begin() const {
+  return JointActionsIterator(legal_actions, 0);
+}
+JointActionsIterator JointActions::end() const {
+  return JointActionsIterator(legal_actions, num_joint_actions);
+}
+
+JointActionsIterator::JointActionsIterator(
+    const std::vector<std::vector<Action>>* legal_actions, int current)
+    : legal_actions_(legal_actions),
+      indices_(legal_actions->size(), 0),
+      joint_action_(legal_actions->size(), kInvalidAction),
+      current_(current) {
+  for (int pl = 0; pl < legal_actions_->size(); ++pl) {
+    const std::vector<Action>& actions = (*legal_actions_)[pl];
+    if (!actions.empty()) joint_action_[pl] = actions[0];
+  }
+}
+
+// Players are digits of increasing significance, with player 0 varying
+// fastest -- the same radix order used by the flat joint action encoding.
+JointActionsIterator& JointActionsIterator::operator++() {
+  ++current_;
+  for (int pl = 0; pl < legal_actions_->size(); ++pl) {
+    const std::vector<Action>& actions = (*legal_actions_)[pl];
+    if (actions.empty()) continue;
+    if (++indices_[pl] < actions.size()) {
+      joint_action_[pl] = actions[indices_[pl]];
+      return *this;  // No carry; higher digits are unchanged.
+    }
+    indices_[pl] = 0;
+    joint_action_[pl] = actions[0];
+  }
+  return *this;  // Carried out of the last digit: this is now end().
+}
+absl::Span<const Action> JointActionsIterator::operator*() const {
+  return absl::MakeConstSpan(joint_action_);
+}
+bool JointActionsIterator::operator==(const JointActionsIterator& rhs) const {
+  return current_ == rhs.current_;
+}
+bool JointActionsIterator::operator!=(const JointActionsIterator& rhs) const {
+  return !(*this == rhs);
+}
+
 // FixedActions
 
 FixedActions ActionView::fixed_action(Player player, int action_index) const {
@@ -15,8 +15,10 @@
 #ifndef OPEN_SPIEL_ACTION_VIEW_
 #define OPEN_SPIEL_ACTION_VIEW_
 
+#include <cstdint>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/spiel.h"
 
 // ActionView provides a number of iterators that are useful for dealing
@@ -66,6 +68,40 @@ struct FlatJointActions {
   FlatJointActionsIterator end() const;
 };
 
+// An odometer over the per-player legal action lists: visits the same joint
+// actions as FlatJointActions, in the same order, but yields the decoded
+// per-player actions directly. Decoding a flat id requires a division per
+// player per joint action; the odometer only bumps one digit per step, and
+// nothing proportional to the cartesian product is ever allocated. Players
+// without legal actions contribute kInvalidAction, mirroring
+// SimMoveState::FlatJointActionToActions.
+class JointActionsIterator {
+ public:
+  JointActionsIterator(const std::vector<std::vector<Action>>* legal_actions,
+                       int current);
+  JointActionsIterator& operator++();
+  // The current joint action, one entry per player. The span is invalidated
+  // by the next increment.
+  absl::Span<const Action> operator*() const;
+  // The flat joint action id of the current joint action.
+  Action flat_action() const { return current_; }
+  bool operator==(const JointActionsIterator& rhs) const;
+  bool operator!=(const JointActionsIterator& rhs) const;
+
+ private:
+  const std::vector<std::vector<Action>>* legal_actions_;
+  std::vector<int> indices_;        // Odometer digits, one per player.
+  std::vector<Action> joint_action_;
+  int current_;  // Flat id of the current joint action; also the sentinel.
+};
+
+struct JointActions {
+  const std::vector<std::vector<Action>>* legal_actions;
+  const int num_joint_actions;
+  JointActionsIterator begin() const;
+  JointActionsIterator end() const;
+};
+
 // Provides a number of iterators that are useful for dealing
 // with simultaneous move nodes.
 struct ActionView {
@@ -91,9 +127,24 @@ struct ActionView {
   // product of the actions.
   FlatJointActions flat_joint_actions() const;
 
+  // Provides a lazy iterator over the decoded joint actions (one action per
+  // player), in flat joint action order, without materializing the cartesian
+  // product. See JointActionsIterator above.
+  JointActions joint_actions() const;
+
   // Provides an iterator over flattened actions, while we fix one action
   // for the specified player.
   FixedActions fixed_action(Player player, int action_index) const;
+
+  // Packs the legal actions of the specified player into a 64-bit mask,
+  // with bit `a` set iff action `a` is legal. Only usable for games whose
+  // action space has at most 64 distinct actions (checked per action).
+  uint64_t legal_mask(Player player) const;
+
+  // Fills one legal mask per player. `masks` must have num_players()
+  // entries. Avoids the nested-vector representation entirely for
+  // fixed-size action spaces.
+  void legal_masks(absl::Span<uint64_t> masks) const;
 };
 
 }  // namespace open_spiel
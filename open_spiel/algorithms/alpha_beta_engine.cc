@@ -0,0 +1,221 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/alpha_beta_engine.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+uint64_t RoundUpToPowerOfTwo(uint64_t x) {
+  uint64_t result = 1;
+  while (result < x) result <<= 1;
+  return result;
+}
+
+}  // namespace
+
+AlphaBetaEngine::AlphaBetaEngine(
+    const Game& game, std::function<double(const State&)> value_function,
+    int64_t table_entries, bool use_undo)
+    : game_(game.shared_from_this()),
+      value_function_(std::move(value_function)),
+      use_undo_(use_undo) {
+  SPIEL_CHECK_LE(game.NumPlayers(), 2);
+  const GameType& type = game.GetType();
+  // Note: unlike AlphaBetaSearch, stochastic games are allowed here; the
+  // search checks per node that no chance node is reached.
+  SPIEL_CHECK_EQ(type.dynamics, GameType::Dynamics::kSequential);
+  SPIEL_CHECK_EQ(type.utility, GameType::Utility::kZeroSum);
+  SPIEL_CHECK_EQ(type.reward_model, GameType::RewardModel::kTerminal);
+
+  SPIEL_CHECK_GE(table_entries, 1);
+  const uint64_t size = RoundUpToPowerOfTwo(table_entries);
+  table_.resize(size);
+  table_mask_ = size - 1;
+}
+
+void AlphaBetaEngine::ClearTable() {
+  std::fill(table_.begin(), table_.end(), TableEntry());
+}
+
+double AlphaBetaEngine::SearchNode(State* state, int depth, double alpha,
+                                   double beta, Action* best_action) {
+  if (state->IsTerminal()) {
+    return state->PlayerReturn(maximizing_player_);
+  }
+  if (state->IsChanceNode()) {
+    SpielFatalError(
+        "AlphaBetaEngine: search reached a chance node. The engine only "
+        "handles subtrees past all chance (e.g. endgames).");
+  }
+
+  ++nodes_;
+  if (node_budget_ > 0 && nodes_ > node_budget_) {
+    aborted_ = true;
+    return 0;
+  }
+
+  const uint64_t key = TranspositionTable::KeyFor(*state);
+  TableEntry& slot = table_[key & table_mask_];
+  const bool slot_matches = (slot.depth >= 0 && slot.key == key);
+  // Bound cutoffs are only taken at interior nodes; the root always runs its
+  // full move loop so best_action gets filled in.
+  if (slot_matches && best_action == nullptr && slot.depth >= depth) {
+    if (slot.bound == TranspositionTable::kExact) {
+      if (slot.horizon) horizon_reached_ = true;
+      return slot.value;
+    }
+    if (slot.bound == TranspositionTable::kLowerBound) {
+      alpha = std::max(alpha, slot.value);
+    } else {
+      beta = std::min(beta, slot.value);
+    }
+    if (alpha >= beta) {
+      if (slot.horizon) horizon_reached_ = true;
+      return slot.value;
+    }
+  }
+
+  if (depth == 0) {
+    horizon_reached_ = true;
+    // Without a value function the horizon scores even; a deeper iteration
+    // (or a stored deeper entry) supersedes it.
+    return value_function_ ? value_function_(*state) : 0.0;
+  }
+
+  // Search the remembered best move first: with iterative deepening this is
+  // usually the previous iteration's choice and produces early cutoffs.
+  std::vector<Action> actions = state->LegalActions();
+  if (slot_matches && slot.best_move != kInvalidAction) {
+    auto it = std::find(actions.begin(), actions.end(), slot.best_move);
+    if (it != actions.end()) std::rotate(actions.begin(), it, it + 1);
+  }
+
+  const double original_alpha = alpha;
+  const double original_beta = beta;
+  // Track whether this subtree (as opposed to the whole iteration) touches
+  // the depth horizon, so the stored entry can carry that taint.
+  const bool horizon_before = horizon_reached_;
+  horizon_reached_ = false;
+  const Player player = state->CurrentPlayer();
+  const bool maximizing = (player == maximizing_player_);
+  double value = maximizing ? -std::numeric_limits<double>::infinity()
+                            : std::numeric_limits<double>::infinity();
+  Action best_move = kInvalidAction;
+
+  for (Action action : actions) {
+    double child_value;
+    if (use_undo_) {
+      state->ApplyAction(action);
+      child_value = SearchNode(state, depth - 1, alpha, beta,
+                               /*best_action=*/nullptr);
+      state->UndoAction(player, action);
+    } else {
+      std::unique_ptr<State> child_state = state->Child(action);
+      child_value = SearchNode(child_state.get(), depth - 1, alpha, beta,
+                               /*best_action=*/nullptr);
+    }
+    if (aborted_) return 0;
+
+    if (maximizing ? (child_value > value) : (child_value < value)) {
+      value = child_value;
+      best_move = action;
+      if (best_action != nullptr) *best_action = action;
+    }
+    if (maximizing) {
+      alpha = std::max(alpha, value);
+    } else {
+      beta = std::min(beta, value);
+    }
+    if (alpha >= beta) break;
+  }
+
+  const bool subtree_horizon = horizon_reached_;
+  horizon_reached_ = horizon_before || subtree_horizon;
+
+  // Depth-preferred replacement: a slot only yields to an entry searched at
+  // least as deep (an empty slot has depth -1).
+  if (slot.depth <= depth) {
+    slot.key = key;
+    slot.value = value;
+    slot.best_move = best_move;
+    slot.depth = static_cast<int16_t>(depth);
+    slot.horizon = subtree_horizon;
+    if (value <= original_alpha) {
+      slot.bound = TranspositionTable::kUpperBound;
+    } else if (value >= original_beta) {
+      slot.bound = TranspositionTable::kLowerBound;
+    } else {
+      slot.bound = TranspositionTable::kExact;
+    }
+  }
+  return value;
+}
+
+AlphaBetaEngine::SearchResult AlphaBetaEngine::Search(
+    const State& state, int depth_limit, int64_t node_budget,
+    Player maximizing_player) {
+  SPIEL_CHECK_GE(depth_limit, 1);
+  SPIEL_CHECK_FALSE(state.IsChanceNode());
+
+  std::unique_ptr<State> root = state.Clone();
+  maximizing_player_ =
+      (maximizing_player == kInvalidPlayer) ? root->CurrentPlayer()
+                                            : maximizing_player;
+  node_budget_ = node_budget;
+  nodes_ = 0;
+  aborted_ = false;
+
+  const double infinity = std::numeric_limits<double>::infinity();
+  SearchResult result;
+  for (int depth = 1; depth <= depth_limit; ++depth) {
+    horizon_reached_ = false;
+    Action iteration_best = kInvalidAction;
+    const double value =
+        SearchNode(root.get(), depth, -infinity, infinity, &iteration_best);
+    if (aborted_) {
+      // Fully searched root moves of the cut-short iteration are still
+      // correctly compared, so prefer its best move when we have nothing
+      // better; the previous iteration's value stands.
+      if (result.best_action == kInvalidAction) {
+        result.best_action = iteration_best;
+      }
+      break;
+    }
+    result.value = value;
+    result.best_action = iteration_best;
+    result.depth_reached = depth;
+    if (!horizon_reached_) {
+      // Every line ended in a terminal state: the position is solved and
+      // deeper iterations cannot change the result.
+      result.solved = true;
+      break;
+    }
+  }
+  result.nodes_searched = nodes_;
+  return result;
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
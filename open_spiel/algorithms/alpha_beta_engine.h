@@ -0,0 +1,123 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_ALPHA_BETA_ENGINE_H_
+#define OPEN_SPIEL_ALGORITHMS_ALPHA_BETA_ENGINE_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "open_spiel/algorithms/transposition_table.h"
+#include "open_spiel/spiel.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// An alpha-beta engine for solving endgames online, built for throughput
+// where AlphaBetaSearch (minimax.h) is built for simplicity. Compared to it,
+// the engine:
+//   - applies and undoes actions on a single state (the game must support
+//     UndoAction, or pass use_undo = false to fall back to Child());
+//   - keeps a fixed-size, cache-resident transposition table with a
+//     depth-preferred replacement scheme: a flat array with no per-entry
+//     allocation and no locks, probed on every interior node;
+//   - iteratively deepens, searching each node's remembered best move first,
+//     and stops deepening as soon as an iteration completes without reaching
+//     the depth horizon (the position is then solved);
+//   - honors a node budget, returning the deepest fully completed
+//     iteration's result when the budget runs out mid-iteration.
+//
+// The game must be a two-player, zero-sum, sequential game with terminal
+// rewards. Stochastic games are accepted as long as the searched subtree
+// contains no chance nodes (e.g. Durak once the deck is dealt out); reaching
+// a chance node is a fatal error. The engine is single-threaded; use one
+// engine per thread.
+class AlphaBetaEngine {
+ public:
+  struct SearchResult {
+    // Value for the maximizing player, from the deepest completed iteration.
+    double value = 0;
+    Action best_action = kInvalidAction;
+    // Deepest fully completed iteration. 0 means the node budget expired
+    // before depth 1 finished (best_action may still hold the best fully
+    // searched root move of the cut-short iteration).
+    int depth_reached = 0;
+    // Nodes visited across all iterations of this Search() call.
+    int64_t nodes_searched = 0;
+    // True if no completed iteration hit the depth horizon, i.e. the value
+    // is the exact game value under optimal play.
+    bool solved = false;
+  };
+
+  // value_function evaluates non-terminal nodes at the depth horizon (for
+  // the maximizing player); when null such nodes score 0 until a deeper
+  // iteration resolves them. table_entries is rounded up to a power of two;
+  // the default of 1 << 20 entries keeps the table around 32 MB.
+  explicit AlphaBetaEngine(
+      const Game& game,
+      std::function<double(const State&)> value_function = nullptr,
+      int64_t table_entries = int64_t{1} << 20, bool use_undo = true);
+
+  // Searches from state (which must not be a chance node), deepening up to
+  // depth_limit plies. node_budget <= 0 means no budget. maximizing_player
+  // defaults to the player to move at the root. The table persists across
+  // calls, so successive searches of nearby positions warm-start each other;
+  // call ClearTable() between unrelated games.
+  SearchResult Search(const State& state, int depth_limit,
+                      int64_t node_budget = 0,
+                      Player maximizing_player = kInvalidPlayer);
+
+  void ClearTable();
+
+ private:
+  struct TableEntry {
+    uint64_t key = 0;
+    double value = 0;
+    Action best_move = kInvalidAction;
+    int16_t depth = -1;  // -1 marks an empty slot.
+    TranspositionTable::Bound bound = TranspositionTable::kExact;
+    // True if the entry's subtree was cut off at the depth horizon, i.e. the
+    // value rests on the value function rather than terminal returns alone.
+    // Propagated on reuse so SearchResult::solved stays truthful across
+    // warm-started searches.
+    bool horizon = false;
+  };
+
+  // Negamax-free plain alpha-beta, mirroring minimax.cc. best_action is
+  // non-null only at the root, where table cutoffs are skipped so the action
+  // is always filled from a full move loop.
+  double SearchNode(State* state, int depth, double alpha, double beta,
+                    Action* best_action);
+
+  std::shared_ptr<const Game> game_;
+  std::function<double(const State&)> value_function_;
+  bool use_undo_;
+
+  std::vector<TableEntry> table_;
+  uint64_t table_mask_;
+
+  // Per-Search() state.
+  Player maximizing_player_ = kInvalidPlayer;
+  int64_t node_budget_ = 0;
+  int64_t nodes_ = 0;
+  bool aborted_ = false;
+  bool horizon_reached_ = false;
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_ALPHA_BETA_ENGINE_H_
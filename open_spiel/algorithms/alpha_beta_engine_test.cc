@@ -0,0 +1,95 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/alpha_beta_engine.h"
+
+#include "open_spiel/games/tic_tac_toe/tic_tac_toe.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void EngineSolvesTicTacToe() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  AlphaBetaEngine engine(*game, /*value_function=*/nullptr,
+                         /*table_entries=*/1 << 16);
+
+  AlphaBetaEngine::SearchResult result = engine.Search(*state, /*depth_limit=*/9);
+  SPIEL_CHECK_EQ(result.value, 0.0);
+  SPIEL_CHECK_TRUE(result.solved);
+  SPIEL_CHECK_LE(result.depth_reached, 9);
+  SPIEL_CHECK_GT(result.nodes_searched, 0);
+  SPIEL_CHECK_NE(result.best_action, kInvalidAction);
+
+  // A re-search of the same position hits the warm table and cannot cost
+  // more nodes than the cold search.
+  AlphaBetaEngine::SearchResult warm = engine.Search(*state, /*depth_limit=*/9);
+  SPIEL_CHECK_EQ(warm.value, 0.0);
+  SPIEL_CHECK_TRUE(warm.solved);
+  SPIEL_CHECK_LE(warm.nodes_searched, result.nodes_searched);
+}
+
+void EngineFindsForcedWin() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  // .o.
+  // .x.
+  // ...
+  state->ApplyAction(4);
+  state->ApplyAction(1);
+
+  AlphaBetaEngine engine(*game);
+  AlphaBetaEngine::SearchResult result = engine.Search(*state, /*depth_limit=*/9);
+  SPIEL_CHECK_EQ(result.value, 1.0);
+  SPIEL_CHECK_TRUE(result.solved);
+}
+
+void EngineHonorsNodeBudget() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  AlphaBetaEngine engine(*game);
+
+  const int64_t budget = 50;
+  AlphaBetaEngine::SearchResult result =
+      engine.Search(*state, /*depth_limit=*/9, budget);
+  SPIEL_CHECK_LE(result.nodes_searched, budget + 1);
+  SPIEL_CHECK_FALSE(result.solved);
+  SPIEL_CHECK_LT(result.depth_reached, 9);
+}
+
+void EngineStopsAtValueFunctionHorizon() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  AlphaBetaEngine engine(*game,
+                         [](const State&) { return 0.25; });
+
+  AlphaBetaEngine::SearchResult result = engine.Search(*state, /*depth_limit=*/2);
+  SPIEL_CHECK_EQ(result.depth_reached, 2);
+  SPIEL_CHECK_FALSE(result.solved);
+  SPIEL_CHECK_EQ(result.value, 0.25);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::EngineSolvesTicTacToe();
+  open_spiel::algorithms::EngineFindsForcedWin();
+  open_spiel::algorithms::EngineHonorsNodeBudget();
+  open_spiel::algorithms::EngineStopsAtValueFunctionHorizon();
+}
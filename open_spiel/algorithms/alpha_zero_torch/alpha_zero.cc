@@ -18,6 +18,7 @@
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <random>
@@ -37,21 +38,24 @@
 #include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/algorithms/alpha_zero_torch/device_manager.h"
+#include "open_spiel/algorithms/alpha_zero_torch/shm_trajectory_ring.h"
 #include "open_spiel/algorithms/alpha_zero_torch/vpevaluator.h"
 #include "open_spiel/algorithms/alpha_zero_torch/vpnet.h"
 #include "open_spiel/algorithms/mcts.h"
+#include "open_spiel/games/durak/durak.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/utils/circular_buffer.h"
 #include "open_spiel/utils/data_logger.h"
 #include "open_spiel/utils/file.h"
 #include "open_spiel/utils/json.h"
+#include "open_spiel/utils/lock_free_queue.h"
 #include "open_spiel/utils/logger.h"
 #include "open_spiel/utils/lru_cache.h"
+#include "open_spiel/utils/prioritized_replay_buffer.h"
 #include "open_spiel/utils/serializable_circular_buffer.h"
 #include "open_spiel/utils/stats.h"
 #include "open_spiel/utils/thread.h"
-#include "open_spiel/utils/threaded_queue.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -106,6 +110,96 @@ struct Trajectory {
   std::vector<double> returns;
 };
 
+// --- Flat trajectory encoding for the shared-memory actor transport. ------
+// A fixed field order of length-prefixed PODs; both sides are this file, so
+// there is no versioning beyond the ring's header check.
+
+template <typename T>
+void Append(std::vector<char>* buffer, const T& value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  buffer->insert(buffer->end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+void AppendVector(std::vector<char>* buffer, const std::vector<T>& values) {
+  Append<int64_t>(buffer, values.size());
+  const char* bytes = reinterpret_cast<const char*>(values.data());
+  buffer->insert(buffer->end(), bytes, bytes + values.size() * sizeof(T));
+}
+
+template <typename T>
+T Read(const std::vector<char>& buffer, int64_t* offset) {
+  T value;
+  std::memcpy(&value, buffer.data() + *offset, sizeof(T));
+  *offset += sizeof(T);
+  return value;
+}
+
+template <typename T>
+std::vector<T> ReadVector(const std::vector<char>& buffer, int64_t* offset) {
+  std::vector<T> values(Read<int64_t>(buffer, offset));
+  std::memcpy(values.data(), buffer.data() + *offset,
+              values.size() * sizeof(T));
+  *offset += values.size() * sizeof(T);
+  return values;
+}
+
+std::vector<char> SerializeTrajectory(const Trajectory& trajectory) {
+  std::vector<char> buffer;
+  Append<int64_t>(&buffer, trajectory.states.size());
+  for (const Trajectory::State& state : trajectory.states) {
+    AppendVector(&buffer, state.observation);
+    Append<int32_t>(&buffer, state.current_player);
+    AppendVector(&buffer, state.legal_actions);
+    Append<int64_t>(&buffer, state.action);
+    Append<int64_t>(&buffer, state.policy.size());
+    for (const auto& [action, probability] : state.policy) {
+      Append<int64_t>(&buffer, action);
+      Append<double>(&buffer, probability);
+    }
+    Append<double>(&buffer, state.value);
+  }
+  AppendVector(&buffer, trajectory.returns);
+  return buffer;
+}
+
+Trajectory DeserializeTrajectory(const std::vector<char>& buffer) {
+  Trajectory trajectory;
+  int64_t offset = 0;
+  trajectory.states.resize(Read<int64_t>(buffer, &offset));
+  for (Trajectory::State& state : trajectory.states) {
+    state.observation = ReadVector<float>(buffer, &offset);
+    state.current_player = Read<int32_t>(buffer, &offset);
+    state.legal_actions = ReadVector<open_spiel::Action>(buffer, &offset);
+    state.action = Read<int64_t>(buffer, &offset);
+    int64_t policy_size = Read<int64_t>(buffer, &offset);
+    state.policy.reserve(policy_size);
+    for (int64_t i = 0; i < policy_size; ++i) {
+      open_spiel::Action action = Read<int64_t>(buffer, &offset);
+      double probability = Read<double>(buffer, &offset);
+      state.policy.emplace_back(action, probability);
+    }
+    state.value = Read<double>(buffer, &offset);
+  }
+  trajectory.returns = ReadVector<double>(buffer, &offset);
+  return trajectory;
+}
+
+// Upper bound on the encoding of any one trajectory, used to size ring slots.
+int64_t MaxTrajectoryBytes(const open_spiel::Game& game) {
+  int64_t num_actions = game.NumDistinctActions();
+  int64_t per_state = 8 + game.ObservationTensorSize() * sizeof(float) +  //
+                      4 +                       // current_player
+                      8 + num_actions * 8 +     // legal_actions
+                      8 +                       // action
+                      8 + num_actions * 16 +    // policy
+                      8;                        // value
+  return 8 + game.MaxGameLength() * per_state + 8 + game.NumPlayers() * 8;
+}
+
+constexpr int kActorRingSlots = 256;
+const char* const kActorRingFile = "/trajectory_ring.shm";
+
 Trajectory PlayGame(Logger* logger, int game_num, const open_spiel::Game& game,
                     std::vector<std::unique_ptr<MCTSBot>>* bots,
                     std::mt19937* rng, double temperature, int temperature_drop,
@@ -181,32 +275,73 @@ std::unique_ptr<MCTSBot> InitAZBot(const AlphaZeroConfig& config,
       /*dont_return_chance_node*/ true);
 }
 
-// An actor thread runner that generates games and returns trajectories.
+// Pin the calling thread to group `index % num_groups` of a ';'-separated
+// cpu-list spec (see AlphaZeroConfig::actor_affinity). An empty spec leaves
+// placement to the OS scheduler.
+void PinToAffinityGroup(const std::string& spec, int index) {
+  if (spec.empty()) {
+    return;
+  }
+  std::vector<std::string> groups = absl::StrSplit(spec, ';');
+  PinThisThreadToCpus(ParseCpuList(groups[index % groups.size()]));
+}
+
+// An actor that generates games and returns trajectories. Each actor keeps
+// config.games_per_actor games in flight at once, one game-runner thread per
+// game: self-play is inference-bound, so a runner spends nearly all its time
+// parked on the evaluator's result future, and K parked runners mean K
+// outstanding inference requests per actor where a single game loop means
+// one. That keeps the evaluator's batches full with far fewer actors.
+// (A runner blocked on a future costs little beyond its stack; a
+// suspend/resume game scheduler inside one thread would need the search
+// itself to be written in continuation style for no extra benefit here.)
 void actor(const open_spiel::Game& game, const AlphaZeroConfig& config, int num,
-           ThreadedQueue<Trajectory>* trajectory_queue,
+           LockFreeQueue<Trajectory>* trajectory_queue,
            std::shared_ptr<VPNetEvaluator> vp_eval, StopToken* stop) {
+  // Pin before anything is allocated or spawned: the runner threads inherit
+  // the mask, and the trajectories this actor builds and pushes first-touch
+  // onto the group's NUMA node.
+  PinToAffinityGroup(config.actor_affinity, num);
   std::unique_ptr<Logger> logger;
   if (num < 20) {  // Limit the number of open files.
     logger.reset(new FileLogger(config.path, absl::StrCat("actor-", num)));
   } else {
     logger.reset(new NoopLogger());
   }
-  std::mt19937 rng(absl::ToUnixNanos(absl::Now()));
-  absl::uniform_real_distribution<double> dist(0.0, 1.0);
-  std::vector<std::unique_ptr<MCTSBot>> bots;
-  bots.reserve(2);
-  for (int player = 0; player < 2; player++) {
-    bots.push_back(InitAZBot(config, game, vp_eval, false));
-  }
-  for (int game_num = 1; !stop->StopRequested(); ++game_num) {
-    double cutoff =
-        (dist(rng) < config.cutoff_probability ? config.cutoff_value
-                                               : game.MaxUtility() + 1);
-    if (!trajectory_queue->Push(
-            PlayGame(logger.get(), game_num, game, &bots, &rng,
-                     config.temperature, config.temperature_drop, cutoff),
-            absl::Seconds(10))) {
-      logger->Print("Failed to push a trajectory after 10 seconds.");
+  const int games_per_actor = std::max(1, config.games_per_actor);
+  auto run_games = [&](int runner) {
+    std::mt19937 rng(absl::ToUnixNanos(absl::Now()) + num * 1000 + runner);
+    absl::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::vector<std::unique_ptr<MCTSBot>> bots;
+    bots.reserve(2);
+    for (int player = 0; player < 2; player++) {
+      bots.push_back(InitAZBot(config, game, vp_eval, false));
+    }
+    // Game numbers are interleaved across runners so the log identifies
+    // which runner played which game.
+    for (int game_num = runner + 1; !stop->StopRequested();
+         game_num += games_per_actor) {
+      double cutoff =
+          (dist(rng) < config.cutoff_probability ? config.cutoff_value
+                                                 : game.MaxUtility() + 1);
+      if (!trajectory_queue->Push(
+              PlayGame(logger.get(), game_num, game, &bots, &rng,
+                       config.temperature, config.temperature_drop, cutoff),
+              absl::Seconds(10))) {
+        logger->Print("Failed to push a trajectory after 10 seconds.");
+      }
+    }
+  };
+  if (games_per_actor == 1) {
+    run_games(0);
+  } else {
+    std::vector<Thread> runners;
+    runners.reserve(games_per_actor);
+    for (int runner = 0; runner < games_per_actor; ++runner) {
+      runners.emplace_back([&run_games, runner]() { run_games(runner); });
+    }
+    for (auto& t : runners) {
+      t.join();
     }
   }
   logger->Print("Got a quit.");
@@ -262,6 +397,7 @@ class EvalResults {
 void evaluator(const open_spiel::Game& game, const AlphaZeroConfig& config,
                int num, EvalResults* results,
                std::shared_ptr<VPNetEvaluator> vp_eval, StopToken* stop) {
+  PinToAffinityGroup(config.evaluator_affinity, num);
   FileLogger logger(config.path, absl::StrCat("evaluator-", num));
   std::mt19937 rng;
   auto rand_evaluator = std::make_shared<RandomRolloutEvaluator>(1, num);
@@ -304,9 +440,13 @@ void evaluator(const open_spiel::Game& game, const AlphaZeroConfig& config,
 void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
              DeviceManager* device_manager,
              std::shared_ptr<VPNetEvaluator> eval,
-             ThreadedQueue<Trajectory>* trajectory_queue,
-             EvalResults* eval_results, StopToken* stop,
-             const StartInfo& start_info) {
+             std::vector<std::unique_ptr<LockFreeQueue<Trajectory>>>*
+                 trajectory_queues,
+             ShmTrajectoryRing* actor_ring, EvalResults* eval_results,
+             StopToken* stop, const StartInfo& start_info) {
+  // Keep the learner with the cores PCIe-local to its device; the replay
+  // buffer is filled by this thread, so it first-touches onto that node too.
+  PinToAffinityGroup(config.learner_affinity, 0);
   FileLogger logger(config.path, "learner", "a");
   DataLoggerJsonLines data_logger(
       config.path, "learner", true, "a", start_info.start_time);
@@ -316,14 +456,47 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
   logger.Print("Running the learner on device %d: %s", device_id,
                device_manager->Get(0, device_id)->Device());
 
+  // With prioritized_replay_alpha > 0 the buffer samples states
+  // proportional to their last training loss (new states enter at the
+  // maximum priority) and the batches carry importance weights; otherwise
+  // the classic uniform circular buffer is used. Only one of the two is
+  // ever populated.
+  const bool prioritized = config.prioritized_replay_alpha > 0;
   SerializableCircularBuffer<VPNetModel::TrainInputs> replay_buffer(
-      config.replay_buffer_size);
+      prioritized ? 1 : config.replay_buffer_size);
+  std::unique_ptr<PrioritizedReplayBuffer<VPNetModel::TrainInputs>>
+      prioritized_buffer;
+  if (prioritized) {
+    prioritized_buffer =
+        std::make_unique<PrioritizedReplayBuffer<VPNetModel::TrainInputs>>(
+            config.replay_buffer_size, config.prioritized_replay_alpha,
+            config.prioritized_replay_beta);
+  }
   if (start_info.start_step > 1) {
-    replay_buffer.LoadBuffer(config.path + "/replay_buffer.data");
+    if (prioritized) {
+      prioritized_buffer->LoadBuffer(config.path + "/replay_buffer.data");
+    } else {
+      replay_buffer.LoadCheckpoint(config.path + "/replay_buffer.data");
+    }
   }
   int learn_rate = config.replay_buffer_size / config.replay_buffer_reuse;
   int64_t total_trajectories = start_info.total_trajectories;
 
+  // Suit-permutation augmentation is defined by the Durak observer layout;
+  // resolve the deck geometry once and refuse games without the symmetry.
+  int suit_aug_ranks = 0;
+  if (config.suit_augmentation) {
+    suit_aug_ranks =
+        open_spiel::durak::SuitAugmentationRanks(game.GetType().short_name);
+    if (suit_aug_ranks == 0) {
+      open_spiel::SpielFatalError(absl::StrCat(
+          "suit_augmentation is only defined for the durak games, not ",
+          game.GetType().short_name));
+    }
+    logger.Print("Suit-permutation augmentation enabled (%d ranks).",
+                 suit_aug_ranks);
+  }
+
   const int stage_count = 7;
   std::vector<open_spiel::BasicStats> value_accuracies(stage_count);
   std::vector<open_spiel::BasicStats> value_predictions(stage_count);
@@ -348,12 +521,30 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
       value_prediction.Reset();
     }
 
-    // Collect trajectories
-    int queue_size = trajectory_queue->Size();
+    // Collect trajectories, cycling over the queue shards and, when external
+    // actor processes are attached, the shared-memory ring.
+    int queue_size = 0;
+    for (const auto& queue : *trajectory_queues) {
+      queue_size += queue->Size();
+    }
+    if (actor_ring != nullptr) {
+      queue_size += actor_ring->ApproxSize();
+    }
     int num_states = 0;
     int num_trajectories = 0;
+    int shard = 0;
+    std::vector<char> ring_record;
     while (!stop->StopRequested() && num_states < learn_rate) {
-      absl::optional<Trajectory> trajectory = trajectory_queue->Pop();
+      absl::optional<Trajectory> trajectory;
+      if (!trajectory_queues->empty()) {
+        trajectory = (*trajectory_queues)[shard]->Pop(absl::Now() +
+                                                      absl::Milliseconds(10));
+        shard = (shard + 1) % trajectory_queues->size();
+      }
+      if (!trajectory && actor_ring != nullptr &&
+          actor_ring->Pop(&ring_record, absl::Milliseconds(10))) {
+        trajectory = DeserializeTrajectory(ring_record);
+      }
       if (trajectory) {
         num_trajectories += 1;
         total_trajectories += 1;
@@ -364,9 +555,14 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
         outcomes.Add(p1_outcome > 0 ? 0 : (p1_outcome < 0 ? 1 : 2));
 
         for (const Trajectory::State& state : trajectory->states) {
-          replay_buffer.Add(VPNetModel::TrainInputs{state.legal_actions,
-                                                    state.observation,
-                                                    state.policy, p1_outcome});
+          VPNetModel::TrainInputs train_inputs{state.legal_actions,
+                                               state.observation,
+                                               state.policy, p1_outcome};
+          if (prioritized) {
+            prioritized_buffer->Add(train_inputs);
+          } else {
+            replay_buffer.Add(train_inputs);
+          }
           num_states += 1;
         }
 
@@ -391,8 +587,13 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
         num_states, num_trajectories, num_states / seconds,
         num_states / (config.actors * seconds),
         static_cast<double>(num_states) / num_trajectories);
+    const int buffer_size =
+        prioritized ? prioritized_buffer->Size() : replay_buffer.Size();
+    const int64_t buffer_total_added = prioritized
+                                           ? prioritized_buffer->TotalAdded()
+                                           : replay_buffer.TotalAdded();
     logger.Print("Queue size: %d. Buffer size: %d. States seen: %d", queue_size,
-                 replay_buffer.Size(), replay_buffer.TotalAdded());
+                 buffer_size, buffer_total_added);
 
     if (stop->StopRequested()) {
       break;
@@ -400,48 +601,147 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
 
     last = now;
 
-    replay_buffer.SaveBuffer(config.path + "/replay_buffer.data");
+    if (prioritized) {
+      prioritized_buffer->SaveBuffer(config.path + "/replay_buffer.data");
+    } else {
+      // Persists only the states added this step, with the file write in the
+      // background; the learn step below runs while it lands.
+      replay_buffer.SaveCheckpoint(config.path + "/replay_buffer.data");
+    }
 
+    const int num_learn_devices = std::min(
+        std::max(1, config.learning_devices), device_manager->Count());
     VPNetModel::LossInfo losses;
-    {  // Extra scope to return the device for use for inference asap.
-      DeviceManager::DeviceLoan learn_model =
-          device_manager->Get(config.train_batch_size, device_id);
+    {  // Extra scope to return the devices for use for inference asap.
+      std::vector<DeviceManager::DeviceLoan> learn_models;
+      learn_models.reserve(num_learn_devices);
+      for (int d = 0; d < num_learn_devices; ++d) {
+        learn_models.push_back(device_manager->Get(
+            config.train_batch_size / num_learn_devices, d));
+      }
 
-      // Let the device manager know that the first device is now
+      // Let the device manager know that the learning devices are now
       // off-limits for inference and should only be used for learning
       // (if config.explicit_learning == true).
       device_manager->SetLearning(config.explicit_learning);
 
-      // Learn from them.
-      for (int i = 0; i < replay_buffer.Size() / config.train_batch_size; i++) {
-        losses += learn_model->Learn(
-            replay_buffer.Sample(&rng, config.train_batch_size));
+      // Learn from them. With several learning devices each batch is
+      // sharded across the replicas: every replica runs forward/backward on
+      // its shard in its own thread, the gradients are averaged into the
+      // first device which steps its optimizer, and the updated weights are
+      // copied back out to the replicas before the next batch.
+      for (int i = 0; i < buffer_size / config.train_batch_size; i++) {
+        std::vector<VPNetModel::TrainInputs> batch;
+        std::vector<int> batch_indices;
+        std::vector<double> batch_weights;
+        if (prioritized) {
+          PrioritizedReplayBuffer<VPNetModel::TrainInputs>::Batch sampled =
+              prioritized_buffer->Sample(&rng, config.train_batch_size);
+          batch = std::move(sampled.elements);
+          batch_indices = std::move(sampled.indices);
+          batch_weights = std::move(sampled.weights);
+        } else {
+          batch = replay_buffer.Sample(&rng, config.train_batch_size);
+        }
+        // Each sampled element gets an independent relabeling of the
+        // non-trump suits, so across buffer reuse one self-play state is
+        // trained on several of its six equivalent presentations. The
+        // elements are copies, so the buffer keeps the raw trajectories.
+        if (suit_aug_ranks > 0) {
+          for (VPNetModel::TrainInputs& inputs : batch) {
+            open_spiel::durak::AugmentWithSuitPermutation(
+                suit_aug_ranks, absl::MakeSpan(inputs.observations),
+                &inputs.legal_actions, &inputs.policy, &rng);
+          }
+        }
+        // Per-sample losses of the batch become its refreshed priorities.
+        std::vector<double> batch_losses;
+        if (num_learn_devices == 1) {
+          losses += learn_models[0]->Learn(
+              batch, batch_weights, prioritized ? &batch_losses : nullptr);
+          if (prioritized) {
+            prioritized_buffer->UpdatePriorities(batch_indices, batch_losses);
+          }
+          continue;
+        }
+        const int shard_size =
+            (batch.size() + num_learn_devices - 1) / num_learn_devices;
+        std::vector<VPNetModel::LossInfo> shard_losses(num_learn_devices);
+        std::vector<std::vector<double>> shard_sample_losses(num_learn_devices);
+        std::vector<Thread> shard_threads;
+        shard_threads.reserve(num_learn_devices);
+        for (int d = 0; d < num_learn_devices; ++d) {
+          shard_threads.emplace_back([&, d]() {
+            const size_t shard_begin =
+                std::min<size_t>(d * shard_size, batch.size());
+            const size_t shard_end =
+                std::min<size_t>((d + 1) * shard_size, batch.size());
+            if (shard_begin == shard_end) return;
+            std::vector<double> shard_weights;
+            if (prioritized) {
+              shard_weights.assign(batch_weights.begin() + shard_begin,
+                                   batch_weights.begin() + shard_end);
+            }
+            shard_losses[d] = learn_models[d]->ComputeGradients(
+                std::vector<VPNetModel::TrainInputs>(
+                    batch.begin() + shard_begin, batch.begin() + shard_end),
+                shard_weights, prioritized ? &shard_sample_losses[d] : nullptr);
+          });
+        }
+        for (Thread& shard_thread : shard_threads) shard_thread.join();
+        if (prioritized) {
+          // Shards are contiguous slices, so concatenating in device order
+          // realigns the per-sample losses with batch_indices.
+          for (const std::vector<double>& shard : shard_sample_losses) {
+            batch_losses.insert(batch_losses.end(), shard.begin(),
+                                shard.end());
+          }
+          prioritized_buffer->UpdatePriorities(batch_indices, batch_losses);
+        }
+        std::vector<VPNetModel*> replicas;
+        replicas.reserve(num_learn_devices - 1);
+        for (int d = 1; d < num_learn_devices; ++d) {
+          replicas.push_back(learn_models[d].model());
+        }
+        learn_models[0]->StepAveragingGradients(replicas);
+        for (VPNetModel* replica : replicas) {
+          replica->CopyWeightsFrom(*learn_models[0].model());
+        }
+        for (const VPNetModel::LossInfo& shard_loss : shard_losses) {
+          losses += shard_loss;
+        }
       }
 
-      // The device manager can now once again use the first device for
+      // The device manager can now once again use the learning devices for
       // inference (if it could not before).
       device_manager->SetLearning(false);
     }
 
     // Always save a checkpoint, either for keeping or for loading the weights
     // to the other sessions. It only allows numbers, so use -1 as "latest".
+    // The save is asynchronous: only the host-memory snapshot happens here;
+    // a background thread writes the files and renames them into place, so
+    // training never stalls on the disk and actor processes polling the path
+    // never see a partial file.
     std::string checkpoint_path = device_manager->Get(0, device_id)
-        ->SaveCheckpoint(VPNetModel::kMostRecentCheckpointStep);
+        ->SaveCheckpointAsync(VPNetModel::kMostRecentCheckpointStep);
     if (step % config.checkpoint_freq == 0) {
-      device_manager->Get(0, device_id)->SaveCheckpoint(step);
+      device_manager->Get(0, device_id)->SaveCheckpointAsync(step);
     }
-    if (device_manager->Count() > 0) {
-      for (int i = 0; i < device_manager->Count(); ++i) {
-        if (i != device_id) {
-          device_manager->Get(0, i)->LoadCheckpoint(checkpoint_path);
-        }
+    // In-process devices refresh straight from the snapshot rather than the
+    // (possibly still in-flight) checkpoint files.
+    std::shared_ptr<const VPNetModel::CheckpointSnapshot> snapshot =
+        device_manager->Get(0, device_id)->LastSnapshot();
+    for (int i = 0; i < device_manager->Count(); ++i) {
+      if (i != device_id) {
+        device_manager->Get(0, i)->LoadCheckpoint(*snapshot);
       }
     }
-    logger.Print("Checkpoint saved: %s", checkpoint_path);
+    logger.Print("Checkpoint queued: %s", checkpoint_path);
 
     DataLogger::Record record = {
         {"step", step},
-        {"total_states", replay_buffer.TotalAdded()},
+        {"total_states", buffer_total_added},
         {"states_per_s", num_states / seconds},
         {"states_per_s_actor", num_states / (config.actors * seconds)},
         {"total_trajectories", total_trajectories},
@@ -476,9 +776,11 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
     LRUCacheInfo cache_info = eval->CacheInfo();
     if (cache_info.size > 0) {
       logger.Print(absl::StrFormat(
-          "Cache size: %d/%d: %.1f%%, hits: %d, misses: %d, hit rate: %.3f%%",
+          "Cache size: %d/%d: %.1f%%, hits: %d, misses: %d, hit rate: %.3f%%, "
+          "evictions: %d",
           cache_info.size, cache_info.max_size, 100.0 * cache_info.Usage(),
-          cache_info.hits, cache_info.misses, 100.0 * cache_info.HitRate()));
+          cache_info.hits, cache_info.misses, 100.0 * cache_info.HitRate(),
+          cache_info.evictions));
       eval->ClearCache();
     }
     record.emplace("cache",
@@ -492,11 +794,15 @@ void learner(const open_spiel::Game& game, const AlphaZeroConfig& config,
                        {"misses", cache_info.misses},
                        {"misses_per_s", cache_info.misses / seconds},
                        {"hit_rate", cache_info.HitRate()},
+                       {"evictions", cache_info.evictions},
                    }));
 
     data_logger.Write(record);
     logger.Print("");
   }
+
+  // Make sure the final checkpoint is on disk before tearing down.
+  device_manager->Get(0, device_id)->FinishPendingCheckpoints();
 }
 
 bool AlphaZero(AlphaZeroConfig config, StopToken* stop, bool resuming) {
@@ -582,6 +888,10 @@ bool AlphaZero(AlphaZeroConfig config, StopToken* stop, bool resuming) {
     return false;
   }
 
+  config.learning_devices = std::max(
+      1, std::min(config.learning_devices, device_manager.Count()));
+  device_manager.SetLearningDevices(config.learning_devices);
+
   std::cerr << "Loading model from step " << start_info.model_checkpoint_step
             << std::endl;
   {  // Make sure they're all in sync.
@@ -594,20 +904,47 @@ bool AlphaZero(AlphaZeroConfig config, StopToken* stop, bool resuming) {
     }
   }
 
+  for (int i = 0; i < device_manager.Count(); ++i) {
+    device_manager.Get(0, i)->SetFP16Inference(config.inference_fp16);
+  }
+
+  // Cache contention scales with concurrent games, not actor threads.
   auto eval = std::make_shared<VPNetEvaluator>(
       &device_manager, config.inference_batch_size, config.inference_threads,
-      config.inference_cache, (config.actors + config.evaluators) / 16);
+      config.inference_cache,
+      (config.actors * std::max(1, config.games_per_actor) +
+       config.evaluators) / 16);
+
+  // Shard the trajectory queue per group of actors so that many actors don't
+  // all serialize on one queue mutex; the learner drains the shards
+  // round-robin. Groups of up to 8 actors share a shard.
+  const int num_queue_shards = (config.actors + 7) / 8;
+  std::vector<std::unique_ptr<LockFreeQueue<Trajectory>>> trajectory_queues;
+  trajectory_queues.reserve(num_queue_shards);
+  for (int i = 0; i < num_queue_shards; ++i) {
+    trajectory_queues.push_back(std::make_unique<LockFreeQueue<Trajectory>>(
+        std::max(1, config.replay_buffer_size / config.replay_buffer_reuse /
+                        num_queue_shards)));
+  }
 
-  ThreadedQueue<Trajectory> trajectory_queue(config.replay_buffer_size /
-                                             config.replay_buffer_reuse);
+  // With no in-process actors, self-play comes from separate actor processes
+  // (AlphaZeroActorProcess) over a shared-memory ring created here.
+  std::unique_ptr<ShmTrajectoryRing> actor_ring;
+  if (config.actors == 0) {
+    actor_ring = std::make_unique<ShmTrajectoryRing>(
+        config.path + kActorRingFile, kActorRingSlots,
+        MaxTrajectoryBytes(*game), /*create=*/true);
+  }
 
   EvalResults eval_results(config.eval_levels, config.evaluation_window);
 
   std::vector<Thread> actors;
   actors.reserve(config.actors);
   for (int i = 0; i < config.actors; ++i) {
-    actors.emplace_back(
-        [&, i]() { actor(*game, config, i, &trajectory_queue, eval, stop); });
+    actors.emplace_back([&, i]() {
+      actor(*game, config, i, trajectory_queues[i % num_queue_shards].get(),
+            eval, stop);
+    });
   }
   std::vector<Thread> evaluators;
   evaluators.reserve(config.evaluators);
@@ -615,16 +952,18 @@ bool AlphaZero(AlphaZeroConfig config, StopToken* stop, bool resuming) {
     evaluators.emplace_back(
         [&, i]() { evaluator(*game, config, i, &eval_results, eval, stop); });
   }
-  learner(*game, config, &device_manager, eval, &trajectory_queue,
-          &eval_results, stop, start_info);
+  learner(*game, config, &device_manager, eval, &trajectory_queues,
+          actor_ring.get(), &eval_results, stop, start_info);
 
   if (!stop->StopRequested()) {
     stop->Stop();
   }
 
-  // Empty the queue so that the actors can exit.
-  trajectory_queue.BlockNewValues();
-  trajectory_queue.Clear();
+  // Empty the queues so that the actors can exit.
+  for (auto& queue : trajectory_queues) {
+    queue->BlockNewValues();
+    queue->Clear();
+  }
 
   std::cout << "Joining all the threads." << std::endl;
   for (auto& t : actors) {
@@ -637,6 +976,71 @@ bool AlphaZero(AlphaZeroConfig config, StopToken* stop, bool resuming) {
   return true;
 }
 
+bool AlphaZeroActorProcess(AlphaZeroConfig config, StopToken* stop, int num) {
+  // Same placement policy as in-process actors, keyed by the process number;
+  // the inference threads created below inherit the mask.
+  PinToAffinityGroup(config.actor_affinity, num);
+  std::shared_ptr<const open_spiel::Game> game =
+      open_spiel::LoadGame(config.game);
+
+  FileLogger logger(config.path, absl::StrCat("actor-proc-", num));
+  std::mt19937 rng(absl::ToUnixNanos(absl::Now()) + num);
+  absl::uniform_real_distribution<double> dist(0.0, 1.0);
+
+  // This process runs its own devices and model; the learner publishes
+  // weights through the most-recent checkpoint file.
+  DeviceManager device_manager;
+  for (const absl::string_view& device : absl::StrSplit(config.devices, ',')) {
+    device_manager.AddDevice(
+        VPNetModel(*game, config.path, config.graph_def, std::string(device)));
+  }
+  if (device_manager.Count() == 0) {
+    std::cerr << "No devices specified?" << std::endl;
+    return false;
+  }
+  for (int i = 0; i < device_manager.Count(); ++i) {
+    device_manager.Get(0, i)->LoadCheckpoint(
+        VPNetModel::kMostRecentCheckpointStep);
+    device_manager.Get(0, i)->SetFP16Inference(config.inference_fp16);
+  }
+
+  auto eval = std::make_shared<VPNetEvaluator>(
+      &device_manager, config.inference_batch_size, config.inference_threads,
+      config.inference_cache);
+
+  ShmTrajectoryRing ring(config.path + kActorRingFile, kActorRingSlots,
+                         MaxTrajectoryBytes(*game), /*create=*/false);
+
+  std::vector<std::unique_ptr<MCTSBot>> bots;
+  bots.reserve(2);
+  for (int player = 0; player < 2; player++) {
+    bots.push_back(InitAZBot(config, *game, eval, false));
+  }
+
+  for (int game_num = 1; !stop->StopRequested(); ++game_num) {
+    double cutoff =
+        (dist(rng) < config.cutoff_probability ? config.cutoff_value
+                                               : game->MaxUtility() + 1);
+    Trajectory trajectory =
+        PlayGame(&logger, game_num, *game, &bots, &rng, config.temperature,
+                 config.temperature_drop, cutoff);
+    if (!ring.Push(SerializeTrajectory(trajectory), absl::Seconds(10))) {
+      logger.Print("Failed to push a trajectory after 10 seconds.");
+    }
+
+    // Pick up the learner's latest weights. In-process actors get them for
+    // free when the learner reloads the devices; here we poll the
+    // most-recent checkpoint between games.
+    for (int i = 0; i < device_manager.Count(); ++i) {
+      device_manager.Get(0, i)->LoadCheckpoint(
+          VPNetModel::kMostRecentCheckpointStep);
+    }
+    eval->ClearCache();
+  }
+  logger.Print("Got a quit.");
+  return true;
+}
+
 }  // namespace torch_az
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -37,14 +37,29 @@ struct AlphaZeroConfig {
   std::string devices;
 
   bool explicit_learning;
+  int learning_devices;
   double learning_rate;
   double weight_decay;
   int train_batch_size;
   int inference_batch_size;
   int inference_threads;
   int inference_cache;
+  bool inference_fp16;
   int replay_buffer_size;
   int replay_buffer_reuse;
+  // Prioritized experience replay: with alpha > 0 the learner samples
+  // buffer positions proportional to their last training loss^alpha and
+  // corrects with importance weights^beta (see
+  // utils/prioritized_replay_buffer.h); 0 keeps uniform sampling.
+  double prioritized_replay_alpha;
+  double prioritized_replay_beta;
+  // Durak games only: apply a freshly sampled permutation of the three
+  // non-trump suits to every sampled batch element (observation, legal
+  // actions and policy target; see durak::AugmentWithSuitPermutation).
+  // Positions are equivalent under those relabelings, so each self-play
+  // state yields up to six distinct training presentations across buffer
+  // reuse.
+  bool suit_augmentation;
   int checkpoint_freq;
   int evaluation_window;
 
@@ -58,9 +73,20 @@ struct AlphaZeroConfig {
   double cutoff_value;
 
   int actors;
+  int games_per_actor;
   int evaluators;
   int eval_levels;
   int max_steps;
+  // CPU placement (Linux only; empty = leave it to the OS scheduler).
+  // taskset-style cpu lists, e.g. "0-15,32". actor_affinity and
+  // evaluator_affinity may hold several groups separated by ';' — thread i
+  // is pinned to group i % num_groups, so "0-31;32-63" alternates actors
+  // between two sockets. Keep learner_affinity on the cores PCIe-local to
+  // the learning devices. Pinned threads also first-touch their queue and
+  // buffer memory, which places it on the group's NUMA node.
+  std::string actor_affinity;
+  std::string evaluator_affinity;
+  std::string learner_affinity;
 
   json::Object ToJson() const {
     return json::Object({
@@ -72,14 +98,19 @@ struct AlphaZeroConfig {
         {"nn_depth", nn_depth},
         {"devices", devices},
         {"explicit_learning", explicit_learning},
+        {"learning_devices", learning_devices},
         {"learning_rate", learning_rate},
         {"weight_decay", weight_decay},
         {"train_batch_size", train_batch_size},
         {"inference_batch_size", inference_batch_size},
         {"inference_threads", inference_threads},
         {"inference_cache", inference_cache},
+        {"inference_fp16", inference_fp16},
         {"replay_buffer_size", replay_buffer_size},
         {"replay_buffer_reuse", replay_buffer_reuse},
+        {"prioritized_replay_alpha", prioritized_replay_alpha},
+        {"prioritized_replay_beta", prioritized_replay_beta},
+        {"suit_augmentation", suit_augmentation},
         {"checkpoint_freq", checkpoint_freq},
         {"evaluation_window", evaluation_window},
         {"uct_c", uct_c},
@@ -91,9 +122,13 @@ struct AlphaZeroConfig {
         {"cutoff_probability", cutoff_probability},
         {"cutoff_value", cutoff_value},
         {"actors", actors},
+        {"games_per_actor", games_per_actor},
         {"evaluators", evaluators},
         {"eval_levels", eval_levels},
         {"max_steps", max_steps},
+        {"actor_affinity", actor_affinity},
+        {"evaluator_affinity", evaluator_affinity},
+        {"learner_affinity", learner_affinity},
     });
   }
 
@@ -106,14 +141,33 @@ struct AlphaZeroConfig {
     nn_depth = config_json.at("nn_depth").GetInt();
     devices = config_json.at("devices").GetString();
     explicit_learning = config_json.at("explicit_learning").GetBool();
+    // Optional for compatibility with configs written before it existed.
+    learning_devices = config_json.count("learning_devices") > 0
+                           ? config_json.at("learning_devices").GetInt()
+                           : 1;
     learning_rate = config_json.at("learning_rate").GetDouble();
     weight_decay = config_json.at("weight_decay").GetDouble();
     train_batch_size = config_json.at("train_batch_size").GetInt();
     inference_batch_size = config_json.at("inference_batch_size").GetInt();
     inference_threads = config_json.at("inference_threads").GetInt();
     inference_cache = config_json.at("inference_cache").GetInt();
+    // Optional for compatibility with configs written before it existed.
+    inference_fp16 = config_json.count("inference_fp16") > 0 &&
+                     config_json.at("inference_fp16").GetBool();
     replay_buffer_size = config_json.at("replay_buffer_size").GetInt();
     replay_buffer_reuse = config_json.at("replay_buffer_reuse").GetInt();
+    // Optional for compatibility with configs written before they existed.
+    prioritized_replay_alpha =
+        config_json.count("prioritized_replay_alpha") > 0
+            ? config_json.at("prioritized_replay_alpha").GetDouble()
+            : 0;
+    prioritized_replay_beta =
+        config_json.count("prioritized_replay_beta") > 0
+            ? config_json.at("prioritized_replay_beta").GetDouble()
+            : 0.4;
+    // Optional for compatibility with configs written before it existed.
+    suit_augmentation = config_json.count("suit_augmentation") > 0 &&
+                        config_json.at("suit_augmentation").GetBool();
     checkpoint_freq = config_json.at("checkpoint_freq").GetInt();
     evaluation_window = config_json.at("evaluation_window").GetInt();
     uct_c = config_json.at("uct_c").GetDouble();
@@ -125,14 +179,36 @@ struct AlphaZeroConfig {
     cutoff_probability = config_json.at("cutoff_probability").GetDouble();
     cutoff_value = config_json.at("cutoff_value").GetDouble();
     actors = config_json.at("actors").GetInt();
+    // Optional for compatibility with configs written before it existed.
+    games_per_actor = config_json.count("games_per_actor") > 0
+                          ? config_json.at("games_per_actor").GetInt()
+                          : 1;
     evaluators = config_json.at("evaluators").GetInt();
     eval_levels = config_json.at("eval_levels").GetInt();
     max_steps = config_json.at("max_steps").GetInt();
+    // Optional for compatibility with configs written before they existed.
+    actor_affinity = config_json.count("actor_affinity") > 0
+                         ? config_json.at("actor_affinity").GetString()
+                         : "";
+    evaluator_affinity = config_json.count("evaluator_affinity") > 0
+                             ? config_json.at("evaluator_affinity").GetString()
+                             : "";
+    learner_affinity = config_json.count("learner_affinity") > 0
+                           ? config_json.at("learner_affinity").GetString()
+                           : "";
   }
 };
 
 bool AlphaZero(AlphaZeroConfig config, StopToken* stop, bool resuming);
 
+// Runs a self-play actor as a standalone process, pushing trajectories into
+// the shared-memory ring created by an AlphaZero() run with actors = 0 in the
+// same config.path. All processes must use the same config. `num` only labels
+// the log file; any number of actor processes may attach (e.g. one per core,
+// across machines sharing config.path over a common filesystem mapping).
+// Weights are picked up from the most-recent checkpoint between games.
+bool AlphaZeroActorProcess(AlphaZeroConfig config, StopToken* stop, int num);
+
 }  // namespace torch_az
 }  // namespace algorithms
 }  // namespace open_spiel
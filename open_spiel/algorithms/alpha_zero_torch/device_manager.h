@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_DEVICE_MANAGER_H_
 #define OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_DEVICE_MANAGER_H_
 
+#include <algorithm>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
@@ -51,6 +52,7 @@ class DeviceManager {
 
     ~DeviceLoan() { manager_->Return(device_id_, requests_); }
     VPNetModel* operator->() { return model_; }
+    VPNetModel* model() { return model_; }
 
    private:
     DeviceLoan(DeviceManager* manager, VPNetModel* model, int device_id,
@@ -71,10 +73,14 @@ class DeviceManager {
     absl::MutexLock lock(&m_);
     if (device_id < 0) {
       // The starting device changes depending on if we are allowed to
-      // use the first device or not.
-      device_id = 0 + (learning_ && multiple_devices_);
-      for (int i = 1 + (learning_ && multiple_devices_); i < devices.size();
-           ++i) {
+      // use the learning devices or not. At least one device always stays
+      // available for inference.
+      int first = 0;
+      if (learning_ && multiple_devices_) {
+        first = std::min<int>(learning_devices_, devices.size() - 1);
+      }
+      device_id = first;
+      for (int i = first + 1; i < devices.size(); ++i) {
         if (devices[i].requests < devices[device_id].requests) {
           device_id = i;
         }
@@ -84,12 +90,19 @@ class DeviceManager {
     return DeviceLoan(this, &devices[device_id].model, device_id, requests);
   }
 
-  // A member to ensure that when device:0 is learning and there are
-  // multiple devices available, that device:0 does not take on any
-  // inference requests from the actors and evaluators. These inference
-  // requests should be dealt with by the other available devices.
+  // A member to ensure that when the first devices are learning and there
+  // are multiple devices available, they do not take on any inference
+  // requests from the actors and evaluators. These inference requests
+  // should be dealt with by the other available devices.
   void SetLearning(bool value) { learning_ = value; }
 
+  // How many leading devices the learner trains on (and SetLearning
+  // reserves); the rest only serve inference. Defaults to 1. Not thread
+  // safe; set once before training starts.
+  void SetLearningDevices(int learning_devices) {
+    learning_devices_ = learning_devices;
+  }
+
   int Count() const { return devices.size(); }
 
  private:
@@ -105,6 +118,7 @@ class DeviceManager {
 
   bool learning_;
   bool multiple_devices_;
+  int learning_devices_ = 1;
   std::vector<Device> devices;
   absl::Mutex m_;
 };
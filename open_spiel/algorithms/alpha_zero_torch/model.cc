@@ -338,20 +338,32 @@ std::vector<torch::Tensor> ModelImpl::forward(torch::Tensor x,
 std::vector<torch::Tensor> ModelImpl::losses(torch::Tensor inputs,
                                              torch::Tensor masks,
                                              torch::Tensor policy_targets,
-                                             torch::Tensor value_targets) {
+                                             torch::Tensor value_targets,
+                                             torch::Tensor sample_weights) {
   std::vector<torch::Tensor> output = this->forward_(inputs, masks);
 
   torch::Tensor value_predictions = output[0];
   torch::Tensor policy_predictions = output[1];
 
-  // Policy loss (cross-entropy).
-  torch::Tensor policy_loss = torch::sum(
+  // Per-sample policy loss (cross-entropy) and value loss (squared error),
+  // both of shape [batch].
+  torch::Tensor per_sample_policy_loss = torch::sum(
       -policy_targets * torch::log_softmax(policy_predictions, 1), -1);
-  policy_loss = torch::mean(policy_loss);
-
-  // Value loss (mean-squared error).
-  torch::nn::MSELoss mse_loss;
-  torch::Tensor value_loss = mse_loss(value_predictions, value_targets);
+  torch::Tensor per_sample_value_loss =
+      torch::square(value_predictions - value_targets).squeeze(-1);
+  torch::Tensor per_sample_loss =
+      (per_sample_policy_loss + per_sample_value_loss).detach();
+
+  // Means to optimize, importance-weighted when weights are given.
+  torch::Tensor policy_loss;
+  torch::Tensor value_loss;
+  if (sample_weights.defined()) {
+    policy_loss = torch::mean(sample_weights * per_sample_policy_loss);
+    value_loss = torch::mean(sample_weights * per_sample_value_loss);
+  } else {
+    policy_loss = torch::mean(per_sample_policy_loss);
+    value_loss = torch::mean(per_sample_value_loss);
+  }
 
   // L2 regularization loss (weights only).
   torch::Tensor l2_regularization_loss = torch::full(
@@ -372,7 +384,7 @@ std::vector<torch::Tensor> ModelImpl::losses(torch::Tensor inputs,
         weight_decay_ * torch::sum(torch::square(named_parameter.value())) / 2;
   }
 
-  return {policy_loss, value_loss, l2_regularization_loss};
+  return {policy_loss, value_loss, l2_regularization_loss, per_sample_loss};
 }
 
 std::vector<torch::Tensor> ModelImpl::forward_(torch::Tensor x,
@@ -185,9 +185,15 @@ class ModelImpl : public torch::nn::Module {
  public:
   ModelImpl(const ModelConfig& config, const std::string& device);
   std::vector<torch::Tensor> forward(torch::Tensor x, torch::Tensor mask);
+  // Returns {policy loss, value loss, l2 loss, per-sample loss}: the first
+  // three are scalars to optimize, the last is the [batch] vector of
+  // per-sample policy + value losses (detached), for prioritized replay.
+  // When `sample_weights` is defined ([batch], e.g. importance weights from
+  // prioritized sampling), the policy and value means are weighted by it.
   std::vector<torch::Tensor> losses(torch::Tensor inputs, torch::Tensor masks,
                                     torch::Tensor policy_targets,
-                                    torch::Tensor value_targets);
+                                    torch::Tensor value_targets,
+                                    torch::Tensor sample_weights = {});
 
  private:
   std::vector<torch::Tensor> forward_(torch::Tensor x, torch::Tensor mask);
@@ -0,0 +1,207 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/alpha_zero_torch/shm_trajectory_ring.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cstring>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace torch_az {
+namespace {
+
+// File layout: Header, then num_slots slots. Each slot is
+//   std::atomic<uint64_t> state (kSlotEmpty / kSlotWriting / kSlotReady)
+//   int64_t record_size
+//   char record[max_record_bytes]
+// All cross-process coordination uses std::atomic on the mapped words, which
+// is address-free for lock-free types, so it behaves identically across
+// processes mapping the file at different addresses.
+struct Header {
+  uint64_t magic;
+  int64_t num_slots;
+  int64_t max_record_bytes;
+  std::atomic<uint64_t> write_ticket;
+  std::atomic<uint64_t> read_ticket;
+};
+
+constexpr uint64_t kRingMagic = 0x4f53'415a'5249'4e47ULL;  // "OSAZRING"
+
+constexpr uint64_t kSlotEmpty = 0;
+constexpr uint64_t kSlotWriting = 1;
+constexpr uint64_t kSlotReady = 2;
+
+// How long a producer or consumer sleeps between polls of a slot that isn't
+// in the state it needs yet. Trajectories take milliseconds to generate, so
+// a short sleep costs nothing measurable.
+constexpr absl::Duration kPollInterval = absl::Microseconds(100);
+
+std::atomic<uint64_t>* SlotState(char* slot) {
+  return reinterpret_cast<std::atomic<uint64_t>*>(slot);
+}
+
+}  // namespace
+
+ShmTrajectoryRing::ShmTrajectoryRing(const std::string& filename,
+                                     int64_t num_slots,
+                                     int64_t max_record_bytes, bool create)
+    : num_slots_(num_slots), max_record_bytes_(max_record_bytes) {
+#ifdef _WIN32
+  SpielFatalError("ShmTrajectoryRing is not supported on Windows.");
+#else
+  SPIEL_CHECK_GT(num_slots_, 0);
+  SPIEL_CHECK_GT(max_record_bytes_, 0);
+  static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                "Shared-memory ring requires lock-free 64-bit atomics.");
+
+  slot_size_ = sizeof(std::atomic<uint64_t>) + sizeof(int64_t) +
+               max_record_bytes_;
+  // Keep every slot's atomic 8-byte aligned.
+  slot_size_ = (slot_size_ + 7) & ~int64_t{7};
+  file_size_ = sizeof(Header) + num_slots_ * slot_size_;
+
+  int fd = open(filename.c_str(), create ? (O_RDWR | O_CREAT | O_TRUNC)
+                                         : O_RDWR,
+                0644);
+  if (fd < 0) {
+    SpielFatalError(absl::StrCat("Failed to open ring file: ", filename));
+  }
+  if (create && ftruncate(fd, file_size_) != 0) {
+    close(fd);
+    SpielFatalError(absl::StrCat("Failed to size ring file: ", filename));
+  }
+
+  void* mapping = mmap(nullptr, file_size_, PROT_READ | PROT_WRITE,
+                       MAP_SHARED, fd, 0);
+  close(fd);  // The mapping keeps the file alive.
+  if (mapping == MAP_FAILED) {
+    SpielFatalError(absl::StrCat("Failed to map ring file: ", filename));
+  }
+  data_ = static_cast<char*>(mapping);
+
+  Header* header = reinterpret_cast<Header*>(data_);
+  if (create) {
+    header->num_slots = num_slots_;
+    header->max_record_bytes = max_record_bytes_;
+    header->write_ticket.store(0, std::memory_order_relaxed);
+    header->read_ticket.store(0, std::memory_order_relaxed);
+    // Publish the magic last so attaching processes never see a
+    // half-initialized header.
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = kRingMagic;
+  } else {
+    if (header->magic != kRingMagic) {
+      SpielFatalError(absl::StrCat("Not a trajectory ring (or not yet "
+                                   "created): ", filename));
+    }
+    if (header->num_slots != num_slots_ ||
+        header->max_record_bytes != max_record_bytes_) {
+      SpielFatalError(absl::StrCat(
+          "Ring geometry mismatch for ", filename, ": file has ",
+          header->num_slots, " slots of ", header->max_record_bytes,
+          " bytes, expected ", num_slots_, " slots of ", max_record_bytes_,
+          " bytes."));
+    }
+  }
+#endif
+}
+
+ShmTrajectoryRing::~ShmTrajectoryRing() {
+#ifndef _WIN32
+  if (data_ != nullptr) {
+    munmap(data_, file_size_);
+  }
+#endif
+}
+
+char* ShmTrajectoryRing::SlotAt(int64_t index) const {
+  return data_ + sizeof(Header) + index * slot_size_;
+}
+
+bool ShmTrajectoryRing::Push(const std::vector<char>& record,
+                             absl::Duration timeout) {
+  SPIEL_CHECK_LE(static_cast<int64_t>(record.size()), max_record_bytes_);
+  Header* header = reinterpret_cast<Header*>(data_);
+  uint64_t ticket =
+      header->write_ticket.fetch_add(1, std::memory_order_relaxed);
+  char* slot = SlotAt(ticket % num_slots_);
+  std::atomic<uint64_t>* state = SlotState(slot);
+
+  // The slot may still hold the record from num_slots tickets ago; wait for
+  // the consumer to drain it. The ticket is already claimed, so on timeout
+  // the slot is left empty-claimed and the consumer will simply wait for it -
+  // callers should treat a false return as "shutting down", matching how
+  // ThreadedQueue::Push timeouts are handled by the actors.
+  absl::Time deadline = absl::Now() + timeout;
+  uint64_t expected = kSlotEmpty;
+  while (!state->compare_exchange_weak(expected, kSlotWriting,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed)) {
+    expected = kSlotEmpty;
+    if (absl::Now() >= deadline) return false;
+    absl::SleepFor(kPollInterval);
+  }
+
+  int64_t size = record.size();
+  std::memcpy(slot + sizeof(std::atomic<uint64_t>), &size, sizeof(size));
+  std::memcpy(slot + sizeof(std::atomic<uint64_t>) + sizeof(int64_t),
+              record.data(), record.size());
+  state->store(kSlotReady, std::memory_order_release);
+  return true;
+}
+
+bool ShmTrajectoryRing::Pop(std::vector<char>* record,
+                            absl::Duration timeout) {
+  Header* header = reinterpret_cast<Header*>(data_);
+  uint64_t ticket = header->read_ticket.load(std::memory_order_relaxed);
+  char* slot = SlotAt(ticket % num_slots_);
+  std::atomic<uint64_t>* state = SlotState(slot);
+
+  absl::Time deadline = absl::Now() + timeout;
+  while (state->load(std::memory_order_acquire) != kSlotReady) {
+    if (absl::Now() >= deadline) return false;
+    absl::SleepFor(kPollInterval);
+  }
+
+  int64_t size;
+  std::memcpy(&size, slot + sizeof(std::atomic<uint64_t>), sizeof(size));
+  record->resize(size);
+  std::memcpy(record->data(),
+              slot + sizeof(std::atomic<uint64_t>) + sizeof(int64_t), size);
+  state->store(kSlotEmpty, std::memory_order_release);
+  header->read_ticket.store(ticket + 1, std::memory_order_relaxed);
+  return true;
+}
+
+int64_t ShmTrajectoryRing::ApproxSize() const {
+  const Header* header = reinterpret_cast<const Header*>(data_);
+  return header->write_ticket.load(std::memory_order_relaxed) -
+         header->read_ticket.load(std::memory_order_relaxed);
+}
+
+}  // namespace torch_az
+}  // namespace algorithms
+}  // namespace open_spiel
@@ -0,0 +1,91 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_SHM_TRAJECTORY_RING_H_
+#define OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_SHM_TRAJECTORY_RING_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace torch_az {
+
+// A file-backed shared-memory ring for passing serialized trajectories from
+// actor processes to the learner without any per-record protocol or proto
+// serialization: producers memcpy a flat record into a mapped slot and the
+// consumer memcpys it back out of the same physical pages.
+//
+// The ring is a fixed number of fixed-size slots, multi-producer (any number
+// of actor processes) and single-consumer (the learner). Producers claim a
+// slot with an atomic ticket counter and publish it with a release store on
+// the slot's state word; no locks are taken, so a producer can never block
+// the learner or another producer except through backpressure when the ring
+// is full. All coordination state lives in the mapping itself, so it works
+// identically for threads in one process and for separate processes mapping
+// the same file (MAP_SHARED, as in MmapInfoStateStore).
+//
+// A record is an opaque byte string up to max_record_bytes long; callers
+// define the layout (see SerializeTrajectory in alpha_zero.cc). A crashed
+// producer can permanently leak its claimed slot; the ring is transport for
+// restartable self-play data, not durable storage, so the recovery story is
+// to recreate the file.
+//
+// POSIX-only (like MmapInfoStateStore); not available on Windows.
+class ShmTrajectoryRing {
+ public:
+  // Creates `filename` with `num_slots` slots of `max_record_bytes` each
+  // (create = true, learner side), or attaches to an existing ring
+  // (create = false, actor side), in which case the geometry must match the
+  // file header.
+  ShmTrajectoryRing(const std::string& filename, int64_t num_slots,
+                    int64_t max_record_bytes, bool create);
+  ~ShmTrajectoryRing();
+
+  ShmTrajectoryRing(const ShmTrajectoryRing&) = delete;
+  ShmTrajectoryRing& operator=(const ShmTrajectoryRing&) = delete;
+
+  // Copies the record into the next free slot. Blocks (polling) while the
+  // ring is full; returns false if `timeout` elapses first.
+  bool Push(const std::vector<char>& record, absl::Duration timeout);
+
+  // Pops the oldest record into *record. Returns false if none arrives
+  // within `timeout`. Only one consumer may call this.
+  bool Pop(std::vector<char>* record, absl::Duration timeout);
+
+  // Records currently committed and not yet consumed (approximate: producers
+  // may be mid-write).
+  int64_t ApproxSize() const;
+
+  int64_t num_slots() const { return num_slots_; }
+  int64_t max_record_bytes() const { return max_record_bytes_; }
+
+ private:
+  char* SlotAt(int64_t index) const;
+
+  const int64_t num_slots_;
+  const int64_t max_record_bytes_;
+  int64_t slot_size_ = 0;
+  int64_t file_size_ = 0;
+  char* data_ = nullptr;  // The whole mapping; slots start after the header.
+};
+
+}  // namespace torch_az
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_ALPHA_ZERO_TORCH_SHM_TRAJECTORY_RING_H_
@@ -0,0 +1,139 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/alpha_zero_torch/shm_trajectory_ring.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace torch_az {
+namespace {
+
+std::string TestFile(const std::string& name) {
+  return absl::StrCat(std::getenv("TMPDIR") ? std::getenv("TMPDIR") : "/tmp",
+                      "/", name);
+}
+
+std::vector<char> MakeRecord(int seed, int size) {
+  std::vector<char> record(size);
+  for (int i = 0; i < size; ++i) {
+    record[i] = static_cast<char>((seed * 31 + i) % 127);
+  }
+  return record;
+}
+
+void RoundTripTest() {
+  std::string filename = TestFile("shm_ring_test_roundtrip.shm");
+  std::remove(filename.c_str());
+  ShmTrajectoryRing ring(filename, /*num_slots=*/4, /*max_record_bytes=*/64,
+                         /*create=*/true);
+  SPIEL_CHECK_EQ(ring.ApproxSize(), 0);
+
+  SPIEL_CHECK_TRUE(ring.Push(MakeRecord(1, 10), absl::Seconds(1)));
+  SPIEL_CHECK_TRUE(ring.Push(MakeRecord(2, 64), absl::Seconds(1)));
+  SPIEL_CHECK_EQ(ring.ApproxSize(), 2);
+
+  std::vector<char> record;
+  SPIEL_CHECK_TRUE(ring.Pop(&record, absl::Seconds(1)));
+  SPIEL_CHECK_TRUE(record == MakeRecord(1, 10));
+  SPIEL_CHECK_TRUE(ring.Pop(&record, absl::Seconds(1)));
+  SPIEL_CHECK_TRUE(record == MakeRecord(2, 64));
+  SPIEL_CHECK_EQ(ring.ApproxSize(), 0);
+
+  // Empty ring: Pop times out.
+  SPIEL_CHECK_FALSE(ring.Pop(&record, absl::Milliseconds(5)));
+
+  std::remove(filename.c_str());
+}
+
+void SecondMappingSeesRecordsTest() {
+  // Two mappings of the same file, as with separate processes.
+  std::string filename = TestFile("shm_ring_test_attach.shm");
+  std::remove(filename.c_str());
+  ShmTrajectoryRing consumer(filename, /*num_slots=*/4,
+                             /*max_record_bytes=*/64, /*create=*/true);
+  ShmTrajectoryRing producer(filename, /*num_slots=*/4,
+                             /*max_record_bytes=*/64, /*create=*/false);
+
+  SPIEL_CHECK_TRUE(producer.Push(MakeRecord(7, 33), absl::Seconds(1)));
+  std::vector<char> record;
+  SPIEL_CHECK_TRUE(consumer.Pop(&record, absl::Seconds(1)));
+  SPIEL_CHECK_TRUE(record == MakeRecord(7, 33));
+
+  std::remove(filename.c_str());
+}
+
+void ConcurrentProducersTest() {
+  std::string filename = TestFile("shm_ring_test_concurrent.shm");
+  std::remove(filename.c_str());
+  // A small ring so the producers exercise the backpressure path.
+  ShmTrajectoryRing ring(filename, /*num_slots=*/2, /*max_record_bytes=*/16,
+                         /*create=*/true);
+
+  constexpr int kProducers = 4;
+  constexpr int kPerProducer = 50;
+  std::vector<Thread> producers;
+  producers.reserve(kProducers);
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&ring, p]() {
+      for (int i = 0; i < kPerProducer; ++i) {
+        SPIEL_CHECK_TRUE(ring.Push(MakeRecord(p, 16), absl::Seconds(30)));
+      }
+    });
+  }
+
+  std::vector<int> counts(kProducers, 0);
+  std::vector<char> record;
+  for (int i = 0; i < kProducers * kPerProducer; ++i) {
+    SPIEL_CHECK_TRUE(ring.Pop(&record, absl::Seconds(30)));
+    bool matched = false;
+    for (int p = 0; p < kProducers; ++p) {
+      if (record == MakeRecord(p, 16)) {
+        counts[p] += 1;
+        matched = true;
+        break;
+      }
+    }
+    SPIEL_CHECK_TRUE(matched);
+  }
+  for (Thread& producer : producers) {
+    producer.join();
+  }
+  for (int p = 0; p < kProducers; ++p) {
+    SPIEL_CHECK_EQ(counts[p], kPerProducer);
+  }
+  SPIEL_CHECK_EQ(ring.ApproxSize(), 0);
+
+  std::remove(filename.c_str());
+}
+
+}  // namespace
+}  // namespace torch_az
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::torch_az::RoundTripTest();
+  open_spiel::algorithms::torch_az::SecondMappingSeesRecordsTest();
+  open_spiel::algorithms::torch_az::ConcurrentProducersTest();
+}
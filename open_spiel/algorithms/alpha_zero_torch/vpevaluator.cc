@@ -14,6 +14,8 @@
 
 #include "open_spiel/algorithms/alpha_zero_torch/vpevaluator.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <memory>
 
@@ -26,18 +28,15 @@ namespace algorithms {
 namespace torch_az {
 
 VPNetEvaluator::VPNetEvaluator(DeviceManager* device_manager, int batch_size,
-                               int threads, int cache_size, int cache_shards)
+                               int threads, int cache_size, int cache_shards,
+                               int max_wait_micros)
     : device_manager_(*device_manager),
+      cache_(cache_size, cache_shards),
       batch_size_(batch_size),
+      max_wait_(absl::Microseconds(max_wait_micros)),
       queue_(batch_size * threads * 4),
+      collect_target_(batch_size),
       batch_size_hist_(batch_size + 1) {
-  cache_shards = std::max(1, cache_shards);
-  cache_.reserve(cache_shards);
-  for (int i = 0; i < cache_shards; ++i) {
-    cache_.push_back(
-        std::make_unique<LRUCache<uint64_t, VPNetModel::InferenceOutputs>>(
-            cache_size / cache_shards));
-  }
   if (batch_size_ <= 1) {
     threads = 0;
   }
@@ -56,19 +55,9 @@ VPNetEvaluator::~VPNetEvaluator() {
   }
 }
 
-void VPNetEvaluator::ClearCache() {
-  for (auto& c : cache_) {
-    c->Clear();
-  }
-}
+void VPNetEvaluator::ClearCache() { cache_.Clear(); }
 
-LRUCacheInfo VPNetEvaluator::CacheInfo() {
-  LRUCacheInfo info;
-  for (auto& c : cache_) {
-    info += c->Info();
-  }
-  return info;
-}
+LRUCacheInfo VPNetEvaluator::CacheInfo() { return cache_.Info(); }
 
 std::vector<double> VPNetEvaluator::Evaluate(const State& state) {
   // TODO(author5): currently assumes zero-sum.
@@ -88,16 +77,11 @@ VPNetModel::InferenceOutputs VPNetEvaluator::Inference(const State& state) {
   VPNetModel::InferenceInputs inputs = {state.LegalActions(),
                                         state.ObservationTensor()};
 
-  uint64_t key;
-  int cache_shard;
-  if (!cache_.empty()) {
-    key = absl::Hash<VPNetModel::InferenceInputs>{}(inputs);
-    cache_shard = key % cache_.size();
-    absl::optional<const VPNetModel::InferenceOutputs> opt_outputs =
-        cache_[cache_shard]->Get(key);
-    if (opt_outputs) {
-      return *opt_outputs;
-    }
+  uint64_t key = absl::Hash<VPNetModel::InferenceInputs>{}(inputs);
+  absl::optional<const VPNetModel::InferenceOutputs> opt_outputs =
+      cache_.Get(key);
+  if (opt_outputs) {
+    return *opt_outputs;
   }
   VPNetModel::InferenceOutputs outputs;
   if (batch_size_ <= 1) {
@@ -108,9 +92,7 @@ VPNetModel::InferenceOutputs VPNetEvaluator::Inference(const State& state) {
     queue_.Push(QueueItem{inputs, &prom});
     outputs = fut.get();
   }
-  if (!cache_.empty()) {
-    cache_[cache_shard]->Set(key, outputs);
-  }
+  cache_.Set(key, outputs);
   return outputs;
 }
 
@@ -124,18 +106,38 @@ void VPNetEvaluator::Runner() {
       // Only one thread at a time should be listening to the queue to maximize
       // batch size and minimize latency.
       absl::MutexLock lock(&inference_queue_m_);
+      const int target = collect_target_;
+      bool hit_deadline = false;
       absl::Time deadline = absl::InfiniteFuture();
-      for (int i = 0; i < batch_size_; ++i) {
+      for (int i = 0; i < target; ++i) {
         absl::optional<QueueItem> item = queue_.Pop(deadline);
-        if (!item) {  // Hit the deadline.
+        if (!item) {
+          hit_deadline = true;
           break;
         }
         if (inputs.empty()) {
-          deadline = absl::Now() + absl::Milliseconds(1);
+          deadline = absl::Now() + max_wait_;
         }
         inputs.push_back(item->inputs);
         promises.push_back(item->prom);
       }
+      if (!inputs.empty()) {
+        if (hit_deadline) {
+          // The arrivals ran dry before the target, so shrink the target
+          // toward what actually showed up rather than letting the next batch
+          // idle-wait out its full deadline again.
+          batch_fill_ewma_ =
+              batch_fill_ewma_ <= 0
+                  ? inputs.size()
+                  : 0.75 * batch_fill_ewma_ + 0.25 * inputs.size();
+          collect_target_ = std::clamp<int>(
+              static_cast<int>(std::ceil(batch_fill_ewma_)), 1, batch_size_);
+        } else {
+          // Filled before the deadline: demand may be higher than the current
+          // target, so probe upward.
+          collect_target_ = std::min(collect_target_ * 2, batch_size_);
+        }
+      }
     }
 
     if (inputs.empty()) {  // Almost certainly StopRequested.
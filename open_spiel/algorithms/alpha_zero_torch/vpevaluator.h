@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/hash/hash.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/algorithms/alpha_zero_torch/device_manager.h"
 #include "open_spiel/algorithms/alpha_zero_torch/vpnet.h"
 #include "open_spiel/algorithms/mcts.h"
@@ -34,8 +35,16 @@ namespace torch_az {
 
 class VPNetEvaluator : public Evaluator {
  public:
+  // batch_size is an upper bound on the inference batch, not a quota: a batch
+  // is sent to the device once max_wait_micros has elapsed since its first
+  // request, and the number of requests a batch waits for adapts to the
+  // recent arrival rate, so a few actors don't stall waiting for a full batch
+  // and many actors don't convoy behind the deadline. With threads > 1,
+  // several batches are collected and inferred concurrently, spread across
+  // devices by the DeviceManager.
   explicit VPNetEvaluator(DeviceManager* device_manager, int batch_size,
-                          int threads, int cache_size, int cache_shards = 1);
+                          int threads, int cache_size, int cache_shards = 1,
+                          int max_wait_micros = 1000);
   ~VPNetEvaluator() override;
 
   // Return a value of this state for each player.
@@ -57,8 +66,7 @@ class VPNetEvaluator : public Evaluator {
   void Runner();
 
   DeviceManager& device_manager_;
-  std::vector<std::unique_ptr<LRUCache<uint64_t, VPNetModel::InferenceOutputs>>>
-      cache_;
+  ShardedLRUCache<uint64_t, VPNetModel::InferenceOutputs> cache_;
   const int batch_size_;
 
   struct QueueItem {
@@ -66,10 +74,16 @@ class VPNetEvaluator : public Evaluator {
     std::promise<VPNetModel::InferenceOutputs>* prom;
   };
 
+  const absl::Duration max_wait_;
+
   ThreadedQueue<QueueItem> queue_;
   StopToken stop_;
   std::vector<Thread> inference_threads_;
   absl::Mutex inference_queue_m_;  // Only one thread at a time should pop.
+  // How many requests the collecting thread waits for before running
+  // inference, adapted from recent batches. Guarded by inference_queue_m_.
+  int collect_target_;
+  double batch_fill_ewma_ = 0;  // Guarded by inference_queue_m_.
 
   absl::Mutex stats_m_;
   open_spiel::BasicStats batch_size_stats_;
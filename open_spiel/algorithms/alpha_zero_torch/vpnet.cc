@@ -16,14 +16,22 @@
 
 #include <torch/torch.h>
 
+#include <cstdio>   // For std::rename.
+#include <cstring>  // For memcpy.
+#include <deque>
 #include <fstream>  // For ifstream/ofstream.
+#include <memory>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 #include "open_spiel/algorithms/alpha_zero_torch/model.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -85,6 +93,18 @@ std::string TorchDeviceName(const std::string& device) {
   return device;
 }
 
+// Writes `contents` under a temporary name and renames it over `path`, so a
+// concurrent reader of `path` sees either the previous file or the complete
+// new one, never a partial write.
+void WriteFileAtomically(const std::string& path, const std::string& contents) {
+  std::string tmp_path = absl::StrCat(path, ".tmp");
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), contents.size());
+  }
+  std::rename(tmp_path.c_str(), path.c_str());
+}
+
 bool CreateGraphDef(const Game& game, double learning_rate, double weight_decay,
                     const std::string& path, const std::string& filename,
                     std::string nn_model, int nn_width, int nn_depth,
@@ -124,6 +144,76 @@ VPNetModel::VPNetModel(const Game& game, const std::string& path,
   model_->to(torch_device_);
 }
 
+// A single background thread draining a queue of (path, snapshot) jobs in
+// order. Each file is written under a temporary name and atomically renamed
+// into place; the model file is published before the optimizer file, so a
+// reader that only needs weights gets them as early as possible.
+struct VPNetModel::AsyncCheckpointWriter {
+  AsyncCheckpointWriter() : thread([this]() { Run(); }) {}
+
+  ~AsyncCheckpointWriter() {
+    {
+      absl::MutexLock lock(&mutex);
+      stop = true;
+    }
+    thread.join();
+  }
+
+  void Enqueue(std::string path,
+               std::shared_ptr<const CheckpointSnapshot> snapshot) {
+    absl::MutexLock lock(&mutex);
+    jobs.emplace_back(std::move(path), std::move(snapshot));
+  }
+
+  void Finish() {
+    absl::MutexLock lock(&mutex);
+    mutex.Await(absl::Condition(
+        +[](AsyncCheckpointWriter* writer) {
+          return writer->jobs.empty() && !writer->writing;
+        },
+        this));
+  }
+
+  void Run() {
+    while (true) {
+      std::pair<std::string, std::shared_ptr<const CheckpointSnapshot>> job;
+      {
+        absl::MutexLock lock(&mutex);
+        mutex.Await(absl::Condition(
+            +[](AsyncCheckpointWriter* writer) {
+              return writer->stop || !writer->jobs.empty();
+            },
+            this));
+        if (jobs.empty()) return;  // Stopped and fully drained.
+        job = std::move(jobs.front());
+        jobs.pop_front();
+        writing = true;
+      }
+      WriteFileAtomically(absl::StrCat(job.first, ".pt"),
+                          job.second->model_bytes);
+      WriteFileAtomically(absl::StrCat(job.first, "-optimizer.pt"),
+                          job.second->optimizer_bytes);
+      {
+        absl::MutexLock lock(&mutex);
+        writing = false;
+      }
+    }
+  }
+
+  absl::Mutex mutex;
+  std::deque<std::pair<std::string, std::shared_ptr<const CheckpointSnapshot>>>
+      jobs;
+  bool writing = false;
+  bool stop = false;
+  // Last so the thread starts after the state above is initialized.
+  Thread thread;
+};
+
+// Out of line so AsyncCheckpointWriter is complete where these are generated.
+VPNetModel::~VPNetModel() = default;
+VPNetModel::VPNetModel(VPNetModel&& other) = default;
+VPNetModel& VPNetModel::operator=(VPNetModel&& other) = default;
+
 std::string VPNetModel::SaveCheckpoint(int step) {
   std::string full_path = absl::StrCat(path_, "/checkpoint-", step);
 
@@ -133,6 +223,32 @@ std::string VPNetModel::SaveCheckpoint(int step) {
   return full_path;
 }
 
+std::string VPNetModel::SaveCheckpointAsync(int step) {
+  std::string full_path = absl::StrCat(path_, "/checkpoint-", step);
+
+  auto snapshot = std::make_shared<CheckpointSnapshot>();
+  std::ostringstream model_stream;
+  torch::save(model_, model_stream);
+  snapshot->model_bytes = model_stream.str();
+  std::ostringstream optimizer_stream;
+  torch::save(model_optimizer_, optimizer_stream);
+  snapshot->optimizer_bytes = optimizer_stream.str();
+  last_snapshot_ = snapshot;
+
+  if (async_writer_ == nullptr) {
+    async_writer_ = std::make_unique<AsyncCheckpointWriter>();
+  }
+  async_writer_->Enqueue(full_path, std::move(snapshot));
+
+  return full_path;
+}
+
+void VPNetModel::FinishPendingCheckpoints() {
+  if (async_writer_ != nullptr) {
+    async_writer_->Finish();
+  }
+}
+
 void VPNetModel::LoadCheckpoint(int step) {
   // Load checkpoint from the path given at its initialization.
   LoadCheckpoint(absl::StrCat(path_, "/checkpoint-", step));
@@ -142,6 +258,38 @@ void VPNetModel::LoadCheckpoint(const std::string& path) {
   torch::load(model_, absl::StrCat(path, ".pt"), torch_device_);
   torch::load(model_optimizer_, absl::StrCat(path, "-optimizer.pt"),
               torch_device_);
+  fp16_model_stale_ = true;
+}
+
+void VPNetModel::LoadCheckpoint(const CheckpointSnapshot& snapshot) {
+  std::istringstream model_stream(snapshot.model_bytes);
+  torch::load(model_, model_stream, torch_device_);
+  std::istringstream optimizer_stream(snapshot.optimizer_bytes);
+  torch::load(model_optimizer_, optimizer_stream, torch_device_);
+  fp16_model_stale_ = true;
+}
+
+void VPNetModel::SetFP16Inference(bool enabled) {
+  // Half precision is only well supported (and only a win) on CUDA.
+  fp16_inference_ = enabled && torch_device_.is_cuda();
+  fp16_model_stale_ = true;
+}
+
+void VPNetModel::RefreshFP16Model() {
+  if (fp16_model_ == nullptr) {
+    fp16_model_ =
+        std::make_unique<Model>(model_config_, TorchDeviceName(device_));
+  }
+  // Round-trip the fp32 weights through a host buffer into the copy, then
+  // halve it. This reuses the checkpoint machinery rather than pairing up
+  // parameters by hand.
+  std::ostringstream stream;
+  torch::save(model_, stream);
+  std::istringstream in(stream.str());
+  torch::load(*fp16_model_, in, torch_device_);
+  (*fp16_model_)->to(torch_device_, torch::kHalf);
+  (*fp16_model_)->eval();
+  fp16_model_stale_ = false;
 }
 
 std::vector<VPNetModel::InferenceOutputs> VPNetModel::Inference(
@@ -152,31 +300,53 @@ std::vector<VPNetModel::InferenceOutputs> VPNetModel::Inference(
   //   - Their default data type is a 32-bit float
   //   - Use the byte data type for boolean
 
-  torch::Tensor torch_inf_inputs =
-      torch::empty({inference_batch_size, flat_input_size_}, torch_device_);
-  torch::Tensor torch_inf_legal_mask = torch::full(
-      {inference_batch_size, num_actions_}, false,
-      torch::TensorOptions().dtype(torch::kByte).device(torch_device_));
-
+  // Stage the batch in host memory and move it to the device in one transfer.
+  // Writing elements of a device tensor directly (the previous approach)
+  // issues one device op per element. Pinned host memory lets the copy run as
+  // an async DMA on CUDA devices.
+  const bool pin = torch_device_.is_cuda();
+  torch::Tensor host_inputs = torch::empty(
+      {inference_batch_size, flat_input_size_},
+      torch::TensorOptions().dtype(torch::kFloat32).pinned_memory(pin));
+  torch::Tensor host_legal_mask = torch::zeros(
+      {inference_batch_size, num_actions_},
+      torch::TensorOptions().dtype(torch::kByte).pinned_memory(pin));
+
+  float* input_data = host_inputs.data_ptr<float>();
+  uint8_t* mask_data = host_legal_mask.data_ptr<uint8_t>();
   for (int batch = 0; batch < inference_batch_size; ++batch) {
-    // Copy legal mask(s) to a Torch tensor.
     for (Action action : inputs[batch].legal_actions) {
-      torch_inf_legal_mask[batch][action] = true;
-    }
-
-    // Copy the observation(s) to a Torch tensor.
-    for (int i = 0; i < inputs[batch].observations.size(); ++i) {
-      torch_inf_inputs[batch][i] = inputs[batch].observations[i];
+      mask_data[batch * num_actions_ + action] = 1;
     }
+    std::memcpy(input_data + batch * flat_input_size_,
+                inputs[batch].observations.data(),
+                inputs[batch].observations.size() * sizeof(float));
   }
 
-  // Run the inference.
-  model_->eval();
-  std::vector<torch::Tensor> torch_outputs =
-      model_(torch_inf_inputs, torch_inf_legal_mask);
+  torch::Tensor torch_inf_inputs =
+      host_inputs.to(torch_device_, /*non_blocking=*/pin);
+  torch::Tensor torch_inf_legal_mask =
+      host_legal_mask.to(torch_device_, /*non_blocking=*/pin);
+
+  // Run the inference. Nothing here ever needs gradients, so stop autograd
+  // from recording the forward pass.
+  torch::NoGradGuard no_grad;
+  std::vector<torch::Tensor> torch_outputs;
+  if (fp16_inference_) {
+    if (fp16_model_stale_) RefreshFP16Model();
+    torch_outputs = (*fp16_model_)(torch_inf_inputs.to(torch::kHalf),
+                                   torch_inf_legal_mask);
+  } else {
+    model_->eval();
+    torch_outputs = model_(torch_inf_inputs, torch_inf_legal_mask);
+  }
 
-  torch::Tensor value_batch = torch_outputs[0];
-  torch::Tensor policy_batch = torch_outputs[1];
+  // One device-to-host transfer per output head, rather than a synchronizing
+  // item<>() call per element; results are fp32 regardless of the forward
+  // pass precision.
+  torch::Tensor value_batch = torch_outputs[0].to(torch::kCPU, torch::kFloat);
+  torch::Tensor policy_batch = torch_outputs[1].to(torch::kCPU, torch::kFloat);
+  auto policy_accessor = policy_batch.accessor<float, 2>();
 
   // Copy the Torch tensor output to the appropriate structure.
   std::vector<InferenceOutputs> output;
@@ -187,8 +357,7 @@ std::vector<VPNetModel::InferenceOutputs> VPNetModel::Inference(
     ActionsAndProbs state_policy;
     state_policy.reserve(inputs[batch].legal_actions.size());
     for (Action action : inputs[batch].legal_actions) {
-      state_policy.push_back(
-          {action, policy_batch[batch][action].item<float>()});
+      state_policy.push_back({action, policy_accessor[batch][action]});
     }
 
     output.push_back({value, state_policy});
@@ -197,41 +366,88 @@ std::vector<VPNetModel::InferenceOutputs> VPNetModel::Inference(
   return output;
 }
 
-VPNetModel::LossInfo VPNetModel::Learn(const std::vector<TrainInputs>& inputs) {
+VPNetModel::LossInfo VPNetModel::Learn(
+    const std::vector<TrainInputs>& inputs,
+    const std::vector<double>& sample_weights,
+    std::vector<double>* per_sample_losses) {
+  LossInfo losses = ComputeGradients(inputs, sample_weights,
+                                     per_sample_losses);
+
+  model_optimizer_.step();
+  fp16_model_stale_ = true;
+
+  return losses;
+}
+
+VPNetModel::LossInfo VPNetModel::ComputeGradients(
+    const std::vector<TrainInputs>& inputs,
+    const std::vector<double>& sample_weights,
+    std::vector<double>* per_sample_losses) {
   int training_batch_size = inputs.size();
+  SPIEL_CHECK_TRUE(sample_weights.empty() ||
+                   sample_weights.size() == inputs.size());
 
   // Torch tensors by default use a dense, row-aligned memory layout.
   //   - Their default data type is a 32-bit float
   //   - Use the byte data type for boolean
 
-  torch::Tensor torch_train_inputs =
-      torch::empty({training_batch_size, flat_input_size_}, torch_device_);
-  torch::Tensor torch_train_legal_mask = torch::full(
-      {training_batch_size, num_actions_}, false,
-      torch::TensorOptions().dtype(torch::kByte).device(torch_device_));
-  torch::Tensor torch_policy_targets =
-      torch::zeros({training_batch_size, num_actions_}, torch_device_);
-  torch::Tensor torch_value_targets =
-      torch::empty({training_batch_size, 1}, torch_device_);
-
+  // As in Inference, stage the batch in (pinned) host memory and move it to
+  // the device in one transfer per tensor.
+  const bool pin = torch_device_.is_cuda();
+  torch::Tensor host_inputs = torch::empty(
+      {training_batch_size, flat_input_size_},
+      torch::TensorOptions().dtype(torch::kFloat32).pinned_memory(pin));
+  torch::Tensor host_legal_mask = torch::zeros(
+      {training_batch_size, num_actions_},
+      torch::TensorOptions().dtype(torch::kByte).pinned_memory(pin));
+  torch::Tensor host_policy_targets = torch::zeros(
+      {training_batch_size, num_actions_},
+      torch::TensorOptions().dtype(torch::kFloat32).pinned_memory(pin));
+  torch::Tensor host_value_targets = torch::empty(
+      {training_batch_size, 1},
+      torch::TensorOptions().dtype(torch::kFloat32).pinned_memory(pin));
+
+  float* input_data = host_inputs.data_ptr<float>();
+  uint8_t* mask_data = host_legal_mask.data_ptr<uint8_t>();
+  float* policy_data = host_policy_targets.data_ptr<float>();
+  float* value_data = host_value_targets.data_ptr<float>();
   for (int batch = 0; batch < training_batch_size; ++batch) {
-    // Copy the legal mask(s) to a Torch tensor.
+    // Copy the legal mask(s).
     for (Action action : inputs[batch].legal_actions) {
-      torch_train_legal_mask[batch][action] = true;
+      mask_data[batch * num_actions_ + action] = 1;
     }
 
-    // Copy the observation(s) to a Torch tensor.
-    for (int i = 0; i < inputs[batch].observations.size(); ++i) {
-      torch_train_inputs[batch][i] = inputs[batch].observations[i];
-    }
+    // Copy the observation(s).
+    std::memcpy(input_data + batch * flat_input_size_,
+                inputs[batch].observations.data(),
+                inputs[batch].observations.size() * sizeof(float));
 
-    // Copy the policy target(s) to a Torch tensor.
+    // Copy the policy target(s).
     for (const auto& [action, probability] : inputs[batch].policy) {
-      torch_policy_targets[batch][action] = probability;
+      policy_data[batch * num_actions_ + action] = probability;
     }
 
-    // Copy the value target(s) to a Torch tensor.
-    torch_value_targets[batch][0] = inputs[batch].value;
+    // Copy the value target(s).
+    value_data[batch] = inputs[batch].value;
+  }
+
+  torch::Tensor torch_train_inputs =
+      host_inputs.to(torch_device_, /*non_blocking=*/pin);
+  torch::Tensor torch_train_legal_mask =
+      host_legal_mask.to(torch_device_, /*non_blocking=*/pin);
+  torch::Tensor torch_policy_targets =
+      host_policy_targets.to(torch_device_, /*non_blocking=*/pin);
+  torch::Tensor torch_value_targets =
+      host_value_targets.to(torch_device_, /*non_blocking=*/pin);
+
+  torch::Tensor torch_sample_weights;
+  if (!sample_weights.empty()) {
+    torch_sample_weights =
+        torch::from_blob(const_cast<double*>(sample_weights.data()),
+                         {training_batch_size},
+                         torch::TensorOptions().dtype(torch::kFloat64))
+            .to(torch::kFloat32)
+            .to(torch_device_, /*non_blocking=*/pin);
   }
 
   // Run a training step and get the losses.
@@ -240,20 +456,64 @@ VPNetModel::LossInfo VPNetModel::Learn(const std::vector<TrainInputs>& inputs) {
 
   std::vector<torch::Tensor> torch_outputs =
       model_->losses(torch_train_inputs, torch_train_legal_mask,
-                     torch_policy_targets, torch_value_targets);
+                     torch_policy_targets, torch_value_targets,
+                     torch_sample_weights);
 
   torch::Tensor total_loss =
       torch_outputs[0] + torch_outputs[1] + torch_outputs[2];
 
   total_loss.backward();
 
-  model_optimizer_.step();
+  if (per_sample_losses != nullptr) {
+    torch::Tensor host_losses =
+        torch_outputs[3].to(torch::kCPU).to(torch::kFloat64).contiguous();
+    const double* loss_data = host_losses.data_ptr<double>();
+    per_sample_losses->assign(loss_data, loss_data + training_batch_size);
+  }
 
   return LossInfo(torch_outputs[0].item<float>(),
                   torch_outputs[1].item<float>(),
                   torch_outputs[2].item<float>());
 }
 
+void VPNetModel::StepAveragingGradients(
+    const std::vector<VPNetModel*>& replicas) {
+  {
+    torch::NoGradGuard no_grad;
+    std::vector<torch::Tensor> params = model_->parameters();
+    const double scale = 1.0 / (1 + replicas.size());
+    for (int i = 0; i < params.size(); ++i) {
+      torch::Tensor grad = params[i].mutable_grad();
+      if (!grad.defined()) continue;
+      for (VPNetModel* replica : replicas) {
+        torch::Tensor replica_grad =
+            replica->model_->parameters()[i].mutable_grad();
+        if (replica_grad.defined()) {
+          grad.add_(replica_grad.to(torch_device_));
+        }
+      }
+      grad.mul_(scale);
+    }
+  }
+  model_optimizer_.step();
+  fp16_model_stale_ = true;
+}
+
+void VPNetModel::CopyWeightsFrom(const VPNetModel& other) {
+  torch::NoGradGuard no_grad;
+  std::vector<torch::Tensor> params = model_->parameters();
+  std::vector<torch::Tensor> other_params = other.model_->parameters();
+  for (int i = 0; i < params.size(); ++i) {
+    params[i].copy_(other_params[i].to(torch_device_));
+  }
+  std::vector<torch::Tensor> buffers = model_->buffers();
+  std::vector<torch::Tensor> other_buffers = other.model_->buffers();
+  for (int i = 0; i < buffers.size(); ++i) {
+    buffers[i].copy_(other_buffers[i].to(torch_device_));
+  }
+  fp16_model_stale_ = true;
+}
+
 }  // namespace torch_az
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -18,6 +18,7 @@
 #include <torch/torch.h>
 
 #include <nop/structure.h>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -79,9 +80,17 @@ class VPNetModel {
              observations == other.observations;
     }
 
+    // Bulk-hash both vectors as contiguous memory rather than element by
+    // element; observation tensors are hundreds of floats and this runs on
+    // every cache probe.
     template <typename H>
     friend H AbslHashValue(H h, const InferenceInputs& in) {
-      return H::combine(std::move(h), in.legal_actions, in.observations);
+      h = H::combine_contiguous(std::move(h), in.legal_actions.data(),
+                                in.legal_actions.size());
+      h = H::combine_contiguous(std::move(h), in.observations.data(),
+                                in.observations.size());
+      return H::combine(std::move(h), in.legal_actions.size(),
+                        in.observations.size());
     }
   };
 
@@ -106,13 +115,23 @@ class VPNetModel {
     kInvalidCheckpointStep = -2
   };
 
+  // A checkpoint serialized into host memory: the model and optimizer bytes
+  // as produced by torch::save. Taking the snapshot is the only part of an
+  // asynchronous checkpoint paid for on the calling thread.
+  struct CheckpointSnapshot {
+    std::string model_bytes;
+    std::string optimizer_bytes;
+  };
+
   VPNetModel(const Game &game, const std::string &path,
              const std::string &file_name,
              const std::string &device = "/cpu:0");
+  ~VPNetModel();
 
-  // Move only, not copyable.
-  VPNetModel(VPNetModel&& other) = default;
-  VPNetModel& operator=(VPNetModel&& other) = default;
+  // Move only, not copyable. Defined out of line because of the
+  // AsyncCheckpointWriter member, which is only forward-declared here.
+  VPNetModel(VPNetModel&& other);
+  VPNetModel& operator=(VPNetModel&& other);
   VPNetModel(const VPNetModel&) = delete;
   VPNetModel& operator=(const VPNetModel&) = delete;
 
@@ -120,12 +139,62 @@ class VPNetModel {
   std::vector<InferenceOutputs> Inference(
       const std::vector<InferenceInputs>& inputs);
 
-  // Training: do one (batch) step of neural net training
-  LossInfo Learn(const std::vector<TrainInputs>& inputs);
+  // Training: do one (batch) step of neural net training.
+  //
+  // The optional arguments serve prioritized replay: `sample_weights`
+  // (empty, or one importance weight per input) scales each sample's
+  // contribution to the batch loss, and when `per_sample_losses` is non-null
+  // it is filled with each sample's unweighted policy + value loss — the
+  // priorities to write back into the buffer.
+  LossInfo Learn(const std::vector<TrainInputs>& inputs,
+                 const std::vector<double>& sample_weights = {},
+                 std::vector<double>* per_sample_losses = nullptr);
+
+  // The pieces of Learn, for data-parallel training across devices: run the
+  // forward and backward pass, leaving the gradients in the model without
+  // stepping the optimizer.
+  LossInfo ComputeGradients(const std::vector<TrainInputs>& inputs,
+                            const std::vector<double>& sample_weights = {},
+                            std::vector<double>* per_sample_losses = nullptr);
+  // Averages this model's gradients with those of `replicas` (each holding
+  // gradients from its own shard of the batch, on its own device) and steps
+  // this model's optimizer. The replicas' weights are left untouched; bring
+  // them back in sync with CopyWeightsFrom afterwards.
+  void StepAveragingGradients(const std::vector<VPNetModel*>& replicas);
+  // Copies the model weights (parameters and buffers) from `other` onto this
+  // model's device. Optimizer state is not copied.
+  void CopyWeightsFrom(const VPNetModel& other);
 
   std::string SaveCheckpoint(int step);
+
+  // Like SaveCheckpoint, but the calling thread only serializes the model and
+  // optimizer into a host-memory snapshot; a background thread then writes
+  // the files under temporary names and renames each over its final name, so
+  // readers polling the returned path (e.g. actor processes reloading
+  // kMostRecentCheckpointStep between games) never observe a partially
+  // written file. Writes are published in call order.
+  std::string SaveCheckpointAsync(int step);
+
+  // The snapshot taken by the most recent SaveCheckpointAsync call (null
+  // before the first). Lets other in-process devices refresh their weights
+  // without waiting for the disk write.
+  std::shared_ptr<const CheckpointSnapshot> LastSnapshot() const {
+    return last_snapshot_;
+  }
+
+  // Blocks until every queued asynchronous checkpoint has been published.
+  void FinishPendingCheckpoints();
+
   void LoadCheckpoint(int step);
   void LoadCheckpoint(const std::string& path);
+  void LoadCheckpoint(const CheckpointSnapshot& snapshot);
+
+  // Enables (or disables) half-precision inference: Inference() then runs a
+  // dedicated fp16 copy of the network, refreshed from the fp32 weights
+  // whenever they change (Learn or LoadCheckpoint). Training, checkpoints
+  // and the value/policy results stay fp32; only the forward pass is
+  // halved. CPU devices ignore the setting — fp16 only pays off on CUDA.
+  void SetFP16Inference(bool enabled);
 
   std::string Device() const { return device_; }
 
@@ -150,6 +219,18 @@ class VPNetModel {
   Model model_;
   torch::optim::Adam model_optimizer_;
   torch::Device torch_device_;
+
+  // Background writer for SaveCheckpointAsync; created lazily on first use.
+  struct AsyncCheckpointWriter;
+  std::shared_ptr<const CheckpointSnapshot> last_snapshot_;
+  std::unique_ptr<AsyncCheckpointWriter> async_writer_;
+
+  // Half-precision copy of model_ used by Inference when fp16 inference is
+  // enabled; rebuilt lazily whenever the fp32 weights change.
+  void RefreshFP16Model();
+  bool fp16_inference_ = false;
+  bool fp16_model_stale_ = true;
+  std::unique_ptr<Model> fp16_model_;
 };
 
 }  // namespace torch_az
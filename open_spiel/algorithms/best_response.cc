@@ -17,11 +17,14 @@
 
 #include <cmath>
 #include <limits>
+#include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/btree_set.h"
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/algorithms/expected_returns.h"
 #include "open_spiel/algorithms/history_tree.h"
 #include "open_spiel/policy.h"
@@ -76,6 +79,183 @@ double TabularBestResponse::HandleTerminalCase(const HistoryNode& node) const {
   return node.GetValue();
 }
 
+void TabularBestResponse::EnsureIncrementalIndexes() {
+  // The tree never changes, so these two indexes are built exactly once.
+  if (parent_.empty()) {
+    std::vector<HistoryNode*> stack = {tree_.Root()};
+    while (!stack.empty()) {
+      HistoryNode* node = stack.back();
+      stack.pop_back();
+      if (node->GetType() == StateType::kDecision) {
+        infostate_histories_[node->GetInfoState()].push_back(node);
+      }
+      for (Action action : node->GetChildActions()) {
+        HistoryNode* child = node->GetChild(action).second;
+        parent_[child->GetHistory()] = {node, action};
+        stack.push_back(child);
+      }
+    }
+  }
+  // infosets_ is rebuilt by every full SetPolicy, so positions within it may
+  // be stale; rebuild lazily.
+  if (infoset_member_index_.empty()) {
+    for (const auto& [infostate, members] : infosets_) {
+      for (int i = 0; i < members.size(); ++i) {
+        infoset_member_index_[members[i].first] = i;
+      }
+    }
+  }
+}
+
+// Returns the counterfactual reach probability of `node` under the current
+// policy_: the product of all chance and non-best-responder policy
+// probabilities along the path from the root, treating the best responder's
+// own actions as probability one.
+double TabularBestResponse::CounterfactualReachProb(HistoryNode* node) const {
+  double cf_prob = 1.0;
+  auto it = parent_.find(node->GetHistory());
+  while (it != parent_.end()) {
+    auto [parent, action] = it->second;
+    if (parent->GetType() == StateType::kChance) {
+      cf_prob *= parent->GetChild(action).first;
+    } else if (parent->GetState()->CurrentPlayer() != best_responder_) {
+      cf_prob *= GetProb(policy_->GetStatePolicy(*parent->GetState()), action);
+    }
+    it = parent_.find(parent->GetHistory());
+  }
+  return cf_prob;
+}
+
+void TabularBestResponse::SetPolicy(
+    const Policy* policy, const std::vector<std::string>& changed_infostates) {
+  policy_ = policy;
+  EnsureIncrementalIndexes();
+
+  // Histories whose cached value may no longer be correct. Processed as a
+  // worklist: marking a history also marks its parent (a changed child value
+  // propagates up) and, for best-responder decisions, every history sharing
+  // its infoset (the joint best-response action may change), to a fixed
+  // point.
+  absl::flat_hash_set<std::string> dirty;
+  std::vector<HistoryNode*> worklist;
+  absl::flat_hash_set<std::string> reopened_infosets;
+
+  auto mark = [&](HistoryNode* node) {
+    if (dirty.insert(node->GetHistory()).second) {
+      value_cache_.erase(node->GetHistory());
+      worklist.push_back(node);
+    }
+  };
+
+  for (const std::string& changed : changed_infostates) {
+    auto histories_it = infostate_histories_.find(changed);
+    if (histories_it == infostate_histories_.end()) {
+      SpielFatalError(
+          absl::StrCat("SetPolicy: unknown changed infostate: ", changed));
+    }
+    for (HistoryNode* member : histories_it->second) {
+      // The member's own value changes (its action mix did), and the
+      // counterfactual reach probabilities of everything below it change, so
+      // the weights of descendant best-responder infosets must be rewritten
+      // before any best response is recomputed. The reach probability of the
+      // member itself is unaffected by a change at its own infostate, but is
+      // recomputed from scratch anyway (under the new policy) so that nested
+      // changed infostates come out right regardless of processing order.
+      mark(member);
+      std::vector<std::pair<HistoryNode*, double>> stack = {
+          {member, CounterfactualReachProb(member)}};
+      while (!stack.empty()) {
+        auto [node, cf_prob] = stack.back();
+        stack.pop_back();
+        const bool opponent_decision =
+            node->GetType() == StateType::kDecision &&
+            node->GetState()->CurrentPlayer() != best_responder_;
+        ActionsAndProbs state_policy;
+        if (opponent_decision) {
+          state_policy = policy_->GetStatePolicy(*node->GetState());
+        }
+        for (Action action : node->GetChildActions()) {
+          auto [edge_prob, child] = node->GetChild(action);
+          double factor = 1.0;
+          if (node->GetType() == StateType::kChance) {
+            factor = edge_prob;
+          } else if (opponent_decision) {
+            factor = GetProb(state_policy, action);
+          }
+          double child_cf_prob = cf_prob * factor;
+          if (child->GetType() == StateType::kDecision &&
+              child->GetState()->CurrentPlayer() == best_responder_) {
+            infosets_[child->GetInfoState()][infoset_member_index_.at(child)]
+                .second = child_cf_prob;
+            mark(child);
+          }
+          if (child->GetType() != StateType::kTerminal) {
+            stack.push_back({child, child_cf_prob});
+          }
+        }
+      }
+    }
+  }
+
+  for (int i = 0; i < worklist.size(); ++i) {
+    HistoryNode* node = worklist[i];
+    auto parent_it = parent_.find(node->GetHistory());
+    if (parent_it != parent_.end()) mark(parent_it->second.first);
+    if (node->GetType() == StateType::kDecision &&
+        node->GetState()->CurrentPlayer() == best_responder_) {
+      const std::string& infostate = node->GetInfoState();
+      if (reopened_infosets.insert(infostate).second) {
+        best_response_policy_.erase(infostate);
+        best_response_actions_.erase(infostate);
+        for (const auto& [other_member, cf_prob] : infosets_[infostate]) {
+          mark(other_member);
+        }
+      }
+    }
+  }
+}
+
+void TabularBestResponse::SetPolicyReusingTree(const Policy* policy) {
+  policy_ = policy;
+  value_cache_.clear();
+  best_response_actions_.clear();
+  best_response_policy_.clear();
+  EnsureIncrementalIndexes();
+
+  // One DFS over the cached tree carries the counterfactual reach
+  // probability down: chance edges multiply by their (policy-independent)
+  // stored probability, opponent decisions by the new policy, and the best
+  // responder's own actions by one. Each best-responder decision node's
+  // entry in infosets_ is rewritten in place.
+  std::vector<std::pair<HistoryNode*, double>> stack = {{tree_.Root(), 1.0}};
+  while (!stack.empty()) {
+    auto [node, cf_prob] = stack.back();
+    stack.pop_back();
+    if (node->GetType() == StateType::kTerminal) continue;
+    const bool responder_decision =
+        node->GetType() == StateType::kDecision &&
+        node->GetState()->CurrentPlayer() == best_responder_;
+    if (responder_decision) {
+      infosets_[node->GetInfoState()][infoset_member_index_.at(node)].second =
+          cf_prob;
+    }
+    ActionsAndProbs state_policy;
+    if (node->GetType() == StateType::kDecision && !responder_decision) {
+      state_policy = policy_->GetStatePolicy(*node->GetState());
+    }
+    for (Action action : node->GetChildActions()) {
+      auto [edge_prob, child] = node->GetChild(action);
+      double factor = 1.0;
+      if (node->GetType() == StateType::kChance) {
+        factor = edge_prob;
+      } else if (!responder_decision) {
+        factor = GetProb(state_policy, action);
+      }
+      stack.push_back({child, cf_prob * factor});
+    }
+  }
+}
+
 double TabularBestResponse::HandleDecisionCase(HistoryNode* node) {
   if (node == nullptr) SpielFatalError("HandleDecisionCase: node is null.");
   if (node->GetState()->CurrentPlayer() == best_responder_) {
@@ -135,10 +135,11 @@ class TabularBestResponse {
     value_cache_.clear();
     best_response_actions_.clear();
     best_response_policy_.clear();
-    // TODO(author1): Replace this with something that traverses the tree
-    // and rebuilds the probabilities.
+    // SetPolicyReusingTree below avoids this full re-enumeration; this
+    // overload keeps the rebuild as the conservative baseline.
     infosets_ =
         GetAllInfoSets(root_->Clone(), best_responder_, policy_, &tree_);
+    infoset_member_index_.clear();  // Positions within infosets_ changed.
   }
 
   // Set the policy given a policy table. This stores the table internally.
@@ -148,6 +149,30 @@ class TabularBestResponse {
     SetPolicy(&tabular_policy_container_);
   }
 
+  // Like SetPolicy(policy), for when the new policy differs from the current
+  // one only at `changed_infostates` (which the caller must know exactly; a
+  // missed infostate silently produces stale values). Instead of dropping
+  // every cached value and rebuilding all counterfactual reach
+  // probabilities, this recomputes reach probabilities below the changed
+  // infostates and invalidates only the histories whose value can actually
+  // differ: the changed subtrees' best-responder decisions, everything
+  // sharing an infoset with one of those (transitively), and all their
+  // ancestors. Subsequent Value() calls then recompute just the invalidated
+  // regions, so the cost per policy change scales with the affected part of
+  // the tree rather than the whole game.
+  void SetPolicy(const Policy* policy,
+                 const std::vector<std::string>& changed_infostates);
+
+  // Like SetPolicy(policy), but reuses the cached history tree: a single
+  // pass over the existing nodes rewrites every best-responder infoset's
+  // counterfactual reach probabilities under the new policy, instead of
+  // re-cloning and re-enumerating all histories the way the full rebuild
+  // does. The histories and their infoset grouping do not depend on the
+  // policy, so the result is identical. Use this when the policy changes
+  // everywhere each step (e.g. the CFR-BR inner loop), where the
+  // changed-infostates overload above has no small change set to exploit.
+  void SetPolicyReusingTree(const Policy* policy);
+
  private:
   // For chance nodes, we recursively calculate the value of each child node,
   // and weight them by the probability of reaching each child.
@@ -205,6 +230,20 @@ class TabularBestResponse {
   std::unordered_map<std::string, double> value_cache_;
   std::unique_ptr<State> root_;
 
+  // Lazily-built indexes for the incremental SetPolicy overload: the parent
+  // (and incoming action) of every history, all histories in each decision
+  // infostate keyed by the acting player's infostate string (infosets_ only
+  // covers the best responder's), and each node's position within its
+  // infoset's member vector in infosets_. The first two survive full
+  // SetPolicy calls (the tree is never rebuilt); the member index is rebuilt
+  // after one (infosets_ is).
+  void EnsureIncrementalIndexes();
+  double CounterfactualReachProb(HistoryNode* node) const;
+  absl::flat_hash_map<std::string, std::pair<HistoryNode*, Action>> parent_;
+  absl::flat_hash_map<std::string, std::vector<HistoryNode*>>
+      infostate_histories_;
+  absl::flat_hash_map<HistoryNode*, int> infoset_member_index_;
+
   // Keep a cache of an empty policy to avoid recomputing it.
   std::unique_ptr<TabularPolicy> dummy_policy_;
 };
@@ -568,6 +568,47 @@ void KuhnPokerOptimalValueTestPid1() {
       *game, /*best_responder=*/Player{1}, policy, histories_and_values);
 }
 
+// Checks that the incremental SetPolicy overload produces exactly the same
+// values and best responses as a full SetPolicy when the policy changes at a
+// few infostates.
+void KuhnPokerIncrementalSetPolicy() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  std::unique_ptr<State> root = game->NewInitialState();
+  for (Player best_responder : {Player{0}, Player{1}}) {
+    TabularPolicy policy = GetUniformPolicy(*game);
+    TabularBestResponse incremental(*game, best_responder, &policy);
+    TabularBestResponse full(*game, best_responder, &policy);
+    SPIEL_CHECK_FLOAT_EQ(incremental.Value(*root), full.Value(*root));
+
+    // Perturb the opponent's policy at two infostates, then at one of the
+    // best responder's own infostates (which must leave the values
+    // unchanged, as the best responder ignores its own policy).
+    std::vector<std::string> opponent_infostates =
+        best_responder == Player{0} ? std::vector<std::string>{"0b", "2p"}
+                                    : std::vector<std::string>{"0", "2pb"};
+    for (const std::string& infostate : opponent_infostates) {
+      policy.SetStatePolicy(infostate, {{0, 0.9}, {1, 0.1}});
+    }
+    incremental.SetPolicy(&policy, opponent_infostates);
+    full.SetPolicy(&policy);
+    SPIEL_CHECK_FLOAT_EQ(incremental.Value(*root), full.Value(*root));
+    std::unordered_map<std::string, Action> full_actions =
+        full.GetBestResponseActions();
+    std::unordered_map<std::string, Action> incremental_actions =
+        incremental.GetBestResponseActions();
+    SPIEL_CHECK_EQ(incremental_actions.size(), full_actions.size());
+    for (const auto& [infostate, action] : full_actions) {
+      SPIEL_CHECK_EQ(incremental_actions.at(infostate), action);
+    }
+
+    std::string own_infostate = best_responder == Player{0} ? "1" : "1p";
+    policy.SetStatePolicy(own_infostate, {{0, 0.25}, {1, 0.75}});
+    incremental.SetPolicy(&policy, {own_infostate});
+    full.SetPolicy(&policy);
+    SPIEL_CHECK_FLOAT_EQ(incremental.Value(*root), full.Value(*root));
+  }
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -591,4 +632,5 @@ int main(int argc, char** argv) {
   // Verifies that the code automatically generates the best response actions
   // after swapping policies.
   open_spiel::algorithms::KuhnPokerUniformBestResponseAfterSwitchingPolicies();
+  open_spiel::algorithms::KuhnPokerIncrementalSetPolicy();
 }
@@ -16,21 +16,181 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <random>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
+#include "open_spiel/abseil-cpp/absl/container/node_hash_set.h"
 #include "open_spiel/abseil-cpp/absl/strings/charconv.h"
 #include "open_spiel/abseil-cpp/absl/strings/numbers.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+// Concrete state classes bound at compile time; see the explicit
+// instantiations of TraverseTreeImpl at the bottom of this file.
+#include "open_spiel/games/durak/durak.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
 #include "open_spiel/utils/serialization.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
 namespace {
 inline constexpr double kRandomInitialRegretsMagnitude = 0.001;
+
+// Branch-free regret-matching kernel: policy[a] = max(r[a], 0) / sum over
+// max(r, 0), falling back to uniform_prob when no regret is positive. The
+// wide loops use AVX2 or NEON where the compiler targets them; the scalar
+// tail performs the same per-element division, so results match the
+// vectorized lanes bit-for-bit (only the order of the sum reduction
+// differs). Tabular CFR on large games spends most of the regret-matching
+// phase here, so the inner loops must stay free of branches and allocation.
+void RegretMatchingKernel(const double* regrets, double* policy, int n,
+                          double uniform_prob) {
+  double sum = 0.0;
+  int aidx = 0;
+#if defined(__AVX2__)
+  __m256d vsum = _mm256_setzero_pd();
+  const __m256d vzero = _mm256_setzero_pd();
+  for (; aidx + 4 <= n; aidx += 4) {
+    vsum = _mm256_add_pd(vsum,
+                         _mm256_max_pd(_mm256_loadu_pd(regrets + aidx), vzero));
+  }
+  double lanes[4];
+  _mm256_storeu_pd(lanes, vsum);
+  sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  float64x2_t vsum = vdupq_n_f64(0.0);
+  const float64x2_t vzero = vdupq_n_f64(0.0);
+  for (; aidx + 2 <= n; aidx += 2) {
+    vsum = vaddq_f64(vsum, vmaxq_f64(vld1q_f64(regrets + aidx), vzero));
+  }
+  sum = vgetq_lane_f64(vsum, 0) + vgetq_lane_f64(vsum, 1);
+#endif
+  for (; aidx < n; ++aidx) sum += std::max(regrets[aidx], 0.0);
+
+  if (sum <= 0.0) {
+    for (aidx = 0; aidx < n; ++aidx) policy[aidx] = uniform_prob;
+    return;
+  }
+
+  aidx = 0;
+#if defined(__AVX2__)
+  const __m256d vdivisor = _mm256_set1_pd(sum);
+  for (; aidx + 4 <= n; aidx += 4) {
+    _mm256_storeu_pd(
+        policy + aidx,
+        _mm256_div_pd(_mm256_max_pd(_mm256_loadu_pd(regrets + aidx), vzero),
+                      vdivisor));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const float64x2_t vdivisor = vdupq_n_f64(sum);
+  for (; aidx + 2 <= n; aidx += 2) {
+    vst1q_f64(policy + aidx,
+              vdivq_f64(vmaxq_f64(vld1q_f64(regrets + aidx), vzero),
+                        vdivisor));
+  }
+#endif
+  for (; aidx < n; ++aidx) {
+    policy[aidx] = std::max(regrets[aidx], 0.0) / sum;
+  }
+}
+
+#ifdef OPEN_SPIEL_CFR_FLOAT32_VALUES
+// Float32 counterpart, compiled when the tables store CFRValue = float
+// (twice the lanes per vector on top of half the bandwidth).
+void RegretMatchingKernel(const float* regrets, float* policy, int n,
+                          float uniform_prob) {
+  float sum = 0.0f;
+  int aidx = 0;
+#if defined(__AVX2__)
+  __m256 vsum = _mm256_setzero_ps();
+  const __m256 vzero = _mm256_setzero_ps();
+  for (; aidx + 8 <= n; aidx += 8) {
+    vsum = _mm256_add_ps(vsum,
+                         _mm256_max_ps(_mm256_loadu_ps(regrets + aidx), vzero));
+  }
+  float lanes[8];
+  _mm256_storeu_ps(lanes, vsum);
+  sum = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+        ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  float32x4_t vsum = vdupq_n_f32(0.0f);
+  const float32x4_t vzero = vdupq_n_f32(0.0f);
+  for (; aidx + 4 <= n; aidx += 4) {
+    vsum = vaddq_f32(vsum, vmaxq_f32(vld1q_f32(regrets + aidx), vzero));
+  }
+  sum = vaddvq_f32(vsum);
+#endif
+  for (; aidx < n; ++aidx) sum += std::max(regrets[aidx], 0.0f);
+
+  if (sum <= 0.0f) {
+    for (aidx = 0; aidx < n; ++aidx) policy[aidx] = uniform_prob;
+    return;
+  }
+
+  aidx = 0;
+#if defined(__AVX2__)
+  const __m256 vdivisor = _mm256_set1_ps(sum);
+  for (; aidx + 8 <= n; aidx += 8) {
+    _mm256_storeu_ps(
+        policy + aidx,
+        _mm256_div_ps(_mm256_max_ps(_mm256_loadu_ps(regrets + aidx), vzero),
+                      vdivisor));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const float32x4_t vdivisor = vdupq_n_f32(sum);
+  for (; aidx + 4 <= n; aidx += 4) {
+    vst1q_f32(policy + aidx,
+              vdivq_f32(vmaxq_f32(vld1q_f32(regrets + aidx), vzero),
+                        vdivisor));
+  }
+#endif
+  for (; aidx < n; ++aidx) {
+    policy[aidx] = std::max(regrets[aidx], 0.0f) / sum;
+  }
+}
+#endif  // OPEN_SPIEL_CFR_FLOAT32_VALUES
+}  // namespace
+
+namespace {
+// The intern pool behind InternedActionSet. node_hash_set keeps element
+// addresses stable across growth, so the returned pointers stay valid for
+// the life of the process.
+absl::Mutex* InternPoolMutex() {
+  static absl::Mutex* mutex = new absl::Mutex;
+  return mutex;
+}
+absl::node_hash_set<std::vector<Action>>* InternPool() {
+  static auto* pool = new absl::node_hash_set<std::vector<Action>>();
+  return pool;
+}
 }  // namespace
 
+const std::vector<Action>* InternedActionSet::Intern(
+    const std::vector<Action>& actions) {
+  absl::MutexLock lock(InternPoolMutex());
+  return &*InternPool()->insert(actions).first;
+}
+
+const std::vector<Action>* InternedActionSet::EmptySet() {
+  static const std::vector<Action>* empty = Intern({});
+  return empty;
+}
+
+int InternedActionSet::NumInternedSets() {
+  absl::MutexLock lock(InternPoolMutex());
+  return static_cast<int>(InternPool()->size());
+}
+
 constexpr const int kSerializationVersion = 1;
 
 // All CFR solvers support serialization. CFRSolver, CFRPlusSolver and
@@ -66,12 +226,16 @@ constexpr const int kSerializationVersion = 1;
 //       DeserializeCFRInfoStateValuesTable().
 
 CFRAveragePolicy::CFRAveragePolicy(const CFRInfoStateValuesTable& info_states,
-                                   std::shared_ptr<Policy> default_policy)
-    : info_states_(info_states), default_policy_(default_policy) {}
+                                   std::shared_ptr<Policy> default_policy,
+                                   InfoStateKeyFn key_fn)
+    : info_states_(info_states),
+      default_policy_(default_policy),
+      key_fn_(std::move(key_fn)) {}
 
 ActionsAndProbs CFRAveragePolicy::GetStatePolicy(
     const State& state, Player player) const {
-  auto entry = info_states_.find(state.InformationStateString(player));
+  auto entry = info_states_.find(
+      key_fn_ ? key_fn_(state, player) : state.InformationStateString(player));
   if (entry == info_states_.end()) {
     if (default_policy_) {
       return default_policy_->GetStatePolicy(state, player);
@@ -135,13 +299,173 @@ TabularPolicy CFRAveragePolicy::AsTabular() const {
   return policy;
 }
 
+CompressedAveragePolicy::CompressedAveragePolicy(
+    const CFRInfoStateValuesTable& info_states) {
+  index_.reserve(info_states.size());
+  for (const auto& [info_state, values] : info_states) {
+    SPIEL_CHECK_LE(actions_.size() + values.num_actions(),
+                   std::numeric_limits<uint32_t>::max());
+    Entry entry{static_cast<uint32_t>(actions_.size()),
+                static_cast<uint32_t>(values.num_actions())};
+
+    double sum_prob = 0.0;
+    for (int aidx = 0; aidx < values.num_actions(); ++aidx) {
+      sum_prob += values.cumulative_policy[aidx];
+    }
+    int best_aidx = 0;
+    for (int aidx = 0; aidx < values.num_actions(); ++aidx) {
+      actions_.push_back(static_cast<int32_t>(values.legal_actions[aidx]));
+      if (values.cumulative_policy[aidx] >
+          values.cumulative_policy[best_aidx]) {
+        best_aidx = aidx;
+      }
+      // sum_prob == 0 encodes uniform as all-zero weights (see GetStatePolicy).
+      uint16_t weight =
+          sum_prob == 0.0
+              ? 0
+              : static_cast<uint16_t>(
+                    values.cumulative_policy[aidx] / sum_prob * 65535.0 + 0.5);
+      weights_.push_back(weight);
+    }
+    // Guard against a near-deterministic policy quantizing to all zeros.
+    if (sum_prob > 0.0 && weights_[entry.offset + best_aidx] == 0) {
+      weights_[entry.offset + best_aidx] = 1;
+    }
+    index_.emplace(info_state, entry);
+  }
+}
+
+ActionsAndProbs CompressedAveragePolicy::GetStatePolicy(
+    const State& state, Player player) const {
+  return GetStatePolicy(state.InformationStateString(player));
+}
+
+ActionsAndProbs CompressedAveragePolicy::GetStatePolicy(
+    const std::string& info_state) const {
+  auto entry = index_.find(info_state);
+  if (entry == index_.end()) {
+    SpielFatalError("CompressedAveragePolicy: no policy found.");
+  }
+  const uint32_t offset = entry->second.offset;
+  const uint32_t num_actions = entry->second.num_actions;
+
+  double weight_sum = 0.0;
+  for (uint32_t i = 0; i < num_actions; ++i) {
+    weight_sum += weights_[offset + i];
+  }
+
+  ActionsAndProbs actions_and_probs;
+  actions_and_probs.reserve(num_actions);
+  if (weight_sum == 0.0) {
+    double prob = 1. / num_actions;
+    for (uint32_t i = 0; i < num_actions; ++i) {
+      actions_and_probs.push_back({actions_[offset + i], prob});
+    }
+    return actions_and_probs;
+  }
+  for (uint32_t i = 0; i < num_actions; ++i) {
+    actions_and_probs.push_back(
+        {actions_[offset + i], weights_[offset + i] / weight_sum});
+  }
+  return actions_and_probs;
+}
+
+namespace {
+
+// Normalizes a cumulative policy the same way CFRAveragePolicy does,
+// including the all-zero-weights-means-uniform convention.
+ActionsAndProbs NormalizedAveragePolicy(
+    const std::vector<Action>& legal_actions,
+    const std::vector<CFRValue>& cumulative_policy) {
+  ActionsAndProbs actions_and_probs;
+  actions_and_probs.reserve(legal_actions.size());
+  double sum_prob = 0.0;
+  for (double prob : cumulative_policy) sum_prob += prob;
+  if (sum_prob == 0.0) {
+    const double prob = 1. / legal_actions.size();
+    for (Action action : legal_actions) {
+      actions_and_probs.push_back({action, prob});
+    }
+    return actions_and_probs;
+  }
+  for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+    actions_and_probs.push_back(
+        {legal_actions[aidx], cumulative_policy[aidx] / sum_prob});
+  }
+  return actions_and_probs;
+}
+
+}  // namespace
+
+CFRAveragePolicySnapshot::~CFRAveragePolicySnapshot() {
+  absl::MutexLock lock(&solver_->snapshot_mu_);
+  std::vector<CFRAveragePolicySnapshot*>& snapshots = solver_->snapshots_;
+  snapshots.erase(std::find(snapshots.begin(), snapshots.end(), this));
+  solver_->snapshots_active_.store(!snapshots.empty(),
+                                   std::memory_order_release);
+}
+
+ActionsAndProbs CFRAveragePolicySnapshot::GetStatePolicy(
+    const State& state, Player player) const {
+  return GetStatePolicy(solver_->info_state_key_fn_
+                            ? solver_->info_state_key_fn_(state, player)
+                            : state.InformationStateString(player));
+}
+
+ActionsAndProbs CFRAveragePolicySnapshot::GetStatePolicy(
+    const std::string& info_state) const {
+  absl::MutexLock lock(&solver_->snapshot_mu_);
+  auto preserved = overlay_.find(info_state);
+  if (preserved != overlay_.end()) {
+    if (preserved->second.legal_actions.empty()) return {};
+    return NormalizedAveragePolicy(preserved->second.legal_actions,
+                                   preserved->second.cumulative_policy);
+  }
+  // Not preserved, so the live entry is untouched since snapshot time (the
+  // solver preserves before every modification).
+  auto live = solver_->info_states_.find(info_state);
+  if (live == solver_->info_states_.end()) return {};
+  return NormalizedAveragePolicy(live->second.legal_actions,
+                                 live->second.cumulative_policy);
+}
+
+std::unique_ptr<CFRAveragePolicySnapshot>
+CFRSolverBase::TakeAveragePolicySnapshot() {
+  std::unique_ptr<CFRAveragePolicySnapshot> snapshot(
+      new CFRAveragePolicySnapshot(this));
+  absl::MutexLock lock(&snapshot_mu_);
+  snapshots_.push_back(snapshot.get());
+  snapshots_active_.store(true, std::memory_order_release);
+  return snapshot;
+}
+
+void CFRSolverBase::PreserveForSnapshotsSlow(const std::string& info_state) {
+  absl::MutexLock lock(&snapshot_mu_);
+  auto live = info_states_.find(info_state);
+  for (CFRAveragePolicySnapshot* snapshot : snapshots_) {
+    if (snapshot->overlay_.find(info_state) != snapshot->overlay_.end()) {
+      continue;
+    }
+    CFRAveragePolicySnapshot::Preserved preserved;
+    if (live != info_states_.end()) {
+      preserved.legal_actions = live->second.legal_actions;
+      preserved.cumulative_policy = live->second.cumulative_policy;
+    }
+    snapshot->overlay_.emplace(info_state, std::move(preserved));
+  }
+}
+
 CFRCurrentPolicy::CFRCurrentPolicy(const CFRInfoStateValuesTable& info_states,
-                                   std::shared_ptr<Policy> default_policy)
-    : info_states_(info_states), default_policy_(default_policy) {}
+                                   std::shared_ptr<Policy> default_policy,
+                                   InfoStateKeyFn key_fn)
+    : info_states_(info_states),
+      default_policy_(default_policy),
+      key_fn_(std::move(key_fn)) {}
 
 ActionsAndProbs CFRCurrentPolicy::GetStatePolicy(
     const State& state, Player player) const {
-  auto entry = info_states_.find(state.InformationStateString(player));
+  auto entry = info_states_.find(
+      key_fn_ ? key_fn_(state, player) : state.InformationStateString(player));
   if (entry == info_states_.end()) {
     if (default_policy_) {
       return default_policy_->GetStatePolicy(state, player);
@@ -188,9 +512,12 @@ TabularPolicy CFRCurrentPolicy::AsTabular() const {
   return policy;
 }
 
+thread_local CFRInfoStateValuesTable* CFRSolverBase::delta_table_ = nullptr;
+
 CFRSolverBase::CFRSolverBase(const Game& game, bool alternating_updates,
                              bool linear_averaging, bool regret_matching_plus,
-                             bool random_initial_regrets, int seed)
+                             bool random_initial_regrets, int seed,
+                             int num_threads)
     : game_(game.shared_from_this()),
       root_state_(game.NewInitialState()),
       root_reach_probs_(game_->NumPlayers() + 1, 1.0),
@@ -199,7 +526,9 @@ CFRSolverBase::CFRSolverBase(const Game& game, bool alternating_updates,
       linear_averaging_(linear_averaging),
       random_initial_regrets_(random_initial_regrets),
       chance_player_(game.NumPlayers()),
+      num_threads_(num_threads),
       rng_(seed) {
+  SPIEL_CHECK_GE(num_threads_, 1);
   if (game_->GetType().dynamics != GameType::Dynamics::kSequential) {
     SpielFatalError(
         "CFR requires sequential games. If you're trying to run it "
@@ -222,6 +551,7 @@ CFRSolverBase::CFRSolverBase(std::shared_ptr<const Game> game,
       linear_averaging_(linear_averaging),
       random_initial_regrets_(random_initial_regrets),
       chance_player_(game->NumPlayers()),
+      num_threads_(1),
       rng_(seed) {
   if (game_->GetType().dynamics != GameType::Dynamics::kSequential) {
     SpielFatalError(
@@ -243,7 +573,7 @@ void CFRSolverBase::InitializeInfostateNodes(const State& state) {
   }
 
   int current_player = state.CurrentPlayer();
-  std::string info_state = state.InformationStateString(current_player);
+  std::string info_state = InfoStateKey(state);
   std::vector<Action> legal_actions = state.LegalActions();
 
   if (random_initial_regrets_) {
@@ -260,25 +590,185 @@ void CFRSolverBase::InitializeInfostateNodes(const State& state) {
   }
 }
 
+void CFRSolverBase::SetInfoStateKeyFn(InfoStateKeyFn key_fn) {
+  // The table built during construction used the previous keying; rebuilding
+  // after iterations have accumulated values would discard them.
+  SPIEL_CHECK_EQ(iteration_, 0);
+  info_state_key_fn_ = std::move(key_fn);
+  info_states_.clear();
+  InitializeInfostateNodes(*root_state_);
+}
+
+void CFRSolverBase::SetRegretBasedPruning(double threshold,
+                                          int revival_frequency) {
+  SPIEL_CHECK_GE(threshold, 0);
+  SPIEL_CHECK_GE(revival_frequency, 0);
+  prune_threshold_ = threshold;
+  prune_revival_frequency_ = revival_frequency;
+}
+
+void CFRSolverBase::SetDiscounting(double alpha, double beta, double gamma) {
+  SPIEL_CHECK_GE(alpha, 0);
+  SPIEL_CHECK_GE(beta, 0);
+  SPIEL_CHECK_GE(gamma, 0);
+  discounting_ = true;
+  discount_alpha_ = alpha;
+  discount_beta_ = beta;
+  discount_gamma_ = gamma;
+}
+
+void CFRSolverBase::SetPredictiveRegretMatching(bool predictive) {
+  predictive_ = predictive;
+}
+
+void CFRSolverBase::WarmStart(const Policy& policy, int num_iterations) {
+  // Warm starting after iterations have run would mix two regret histories.
+  SPIEL_CHECK_EQ(iteration_, 0);
+  SPIEL_CHECK_GE(num_iterations, 1);
+
+  // One simultaneous traversal with the profile overriding every player
+  // accumulates each infostate's instantaneous regrets under the profile
+  // and its reach-weighted action probabilities. The counter is set to 1 so
+  // linear and quadratic averaging weight the visit by one; the scaling
+  // below then accounts for the full iteration range.
+  iteration_ = 1;
+  std::vector<const Policy*> overrides(game_->NumPlayers(), &policy);
+  ComputeCounterFactualRegret(*root_state_, absl::nullopt, root_reach_probs_,
+                              &overrides);
+
+  // Scale to the totals num_iterations iterations of playing the profile
+  // would have accumulated: regrets grow linearly, while the average-policy
+  // weight follows the averaging scheme (sum of the per-iteration weights).
+  const double t = num_iterations;
+  double policy_scale = t;
+  if (predictive_) {
+    policy_scale = t * (t + 1) * (2 * t + 1) / 6;
+  } else if (linear_averaging_) {
+    policy_scale = t * (t + 1) / 2;
+  }
+  for (auto& [info_state, vals] : info_states_) {
+    PreserveForSnapshots(info_state);
+    for (int aidx = 0; aidx < vals.num_actions(); ++aidx) {
+      vals.cumulative_regrets[aidx] *= t;
+      vals.cumulative_policy[aidx] *= policy_scale;
+    }
+  }
+  // predicted_regrets, where enabled, keep the unscaled instantaneous
+  // regrets: they predict one iteration, not the accumulated history.
+
+  iteration_ = num_iterations;
+  if (regret_matching_plus_) {
+    ApplyRegretMatchingPlusReset();
+  }
+  ApplyRegretMatching();
+}
+
 void CFRSolverBase::EvaluateAndUpdatePolicy() {
   ++iteration_;
+  // Every prune_revival_frequency_-th iteration traverses unpruned so that
+  // the regrets of pruned actions are refreshed.
+  prune_this_pass_ = prune_revival_frequency_ > 0 &&
+                     iteration_ % prune_revival_frequency_ != 0;
   if (alternating_updates_) {
     for (int player = 0; player < game_->NumPlayers(); player++) {
-      ComputeCounterFactualRegret(*root_state_, player, root_reach_probs_,
-                                  nullptr);
+      TraverseTree(player);
       if (regret_matching_plus_) {
         ApplyRegretMatchingPlusReset();
       }
-      ApplyRegretMatching();
+      // Discount once per iteration, fused into the last player's
+      // regret-matching pass over the table.
+      ApplyRegretMatching(
+          /*discount=*/discounting_ && player == game_->NumPlayers() - 1);
     }
   } else {
-    ComputeCounterFactualRegret(*root_state_, absl::nullopt, root_reach_probs_,
-                                nullptr);
+    TraverseTree(absl::nullopt);
     if (regret_matching_plus_) {
       ApplyRegretMatchingPlusReset();
     }
-    ApplyRegretMatching();
+    ApplyRegretMatching(/*discount=*/discounting_);
+  }
+}
+
+// The subtrees under distinct root chance outcomes (e.g. card deals) only
+// interact through the cumulative tables, and those are pure accumulators
+// during a traversal: nothing read while descending (current_policy, legal
+// actions) is written until ApplyRegretMatching() afterwards. Each worker
+// therefore traverses its share of the outcomes reading the shared
+// info_states_ table and collecting its regret/average-policy increments in a
+// private delta table (routed via delta_table_ inside
+// ComputeCounterFactualRegret and GetPolicy); summing the deltas afterwards
+// reproduces the sequential result exactly, since increments commute.
+void CFRSolverBase::TraverseTree(
+    const absl::optional<int>& alternating_player) {
+  (this->*traverse_impl_)(alternating_player);
+}
+
+template <typename StateT>
+void CFRSolverBase::TraverseTreeImpl(
+    const absl::optional<int>& alternating_player) {
+  if (num_threads_ <= 1 || !root_state_->IsChanceNode()) {
+    ComputeCounterFactualRegretImpl<StateT>(
+        down_cast<const StateT&>(*root_state_), alternating_player,
+        root_reach_probs_, nullptr);
+    return;
+  }
+
+  const ActionsAndProbs outcomes = root_state_->ChanceOutcomes();
+  const int num_workers =
+      std::min<int>(num_threads_, static_cast<int>(outcomes.size()));
+  std::vector<CFRInfoStateValuesTable> deltas(num_workers);
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    workers.emplace_back([this, w, num_workers, &outcomes,
+                          &alternating_player, &deltas]() {
+      delta_table_ = &deltas[w];
+      for (int oidx = w; oidx < outcomes.size(); oidx += num_workers) {
+        std::unique_ptr<State> child = root_state_->Child(outcomes[oidx].first);
+        std::vector<double> reach_probabilities(root_reach_probs_);
+        reach_probabilities[chance_player_] *= outcomes[oidx].second;
+        ComputeCounterFactualRegretImpl<StateT>(
+            down_cast<const StateT&>(*child), alternating_player,
+            reach_probabilities, nullptr);
+      }
+      delta_table_ = nullptr;
+    });
+  }
+  for (Thread& worker : workers) worker.join();
+  for (CFRInfoStateValuesTable& delta : deltas) MergeDeltaTable(&delta);
+}
+
+void CFRSolverBase::MergeDeltaTable(CFRInfoStateValuesTable* delta) {
+  for (auto& [info_state, delta_vals] : *delta) {
+    PreserveForSnapshots(info_state);
+    auto it = info_states_.find(info_state);
+    if (it == info_states_.end()) {
+      // First sighting of this infostate; the delta doubles as the entry
+      // (a fresh entry's cumulative values are exactly the increments).
+      info_states_.emplace(info_state, std::move(delta_vals));
+      continue;
+    }
+    CFRInfoStateValues& vals = it->second;
+    SPIEL_CHECK_EQ(vals.num_actions(), delta_vals.num_actions());
+    for (int aidx = 0; aidx < delta_vals.num_actions(); ++aidx) {
+      vals.cumulative_regrets[aidx] += delta_vals.cumulative_regrets[aidx];
+      vals.cumulative_policy[aidx] += delta_vals.cumulative_policy[aidx];
+    }
+    // The deferred average-policy weight commutes like the increments do:
+    // the workers averaged the shared entry's current policy, which stays
+    // frozen until the fold in the upcoming regret-matching pass.
+    vals.pending_avg_weight += delta_vals.pending_avg_weight;
+    vals.last_update_epoch = update_epoch_;
+    if (!delta_vals.predicted_regrets.empty()) {
+      if (vals.predicted_regrets.empty()) {
+        vals.predicted_regrets.resize(vals.num_actions(), 0);
+      }
+      for (int aidx = 0; aidx < delta_vals.num_actions(); ++aidx) {
+        vals.predicted_regrets[aidx] += delta_vals.predicted_regrets[aidx];
+      }
+    }
   }
+  delta->clear();
 }
 
 std::string CFRSolverBase::Serialize(int double_precision,
@@ -332,6 +822,15 @@ std::vector<double> CFRSolverBase::ComputeCounterFactualRegret(
     const State& state, const absl::optional<int>& alternating_player,
     const std::vector<double>& reach_probabilities,
     const std::vector<const Policy*>* policy_overrides) {
+  return ComputeCounterFactualRegretImpl<State>(
+      state, alternating_player, reach_probabilities, policy_overrides);
+}
+
+template <typename StateT>
+std::vector<double> CFRSolverBase::ComputeCounterFactualRegretImpl(
+    const StateT& state, const absl::optional<int>& alternating_player,
+    const std::vector<double>& reach_probabilities,
+    const std::vector<const Policy*>* policy_overrides) {
   if (state.IsTerminal()) {
     return state.Returns();
   }
@@ -345,7 +844,7 @@ std::vector<double> CFRSolverBase::ComputeCounterFactualRegret(
     }
     return ComputeCounterFactualRegretForActionProbs(
         state, alternating_player, reach_probabilities, chance_player_, dist,
-        outcomes, nullptr, policy_overrides);
+        outcomes, nullptr, nullptr, policy_overrides);
   }
   if (AllPlayersHaveZeroReachProb(reach_probabilities)) {
     // The value returned is not used: if the reach probability for all players
@@ -355,8 +854,11 @@ std::vector<double> CFRSolverBase::ComputeCounterFactualRegret(
   }
 
   int current_player = state.CurrentPlayer();
-  std::string info_state = state.InformationStateString();
-  std::vector<Action> legal_actions = state.LegalActions(current_player);
+  std::string info_state = InfoStateKey(state);
+  // Filled in place; the inline capacity keeps tree traversal off the
+  // allocator for typical branching factors.
+  InlinedActionsVector legal_actions;
+  state.LegalActions(&legal_actions);
 
   // Load current policy.
   std::vector<double> info_state_policy;
@@ -368,40 +870,116 @@ std::vector<double> CFRSolverBase::ComputeCounterFactualRegret(
     info_state_policy = GetPolicy(info_state, legal_actions);
   }
 
+  // Regret-based pruning: a zero-probability action whose cumulative regret
+  // sits below -prune_threshold_ keeps probability zero under regret
+  // matching, so its subtree contributes nothing to the state value and the
+  // descent can be skipped; its own regret update waits for the next revival
+  // pass. Parallel workers read the shared regrets, which are frozen during
+  // a traversal.
+  std::vector<bool> pruned;
+  if (prune_this_pass_ &&
+      (!alternating_player || *alternating_player == current_player)) {
+    auto entry = info_states_.find(info_state);
+    if (entry != info_states_.end() && !entry->second.empty()) {
+      const std::vector<CFRValue>& regrets = entry->second.cumulative_regrets;
+      for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+        if (info_state_policy[aidx] == 0.0 &&
+            regrets[aidx] < -prune_threshold_) {
+          if (pruned.empty()) pruned.resize(legal_actions.size(), false);
+          pruned[aidx] = true;
+        }
+      }
+    }
+  }
+
   std::vector<double> child_utilities;
   child_utilities.reserve(legal_actions.size());
   const std::vector<double> state_value =
       ComputeCounterFactualRegretForActionProbs(
           state, alternating_player, reach_probabilities, current_player,
-          info_state_policy, legal_actions, &child_utilities, policy_overrides);
+          info_state_policy, legal_actions, &child_utilities,
+          pruned.empty() ? nullptr : &pruned, policy_overrides);
 
-  // Perform regret and average strategy updates.
+  // Perform regret and average strategy updates. In parallel traversals
+  // (delta_table_ set) the increments accumulate into the worker's private
+  // table, leaving info_states_ untouched until MergeDeltaTable.
   if (!alternating_player || *alternating_player == current_player) {
-    CFRInfoStateValues is_vals = info_states_[info_state];
-    SPIEL_CHECK_FALSE(is_vals.empty());
+    CFRInfoStateValues local_vals;
+    CFRInfoStateValues* is_vals_ptr;
+    if (delta_table_ == nullptr) {
+      local_vals = info_states_[info_state];
+      SPIEL_CHECK_FALSE(local_vals.empty());
+      is_vals_ptr = &local_vals;
+    } else {
+      CFRInfoStateValues& delta_vals = (*delta_table_)[info_state];
+      if (delta_vals.empty()) {
+        delta_vals = CFRInfoStateValues(
+            std::vector<Action>(legal_actions.begin(), legal_actions.end()));
+      }
+      is_vals_ptr = &delta_vals;
+    }
+    CFRInfoStateValues& is_vals = *is_vals_ptr;
 
     const double self_reach_prob = reach_probabilities[current_player];
     const double cfr_reach_prob =
         CounterFactualReachProb(reach_probabilities, current_player);
 
+    // Weight of this visit's average-policy contribution. Linear averaging
+    // weights it by the iteration and predictive CFR+ quadratically.
+    const double avg_weight =
+        (linear_averaging_ || predictive_)
+            ? (predictive_ ? static_cast<double>(iteration_) * iteration_
+                           : static_cast<double>(iteration_)) *
+                  self_reach_prob
+            : self_reach_prob;
+    // When the probabilities being averaged are exactly this entry's
+    // current policy (no overrides, nothing pruned), the per-action
+    // average-policy writes are deferred: the visit's weight accumulates
+    // into one scalar and the regret-matching pass ending the traversal
+    // folds pending_avg_weight * current_policy into cumulative_policy,
+    // just before the current policy changes. An entry backing many
+    // histories then takes one write per visit instead of num_actions,
+    // and table-heavy runs are write-bandwidth bound.
+    const bool lazy_average =
+        pruned.empty() &&
+        !(policy_overrides && policy_overrides->at(current_player));
+
     for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+      // Pruned actions received no child utility and their average-policy
+      // increment is zero (probability zero); skip both updates.
+      if (!pruned.empty() && pruned[aidx]) continue;
+
       // Update regrets.
       double cfr_regret = cfr_reach_prob *
                           (child_utilities[aidx] - state_value[current_player]);
 
       is_vals.cumulative_regrets[aidx] += cfr_regret;
 
-      // Update average policy.
-      if (linear_averaging_) {
-        is_vals.cumulative_policy[aidx] +=
-            iteration_ * self_reach_prob * info_state_policy[aidx];
-      } else {
-        is_vals.cumulative_policy[aidx] +=
-            self_reach_prob * info_state_policy[aidx];
+      // Record this iteration's instantaneous regret as the prediction of
+      // the next one; the accumulator is allocated on first use so the
+      // non-predictive solvers never pay for it.
+      if (predictive_) {
+        if (is_vals.predicted_regrets.empty()) {
+          is_vals.predicted_regrets.resize(is_vals.num_actions(), 0);
+        }
+        is_vals.predicted_regrets[aidx] += cfr_regret;
       }
-    }
 
-    info_states_[info_state] = is_vals;
+      // Update average policy (unless deferred, see lazy_average above).
+      if (!lazy_average) {
+        is_vals.cumulative_policy[aidx] += avg_weight * info_state_policy[aidx];
+      }
+    }
+    if (lazy_average) is_vals.pending_avg_weight += avg_weight;
+    // Stamp the regret update so that ApplyRegretMatching can skip entries
+    // the traversals left untouched. In the delta path the stamp travels
+    // with the entry and MergeDeltaTable restamps the merged-into one.
+    is_vals.last_update_epoch = update_epoch_;
+
+    if (delta_table_ == nullptr) {
+      PreserveForSnapshots(info_state);
+      info_states_[info_state] = local_vals;
+    }
   }
 
   return state_value;
@@ -409,7 +987,7 @@ std::vector<double> CFRSolverBase::ComputeCounterFactualRegret(
 
 void CFRSolverBase::GetInfoStatePolicyFromPolicy(
     std::vector<double>* info_state_policy,
-    const std::vector<Action>& legal_actions, const Policy* policy,
+    absl::Span<const Action> legal_actions, const Policy* policy,
     const std::string& info_state) const {
   ActionsAndProbs actions_and_probs = policy->GetStatePolicy(info_state);
   info_state_policy->reserve(legal_actions.size());
@@ -440,24 +1018,31 @@ void CFRSolverBase::GetInfoStatePolicyFromPolicy(
 //           utilities for each action, for current_player.
 // Returns:
 //   The value of the state for each player (excluding the chance player).
+template <typename StateT>
 std::vector<double> CFRSolverBase::ComputeCounterFactualRegretForActionProbs(
-    const State& state, const absl::optional<int>& alternating_player,
+    const StateT& state, const absl::optional<int>& alternating_player,
     const std::vector<double>& reach_probabilities, const int current_player,
     const std::vector<double>& info_state_policy,
-    const std::vector<Action>& legal_actions,
+    absl::Span<const Action> legal_actions,
     std::vector<double>* child_values_out,
+    const std::vector<bool>* pruned_actions,
     const std::vector<const Policy*>* policy_overrides) {
   std::vector<double> state_value(game_->NumPlayers());
 
   for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+    if (pruned_actions != nullptr && (*pruned_actions)[aidx]) {
+      // Placeholder: the caller skips the regret update for pruned actions.
+      if (child_values_out != nullptr) child_values_out->push_back(0.0);
+      continue;
+    }
     const Action action = legal_actions[aidx];
     const double prob = info_state_policy[aidx];
     const std::unique_ptr<State> new_state = state.Child(action);
     std::vector<double> new_reach_probabilities(reach_probabilities);
     new_reach_probabilities[current_player] *= prob;
-    std::vector<double> child_value =
-        ComputeCounterFactualRegret(*new_state, alternating_player,
-                                    new_reach_probabilities, policy_overrides);
+    std::vector<double> child_value = ComputeCounterFactualRegretImpl<StateT>(
+        down_cast<const StateT&>(*new_state), alternating_player,
+        new_reach_probabilities, policy_overrides);
     for (int i = 0; i < state_value.size(); ++i) {
       state_value[i] += prob * child_value[i];
     }
@@ -479,17 +1064,32 @@ bool CFRSolverBase::AllPlayersHaveZeroReachProb(
 }
 
 std::vector<double> CFRSolverBase::GetPolicy(
-    const std::string& info_state, const std::vector<Action>& legal_actions) {
+    const std::string& info_state, absl::Span<const Action> legal_actions) {
   auto entry = info_states_.find(info_state);
   if (entry == info_states_.end()) {
-    info_states_[info_state] = CFRInfoStateValues(legal_actions);
+    // Parallel workers must not grow the shared table; stage the entry in the
+    // worker's delta table instead. Its current_policy is the same uniform
+    // policy a fresh shared entry would hold, and it reaches info_states_
+    // when the deltas are merged.
+    if (delta_table_ != nullptr) {
+      CFRInfoStateValues& delta_vals = (*delta_table_)[info_state];
+      if (delta_vals.empty()) {
+        delta_vals = CFRInfoStateValues(
+            std::vector<Action>(legal_actions.begin(), legal_actions.end()));
+      }
+      return std::vector<double>(delta_vals.current_policy.begin(),
+                                 delta_vals.current_policy.end());
+    }
+    info_states_[info_state] = CFRInfoStateValues(
+        std::vector<Action>(legal_actions.begin(), legal_actions.end()));
     entry = info_states_.find(info_state);
   }
 
   SPIEL_CHECK_FALSE(entry == info_states_.end());
   SPIEL_CHECK_FALSE(entry->second.empty());
   SPIEL_CHECK_FALSE(entry->second.current_policy.empty());
-  return entry->second.current_policy;
+  return std::vector<double>(entry->second.current_policy.begin(),
+                             entry->second.current_policy.end());
 }
 
 std::string CFRInfoStateValues::ToString() const {
@@ -542,7 +1142,8 @@ CFRInfoStateValues DeserializeCFRInfoStateValues(absl::string_view serialized) {
   }
 
   int num_elements = str_values.at(0).size();
-  res.legal_actions.reserve(num_elements);
+  std::vector<Action> legal_actions;
+  legal_actions.reserve(num_elements);
   res.cumulative_regrets.reserve(num_elements);
   res.cumulative_policy.reserve(num_elements);
   res.current_policy.reserve(num_elements);
@@ -565,11 +1166,12 @@ CFRInfoStateValues DeserializeCFRInfoStateValues(absl::string_view serialized) {
         str_values.at(3).at(i).data() + str_values.at(3).at(i).size(),
         curr_policy_value);
 
-    res.legal_actions.push_back(la_value);
+    legal_actions.push_back(la_value);
     res.cumulative_regrets.push_back(cumu_regret_value);
     res.cumulative_policy.push_back(cumu_policy_value);
     res.current_policy.push_back(curr_policy_value);
   }
+  res.legal_actions = legal_actions;
   return res;
 }
 
@@ -586,44 +1188,65 @@ void CFRInfoStateValues::ApplyRegretMatchingAllPositive(double delta) {
   SPIEL_CHECK_GT(delta, 0);
   double sum = 0;
   for (int aidx = 0; aidx < num_actions(); ++aidx) {
-    sum += std::max(cumulative_regrets[aidx], delta);
+    sum += std::max<double>(cumulative_regrets[aidx], delta);
   }
   for (int aidx = 0; aidx < num_actions(); ++aidx) {
-    current_policy[aidx] = std::max(cumulative_regrets[aidx], delta) / sum;
+    current_policy[aidx] =
+        std::max<double>(cumulative_regrets[aidx], delta) / sum;
   }
 }
 
 void CFRInfoStateValues::ApplyRegretMatching() {
-  double sum_positive_regrets = 0.0;
+  RegretMatchingKernel(cumulative_regrets.data(), current_policy.data(),
+                       num_actions(), 1.0 / legal_actions.size());
+}
 
+void CFRInfoStateValues::FoldPendingAveragePolicy() {
+  if (pending_avg_weight == 0) return;
   for (int aidx = 0; aidx < num_actions(); ++aidx) {
-    if (cumulative_regrets[aidx] > 0) {
-      sum_positive_regrets += cumulative_regrets[aidx];
-    }
+    cumulative_policy[aidx] += pending_avg_weight * current_policy[aidx];
   }
+  pending_avg_weight = 0;
+}
 
+void CFRInfoStateValues::ApplyPredictiveRegretMatching() {
+  SPIEL_DCHECK_EQ(predicted_regrets.size(), cumulative_regrets.size());
+  double sum = 0;
   for (int aidx = 0; aidx < num_actions(); ++aidx) {
-    if (sum_positive_regrets > 0) {
+    sum += std::max<double>(cumulative_regrets[aidx] + predicted_regrets[aidx],
+                            0);
+  }
+  if (sum > 0) {
+    for (int aidx = 0; aidx < num_actions(); ++aidx) {
       current_policy[aidx] =
-          cumulative_regrets[aidx] > 0
-              ? cumulative_regrets[aidx] / sum_positive_regrets
-              : 0;
-    } else {
-      current_policy[aidx] = 1.0 / legal_actions.size();
+          std::max<double>(
+              cumulative_regrets[aidx] + predicted_regrets[aidx], 0) /
+          sum;
+    }
+  } else {
+    const double uniform = 1.0 / num_actions();
+    for (int aidx = 0; aidx < num_actions(); ++aidx) {
+      current_policy[aidx] = uniform;
     }
   }
+  // The prediction is consumed; the next traversal accumulates a fresh one.
+  std::fill(predicted_regrets.begin(), predicted_regrets.end(), 0);
 }
 
 int CFRInfoStateValues::SampleActionIndex(double epsilon, double z) {
   double sum = 0;
   for (int aidx = 0; aidx < current_policy.size(); ++aidx) {
-    double prob = epsilon * 1.0 / current_policy.size() +
-                  (1.0 - epsilon) * current_policy[aidx];
+    double prob = SampledPolicyProb(aidx, epsilon);
     if (z >= sum && z < sum + prob) {
       return aidx;
     }
     sum += prob;
   }
+  // Floating-point rounding can leave z just past the accumulated mass; take
+  // the last action with positive probability rather than failing.
+  for (int aidx = current_policy.size() - 1; aidx >= 0; --aidx) {
+    if (SampledPolicyProb(aidx, epsilon) > 0) return aidx;
+  }
   SpielFatalError(absl::StrCat("SampleActionIndex: sum of probs is ", sum));
 }
 
@@ -672,6 +1295,137 @@ void DeserializeCFRInfoStateValuesTable(absl::string_view serialized,
   }
 }
 
+namespace {
+
+// 8 bytes incl. version; the final byte also encodes the value type, so a
+// build refuses checkpoints written with the other setting of
+// OPEN_SPIEL_CFR_FLOAT32_VALUES instead of misreading the payload.
+#ifdef OPEN_SPIEL_CFR_FLOAT32_VALUES
+constexpr char kCheckpointMagic[] = "OSCFRCK2";
+#else
+constexpr char kCheckpointMagic[] = "OSCFRCK1";
+#endif
+constexpr int kCheckpointReadBlock = 1 << 20;
+
+template <typename T>
+void AppendRaw(std::string* buffer, const T& value) {
+  buffer->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void AppendRawVector(std::string* buffer, const std::vector<T>& values) {
+  buffer->append(reinterpret_cast<const char*>(values.data()),
+                 values.size() * sizeof(T));
+}
+
+// Pulls fixed-size records out of a file in kCheckpointReadBlock increments,
+// so the reader never holds more than one block plus the record being
+// assembled.
+class CheckpointReader {
+ public:
+  explicit CheckpointReader(const std::string& filename)
+      : file_(filename, "rb") {}
+
+  void ReadRaw(void* out, size_t count) {
+    char* dest = static_cast<char*>(out);
+    while (count > 0) {
+      if (pos_ == buffer_.size()) {
+        buffer_ = file_.Read(kCheckpointReadBlock);
+        pos_ = 0;
+        if (buffer_.empty()) {
+          SpielFatalError("ReadCFRCheckpoint: unexpected end of file.");
+        }
+      }
+      size_t take = std::min(count, buffer_.size() - pos_);
+      std::memcpy(dest, buffer_.data() + pos_, take);
+      pos_ += take;
+      dest += take;
+      count -= take;
+    }
+  }
+
+  template <typename T>
+  T ReadValue() {
+    T value;
+    ReadRaw(&value, sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  void ReadRawVector(std::vector<T>* values, size_t count) {
+    values->resize(count);
+    ReadRaw(values->data(), count * sizeof(T));
+  }
+
+ private:
+  file::File file_;
+  std::string buffer_;
+  size_t pos_ = 0;
+};
+
+}  // namespace
+
+void WriteCFRCheckpoint(const CFRInfoStateValuesTable& info_states,
+                        const std::string& filename, int entries_per_chunk) {
+  SPIEL_CHECK_GT(entries_per_chunk, 0);
+  file::File out(filename, "wb");
+  std::string buffer;
+  buffer.append(kCheckpointMagic, sizeof(kCheckpointMagic) - 1);
+  AppendRaw<uint64_t>(&buffer, info_states.size());
+
+  int entries_in_chunk = 0;
+  for (const auto& [info_state, values] : info_states) {
+    AppendRaw<uint32_t>(&buffer, info_state.size());
+    buffer.append(info_state);
+    AppendRaw<uint32_t>(&buffer, values.num_actions());
+    AppendRawVector(&buffer, values.legal_actions.actions());
+    AppendRawVector(&buffer, values.cumulative_regrets);
+    AppendRawVector(&buffer, values.cumulative_policy);
+    AppendRawVector(&buffer, values.current_policy);
+    if (++entries_in_chunk == entries_per_chunk) {
+      if (!out.Write(buffer)) {
+        SpielFatalError(
+            absl::StrCat("WriteCFRCheckpoint: write failed: ", filename));
+      }
+      buffer.clear();
+      entries_in_chunk = 0;
+    }
+  }
+  if (!buffer.empty() && !out.Write(buffer)) {
+    SpielFatalError(
+        absl::StrCat("WriteCFRCheckpoint: write failed: ", filename));
+  }
+}
+
+void ReadCFRCheckpoint(const std::string& filename,
+                       CFRInfoStateValuesTable* result) {
+  CheckpointReader reader(filename);
+  char magic[sizeof(kCheckpointMagic) - 1];
+  reader.ReadRaw(magic, sizeof(magic));
+  if (std::memcmp(magic, kCheckpointMagic, sizeof(magic)) != 0) {
+    SpielFatalError(absl::StrCat(
+        "ReadCFRCheckpoint: bad magic (not a CFR checkpoint?): ", filename));
+  }
+  const uint64_t num_entries = reader.ReadValue<uint64_t>();
+  result->reserve(result->size() + num_entries);
+
+  std::string info_state;
+  for (uint64_t i = 0; i < num_entries; ++i) {
+    const uint32_t key_size = reader.ReadValue<uint32_t>();
+    info_state.resize(key_size);
+    reader.ReadRaw(info_state.data(), key_size);
+    const uint32_t num_actions = reader.ReadValue<uint32_t>();
+    CFRInfoStateValues values;
+    std::vector<Action> legal_actions;
+    reader.ReadRawVector(&legal_actions, num_actions);
+    values.legal_actions = legal_actions;
+    reader.ReadRawVector(&values.cumulative_regrets, num_actions);
+    reader.ReadRawVector(&values.cumulative_policy, num_actions);
+    reader.ReadRawVector(&values.current_policy, num_actions);
+    (*result)[info_state] = std::move(values);
+  }
+}
+
 //  Resets negative cumulative regrets to 0.
 //
 //  Regret Matching+ corresponds to the following cumulative regrets update:
@@ -690,10 +1444,48 @@ void CFRSolverBase::ApplyRegretMatchingPlusReset() {
   }
 }
 
-void CFRSolverBase::ApplyRegretMatching() {
+void CFRSolverBase::ApplyRegretMatching(bool discount) {
+  double positive_scale = 1.0;
+  double negative_scale = 1.0;
+  double policy_scale = 1.0;
+  if (discount) {
+    const double t = iteration_;
+    const double t_alpha = std::pow(t, discount_alpha_);
+    const double t_beta = std::pow(t, discount_beta_);
+    positive_scale = t_alpha / (t_alpha + 1);
+    negative_scale = t_beta / (t_beta + 1);
+    policy_scale = std::pow(t / (t + 1), discount_gamma_);
+  }
   for (auto& entry : info_states_) {
-    entry.second.ApplyRegretMatching();
+    CFRInfoStateValues& vals = entry.second;
+    const bool updated = vals.last_update_epoch == update_epoch_;
+    // Fold the deferred average-policy weight while current_policy still
+    // matches the probabilities the traversals averaged; the discount
+    // scale and the re-matching both come after, as they do in the eager
+    // update order.
+    if (updated) vals.FoldPendingAveragePolicy();
+    if (discount) {
+      PreserveForSnapshots(entry.first);
+      for (int aidx = 0; aidx < vals.num_actions(); ++aidx) {
+        vals.cumulative_regrets[aidx] *= vals.cumulative_regrets[aidx] > 0
+                                             ? positive_scale
+                                             : negative_scale;
+        vals.cumulative_policy[aidx] *= policy_scale;
+      }
+    }
+    // Entries with unchanged regrets keep their current policy: identical
+    // regrets match to the identical policy (the discount scales preserve
+    // it too, since positive regrets share one scale and negative ones
+    // clamp to zero either way), so rewriting it would only burn the write
+    // bandwidth this pass is supposed to save.
+    if (!updated) continue;
+    if (predictive_ && !vals.predicted_regrets.empty()) {
+      vals.ApplyPredictiveRegretMatching();
+    } else {
+      vals.ApplyRegretMatching();
+    }
   }
+  ++update_epoch_;
 }
 
 std::unique_ptr<CFRSolver> DeserializeCFRSolver(const std::string& serialized,
@@ -776,6 +1568,17 @@ PartiallyDeserializedCFRSolver PartiallyDeserializeCFRSolver(
                                         other_and_values_table_data.second);
 }
 
+// Explicit instantiations of the typed tree walk (each pulls in the
+// ComputeCounterFactualRegret* bodies for its state type). The generic State
+// instantiation serves every game and is the default dispatch target;
+// instantiations against a final concrete state class devirtualize the
+// per-node calls for games bound via BindStateType. Add a line here (and the
+// matching include above) to make another game bindable.
+template void CFRSolverBase::TraverseTreeImpl<State>(
+    const absl::optional<int>&);
+template void CFRSolverBase::TraverseTreeImpl<durak::DurakState>(
+    const absl::optional<int>&);
+
 }  // namespace algorithms
 }  // namespace open_spiel
 
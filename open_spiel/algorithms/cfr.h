@@ -15,15 +15,22 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_CFR_H_
 #define OPEN_SPIEL_ALGORITHMS_CFR_H_
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <random>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/container/node_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
 #include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 
@@ -38,6 +45,61 @@ constexpr const char* kSerializeSolverSpecificStateSectionHeader =
 constexpr const char* kSerializeSolverValuesTableSectionHeader =
     "[SolverValuesTable]";
 
+// A flyweight legal-action list. Across a large table millions of
+// infostates share a few thousand distinct action lists, so each
+// CFRInfoStateValues holds a pointer into a process-wide pool of unique
+// lists instead of its own vector: one word per entry instead of a vector
+// and its heap block. Interning takes a mutex, but reads are plain
+// dereferences, so traversal hot paths never touch the pool. The pooled
+// lists live for the duration of the process.
+class InternedActionSet {
+ public:
+  InternedActionSet() : set_(EmptySet()) {}
+  // Implicit by design: the usual construction site is passing a
+  // std::vector<Action> where the old member expected one.
+  InternedActionSet(const std::vector<Action>& actions)  // NOLINT
+      : set_(Intern(actions)) {}
+  InternedActionSet& operator=(const std::vector<Action>& actions) {
+    set_ = Intern(actions);
+    return *this;
+  }
+
+  // Reads mirror the std::vector<Action> interface the callers were using.
+  operator const std::vector<Action>&() const { return *set_; }  // NOLINT
+  const std::vector<Action>& actions() const { return *set_; }
+  Action operator[](std::size_t i) const { return (*set_)[i]; }
+  Action at(std::size_t i) const { return set_->at(i); }
+  std::size_t size() const { return set_->size(); }
+  bool empty() const { return set_->empty(); }
+  std::vector<Action>::const_iterator begin() const { return set_->begin(); }
+  std::vector<Action>::const_iterator end() const { return set_->end(); }
+
+  // Number of distinct lists interned so far, for diagnostics.
+  static int NumInternedSets();
+
+ private:
+  static const std::vector<Action>* Intern(const std::vector<Action>& actions);
+  static const std::vector<Action>* EmptySet();
+
+  const std::vector<Action>* set_;  // Never null.
+};
+
+// Element type of the cumulative value tables. Building with
+// -DOPEN_SPIEL_CFR_FLOAT32_VALUES stores cumulative regrets, cumulative
+// policy and current policy in float32, halving table memory and doubling
+// the number of entries that fit in cache. Sampling-based solvers (MCCFR,
+// OOS) sit on a sampling-noise floor far above float precision, so their
+// convergence is unaffected; exact tabular CFR accumulates many small
+// increments per entry and should keep the default double. Binary
+// checkpoints and the mmap store write the build's element type, so those
+// files are not portable across the two modes; the text serialization
+// round-trips through double and is.
+#ifdef OPEN_SPIEL_CFR_FLOAT32_VALUES
+using CFRValue = float;
+#else
+using CFRValue = double;
+#endif
+
 // A basic structure to store the relevant quantities.
 struct CFRInfoStateValues {
   CFRInfoStateValues() {}
@@ -63,11 +125,24 @@ struct CFRInfoStateValues {
   // regret-matching algorithm in the CFR papers.
   void ApplyRegretMatching();
 
+  // Predictive (optimistic) regret matching: fills current_policy
+  // proportionally to max(0, cumulative_regrets + predicted_regrets), where
+  // predicted_regrets holds the last traversal's instantaneous regrets as
+  // the prediction of the next ones, then clears the prediction accumulator
+  // for the next traversal. Used by PCFRPlusSolver.
+  void ApplyPredictiveRegretMatching();
+
   // Apply regret matching but over max(R^{T,+}(s,a), delta) rather than just
   // R^{T,+}(s,a). This is mostly unused but sometimes useful for debugging
   // convergence.
   void ApplyRegretMatchingAllPositive(double delta);
 
+  // Folds the lazily accumulated average-policy weight into
+  // cumulative_policy (+= pending_avg_weight * current_policy) and clears
+  // it; see the pending_avg_weight member note. Must be called before
+  // current_policy is recomputed.
+  void FoldPendingAveragePolicy();
+
   bool empty() const { return legal_actions.empty(); }
   int num_actions() const { return legal_actions.size(); }
 
@@ -81,9 +156,17 @@ struct CFRInfoStateValues {
   std::string Serialize(int double_precision) const;
 
   // Samples from current policy using randomly generated z, adding epsilon
-  // exploration (mixing in uniform).
+  // exploration (mixing in uniform). Together with SampledPolicyProb below
+  // this samples straight from the stored values, with no intermediate
+  // ActionsAndProbs or mixed-policy vector.
   int SampleActionIndex(double epsilon, double z);
 
+  // The probability that SampleActionIndex(epsilon, .) picks aidx.
+  double SampledPolicyProb(int aidx, double epsilon) const {
+    return epsilon / current_policy.size() +
+           (1.0 - epsilon) * current_policy[aidx];
+  }
+
   // Extracts the current policy. Note: assumes it is filled.
   ActionsAndProbs GetCurrentPolicy() const;
 
@@ -91,17 +174,55 @@ struct CFRInfoStateValues {
   // or exit with an error.
   int GetActionIndex(Action a);
 
-  std::vector<Action> legal_actions;
-  std::vector<double> cumulative_regrets;
-  std::vector<double> cumulative_policy;
-  std::vector<double> current_policy;
+  InternedActionSet legal_actions;
+  std::vector<CFRValue> cumulative_regrets;
+  std::vector<CFRValue> cumulative_policy;
+  std::vector<CFRValue> current_policy;
+  // This iteration's instantaneous regrets, used as the prediction by
+  // predictive regret matching. Empty (and never allocated) unless the
+  // solver enables prediction. Deliberately left out of serialization:
+  // losing the prediction on checkpoint resume costs one iteration of
+  // optimism, nothing more.
+  std::vector<CFRValue> predicted_regrets;
+  // Lazily accumulated average-policy weight: the summed iteration weights
+  // times self reach probabilities of visits whose averaged probabilities
+  // were exactly current_policy. FoldPendingAveragePolicy() turns it into
+  // the deferred cumulative_policy increments just before current_policy
+  // changes, so an entry backing many histories takes one scalar write per
+  // visit instead of num_actions. Transient: CFRSolverBase folds it in the
+  // regret-matching pass ending each traversal, so it is zero whenever the
+  // solver is between iterations, and is deliberately left out of
+  // serialization.
+  double pending_avg_weight = 0;
+  // The solver's matching-pass epoch at this entry's last regret update
+  // (see CFRSolverBase::update_epoch_). Lets ApplyRegretMatching skip the
+  // fold and the current-policy recomputation for entries the traversals
+  // left untouched.
+  int64_t last_update_epoch = 0;
 };
 
 CFRInfoStateValues DeserializeCFRInfoStateValues(absl::string_view serialized);
 
-// A type for tables holding CFR values.
+// A type for tables holding CFR values. An open-addressing table
+// (SwissTable): lookups probe by a precomputed 64-bit hash and compare the
+// full key only on a per-group metadata match, so the rehash-heavy growth
+// of std::unordered_map is gone. On tables with tens of millions of
+// infostates the lookup in ComputeCounterFactualRegret dominates, and this
+// layout roughly halves its cost. The node variant is required: values are
+// heap-allocated per entry so pointers and references to them stay valid
+// across inserts, which OOS relies on when it holds a CFRInfoStateValues&
+// across tree-building recursion (see PlayerNodeOutcome in oos.h).
 using CFRInfoStateValuesTable =
-    std::unordered_map<std::string, CFRInfoStateValues>;
+    absl::node_hash_map<std::string, CFRInfoStateValues>;
+
+// Maps a decision state to the string keying its entry in a values table.
+// Solvers default to State::InformationStateString; a custom function lets
+// symmetric infostates share one entry (e.g. suit isomorphisms in card
+// games, see DurakState::CanonicalInfoStateString). Because the tables are
+// indexed positionally over each state's legal actions, any two states
+// mapped to the same key must have action lists whose positions correspond
+// under the symmetry.
+using InfoStateKeyFn = std::function<std::string(const State&, Player)>;
 
 // The result parameter is passed by pointer in order to avoid copying/moving
 // the string once the table is fully serialized (CFRInfoStateValuesTable
@@ -118,6 +239,21 @@ void DeserializeCFRInfoStateValuesTable(absl::string_view serialized,
                                         CFRInfoStateValuesTable* result,
                                         std::string delimiter = "<~>");
 
+// Streaming binary checkpoint of a values table. Unlike
+// SerializeCFRInfoStateValuesTable, which builds the entire serialized string
+// in memory before it can be written, the writer flushes to `filename` every
+// `entries_per_chunk` entries, so peak memory above the table itself is one
+// chunk regardless of table size; the reader likewise parses the file
+// incrementally in fixed-size blocks. The format stores the table's value
+// type (CFRValue) bitwise in host byte order: lossless and fast, but, like
+// the double_precision == -1 text mode, not portable across architectures
+// (or across builds that differ in OPEN_SPIEL_CFR_FLOAT32_VALUES).
+void WriteCFRCheckpoint(const CFRInfoStateValuesTable& info_states,
+                        const std::string& filename,
+                        int entries_per_chunk = 4096);
+void ReadCFRCheckpoint(const std::string& filename,
+                       CFRInfoStateValuesTable* result);
+
 // A policy that extracts the average policy from the CFR table values, which
 // can be passed to tabular exploitability.
 class CFRAveragePolicy : public Policy {
@@ -127,8 +263,11 @@ class CFRAveragePolicy : public Policy {
   // state/info state (or an empty policy if default_policy is nullptr).
   // If an info state has zero cumulative regret for all actions,
   // return a uniform policy.
+  // The optional key_fn must be the one the table was built with; state
+  // lookups go through it (nullptr: InformationStateString).
   CFRAveragePolicy(const CFRInfoStateValuesTable& info_states,
-                   std::shared_ptr<Policy> default_policy);
+                   std::shared_ptr<Policy> default_policy,
+                   InfoStateKeyFn key_fn = nullptr);
   ActionsAndProbs GetStatePolicy(const State& state) const override {
     return GetStatePolicy(state, state.CurrentPlayer());
   };
@@ -141,19 +280,104 @@ class CFRAveragePolicy : public Policy {
   const CFRInfoStateValuesTable& info_states_;
   UniformPolicy uniform_policy_;
   std::shared_ptr<Policy> default_policy_;
+  InfoStateKeyFn key_fn_;
   void GetStatePolicyFromInformationStateValues(
       const CFRInfoStateValues& is_vals,
       ActionsAndProbs* actions_and_probs) const;
 };
 
+// A compacted snapshot of the average policy, for serving. Where
+// CFRAveragePolicy keeps a reference to the live table (three double vectors
+// per infostate), this copies just the average policy out, quantized to
+// 16-bit fixed point: per infostate it stores the legal actions as int32 and
+// a 16-bit weight per action in two flat arrays, about an eighth of the
+// table's per-action footprint. Probabilities are materialized on demand in
+// GetStatePolicy by normalizing the weights, so lookups return the same
+// ActionsAndProbs shape as CFRAveragePolicy with per-action error below
+// 1/65535 — negligible next to the convergence error of the table being
+// served. Infostates where every action has zero cumulative weight
+// materialize as uniform, matching CFRAveragePolicy.
+//
+// The snapshot is immutable and self-contained: the solver (and its table)
+// can be discarded or kept training after construction.
+class CompressedAveragePolicy : public Policy {
+ public:
+  explicit CompressedAveragePolicy(const CFRInfoStateValuesTable& info_states);
+
+  ActionsAndProbs GetStatePolicy(const State& state) const override {
+    return GetStatePolicy(state, state.CurrentPlayer());
+  };
+  ActionsAndProbs GetStatePolicy(const State& state,
+                                 Player player) const override;
+  ActionsAndProbs GetStatePolicy(const std::string& info_state) const override;
+
+ private:
+  struct Entry {
+    uint32_t offset;       // Into actions_/weights_.
+    uint32_t num_actions;
+  };
+  absl::flat_hash_map<std::string, Entry> index_;
+  std::vector<int32_t> actions_;
+  std::vector<uint16_t> weights_;
+};
+
+class CFRSolverBase;
+
+// A consistent, copy-free view of a solver's average policy at the moment
+// TakeAveragePolicySnapshot() was called. Taking a snapshot is O(1): no
+// table is copied. Instead, reads resolve against the live table, and the
+// solver preserves an entry's pre-change cumulative policy into the
+// snapshot the first time it is about to modify that entry
+// (copy-on-first-write). Memory therefore grows with how much of the table
+// changes while the snapshot is alive, not with the table size.
+//
+// Take snapshots from the solver's own thread, between iterations; the
+// returned snapshot may then be read from any number of threads while
+// iterations continue. The snapshot unregisters itself on destruction and
+// must not outlive the solver.
+class CFRAveragePolicySnapshot : public Policy {
+ public:
+  ~CFRAveragePolicySnapshot() override;
+
+  CFRAveragePolicySnapshot(const CFRAveragePolicySnapshot&) = delete;
+  CFRAveragePolicySnapshot& operator=(const CFRAveragePolicySnapshot&) =
+      delete;
+
+  ActionsAndProbs GetStatePolicy(const State& state) const override {
+    return GetStatePolicy(state, state.CurrentPlayer());
+  };
+  ActionsAndProbs GetStatePolicy(const State& state,
+                                 Player player) const override;
+  ActionsAndProbs GetStatePolicy(const std::string& info_state) const override;
+
+ private:
+  friend class CFRSolverBase;
+
+  struct Preserved {
+    // Empty legal_actions means the entry did not exist at snapshot time.
+    InternedActionSet legal_actions;
+    std::vector<CFRValue> cumulative_policy;
+  };
+
+  explicit CFRAveragePolicySnapshot(CFRSolverBase* solver)
+      : solver_(solver) {}
+
+  CFRSolverBase* const solver_;
+  // Pre-change values of entries modified since the snapshot was taken.
+  // Guarded by the solver's snapshot mutex.
+  std::unordered_map<std::string, Preserved> overlay_;
+};
+
 // A policy that extracts the current policy from the CFR table values.
 class CFRCurrentPolicy : public Policy {
  public:
   // Returns the current policy from the CFR values. If a default policy is
   // passed in, then it means that it is used if the lookup fails (use nullptr
   // to not use a default policy).
+  // As in CFRAveragePolicy, key_fn must match the table's keying.
   CFRCurrentPolicy(const CFRInfoStateValuesTable& info_states,
-                   std::shared_ptr<Policy> default_policy);
+                   std::shared_ptr<Policy> default_policy,
+                   InfoStateKeyFn key_fn = nullptr);
   ActionsAndProbs GetStatePolicy(const State& state) const override {
     return GetStatePolicy(state, state.CurrentPlayer());
   };
@@ -165,6 +389,7 @@ class CFRCurrentPolicy : public Policy {
  private:
   const CFRInfoStateValuesTable& info_states_;
   std::shared_ptr<Policy> default_policy_;
+  InfoStateKeyFn key_fn_;
   ActionsAndProbs GetStatePolicyFromInformationStateValues(
       const CFRInfoStateValues& is_vals,
       ActionsAndProbs& actions_and_probs) const;
@@ -187,9 +412,14 @@ class CFRCurrentPolicy : public Policy {
 //
 class CFRSolverBase {
  public:
+  // If num_threads > 1 and the game starts with a chance node (as card deals
+  // do), each iteration partitions the root chance outcomes across that many
+  // worker threads; see EvaluateAndUpdatePolicy for details. The result is
+  // identical to the single-threaded computation.
   CFRSolverBase(const Game& game, bool alternating_updates,
                 bool linear_averaging, bool regret_matching_plus,
-                bool random_initial_regrets = false, int seed = 0);
+                bool random_initial_regrets = false, int seed = 0,
+                int num_threads = 1);
   // The constructor below is used for deserialization purposes.
   CFRSolverBase(std::shared_ptr<const Game> game, bool alternating_updates,
                 bool linear_averaging, bool regret_matching_plus, int iteration,
@@ -199,11 +429,79 @@ class CFRSolverBase {
   // Performs one step of the CFR algorithm.
   virtual void EvaluateAndUpdatePolicy();
 
+  // Compile-time game binding: reruns the tree walk with the concrete state
+  // type StateT bound statically. With the generic State every per-node call
+  // (LegalActions, CurrentPlayer, ChanceOutcomes, ...) is virtual; when
+  // StateT is a final class the compiler binds them statically and can
+  // inline them into the traversal, which is worth a large constant factor
+  // on tree-walk-bound runs. Every state reached in the traversal must be a
+  // StateT (down_cast, checked in debug builds). Only types listed in the
+  // explicit instantiations at the bottom of cfr.cc can be bound; any other
+  // type fails at link time. Call before the first iteration.
+  template <typename StateT>
+  void BindStateType() {
+    traverse_impl_ = &CFRSolverBase::TraverseTreeImpl<StateT>;
+  }
+
+  // Reroutes all infostate keying through `key_fn` (nullptr restores the
+  // default InformationStateString); see InfoStateKeyFn for the contract.
+  // Must be called before the first iteration: the infostate table built
+  // during construction is discarded and rebuilt under the new keys.
+  void SetInfoStateKeyFn(InfoStateKeyFn key_fn);
+
+  // Enables regret-based pruning: traversals skip descending into actions
+  // whose cumulative regret has fallen below -threshold. Such actions have
+  // probability zero under regret matching, so the skipped subtree cannot
+  // affect the state value; only the pruned action's own regret update is
+  // deferred. Every revival_frequency-th iteration runs unpruned so that
+  // pruned actions' regrets keep tracking the true counterfactual values and
+  // actions can recover. Pass revival_frequency = 0 to disable. A no-op
+  // under regret_matching_plus, which floors regrets at zero. See Brown &
+  // Sandholm, "Regret-Based Pruning in Extensive-Form Games" (NIPS 2015).
+  void SetRegretBasedPruning(double threshold, int revival_frequency = 20);
+
+  // Enables Discounted CFR: at the end of iteration t, positive cumulative
+  // regrets are scaled by t^alpha / (t^alpha + 1), negative ones by
+  // t^beta / (t^beta + 1), and the cumulative policy by (t / (t + 1))^gamma.
+  // The scaling is fused into the existing table-wide regret-matching pass,
+  // so no extra traversal is performed. The paper's recommended defaults are
+  // alpha = 1.5, beta = 0, gamma = 2; use DCFRSolver to get them. See Brown
+  // & Sandholm, "Solving Imperfect-Information Games via Discounted Regret
+  // Minimization" (AAAI 2019).
+  void SetDiscounting(double alpha, double beta, double gamma);
+
+  // Enables predictive (optimistic) regret matching+ with quadratic
+  // averaging, i.e. PCFR+: the current policy is proportional to
+  // max(0, cumulative_regrets + last iteration's instantaneous regrets), and
+  // average-policy contributions are weighted by t^2. Should be combined
+  // with regret matching+ and alternating updates; use PCFRPlusSolver. See
+  // Farina, Kroer & Sandholm, "Faster Game Solving via Predictive
+  // Blackwell Approachability" (AAAI 2021).
+  void SetPredictiveRegretMatching(bool predictive);
+
+  // Warm starts the solver from an existing policy profile (e.g. a previous
+  // MCCFR run or a distilled network), as if `num_iterations` iterations had
+  // been played with every player following `policy`: one traversal under
+  // the profile computes each infostate's instantaneous regrets and
+  // reach-weighted action probabilities, and the cumulative tables are
+  // scaled to the totals that many such iterations would have accumulated
+  // (the substitute counterfactual values of Brown & Sandholm,
+  // "Strategy-Based Warm Starting for Regret Minimization in Games",
+  // AAAI 2016, with the profile's expected value as the substitute). The
+  // iteration counter advances to num_iterations, so linear/quadratic
+  // averaging and discounting continue with the right weights and a
+  // refinement run skips the cold start. `policy` must answer
+  // GetStatePolicy(info_state) for every infostate key reachable under
+  // itself (call SetInfoStateKeyFn first when using custom keys). Must be
+  // called before the first iteration.
+  void WarmStart(const Policy& policy, int num_iterations);
+
   // Computes the average policy, containing the policy for all players.
   // The returned policy instance should only be used during the lifetime of
   // the CFRSolver object.
   std::shared_ptr<Policy> AveragePolicy() const {
-    return std::make_shared<CFRAveragePolicy>(info_states_, nullptr);
+    return std::make_shared<CFRAveragePolicy>(info_states_, nullptr,
+                                              info_state_key_fn_);
   }
   // Note: This can be quite large.
   TabularPolicy TabularAveragePolicy() const {
@@ -211,11 +509,16 @@ class CFRSolverBase {
     return policy.AsTabular();
   }
 
+  // Returns an O(1), copy-on-write snapshot of the average policy that stays
+  // consistent while iterations continue; see CFRAveragePolicySnapshot.
+  std::unique_ptr<CFRAveragePolicySnapshot> TakeAveragePolicySnapshot();
+
   // Computes the current policy, containing the policy for all players.
   // The returned policy instance should only be used during the lifetime of
   // the CFRSolver object.
   std::shared_ptr<Policy> CurrentPolicy() const {
-    return std::make_shared<CFRCurrentPolicy>(info_states_, nullptr);
+    return std::make_shared<CFRCurrentPolicy>(info_states_, nullptr,
+                                              info_state_key_fn_);
   }
 
   TabularPolicy TabularCurrentPolicy() const {
@@ -239,6 +542,16 @@ class CFRSolverBase {
   const std::unique_ptr<State> root_state_;
   const std::vector<double> root_reach_probs_;
 
+  // Null unless overridden via SetInfoStateKeyFn.
+  InfoStateKeyFn info_state_key_fn_;
+
+  // The key for `state`'s current player under the active keying.
+  std::string InfoStateKey(const State& state) const {
+    return info_state_key_fn_
+               ? info_state_key_fn_(state, state.CurrentPlayer())
+               : state.InformationStateString();
+  }
+
   // Compute the counterfactual regret and update the average policy for the
   // specified player.
   // The optional `policy_overrides` can be used to specify for each player a
@@ -251,8 +564,10 @@ class CFRSolverBase {
       const std::vector<double>& reach_probabilities,
       const std::vector<const Policy*>* policy_overrides);
 
-  // Update the current policy for all information states.
-  void ApplyRegretMatching();
+  // Update the current policy for all information states. When `discount` is
+  // true, the DCFR discount factors for the just-finished iteration are
+  // applied to each entry's cumulative values before its policy is updated.
+  void ApplyRegretMatching(bool discount = false);
 
   // This method should return the type of itself so that it can be checked
   // in different deserialization methods; one method for each subtype.
@@ -263,12 +578,23 @@ class CFRSolverBase {
   }
 
  private:
+  // The traversal bodies, templated on the concrete state type (see
+  // BindStateType). Instantiated only in cfr.cc; StateT = State reproduces
+  // the former virtual-dispatch walk exactly.
+  template <typename StateT>
+  std::vector<double> ComputeCounterFactualRegretImpl(
+      const StateT& state, const absl::optional<int>& alternating_player,
+      const std::vector<double>& reach_probabilities,
+      const std::vector<const Policy*>* policy_overrides);
+
+  template <typename StateT>
   std::vector<double> ComputeCounterFactualRegretForActionProbs(
-      const State& state, const absl::optional<int>& alternating_player,
+      const StateT& state, const absl::optional<int>& alternating_player,
       const std::vector<double>& reach_probabilities, const int current_player,
       const std::vector<double>& info_state_policy,
-      const std::vector<Action>& legal_actions,
+      absl::Span<const Action> legal_actions,
       std::vector<double>* child_values_out,
+      const std::vector<bool>* pruned_actions,
       const std::vector<const Policy*>* policy_overrides);
 
   void InitializeInfostateNodes(const State& state);
@@ -276,14 +602,14 @@ class CFRSolverBase {
   // Fills `info_state_policy` to be a [num_actions] vector of the probabilities
   // found in `policy` at the given `info_state`.
   void GetInfoStatePolicyFromPolicy(std::vector<double>* info_state_policy,
-                                    const std::vector<Action>& legal_actions,
+                                    absl::Span<const Action> legal_actions,
                                     const Policy* policy,
                                     const std::string& info_state) const;
 
   // Get the policy at this information state. The probabilities are ordered in
   // the same order as legal_actions.
   std::vector<double> GetPolicy(const std::string& info_state,
-                                const std::vector<Action>& legal_actions);
+                                absl::Span<const Action> legal_actions);
 
   void ApplyRegretMatchingPlusReset();
 
@@ -293,6 +619,20 @@ class CFRSolverBase {
   bool AllPlayersHaveZeroReachProb(
       const std::vector<double>& reach_probabilities) const;
 
+  // Runs the regret/average-policy traversal for one (possibly alternating)
+  // update, either sequentially from the root or, when num_threads_ > 1 and
+  // the root is a chance node, by distributing the root chance outcomes
+  // round-robin across worker threads. Dispatches to the instantiation
+  // selected by BindStateType (the generic State one by default).
+  void TraverseTree(const absl::optional<int>& alternating_player);
+
+  template <typename StateT>
+  void TraverseTreeImpl(const absl::optional<int>& alternating_player);
+
+  // Adds the per-worker accumulated regret and average-policy increments in
+  // `delta` into info_states_, inserting entries the main table has not seen.
+  void MergeDeltaTable(CFRInfoStateValuesTable* delta);
+
   const bool regret_matching_plus_;
   const bool alternating_updates_;
   const bool linear_averaging_;
@@ -300,10 +640,67 @@ class CFRSolverBase {
 
   const int chance_player_;
 
+  // Number of worker threads used by TraverseTree; 1 means sequential.
+  const int num_threads_;
+
+  // The traversal instantiation TraverseTree dispatches to; rebound by
+  // BindStateType.
+  void (CFRSolverBase::*traverse_impl_)(const absl::optional<int>&) =
+      &CFRSolverBase::TraverseTreeImpl<State>;
+
+  // Regret-based pruning configuration; see SetRegretBasedPruning. The
+  // threshold is stored as given (non-negative) and compared against
+  // -prune_threshold_. prune_this_pass_ is recomputed once per iteration:
+  // false on revival iterations and whenever pruning is disabled.
+  double prune_threshold_ = 0.0;
+  int prune_revival_frequency_ = 0;
+  bool prune_this_pass_ = false;
+
+  // DCFR discounting configuration; see SetDiscounting.
+  bool discounting_ = false;
+  double discount_alpha_ = 0.0;
+  double discount_beta_ = 0.0;
+  double discount_gamma_ = 0.0;
+
+  // Predictive regret matching+ with quadratic averaging; see
+  // SetPredictiveRegretMatching.
+  bool predictive_ = false;
+
+  // Counts regret-matching passes over the table (one per call to
+  // ApplyRegretMatching, so several per iteration under alternating
+  // updates). Traversals stamp it into each updated entry's
+  // last_update_epoch; entries with an older stamp have unchanged regrets,
+  // and therefore an unchanged current policy, and are skipped by the pass.
+  int64_t update_epoch_ = 1;
+
+  // Set only inside parallel workers: when non-null, regret and
+  // average-policy updates go into this thread's private table instead of
+  // info_states_, which the workers read concurrently but never mutate.
+  static thread_local CFRInfoStateValuesTable* delta_table_;
+
   // CFR generally does not use this random number generator. However, this is
   // used for random initial regrets (and could be useful for some helper
   // methods for debugging).
   std::mt19937 rng_;
+
+  friend class CFRAveragePolicySnapshot;
+
+  // Called before the entry for `info_state` is created or its cumulative
+  // policy modified; preserves the pre-change values into every outstanding
+  // snapshot that has not yet seen this entry. The fast path is one relaxed
+  // atomic load, so iterations pay nothing when no snapshot is alive.
+  void PreserveForSnapshots(const std::string& info_state) {
+    if (snapshots_active_.load(std::memory_order_acquire)) {
+      PreserveForSnapshotsSlow(info_state);
+    }
+  }
+  void PreserveForSnapshotsSlow(const std::string& info_state);
+
+  // Guards snapshots_ and every snapshot's overlay, and orders snapshot
+  // reads of info_states_ with respect to preserved writes.
+  mutable absl::Mutex snapshot_mu_;
+  std::vector<CFRAveragePolicySnapshot*> snapshots_;
+  std::atomic<bool> snapshots_active_{false};
 };
 
 // Standard CFR implementation.
@@ -311,11 +708,13 @@ class CFRSolverBase {
 // See https://poker.cs.ualberta.ca/publications/NIPS07-cfr.pdf
 class CFRSolver : public CFRSolverBase {
  public:
-  explicit CFRSolver(const Game& game)
+  explicit CFRSolver(const Game& game, int num_threads = 1)
       : CFRSolverBase(game,
                       /*alternating_updates=*/true,
                       /*linear_averaging=*/false,
-                      /*regret_matching_plus=*/false) {}
+                      /*regret_matching_plus=*/false,
+                      /*random_initial_regrets=*/false, /*seed=*/0,
+                      num_threads) {}
   // The constructor below is used for deserialization purposes.
   CFRSolver(std::shared_ptr<const Game> game, int iteration)
       : CFRSolverBase(game,
@@ -359,6 +758,54 @@ class CFRPlusSolver : public CFRSolverBase {
 std::unique_ptr<CFRPlusSolver> DeserializeCFRPlusSolver(
     const std::string& serialized, std::string delimiter = "<~>");
 
+// Discounted CFR (DCFR) implementation.
+//
+// See https://arxiv.org/abs/1809.04040
+//
+// DCFR is CFR with alternating updates and per-iteration discounting of the
+// cumulative regrets and cumulative policy (see SetDiscounting). Linear
+// averaging is left off because the gamma discount already weights the
+// average; the defaults below are the paper's recommended ones.
+class DCFRSolver : public CFRSolverBase {
+ public:
+  explicit DCFRSolver(const Game& game, double alpha = 1.5, double beta = 0.0,
+                      double gamma = 2.0, int num_threads = 1)
+      : CFRSolverBase(game,
+                      /*alternating_updates=*/true,
+                      /*linear_averaging=*/false,
+                      /*regret_matching_plus=*/false,
+                      /*random_initial_regrets=*/false, /*seed=*/0,
+                      num_threads) {
+    SetDiscounting(alpha, beta, gamma);
+  }
+
+ protected:
+  std::string SerializeThisType() const { return "DCFRSolver"; }
+};
+
+// Predictive CFR+ (PCFR+) implementation.
+//
+// See https://arxiv.org/abs/2007.14358
+//
+// PCFR+ is CFR+ with predictive regret matching+ and quadratic averaging
+// (see SetPredictiveRegretMatching). Linear averaging is left off because
+// the quadratic weighting replaces it.
+class PCFRPlusSolver : public CFRSolverBase {
+ public:
+  explicit PCFRPlusSolver(const Game& game, int num_threads = 1)
+      : CFRSolverBase(game,
+                      /*alternating_updates=*/true,
+                      /*linear_averaging=*/false,
+                      /*regret_matching_plus=*/true,
+                      /*random_initial_regrets=*/false, /*seed=*/0,
+                      num_threads) {
+    SetPredictiveRegretMatching(true);
+  }
+
+ protected:
+  std::string SerializeThisType() const { return "PCFRPlusSolver"; }
+};
+
 struct PartiallyDeserializedCFRSolver {
   PartiallyDeserializedCFRSolver(std::shared_ptr<const Game> game,
                                  std::string solver_type,
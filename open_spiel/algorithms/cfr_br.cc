@@ -14,19 +14,25 @@
 
 #include "open_spiel/algorithms/cfr_br.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "open_spiel/algorithms/cfr.h"
 #include "open_spiel/policy.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
 
-CFRBRSolver::CFRBRSolver(const Game& game)
+CFRBRSolver::CFRBRSolver(const Game& game, int num_threads)
     : CFRSolverBase(game,
                     /*alternating_updates=*/false,
                     /*linear_averaging=*/false,
                     /*regret_matching_plus=*/false),
       policy_overrides_(game.NumPlayers(), nullptr),
-      uniform_policy_(UniformPolicy()) {
+      uniform_policy_(UniformPolicy()),
+      num_br_threads_(num_threads) {
+  SPIEL_CHECK_GE(num_threads, 1);
   InitializeBestResponseComputers();
 }
 
@@ -36,7 +42,8 @@ CFRBRSolver::CFRBRSolver(std::shared_ptr<const Game> game, int iteration)
                     /*linear_averaging=*/false,
                     /*regret_matching_plus=*/false, iteration),
       policy_overrides_(game->NumPlayers(), nullptr),
-      uniform_policy_(UniformPolicy()) {
+      uniform_policy_(UniformPolicy()),
+      num_br_threads_(1) {
   InitializeBestResponseComputers();
 }
 
@@ -50,22 +57,38 @@ void CFRBRSolver::InitializeBestResponseComputers() {
 void CFRBRSolver::EvaluateAndUpdatePolicy() {
   ++iteration_;
 
-  std::vector<TabularPolicy> br_policies(game_->NumPlayers());
+  const int num_players = game_->NumPlayers();
+  std::vector<TabularPolicy> br_policies(num_players);
   std::shared_ptr<Policy> current_policy = CurrentPolicy();
 
-  // Set all the player's policies first.
-  for (int p = 0; p < game_->NumPlayers(); ++p) {
+  // The per-player best responses are independent: each computer owns its
+  // own tree and caches, and all of them only read the (frozen) current
+  // policy. SetPolicyReusingTree keeps the computers' history trees from the
+  // constructor alive across iterations instead of re-enumerating them.
+  auto compute_best_response = [&](int p) {
     // Need to have an exception here because the CFR policy objects are
     // wrappers around information that is contained in a table, and those do
     // not exist until there's been a tree traversal to compute regrets below.
     if (iteration_ > 1) {
-      best_response_computers_[p]->SetPolicy(current_policy.get());
+      best_response_computers_[p]->SetPolicyReusingTree(current_policy.get());
     }
-  }
-
-  // Now, for each player compute a best response
-  for (int p = 0; p < game_->NumPlayers(); ++p) {
     br_policies[p] = best_response_computers_[p]->GetBestResponsePolicy();
+  };
+  if (num_br_threads_ <= 1) {
+    for (int p = 0; p < num_players; ++p) compute_best_response(p);
+  } else {
+    const int num_workers = std::min(num_br_threads_, num_players);
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int w = 0; w < num_workers; ++w) {
+      workers.emplace_back(
+          [&compute_best_response, w, num_workers, num_players]() {
+            for (int p = w; p < num_players; p += num_workers) {
+              compute_best_response(p);
+            }
+          });
+    }
+    for (Thread& worker : workers) worker.join();
   }
 
   for (int p = 0; p < game_->NumPlayers(); ++p) {
@@ -33,7 +33,10 @@ namespace algorithms {
 
 class CFRBRSolver : public CFRSolverBase {
  public:
-  explicit CFRBRSolver(const Game& game);
+  // If num_threads > 1, the per-player best responses within each iteration
+  // (which are independent of each other) are computed concurrently on up to
+  // that many threads; the results are identical to a single-threaded run.
+  explicit CFRBRSolver(const Game& game, int num_threads = 1);
   // The constructor below is used for deserialization purposes.
   CFRBRSolver(std::shared_ptr<const Game> game, int iteration);
 
@@ -49,6 +52,8 @@ class CFRBRSolver : public CFRSolverBase {
   std::vector<const Policy*> policy_overrides_;
   UniformPolicy uniform_policy_;
   std::vector<std::unique_ptr<TabularBestResponse>> best_response_computers_;
+  // Thread budget for the per-player best-response phase.
+  const int num_br_threads_;
 };
 
 std::unique_ptr<CFRBRSolver> DeserializeCFRBRSolver(
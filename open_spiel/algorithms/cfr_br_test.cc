@@ -59,6 +59,22 @@ void CFRBRTest_LeducPoker() {
             << std::endl;
 }
 
+// The threaded best-response phase and the tree-reusing policy reset must
+// leave the iterates unchanged: a parallel solver's average policy matches
+// the single-threaded one's exactly.
+void CFRBRTest_ParallelMatchesSequential() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  CFRBRSolver sequential(*game);
+  CFRBRSolver parallel(*game, /*num_threads=*/2);
+  for (int i = 0; i < 50; i++) {
+    sequential.EvaluateAndUpdatePolicy();
+    parallel.EvaluateAndUpdatePolicy();
+  }
+  SPIEL_CHECK_FLOAT_NEAR(Exploitability(*game, *sequential.AveragePolicy()),
+                         Exploitability(*game, *parallel.AveragePolicy()),
+                         1e-12);
+}
+
 void CFRBRTest_CFRBRSolverSerialization() {
   auto game = LoadGame("kuhn_poker");
   CFRBRSolver solver = CFRBRSolver(*game);
@@ -96,5 +112,6 @@ namespace algorithms = open_spiel::algorithms;
 int main(int argc, char** argv) {
   algorithms::CFRBRTest_KuhnPoker();
   algorithms::CFRBRTest_LeducPoker();
+  algorithms::CFRBRTest_ParallelMatchesSequential();
   algorithms::CFRBRTest_CFRBRSolverSerialization();
 }
@@ -28,6 +28,7 @@
 #include "open_spiel/games/tic_tac_toe/tic_tac_toe.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -102,6 +103,30 @@ void CFRPlusTest_KuhnPoker() {
   CheckExploitabilityKuhnPoker(*game, *average_policy);
 }
 
+void DCFRTest_KuhnPoker() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  DCFRSolver solver(*game);
+  // Discounting reaches the same exploitability in fewer iterations than the
+  // 300 CFRTest_KuhnPoker needs.
+  for (int i = 0; i < 100; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  const std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  CheckNashKuhnPoker(*game, *average_policy);
+  CheckExploitabilityKuhnPoker(*game, *average_policy);
+}
+
+void PCFRPlusTest_KuhnPoker() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  PCFRPlusSolver solver(*game);
+  for (int i = 0; i < 100; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  const std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  CheckNashKuhnPoker(*game, *average_policy);
+  CheckExploitabilityKuhnPoker(*game, *average_policy);
+}
+
 void CFRTest_KuhnPokerRunsWithThreePlayers(bool linear_averaging,
                                            bool regret_matching_plus,
                                            bool alternating_updates) {
@@ -227,6 +252,248 @@ void CFRTest_InfoStateValuesTableSerialization() {
   }
 }
 
+void CFRTest_BindStateType() {
+  // Rebinding the traversal (here to the generic State instantiation, the
+  // same one the default dispatch uses) must not change any result: run a
+  // bound and an unbound solver in lockstep and compare their policies.
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  CFRSolver solver(*game);
+  CFRSolver bound_solver(*game);
+  bound_solver.BindStateType<State>();
+  for (int i = 0; i < 50; i++) {
+    solver.EvaluateAndUpdatePolicy();
+    bound_solver.EvaluateAndUpdatePolicy();
+  }
+  TabularPolicy policy = solver.TabularAveragePolicy();
+  TabularPolicy bound_policy = bound_solver.TabularAveragePolicy();
+  for (const auto& [info_state, state_policy] : policy.PolicyTable()) {
+    const ActionsAndProbs& bound_state_policy =
+        bound_policy.PolicyTable().at(info_state);
+    SPIEL_CHECK_EQ(state_policy.size(), bound_state_policy.size());
+    for (int i = 0; i < state_policy.size(); ++i) {
+      SPIEL_CHECK_EQ(state_policy[i].second, bound_state_policy[i].second);
+    }
+  }
+}
+
+void CFRTest_RegretBasedPruning() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  CFRSolver solver(*game);
+  solver.SetRegretBasedPruning(/*threshold=*/1.0, /*revival_frequency=*/10);
+  for (int i = 0; i < 300; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  const std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  CheckNashKuhnPoker(*game, *average_policy);
+  CheckExploitabilityKuhnPoker(*game, *average_policy);
+}
+
+void CFRTest_LazyAveraging() {
+  // The average-policy writes are deferred into per-entry pending weights
+  // and folded by the regret-matching pass ending each traversal. Between
+  // iterations every pending weight must therefore be zero, so that the
+  // average-policy readers and serialization see fully folded tables.
+  // Exercise the lazy path together with linear averaging (weighted
+  // pending) and pruning (which falls back to the eager per-action writes
+  // at entries with pruned actions).
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  CFRPlusSolver solver(*game);
+  for (int i = 0; i < 200; i++) {
+    solver.EvaluateAndUpdatePolicy();
+    for (const auto& [info_state, values] : solver.InfoStateValuesTable()) {
+      SPIEL_CHECK_EQ(values.pending_avg_weight, 0);
+    }
+  }
+  CheckNashKuhnPoker(*game, *solver.AveragePolicy());
+
+  CFRSolver pruning_solver(*game);
+  pruning_solver.SetRegretBasedPruning(/*threshold=*/1.0,
+                                       /*revival_frequency=*/10);
+  for (int i = 0; i < 300; i++) {
+    pruning_solver.EvaluateAndUpdatePolicy();
+    for (const auto& [info_state, values] :
+         pruning_solver.InfoStateValuesTable()) {
+      SPIEL_CHECK_EQ(values.pending_avg_weight, 0);
+    }
+  }
+  CheckNashKuhnPoker(*game, *pruning_solver.AveragePolicy());
+}
+
+void CFRTest_InternedLegalActionSets() {
+  // Entries built from equal action vectors share one interned copy.
+  CFRInfoStateValues values_a({0, 1, 2}, 0.1);
+  CFRInfoStateValues values_b({0, 1, 2}, 0.2);
+  CFRInfoStateValues values_c({0, 1, 2, 3}, 0.1);
+  SPIEL_CHECK_EQ(&values_a.legal_actions.actions(),
+                 &values_b.legal_actions.actions());
+  SPIEL_CHECK_TRUE(&values_a.legal_actions.actions() !=
+                   &values_c.legal_actions.actions());
+  SPIEL_CHECK_EQ(values_a.legal_actions.size(), 3);
+  SPIEL_CHECK_EQ(values_a.legal_actions.at(2), 2);
+
+  // Running a solver never creates more distinct sets than infostates.
+  auto game = LoadGame("kuhn_poker");
+  CFRSolver solver(*game);
+  for (int i = 0; i < 10; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  // The pool is process-wide, so allow for sets interned by earlier tests
+  // (plus the shared empty set): its size is bounded by the infostates seen.
+  SPIEL_CHECK_GT(InternedActionSet::NumInternedSets(), 0);
+  SPIEL_CHECK_LE(InternedActionSet::NumInternedSets(),
+                 static_cast<int>(solver.InfoStateValuesTable().size()) + 8);
+}
+
+void CFRTest_CompressedAveragePolicy() {
+  auto game = LoadGame("kuhn_poker");
+  CFRSolver solver(*game);
+  for (int i = 0; i < 100; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  CompressedAveragePolicy compressed(solver.InfoStateValuesTable());
+
+  // Per-action quantization error is bounded by 1/65535 plus renormalization.
+  for (const auto& [info_state, values] : solver.InfoStateValuesTable()) {
+    ActionsAndProbs exact = average_policy->GetStatePolicy(info_state);
+    ActionsAndProbs quantized = compressed.GetStatePolicy(info_state);
+    SPIEL_CHECK_EQ(exact.size(), quantized.size());
+    for (int i = 0; i < exact.size(); ++i) {
+      SPIEL_CHECK_EQ(exact[i].first, quantized[i].first);
+      SPIEL_CHECK_FLOAT_NEAR(exact[i].second, quantized[i].second, 1e-3);
+    }
+  }
+
+  // The quantized policy must remain (nearly) as unexploitable.
+  double exact_expl = Exploitability(*game, *average_policy);
+  double quantized_expl = Exploitability(*game, compressed);
+  SPIEL_CHECK_FLOAT_NEAR(quantized_expl, exact_expl, 1e-3);
+}
+
+void CFRTest_AveragePolicySnapshot() {
+  auto game = LoadGame("kuhn_poker");
+  CFRSolver solver(*game);
+  for (int i = 0; i < 20; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+
+  // The snapshot must keep returning the iteration-20 average policy while
+  // the solver keeps iterating.
+  std::unique_ptr<CFRAveragePolicySnapshot> snapshot =
+      solver.TakeAveragePolicySnapshot();
+  TabularPolicy at_snapshot_time = solver.TabularAveragePolicy();
+  for (int i = 0; i < 100; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  for (const auto& [info_state, expected] :
+       at_snapshot_time.PolicyTable()) {
+    SPIEL_CHECK_TRUE(StatePoliciesEqual(snapshot->GetStatePolicy(info_state),
+                                        expected, 1e-12));
+  }
+
+  // The live average has moved on, and a fresh snapshot tracks it.
+  std::unique_ptr<CFRAveragePolicySnapshot> fresh =
+      solver.TakeAveragePolicySnapshot();
+  TabularPolicy now = solver.TabularAveragePolicy();
+  for (const auto& [info_state, expected] : now.PolicyTable()) {
+    SPIEL_CHECK_TRUE(StatePoliciesEqual(fresh->GetStatePolicy(info_state),
+                                        expected, 1e-12));
+  }
+
+  // Dropping snapshots re-enables the no-snapshot fast path; iterations and
+  // further snapshots still behave.
+  snapshot.reset();
+  fresh.reset();
+  for (int i = 0; i < 10; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  std::unique_ptr<CFRAveragePolicySnapshot> last =
+      solver.TakeAveragePolicySnapshot();
+  TabularPolicy final_policy = solver.TabularAveragePolicy();
+  for (const auto& [info_state, expected] : final_policy.PolicyTable()) {
+    SPIEL_CHECK_TRUE(StatePoliciesEqual(last->GetStatePolicy(info_state),
+                                        expected, 1e-12));
+  }
+}
+
+void CFRTest_CheckpointRoundTrip() {
+  auto game = LoadGame("kuhn_poker");
+  CFRSolver solver(*game);
+  for (int i = 0; i < 10; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  const CFRInfoStateValuesTable& table = solver.InfoStateValuesTable();
+
+  std::string filename = file::GetTmpDir() + "/cfr_test_checkpoint.bin";
+  // Small chunk size so the round trip exercises multiple flushes.
+  WriteCFRCheckpoint(table, filename, /*entries_per_chunk=*/3);
+  CFRInfoStateValuesTable restored;
+  ReadCFRCheckpoint(filename, &restored);
+  file::Remove(filename);
+
+  SPIEL_CHECK_EQ(table.size(), restored.size());
+  for (const auto& [info_state, values] : table) {
+    const CFRInfoStateValues& r = restored.at(info_state);
+    for (int i = 0; i < values.legal_actions.size(); i++) {
+      SPIEL_CHECK_EQ(values.legal_actions.at(i), r.legal_actions.at(i));
+      // The binary format is bitwise, so equality is exact.
+      SPIEL_CHECK_EQ(values.cumulative_regrets.at(i),
+                     r.cumulative_regrets.at(i));
+      SPIEL_CHECK_EQ(values.cumulative_policy.at(i),
+                     r.cumulative_policy.at(i));
+      SPIEL_CHECK_EQ(values.current_policy.at(i), r.current_policy.at(i));
+    }
+  }
+}
+
+void CFRTest_WarmStart() {
+  auto game = LoadGame("kuhn_poker");
+  // A donor run provides the profile to warm start from.
+  CFRSolver donor(*game);
+  for (int i = 0; i < 200; i++) {
+    donor.EvaluateAndUpdatePolicy();
+  }
+  TabularPolicy warm_policy = donor.TabularAveragePolicy();
+  double warm_expl = Exploitability(*game, warm_policy);
+
+  // Immediately after warm starting, the average policy is the warm policy:
+  // the cumulative weights are the reach-weighted profile probabilities and
+  // the reach factors out of the per-infostate normalization.
+  CFRSolver solver(*game);
+  solver.WarmStart(warm_policy, /*num_iterations=*/200);
+  TabularPolicy after = solver.TabularAveragePolicy();
+  for (const auto& [info_state, expected] : warm_policy.PolicyTable()) {
+    const ActionsAndProbs& actual = after.PolicyTable().at(info_state);
+    SPIEL_CHECK_EQ(expected.size(), actual.size());
+    for (int i = 0; i < expected.size(); ++i) {
+      SPIEL_CHECK_EQ(expected[i].first, actual[i].first);
+      SPIEL_CHECK_FLOAT_NEAR(expected[i].second, actual[i].second, 1e-9);
+    }
+  }
+
+  // A short refinement run improves on the warm policy, and beats a cold
+  // run of the same length.
+  for (int i = 0; i < 100; i++) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  double refined_expl = Exploitability(*game, *solver.AveragePolicy());
+  SPIEL_CHECK_LT(refined_expl, warm_expl);
+  CFRSolver cold(*game);
+  for (int i = 0; i < 100; i++) {
+    cold.EvaluateAndUpdatePolicy();
+  }
+  SPIEL_CHECK_LT(refined_expl, Exploitability(*game, *cold.AveragePolicy()));
+
+  // Warm starting composes with CFR+: regret matching+ floors the negative
+  // substitute regrets and linear averaging reweights the warm policy.
+  CFRPlusSolver plus(*game);
+  plus.WarmStart(warm_policy, /*num_iterations=*/200);
+  for (int i = 0; i < 100; i++) {
+    plus.EvaluateAndUpdatePolicy();
+  }
+  SPIEL_CHECK_LE(Exploitability(*game, *plus.AveragePolicy()), warm_expl);
+}
+
 void CFRTest_CFRSolverSerialization() {
   auto game = LoadGame("kuhn_poker");
   CFRSolver solver = CFRSolver(*game);
@@ -265,6 +532,8 @@ int main(int argc, char** argv) {
   algorithms::CFRTest_KuhnPoker();
   algorithms::CFRTest_IIGoof4();
   algorithms::CFRPlusTest_KuhnPoker();
+  algorithms::DCFRTest_KuhnPoker();
+  algorithms::PCFRPlusTest_KuhnPoker();
   algorithms::CFRTest_KuhnPokerRunsWithThreePlayers(
       /*linear_averaging=*/false,
       /*regret_matching_plus=*/false,
@@ -319,6 +588,14 @@ int main(int argc, char** argv) {
   // states.
   // algorithms::CFRTest_TicTacToe(10, 2.0);
 
+  algorithms::CFRTest_BindStateType();
+  algorithms::CFRTest_RegretBasedPruning();
+  algorithms::CFRTest_LazyAveraging();
   algorithms::CFRTest_InfoStateValuesTableSerialization();
+  algorithms::CFRTest_InternedLegalActionSets();
+  algorithms::CFRTest_CheckpointRoundTrip();
+  algorithms::CFRTest_CompressedAveragePolicy();
+  algorithms::CFRTest_AveragePolicySnapshot();
+  algorithms::CFRTest_WarmStart();
   algorithms::CFRTest_CFRSolverSerialization();
 }
@@ -14,6 +14,13 @@
 
 #include "open_spiel/algorithms/corr_dev_builder.h"
 
+#include <atomic>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel_utils.h"
 
@@ -48,6 +55,74 @@ void CorrDevBuilder::AddSampledJointPolicy(const TabularPolicy& policy,
   }
 }
 
+void CorrDevBuilder::AddSampledJointPolicyParallel(const TabularPolicy& policy,
+                                                   int num_samples,
+                                                   int num_threads,
+                                                   double weight) {
+  SPIEL_CHECK_GT(num_samples, 0);
+  SPIEL_CHECK_GE(num_threads, 1);
+
+  // Per-shard entry: accumulated weight plus the sampled policy itself,
+  // built only the first time its key is seen.
+  struct ShardEntry {
+    double weight = 0.0;
+    TabularPolicy policy;
+  };
+  std::vector<absl::flat_hash_map<std::string, ShardEntry>> shards(num_threads);
+
+  // Draw the worker seeds from the builder's RNG up front so the member RNG
+  // is never touched concurrently.
+  std::vector<std::mt19937::result_type> seeds;
+  seeds.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) seeds.push_back(rng_());
+
+  const double sample_weight = weight / num_samples;
+  std::atomic<int> next_sample(0);
+  auto worker = [&](int thread_num) {
+    std::mt19937 rng(seeds[thread_num]);
+    absl::flat_hash_map<std::string, ShardEntry>& shard = shards[thread_num];
+    std::vector<Action> sampled_actions;
+    sampled_actions.reserve(policy.PolicyTable().size());
+    std::string key;
+    for (int sample = next_sample++; sample < num_samples;
+         sample = next_sample++) {
+      // All samples iterate the same (unmodified) policy table, so the
+      // sampled action sequence identifies the joint policy and serves as
+      // a cheap interned key; the canonical stringified key is computed
+      // only once per distinct policy during the merge below.
+      sampled_actions.clear();
+      key.clear();
+      for (const auto& iter : policy.PolicyTable()) {
+        Action sampled_action = SampleAction(iter.second, rng).first;
+        sampled_actions.push_back(sampled_action);
+        absl::StrAppend(&key, sampled_action, ",");
+      }
+      ShardEntry& entry = shard[key];
+      entry.weight += sample_weight;
+      if (entry.policy.PolicyTable().empty()) {
+        int idx = 0;
+        for (const auto& iter : policy.PolicyTable()) {
+          entry.policy.SetStatePolicy(
+              iter.first,
+              ToDeterministicPolicy(iter.second, sampled_actions[idx++]));
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) threads.emplace_back(worker, i);
+  for (std::thread& thread : threads) thread.join();
+
+  for (const auto& shard : shards) {
+    for (const auto& key_and_entry : shard) {
+      AddDeterminsticJointPolicy(key_and_entry.second.policy,
+                                 key_and_entry.second.weight);
+    }
+  }
+}
+
 void CorrDevBuilder::AddMixedJointPolicy(const TabularPolicy& policy,
                                          double weight) {
   std::vector<int> action_indices(policy.PolicyTable().size(), 0);
@@ -51,6 +51,18 @@ class CorrDevBuilder {
   void AddSampledJointPolicy(const TabularPolicy& policy, int num_samples,
                              double weight = 1.0);
 
+  // Parallel version of AddSampledJointPolicy: the samples are drawn by
+  // num_threads workers, each accumulating into its own weight map keyed by
+  // the sampled action sequence (much cheaper to build than the canonical
+  // stringified policy), and the shards are merged into the builder at the
+  // end, computing the canonical key once per distinct sampled policy. The
+  // result is equivalent to the serial version with the same number of
+  // samples, up to which samples the RNG draws. The builder itself must not
+  // be used concurrently while this call runs.
+  void AddSampledJointPolicyParallel(const TabularPolicy& policy,
+                                     int num_samples, int num_threads,
+                                     double weight = 1.0);
+
   // This function adds a mixed joint policy to the correlation device. It does
   // so by computing the probability of each deterministic joint policy by
   // enumerating all possible actions that the policy is mixing over and
@@ -90,6 +90,21 @@ void BasicSamplingCorrDevBuilderTest() {
   SPIEL_CHECK_LE(mu.size(), 64 * 64);
 }
 
+void ParallelSamplingCorrDevBuilderTest() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  CorrDevBuilder cd_builder;
+  TabularPolicy uniform_policy = GetUniformPolicy(*game);
+  cd_builder.AddSampledJointPolicyParallel(uniform_policy, 10000,
+                                           /*num_threads=*/4);
+  CorrelationDevice mu = cd_builder.GetCorrelationDevice();
+  SPIEL_CHECK_LE(mu.size(), 64 * 64);
+  double total_prob = 0.0;
+  for (const auto& prob_and_policy : mu) {
+    total_prob += prob_and_policy.first;
+  }
+  SPIEL_CHECK_FLOAT_NEAR(total_prob, 1.0, 1e-10);
+}
+
 void CFRShapleysCorrDistTest() {
   std::shared_ptr<const Game> game =
       LoadGame("turn_based_simultaneous_game(game=matrix_shapleys_game())");
@@ -168,6 +183,7 @@ namespace algorithms = open_spiel::algorithms;
 int main(int argc, char** argv) {
   algorithms::BasicCorrDevBuilderTest();
   algorithms::BasicSamplingCorrDevBuilderTest();
+  algorithms::ParallelSamplingCorrDevBuilderTest();
   algorithms::CFRShapleysCorrDistTest();
   algorithms::CFRGoofspielCorrDistTest();
 }
@@ -14,8 +14,10 @@
 
 #include "open_spiel/algorithms/corr_dist.h"
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
@@ -36,6 +38,7 @@
 #include "open_spiel/game_transforms/turn_based_simultaneous_game.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -126,29 +129,55 @@ std::string ToString(const CorrelationDevice& corr_dev) {
 }
 
 std::vector<double> ExpectedValues(const Game& game,
-                                   const CorrelationDevice& mu) {
+                                   const CorrelationDevice& mu,
+                                   int num_threads) {
+  SPIEL_CHECK_GE(num_threads, 1);
   CheckCorrelationDeviceProbDist(mu);
+  // Each device entry is one independent ExpectedReturns walk; the walks go
+  // to worker threads, and the weighted sum is taken in device order below so
+  // the result is identical to the serial evaluation.
+  std::vector<std::vector<double>> item_values(mu.size());
+  const int num_workers = std::min<int>(num_threads, mu.size());
+  if (num_workers <= 1) {
+    for (int i = 0; i < mu.size(); ++i) {
+      item_values[i] =
+          ExpectedReturns(*game.NewInitialState(), mu[i].second, -1, false);
+    }
+  } else {
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int t = 0; t < num_workers; ++t) {
+      workers.emplace_back([t, num_workers, &game, &mu, &item_values]() {
+        for (int i = t; i < mu.size(); i += num_workers) {
+          item_values[i] =
+              ExpectedReturns(*game.NewInitialState(), mu[i].second, -1,
+                              false);
+        }
+      });
+    }
+    for (Thread& worker : workers) worker.join();
+  }
+
   std::vector<double> values(game.NumPlayers(), 0);
-  for (const std::pair<double, TabularPolicy>& item : mu) {
-    std::vector<double> item_values =
-        ExpectedReturns(*game.NewInitialState(), item.second, -1, false);
+  for (int i = 0; i < mu.size(); ++i) {
     for (Player p = 0; p < game.NumPlayers(); ++p) {
-      values[p] += item.first * item_values[p];
+      values[p] += mu[i].first * item_values[i][p];
     }
   }
   return values;
 }
 
 std::vector<double> ExpectedValues(const Game& game,
-                                   const NormalFormCorrelationDevice& mu) {
+                                   const NormalFormCorrelationDevice& mu,
+                                   int num_threads) {
   if (game.GetType().information == GameType::Information::kOneShot) {
     std::shared_ptr<const Game> actual_game = ConvertToTurnBased(game);
     CorrelationDevice converted_mu = ConvertCorrelationDevice(*actual_game, mu);
-    return ExpectedValues(*actual_game, converted_mu);
+    return ExpectedValues(*actual_game, converted_mu, num_threads);
   } else {
     SPIEL_CHECK_EQ(game.GetType().dynamics, GameType::Dynamics::kSequential);
     CorrelationDevice converted_mu = ConvertCorrelationDevice(game, mu);
-    return ExpectedValues(game, converted_mu);
+    return ExpectedValues(game, converted_mu, num_threads);
   }
 }
 
@@ -289,9 +318,10 @@ CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu, int player,
 
 CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu,
                      const float prob_cut_threshold,
-                     const float action_value_tolerance) {
+                     const float action_value_tolerance, int num_threads) {
   // Check for proper probability distribution.
   CheckCorrelationDeviceProbDist(mu);
+  SPIEL_CHECK_GE(num_threads, 1);
   CorrDistConfig config;
   auto cce_game =
       std::make_shared<CCEGame>(game.shared_from_this(), config, mu);
@@ -312,13 +342,36 @@ CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu,
 
   CCETabularPolicy policy;
 
-  std::unique_ptr<State> root = cce_game->NewInitialState();
-  for (auto p = Player{0}; p < cce_game->NumPlayers(); ++p) {
-    TabularBestResponse best_response(*cce_game, p, &policy, prob_cut_threshold,
+  // The per-player deviation best responses are independent, so they can go
+  // to worker threads; each works over its own root state.
+  auto best_respond = [&cce_game, &policy, prob_cut_threshold,
+                       action_value_tolerance, &dist_info](Player p) {
+    TabularBestResponse best_response(*cce_game, p, &policy,
+                                      prob_cut_threshold,
                                       action_value_tolerance);
-    dist_info.best_response_values[p] = best_response.Value(*root);
+    dist_info.best_response_values[p] =
+        best_response.Value(*cce_game->NewInitialState());
     dist_info.best_response_policies[p] = best_response.GetBestResponsePolicy();
+  };
+  const int num_workers = std::min(num_threads, cce_game->NumPlayers());
+  if (num_workers <= 1) {
+    for (auto p = Player{0}; p < cce_game->NumPlayers(); ++p) {
+      best_respond(p);
+    }
+  } else {
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int t = 0; t < num_workers; ++t) {
+      workers.emplace_back([&best_respond, &cce_game, t, num_workers]() {
+        for (Player p = t; p < cce_game->NumPlayers(); p += num_workers) {
+          best_respond(p);
+        }
+      });
+    }
+    for (Thread& worker : workers) worker.join();
   }
+
+  std::unique_ptr<State> root = cce_game->NewInitialState();
   dist_info.on_policy_values = ExpectedReturns(*root, policy, -1, false);
   SPIEL_CHECK_EQ(dist_info.best_response_values.size(),
                  dist_info.on_policy_values.size());
@@ -333,9 +386,10 @@ CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu,
 }
 
 CorrDistInfo CEDist(const Game& game, const CorrelationDevice& mu,
-                    const float action_value_tolerance) {
+                    const float action_value_tolerance, int num_threads) {
   // Check for proper probability distribution.
   CheckCorrelationDeviceProbDist(mu);
+  SPIEL_CHECK_GE(num_threads, 1);
   CorrDistConfig config;
   auto ce_game = std::make_shared<CEGame>(game.shared_from_this(), config, mu);
 
@@ -349,13 +403,15 @@ CorrDistInfo CEDist(const Game& game, const CorrelationDevice& mu,
 
   CETabularPolicy policy(config);
 
-  // For similar reasons as in CCEDist, we must manually do NashConv.
-
-  std::unique_ptr<State> root = ce_game->NewInitialState();
-  for (auto p = Player{0}; p < ce_game->NumPlayers(); ++p) {
+  // For similar reasons as in CCEDist, we must manually do NashConv. As
+  // there, the per-player deviations are independent and can go to worker
+  // threads; each writes only its own player's slots of dist_info.
+  auto best_respond = [&ce_game, &policy, action_value_tolerance, &config,
+                       &dist_info](Player p) {
     TabularBestResponse best_response(*ce_game, p, &policy, -1.0,
                                       action_value_tolerance);
-    dist_info.best_response_values[p] = best_response.Value(*root);
+    dist_info.best_response_values[p] =
+        best_response.Value(*ce_game->NewInitialState());
 
     // This policy has all of the conditional ones built in. We have to extract
     // one per signal by mapping back the info states.
@@ -381,8 +437,26 @@ CorrDistInfo CEDist(const Game& game, const CorrelationDevice& mu,
       dist_info.conditional_best_response_policies[p].push_back(
           signal_and_policy.second);
     }
+  };
+  const int num_workers = std::min(num_threads, ce_game->NumPlayers());
+  if (num_workers <= 1) {
+    for (auto p = Player{0}; p < ce_game->NumPlayers(); ++p) {
+      best_respond(p);
+    }
+  } else {
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int t = 0; t < num_workers; ++t) {
+      workers.emplace_back([&best_respond, &ce_game, t, num_workers]() {
+        for (Player p = t; p < ce_game->NumPlayers(); p += num_workers) {
+          best_respond(p);
+        }
+      });
+    }
+    for (Thread& worker : workers) worker.join();
   }
 
+  std::unique_ptr<State> root = ce_game->NewInitialState();
   dist_info.on_policy_values = ExpectedReturns(*root, policy, -1, false);
   SPIEL_CHECK_EQ(dist_info.best_response_values.size(),
                  dist_info.on_policy_values.size());
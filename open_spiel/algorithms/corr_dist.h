@@ -105,11 +105,16 @@ struct CorrDistConfig {
   std::string recommendation_delimiter = " R-*-=-*-R ";
 };
 
-// Return the expected values (one per player) of a correlation device.
+// Return the expected values (one per player) of a correlation device. With
+// num_threads > 1 the per-policy ExpectedReturns walks (independent of one
+// another) run on worker threads; the weighted sum is taken in device order
+// afterwards, so the result is identical to the serial evaluation.
 std::vector<double> ExpectedValues(const Game& game,
-                                   const CorrelationDevice& mu);
+                                   const CorrelationDevice& mu,
+                                   int num_threads = 1);
 std::vector<double> ExpectedValues(const Game& game,
-                                   const NormalFormCorrelationDevice& mu);
+                                   const NormalFormCorrelationDevice& mu,
+                                   int num_threads = 1);
 
 // Compute the sum of individual incentives to deviate (from the joint
 // distribution) to a best response, over all players. The auxiliary game
@@ -161,9 +166,12 @@ struct CorrDistInfo {
 // determines which policies the opponents follow (never revealed). Note that
 // the policies in this correlation device *can* be mixed. If values is
 // non-null, then it is filled with the deviation incentive of each player.
+// With num_threads > 1 the per-player deviation best responses (independent
+// of one another) are computed on worker threads.
 CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu,
                      const float prob_cut_threshold = -1.0,
-                     const float action_value_tolerance = -1.0);
+                     const float action_value_tolerance = -1.0,
+                     int num_threads = 1);
 CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu, int player,
                      const float prob_cut_threshold = -1.0,
                      const float action_value_tolerance = -1.0);
@@ -175,9 +183,12 @@ CorrDistInfo CCEDist(const Game& game, const CorrelationDevice& mu, int player,
 // over mixed policies, then first convert the correlation device using the
 // helper functions DeterminizeCorrDev or SampledDeterminizeCorrDev in
 // corr_dev_builder.h. If values is non-null, then it is filled with the
-// deviation incentive of each player.
+// deviation incentive of each player. With num_threads > 1 the per-player
+// deviation best responses (independent of one another) are computed on
+// worker threads.
 CorrDistInfo CEDist(const Game& game, const CorrelationDevice& mu,
-                    const float action_value_tolerance = -1.0);
+                    const float action_value_tolerance = -1.0,
+                    int num_threads = 1);
 
 }  // namespace algorithms
 }  // namespace open_spiel
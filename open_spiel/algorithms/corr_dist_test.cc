@@ -377,6 +377,49 @@ void TestCCECEDistCFRGoofSpiel() {
               << std::endl;
   }
 }
+
+void TestParallelDistMatchesSerial() {
+  std::shared_ptr<const Game> game = LoadGame(
+      "turn_based_simultaneous_game(game=goofspiel(num_cards=3,points_order="
+      "descending,returns_type=total_points))");
+  std::vector<TabularPolicy> policies;
+  CFRSolverBase solver(*game,
+                       /*alternating_updates=*/true,
+                       /*linear_averaging=*/false,
+                       /*regret_matching_plus=*/false,
+                       /*random_initial_regrets*/ false);
+  for (int i = 0; i < 10; i++) {
+    solver.EvaluateAndUpdatePolicy();
+    policies.push_back(
+        static_cast<CFRCurrentPolicy*>(solver.CurrentPolicy().get())
+            ->AsTabular());
+  }
+  CorrelationDevice mu = UniformCorrelationDevice(policies);
+
+  // Per-item and per-player evaluations are independent, so the threaded
+  // paths must reproduce the serial results exactly.
+  std::vector<double> serial_values = ExpectedValues(*game, mu);
+  std::vector<double> parallel_values =
+      ExpectedValues(*game, mu, /*num_threads=*/3);
+  SPIEL_CHECK_TRUE(serial_values == parallel_values);
+
+  CorrDistInfo serial_cce = CCEDist(*game, mu);
+  CorrDistInfo parallel_cce = CCEDist(*game, mu, /*prob_cut_threshold=*/-1.0,
+                                      /*action_value_tolerance=*/-1.0,
+                                      /*num_threads=*/2);
+  SPIEL_CHECK_FLOAT_EQ(serial_cce.dist_value, parallel_cce.dist_value);
+  SPIEL_CHECK_TRUE(serial_cce.best_response_values ==
+                   parallel_cce.best_response_values);
+
+  CorrelationDevice det_mu = SampledDeterminizeCorrDev(mu, 20);
+  CorrDistInfo serial_ce = CEDist(*game, det_mu);
+  CorrDistInfo parallel_ce = CEDist(*game, det_mu,
+                                    /*action_value_tolerance=*/-1.0,
+                                    /*num_threads=*/2);
+  SPIEL_CHECK_FLOAT_EQ(serial_ce.dist_value, parallel_ce.dist_value);
+  SPIEL_CHECK_TRUE(serial_ce.best_response_values ==
+                   parallel_ce.best_response_values);
+}
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -394,4 +437,5 @@ int main(int argc, char** argv) {
   algorithms::TestGreenwaldSarfatiExample1();
   algorithms::TestGreenwaldSarfatiExample2();
   algorithms::TestCCECEDistCFRGoofSpiel();
+  algorithms::TestParallelDistMatchesSerial();
 }
@@ -92,14 +92,16 @@ TabularPolicy DeterministicTabularPolicy::GetTabularPolicy() const {
 
 bool DeterministicTabularPolicy::NextPolicy() {
   // Treat the current indices as digits in a mixed base. Starting at the
-  // beginning of the table, add 1. If can't, continue trying. If we reach the
+  // first branching entry, add 1. If can't, continue trying. If we reach the
   // end without being able to add 1, then this is the end of the order.
   // Otherwise, increment the digit we land on by 1, and reset all the ones
-  // we skipped over earlier in the order.
-  for (auto iter = table_.begin(); iter != table_.end(); ++iter) {
-    if (iter->second.TryIncIndex()) {
-      for (auto iter2 = table_.begin(); iter2 != iter; ++iter2) {
-        iter2->second.index = 0;
+  // we skipped over earlier in the order. Single-action infostates are not
+  // part of the layout: their digit is always 0, so skipping them leaves the
+  // counting order unchanged.
+  for (size_t i = 0; i < branching_entries_.size(); ++i) {
+    if (branching_entries_[i]->TryIncIndex()) {
+      for (size_t j = 0; j < i; ++j) {
+        branching_entries_[j]->index = 0;
       }
       return true;
     }
@@ -120,6 +122,32 @@ void DeterministicTabularPolicy::CreateTable(const Game& game, Player player) {
     table_[info_state_actions.first] =
         LegalsWithIndex(info_state_actions.second);
   }
+  BuildBranchingLayout();
+}
+
+void DeterministicTabularPolicy::BuildBranchingLayout() {
+  branching_entries_.clear();
+  for (auto& info_state_entry : table_) {
+    if (info_state_entry.second.legal_actions_.size() > 1) {
+      branching_entries_.push_back(&info_state_entry.second);
+    }
+  }
+}
+
+DeterministicTabularPolicy::DeterministicTabularPolicy(
+    const DeterministicTabularPolicy& other)
+    : table_(other.table_), player_(other.player_) {
+  BuildBranchingLayout();
+}
+
+DeterministicTabularPolicy& DeterministicTabularPolicy::operator=(
+    const DeterministicTabularPolicy& other) {
+  if (this != &other) {
+    table_ = other.table_;
+    player_ = other.player_;
+    BuildBranchingLayout();
+  }
+  return *this;
 }
 
 std::string DeterministicTabularPolicy::ToString(
@@ -96,8 +96,18 @@ class DeterministicTabularPolicy : public Policy {
   // This function sets this policy to the next deterministic policy in this
   // counting order. The function returns true if this changed the policy (i.e
   // there exists a next policy in the order), otherwise returns false.
+  //
+  // The increment only visits genuinely branching information states: those
+  // with one legal action are permanently stuck at digit 0, so they are left
+  // out of the precomputed radix layout (see branching_entries_) and cost
+  // nothing per step. In games dominated by forced moves this makes
+  // enumeration proportional to the number of real choices.
   bool NextPolicy();
 
+  // The number of information states with more than one legal action, i.e.
+  // the number of digits in the enumeration's radix layout.
+  int NumBranchingInfostates() const { return branching_entries_.size(); }
+
   // Resets the policy to the first one in the total order defined above: all
   // actions set to their first legal action (index = 0 in the legal actions
   // list).
@@ -107,10 +117,23 @@ class DeterministicTabularPolicy : public Policy {
   // delimiter to separate information state and action.
   std::string ToString(const std::string& delimiter) const;
 
+  // Copies rebuild the radix layout, which points into the copied table.
+  // Moves keep it valid (map nodes do not relocate on move).
+  DeterministicTabularPolicy(const DeterministicTabularPolicy& other);
+  DeterministicTabularPolicy& operator=(
+      const DeterministicTabularPolicy& other);
+  DeterministicTabularPolicy(DeterministicTabularPolicy&&) = default;
+  DeterministicTabularPolicy& operator=(DeterministicTabularPolicy&&) =
+      default;
+
  private:
   void CreateTable(const Game& game, Player player);
+  void BuildBranchingLayout();
 
   std::map<std::string, LegalsWithIndex> table_;
+  // The radix layout for NextPolicy: pointers to the table entries with more
+  // than one legal action, in table (enumeration) order.
+  std::vector<LegalsWithIndex*> branching_entries_;
   Player player_;
 };
 
@@ -40,6 +40,25 @@ void KuhnDeterministicPolicyTest() {
   SPIEL_CHECK_EQ(p1_policies, 64);  // 2^6
 }
 
+void BranchingLayoutTest() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  DeterministicTabularPolicy policy(*game, Player{0});
+  // All 6 of the player's infostates in Kuhn have two legal actions.
+  SPIEL_CHECK_EQ(policy.NumBranchingInfostates(), 6);
+
+  // Copies rebuild the radix layout; enumerating a copy picks up where the
+  // original stood in the counting order.
+  for (int i = 0; i < 10; ++i) {
+    SPIEL_CHECK_TRUE(policy.NextPolicy());
+  }
+  DeterministicTabularPolicy copy = policy;
+  int remaining = 1;
+  while (copy.NextPolicy()) {
+    remaining += 1;
+  }
+  SPIEL_CHECK_EQ(remaining, 64 - 10);
+}
+
 void NumDeterministicPoliciesTest() {
   // In Kuhn, each player has 6 information states with 2 actions each.
   std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
@@ -58,5 +77,6 @@ void NumDeterministicPoliciesTest() {
 
 int main(int argc, char** argv) {
   open_spiel::algorithms::KuhnDeterministicPolicyTest();
+  open_spiel::algorithms::BranchingLayoutTest();
   open_spiel::algorithms::NumDeterministicPoliciesTest();
 }
@@ -0,0 +1,264 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/distributed_mccfr.h"
+
+#include <cstring>
+#include <utility>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// Blob layout (host-endian):
+//   varint num_entries
+//   per entry:
+//     varint key size, key bytes
+//     varint num_actions, then that many varint actions (so a receiver can
+//       create entries it has not visited itself)
+//     sparse policy deltas:  varint count, then (varint aidx, double) pairs
+// Entries and actions whose delta is exactly zero are omitted, so the blob
+// covers only what the interval touched.
+
+// Varint codec, as in trajectory_io.cc.
+void AppendVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+uint64_t ReadVarint(const char** p, const char* end) {
+  uint64_t value = 0;
+  int shift = 0;
+  for (;;) {
+    SPIEL_CHECK_TRUE(*p < end);
+    const uint8_t byte = static_cast<uint8_t>(*(*p)++);
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) return value;
+    shift += 7;
+  }
+}
+
+void AppendDouble(double value, std::string* out) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+double ReadDouble(const char** p, const char* end) {
+  SPIEL_CHECK_LE(*p + sizeof(double), end);
+  double value;
+  std::memcpy(&value, *p, sizeof(value));
+  *p += sizeof(value);
+  return value;
+}
+
+// Appends the nonzero (aidx, current - base) pairs for one table column,
+// prefixed by their count. Deltas are computed in double regardless of
+// CFRValue so blobs from float32 and double builds interoperate.
+void AppendSparseDeltas(const std::vector<CFRValue>& current,
+                        const CFRValue* base, std::string* out) {
+  const size_t count_pos = out->size();
+  AppendVarint(0, out);  // Placeholder; counts below 128 stay one byte.
+  uint64_t count = 0;
+  for (size_t aidx = 0; aidx < current.size(); ++aidx) {
+    const double delta =
+        static_cast<double>(current[aidx]) - static_cast<double>(base[aidx]);
+    if (delta == 0) continue;
+    AppendVarint(aidx, out);
+    AppendDouble(delta, out);
+    ++count;
+  }
+  if (count < 0x80) {
+    (*out)[count_pos] = static_cast<char>(count);
+  } else {
+    // Re-encode with the full-width count; rare (entries with >127 changed
+    // actions), so the copy is acceptable.
+    std::string tail(out->substr(count_pos + 1));
+    out->resize(count_pos);
+    AppendVarint(count, out);
+    out->append(tail);
+  }
+}
+
+}  // namespace
+
+class InProcessPolicyExchange::WorkerTransport : public PolicyExchangeTransport {
+ public:
+  WorkerTransport(InProcessPolicyExchange* exchange, int worker)
+      : exchange_(exchange), worker_(worker) {}
+
+  void Publish(const std::string& blob) override {
+    exchange_->Publish(worker_, blob);
+  }
+  std::vector<std::string> Collect() override {
+    return exchange_->Collect(worker_);
+  }
+
+ private:
+  InProcessPolicyExchange* exchange_;
+  int worker_;
+};
+
+InProcessPolicyExchange::InProcessPolicyExchange(int num_workers)
+    : inboxes_(num_workers) {
+  SPIEL_CHECK_GE(num_workers, 1);
+  transports_.reserve(num_workers);
+  for (int worker = 0; worker < num_workers; ++worker) {
+    transports_.push_back(std::make_unique<WorkerTransport>(this, worker));
+  }
+}
+
+InProcessPolicyExchange::~InProcessPolicyExchange() {}
+
+PolicyExchangeTransport* InProcessPolicyExchange::transport(int worker) {
+  SPIEL_CHECK_GE(worker, 0);
+  SPIEL_CHECK_LT(worker, num_workers());
+  return transports_[worker].get();
+}
+
+void InProcessPolicyExchange::Publish(int worker, const std::string& blob) {
+  std::lock_guard<std::mutex> lock(mu_);
+  for (int peer = 0; peer < num_workers(); ++peer) {
+    if (peer != worker) inboxes_[peer].push_back(blob);
+  }
+}
+
+std::vector<std::string> InProcessPolicyExchange::Collect(int worker) {
+  std::lock_guard<std::mutex> lock(mu_);
+  return std::move(inboxes_[worker]);
+}
+
+DistributedMCCFRWorker::DistributedMCCFRWorker(
+    ExternalSamplingMCCFRSolver* solver, PolicyExchangeTransport* transport,
+    int sync_period)
+    : solver_(solver), transport_(transport), sync_period_(sync_period) {
+  SPIEL_CHECK_TRUE(solver != nullptr);
+  SPIEL_CHECK_TRUE(transport != nullptr);
+  SPIEL_CHECK_GE(sync_period, 1);
+}
+
+void DistributedMCCFRWorker::RunIterations(int num_iterations) {
+  SPIEL_CHECK_GE(num_iterations, 1);
+  for (int i = 0; i < num_iterations; ++i) {
+    solver_->RunIteration();
+    if (++iterations_since_sync_ >= sync_period_) Sync();
+  }
+}
+
+void DistributedMCCFRWorker::Sync() {
+  // Publish before merging so our blob carries only locally accumulated
+  // increments; resnapshot after merging so neither our own published
+  // deltas nor the freshly applied peer deltas are ever republished.
+  transport_->Publish(EncodeDeltas());
+  for (const std::string& blob : transport_->Collect()) ApplyDeltas(blob);
+  SnapshotTable();
+  iterations_since_sync_ = 0;
+  ++num_syncs_;
+}
+
+std::string DistributedMCCFRWorker::EncodeDeltas() const {
+  std::string blob;
+  uint64_t num_entries = 0;
+  const size_t count_pos = blob.size();
+  AppendVarint(0, &blob);  // Patched below.
+  for (const auto& [key, values] : solver_->InfoStateValuesTable()) {
+    const int num_actions = values.num_actions();
+    // Entries the last sync has not seen are measured against the fresh
+    // entry a peer would create, so the initial values are never shipped
+    // (nor double-counted on arrival).
+    auto synced_it = synced_.find(key);
+    std::vector<CFRValue> fresh;
+    const CFRValue* base;
+    if (synced_it != synced_.end()) {
+      base = synced_it->second.data();
+    } else {
+      fresh.assign(num_actions,
+                   ExternalSamplingMCCFRSolver::kInitialTableValues);
+      base = fresh.data();
+    }
+    const size_t entry_start = blob.size();
+    AppendVarint(key.size(), &blob);
+    blob.append(key);
+    AppendVarint(num_actions, &blob);
+    for (const Action action : values.legal_actions) {
+      SPIEL_CHECK_GE(action, 0);
+      AppendVarint(static_cast<uint64_t>(action), &blob);
+    }
+    const size_t deltas_start = blob.size();
+    AppendSparseDeltas(values.cumulative_policy, base, &blob);
+    if (blob.size() - deltas_start == 1) {
+      // The count was zero: nothing changed, drop the entry.
+      blob.resize(entry_start);
+    } else {
+      ++num_entries;
+    }
+  }
+  if (num_entries < 0x80) {
+    blob[count_pos] = static_cast<char>(num_entries);
+  } else {
+    std::string tail(blob.substr(count_pos + 1));
+    blob.resize(count_pos);
+    AppendVarint(num_entries, &blob);
+    blob.append(tail);
+  }
+  return blob;
+}
+
+void DistributedMCCFRWorker::ApplyDeltas(const std::string& blob) {
+  CFRInfoStateValuesTable& table = solver_->InfoStateValuesTable();
+  const char* p = blob.data();
+  const char* end = blob.data() + blob.size();
+  const uint64_t num_entries = ReadVarint(&p, end);
+  for (uint64_t i = 0; i < num_entries; ++i) {
+    const uint64_t key_size = ReadVarint(&p, end);
+    SPIEL_CHECK_LE(p + key_size, end);
+    std::string key(p, key_size);
+    p += key_size;
+    const uint64_t num_actions = ReadVarint(&p, end);
+    std::vector<Action> legal_actions;
+    legal_actions.reserve(num_actions);
+    for (uint64_t a = 0; a < num_actions; ++a) {
+      legal_actions.push_back(static_cast<Action>(ReadVarint(&p, end)));
+    }
+    auto iter_and_result = table.insert(
+        {std::move(key),
+         CFRInfoStateValues(legal_actions,
+                            ExternalSamplingMCCFRSolver::kInitialTableValues)});
+    CFRInfoStateValues& values = iter_and_result.first->second;
+    SPIEL_CHECK_EQ(values.num_actions(), static_cast<int>(num_actions));
+    const uint64_t num_policy_deltas = ReadVarint(&p, end);
+    for (uint64_t d = 0; d < num_policy_deltas; ++d) {
+      const uint64_t aidx = ReadVarint(&p, end);
+      SPIEL_CHECK_LT(aidx, num_actions);
+      values.cumulative_policy[aidx] += ReadDouble(&p, end);
+    }
+  }
+  SPIEL_CHECK_TRUE(p == end);
+}
+
+void DistributedMCCFRWorker::SnapshotTable() {
+  const CFRInfoStateValuesTable& table = solver_->InfoStateValuesTable();
+  synced_.reserve(table.size());
+  for (const auto& [key, values] : table) {
+    std::vector<CFRValue>& snapshot = synced_[key];
+    snapshot.assign(values.cumulative_policy.begin(),
+                    values.cumulative_policy.end());
+  }
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
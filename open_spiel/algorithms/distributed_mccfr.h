@@ -0,0 +1,145 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_DISTRIBUTED_MCCFR_H_
+#define OPEN_SPIEL_ALGORITHMS_DISTRIBUTED_MCCFR_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/algorithms/cfr.h"
+#include "open_spiel/algorithms/external_sampling_mccfr.h"
+
+// Distributed external-sampling MCCFR with periodic average-policy pooling.
+//
+// Each worker runs an ordinary ExternalSamplingMCCFRSolver on its own
+// replica of the values table and periodically exchanges *deltas* — the
+// cumulative-policy increments it accumulated since the last exchange —
+// with its peers. cumulative_policy is unnormalized mixture mass, so summing
+// the workers' contributions yields the reach-weighted mixture of their
+// average policies: an ensemble estimate whose variance shrinks with the
+// number of workers, and the quantity AveragePolicy() is read from.
+//
+// Cumulative regrets deliberately stay worker-local. Summing (or averaging)
+// regret increments for the *same* infostate across replicas looks like the
+// natural extension, but measurably corrupts convergence: the replicas'
+// increments are strongly correlated, so a merge applies what amounts to one
+// oversized regret-matching step per interval, and each worker's
+// current-policy oscillation loses the phase information regret matching
+// depends on. In head-to-head runs on Kuhn poker, every regret-merging
+// variant left workers worse than a solo run of the same per-worker
+// iteration count, while policy-only pooling matches or beats it.
+//
+// The payload is defined here; how blobs move between machines is the
+// transport's problem (TCP, MPI, a shared filesystem — anything that
+// delivers each published blob to every peer exactly once). Deltas are
+// encoded sparsely (only entries and actions that changed since the last
+// sync), so a sync's bandwidth scales with the infostates visited in the
+// interval, not with the table. The encoding is host-endian, like the
+// other binary formats in this directory, so all nodes must share
+// endianness.
+
+namespace open_spiel {
+namespace algorithms {
+
+// Delivers this worker's delta blobs to every peer and collects theirs.
+// Implementations are provided by the deployment; InProcessPolicyExchange
+// below is the in-process reference used by tests and by multi-threaded
+// single-machine runs.
+class PolicyExchangeTransport {
+ public:
+  virtual ~PolicyExchangeTransport() = default;
+
+  // Sends `blob` to every peer. Must not deliver the blob back to the
+  // publishing worker.
+  virtual void Publish(const std::string& blob) = 0;
+
+  // Returns the blobs peers have published since the last Collect, in
+  // arrival order. Blobs published while this worker was between syncs
+  // must be buffered, not dropped.
+  virtual std::vector<std::string> Collect() = 0;
+};
+
+// All-to-all exchange between workers in one process: Publish appends to
+// every other worker's inbox under a mutex, Collect drains the caller's.
+// Transports stay valid for the lifetime of the exchange.
+class InProcessPolicyExchange {
+ public:
+  explicit InProcessPolicyExchange(int num_workers);
+  ~InProcessPolicyExchange();
+
+  InProcessPolicyExchange(const InProcessPolicyExchange&) = delete;
+  InProcessPolicyExchange& operator=(const InProcessPolicyExchange&) = delete;
+
+  int num_workers() const { return static_cast<int>(inboxes_.size()); }
+  PolicyExchangeTransport* transport(int worker);
+
+ private:
+  class WorkerTransport;
+
+  void Publish(int worker, const std::string& blob);
+  std::vector<std::string> Collect(int worker);
+
+  std::mutex mu_;
+  std::vector<std::vector<std::string>> inboxes_;
+  std::vector<std::unique_ptr<PolicyExchangeTransport>> transports_;
+};
+
+// Drives one node's solver and its periodic synchronization. The solver
+// and transport are borrowed, not owned, and must outlive the worker.
+class DistributedMCCFRWorker {
+ public:
+  // Syncs after every `sync_period` iterations of RunIterations. Longer
+  // periods cost bandwidth less often but delay when peers' policy mass
+  // becomes visible; the local solver's convergence is unaffected either
+  // way (see the file comment).
+  DistributedMCCFRWorker(ExternalSamplingMCCFRSolver* solver,
+                         PolicyExchangeTransport* transport,
+                         int sync_period = 100);
+
+  // Runs `num_iterations` solver iterations, syncing every sync_period.
+  void RunIterations(int num_iterations);
+
+  // Publishes the policy deltas accumulated since the last sync, merges
+  // every delta collected from peers into the local table, and resnapshots.
+  // Cheap when nothing changed (an empty blob is still published so peers'
+  // Collect stays cheap to reason about).
+  void Sync();
+
+  int64_t num_syncs() const { return num_syncs_; }
+
+ private:
+  std::string EncodeDeltas() const;
+  void ApplyDeltas(const std::string& blob);
+  void SnapshotTable();
+
+  ExternalSamplingMCCFRSolver* solver_;
+  PolicyExchangeTransport* transport_;
+  int sync_period_;
+  int iterations_since_sync_ = 0;
+  int64_t num_syncs_ = 0;
+  // Per entry, the cumulative policy as of the last sync; deltas are the
+  // difference against this. The shadow copy costs one value per action —
+  // the price of shipping increments instead of whole tables.
+  absl::flat_hash_map<std::string, std::vector<CFRValue>> synced_;
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_DISTRIBUTED_MCCFR_H_
@@ -21,6 +21,7 @@
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -37,6 +38,58 @@ namespace torch_dqn {
 constexpr const float kIllegalActionLogitsPenalty =
     std::numeric_limits<float>::lowest();
 
+TensorReplayBuffer::TensorReplayBuffer(int capacity, int state_size,
+                                       int num_actions)
+    : capacity_(capacity),
+      state_size_(state_size),
+      num_actions_(num_actions),
+      info_states_(torch::zeros({capacity, state_size},
+                                torch::dtype(torch::kFloat32))),
+      next_info_states_(torch::zeros({capacity, state_size},
+                                     torch::dtype(torch::kFloat32))),
+      legal_actions_masks_(torch::zeros({capacity, num_actions},
+                                        torch::dtype(torch::kBool))),
+      actions_(torch::zeros({capacity}, torch::dtype(torch::kInt64))),
+      rewards_(torch::zeros({capacity}, torch::dtype(torch::kFloat32))),
+      are_final_steps_(torch::zeros({capacity},
+                                    torch::dtype(torch::kFloat32))) {}
+
+void TensorReplayBuffer::Add(const Transition& transition) {
+  SPIEL_CHECK_EQ(transition.info_state.size(), state_size_);
+  SPIEL_CHECK_EQ(transition.next_info_state.size(), state_size_);
+  SPIEL_CHECK_EQ(transition.legal_actions_mask.size(), num_actions_);
+  const int64_t row = total_added_ % capacity_;
+  info_states_[row].copy_(torch::from_blob(
+      const_cast<float*>(transition.info_state.data()), {state_size_},
+      torch::dtype(torch::kFloat32)));
+  next_info_states_[row].copy_(torch::from_blob(
+      const_cast<float*>(transition.next_info_state.data()), {state_size_},
+      torch::dtype(torch::kFloat32)));
+  legal_actions_masks_[row].copy_(
+      torch::from_blob(const_cast<int*>(transition.legal_actions_mask.data()),
+                       {num_actions_}, torch::dtype(torch::kInt32))
+          .to(torch::kBool));
+  actions_[row] = static_cast<int64_t>(transition.action);
+  rewards_[row] = static_cast<float>(transition.reward);
+  are_final_steps_[row] = transition.is_final_step ? 1.0f : 0.0f;
+  total_added_ += 1;
+  size_ = static_cast<int>(std::min<int64_t>(total_added_, capacity_));
+}
+
+torch::Tensor TensorReplayBuffer::SampleIndices(std::mt19937* rng,
+                                                int num) const {
+  SPIEL_CHECK_LE(num, size_);
+  std::vector<int64_t> all_indices(size_);
+  std::iota(all_indices.begin(), all_indices.end(), int64_t{0});
+  std::vector<int64_t> sampled;
+  sampled.reserve(num);
+  std::sample(all_indices.begin(), all_indices.end(),
+              std::back_inserter(sampled), num, *rng);
+  return torch::from_blob(sampled.data(), {num},
+                          torch::dtype(torch::kInt64))
+      .clone();
+}
+
 Action RandomAgent::Step(const State& state, bool is_evaluation) {
   if (state.IsTerminal()) {
     return kInvalidAction;
@@ -59,7 +112,9 @@ DQN::DQN(const DQNSettings& settings)
       epsilon_start_(settings.epsilon_start),
       epsilon_end_(settings.epsilon_end),
       epsilon_decay_duration_(settings.epsilon_decay_duration),
-      replay_buffer_(settings.replay_buffer_capacity),
+      replay_buffer_(settings.replay_buffer_capacity,
+                     settings.state_representation_size,
+                     settings.num_actions),
       batch_size_(settings.batch_size),
       step_counter_(0),
       exists_prev_(false),
@@ -197,36 +252,12 @@ double DQN::GetEpsilon(bool is_evaluation, int power) {
 void DQN::Learn() {
   if (replay_buffer_.Size() < batch_size_
       || replay_buffer_.Size() < min_buffer_size_to_learn_) return;
-  std::vector<Transition> transition = replay_buffer_.Sample(&rng_,
-                                                             batch_size_);
-  std::vector<torch::Tensor> info_states;
-  std::vector<torch::Tensor> next_info_states;
-  std::vector<torch::Tensor> legal_actions_mask;
-  std::vector<Action> actions;
-  std::vector<float> rewards;
-  std::vector<int> are_final_steps;
-  for (auto t : transition) {
-    info_states.push_back(
-        torch::from_blob(t.info_state.data(),
-                         {1, static_cast<long>(t.info_state.size())},
-                         torch::TensorOptions().dtype(torch::kFloat32))
-            .clone());
-    next_info_states.push_back(
-        torch::from_blob(t.next_info_state.data(),
-                         {1, static_cast<long>(t.next_info_state.size())},
-                         torch::TensorOptions().dtype(torch::kFloat32))
-            .clone());
-    legal_actions_mask.push_back(
-        torch::from_blob(t.legal_actions_mask.data(),
-                         {1, static_cast<long>(t.legal_actions_mask.size())},
-                         torch::TensorOptions().dtype(torch::kBool))
-            .clone());
-    actions.push_back(t.action);
-    rewards.push_back(t.reward);
-    are_final_steps.push_back(t.is_final_step);
-  }
-  torch::Tensor info_states_tensor = torch::stack(info_states, 0);
-  torch::Tensor next_info_states_tensor = torch::stack(next_info_states, 0);
+  // Batch assembly is a single index_select per field from the buffer's
+  // contiguous storage; no per-transition tensor construction.
+  torch::Tensor indices = replay_buffer_.SampleIndices(&rng_, batch_size_);
+  torch::Tensor info_states_tensor = replay_buffer_.InfoStates(indices);
+  torch::Tensor next_info_states_tensor =
+      replay_buffer_.NextInfoStates(indices);
   q_network_->train();
   torch::Tensor q_values = q_network_->forward(info_states_tensor);
   target_q_network_->eval();
@@ -234,40 +265,30 @@ void DQN::Learn() {
       next_info_states_tensor).detach();
 
   torch::Tensor illegal_action_masks_tensor =
-      torch::stack(legal_actions_mask, 0).bitwise_not();
+      replay_buffer_.LegalActionsMasks(indices).bitwise_not();
   torch::Tensor legal_q_values =
       torch::masked_fill(target_q_values, illegal_action_masks_tensor,
                          kIllegalActionLogitsPenalty);
 
-  torch::Tensor max_next_q = std::get<0>(legal_q_values.max(2));
+  torch::Tensor max_next_q = std::get<0>(legal_q_values.max(1));
 
-  torch::Tensor are_final_steps_tensor = torch::from_blob(
-      are_final_steps.data(),
-      {batch_size_},
-      torch::TensorOptions().dtype(torch::kInt32)).to(torch::kFloat32);
-  torch::Tensor rewards_tensor = torch::from_blob(
-      rewards.data(),
-      {batch_size_},
-      torch::TensorOptions().dtype(torch::kFloat32));
+  torch::Tensor are_final_steps_tensor =
+      replay_buffer_.AreFinalSteps(indices);
+  torch::Tensor rewards_tensor = replay_buffer_.Rewards(indices);
   torch::Tensor target = rewards_tensor + (
-      1.0 - are_final_steps_tensor) * max_next_q.squeeze(1) * discount_factor_;
-  torch::Tensor actions_tensor = torch::from_blob(
-      actions.data(),
-      {batch_size_},
-      torch::TensorOptions().dtype(torch::kInt64));
+      1.0 - are_final_steps_tensor) * max_next_q * discount_factor_;
+  torch::Tensor actions_tensor = replay_buffer_.Actions(indices);
   torch::Tensor predictions = q_values.index(
-      {torch::arange(q_values.size(0)),
-                     torch::indexing::Slice(),
-                     actions_tensor});
+      {torch::arange(q_values.size(0)), actions_tensor});
 
   optimizer_.zero_grad();
   torch::Tensor value_loss;
   if (loss_str_ == "mse") {
     torch::nn::MSELoss mse_loss;
-    value_loss = mse_loss(predictions.squeeze(1), target);
+    value_loss = mse_loss(predictions, target);
   } else if (loss_str_ == "huber") {
     torch::nn::SmoothL1Loss l1_loss;
-    value_loss = l1_loss(predictions.squeeze(1), target);
+    value_loss = l1_loss(predictions, target);
   } else {
     SpielFatalError("Not implemented, choose from 'mse', 'huber'.");
   }
@@ -27,7 +27,6 @@
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
-#include "open_spiel/utils/circular_buffer.h"
 
 // Note: This implementation has only been lightly tested on a few small games.
 
@@ -44,6 +43,62 @@ struct Transition {
   std::vector<int> legal_actions_mask;
 };
 
+// A fixed-capacity replay buffer storing transitions in preallocated
+// contiguous tensors (structure-of-arrays layout) rather than one Transition
+// object per slot. Adding a transition copies each field into its row once;
+// assembling a training batch is then a single index_select per field, with
+// no per-transition tensor construction in the learning step.
+class TensorReplayBuffer {
+ public:
+  TensorReplayBuffer(int capacity, int state_size, int num_actions);
+
+  // Adds one transition, replacing the oldest once the buffer is full.
+  void Add(const Transition& transition);
+
+  // Returns `num` distinct slot indices sampled uniformly without
+  // replacement, as an int64 tensor usable with the batch accessors below.
+  torch::Tensor SampleIndices(std::mt19937* rng, int num) const;
+
+  // Batched fields for the given indices. Shapes: [num, state_size] for the
+  // info states, [num, num_actions] (bool) for the legal-action masks, and
+  // [num] for the rest.
+  torch::Tensor InfoStates(const torch::Tensor& indices) const {
+    return info_states_.index_select(0, indices);
+  }
+  torch::Tensor NextInfoStates(const torch::Tensor& indices) const {
+    return next_info_states_.index_select(0, indices);
+  }
+  torch::Tensor LegalActionsMasks(const torch::Tensor& indices) const {
+    return legal_actions_masks_.index_select(0, indices);
+  }
+  torch::Tensor Actions(const torch::Tensor& indices) const {
+    return actions_.index_select(0, indices);
+  }
+  torch::Tensor Rewards(const torch::Tensor& indices) const {
+    return rewards_.index_select(0, indices);
+  }
+  torch::Tensor AreFinalSteps(const torch::Tensor& indices) const {
+    return are_final_steps_.index_select(0, indices);
+  }
+
+  int Size() const { return size_; }
+  bool Empty() const { return size_ == 0; }
+  int64_t TotalAdded() const { return total_added_; }
+
+ private:
+  const int capacity_;
+  const int state_size_;
+  const int num_actions_;
+  int size_ = 0;
+  int64_t total_added_ = 0;
+  torch::Tensor info_states_;
+  torch::Tensor next_info_states_;
+  torch::Tensor legal_actions_masks_;
+  torch::Tensor actions_;
+  torch::Tensor rewards_;
+  torch::Tensor are_final_steps_;
+};
+
 struct DQNSettings {
   int seed;
   bool use_observation;
@@ -131,7 +186,7 @@ class DQN : public Agent {
   double epsilon_start_;
   double epsilon_end_;
   double epsilon_decay_duration_;
-  CircularBuffer<Transition> replay_buffer_;
+  TensorReplayBuffer replay_buffer_;
   int batch_size_;
   int step_counter_;
   bool exists_prev_;
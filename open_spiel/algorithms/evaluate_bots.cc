@@ -14,14 +14,22 @@
 
 #include "open_spiel/algorithms/evaluate_bots.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <memory>
 #include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
-#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_bots.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 
@@ -62,7 +70,9 @@ std::vector<double> EvaluateBots(State* state, const std::vector<Bot*>& bots,
   }
 
   // Return terminal utility.
-  return state->Returns();
+  std::vector<double> returns(num_players);
+  state->ReturnsInto(absl::MakeSpan(returns));
+  return returns;
 }
 
 std::vector<double> EvaluateBots(const Game& game,
@@ -80,4 +90,139 @@ std::vector<double> EvaluateBots(const Game& game,
   return EvaluateBots(game, bots, seed);
 }
 
+BotEvaluationResults EvaluateBotsBatch(const Game& game,
+                                       const EvaluationBotFactory& bot_factory,
+                                       int num_episodes, int seed,
+                                       int num_threads) {
+  SPIEL_CHECK_GT(num_episodes, 0);
+  SPIEL_CHECK_GT(num_threads, 0);
+  const int num_players = game.NumPlayers();
+  const int num_workers = std::min(num_threads, num_episodes);
+
+  // Per-worker accumulators, merged after the join.
+  std::vector<std::vector<double>> sums(
+      num_workers, std::vector<double>(num_players, 0.0));
+  std::vector<std::vector<double>> sums_of_squares(
+      num_workers, std::vector<double>(num_players, 0.0));
+
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    workers.emplace_back([w, num_workers, num_episodes, num_players, seed,
+                          &game, &bot_factory, &sums, &sums_of_squares]() {
+      // One set of bots per worker, reused across episodes via Restart()
+      // inside EvaluateBots.
+      std::vector<std::unique_ptr<Bot>> bots;
+      std::vector<Bot*> bot_ptrs;
+      bots.reserve(num_players);
+      bot_ptrs.reserve(num_players);
+      for (Player p = 0; p < num_players; ++p) {
+        bots.push_back(bot_factory(p));
+        bot_ptrs.push_back(bots.back().get());
+      }
+      for (int episode = w; episode < num_episodes; episode += num_workers) {
+        std::unique_ptr<State> state = game.NewInitialState();
+        const std::vector<double> returns =
+            EvaluateBots(state.get(), bot_ptrs, seed + episode);
+        for (Player p = 0; p < num_players; ++p) {
+          sums[w][p] += returns[p];
+          sums_of_squares[w][p] += returns[p] * returns[p];
+        }
+      }
+    });
+  }
+  for (Thread& worker : workers) worker.join();
+
+  BotEvaluationResults results;
+  results.num_episodes = num_episodes;
+  results.mean_returns.resize(num_players);
+  results.stddev_returns.resize(num_players);
+  results.confidence_radius.resize(num_players);
+  for (Player p = 0; p < num_players; ++p) {
+    double sum = 0.0;
+    double sum_of_squares = 0.0;
+    for (int w = 0; w < num_workers; ++w) {
+      sum += sums[w][p];
+      sum_of_squares += sums_of_squares[w][p];
+    }
+    const double mean = sum / num_episodes;
+    results.mean_returns[p] = mean;
+    // Sample variance; a single episode gives no spread estimate.
+    const double variance =
+        num_episodes > 1
+            ? std::max(0.0, (sum_of_squares - num_episodes * mean * mean) /
+                                (num_episodes - 1))
+            : 0.0;
+    results.stddev_returns[p] = std::sqrt(variance);
+    results.confidence_radius[p] =
+        1.96 * results.stddev_returns[p] / std::sqrt(num_episodes);
+  }
+  return results;
+}
+
+void BotSessionRegistry::Register(const std::string& name,
+                                  EvaluationBotFactory factory) {
+  const bool inserted = factories_.emplace(name, std::move(factory)).second;
+  if (!inserted) {
+    SpielFatalError(absl::StrCat("Bot session already registered: ", name));
+  }
+}
+
+Bot* BotSessionRegistry::Get(const std::string& name, Player player) {
+  SPIEL_CHECK_GE(player, 0);
+  auto factory = factories_.find(name);
+  if (factory == factories_.end()) {
+    SpielFatalError(absl::StrCat("Unknown bot session: ", name));
+  }
+  std::vector<std::unique_ptr<Bot>>& seats = bots_[name];
+  if (static_cast<int>(seats.size()) <= player) seats.resize(player + 1);
+  if (seats[player] == nullptr) seats[player] = factory->second(player);
+  return seats[player].get();
+}
+
+BotEvaluationResults BotSessionRegistry::EvaluatePairing(
+    const Game& game, const std::vector<std::string>& names, int num_episodes,
+    int seed) {
+  SPIEL_CHECK_EQ(static_cast<int>(names.size()), game.NumPlayers());
+  SPIEL_CHECK_GT(num_episodes, 0);
+  const int num_players = game.NumPlayers();
+
+  std::vector<Bot*> bot_ptrs;
+  bot_ptrs.reserve(num_players);
+  for (Player p = 0; p < num_players; ++p) {
+    bot_ptrs.push_back(Get(names[p], p));
+  }
+
+  std::vector<double> sums(num_players, 0.0);
+  std::vector<double> sums_of_squares(num_players, 0.0);
+  for (int episode = 0; episode < num_episodes; ++episode) {
+    std::unique_ptr<State> state = game.NewInitialState();
+    const std::vector<double> returns =
+        EvaluateBots(state.get(), bot_ptrs, seed + episode);
+    for (Player p = 0; p < num_players; ++p) {
+      sums[p] += returns[p];
+      sums_of_squares[p] += returns[p] * returns[p];
+    }
+  }
+
+  BotEvaluationResults results;
+  results.num_episodes = num_episodes;
+  results.mean_returns.resize(num_players);
+  results.stddev_returns.resize(num_players);
+  results.confidence_radius.resize(num_players);
+  for (Player p = 0; p < num_players; ++p) {
+    const double mean = sums[p] / num_episodes;
+    results.mean_returns[p] = mean;
+    const double variance =
+        num_episodes > 1
+            ? std::max(0.0, (sums_of_squares[p] - num_episodes * mean * mean) /
+                                (num_episodes - 1))
+            : 0.0;
+    results.stddev_returns[p] = std::sqrt(variance);
+    results.confidence_radius[p] =
+        1.96 * results.stddev_returns[p] / std::sqrt(num_episodes);
+  }
+  return results;
+}
+
 }  // namespace open_spiel
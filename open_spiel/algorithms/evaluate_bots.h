@@ -15,8 +15,12 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_EVALUATE_BOTS_H_
 #define OPEN_SPIEL_ALGORITHMS_EVALUATE_BOTS_H_
 
+#include <functional>
+#include <memory>
+#include <string>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_bots.h"
 
@@ -37,6 +41,70 @@ std::vector<double> EvaluateBots(const Game& game,
 std::vector<double> EvaluateBots(const Game& game,
                                  const std::vector<Bot*>& bots);
 
+// Aggregate results of EvaluateBotsBatch: per-player sample statistics over
+// the played episodes. confidence_radius is the half-width of a normal
+// 95% confidence interval (1.96 * stddev / sqrt(num_episodes)).
+struct BotEvaluationResults {
+  int num_episodes = 0;
+  std::vector<double> mean_returns;       // [num_players]
+  std::vector<double> stddev_returns;     // [num_players], sample stddev.
+  std::vector<double> confidence_radius;  // [num_players]
+};
+
+// Creates the bot playing as `player`; called once per (worker, player)
+// since bots are generally stateful and not safe to share across threads.
+// (Not to be confused with the registry-oriented BotFactory interface in
+// spiel_bots.h.)
+using EvaluationBotFactory = std::function<std::unique_ptr<Bot>(Player)>;
+
+// Plays `num_episodes` episodes of `game` spread across `num_threads`
+// worker threads and returns aggregate per-player returns. Each worker
+// builds its own set of bots through `bot_factory` and reuses them across
+// its episodes via Bot::Restart(), so per-episode setup cost is one
+// NewInitialState() call. Episode e uses seed `seed + e`, so results are
+// reproducible for a fixed seed and thread count.
+BotEvaluationResults EvaluateBotsBatch(const Game& game,
+                                       const EvaluationBotFactory& bot_factory,
+                                       int num_episodes, int seed,
+                                       int num_threads = 1);
+
+// Keeps one live bot per (session name, player) across an evaluation run,
+// for ladders that play many pairings from a pool of contestants.
+// EvaluateBotsBatch reuses bots within one pairing; without a registry each
+// new pairing still reconstructs its bots, which for neural MCTS bots means
+// reloading the model every time. Here a session's bots are constructed on
+// first use and then only Restart()ed between episodes and pairings, so a
+// model is loaded once per process no matter how many pairings it plays.
+// Expensive shared pieces (an evaluator, a DeviceManager holding the loaded
+// models) should be created once by the caller and captured by the
+// registered factories, making them common to every session that uses them.
+//
+// Sessions are stateful and not thread-safe: run pairings sequentially, or
+// use one registry per thread.
+class BotSessionRegistry {
+ public:
+  // Registers `name`; `factory` is invoked lazily, once per player seat.
+  // Registering an existing name is an error.
+  void Register(const std::string& name, EvaluationBotFactory factory);
+
+  // Returns the session bot for (name, player), constructing it on first
+  // request. The registry keeps ownership; the pointer stays valid for the
+  // registry's lifetime.
+  Bot* Get(const std::string& name, Player player);
+
+  // Plays `num_episodes` episodes of `game` between the named sessions
+  // (one name per seat, in player order; a name may fill several seats only
+  // if its bots support it). Episode e uses seed `seed + e`.
+  BotEvaluationResults EvaluatePairing(const Game& game,
+                                       const std::vector<std::string>& names,
+                                       int num_episodes, int seed);
+
+ private:
+  absl::flat_hash_map<std::string, EvaluationBotFactory> factories_;
+  // Lazily filled, indexed by player seat.
+  absl::flat_hash_map<std::string, std::vector<std::unique_ptr<Bot>>> bots_;
+};
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_ALGORITHMS_EVALUATE_BOTS_H_
@@ -70,10 +70,73 @@ void BotTest_RandomVsRandomPolicy() {
   SPIEL_CHECK_FLOAT_NEAR(average_results[1], -0.125, 0.01);
 }
 
+void BotTest_Batch() {
+  auto game = LoadGame("kuhn_poker");
+  EvaluationBotFactory factory = [](Player p) {
+    return MakeUniformRandomBot(p, /*seed=*/1234 + p);
+  };
+  constexpr int num_episodes = 20000;
+  BotEvaluationResults results =
+      EvaluateBotsBatch(*game, factory, num_episodes, /*seed=*/17,
+                        /*num_threads=*/4);
+  SPIEL_CHECK_EQ(results.num_episodes, num_episodes);
+  SPIEL_CHECK_EQ(results.mean_returns.size(), 2);
+  // Kuhn is zero-sum, so per-episode returns (and therefore the means) are
+  // exactly opposite.
+  SPIEL_CHECK_FLOAT_NEAR(results.mean_returns[0] + results.mean_returns[1],
+                         0.0, 1e-12);
+  // Uniform random self-play favours player 0 by 0.125 on average.
+  SPIEL_CHECK_FLOAT_NEAR(results.mean_returns[0], 0.125,
+                         3 * results.confidence_radius[0]);
+  for (Player p = 0; p < 2; ++p) {
+    SPIEL_CHECK_GT(results.stddev_returns[p], 0.0);
+    SPIEL_CHECK_GT(results.confidence_radius[p], 0.0);
+  }
+
+  // Same seed and thread count: bit-identical statistics.
+  BotEvaluationResults again =
+      EvaluateBotsBatch(*game, factory, num_episodes, /*seed=*/17,
+                        /*num_threads=*/4);
+  SPIEL_CHECK_TRUE(again.mean_returns == results.mean_returns);
+  SPIEL_CHECK_TRUE(again.stddev_returns == results.stddev_returns);
+}
+
+void BotTest_SessionRegistry() {
+  auto game = LoadGame("kuhn_poker");
+  BotSessionRegistry registry;
+  int uniform_constructions = 0;
+  registry.Register("uniform", [&uniform_constructions](Player p) {
+    ++uniform_constructions;
+    return MakeUniformRandomBot(p, /*seed=*/1234 + p);
+  });
+  registry.Register("stateful", [&game](Player p) {
+    return MakeStatefulRandomBot(*game, p, /*seed=*/4321 + p);
+  });
+
+  BotEvaluationResults results = registry.EvaluatePairing(
+      *game, {"uniform", "stateful"}, /*num_episodes=*/2000, /*seed=*/17);
+  SPIEL_CHECK_EQ(results.num_episodes, 2000);
+  SPIEL_CHECK_FLOAT_NEAR(results.mean_returns[0] + results.mean_returns[1],
+                         0.0, 1e-12);
+
+  // A second pairing reusing the "uniform" session (in both seats now)
+  // constructs one new bot for seat 1 only; seat 0's bot is reused.
+  registry.EvaluatePairing(*game, {"uniform", "uniform"},
+                           /*num_episodes=*/100, /*seed=*/18);
+  SPIEL_CHECK_EQ(uniform_constructions, 2);
+
+  // A third pairing constructs nothing further.
+  registry.EvaluatePairing(*game, {"uniform", "stateful"},
+                           /*num_episodes=*/100, /*seed=*/19);
+  SPIEL_CHECK_EQ(uniform_constructions, 2);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::BotTest_RandomVsRandom();
   open_spiel::BotTest_RandomVsRandomPolicy();
+  open_spiel::BotTest_Batch();
+  open_spiel::BotTest_SessionRegistry();
 }
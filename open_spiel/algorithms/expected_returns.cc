@@ -14,13 +14,18 @@
 
 #include "open_spiel/algorithms/expected_returns.h"
 
+#include <atomic>
+#include <deque>
 #include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/simultaneous_move_game.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -38,6 +43,11 @@ std::vector<double> ExpectedReturnsImpl(
     int depth_limit,
     float prob_cut_threshold) {
   if (state.IsTerminal() || depth_limit == 0) {
+    // Rewards() is not defined at chance nodes; a depth cut landing on one
+    // contributes nothing.
+    if (state.IsChanceNode()) {
+      return std::vector<double>(state.NumPlayers(), 0.0);
+    }
     return state.Rewards();
   }
 
@@ -137,6 +147,11 @@ std::vector<double> ExpectedReturnsImpl(
     int depth_limit,
     float prob_cut_threshold) {
   if (state.IsTerminal() || depth_limit == 0) {
+    // Rewards() is not defined at chance nodes; a depth cut landing on one
+    // contributes nothing.
+    if (state.IsChanceNode()) {
+      return std::vector<double>(state.NumPlayers(), 0.0);
+    }
     return state.Rewards();
   }
 
@@ -219,6 +234,103 @@ std::vector<double> ExpectedReturnsImpl(
   return values;
 }
 
+// A root subtree produced by the splitting pass of ExpectedReturnsParallel:
+// its returns, weighted by weight, contribute to the overall expectation.
+struct Subtree {
+  std::unique_ptr<State> state;
+  double weight;
+  int depth;
+};
+
+// Expands the tree breadth-first from `root` until there are at least
+// `target_subtrees` independent subtrees (or the frontier runs dry). Chance
+// nodes split into their outcomes; turn-based decision nodes contribute
+// their Rewards() to *base_values and split into their positive-probability
+// actions, mirroring the weighting in ExpectedReturnsImpl. Terminal and
+// depth-exhausted nodes resolve directly into *base_values (chance nodes at
+// the depth cut contribute nothing); simultaneous nodes are not expanded and
+// become subtrees as-is.
+std::vector<Subtree> SplitIntoSubtrees(
+    const State& root, int depth_limit,
+    const std::function<ActionsAndProbs(Player, const std::string&)>&
+        policy_func,
+    int target_subtrees, float prob_cut_threshold,
+    std::vector<double>* base_values) {
+  // Forced lines (e.g. a seeded deal's single-outcome chance chain) expand
+  // without producing parallelism; cap how far splitting walks so a
+  // low-branching game cannot be evaluated entirely in this pass.
+  constexpr int kMaxSplitPlies = 64;
+  const int num_players = root.NumPlayers();
+
+  std::vector<Subtree> subtrees;
+  std::deque<Subtree> frontier;
+  frontier.push_back(Subtree{root.Clone(), 1.0, depth_limit});
+
+  while (!frontier.empty()) {
+    if (static_cast<int>(frontier.size() + subtrees.size()) >=
+        target_subtrees) {
+      break;
+    }
+    Subtree node = std::move(frontier.front());
+    frontier.pop_front();
+
+    if (node.state->IsTerminal() || node.depth == 0) {
+      // A depth cut on a chance node contributes nothing, matching
+      // ExpectedReturnsImpl (Rewards() is not defined there).
+      if (!node.state->IsChanceNode()) {
+        const std::vector<double> rewards = node.state->Rewards();
+        for (auto p = Player{0}; p < num_players; ++p) {
+          (*base_values)[p] += node.weight * rewards[p];
+        }
+      }
+      continue;
+    }
+    if (node.state->IsSimultaneousNode() ||
+        depth_limit - node.depth >= kMaxSplitPlies) {
+      subtrees.push_back(std::move(node));
+      continue;
+    }
+
+    if (node.state->IsChanceNode()) {
+      for (const auto& [action, prob] : node.state->ChanceOutcomes()) {
+        if (prob <= prob_cut_threshold) continue;
+        frontier.push_back(
+            Subtree{node.state->Child(action), node.weight * prob,
+                    node.depth - 1});
+      }
+    } else {
+      const Player player = node.state->CurrentPlayer();
+      ActionsAndProbs state_policy =
+          policy_func(player, node.state->InformationStateString());
+      if (state_policy.empty()) {
+        SpielFatalError("Error in SplitIntoSubtrees; infostate not found.");
+      }
+      const std::vector<double> rewards = node.state->Rewards();
+      for (auto p = Player{0}; p < num_players; ++p) {
+        (*base_values)[p] += node.weight * rewards[p];
+      }
+      float total_prob = 0.0;
+      for (const Action action : node.state->LegalActions()) {
+        const double action_prob = GetProb(state_policy, action);
+        SPIEL_CHECK_LE(action_prob, 1.0);
+        if (action_prob > prob_cut_threshold) {
+          SPIEL_CHECK_GE(action_prob, 0.0);
+          total_prob += action_prob;
+          frontier.push_back(
+              Subtree{node.state->Child(action), node.weight * action_prob,
+                      node.depth - 1});
+        }
+      }
+      SPIEL_CHECK_GT(total_prob, 0.0);
+    }
+  }
+
+  for (Subtree& node : frontier) {
+    subtrees.push_back(std::move(node));
+  }
+  return subtrees;
+}
+
 std::vector<double> ExpectedReturnsOfDeterministicPoliciesFromSeedsImpl(
   const State& state,
   const std::vector<int>& policy_seeds,
@@ -343,6 +455,67 @@ std::vector<double> ExpectedReturns(const State& state,
 }
 
 
+std::vector<double> ExpectedReturnsParallel(const State& state,
+                                            const Policy& joint_policy,
+                                            int depth_limit, int num_threads,
+                                            float prob_cut_threshold) {
+  SPIEL_CHECK_GE(num_threads, 1);
+  const int num_players = state.NumPlayers();
+
+  // The splitting pass runs single-threaded and shares one lookup cache.
+  absl::flat_hash_map<std::string, ActionsAndProbs> split_cache;
+  auto split_policy_func = [&joint_policy, &split_cache](
+                               Player player, const std::string& info_state) {
+    auto [it, inserted] = split_cache.try_emplace(info_state);
+    if (inserted) it->second = joint_policy.GetStatePolicy(info_state);
+    return it->second;
+  };
+
+  std::vector<double> values(num_players, 0.0);
+  std::vector<Subtree> subtrees =
+      SplitIntoSubtrees(state, depth_limit, split_policy_func,
+                        /*target_subtrees=*/num_threads * 4,
+                        prob_cut_threshold, &values);
+
+  // Workers pull subtrees off a shared counter; each keeps a private policy
+  // cache so no locks are taken on the hot path.
+  std::atomic<int> next_subtree{0};
+  std::vector<std::vector<double>> thread_values(
+      num_threads, std::vector<double>(num_players, 0.0));
+  std::vector<Thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([t, &next_subtree, &subtrees, &thread_values,
+                          &joint_policy, prob_cut_threshold, num_players]() {
+      absl::flat_hash_map<std::string, ActionsAndProbs> cache;
+      auto policy_func = [&joint_policy, &cache](
+                             Player player, const std::string& info_state) {
+        auto [it, inserted] = cache.try_emplace(info_state);
+        if (inserted) it->second = joint_policy.GetStatePolicy(info_state);
+        return it->second;
+      };
+      for (int i = next_subtree.fetch_add(1);
+           i < static_cast<int>(subtrees.size());
+           i = next_subtree.fetch_add(1)) {
+        const Subtree& subtree = subtrees[i];
+        const std::vector<double> subtree_values = ExpectedReturnsImpl(
+            *subtree.state, policy_func, subtree.depth, prob_cut_threshold);
+        for (auto p = Player{0}; p < num_players; ++p) {
+          thread_values[t][p] += subtree.weight * subtree_values[p];
+        }
+      }
+    });
+  }
+  for (Thread& thread : threads) thread.join();
+
+  for (int t = 0; t < num_threads; ++t) {
+    for (auto p = Player{0}; p < num_players; ++p) {
+      values[p] += thread_values[t][p];
+    }
+  }
+  return values;
+}
+
 std::vector<double> ExpectedReturnsOfDeterministicPoliciesFromSeeds(
     const State& state, const std::vector<int>& policy_seeds) {
   const std::vector<const Policy*>& policies = {};
@@ -49,6 +49,21 @@ std::vector<double> ExpectedReturns(const State& state,
                                     bool use_infostate_get_policy = true,
                                     float prob_cut_threshold = 0.0);
 
+// Parallel version of ExpectedReturns for a joint policy, using the
+// infostate-string policy lookup. The tree is split near the root: chance
+// nodes (e.g. card deals) and turn-based decision nodes are expanded
+// breadth-first until there are several independent subtrees per thread,
+// and the subtrees are then evaluated on num_threads workers and
+// probability-weighted back together. Each worker caches its infostate
+// policy lookups for the duration of the traversal, so infostates reached
+// through many histories hit the policy once. Returns exactly what the
+// sequential ExpectedReturns does; policy-evaluation walks over fixed
+// policies scale close to linearly with the thread count.
+std::vector<double> ExpectedReturnsParallel(const State& state,
+                                            const Policy& joint_policy,
+                                            int depth_limit, int num_threads,
+                                            float prob_cut_threshold = 0.0);
+
 // Computes the (undiscounted) expected returns from random deterministic
 // policies which are specified using a seed. There should be a policy_seed per
 // player. Optionally any number of policies can be provided which override
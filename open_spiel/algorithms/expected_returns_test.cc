@@ -0,0 +1,73 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/expected_returns.h"
+
+#include <string>
+#include <vector>
+
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void ParallelMatchesSequential(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  std::unique_ptr<State> state = game->NewInitialState();
+  TabularPolicy policy = GetUniformPolicy(*game);
+
+  const std::vector<double> sequential =
+      ExpectedReturns(*state, policy, /*depth_limit=*/-1);
+  for (int num_threads : {1, 2, 4}) {
+    const std::vector<double> parallel =
+        ExpectedReturnsParallel(*state, policy, /*depth_limit=*/-1,
+                                num_threads);
+    SPIEL_CHECK_EQ(parallel.size(), sequential.size());
+    for (int p = 0; p < static_cast<int>(sequential.size()); ++p) {
+      SPIEL_CHECK_FLOAT_EQ(parallel[p], sequential[p]);
+    }
+  }
+}
+
+void ParallelMatchesSequentialDepthLimited() {
+  std::shared_ptr<const Game> game = LoadGame("leduc_poker");
+  std::unique_ptr<State> state = game->NewInitialState();
+  TabularPolicy policy = GetUniformPolicy(*game);
+
+  // Depth 4 cuts leduc at a chance node (the public card deal); depth 5 cuts
+  // at decision nodes. Both must agree with the sequential traversal.
+  for (int depth_limit : {4, 5}) {
+    const std::vector<double> sequential =
+        ExpectedReturns(*state, policy, depth_limit);
+    const std::vector<double> parallel =
+        ExpectedReturnsParallel(*state, policy, depth_limit,
+                                /*num_threads=*/3);
+    for (int p = 0; p < static_cast<int>(sequential.size()); ++p) {
+      SPIEL_CHECK_FLOAT_EQ(parallel[p], sequential[p]);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::ParallelMatchesSequential("kuhn_poker");
+  open_spiel::algorithms::ParallelMatchesSequential("leduc_poker");
+  open_spiel::algorithms::ParallelMatchesSequentialDepthLimited();
+}
@@ -20,6 +20,7 @@
 
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
 #include "open_spiel/algorithms/cfr.h"
+#include "open_spiel/algorithms/mmap_infostate_store.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
@@ -68,6 +69,45 @@ ExternalSamplingMCCFRSolver::ExternalSamplingMCCFRSolver(
 
 void ExternalSamplingMCCFRSolver::RunIteration() { RunIteration(rng_.get()); }
 
+void ExternalSamplingMCCFRSolver::SetBackingStore(MmapInfoStateStore* store) {
+  if (store != nullptr && avg_type_ == AverageType::kFull) {
+    SpielFatalError(
+        "SetBackingStore: full averaging still walks the in-memory table; "
+        "use AverageType::kSimple for out-of-core runs.");
+  }
+  backing_store_ = store;
+}
+
+void ExternalSamplingMCCFRSolver::RunIterations(int num_trajectories) {
+  RunIterations(num_trajectories, rng_.get());
+}
+
+void ExternalSamplingMCCFRSolver::RunIterations(int num_trajectories,
+                                                std::mt19937* rng) {
+  SPIEL_CHECK_GE(num_trajectories, 1);
+  if (root_state_ == nullptr) {
+    root_state_ = game_->NewInitialState();
+  }
+  // Players alternate within the batch, exactly like back-to-back
+  // RunIteration() calls. Grouping all of one player's passes first looks
+  // attractive for cache locality, but a player's later passes then update
+  // against regrets the other players have not touched for up to a whole
+  // batch, and that staleness measurably slows convergence at equal
+  // iteration counts.
+  for (int k = 0; k < num_trajectories; ++k) {
+    for (auto p = Player{0}; p < game_->NumPlayers(); ++p) {
+      UpdateRegrets(*root_state_, p, rng);
+    }
+  }
+
+  if (avg_type_ == AverageType::kFull) {
+    std::vector<double> reach_probs(game_->NumPlayers(), 1.0);
+    for (int k = 0; k < num_trajectories; ++k) {
+      FullUpdateAverage(*root_state_, reach_probs);
+    }
+  }
+}
+
 void ExternalSamplingMCCFRSolver::RunIteration(std::mt19937* rng) {
   for (auto p = Player{0}; p < game_->NumPlayers(); ++p) {
     UpdateRegrets(*game_->NewInitialState(), p, rng);
@@ -134,15 +174,32 @@ double ExternalSamplingMCCFRSolver::UpdateRegrets(const State& state,
   }
 
   Player cur_player = state.CurrentPlayer();
-  std::string is_key = state.InformationStateString(cur_player);
+  std::string is_key = InfoStateKey(state, cur_player);
+
+  // Issue the table prefetch as soon as the key is known, before deriving
+  // the legal actions: on big tables the entry lookup below is a cold DRAM
+  // miss, and LegalActions gives the prefetch a few hundred cycles of
+  // independent work to hide it behind.
+  uint64_t store_key = 0;
+  if (backing_store_ != nullptr) {
+    store_key = MmapInfoStateStore::KeyFor(is_key);
+    backing_store_->Prefetch(store_key);
+  } else {
+    info_states_.prefetch(is_key);
+  }
   std::vector<Action> legal_actions = state.LegalActions();
 
-  // The insert here only inserts the default value if the key is not found,
-  // otherwise returns the entry in the map.
-  auto iter_and_result = info_states_.insert(
-      {is_key, CFRInfoStateValues(legal_actions, kInitialTableValues)});
-
-  CFRInfoStateValues info_state_copy = iter_and_result.first->second;
+  CFRInfoStateValues info_state_copy;
+  if (backing_store_ != nullptr) {
+    backing_store_->LoadOrCreate(store_key, legal_actions, kInitialTableValues,
+                                 &info_state_copy);
+  } else {
+    // The insert here only inserts the default value if the key is not found,
+    // otherwise returns the entry in the map.
+    auto iter_and_result = info_states_.insert(
+        {is_key, CFRInfoStateValues(legal_actions, kInitialTableValues)});
+    info_state_copy = iter_and_result.first->second;
+  }
   info_state_copy.ApplyRegretMatching();
 
   double value = 0;
@@ -161,25 +218,36 @@ double ExternalSamplingMCCFRSolver::UpdateRegrets(const State& state,
     }
   }
 
-  // Now the regret and avg strategy updates.
-  CFRInfoStateValues& info_state = info_states_[is_key];
-
-  if (cur_player == player) {
-    // Update regrets
-    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
-      info_state.cumulative_regrets[aidx] += (child_values[aidx] - value);
+  // Now the regret and avg strategy updates. Simple averaging does its
+  // update on the opponent node; in a game with more than two players we only
+  // update player + 1 mod num_players, which reduces to the standard rule in
+  // 2 players.
+  const bool update_regrets = (cur_player == player);
+  const bool update_avg =
+      avg_type_ == AverageType::kSimple &&
+      cur_player == ((player + 1) % game_->NumPlayers());
+  auto apply_updates = [&](CFRInfoStateValues& info_state) {
+    if (update_regrets) {
+      for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+        info_state.cumulative_regrets[aidx] += (child_values[aidx] - value);
+      }
     }
-  }
-
-  // Simple average does averaging on the opponent node. To do this in a game
-  // with more than two players, we only update the player + 1 mod num_players,
-  // which reduces to the standard rule in 2 players.
-  if (avg_type_ == AverageType::kSimple &&
-      cur_player == ((player + 1) % game_->NumPlayers())) {
-    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
-      info_state.cumulative_policy[aidx] +=
-          info_state_copy.current_policy[aidx];
+    if (update_avg) {
+      for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+        info_state.cumulative_policy[aidx] +=
+            info_state_copy.current_policy[aidx];
+      }
+    }
+  };
+  if (backing_store_ != nullptr) {
+    if (update_regrets || update_avg) {
+      CFRInfoStateValues stored_values;
+      SPIEL_CHECK_TRUE(backing_store_->Load(store_key, &stored_values));
+      apply_updates(stored_values);
+      backing_store_->Store(store_key, stored_values);
     }
+  } else {
+    apply_updates(info_states_[is_key]);
   }
 
   return value;
@@ -205,7 +273,10 @@ void ExternalSamplingMCCFRSolver::FullUpdateAverage(
   if (sum == 0.0) return;
 
   Player cur_player = state.CurrentPlayer();
-  std::string is_key = state.InformationStateString(cur_player);
+  std::string is_key = InfoStateKey(state, cur_player);
+  // Same lookahead as UpdateRegrets: overlap the entry fetch with
+  // LegalActions.
+  info_states_.prefetch(is_key);
   std::vector<Action> legal_actions = state.LegalActions();
 
   // The insert here only inserts the default value if the key is not found,
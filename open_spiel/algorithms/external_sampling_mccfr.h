@@ -17,6 +17,8 @@
 
 #include <memory>
 #include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "open_spiel/algorithms/cfr.h"
@@ -32,6 +34,8 @@
 namespace open_spiel {
 namespace algorithms {
 
+class MmapInfoStateStore;
+
 // How to average the strategy. The 'simple' type does the averaging for
 // player i + 1 mod num_players on player i's regret update pass; in two players
 // this corresponds to the standard implementation (updating the average
@@ -85,13 +89,38 @@ class ExternalSamplingMCCFRSolver {
   // Same as above, but uses the specified random number generator instead.
   void RunIteration(std::mt19937* rng);
 
+  // Runs `num_trajectories` iterations as one batch. Cheaper than calling
+  // RunIteration() that many times: the root state is built once and shared
+  // by every trajectory instead of being rebuilt per iteration. The update
+  // schedule is identical to that many RunIteration() calls — players
+  // alternate within the batch (see the note in the .cc on why they must).
+  void RunIterations(int num_trajectories);
+  void RunIterations(int num_trajectories, std::mt19937* rng);
+
+  // Routes all infostate reads and updates through `store` (see
+  // mmap_infostate_store.h) instead of the in-memory table, for runs whose
+  // tables exceed RAM. Pass nullptr to go back to the in-memory table; the
+  // store is borrowed, not owned, and must outlive its use here. Only the
+  // regret passes are supported: AverageType::kFull and AveragePolicy()
+  // still operate on the in-memory table, so out-of-core runs should use
+  // kSimple averaging and read results from the store.
+  void SetBackingStore(MmapInfoStateStore* store);
+
+  // Reroutes all infostate keying through `key_fn` (nullptr restores the
+  // default InformationStateString); see InfoStateKeyFn for the contract.
+  // Set before the first iteration so every entry is keyed consistently.
+  void SetInfoStateKeyFn(InfoStateKeyFn key_fn) {
+    info_state_key_fn_ = std::move(key_fn);
+  }
+
   CFRInfoStateValuesTable& InfoStateValuesTable() { return info_states_; }
 
   // Computes the average policy, containing the policy for all players.
   // The returned policy instance should only be used during the lifetime of
   // the CFRSolver object.
   std::shared_ptr<Policy> AveragePolicy() const {
-    return std::make_shared<CFRAveragePolicy>(info_states_, default_policy_);
+    return std::make_shared<CFRAveragePolicy>(info_states_, default_policy_,
+                                              info_state_key_fn_);
   }
 
   // See comments above CFRInfoStateValues::Serialize(double_precision) for
@@ -104,12 +133,23 @@ class ExternalSamplingMCCFRSolver {
   void FullUpdateAverage(const State& state,
                          const std::vector<double>& reach_probs);
 
+  std::string InfoStateKey(const State& state, Player player) const {
+    return info_state_key_fn_ ? info_state_key_fn_(state, player)
+                              : state.InformationStateString(player);
+  }
+
   std::shared_ptr<const Game> game_;
+  // Lazily built by RunIterations and reused across batches; trajectories
+  // only read it (sampling branches off via Child()).
+  std::unique_ptr<State> root_state_;
   std::unique_ptr<std::mt19937> rng_;
   AverageType avg_type_;
   CFRInfoStateValuesTable info_states_;
   std::uniform_real_distribution<double> dist_;
   std::shared_ptr<Policy> default_policy_;
+  MmapInfoStateStore* backing_store_ = nullptr;
+  // Null unless overridden via SetInfoStateKeyFn.
+  InfoStateKeyFn info_state_key_fn_;
 };
 
 std::unique_ptr<ExternalSamplingMCCFRSolver>
@@ -44,6 +44,21 @@ void MCCFR_2PGameTest(const std::string& game_name, std::mt19937* rng,
   SPIEL_CHECK_LE(nash_conv, nashconv_upperbound);
 }
 
+void MCCFR_BatchedIterationsTest(std::mt19937* rng) {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  ExternalSamplingMCCFRSolver solver(*game);
+  // 1000 trajectories in batches of 50 must converge just like the same
+  // number of individual RunIteration() calls.
+  for (int i = 0; i < 20; i++) {
+    solver.RunIterations(50, rng);
+  }
+  const std::shared_ptr<Policy> average_policy = solver.AveragePolicy();
+  double nash_conv = NashConv(*game, *average_policy, true);
+  std::cout << "Kuhn (batched iterations) NashConv = " << nash_conv
+            << std::endl;
+  SPIEL_CHECK_LE(nash_conv, 0.05);
+}
+
 void MCCFR_KuhnPoker3PTest(std::mt19937* rng) {
   std::shared_ptr<const Game> game = LoadGame("kuhn_poker(players=3)");
   ExternalSamplingMCCFRSolver solver(*game);
@@ -105,6 +120,7 @@ int main(int argc, char** argv) {
   algorithms::MCCFR_2PGameTest("kuhn_poker", &rng, 1000, 0.05);
   algorithms::MCCFR_2PGameTest("leduc_poker", &rng, 1000, 2.5);
   algorithms::MCCFR_2PGameTest("liars_dice", &rng, 100, 1.6);
+  algorithms::MCCFR_BatchedIterationsTest(&rng);
   algorithms::MCCFR_KuhnPoker3PTest(&rng);
   algorithms::MCCFR_SerializationTest();
 }
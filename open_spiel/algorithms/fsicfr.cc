@@ -16,8 +16,11 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <string>
 
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/spiel.h"
 
 namespace open_spiel {
@@ -98,6 +101,57 @@ FSICFRNode* FSICFRGraph::GetOrCreateTerminalNode(
   }
 }
 
+FSICFRNode* FSICFRGraph::GetOrCreateDecisionNode(uint64_t public_state_id,
+                                                 int chance_id,
+                                                 const State& state,
+                                                 int max_predecessors) {
+  auto iter = compact_key_to_node_id_map_.find({public_state_id, chance_id});
+  if (iter != compact_key_to_node_id_map_.end()) {
+    return &nodes_[iter->second];
+  }
+  FSICFRNode* node = GetOrCreateDecisionNode(
+      state.LegalActions(), state.InformationStateString(),
+      state.CurrentPlayer(), max_predecessors, chance_id);
+  compact_key_to_node_id_map_[{public_state_id, chance_id}] = node->id;
+  return node;
+}
+
+FSICFRNode* FSICFRGraph::GetOrCreateTerminalNode(uint64_t public_state_id,
+                                                 double p0_utility,
+                                                 int max_predecessors) {
+  auto iter =
+      compact_key_to_node_id_map_.find({public_state_id, kTerminalChanceId});
+  if (iter != compact_key_to_node_id_map_.end()) {
+    return &nodes_[iter->second];
+  }
+  FSICFRNode* node = GetOrCreateTerminalNode(
+      absl::StrCat("terminal ", public_state_id), p0_utility,
+      max_predecessors);
+  compact_key_to_node_id_map_[{public_state_id, kTerminalChanceId}] = node->id;
+  return node;
+}
+
+void FSICFRGraph::Finalize(const std::vector<int>& chance_outcome_ranges) {
+  for (FSICFRNode& node : nodes_) {
+    if (node.terminal) {
+      continue;
+    }
+    const int opp_range = chance_outcome_ranges[1 - node.player];
+    node.opp_chance_range = opp_range;
+    node.dense_children.assign(node.legal_actions.size() * opp_range, -1);
+    for (const auto& [action_and_chance, child_id] : node.children) {
+      auto action_iter =
+          std::find(node.legal_actions.begin(), node.legal_actions.end(),
+                    action_and_chance.first);
+      SPIEL_CHECK_TRUE(action_iter != node.legal_actions.end());
+      const int a = action_iter - node.legal_actions.begin();
+      SPIEL_CHECK_GE(action_and_chance.second, 0);
+      SPIEL_CHECK_LT(action_and_chance.second, opp_range);
+      node.dense_children[a * opp_range + action_and_chance.second] = child_id;
+    }
+  }
+}
+
 void FSICFRGraph::TopSort() {
   int max_value = -1;
   int cur_value = 0;
@@ -125,6 +179,70 @@ void FSICFRGraph::TopSort() {
   SPIEL_CHECK_EQ(nodes_.size(), ordered_ids_.size());
 }
 
+namespace {
+
+void BuildFSICFRGraphRecursive(const FSICFRGraphSpec& spec, const State& state,
+                               int max_predecessors, int parent_node_id,
+                               Action parent_action,
+                               int parent_other_chance_id,
+                               FSICFRGraph* graph) {
+  if (state.IsTerminal()) {
+    FSICFRNode* node = graph->GetOrCreateTerminalNode(
+        spec.public_state_id(state), state.PlayerReturn(0), max_predecessors);
+    FSICFRNode* parent_node = graph->GetNode(parent_node_id);
+    SPIEL_CHECK_TRUE(parent_node != nullptr);
+    parent_node->AddChild(parent_action, parent_other_chance_id, node);
+  } else if (state.IsChanceNode()) {
+    // Chance nodes create no graph nodes; the outcomes are recovered through
+    // spec.chance_id once all chance events have resolved.
+    for (Action outcome : state.LegalActions()) {
+      std::unique_ptr<State> next_state = state.Child(outcome);
+      BuildFSICFRGraphRecursive(spec, *next_state, max_predecessors,
+                                parent_node_id, parent_action,
+                                parent_other_chance_id, graph);
+    }
+  } else {
+    const Player player = state.CurrentPlayer();
+    const int my_chance_id = spec.chance_id(state, player);
+    const int other_chance_id = spec.chance_id(state, 1 - player);
+
+    FSICFRNode* node = graph->GetOrCreateDecisionNode(
+        spec.public_state_id(state), my_chance_id, state, max_predecessors);
+    int next_max_predecessors = node->max_predecessors + 1;
+    int node_id = node->id;
+
+    node->max_predecessors = std::max(max_predecessors, node->max_predecessors);
+
+    // Copied: creating nodes during the recursion below can reallocate the
+    // graph's node storage.
+    std::vector<Action> legal_actions = node->legal_actions;
+
+    FSICFRNode* parent_node = graph->GetNode(parent_node_id);
+    if (parent_node != nullptr) {
+      parent_node->AddChild(parent_action, parent_other_chance_id, node);
+    }
+
+    for (Action action : legal_actions) {
+      std::unique_ptr<State> next_state = state.Child(action);
+      BuildFSICFRGraphRecursive(spec, *next_state, next_max_predecessors,
+                                node_id, action, other_chance_id, graph);
+    }
+  }
+}
+
+}  // namespace
+
+void BuildFSICFRGraph(const Game& game, const FSICFRGraphSpec& spec,
+                      FSICFRGraph* graph) {
+  SPIEL_CHECK_EQ(game.NumPlayers(), kNumPlayers);
+  SPIEL_CHECK_EQ(spec.chance_outcome_ranges.size(), kNumPlayers);
+  std::unique_ptr<State> initial_state = game.NewInitialState();
+  BuildFSICFRGraphRecursive(spec, *initial_state, 0, -1, kInvalidAction, -1,
+                            graph);
+  graph->TopSort();
+  graph->Finalize(spec.chance_outcome_ranges);
+}
+
 FSICFRSolver::FSICFRSolver(const Game& game, int seed,
                            const std::vector<int>& chance_outcome_ranges,
                            const FSICFRGraph* graph)
@@ -171,10 +289,16 @@ void FSICFRSolver::ForwardPass() {
       int opp_chance_id = sampled_chance_outcomes_[1 - node->player];
       for (int a = 0; a < node->legal_actions.size(); ++a) {
         node->ssum[a] += my_reach * node->strategy[a];
-        Action action = node->legal_actions[a];
-        auto iter = node->children.find({action, opp_chance_id});
-        SPIEL_CHECK_TRUE(iter != node->children.end());
-        int child_id = iter->second;
+        int child_id;
+        if (!node->dense_children.empty()) {
+          child_id = node->DenseChild(a, opp_chance_id);
+        } else {
+          auto iter =
+              node->children.find({node->legal_actions[a], opp_chance_id});
+          SPIEL_CHECK_TRUE(iter != node->children.end());
+          child_id = iter->second;
+        }
+        SPIEL_CHECK_GE(child_id, 0);
         FSICFRNode* child = graph_->GetNode(child_id);
         if (!child->terminal) {
           child->visits += node->visits;
@@ -201,10 +325,16 @@ void FSICFRSolver::BackwardPass() {
       std::vector<double> values(node->legal_actions.size(), 0);
       double opp_reach = node->psum[1 - node->player];
       for (int a = 0; a < node->legal_actions.size(); ++a) {
-        Action action = node->legal_actions[a];
-        auto iter = node->children.find({action, opp_chance_id});
-        SPIEL_CHECK_TRUE(iter != node->children.end());
-        int child_id = iter->second;
+        int child_id;
+        if (!node->dense_children.empty()) {
+          child_id = node->DenseChild(a, opp_chance_id);
+        } else {
+          auto iter =
+              node->children.find({node->legal_actions[a], opp_chance_id});
+          SPIEL_CHECK_TRUE(iter != node->children.end());
+          child_id = iter->second;
+        }
+        SPIEL_CHECK_GE(child_id, 0);
         FSICFRNode* child = graph_->GetNode(child_id);
         if (child->terminal) {
           SPIEL_CHECK_TRUE(child->p0_utility == -1 || child->p0_utility == 1);
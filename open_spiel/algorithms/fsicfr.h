@@ -15,7 +15,11 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_FSICFR_H_
 #define OPEN_SPIEL_ALGORITHMS_FSICFR_H_
 
+#include <cstdint>
+#include <functional>
 #include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
@@ -67,10 +71,21 @@ struct FSICFRNode {
   std::vector<double> strategy;
   std::vector<double> regrets;
 
+  // Transitions (action index, opponent chance id) -> child id as one dense
+  // array of size legal_actions.size() * opp_chance_range, built by
+  // FSICFRGraph::Finalize (-1 where no transition exists). When present, the
+  // forward/backward sweeps index into this instead of hashing into children.
+  int opp_chance_range = 0;
+  std::vector<int> dense_children;
+
   FSICFRNode();
   void AddChild(Action action, int chance_id, FSICFRNode* child);
   std::string ToString();
   void ApplyRegretMatching();
+
+  int DenseChild(int action_index, int opp_chance_id) const {
+    return dense_children[action_index * opp_chance_range + opp_chance_id];
+  }
 };
 
 class FSICFRGraph {
@@ -82,6 +97,17 @@ class FSICFRGraph {
                                       int chance_id);
   FSICFRNode* GetOrCreateTerminalNode(const std::string& terminal_string_key,
                                       double p0_utility, int max_predecessors);
+
+  // Compact-key variants used by BuildFSICFRGraph below: nodes are looked up
+  // by (public state id, chance id) integers, and the information state
+  // string and legal actions are only computed when the node is first
+  // created, not on every revisit.
+  FSICFRNode* GetOrCreateDecisionNode(uint64_t public_state_id, int chance_id,
+                                      const State& state,
+                                      int max_predecessors);
+  FSICFRNode* GetOrCreateTerminalNode(uint64_t public_state_id,
+                                      double p0_utility, int max_predecessors);
+
   FSICFRNode* GetNode(int id) const {
     if (id < 0 || id >= nodes_.size()) {
       return nullptr;
@@ -98,10 +124,21 @@ class FSICFRGraph {
 
   int ordered_node_id(int idx) const { return ordered_ids_[idx]; }
 
+  // Builds the dense per-node transition arrays from the children maps;
+  // chance_outcome_ranges are the per-player chance id ranges (as passed to
+  // FSICFRSolver). Call once after the graph is fully built.
+  void Finalize(const std::vector<int>& chance_outcome_ranges);
+
  private:
+  constexpr static int kTerminalChanceId = -1;
+
   // Infostate/terminal string key to node id map
   absl::flat_hash_map<std::string, int> string_key_to_node_id_map_;
 
+  // (public state id, chance id) to node id map for the compact-key variants;
+  // terminal nodes use kTerminalChanceId as the chance id.
+  absl::flat_hash_map<std::pair<uint64_t, int>, int> compact_key_to_node_id_map_;
+
   // Nodes. Ids correspond to indices.
   std::vector<FSICFRNode> nodes_;
 
@@ -111,6 +148,32 @@ class FSICFRGraph {
   std::vector<int> ordered_ids_;
 };
 
+// Specification the generic graph builder needs to map a game onto FSICFR's
+// assumptions (see the comment at the top of this file): per-player chance id
+// ranges, a dense chance id per player, and a compact public-state id.
+// (public_state_id, acting player's chance_id) must uniquely identify the
+// acting player's information state.
+struct FSICFRGraphSpec {
+  // Number of distinct chance ids for each player.
+  std::vector<int> chance_outcome_ranges;
+
+  // Dense id in [0, chance_outcome_ranges[player]) of the player's chance
+  // outcome; only called once all chance events have resolved.
+  std::function<int(const State&, Player)> chance_id;
+
+  // Compact id of the public state. Hash-based ids (e.g.
+  // DurakState::PublicStateId) are acceptable: a collision would merge
+  // unrelated nodes, but with 64-bit ids this is vanishingly unlikely. For
+  // terminal states the id must also determine the returns.
+  std::function<uint64_t(const State&)> public_state_id;
+};
+
+// Builds the full FSICFR node graph for the game, topologically sorts it and
+// finalizes the dense transition arrays; the graph is then ready to be passed
+// to FSICFRSolver.
+void BuildFSICFRGraph(const Game& game, const FSICFRGraphSpec& spec,
+                      FSICFRGraph* graph);
+
 class FSICFRSolver {
  public:
   FSICFRSolver(const Game& game, int seed,
@@ -14,6 +14,17 @@
 
 #include "open_spiel/algorithms/get_all_histories.h"
 
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/utils/thread.h"
+
 namespace open_spiel {
 namespace algorithms {
 namespace {
@@ -52,18 +63,114 @@ void GetSubgameHistories(State* state,
   }
 }
 
+// A pending subtree root in the parallel traversal.
+struct HistoryWorkItem {
+  std::unique_ptr<State> state;
+  int depth;
+};
+
+// Per-worker state for the work-stealing traversal. The owner pops from the
+// front of its deque (most recently pushed, i.e. deepest, keeping the walk
+// depth-first and the deque short); thieves pop from the back, which holds
+// the shallowest and therefore largest pending subtrees.
+struct HistoryWorker {
+  std::mutex mu;
+  std::deque<HistoryWorkItem> deque;
+  std::vector<std::unique_ptr<State>> histories;
+};
+
+void WorkStealingHistoryWalk(std::vector<std::unique_ptr<HistoryWorker>>*
+                                 workers,
+                             int worker_id, std::atomic<int>* num_pending,
+                             int depth_limit, bool include_terminals,
+                             bool include_chance_states) {
+  HistoryWorker& self = *(*workers)[worker_id];
+  for (;;) {
+    absl::optional<HistoryWorkItem> item;
+    {
+      std::lock_guard<std::mutex> lock(self.mu);
+      if (!self.deque.empty()) {
+        item = std::move(self.deque.front());
+        self.deque.pop_front();
+      }
+    }
+    for (int offset = 1; !item && offset < workers->size(); ++offset) {
+      HistoryWorker& victim =
+          *(*workers)[(worker_id + offset) % workers->size()];
+      std::lock_guard<std::mutex> lock(victim.mu);
+      if (!victim.deque.empty()) {
+        item = std::move(victim.deque.back());
+        victim.deque.pop_back();
+      }
+    }
+    if (!item) {
+      // All deques looked empty; done only once no item is in flight
+      // anywhere (a busy worker may still push more work).
+      if (num_pending->load() == 0) return;
+      std::this_thread::yield();
+      continue;
+    }
+
+    State* state = item->state.get();
+    const int depth = item->depth;
+    if (state->IsTerminal()) {
+      if (include_terminals) self.histories.push_back(std::move(item->state));
+    } else if (depth_limit < 0 || depth <= depth_limit) {
+      for (Action action : state->LegalActions()) {
+        std::unique_ptr<State> next_state = state->Clone();
+        next_state->ApplyAction(action);
+        num_pending->fetch_add(1);
+        std::lock_guard<std::mutex> lock(self.mu);
+        self.deque.push_front({std::move(next_state), depth + 1});
+      }
+      if (!state->IsChanceNode() || include_chance_states) {
+        self.histories.push_back(std::move(item->state));
+      }
+    }
+    num_pending->fetch_sub(1);
+  }
+}
+
 }  // namespace
 
 std::vector<std::unique_ptr<State>> GetAllHistories(
     const Game& game, int depth_limit, bool include_terminals,
-    bool include_chance_states) {
+    bool include_chance_states, int num_threads) {
   // Get the root state.
   std::unique_ptr<State> state = game.NewInitialState();
   std::vector<std::unique_ptr<State>> all_histories;
 
-  // Then, do a recursive tree walk to fill up the vector.
-  GetSubgameHistories(state.get(), &all_histories, depth_limit, 0,
-                      include_terminals, include_chance_states);
+  if (num_threads <= 1) {
+    // Do a recursive tree walk to fill up the vector.
+    GetSubgameHistories(state.get(), &all_histories, depth_limit, 0,
+                        include_terminals, include_chance_states);
+  } else {
+    std::vector<std::unique_ptr<HistoryWorker>> workers;
+    workers.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+      workers.push_back(std::make_unique<HistoryWorker>());
+    }
+    std::atomic<int> num_pending(1);
+    workers[0]->deque.push_front({std::move(state), 0});
+
+    std::vector<Thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+      threads.emplace_back([&workers, &num_pending, t, depth_limit,
+                            include_terminals, include_chance_states]() {
+        WorkStealingHistoryWalk(&workers, t, &num_pending, depth_limit,
+                                include_terminals, include_chance_states);
+      });
+    }
+    for (Thread& thread : threads) thread.join();
+
+    // Merge: concatenate the per-worker results.
+    for (std::unique_ptr<HistoryWorker>& worker : workers) {
+      for (std::unique_ptr<State>& history : worker->histories) {
+        all_histories.push_back(std::move(history));
+      }
+    }
+  }
 
   if (all_histories.empty()) {
     SpielFatalError("GetSubgameHistories returned 0 histories!");
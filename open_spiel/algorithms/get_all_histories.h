@@ -36,9 +36,17 @@ namespace algorithms {
 //
 // Note: negative depth limit means no limit, 0 means only root, etc..
 // The default arguments will return all decision nodes in the game.
+//
+// With num_threads > 1 the traversal runs on a work-stealing thread pool:
+// each worker expands subtrees depth-first from its own deque and idle
+// workers steal the shallowest (largest) pending subtrees from the others;
+// the per-worker history vectors are concatenated at the end. Every history
+// is still returned exactly once, but the order of the returned vector is
+// unspecified in this mode (single-threaded calls keep the depth-first
+// preorder).
 std::vector<std::unique_ptr<State>> GetAllHistories(
     const Game& game, int depth_limit = -1, bool include_terminals = false,
-    bool include_chance_states = false);
+    bool include_chance_states = false, int num_threads = 1);
 
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -14,6 +14,10 @@
 
 #include "open_spiel/algorithms/get_all_histories.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "open_spiel/games/tic_tac_toe/tic_tac_toe.h"
 #include "open_spiel/spiel_utils.h"
 
@@ -34,4 +38,21 @@ int main(int argc, char **argv) {
                                           /*include_terminals=*/false,
                                           /*include_chance_states=*/true);
   SPIEL_CHECK_EQ(histories.size(), kTTTNumPartialHistories);
+
+  // The work-stealing traversal must enumerate exactly the same histories
+  // (the order is unspecified, so compare the sorted history strings).
+  histories = algorithms::GetAllHistories(*game, -1,
+                                          /*include_terminals=*/true,
+                                          /*include_chance_states=*/true,
+                                          /*num_threads=*/4);
+  SPIEL_CHECK_EQ(histories.size(), kTTTNumTotalHistories);
+  std::vector<std::string> history_strings;
+  history_strings.reserve(histories.size());
+  for (const std::unique_ptr<open_spiel::State>& history : histories) {
+    history_strings.push_back(history->HistoryString());
+  }
+  std::sort(history_strings.begin(), history_strings.end());
+  SPIEL_CHECK_TRUE(
+      std::adjacent_find(history_strings.begin(), history_strings.end()) ==
+      history_strings.end());
 }
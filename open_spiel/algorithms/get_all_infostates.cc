@@ -16,6 +16,8 @@
 
 #include <algorithm>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
+
 namespace open_spiel {
 namespace algorithms {
 namespace {
@@ -48,6 +50,41 @@ void GetSubgameInformationStates(
   }
 }
 
+// Depth-first walk for ForAllInformationStates. Only the clones along the
+// current path are live (O(depth) states); `seen` holds one 64-bit key per
+// infostate already reported.
+void StreamSubgameInformationStates(
+    State* state,
+    const std::function<void(uint64_t, Player, const std::vector<Action>&)>&
+        callback,
+    absl::flat_hash_set<uint64_t>* seen, int depth_limit, int depth) {
+  if (state->IsTerminal()) {
+    return;
+  }
+
+  if (depth_limit >= 0 && depth > depth_limit) {
+    return;
+  }
+
+  std::vector<Action> legal_actions = state->LegalActions();
+  if (!state->IsChanceNode()) {
+    int player = state->CurrentPlayer();
+    SPIEL_CHECK_GE(player, 0);
+    SPIEL_CHECK_LT(player, state->NumPlayers());
+    uint64_t key = state->InformationStateHash(player);
+    if (seen->insert(key).second) {
+      callback(key, player, legal_actions);
+    }
+  }
+
+  for (Action action : legal_actions) {
+    std::unique_ptr<State> next_state = state->Clone();
+    next_state->ApplyAction(action);
+    StreamSubgameInformationStates(next_state.get(), callback, seen,
+                                   depth_limit, depth + 1);
+  }
+}
+
 }  // namespace
 
 std::vector<std::vector<std::string>> GetAllInformationStates(const Game& game,
@@ -69,5 +106,16 @@ std::vector<std::vector<std::string>> GetAllInformationStates(const Game& game,
   return all_infostates;
 }
 
+void ForAllInformationStates(
+    const Game& game,
+    const std::function<void(uint64_t infostate_key, Player player,
+                             const std::vector<Action>& legal_actions)>&
+        callback,
+    int depth_limit) {
+  std::unique_ptr<State> state = game.NewInitialState();
+  absl::flat_hash_set<uint64_t> seen;
+  StreamSubgameInformationStates(state.get(), callback, &seen, depth_limit, 0);
+}
+
 }  // namespace algorithms
 }  // namespace open_spiel
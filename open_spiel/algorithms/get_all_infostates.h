@@ -15,6 +15,8 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_GET_ALL_INFOSTATES_H_
 #define OPEN_SPIEL_ALGORITHMS_GET_ALL_INFOSTATES_H_
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,6 +31,27 @@ namespace algorithms {
 std::vector<std::vector<std::string>> GetAllInformationStates(
     const Game& game, int depth_limit = -1);
 
+// Streaming variant of GetAllInformationStates: invokes `callback` once per
+// distinct information state instead of materializing the strings, so the
+// traversal runs in memory independent of the number of infostates. The
+// callback receives the infostate's 64-bit key (State::InformationStateHash),
+// the acting player, and the legal actions at that infostate; the actions
+// span is only valid for the duration of the call.
+//
+// Deduplication uses the 64-bit keys -- eight bytes per infostate instead of
+// the string. A hash collision would silently merge two infostates; with
+// 64-bit keys this is negligible at any traversal size that can finish at
+// all, and games that override InformationStateHash keep that contract.
+// Note the traversal itself still visits every history (distinct histories
+// sharing an infostate have distinct subtrees), so this bounds memory, not
+// time.
+void ForAllInformationStates(
+    const Game& game,
+    const std::function<void(uint64_t infostate_key, Player player,
+                             const std::vector<Action>& legal_actions)>&
+        callback,
+    int depth_limit = -1);
+
 }  // namespace algorithms
 }  // namespace open_spiel
 
@@ -0,0 +1,60 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/get_all_infostates.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace algorithms = open_spiel::algorithms;
+
+int main(int argc, char** argv) {
+  std::shared_ptr<const open_spiel::Game> game =
+      open_spiel::LoadGame("kuhn_poker");
+
+  // The materializing and streaming enumerations must agree on the number of
+  // distinct infostates, in total and per player.
+  std::vector<std::vector<std::string>> all_infostates =
+      algorithms::GetAllInformationStates(*game);
+  std::vector<int> streamed_counts(game->NumPlayers(), 0);
+  algorithms::ForAllInformationStates(
+      *game,
+      [&streamed_counts](uint64_t key, open_spiel::Player player,
+                         const std::vector<open_spiel::Action>& legal_actions) {
+        SPIEL_CHECK_FALSE(legal_actions.empty());
+        ++streamed_counts[player];
+      });
+  for (open_spiel::Player p = 0; p < game->NumPlayers(); ++p) {
+    SPIEL_CHECK_EQ(streamed_counts[p], all_infostates[p].size());
+  }
+
+  // A depth limit restricts both enumerations identically.
+  all_infostates = algorithms::GetAllInformationStates(*game, /*depth_limit=*/3);
+  int streamed_total = 0;
+  algorithms::ForAllInformationStates(
+      *game,
+      [&streamed_total](uint64_t, open_spiel::Player,
+                        const std::vector<open_spiel::Action>&) {
+        ++streamed_total;
+      },
+      /*depth_limit=*/3);
+  int materialized_total = 0;
+  for (const std::vector<std::string>& per_player : all_infostates) {
+    materialized_total += per_player.size();
+  }
+  SPIEL_CHECK_EQ(streamed_total, materialized_total);
+}
@@ -14,6 +14,11 @@
 
 #include "open_spiel/algorithms/get_all_states.h"
 
+#include <cstdint>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
+
 namespace open_spiel {
 namespace algorithms {
 namespace {
@@ -68,6 +73,50 @@ void GetSubgameStates(State* state,
   }
 }
 
+// Streaming counterpart of GetSubgameStates: same walk, but each visited
+// state is handed to the callback and at most a 64-bit hash per state is
+// retained for deduplication.
+void VisitSubgameStates(State* state,
+                        const std::function<void(const State&)>& callback,
+                        absl::flat_hash_set<uint64_t>* visited, int depth_limit,
+                        int depth, bool include_terminals,
+                        bool include_chance_states, bool stop_at_duplicates) {
+  if (state->IsTerminal()) {
+    if (include_terminals) {
+      if (visited == nullptr ||
+          visited->insert(absl::Hash<std::string>()(state->ToString()))
+              .second) {
+        callback(*state);
+      }
+    }
+    return;
+  }
+
+  if (depth_limit >= 0 && depth > depth_limit) {
+    return;
+  }
+
+  if (!state->IsChanceNode() || include_chance_states) {
+    if (visited == nullptr) {
+      callback(*state);
+    } else if (visited->insert(absl::Hash<std::string>()(state->ToString()))
+                   .second) {
+      callback(*state);
+    } else if (stop_at_duplicates) {
+      // Terminate, do not explore the same node twice.
+      return;
+    }
+  }
+
+  for (auto action : state->LegalActions()) {
+    auto next_state = state->Clone();
+    next_state->ApplyAction(action);
+    VisitSubgameStates(next_state.get(), callback, visited, depth_limit,
+                       depth + 1, include_terminals, include_chance_states,
+                       stop_at_duplicates);
+  }
+}
+
 }  // namespace
 
 std::map<std::string, std::unique_ptr<State>> GetAllStates(
@@ -88,5 +137,17 @@ std::map<std::string, std::unique_ptr<State>> GetAllStates(
   return all_states;
 }
 
+void ForAllStates(const Game& game,
+                  const std::function<void(const State&)>& callback,
+                  int depth_limit, bool include_terminals,
+                  bool include_chance_states, bool dedupe,
+                  bool stop_at_duplicates) {
+  std::unique_ptr<State> state = game.NewInitialState();
+  absl::flat_hash_set<uint64_t> visited;
+  VisitSubgameStates(state.get(), callback, dedupe ? &visited : nullptr,
+                     depth_limit, /*depth=*/0, include_terminals,
+                     include_chance_states, stop_at_duplicates);
+}
+
 }  // namespace algorithms
 }  // namespace open_spiel
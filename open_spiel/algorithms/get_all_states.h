@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_GET_ALL_STATES_H_
 #define OPEN_SPIEL_ALGORITHMS_GET_ALL_STATES_H_
 
+#include <functional>
 #include <string>
 
 #include "open_spiel/spiel.h"
@@ -44,6 +45,27 @@ std::map<std::string, std::unique_ptr<State>> GetAllStates(
     const Game& game, int depth_limit, bool include_terminals,
     bool include_chance_states, bool stop_at_duplicates = false);
 
+// Streaming variant of GetAllStates: invokes `callback` for each state
+// instead of materializing the states in a map, so analyses that only need
+// to fold over the states run in memory independent of the game size.
+// The callback must not hold on to the State reference beyond the call;
+// clone it if needed.
+//
+// With `dedupe` set (the default), repeat visits of a state reached via
+// different paths are suppressed using a compact set of 64-bit hashes of the
+// state strings -- eight bytes per state instead of the string and the
+// clone. A hash collision would silently skip a state; with 64-bit hashes
+// this is negligible at any traversal size that can finish at all. With
+// `dedupe` unset no per-state memory is kept and the callback may fire more
+// than once per state.
+//
+// The flags and the traversal order match GetAllStates otherwise.
+void ForAllStates(const Game& game,
+                  const std::function<void(const State&)>& callback,
+                  int depth_limit, bool include_terminals,
+                  bool include_chance_states, bool dedupe = true,
+                  bool stop_at_duplicates = false);
+
 }  // namespace algorithms
 }  // namespace open_spiel
 
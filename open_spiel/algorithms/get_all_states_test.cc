@@ -26,4 +26,12 @@ int main(int argc, char **argv) {
   auto states = algorithms::GetAllStates(*game, -1, /*include_terminals=*/true,
                                          /*include_chance_states=*/true);
   SPIEL_CHECK_EQ(states.size(), ttt::kNumberStates);
+
+  // The streaming visitor must see each state exactly once when deduping.
+  int num_visited = 0;
+  algorithms::ForAllStates(
+      *game, [&num_visited](const open_spiel::State&) { ++num_visited; },
+      /*depth_limit=*/-1, /*include_terminals=*/true,
+      /*include_chance_states=*/true);
+  SPIEL_CHECK_EQ(num_visited, ttt::kNumberStates);
 }
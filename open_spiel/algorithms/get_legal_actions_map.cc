@@ -14,6 +14,16 @@
 
 #include "open_spiel/algorithms/get_legal_actions_map.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/utils/thread.h"
+
 namespace open_spiel {
 namespace algorithms {
 namespace {
@@ -67,12 +77,65 @@ void FillMap(const State& state,
 }  // namespace
 
 std::unordered_map<std::string, std::vector<Action>> GetLegalActionsMap(
-    const Game& game, int depth_limit, Player player) {
+    const Game& game, int depth_limit, Player player, int num_threads) {
+  SPIEL_CHECK_GE(num_threads, 1);
   std::unordered_map<std::string, std::vector<Action>> map;
   std::unique_ptr<State> initial_state = game.NewInitialState();
-  FillMap(*initial_state, &map, depth_limit, 0, player);
+  if (num_threads <= 1 || !initial_state->IsChanceNode() ||
+      (depth_limit >= 0 && depth_limit < 1)) {
+    FillMap(*initial_state, &map, depth_limit, 0, player);
+    return map;
+  }
+
+  // Partition the root chance outcomes over the workers, each filling its
+  // own map over its own subtree states, then merge. Duplicate infostates
+  // across partitions carry identical legal actions, so insertion order
+  // does not matter. The subtree roots are cloned up front so no worker
+  // touches the shared initial state.
+  std::vector<std::unique_ptr<State>> subtrees;
+  for (Action outcome : initial_state->LegalActions()) {
+    subtrees.push_back(initial_state->Child(outcome));
+  }
+  const int num_workers = std::min<int>(num_threads, subtrees.size());
+  std::vector<std::unordered_map<std::string, std::vector<Action>>>
+      worker_maps(num_workers);
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int t = 0; t < num_workers; ++t) {
+    workers.emplace_back(
+        [t, num_workers, depth_limit, player, &subtrees, &worker_maps]() {
+          for (int i = t; i < subtrees.size(); i += num_workers) {
+            FillMap(*subtrees[i], &worker_maps[t], depth_limit, 1, player);
+          }
+        });
+  }
+  for (Thread& worker : workers) worker.join();
+
+  for (std::unordered_map<std::string, std::vector<Action>>& worker_map :
+       worker_maps) {
+    for (auto& [info_state, legal_actions] : worker_map) {
+      map.emplace(info_state, std::move(legal_actions));
+    }
+  }
   return map;
 }
 
+std::unordered_map<std::string, std::vector<uint64_t>> GetLegalActionsMaskMap(
+    const Game& game, int depth_limit, Player player, int num_threads) {
+  const int num_words = (game.NumDistinctActions() + 63) / 64;
+  std::unordered_map<std::string, std::vector<uint64_t>> mask_map;
+  for (auto& [info_state, legal_actions] :
+       GetLegalActionsMap(game, depth_limit, player, num_threads)) {
+    std::vector<uint64_t> mask(num_words, 0);
+    for (Action action : legal_actions) {
+      SPIEL_CHECK_GE(action, 0);
+      SPIEL_CHECK_LT(action, game.NumDistinctActions());
+      mask[action / 64] |= uint64_t{1} << (action % 64);
+    }
+    mask_map.emplace(info_state, std::move(mask));
+  }
+  return mask_map;
+}
+
 }  // namespace algorithms
 }  // namespace open_spiel
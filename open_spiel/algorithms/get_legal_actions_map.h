@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_GET_LEGAL_ACTIONS_MAP_H_
 #define OPEN_SPIEL_ALGORITHMS_GET_LEGAL_ACTIONS_MAP_H_
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -29,8 +30,21 @@ namespace algorithms {
 // do a tree traversal over the entire game, use a negative depth limit. To
 // bundle all the legal actions for all players in the same map, use
 // kInvalidPlayer.
+//
+// With num_threads > 1 and a game whose root is a chance node, the subtrees
+// under the root chance outcomes are traversed on worker threads with one map
+// each, merged at the end; the result is identical to the serial build. Games
+// without a root chance node fall back to the serial traversal.
 std::unordered_map<std::string, std::vector<Action>> GetLegalActionsMap(
-    const Game& game, int depth_limit, Player player);
+    const Game& game, int depth_limit, Player player, int num_threads = 1);
+
+// As above, but each entry is the legal-action set packed as a bitmask,
+// 64 actions per word: action a is bit (a % 64) of word (a / 64), and every
+// entry has (NumDistinctActions() + 63) / 64 words. Much smaller than the
+// action vectors for fixed-action-space games, and membership tests are one
+// shift and mask.
+std::unordered_map<std::string, std::vector<uint64_t>> GetLegalActionsMaskMap(
+    const Game& game, int depth_limit, Player player, int num_threads = 1);
 
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -14,6 +14,8 @@
 
 #include "open_spiel/algorithms/get_legal_actions_map.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <unordered_map>
 
 #include "open_spiel/games/goofspiel/goofspiel.h"
@@ -69,10 +71,49 @@ void GoofspielTest() {
   SPIEL_CHECK_GT(map_both.size(), 0);
 }
 
+void ParallelBuildTest() {
+  for (const char* game_name : {"kuhn_poker", "leduc_poker"}) {
+    std::shared_ptr<const open_spiel::Game> game =
+        open_spiel::LoadGame(game_name);
+    LegalActionsMap serial = algorithms::GetLegalActionsMap(
+        *game, /*depth_limit=*/-1, open_spiel::kInvalidPlayer);
+    LegalActionsMap parallel = algorithms::GetLegalActionsMap(
+        *game, /*depth_limit=*/-1, open_spiel::kInvalidPlayer,
+        /*num_threads=*/3);
+    SPIEL_CHECK_TRUE(serial == parallel);
+  }
+}
+
+void MaskMapTest() {
+  std::shared_ptr<const open_spiel::Game> game =
+      open_spiel::LoadGame("leduc_poker");
+  LegalActionsMap map = algorithms::GetLegalActionsMap(
+      *game, /*depth_limit=*/-1, open_spiel::kInvalidPlayer);
+  std::unordered_map<std::string, std::vector<uint64_t>> mask_map =
+      algorithms::GetLegalActionsMaskMap(*game, /*depth_limit=*/-1,
+                                         open_spiel::kInvalidPlayer,
+                                         /*num_threads=*/3);
+  SPIEL_CHECK_EQ(map.size(), mask_map.size());
+  const int num_words = (game->NumDistinctActions() + 63) / 64;
+  for (const auto& [info_state, legal_actions] : map) {
+    const std::vector<uint64_t>& mask = mask_map.at(info_state);
+    SPIEL_CHECK_EQ(mask.size(), num_words);
+    for (open_spiel::Action a = 0; a < game->NumDistinctActions(); ++a) {
+      const bool in_mask = (mask[a / 64] >> (a % 64)) & 1;
+      const bool in_vector = std::find(legal_actions.begin(),
+                                       legal_actions.end(),
+                                       a) != legal_actions.end();
+      SPIEL_CHECK_EQ(in_mask, in_vector);
+    }
+  }
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
   KuhnTest();
   LeducTest();
   GoofspielTest();
+  ParallelBuildTest();
+  MaskMapTest();
 }
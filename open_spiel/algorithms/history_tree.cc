@@ -14,6 +14,7 @@
 
 #include "open_spiel/algorithms/history_tree.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <unordered_set>
@@ -25,13 +26,16 @@ namespace open_spiel {
 namespace algorithms {
 namespace {
 
-std::unique_ptr<HistoryNode> RecursivelyBuildGameTree(
+// Builds the subtree rooted at state, allocating nodes from the tree's pool
+// rather than one heap allocation per node.
+HistoryNode* RecursivelyBuildGameTree(
     std::unique_ptr<State> state, Player player_id,
+    std::deque<HistoryNode>* pool,
     absl::flat_hash_map<std::string, HistoryNode*>* state_to_node) {
-  std::unique_ptr<HistoryNode> node(
-      new HistoryNode(player_id, std::move(state)));
+  pool->emplace_back(player_id, std::move(state));
+  HistoryNode* node = &pool->back();
   if (state_to_node == nullptr) SpielFatalError("state_to_node is null.");
-  (*state_to_node)[node->GetHistory()] = node.get();
+  (*state_to_node)[node->GetHistory()] = node;
   State* state_ptr = node->GetState();
   switch (node->GetType()) {
     case StateType::kMeanField: {
@@ -45,9 +49,9 @@ std::unique_ptr<HistoryNode> RecursivelyBuildGameTree(
           SpielFatalError("Can't add child; child is null.");
         }
         probability_sum += prob;
-        std::unique_ptr<HistoryNode> child_node = RecursivelyBuildGameTree(
-            std::move(child), player_id, state_to_node);
-        node->AddChild(outcome, {prob, std::move(child_node)});
+        HistoryNode* child_node = RecursivelyBuildGameTree(
+            std::move(child), player_id, pool, state_to_node);
+        node->AddChild(outcome, {prob, child_node});
       }
       SPIEL_CHECK_FLOAT_EQ(probability_sum, 1.0);
       break;
@@ -63,8 +67,9 @@ std::unique_ptr<HistoryNode> RecursivelyBuildGameTree(
         // *counter-factual* probabilities, which ignore the probability of
         // the player that we are playing as.
         node->AddChild(legal_action,
-                       {1., RecursivelyBuildGameTree(
-                                std::move(child), player_id, state_to_node)});
+                       {1., RecursivelyBuildGameTree(std::move(child),
+                                                     player_id, pool,
+                                                     state_to_node)});
       }
       break;
     }
@@ -94,39 +99,53 @@ HistoryNode::HistoryNode(Player player_id, std::unique_ptr<State> game_state)
   } else {
     infostate_ = state_->InformationStateString(player_id);
   }
-  // Compute & store the legal actions so we can check that all actions we're
-  // adding are legal.
-  for (Action action : state_->LegalActions()) legal_actions_.insert(action);
+  // Store the legal actions (sorted, as LegalActions guarantees) so we can
+  // check that all actions we're adding are legal.
+  legal_actions_ = state_->LegalActions();
+  child_info_.reserve(legal_actions_.size());
   if (type_ == StateType::kTerminal) value_ = state_->PlayerReturn(player_id);
 }
 
-void HistoryNode::AddChild(
-    Action outcome, std::pair<double, std::unique_ptr<HistoryNode>> child) {
-  if (!legal_actions_.count(outcome)) SpielFatalError("Child is not legal.");
+void HistoryNode::AddChild(Action outcome,
+                           std::pair<double, HistoryNode*> child) {
+  if (!std::binary_search(legal_actions_.begin(), legal_actions_.end(),
+                          outcome)) {
+    SpielFatalError("Child is not legal.");
+  }
   if (child.second == nullptr) {
     SpielFatalError("Error inserting child; child is null.");
   }
   SPIEL_CHECK_PROB_TOLERANCE(child.first, ProbabilityDefaultTolerance());
-  child_info_[outcome] = std::move(child);
+  // Children are normally added in ascending action order, making this an
+  // append; the lower_bound keeps the vector sorted (and overwrites
+  // duplicates) if a caller inserts out of order.
+  auto it = std::lower_bound(
+      child_info_.begin(), child_info_.end(), outcome,
+      [](const auto& entry, Action action) { return entry.first < action; });
+  if (it != child_info_.end() && it->first == outcome) {
+    it->second = child;
+  } else {
+    child_info_.insert(it, {outcome, child});
+  }
   if (child_info_.size() > legal_actions_.size()) {
     SpielFatalError("More children than legal actions.");
   }
 }
 
 std::pair<double, HistoryNode*> HistoryNode::GetChild(Action outcome) {
-  auto it = child_info_.find(outcome);
-  if (it == child_info_.end()) {
+  auto it = std::lower_bound(
+      child_info_.begin(), child_info_.end(), outcome,
+      [](const auto& entry, Action action) { return entry.first < action; });
+  if (it == child_info_.end() || it->first != outcome) {
     SpielFatalError("Error getting child; action not found.");
   }
   // it->second.first is the probability associated with outcome, so as it is a
   // probability, it must be in [0, 1].
   SPIEL_CHECK_PROB_TOLERANCE(it->second.first, ProbabilityDefaultTolerance());
-  std::pair<double, HistoryNode*> child =
-      std::make_pair(it->second.first, it->second.second.get());
-  if (child.second == nullptr) {
+  if (it->second.second == nullptr) {
     SpielFatalError("Error getting child; child is null.");
   }
-  return child;
+  return it->second;
 }
 
 std::vector<Action> HistoryNode::GetChildActions() const {
@@ -153,8 +172,8 @@ std::vector<std::string> HistoryTree::GetHistories() {
 
 // Builds game tree consisting of all decision nodes for player_id.
 HistoryTree::HistoryTree(std::unique_ptr<State> state, Player player_id) {
-  root_ =
-      RecursivelyBuildGameTree(std::move(state), player_id, &state_to_node_);
+  root_ = RecursivelyBuildGameTree(std::move(state), player_id, &nodes_,
+                                   &state_to_node_);
 }
 
 ActionsAndProbs GetSuccessorsWithProbs(const State& state,
@@ -15,15 +15,14 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_HISTORY_TREE_H_
 #define OPEN_SPIEL_ALGORITHMS_HISTORY_TREE_H_
 
+#include <deque>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "open_spiel/abseil-cpp/absl/container/btree_map.h"
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
-#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
@@ -55,8 +54,11 @@ class HistoryNode {
 
   Action NumChildren() const { return child_info_.size(); }
 
-  void AddChild(Action outcome,
-                std::pair<double, std::unique_ptr<HistoryNode>> child);
+  // Registers a child node reached by taking the given action (or chance
+  // outcome), along with its transition probability. The child is not owned
+  // by this node; it must outlive it (nodes built by HistoryTree live in the
+  // tree's pool).
+  void AddChild(Action outcome, std::pair<double, HistoryNode*> child);
 
   std::vector<Action> GetChildActions() const;
 
@@ -69,11 +71,14 @@ class HistoryNode {
   StateType type_;
   double value_;
 
-  // Map from legal actions to transition probabilities. Uses a map as we need
-  // to preserve the order of the actions.
-  absl::flat_hash_set<Action> legal_actions_;
-  absl::btree_map<Action, std::pair<double, std::unique_ptr<HistoryNode>>>
-      child_info_;
+  // Legal actions at this node, sorted ascending (as returned by
+  // State::LegalActions). Used to check that all added children are legal.
+  std::vector<Action> legal_actions_;
+  // Children with their transition probabilities, kept sorted by action so
+  // that GetChildActions preserves the legal-action order and GetChild can
+  // binary search. A sorted flat vector beats a per-node tree map here: the
+  // fan-out is small and the tree is built once, then only read.
+  std::vector<std::pair<Action, std::pair<double, HistoryNode*>>> child_info_;
 };
 
 // History here refers to the fact that we're using histories- i.e.
@@ -89,7 +94,7 @@ class HistoryTree {
   // viewed from the perspective of the player making the decision.
   HistoryTree(std::unique_ptr<State> state, Player player_id);
 
-  HistoryNode* Root() { return root_.get(); }
+  HistoryNode* Root() { return root_; }
 
   HistoryNode* GetByHistory(const std::string& history);
   HistoryNode* GetByHistory(const State& state) {
@@ -102,7 +107,11 @@ class HistoryTree {
   Action NumHistories() { return state_to_node_.size(); }
 
  private:
-  std::unique_ptr<HistoryNode> root_;
+  // All nodes of the tree, in construction order. A deque gives stable
+  // addresses (handed out as raw pointers throughout) without a separate heap
+  // allocation per node.
+  std::deque<HistoryNode> nodes_;
+  HistoryNode* root_;
 
   // Maps histories to HistoryNodes.
   absl::flat_hash_map<std::string, HistoryNode*> state_to_node_;
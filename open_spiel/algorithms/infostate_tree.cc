@@ -14,6 +14,9 @@
 
 #include "open_spiel/algorithms/infostate_tree.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <stack>
@@ -21,7 +24,15 @@
 #include <utility>
 #include <vector>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/action_view.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -161,7 +172,8 @@ void InfostateNode::SwapParent(std::unique_ptr<InfostateNode> self,
 InfostateTree::InfostateTree(const std::vector<const State*>& start_states,
                              const std::vector<double>& chance_reach_probs,
                              std::shared_ptr<Observer> infostate_observer,
-                             Player acting_player, int max_move_ahead_limit)
+                             Player acting_player, int max_move_ahead_limit,
+                             int num_threads)
     : acting_player_(acting_player),
       infostate_observer_(std::move(infostate_observer)),
       root_(MakeRootNode()) {
@@ -176,11 +188,61 @@ InfostateTree::InfostateTree(const std::vector<const State*>& start_states,
     start_max_move_number =
         std::max(start_max_move_number, start_state->MoveNumber());
   }
+  const int move_limit = start_max_move_number + max_move_ahead_limit;
+
+  if (num_threads > 1 && start_states.size() > 1) {
+    // Partition the start states by their root-level infostate string.
+    // Subtrees under distinct root infostates never share nodes — children
+    // are looked up only within their parent — so the groups can be
+    // expanded concurrently, each into its own scratch root, and stitched
+    // under the real root afterwards.
+    absl::flat_hash_map<std::string, int> group_index;
+    std::vector<std::vector<int>> groups;
+    for (int i = 0; i < start_states.size(); ++i) {
+      const std::string key =
+          infostate_observer_->StringFrom(*start_states[i], acting_player_);
+      auto [it, inserted] = group_index.try_emplace(key, groups.size());
+      if (inserted) groups.emplace_back();
+      groups[it->second].push_back(i);
+    }
 
-  for (int i = 0; i < start_states.size(); ++i) {
-    RecursivelyBuildTree(root_.get(), /*depth=*/1, *start_states[i],
-                         start_max_move_number + max_move_ahead_limit,
-                         chance_reach_probs[i]);
+    std::vector<std::unique_ptr<InfostateNode>> scratch_roots;
+    scratch_roots.reserve(groups.size());
+    for (int g = 0; g < groups.size(); ++g) {
+      scratch_roots.push_back(MakeRootNode());
+    }
+
+    const int num_workers =
+        std::min<int>(num_threads, static_cast<int>(groups.size()));
+    std::vector<Thread> threads;
+    threads.reserve(num_workers);
+    for (int t = 0; t < num_workers; ++t) {
+      threads.emplace_back([this, &groups, &scratch_roots, &start_states,
+                            &chance_reach_probs, move_limit, num_workers, t]() {
+        for (int g = t; g < groups.size(); g += num_workers) {
+          for (int i : groups[g]) {
+            RecursivelyBuildTree(scratch_roots[g].get(), /*depth=*/1,
+                                 *start_states[i], move_limit,
+                                 chance_reach_probs[i]);
+          }
+        }
+      });
+    }
+    for (Thread& thread : threads) thread.join();
+
+    // Stitch the scratch subtrees under the real root.
+    for (std::unique_ptr<InfostateNode>& scratch_root : scratch_roots) {
+      for (std::unique_ptr<InfostateNode>& child : scratch_root->children_) {
+        child->parent_ = root_.get();
+        child->incoming_index_ = root_->children_.size();
+        root_->children_.push_back(std::move(child));
+      }
+    }
+  } else {
+    for (int i = 0; i < start_states.size(); ++i) {
+      RecursivelyBuildTree(root_.get(), /*depth=*/1, *start_states[i],
+                           move_limit, chance_reach_probs[i]);
+    }
   }
 
   // Operations to make after building the tree.
@@ -188,6 +250,7 @@ InfostateTree::InfostateTree(const std::vector<const State*>& start_states,
   nodes_at_depths_.resize(tree_height() + 1);
   CollectNodesAtDepth(mutable_root(), 0);
   LabelNodesWithIds();
+  BuildFlatStructure();
 }
 
 void InfostateTree::RebalanceTree() {
@@ -202,7 +265,7 @@ void InfostateTree::CollectNodesAtDepth(InfostateNode* node, size_t depth) {
 
 std::ostream& InfostateTree::operator<<(std::ostream& os) const {
   return os << "Infostate tree for player " << acting_player_ << ".\n"
-            << "Tree height: " << tree_height_ << '\n'
+            << "Tree height: " << tree_height() << '\n'
             << "Root branching: " << root_branching_factor() << '\n'
             << "Number of decision infostate nodes: " << num_decisions() << '\n'
             << "Number of sequences: " << num_sequences() << '\n'
@@ -244,7 +307,12 @@ std::unique_ptr<InfostateNode> InfostateTree::MakeRootNode() const {
 void InfostateTree::UpdateLeafNode(InfostateNode* node, const State& state,
                                    size_t leaf_depth,
                                    double chance_reach_probs) {
-  tree_height_ = std::max(tree_height_, leaf_depth);
+  // Lock-free maximum: concurrent builder threads may race on the height.
+  size_t known_height = tree_height_.load(std::memory_order_relaxed);
+  while (leaf_depth > known_height &&
+         !tree_height_.compare_exchange_weak(known_height, leaf_depth,
+                                             std::memory_order_relaxed)) {
+  }
   node->corresponding_states_.push_back(state.Clone());
   node->corresponding_ch_reaches_.push_back(chance_reach_probs);
 }
@@ -414,19 +482,21 @@ std::shared_ptr<InfostateTree> MakeInfostateTree(const Game& game,
   // can't call private constructors.
   return std::shared_ptr<InfostateTree>(new InfostateTree(
       {game.NewInitialState().get()}, /*chance_reach_probs=*/{1.},
-      game.MakeObserver(kInfoStateObsType, {}), acting_player, max_move_limit));
+      game.MakeObserver(kInfoStateObsType, {}), acting_player, max_move_limit,
+      /*num_threads=*/1));
 }
 
 std::shared_ptr<InfostateTree> MakeInfostateTree(
-    const std::vector<InfostateNode*>& start_nodes, int max_move_ahead_limit) {
+    const std::vector<InfostateNode*>& start_nodes, int max_move_ahead_limit,
+    int num_threads) {
   std::vector<const InfostateNode*> const_nodes(start_nodes.begin(),
                                                 start_nodes.end());
-  return MakeInfostateTree(const_nodes, max_move_ahead_limit);
+  return MakeInfostateTree(const_nodes, max_move_ahead_limit, num_threads);
 }
 
 std::shared_ptr<InfostateTree> MakeInfostateTree(
     const std::vector<const InfostateNode*>& start_nodes,
-    int max_move_ahead_limit) {
+    int max_move_ahead_limit, int num_threads) {
   SPIEL_CHECK_FALSE(start_nodes.empty());
   const InfostateNode* some_node = start_nodes[0];
   const InfostateTree& originating_tree = some_node->tree();
@@ -458,17 +528,17 @@ std::shared_ptr<InfostateTree> MakeInfostateTree(
   // can't call private constructors.
   return std::shared_ptr<InfostateTree>(new InfostateTree(
       start_states, chance_reach_probs, originating_tree.infostate_observer_,
-      originating_tree.acting_player_, max_move_ahead_limit));
+      originating_tree.acting_player_, max_move_ahead_limit, num_threads));
 }
 
 std::shared_ptr<InfostateTree> MakeInfostateTree(
     const std::vector<const State*>& start_states,
     const std::vector<double>& chance_reach_probs,
     std::shared_ptr<Observer> infostate_observer, Player acting_player,
-    int max_move_ahead_limit) {
+    int max_move_ahead_limit, int num_threads) {
   return std::shared_ptr<InfostateTree>(
       new InfostateTree(start_states, chance_reach_probs, infostate_observer,
-                        acting_player, max_move_ahead_limit));
+                        acting_player, max_move_ahead_limit, num_threads));
 }
 SequenceId InfostateTree::empty_sequence() const {
   return root().sequence_id();
@@ -594,6 +664,122 @@ std::pair<size_t, size_t> InfostateTree::CollectStartEndSequenceIds(
   }
 }
 
+void InfostateTree::BuildFlatStructure() {
+  // Copy the child-sequence ranges and the per-depth node shapes out of the
+  // heap-scattered nodes into id-ordered arrays, so that the sweeps below
+  // touch only contiguous memory.
+  flat_sequence_ranges_.resize(sequences_.size());
+  for (size_t i = 0; i < sequences_.size(); ++i) {
+    const InfostateNode* node = sequences_[i];
+    flat_sequence_ranges_[i] = {node->start_sequence_id().id(),
+                                node->end_sequence_id().id()};
+  }
+  flat_nodes_at_depths_.resize(nodes_at_depths_.size());
+  for (size_t d = 0; d < nodes_at_depths_.size(); ++d) {
+    flat_nodes_at_depths_[d].reserve(nodes_at_depths_[d].size());
+    for (const InfostateNode* node : nodes_at_depths_[d]) {
+      flat_nodes_at_depths_[d].push_back({node->num_children(), node->type()});
+    }
+  }
+}
+
+namespace {
+
+// Vectorized kernels for the sequence-form sweeps below. BuildFlatStructure
+// guarantees that both the traversal tables and the Tree*Vector storage are
+// contiguous in id order, so every hot loop reduces to a max, sum or
+// compare over a flat range of doubles. As in cfr.cc, the AVX2/NEON paths
+// and the scalar tail perform the same per-element operation; only the
+// order of the reductions differs.
+
+// Maximum over n contiguous doubles, seeded with `init`.
+double RangeMaxKernel(const double* values, int n, double init) {
+  double best = init;
+  int i = 0;
+#if defined(__AVX2__)
+  __m256d vbest = _mm256_set1_pd(init);
+  for (; i + 4 <= n; i += 4) {
+    vbest = _mm256_max_pd(vbest, _mm256_loadu_pd(values + i));
+  }
+  double lanes[4];
+  _mm256_storeu_pd(lanes, vbest);
+  best = std::fmax(std::fmax(lanes[0], lanes[1]),
+                   std::fmax(lanes[2], lanes[3]));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  float64x2_t vbest = vdupq_n_f64(init);
+  for (; i + 2 <= n; i += 2) {
+    vbest = vmaxq_f64(vbest, vld1q_f64(values + i));
+  }
+  best = std::fmax(vgetq_lane_f64(vbest, 0), vgetq_lane_f64(vbest, 1));
+#endif
+  for (; i < n; ++i) best = std::fmax(best, values[i]);
+  return best;
+}
+
+// Sum of n contiguous doubles.
+double RangeSumKernel(const double* values, int n) {
+  double sum = 0.0;
+  int i = 0;
+#if defined(__AVX2__)
+  __m256d vsum = _mm256_setzero_pd();
+  for (; i + 4 <= n; i += 4) {
+    vsum = _mm256_add_pd(vsum, _mm256_loadu_pd(values + i));
+  }
+  double lanes[4];
+  _mm256_storeu_pd(lanes, vsum);
+  sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  float64x2_t vsum = vdupq_n_f64(0.0);
+  for (; i + 2 <= n; i += 2) {
+    vsum = vaddq_f64(vsum, vld1q_f64(values + i));
+  }
+  sum = vgetq_lane_f64(vsum, 0) + vgetq_lane_f64(vsum, 1);
+#endif
+  for (; i < n; ++i) sum += values[i];
+  return sum;
+}
+
+// First index of the maximum over n > 0 contiguous doubles, with the
+// maximum itself written to *max_value: a vectorized max reduction followed
+// by a scalar scan for the first element equal to it (the scan usually
+// terminates after a few elements, so it is not worth vectorizing).
+int RangeArgMaxKernel(const double* values, int n, double* max_value) {
+  const double best =
+      RangeMaxKernel(values, n, -std::numeric_limits<double>::infinity());
+  *max_value = best;
+  for (int i = 0; i < n; ++i) {
+    if (values[i] == best) return i;
+  }
+  return n - 1;  // Unreachable unless the range contains NaNs.
+}
+
+// In place, values[i] = (values[i] == match) ? 1 : 0.
+void IndicatorKernel(double* values, int n, double match) {
+  int i = 0;
+#if defined(__AVX2__)
+  const __m256d vmatch = _mm256_set1_pd(match);
+  const __m256d vone = _mm256_set1_pd(1.0);
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_pd(
+        values + i,
+        _mm256_and_pd(_mm256_cmp_pd(_mm256_loadu_pd(values + i), vmatch,
+                                    _CMP_EQ_OQ),
+                      vone));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const float64x2_t vmatch = vdupq_n_f64(match);
+  const uint64x2_t vone_bits = vreinterpretq_u64_f64(vdupq_n_f64(1.0));
+  for (; i + 2 <= n; i += 2) {
+    const uint64x2_t mask = vceqq_f64(vld1q_f64(values + i), vmatch);
+    vst1q_f64(values + i,
+              vreinterpretq_f64_u64(vandq_u64(mask, vone_bits)));
+  }
+#endif
+  for (; i < n; ++i) values[i] = values[i] == match ? 1.0 : 0.0;
+}
+
+}  // namespace
+
 std::pair<double, SfStrategy> InfostateTree::BestResponse(
     TreeplexVector<double>&& gradient) const {
   SPIEL_CHECK_EQ(this, gradient.tree());
@@ -602,26 +788,26 @@ std::pair<double, SfStrategy> InfostateTree::BestResponse(
 
   // 1. Compute counterfactual best response
   // (i.e. in all infostates, even unreachable ones)
-  SequenceId current(0, this);
+  // Both passes read the tree structure through flat_sequence_ranges_, so
+  // they are linear scans over contiguous arrays in sequence-id order;
+  // the per-range maxima run through the vectorized kernels above. Child
+  // sequences always have smaller ids than their parent sequence, so the
+  // ascending scan folds each range before it is read.
+  double* gradient_data = gradient.data();
+  double* response_data = response.data();
   const double init_value = -std::numeric_limits<double>::infinity();
-  while (current.id() <= empty_sequence().id()) {
-    double max_value = init_value;
-    SequenceId max_id = current;
-    const InfostateNode* node = observation_infostate(current);
-    for (current = node->start_sequence_id();
-         current != node->end_sequence_id(); current.next()) {
-      if (gradient[current] > max_value) {
-        max_value = gradient[current];
-        max_id = current;
-      }
-    }
+  for (size_t seq = 0; seq <= empty_sequence().id(); ++seq) {
+    const FlatSequenceRange range = flat_sequence_ranges_[seq];
+    const int num_child_sequences = static_cast<int>(range.end - range.start);
+    if (num_child_sequences == 0) continue;
+    double max_value;
+    const int argmax = RangeArgMaxKernel(gradient_data + range.start,
+                                         num_child_sequences, &max_value);
     if (init_value != max_value) {
-      gradient[node->sequence_id()] += max_value;
-      response[max_id] = 1.;
+      gradient_data[seq] += max_value;
+      response_data[range.start + argmax] = 1.;
     }
-    current.next();
   }
-  SPIEL_CHECK_EQ(current.id(), empty_sequence().id() + 1);
 
   // 2. Prune away unreachable subtrees.
   //
@@ -629,10 +815,12 @@ std::pair<double, SfStrategy> InfostateTree::BestResponse(
   // Instead we make a more cache-friendly double pass through the response
   // vector: we increment the visited path by 1, resulting in a value of 2.
   // Then we zero-out all values but 2.
-  current = empty_sequence();
+  SequenceId current = empty_sequence();
   response[current] = 2.;
-  while (!IsLeafSequence(current)) {
-    for (SequenceId seq : observation_infostate(current)->AllSequenceIds()) {
+  while (flat_sequence_ranges_[current.id()].start !=
+         flat_sequence_ranges_[current.id()].end) {
+    const FlatSequenceRange range = flat_sequence_ranges_[current.id()];
+    for (SequenceId seq : Range<SequenceId>(range.start, range.end, this)) {
       if (response[seq] == 1.) {
         current = seq;
         response[seq] += 1.;
@@ -640,39 +828,35 @@ std::pair<double, SfStrategy> InfostateTree::BestResponse(
       }
     }
   }
-  for (SequenceId seq : response.range()) {
-    response[seq] = response[seq] == 2. ? 1. : 0.;
-  }
+  IndicatorKernel(response_data, static_cast<int>(response.size()), 2.);
   SPIEL_DCHECK_TRUE(IsValidSfStrategy(response));
   return {gradient[empty_sequence()], response};
 }
 
 double InfostateTree::BestResponseValue(LeafVector<double>&& gradient) const {
-  // Loop over all heights.
-  for (int d = tree_height_ - 1; d >= 0; d--) {
+  // Loop over all heights. The per-depth shapes are read from the flat
+  // id-ordered tables and the child values of each parent occupy a
+  // contiguous window of the gradient, so each pass is a sequence of
+  // vectorized max / sum reductions. Parents are written at the front of
+  // the same vector; the tree is balanced, so the write index never
+  // overtakes the read window.
+  double* gradient_data = gradient.data();
+  for (int d = static_cast<int>(tree_height()) - 1; d >= 0; d--) {
     int left_offset = 0;
     // Loop over all parents of current nodes.
-    for (int parent_idx = 0; parent_idx < nodes_at_depths_[d].size();
-         parent_idx++) {
-      const InfostateNode* node = nodes_at_depths_[d][parent_idx];
-      const int num_children = node->num_children();
-      const Range<LeafId> children_range =
-          gradient.range(left_offset, left_offset + num_children);
-      const LeafId parent_id(parent_idx, this);
-
-      if (node->type() == kDecisionInfostateNode) {
-        double max_value = std::numeric_limits<double>::min();
-        for (LeafId id : children_range) {
-          max_value = std::fmax(max_value, gradient[id]);
-        }
-        gradient[parent_id] = max_value;
+    const std::vector<FlatDepthNode>& depth_nodes = flat_nodes_at_depths_[d];
+    for (int parent_idx = 0; parent_idx < depth_nodes.size(); parent_idx++) {
+      const FlatDepthNode& node = depth_nodes[parent_idx];
+      const int num_children = node.num_children;
+
+      if (node.type == kDecisionInfostateNode) {
+        gradient_data[parent_idx] =
+            RangeMaxKernel(gradient_data + left_offset, num_children,
+                           std::numeric_limits<double>::min());
       } else {
-        SPIEL_DCHECK_EQ(node->type(), kObservationInfostateNode);
-        double sum_value = 0.;
-        for (LeafId id : children_range) {
-          sum_value += gradient[id];
-        }
-        gradient[parent_id] = sum_value;
+        SPIEL_DCHECK_EQ(node.type, kObservationInfostateNode);
+        gradient_data[parent_idx] =
+            RangeSumKernel(gradient_data + left_offset, num_children);
       }
       left_offset += num_children;
     }
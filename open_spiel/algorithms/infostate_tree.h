@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_INFOSTATE_TREE_H_
 #define OPEN_SPIEL_ALGORITHMS_INFOSTATE_TREE_H_
 
+#include <atomic>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -265,25 +266,32 @@ std::shared_ptr<InfostateTree> MakeInfostateTree(const Game& game,
 
 // Creates an infostate tree for a player based on some start states,
 // up to some move limit from the deepest start state.
+//
+// With num_threads > 1, subtree expansion is parallelized: the start states
+// are partitioned by their root-level infostate string — subtrees under
+// distinct root infostates never share nodes, as every node is looked up
+// only within its parent — and the groups are expanded concurrently, then
+// stitched under the common root. The infostate observer must be safe to
+// call from multiple threads (observers are stateless string writers).
 std::shared_ptr<InfostateTree> MakeInfostateTree(
     const std::vector<const State*>& start_states,
     const std::vector<double>& chance_reach_probs,
     std::shared_ptr<Observer> infostate_observer, Player acting_player,
-    int max_move_ahead_limit = 1000);
+    int max_move_ahead_limit = 1000, int num_threads = 1);
 
 // Creates an infostate tree based on some leaf infostate nodes coming from
 // another infostate tree, up to some move limit.
 // This is useful for easily constructing (depth-limited) tree continuations.
 std::shared_ptr<InfostateTree> MakeInfostateTree(
     const std::vector<const InfostateNode*>& start_nodes,
-    int max_move_ahead_limit = 1000);
+    int max_move_ahead_limit = 1000, int num_threads = 1);
 
 // C++17 does not allow implicit conversion of non-const pointers to const
 // pointers within a vector - explanation: https://stackoverflow.com/a/2102415
 // This just adds const to the pointers and calls the other MakeInfostateTree.
 std::shared_ptr<InfostateTree> MakeInfostateTree(
     const std::vector<InfostateNode*>& start_nodes,
-    int max_move_ahead_limit = 1000);
+    int max_move_ahead_limit = 1000, int num_threads = 1);
 
 class InfostateTree final {
   // Note that only MakeInfostateTree is allowed to call the constructor
@@ -294,15 +302,16 @@ class InfostateTree final {
   InfostateTree(const std::vector<const State*>& start_states,
                 const std::vector<double>& chance_reach_probs,
                 std::shared_ptr<Observer> infostate_observer,
-                Player acting_player, int max_move_ahead_limit);
+                Player acting_player, int max_move_ahead_limit,
+                int num_threads);
   // Friend factories.
   friend std::shared_ptr<InfostateTree> MakeInfostateTree(const Game&, Player,
                                                           int);
   friend std::shared_ptr<InfostateTree> MakeInfostateTree(
       const std::vector<const State*>&, const std::vector<double>&,
-      std::shared_ptr<Observer>, Player, int);
+      std::shared_ptr<Observer>, Player, int, int);
   friend std::shared_ptr<InfostateTree> MakeInfostateTree(
-      const std::vector<const InfostateNode*>&, int);
+      const std::vector<const InfostateNode*>&, int, int);
 
  public:
   // -- Root accessors ---------------------------------------------------------
@@ -381,6 +390,33 @@ class InfostateTree final {
     return nodes_at_depths_.at(depth);
   }
 
+  // -- Flat traversal structure -----------------------------------------------
+  // The nodes themselves are individually heap-allocated and must stay put,
+  // as algorithms hold raw pointers into the tree for its whole lifetime
+  // (see the constructor note above). To still get linear scans in the
+  // sequence-form sweeps, the structure those sweeps consult is extracted
+  // once after construction into contiguous arrays laid out in id order,
+  // with index-based child references instead of pointers.
+
+  // The child sequences of the infostate node owning a given sequence,
+  // as the id range [start, end). A leaf sequence has start == end.
+  struct FlatSequenceRange {
+    size_t start;
+    size_t end;
+  };
+  const std::vector<FlatSequenceRange>& flat_sequence_ranges() const {
+    return flat_sequence_ranges_;
+  }
+
+  // Child counts and node types per depth, in the order of nodes_at_depths_.
+  struct FlatDepthNode {
+    int num_children;
+    InfostateNodeType type;
+  };
+  const std::vector<std::vector<FlatDepthNode>>& flat_nodes_at_depths() const {
+    return flat_nodes_at_depths_;
+  }
+
   // -- Tree operations --------------------------------------------------------
   // Compute best response and value based on gradient from opponents.
   // This consumes the gradient vector, as it is used to compute the value.
@@ -397,7 +433,9 @@ class InfostateTree final {
   const Player acting_player_;
   const std::shared_ptr<Observer> infostate_observer_;
   const std::unique_ptr<InfostateNode> root_;
-  /*const*/ size_t tree_height_ = 0;
+  // Atomic because leaf updates race on the height maximum when subtrees
+  // are expanded in parallel (see MakeInfostateTree's num_threads).
+  /*const*/ std::atomic<size_t> tree_height_{0};
 
   // Tree structure collections that index the respective NodeIds.
   std::vector<InfostateNode*> decision_infostates_;
@@ -405,6 +443,10 @@ class InfostateTree final {
   // The last vector corresponds to the leaf nodes.
   std::vector<std::vector<InfostateNode*>> nodes_at_depths_;
 
+  // Flat traversal structure (see the public accessors above).
+  std::vector<FlatSequenceRange> flat_sequence_ranges_;
+  std::vector<std::vector<FlatDepthNode>> flat_nodes_at_depths_;
+
   // Utility functions whenever we create a new node for the tree.
   std::unique_ptr<InfostateNode> MakeNode(InfostateNode* parent,
                                           InfostateNodeType type,
@@ -438,6 +480,7 @@ class InfostateTree final {
 
   void CollectNodesAtDepth(InfostateNode* node, size_t depth);
   void LabelNodesWithIds();
+  void BuildFlatStructure();
   std::pair<size_t, size_t> CollectStartEndSequenceIds(
       InfostateNode* node, const SequenceId parent_sequence);
 };
@@ -683,6 +726,11 @@ class TreeVector {
     return os << vec_ << " (for player " << tree_->acting_player() << ')';
   }
   size_t size() const { return vec_.size(); }
+  // Raw contiguous storage, in increasing id order. The vectorized
+  // sequence-form kernels in infostate_tree.cc sweep over this directly;
+  // prefer the checked operator[] everywhere else.
+  T* data() { return vec_.data(); }
+  const T* data() const { return vec_.data(); }
   Range<Id> range() { return Range<Id>(0, vec_.size(), tree_); }
   Range<Id> range(size_t from, size_t to) { return Range<Id>(from, to, tree_); }
   const InfostateTree* tree() const { return tree_; }
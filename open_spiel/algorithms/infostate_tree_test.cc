@@ -15,8 +15,11 @@
 #include "open_spiel/algorithms/infostate_tree.h"
 
 #include <algorithm>
+#include <limits>
 #include <memory>
+#include <random>
 #include <utility>
+#include <vector>
 
 #include "open_spiel/games/goofspiel/goofspiel.h"
 #include "open_spiel/games/kuhn_poker/kuhn_poker.h"
@@ -507,6 +510,125 @@ void TestBestResponse() {
   }
 }
 
+void TestVectorizedSweepKernels() {
+  // The best-response sweeps run through vectorized max/sum kernels; on
+  // randomized gradients they must match a scalar re-computation of the
+  // same recurrences. Kuhn trees are wide enough to exercise both the
+  // vector lanes and the scalar tails.
+  std::mt19937 rng(34);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+  for (int pl = 0; pl < 2; ++pl) {
+    std::shared_ptr<InfostateTree> tree = MakeTree("kuhn_poker", /*player=*/pl);
+
+    // BestResponseValue against a scalar bottom-up sweep.
+    std::vector<double> leaf_values(tree->num_leaves());
+    for (double& v : leaf_values) v = dist(rng);
+    std::vector<double> level = leaf_values;
+    for (int d = static_cast<int>(tree->tree_height()) - 1; d >= 0; d--) {
+      const auto& depth_nodes = tree->flat_nodes_at_depths()[d];
+      std::vector<double> parents(depth_nodes.size());
+      int left_offset = 0;
+      for (int i = 0; i < depth_nodes.size(); ++i) {
+        if (depth_nodes[i].type == kDecisionInfostateNode) {
+          double max_value = std::numeric_limits<double>::min();
+          for (int c = 0; c < depth_nodes[i].num_children; ++c) {
+            max_value = std::fmax(max_value, level[left_offset + c]);
+          }
+          parents[i] = max_value;
+        } else {
+          double sum_value = 0.;
+          for (int c = 0; c < depth_nodes[i].num_children; ++c) {
+            sum_value += level[left_offset + c];
+          }
+          parents[i] = sum_value;
+        }
+        left_offset += depth_nodes[i].num_children;
+      }
+      level = std::move(parents);
+    }
+    LeafVector<double> leaf_grad(tree.get(), std::move(leaf_values));
+    SPIEL_CHECK_FLOAT_EQ(tree->BestResponseValue(std::move(leaf_grad)),
+                         level[0]);
+
+    // BestResponse against a scalar counterfactual pass.
+    std::vector<double> seq_values(tree->num_sequences());
+    for (double& v : seq_values) v = dist(rng);
+    std::vector<double> reference = seq_values;
+    for (size_t seq = 0; seq < reference.size(); ++seq) {
+      const auto& range = tree->flat_sequence_ranges()[seq];
+      double max_value = -std::numeric_limits<double>::infinity();
+      for (size_t child = range.start; child < range.end; ++child) {
+        max_value = std::fmax(max_value, reference[child]);
+      }
+      if (range.start != range.end) reference[seq] += max_value;
+    }
+    TreeplexVector<double> seq_grad(tree.get(), std::move(seq_values));
+    const auto [br_value, response] = tree->BestResponse(std::move(seq_grad));
+    SPIEL_CHECK_FLOAT_EQ(br_value, reference.back());
+    SPIEL_CHECK_TRUE(IsValidSfStrategy(response));
+  }
+}
+
+void TestParallelConstruction() {
+  // A parallel build from the dealt hands must produce a tree isomorphic to
+  // the serial one (certificates sort children, so child order is ignored).
+  const std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  std::vector<std::unique_ptr<State>> start_states;
+  std::vector<const State*> start_state_ptrs;
+  std::vector<double> chance_reaches;
+  std::unique_ptr<State> root = game->NewInitialState();
+  for (const auto& [outcome, prob] : root->ChanceOutcomes()) {
+    start_states.push_back(root->Child(outcome));
+    start_state_ptrs.push_back(start_states.back().get());
+    chance_reaches.push_back(prob);
+  }
+  std::shared_ptr<Observer> infostate_observer =
+      game->MakeObserver(kInfoStateObsType, {});
+
+  for (int pl = 0; pl < 2; ++pl) {
+    std::shared_ptr<InfostateTree> serial_tree =
+        MakeInfostateTree(start_state_ptrs, chance_reaches, infostate_observer,
+                          pl, /*max_move_ahead_limit=*/1000, /*num_threads=*/1);
+    std::shared_ptr<InfostateTree> parallel_tree =
+        MakeInfostateTree(start_state_ptrs, chance_reaches, infostate_observer,
+                          pl, /*max_move_ahead_limit=*/1000, /*num_threads=*/4);
+    SPIEL_CHECK_TRUE(RecomputeBalance(*parallel_tree));
+    SPIEL_CHECK_EQ(parallel_tree->tree_height(), serial_tree->tree_height());
+    SPIEL_CHECK_EQ(parallel_tree->num_decisions(), serial_tree->num_decisions());
+    SPIEL_CHECK_EQ(parallel_tree->num_sequences(), serial_tree->num_sequences());
+    SPIEL_CHECK_EQ(parallel_tree->num_leaves(), serial_tree->num_leaves());
+    SPIEL_CHECK_EQ(parallel_tree->root().MakeCertificate(),
+                   serial_tree->root().MakeCertificate());
+  }
+}
+
+void TestFlatStructure() {
+  for (int pl = 0; pl < 2; ++pl) {
+    std::shared_ptr<InfostateTree> tree = MakeTree("kuhn_poker", /*player=*/pl);
+
+    // The flat sequence ranges must mirror the per-node sequence ranges.
+    const auto& ranges = tree->flat_sequence_ranges();
+    SPIEL_CHECK_EQ(ranges.size(), tree->num_sequences());
+    for (SequenceId id : tree->AllSequenceIds()) {
+      const InfostateNode* node = tree->observation_infostate(id);
+      SPIEL_CHECK_EQ(ranges[id.id()].start, node->start_sequence_id().id());
+      SPIEL_CHECK_EQ(ranges[id.id()].end, node->end_sequence_id().id());
+    }
+
+    // The flat per-depth shapes must mirror the nodes at each depth.
+    const auto& depths = tree->flat_nodes_at_depths();
+    SPIEL_CHECK_EQ(depths.size(), tree->nodes_at_depths().size());
+    for (int depth = 0; depth <= tree->tree_height(); ++depth) {
+      SPIEL_CHECK_EQ(depths[depth].size(), tree->nodes_at_depth(depth).size());
+      for (int i = 0; i < depths[depth].size(); ++i) {
+        const InfostateNode* node = tree->nodes_at_depth(depth)[i];
+        SPIEL_CHECK_EQ(depths[depth][i].num_children, node->num_children());
+        SPIEL_CHECK_EQ(depths[depth][i].type, node->type());
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -518,4 +640,7 @@ int main(int argc, char** argv) {
   open_spiel::algorithms::TestDepthLimitedSubgames();
   open_spiel::algorithms::TestSequenceIdLabeling();
   open_spiel::algorithms::TestBestResponse();
+  open_spiel::algorithms::TestFlatStructure();
+  open_spiel::algorithms::TestVectorizedSweepKernels();
+  open_spiel::algorithms::TestParallelConstruction();
 }
@@ -17,8 +17,10 @@
 #include <algorithm>
 #include <numeric>
 
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/random/discrete_distribution.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
 #include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
@@ -49,6 +51,7 @@ void ISMCTSBot::Reset() {
   nodes_.clear();
   node_pool_.clear();
   root_samples_.clear();
+  root_node_ = nullptr;
 }
 
 ISMCTSStateKey ISMCTSBot::GetStateKey(const State& state) const {
@@ -59,7 +62,12 @@ ISMCTSStateKey ISMCTSBot::GetStateKey(const State& state) const {
   }
 }
 
+uint64_t ISMCTSBot::GetStateHashKey(const State& state) const {
+  return absl::Hash<ISMCTSStateKey>()(GetStateKey(state));
+}
+
 ActionsAndProbs ISMCTSBot::RunSearch(const State& state) {
+  const absl::Time start = collect_step_stats_ ? absl::Now() : absl::Time();
   Reset();
   SPIEL_CHECK_EQ(state.GetGame()->GetType().dynamics,
                  GameType::Dynamics::kSequential);
@@ -70,34 +78,74 @@ ActionsAndProbs ISMCTSBot::RunSearch(const State& state) {
   // do not support ResampleFromInfostate in certain specific (single action)
   // states.
   std::vector<Action> legal_actions = state.LegalActions();
-  if (legal_actions.size() == 1) return {{legal_actions[0], 1.0}};
+  if (legal_actions.size() == 1) {
+    if (collect_step_stats_) RecordStepStats(start, /*simulations=*/0);
+    return {{legal_actions[0], 1.0}};
+  }
 
   root_node_ = CreateNewNode(state);
   SPIEL_CHECK_TRUE(root_node_ != nullptr);
 
   auto root_infostate_key = GetStateKey(state);
 
+  if (num_belief_particles_ > 0) {
+    RefreshBeliefParticles(state, root_infostate_key);
+  }
+
   for (int sim = 0; sim < max_simulations_; ++sim) {
+    // A determinization only needs its infostate key validated when it is
+    // freshly resampled; clones of pooled worlds were validated on entry to
+    // the pool (as were the belief particles, at refresh), and skipping the
+    // re-derivation of the infostate string there is most of the
+    // per-simulation saving in limited-worlds mode.
+    bool fresh_sample =
+        num_belief_particles_ == 0 &&
+        (max_world_samples_ == kUnlimitedNumWorldSamples ||
+         root_samples_.size() < max_world_samples_);
     std::unique_ptr<State> sampled_root_state = SampleRootState(state);
-    SPIEL_CHECK_TRUE(root_infostate_key == GetStateKey(*sampled_root_state));
     SPIEL_CHECK_TRUE(sampled_root_state != nullptr);
+    if (fresh_sample) {
+      SPIEL_CHECK_TRUE(root_infostate_key == GetStateKey(*sampled_root_state));
+    }
     RunSimulation(sampled_root_state.get());
   }
 
+  ActionsAndProbs final_policy;
   if (allow_inconsistent_action_sets_) {
     // Filter illegals for this state.
-    std::vector<Action> legal_actions = state.LegalActions();
     ISMCTSNode temp_node = FilterIllegals(root_node_, legal_actions);
     SPIEL_CHECK_GT(temp_node.total_visits, 0);
-    return GetFinalPolicy(state, &temp_node);
+    final_policy = GetFinalPolicy(state, &temp_node);
   } else {
-    return GetFinalPolicy(state, root_node_);
+    final_policy = GetFinalPolicy(state, root_node_);
   }
+  if (collect_step_stats_) RecordStepStats(start, max_simulations_);
+  return final_policy;
+}
+
+void ISMCTSBot::RecordStepStats(absl::Time start, int simulations) {
+  last_step_stats_ = {};
+  last_step_stats_.wall_time_seconds =
+      absl::ToDoubleSeconds(absl::Now() - start);
+  last_step_stats_.simulations = simulations;
+  last_step_stats_.nodes_expanded = node_pool_.size();
 }
 
 Action ISMCTSBot::Step(const State& state) {
-  ActionsAndProbs policy = RunSearch(state);
-  return SampleAction(policy, RandomNumber()).first;
+  Action action = kInvalidAction;
+  if (opening_book_ != nullptr) {
+    absl::optional<Action> book_action =
+        opening_book_->Lookup(state.InformationStateHash());
+    if (book_action.has_value()) action = *book_action;
+  }
+  if (action == kInvalidAction) {
+    ActionsAndProbs policy = RunSearch(state);
+    action = SampleAction(policy, RandomNumber()).first;
+  }
+  // The run loops only inform the *other* bots of this action; keep our own
+  // belief particles in step with it as well.
+  AdvanceParticles(state.CurrentPlayer(), action);
+  return action;
 }
 
 ActionsAndProbs ISMCTSBot::GetPolicy(const State& state) {
@@ -108,9 +156,71 @@ std::pair<ActionsAndProbs, Action> ISMCTSBot::StepWithPolicy(
     const State& state) {
   ActionsAndProbs policy = GetPolicy(state);
   Action sampled_action = SampleAction(policy, RandomNumber()).first;
+  AdvanceParticles(state.CurrentPlayer(), sampled_action);
   return {policy, sampled_action};
 }
 
+void ISMCTSBot::InformAction(const State& state, Player player_id,
+                             Action action) {
+  AdvanceParticles(player_id, action);
+}
+
+bool ISMCTSBot::StepParticleThroughChance(State* particle) {
+  while (particle->IsChanceNode()) {
+    // The particle's own outcome, not the realized one: the realized chance
+    // action may encode hidden information (a card dealt face down), and
+    // applying it would leak that information into the belief.
+    particle->ApplyAction(
+        SampleAction(particle->ChanceOutcomes(), RandomNumber()).first);
+  }
+  return !particle->IsTerminal();
+}
+
+void ISMCTSBot::AdvanceParticles(Player player_id, Action action) {
+  if (num_belief_particles_ == 0 || belief_particles_.empty()) return;
+  int kept = 0;
+  for (auto& particle : belief_particles_) {
+    if (!StepParticleThroughChance(particle.get())) continue;
+    if (player_id == kChancePlayerId) {
+      // Chance was already advanced above with the particle's own outcome.
+      belief_particles_[kept++] = std::move(particle);
+      continue;
+    }
+    if (particle->CurrentPlayer() != player_id) continue;
+    std::vector<Action> legal_actions = particle->LegalActions();
+    if (std::find(legal_actions.begin(), legal_actions.end(), action) ==
+        legal_actions.end()) {
+      // The observed action is impossible in this world: the particle is
+      // inconsistent with reality, so it dies here.
+      continue;
+    }
+    particle->ApplyAction(action);
+    belief_particles_[kept++] = std::move(particle);
+  }
+  belief_particles_.resize(kept);
+}
+
+void ISMCTSBot::RefreshBeliefParticles(const State& state,
+                                       const ISMCTSStateKey& state_key) {
+  // Keep the particles that, after rolling through any pending chance, are
+  // indistinguishable from the current state from our perspective.
+  int kept = 0;
+  for (auto& particle : belief_particles_) {
+    if (!StepParticleThroughChance(particle.get())) continue;
+    if (GetStateKey(*particle) != state_key) continue;
+    belief_particles_[kept++] = std::move(particle);
+  }
+  belief_particles_.resize(kept);
+
+  // Refill the survivors up to the configured size with fresh resamples.
+  while (static_cast<int>(belief_particles_.size()) < num_belief_particles_) {
+    std::unique_ptr<State> fresh = ResampleFromInfostate(state);
+    SPIEL_CHECK_TRUE(fresh != nullptr);
+    SPIEL_CHECK_TRUE(GetStateKey(*fresh) == state_key);
+    belief_particles_.push_back(std::move(fresh));
+  }
+}
+
 ActionsAndProbs ISMCTSBot::GetFinalPolicy(const State& state,
                                           ISMCTSNode* node) const {
   ActionsAndProbs policy;
@@ -181,6 +291,11 @@ ActionsAndProbs ISMCTSBot::GetFinalPolicy(const State& state,
 }
 
 std::unique_ptr<State> ISMCTSBot::SampleRootState(const State& state) {
+  if (num_belief_particles_ > 0) {
+    // The refreshed particle set is the world pool; draw one uniformly.
+    int idx = absl::Uniform(rng_, 0u, belief_particles_.size());
+    return belief_particles_[idx]->Clone();
+  }
   if (max_world_samples_ == kUnlimitedNumWorldSamples) {
     return ResampleFromInfostate(state);
   } else if (root_samples_.size() < max_world_samples_) {
@@ -207,7 +322,7 @@ std::unique_ptr<State> ISMCTSBot::ResampleFromInfostate(const State& state) {
 }
 
 ISMCTSNode* ISMCTSBot::CreateNewNode(const State& state) {
-  auto infostate_key = GetStateKey(state);
+  uint64_t infostate_key = GetStateHashKey(state);
   node_pool_.push_back(std::unique_ptr<ISMCTSNode>(new ISMCTSNode));
   ISMCTSNode* node = node_pool_.back().get();
   nodes_[infostate_key] = node;
@@ -216,7 +331,7 @@ ISMCTSNode* ISMCTSBot::CreateNewNode(const State& state) {
 }
 
 ISMCTSNode* ISMCTSBot::LookupNode(const State& state) {
-  auto iter = nodes_.find(GetStateKey(state));
+  auto iter = nodes_.find(GetStateHashKey(state));
   if (iter == nodes_.end()) {
     return nullptr;
   } else {
@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_IS_MCTS_H_
 #define OPEN_SPIEL_ALGORITHMS_IS_MCTS_H_
 
+#include <cstdint>
 #include <memory>
 #include <random>
 #include <string>
@@ -22,6 +23,7 @@
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/algorithms/mcts.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_bots.h"
@@ -38,6 +40,13 @@ inline constexpr int kUnlimitedNumWorldSamples = -1;
 // The key identifying a node contains the InformationStateString or
 // ObservationString, as well as the player id, because in some games the
 // observation string can be the same for different players.
+//
+// The node store itself is keyed by the 64-bit hash of this key rather than
+// the key: probes compare 8 bytes instead of full strings and the store keeps
+// no string per node. A hash collision silently merges two infostates'
+// statistics; with the per-decision tree sizes IS-MCTS builds (one node per
+// simulation at most, and the tree is discarded every Step) the chance of
+// that is negligible.
 using ISMCTSStateKey = std::pair<Player, std::string>;
 
 enum class ISMCTSFinalPolicyType {
@@ -95,17 +104,51 @@ class ISMCTSBot : public Bot {
 
   ActionsAndProbs RunSearch(const State& state);
 
-  // Bot maintains no history, so these are empty.
-  void Restart() override {}
-  void RestartAt(const State& state) override {}
+  // Without persistent beliefs the bot maintains no history, so these only
+  // have to drop the particle set.
+  void Restart() override { belief_particles_.clear(); }
+  void RestartAt(const State& state) override { belief_particles_.clear(); }
+
+  // Advances the persistent belief particles by an observed action (no-op
+  // when persistent beliefs are disabled; see SetPersistentBeliefs).
+  void InformAction(const State& state, Player player_id,
+                    Action action) override;
+
   // Set a custom resampling function.
   void SetResampler(InfostateResampler cb) { resampler_cb_ = cb; }
 
+  // Enables a persistent belief state: a set of `num_particles` determinized
+  // worlds carried across decisions instead of resampling every world
+  // independently at each Step. Particles are advanced by the opponent and
+  // chance actions reported through InformAction and by the bot's own steps;
+  // chance is advanced by sampling each particle's own outcomes, so hidden
+  // deals stay hidden. At the next decision, particles inconsistent with the
+  // bot's information state are dropped and replaced by fresh resamples, and
+  // the search draws its root worlds from the surviving particles — which
+  // concentrate on worlds consistent with everything observed so far (e.g.
+  // cards an opponent was seen picking up), where ResampleFromInfostate
+  // alone is typically uniform over the unseen cards. Pass 0 to disable and
+  // drop the particles. When enabled, the particle set replaces the
+  // max_world_samples root pool.
+  void SetPersistentBeliefs(int num_particles) {
+    SPIEL_CHECK_GE(num_particles, 0);
+    num_belief_particles_ = num_particles;
+    if (num_particles == 0) belief_particles_.clear();
+  }
+
+  // Attaches a precomputed opening book (shared across bots). Step answers
+  // from the book — a hash-map probe on the state's infostate hash — before
+  // falling back to search; pass nullptr to detach.
+  void SetOpeningBook(std::shared_ptr<const OpeningBook> book) {
+    opening_book_ = std::move(book);
+  }
+
  private:
   void Reset();
   double RandomNumber();
 
   ISMCTSStateKey GetStateKey(const State& state) const;
+  uint64_t GetStateHashKey(const State& state) const;
   std::unique_ptr<State> SampleRootState(const State& state);
   // Dispatch to either domain-specific implementation,
   // or a specially supplied one via SetResampler()
@@ -133,13 +176,37 @@ class ISMCTSBot : public Bot {
   // Run a simulation, returning the player returns.
   std::vector<double> RunSimulation(State* state);
 
+  // Rolls a belief particle forward through any pending chance nodes by
+  // sampling its own outcomes. Returns false if the particle reached a
+  // terminal state.
+  bool StepParticleThroughChance(State* particle);
+
+  // Applies an observed action by `player_id` to every particle, dropping
+  // particles in which the action is impossible. Shared by InformAction and
+  // the bot's own Step.
+  void AdvanceParticles(Player player_id, Action action);
+
+  // Brings the particle set in line with the current decision: rolls
+  // particles through pending chance, drops the ones inconsistent with the
+  // state's infostate key and refills the set to num_belief_particles_ with
+  // fresh resamples. Called at the top of RunSearch when beliefs are on.
+  void RefreshBeliefParticles(const State& state,
+                              const ISMCTSStateKey& state_key);
+
+  // Fills last_step_stats_ after a search that began at `start` and ran
+  // `simulations` simulations. Called from RunSearch when stats collection
+  // is enabled.
+  void RecordStepStats(absl::Time start, int simulations);
+
   std::mt19937 rng_;
   std::shared_ptr<Evaluator> evaluator_;
-  absl::flat_hash_map<ISMCTSStateKey, ISMCTSNode*> nodes_;
+  absl::flat_hash_map<uint64_t, ISMCTSNode*> nodes_;
   std::vector<std::unique_ptr<ISMCTSNode>> node_pool_;
 
   // If the number of sampled world state is restricted, this list is used to
-  // store the sampled states.
+  // store the sampled states. Each determinization's infostate key is
+  // validated once when it enters the pool; simulations replaying a pooled
+  // world just clone it, without re-deriving the infostate string.
   std::vector<std::unique_ptr<State>> root_samples_;
 
   const double uct_c_;
@@ -148,8 +215,14 @@ class ISMCTSBot : public Bot {
   const ISMCTSFinalPolicyType final_policy_type_;
   const bool use_observation_string_;
   const bool allow_inconsistent_action_sets_;
-  ISMCTSNode* root_node_;
+  ISMCTSNode* root_node_ = nullptr;
   InfostateResampler resampler_cb_;
+  // Persistent belief particles (see SetPersistentBeliefs); empty when
+  // disabled. Unlike root_samples_, these survive across Steps.
+  int num_belief_particles_ = 0;
+  std::vector<std::unique_ptr<State>> belief_particles_;
+  // Optional opening book probed at the top of Step.
+  std::shared_ptr<const OpeningBook> opening_book_;
 };
 
 }  // namespace algorithms
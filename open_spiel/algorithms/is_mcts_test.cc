@@ -98,6 +98,81 @@ void ISMCTS_LeducObservationTest() {
   PlayGame(*game, bot.get(), &rng);
 }
 
+void ISMCTS_StepStatsTest() {
+  std::mt19937 rng(kSeed);
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  auto evaluator =
+      std::make_shared<algorithms::RandomRolloutEvaluator>(1, kSeed);
+  const int max_simulations = 100;
+  algorithms::ISMCTSBot bot(kSeed, evaluator, 5.0, max_simulations);
+
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (state->IsChanceNode()) {
+    state->ApplyAction(
+        SampleAction(state->ChanceOutcomes(), absl::Uniform(rng, 0.0, 1.0))
+            .first);
+  }
+
+  // Collection is off by default: the struct stays zero-initialized.
+  bot.Step(*state);
+  SPIEL_CHECK_EQ(bot.GetLastStepStats().simulations, 0);
+  SPIEL_CHECK_EQ(bot.GetLastStepStats().nodes_expanded, 0);
+
+  bot.SetCollectStepStats(true);
+  bot.Step(*state);
+  const BotStepStats& stats = bot.GetLastStepStats();
+  SPIEL_CHECK_GT(stats.wall_time_seconds, 0.0);
+  SPIEL_CHECK_EQ(stats.simulations, max_simulations);
+  // At most one node is created per simulation, plus the root.
+  SPIEL_CHECK_GT(stats.nodes_expanded, 0);
+  SPIEL_CHECK_LE(stats.nodes_expanded, max_simulations + 1);
+}
+
+void ISMCTS_PersistentBeliefsTest() {
+  std::mt19937 rng(kSeed);
+  std::shared_ptr<const Game> game = LoadGame("leduc_poker");
+  auto evaluator =
+      std::make_shared<algorithms::RandomRolloutEvaluator>(1, kSeed);
+
+  std::vector<std::unique_ptr<algorithms::ISMCTSBot>> bots;
+  for (Player p = 0; p < game->NumPlayers(); ++p) {
+    bots.push_back(std::make_unique<algorithms::ISMCTSBot>(
+        kSeed + p, evaluator, 5.0, 200, algorithms::kUnlimitedNumWorldSamples,
+        algorithms::ISMCTSFinalPolicyType::kNormalizedVisitCount, false,
+        false));
+    bots.back()->SetPersistentBeliefs(16);
+  }
+
+  // Play a couple of games back to back, mirroring the evaluate_bots run
+  // loop: every bot is informed of chance outcomes and of the other players'
+  // actions, and the particles must stay consistent across decisions and
+  // survive Restart() between games.
+  for (int game_num = 0; game_num < 2; ++game_num) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    while (!state->IsTerminal()) {
+      Action action;
+      if (state->IsChanceNode()) {
+        action =
+            SampleAction(state->ChanceOutcomes(), absl::Uniform(rng, 0.0, 1.0))
+                .first;
+        for (auto& bot : bots) bot->InformAction(*state, kChancePlayerId,
+                                                 action);
+      } else {
+        Player current = state->CurrentPlayer();
+        action = bots[current]->Step(*state);
+        for (Player p = 0; p < game->NumPlayers(); ++p) {
+          if (p != current) bots[p]->InformAction(*state, current, action);
+        }
+      }
+      state->ApplyAction(action);
+    }
+    std::cout << "Persistent beliefs game " << game_num
+              << " returns: " << absl::StrJoin(state->Returns(), " ")
+              << std::endl;
+    for (auto& bot : bots) bot->Restart();
+  }
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -105,4 +180,6 @@ int main(int argc, char** argv) {
   open_spiel::ISMCTS_BasicPlayGameTest_Kuhn();
   open_spiel::ISMCTS_BasicPlayGameTest_Leduc();
   open_spiel::ISMCTS_LeducObservationTest();
+  open_spiel::ISMCTS_StepStatsTest();
+  open_spiel::ISMCTS_PersistentBeliefsTest();
 }
@@ -0,0 +1,212 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/match_archive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "open_spiel/abseil-cpp/absl/strings/ascii.h"
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+struct FileHeader {
+  uint64_t magic;
+  int64_t game_string_size;
+};
+
+struct Trailer {
+  int64_t index_offset;
+  int64_t num_matches;
+  uint64_t magic;
+};
+
+constexpr uint64_t kMatchArchiveMagic = 0x4f53'4d41'5443'4831ULL;  // OSMATCH1
+
+// Encoded matches accumulate in memory up to this size before being written
+// out, so small matches do not cost one syscall each.
+constexpr size_t kWriteBufferSize = 1 << 20;
+
+template <typename T>
+absl::string_view StructBytes(const T& value) {
+  return absl::string_view(reinterpret_cast<const char*>(&value),
+                           sizeof(value));
+}
+
+// Varint codec, as in trajectory_io.cc.
+void AppendVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+uint64_t ReadVarint(const char** p, const char* end) {
+  uint64_t value = 0;
+  int shift = 0;
+  for (;;) {
+    SPIEL_CHECK_TRUE(*p < end);
+    const uint8_t byte = static_cast<uint8_t>(*(*p)++);
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) return value;
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+MatchArchiveWriter::MatchArchiveWriter(const std::string& filename,
+                                       const Game& game)
+    : fd_(filename, "wb") {
+  const std::string game_string = game.Serialize();
+  FileHeader header = {kMatchArchiveMagic,
+                       static_cast<int64_t>(game_string.size())};
+  SPIEL_CHECK_TRUE(fd_.Write(StructBytes(header)));
+  SPIEL_CHECK_TRUE(fd_.Write(game_string));
+  next_offset_ = static_cast<int64_t>(sizeof(header) + game_string.size());
+}
+
+MatchArchiveWriter::~MatchArchiveWriter() {
+  if (!buffer_.empty()) {
+    SPIEL_CHECK_TRUE(fd_.Write(buffer_));
+    buffer_.clear();
+  }
+  Trailer trailer;
+  trailer.index_offset = next_offset_;
+  trailer.num_matches = static_cast<int64_t>(index_.size());
+  trailer.magic = kMatchArchiveMagic;
+  SPIEL_CHECK_TRUE(fd_.Write(absl::string_view(
+      reinterpret_cast<const char*>(index_.data()),
+      index_.size() * sizeof(int64_t))));
+  SPIEL_CHECK_TRUE(fd_.Write(StructBytes(trailer)));
+}
+
+void MatchArchiveWriter::Add(absl::Span<const Action> history) {
+  index_.push_back(next_offset_);
+  const size_t before = buffer_.size();
+  AppendVarint(history.size(), &buffer_);
+  for (const Action action : history) {
+    SPIEL_CHECK_GE(action, 0);
+    AppendVarint(static_cast<uint64_t>(action), &buffer_);
+  }
+  next_offset_ += static_cast<int64_t>(buffer_.size() - before);
+  if (buffer_.size() >= kWriteBufferSize) {
+    SPIEL_CHECK_TRUE(fd_.Write(buffer_));
+    buffer_.clear();
+  }
+}
+
+void MatchArchiveWriter::AddHistoryString(absl::string_view history_string) {
+  std::vector<Action> actions;
+  for (absl::string_view token :
+       absl::StrSplit(history_string, ',', absl::SkipWhitespace())) {
+    token = absl::StripAsciiWhitespace(token);
+    Action action;
+    SPIEL_CHECK_TRUE(absl::SimpleAtoi(token, &action));
+    actions.push_back(action);
+  }
+  Add(actions);
+}
+
+MatchArchiveReader::MatchArchiveReader(const std::string& filename)
+    : mapping_(filename) {
+  SPIEL_CHECK_GE(mapping_.size(),
+                 static_cast<int64_t>(sizeof(FileHeader) + sizeof(Trailer)));
+  const char* data = mapping_.data();
+
+  FileHeader header;
+  std::memcpy(&header, data, sizeof(header));
+  SPIEL_CHECK_EQ(header.magic, kMatchArchiveMagic);
+  SPIEL_CHECK_GE(header.game_string_size, 0);
+  game_ = DeserializeGame(std::string(data + sizeof(header),
+                                      header.game_string_size));
+
+  Trailer trailer;
+  std::memcpy(&trailer, data + mapping_.size() - sizeof(trailer),
+              sizeof(trailer));
+  SPIEL_CHECK_EQ(trailer.magic, kMatchArchiveMagic);
+  SPIEL_CHECK_GE(trailer.num_matches, 0);
+  SPIEL_CHECK_EQ(trailer.index_offset +
+                     trailer.num_matches * static_cast<int64_t>(sizeof(
+                         int64_t)) +
+                     static_cast<int64_t>(sizeof(Trailer)),
+                 mapping_.size());
+  matches_end_ = trailer.index_offset;
+  index_.resize(trailer.num_matches);
+  std::memcpy(index_.data(), data + trailer.index_offset,
+              trailer.num_matches * sizeof(int64_t));
+}
+
+std::vector<Action> MatchArchiveReader::Actions(int64_t match) const {
+  SPIEL_CHECK_GE(match, 0);
+  SPIEL_CHECK_LT(match, num_matches());
+  const char* p = mapping_.data() + index_[match];
+  const char* end = mapping_.data() + matches_end_;
+  const uint64_t num_actions = ReadVarint(&p, end);
+  std::vector<Action> actions;
+  actions.reserve(num_actions);
+  for (uint64_t i = 0; i < num_actions; ++i) {
+    actions.push_back(static_cast<Action>(ReadVarint(&p, end)));
+  }
+  return actions;
+}
+
+std::unique_ptr<State> MatchArchiveReader::Replay(int64_t match) const {
+  SPIEL_CHECK_GE(match, 0);
+  SPIEL_CHECK_LT(match, num_matches());
+  const char* p = mapping_.data() + index_[match];
+  const char* end = mapping_.data() + matches_end_;
+  const uint64_t num_actions = ReadVarint(&p, end);
+  std::unique_ptr<State> state = game_->NewInitialState();
+  for (uint64_t i = 0; i < num_actions; ++i) {
+    state->ApplyAction(static_cast<Action>(ReadVarint(&p, end)));
+  }
+  return state;
+}
+
+void MatchArchiveReader::ReplayAll(
+    const std::function<void(int64_t, const State&)>& fn,
+    int num_threads) const {
+  SPIEL_CHECK_GE(num_threads, 1);
+  const int64_t num = num_matches();
+  if (num_threads == 1 || num < 2) {
+    for (int64_t match = 0; match < num; ++match) fn(match, *Replay(match));
+    return;
+  }
+  const int num_workers =
+      static_cast<int>(std::min<int64_t>(num_threads, num));
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    workers.emplace_back([this, w, num_workers, num, &fn]() {
+      const int64_t begin = num * w / num_workers;
+      const int64_t end = num * (w + 1) / num_workers;
+      for (int64_t match = begin; match < end; ++match) {
+        fn(match, *Replay(match));
+      }
+    });
+  }
+  for (Thread& worker : workers) worker.join();
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
@@ -0,0 +1,126 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_MATCH_ARCHIVE_H_
+#define OPEN_SPIEL_ALGORITHMS_MATCH_ARCHIVE_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// A packed on-disk archive of completed matches, built for bulk replay.
+// Each match is stored as a varint-encoded action stream (chance and player
+// actions alike, in history order), far denser than the HistoryString()
+// text it replaces and decodable without parsing. The header carries the
+// game's canonical serialization (Game::Serialize), so an archive is
+// self-describing: the reader reloads the exact game through
+// DeserializeGame and replays streams straight into states. A per-match
+// offset index in the footer lets readers seek to any match and partition
+// an archive across replay threads.
+//
+// The byte layout is host-endian, like the other binary stores in this
+// directory: files are not portable across endianness.
+//
+// File layout:
+//   FileHeader, then the game's serialization
+//   matches: varint action count followed by that many varint actions
+//   index: num_matches int64 match offsets
+//   Trailer
+// The reader finds the index through the fixed-size trailer at the end of
+// the file.
+class MatchArchiveWriter {
+ public:
+  // Creates (truncates) `filename` and writes the header for `game`. Every
+  // match added afterwards must come from this game.
+  MatchArchiveWriter(const std::string& filename, const Game& game);
+
+  // Writes the index footer and closes the file.
+  ~MatchArchiveWriter();
+
+  MatchArchiveWriter(const MatchArchiveWriter&) = delete;
+  MatchArchiveWriter& operator=(const MatchArchiveWriter&) = delete;
+
+  // Appends one completed match, given as its full history in order,
+  // including chance outcomes (i.e. State::History()).
+  void Add(absl::Span<const Action> history);
+
+  // Convenience overload for a (typically terminal) state.
+  void Add(const State& state) { Add(state.History()); }
+
+  // Parses a State::HistoryString() ("a0, a1, ...") and appends it; the
+  // migration path for matches stored as text.
+  void AddHistoryString(absl::string_view history_string);
+
+  int64_t num_matches() const { return static_cast<int64_t>(index_.size()); }
+
+ private:
+  file::File fd_;
+  std::string buffer_;       // Encoded matches not yet written to the file.
+  int64_t next_offset_ = 0;  // File offset the next match will start at.
+  std::vector<int64_t> index_;
+};
+
+// Reader for files produced by MatchArchiveWriter. The whole file is mapped
+// read-only through file::MappedFile, so opening is O(1) and matches are
+// faulted in on demand by the page cache; decoding a match touches only its
+// own bytes.
+class MatchArchiveReader {
+ public:
+  explicit MatchArchiveReader(const std::string& filename);
+
+  MatchArchiveReader(const MatchArchiveReader&) = delete;
+  MatchArchiveReader& operator=(const MatchArchiveReader&) = delete;
+
+  // The game the archive was recorded from, reloaded from the header.
+  const std::shared_ptr<const Game>& game() const { return game_; }
+
+  int64_t num_matches() const { return static_cast<int64_t>(index_.size()); }
+
+  // Decodes match `match`'s action stream.
+  std::vector<Action> Actions(int64_t match) const;
+
+  // Replays match `match` from the initial state and returns the resulting
+  // (typically terminal) state. Actions are applied as they are decoded;
+  // nothing is materialized in between.
+  std::unique_ptr<State> Replay(int64_t match) const;
+
+  // Replays every match, calling `fn(match_index, state)` with each match's
+  // final state. Matches are split into contiguous slices across
+  // `num_threads` workers, so each worker streams forward through its part
+  // of the file; `fn` is invoked concurrently from the workers and must be
+  // thread-safe. Within one worker, indices arrive in increasing order.
+  void ReplayAll(const std::function<void(int64_t, const State&)>& fn,
+                 int num_threads = 1) const;
+
+ private:
+  file::MappedFile mapping_;
+  std::shared_ptr<const Game> game_;
+  std::vector<int64_t> index_;
+  int64_t matches_end_ = 0;  // One past the last match's bytes.
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_MATCH_ARCHIVE_H_
@@ -14,12 +14,17 @@
 
 #include "open_spiel/algorithms/matrix_game_utils.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "open_spiel/algorithms/deterministic_policy.h"
 #include "open_spiel/algorithms/expected_returns.h"
 #include "open_spiel/simultaneous_move_game.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -43,87 +48,137 @@ std::shared_ptr<const MatrixGame> LoadMatrixGame(const std::string& name) {
   return std::static_pointer_cast<const MatrixGame>(game);
 }
 
-std::shared_ptr<const MatrixGame> AsMatrixGame(const Game* game) {
+std::shared_ptr<const MatrixGame> AsMatrixGame(const Game* game,
+                                               int num_threads) {
   const NormalFormGame* nfg = dynamic_cast<const NormalFormGame*>(game);
   SPIEL_CHECK_TRUE(nfg != nullptr);
-  return AsMatrixGame(nfg);
+  return AsMatrixGame(nfg, num_threads);
 }
 
-std::shared_ptr<const MatrixGame> AsMatrixGame(const NormalFormGame* game) {
+std::shared_ptr<const MatrixGame> AsMatrixGame(const NormalFormGame* game,
+                                               int num_threads) {
   SPIEL_CHECK_EQ(game->NumPlayers(), 2);
+  SPIEL_CHECK_GE(num_threads, 1);
   std::unique_ptr<State> initial_state = game->NewInitialState();
   std::vector<std::vector<Action>> legal_actions = {
       initial_state->LegalActions(0), initial_state->LegalActions(1)};
 
   std::vector<std::string> row_names;
   std::vector<std::string> col_names;
-  std::vector<double> row_utils;
-  std::vector<double> col_utils;
   int num_rows = legal_actions[0].size();
   int num_cols = legal_actions[1].size();
+  for (Action row_action : legal_actions[0]) {
+    row_names.push_back(initial_state->ActionToString(0, row_action));
+  }
+  for (Action col_action : legal_actions[1]) {
+    col_names.push_back(initial_state->ActionToString(1, col_action));
+  }
+  std::vector<double> row_utils(num_rows * num_cols);
+  std::vector<double> col_utils(num_rows * num_cols);
 
   GameType type = game->GetType();
   type.min_num_players = 2;
   type.max_num_players = 2;
 
-  for (int r = 0; r < num_rows; ++r) {
-    Action row_action = legal_actions[0][r];
-    row_names.push_back(initial_state->ActionToString(0, row_action));
-
-    for (int c = 0; c < num_cols; ++c) {
-      Action col_action = legal_actions[1][c];
-      if (col_names.size() < num_cols) {
-        col_names.push_back(initial_state->ActionToString(1, col_action));
+  // Each worker evaluates a stride of rows against its own copy of the
+  // initial state, writing into disjoint slices of the utility arrays.
+  const int num_workers = std::min(num_threads, num_rows);
+  auto fill_rows = [&legal_actions, &row_utils, &col_utils, num_cols,
+                    num_rows](const State& base, int first_row, int stride) {
+    for (int r = first_row; r < num_rows; r += stride) {
+      for (int c = 0; c < num_cols; ++c) {
+        std::unique_ptr<State> clone = base.Clone();
+        clone->ApplyActions({legal_actions[0][r], legal_actions[1][c]});
+        SPIEL_CHECK_TRUE(clone->IsTerminal());
+        std::vector<double> returns = clone->Returns();
+        SPIEL_CHECK_EQ(returns.size(), 2);
+        row_utils[r * num_cols + c] = returns[0];
+        col_utils[r * num_cols + c] = returns[1];
       }
-
-      std::unique_ptr<State> clone = initial_state->Clone();
-      clone->ApplyActions({row_action, col_action});
-      SPIEL_CHECK_TRUE(clone->IsTerminal());
-      std::vector<double> returns = clone->Returns();
-      SPIEL_CHECK_EQ(returns.size(), 2);
-
-      row_utils.push_back(returns[0]);
-      col_utils.push_back(returns[1]);
     }
+  };
+  if (num_workers <= 1) {
+    fill_rows(*initial_state, 0, 1);
+  } else {
+    std::vector<std::unique_ptr<State>> worker_states;
+    for (int t = 0; t < num_workers; ++t) {
+      worker_states.push_back(initial_state->Clone());
+    }
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int t = 0; t < num_workers; ++t) {
+      workers.emplace_back([&fill_rows, &worker_states, t, num_workers]() {
+        fill_rows(*worker_states[t], t, num_workers);
+      });
+    }
+    for (Thread& worker : workers) worker.join();
   }
 
   return std::shared_ptr<MatrixGame>(
       new MatrixGame(type, {}, row_names, col_names, row_utils, col_utils));
 }
 
-std::shared_ptr<const MatrixGame> ExtensiveToMatrixGame(const Game& game) {
+std::shared_ptr<const MatrixGame> ExtensiveToMatrixGame(const Game& game,
+                                                        int num_threads) {
   SPIEL_CHECK_EQ(game.NumPlayers(), 2);
+  SPIEL_CHECK_GE(num_threads, 1);
 
   std::vector<std::string> row_names;
   std::vector<std::string> col_names;
-  std::vector<std::vector<double>> row_player_utils;
-  std::vector<std::vector<double>> col_player_utils;
 
   GameType type = game.GetType();
 
-  std::vector<DeterministicTabularPolicy> policies = {
-      DeterministicTabularPolicy(game, 0), DeterministicTabularPolicy(game, 1)};
-
-  bool first_row = true;
+  // Enumerate the deterministic policies for both players up front. The
+  // copies are cheap relative to the payoff evaluations, and having them all
+  // materialized lets any cell (r, c) be evaluated independently.
+  std::vector<DeterministicTabularPolicy> row_policies;
+  std::vector<DeterministicTabularPolicy> col_policies;
+  DeterministicTabularPolicy row_enumerator(game, 0);
   do {
-    policies[1].ResetDefaultPolicy();
-    row_names.push_back(policies[0].ToString(" --- "));
-    std::vector<double> row_utils;
-    std::vector<double> col_utils;
-    do {
-      if (first_row) {
-        col_names.push_back(policies[1].ToString(" --- "));
-      }
+    row_names.push_back(row_enumerator.ToString(" --- "));
+    row_policies.push_back(row_enumerator);
+  } while (row_enumerator.NextPolicy());
+  DeterministicTabularPolicy col_enumerator(game, 1);
+  do {
+    col_names.push_back(col_enumerator.ToString(" --- "));
+    col_policies.push_back(col_enumerator);
+  } while (col_enumerator.NextPolicy());
+
+  const int num_rows = row_policies.size();
+  const int num_cols = col_policies.size();
+  std::vector<std::vector<double>> row_player_utils(
+      num_rows, std::vector<double>(num_cols));
+  std::vector<std::vector<double>> col_player_utils(
+      num_rows, std::vector<double>(num_cols));
+
+  // Every cell is one independent ExpectedReturns tree walk; workers take a
+  // stride of rows each, with one root state per row so no State is shared
+  // across threads.
+  const int num_workers = std::min(num_threads, num_rows);
+  auto fill_rows = [&game, &row_policies, &col_policies, &row_player_utils,
+                    &col_player_utils, num_rows,
+                    num_cols](int first_row, int stride) {
+    for (int r = first_row; r < num_rows; r += stride) {
       std::unique_ptr<State> state = game.NewInitialState();
-      std::vector<double> returns =
-          ExpectedReturns(*state, {&policies[0], &policies[1]}, -1);
-      row_utils.push_back(returns[0]);
-      col_utils.push_back(returns[1]);
-    } while (policies[1].NextPolicy());
-    first_row = false;
-    row_player_utils.push_back(row_utils);
-    col_player_utils.push_back(col_utils);
-  } while (policies[0].NextPolicy());
+      for (int c = 0; c < num_cols; ++c) {
+        std::vector<double> returns =
+            ExpectedReturns(*state, {&row_policies[r], &col_policies[c]}, -1);
+        row_player_utils[r][c] = returns[0];
+        col_player_utils[r][c] = returns[1];
+      }
+    }
+  };
+  if (num_workers <= 1) {
+    fill_rows(0, 1);
+  } else {
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int t = 0; t < num_workers; ++t) {
+      workers.emplace_back(
+          [&fill_rows, t, num_workers]() { fill_rows(t, num_workers); });
+    }
+    for (Thread& worker : workers) worker.join();
+  }
 
   return matrix_game::CreateMatrixGame(type.short_name, type.long_name,
                                        row_names, col_names, row_player_utils,
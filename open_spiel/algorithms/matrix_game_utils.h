@@ -32,10 +32,13 @@ std::shared_ptr<const matrix_game::MatrixGame> LoadMatrixGame(
 // Clones a two-player normal-form game and returns it as a MatrixGame. These
 // functions exist because some implementations are more general than
 // two-player, but there are tools designed specifically to work with matrix
-// games, and hence require conversion.
+// games, and hence require conversion. With num_threads > 1 the payoff cells
+// are evaluated on worker threads, one row stride per worker; the resulting
+// game is identical to the serial conversion.
 std::shared_ptr<const matrix_game::MatrixGame> AsMatrixGame(
-    const NormalFormGame* game);
-std::shared_ptr<const matrix_game::MatrixGame> AsMatrixGame(const Game* game);
+    const NormalFormGame* game, int num_threads = 1);
+std::shared_ptr<const matrix_game::MatrixGame> AsMatrixGame(
+    const Game* game, int num_threads = 1);
 
 // Creates a two-player extensive-form game (EFG)'s equivalent matrix game.
 //
@@ -52,8 +55,13 @@ std::shared_ptr<const matrix_game::MatrixGame> AsMatrixGame(const Game* game);
 //
 // Hence, this method should only be used for  small games! For example, Kuhn
 // poker has 64 deterministic policies, resulting in a 64-by-64 matrix.
+//
+// With num_threads > 1 the policies are enumerated up front and the payoff
+// cells (one ExpectedReturns tree walk each) are evaluated on worker
+// threads, one row stride per worker. The cells are independent, so the
+// resulting game is identical to the serial conversion.
 std::shared_ptr<const matrix_game::MatrixGame> ExtensiveToMatrixGame(
-    const Game& game);
+    const Game& game, int num_threads = 1);
 
 }  // namespace algorithms
 }  // namespace open_spiel
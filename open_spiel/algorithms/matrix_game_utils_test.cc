@@ -46,6 +46,44 @@ void ExtensiveToMatrixGameTest() {
   SPIEL_CHECK_EQ(kuhn_matrix_game->NumCols(), 64);
 }
 
+void ParallelConversionTest() {
+  // Payoff cells are independent, so the threaded conversions must match the
+  // serial ones exactly.
+  std::shared_ptr<const Game> blotto = LoadGame("blotto");
+  std::shared_ptr<const matrix_game::MatrixGame> serial_blotto =
+      AsMatrixGame(blotto.get());
+  std::shared_ptr<const matrix_game::MatrixGame> parallel_blotto =
+      AsMatrixGame(blotto.get(), /*num_threads=*/3);
+  SPIEL_CHECK_EQ(serial_blotto->NumRows(), parallel_blotto->NumRows());
+  SPIEL_CHECK_EQ(serial_blotto->NumCols(), parallel_blotto->NumCols());
+  for (int r = 0; r < serial_blotto->NumRows(); ++r) {
+    for (int c = 0; c < serial_blotto->NumCols(); ++c) {
+      SPIEL_CHECK_EQ(serial_blotto->PlayerUtility(Player{0}, r, c),
+                     parallel_blotto->PlayerUtility(Player{0}, r, c));
+      SPIEL_CHECK_EQ(serial_blotto->PlayerUtility(Player{1}, r, c),
+                     parallel_blotto->PlayerUtility(Player{1}, r, c));
+    }
+  }
+
+  std::shared_ptr<const Game> kuhn_game = LoadGame("kuhn_poker");
+  std::shared_ptr<const matrix_game::MatrixGame> serial_kuhn =
+      ExtensiveToMatrixGame(*kuhn_game);
+  std::shared_ptr<const matrix_game::MatrixGame> parallel_kuhn =
+      ExtensiveToMatrixGame(*kuhn_game, /*num_threads=*/3);
+  SPIEL_CHECK_EQ(serial_kuhn->NumRows(), parallel_kuhn->NumRows());
+  SPIEL_CHECK_EQ(serial_kuhn->NumCols(), parallel_kuhn->NumCols());
+  for (int r = 0; r < serial_kuhn->NumRows(); ++r) {
+    SPIEL_CHECK_EQ(serial_kuhn->RowActionName(r),
+                   parallel_kuhn->RowActionName(r));
+    for (int c = 0; c < serial_kuhn->NumCols(); ++c) {
+      SPIEL_CHECK_EQ(serial_kuhn->PlayerUtility(Player{0}, r, c),
+                     parallel_kuhn->PlayerUtility(Player{0}, r, c));
+      SPIEL_CHECK_EQ(serial_kuhn->PlayerUtility(Player{1}, r, c),
+                     parallel_kuhn->PlayerUtility(Player{1}, r, c));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -53,4 +91,5 @@ void ExtensiveToMatrixGameTest() {
 int main(int argc, char** argv) {
   open_spiel::algorithms::ConvertToMatrixGameTest();
   open_spiel::algorithms::ExtensiveToMatrixGameTest();
+  open_spiel::algorithms::ParallelConversionTest();
 }
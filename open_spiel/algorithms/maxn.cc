@@ -14,6 +14,8 @@
 
 #include "open_spiel/algorithms/maxn.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -23,6 +25,7 @@
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -31,7 +34,7 @@ namespace {
 std::vector<double> _maxn(
     const State* state, int depth,
     std::function<double(const State&, Player player)> value_function,
-    Action* best_action) {
+    Action* best_action, TranspositionTable* transposition_table) {
   const int num_players = state->NumPlayers();
 
   if (state->IsTerminal()) {
@@ -44,11 +47,31 @@ std::vector<double> _maxn(
         "Try increasing depth or provide a value_function.");
   }
 
+  // Max^n has no pruning window, so cached vectors are always exact. Only
+  // interior decision nodes go through the table: the root must run its full
+  // loop so that best_action is filled in, and chance nodes are cheap
+  // pass-throughs.
+  const bool use_table = transposition_table != nullptr &&
+                         best_action == nullptr && !state->IsChanceNode();
+  uint64_t key = 0;
+  if (use_table) {
+    key = TranspositionTable::KeyFor(*state);
+    TranspositionTable::Entry entry;
+    if (transposition_table->Lookup(key, &entry) && entry.depth >= depth &&
+        !entry.values.empty()) {
+      return std::move(entry.values);
+    }
+  }
+
   if (depth == 0) {
     std::vector<double> values(num_players);
     for (Player p = 0; p < num_players; ++p) {
       values[p] = value_function(*state, p);
     }
+    if (use_table) {
+      transposition_table->Store(
+          key, {/*depth=*/0, TranspositionTable::kExact, 0, values});
+    }
     return values;
   }
 
@@ -59,7 +82,7 @@ std::vector<double> _maxn(
       std::unique_ptr<State> child_state = state->Child(actionprob.first);
       std::vector<double> child_values =
           _maxn(child_state.get(), depth, value_function,
-                /*best_action=*/nullptr);
+                /*best_action=*/nullptr, transposition_table);
       for (Player p = 0; p < num_players; ++p) {
         values[p] += actionprob.second * child_values[p];
       }
@@ -74,7 +97,7 @@ std::vector<double> _maxn(
       std::vector<double> child_values =
           _maxn(child_state.get(),
                 /*depth=*/depth - 1, value_function,
-                /*best_action=*/nullptr);
+                /*best_action=*/nullptr, transposition_table);
 
       if (child_values[player] > value) {
         value = child_values[player];
@@ -84,6 +107,10 @@ std::vector<double> _maxn(
         }
       }
     }
+    if (use_table) {
+      transposition_table->Store(
+          key, {/*depth=*/depth, TranspositionTable::kExact, 0, values});
+    }
     return values;
   }
 }
@@ -92,7 +119,7 @@ std::vector<double> _maxn(
 std::pair<std::vector<double>, Action> MaxNSearch(
     const Game& game, const State* state,
     std::function<double(const State&, Player player)> value_function,
-    int depth_limit) {
+    int depth_limit, TranspositionTable* transposition_table) {
   GameType game_info = game.GetType();
   SPIEL_CHECK_TRUE(
       game_info.chance_mode == GameType::ChanceMode::kDeterministic ||
@@ -111,11 +138,84 @@ std::pair<std::vector<double>, Action> MaxNSearch(
   SPIEL_CHECK_FALSE(search_root->IsChanceNode());
 
   Action best_action = kInvalidAction;
-  std::vector<double> values = _maxn(search_root.get(), /*depth=*/depth_limit,
-                                     value_function, &best_action);
+  std::vector<double> values =
+      _maxn(search_root.get(), /*depth=*/depth_limit, value_function,
+            &best_action, transposition_table);
 
   return {values, best_action};
 }
 
+std::pair<std::vector<double>, Action> MaxNSearchRootParallel(
+    const Game& game, const State* state,
+    std::function<double(const State&, Player player)> value_function,
+    int depth_limit, int num_threads,
+    TranspositionTable* transposition_table) {
+  GameType game_info = game.GetType();
+  SPIEL_CHECK_TRUE(
+      game_info.chance_mode == GameType::ChanceMode::kDeterministic ||
+      game_info.chance_mode == GameType::ChanceMode::kExplicitStochastic);
+  // Do not check perfect information. Used by PIMC.
+  SPIEL_CHECK_EQ(game_info.dynamics, GameType::Dynamics::kSequential);
+  SPIEL_CHECK_EQ(game_info.reward_model, GameType::RewardModel::kTerminal);
+  SPIEL_CHECK_GE(depth_limit, 1);
+  SPIEL_CHECK_GE(num_threads, 1);
+
+  std::unique_ptr<State> search_root;
+  if (state == nullptr) {
+    search_root = game.NewInitialState();
+  } else {
+    search_root = state->Clone();
+  }
+
+  SPIEL_CHECK_FALSE(search_root->IsChanceNode());
+  const Player player = search_root->CurrentPlayer();
+
+  // The root children are cloned once up front and re-searched at every
+  // depth; each worker only ever touches its own subtrees.
+  struct RootChild {
+    Action action;
+    std::unique_ptr<State> state;
+    std::vector<double> values;
+  };
+  std::vector<RootChild> children;
+  for (Action action : search_root->LegalActions()) {
+    children.push_back({action, search_root->Child(action), {}});
+  }
+  SPIEL_CHECK_FALSE(children.empty());
+
+  const int num_workers = std::min<int>(num_threads, children.size());
+  const int first_depth = value_function ? 1 : depth_limit;
+  for (int depth = first_depth; depth <= depth_limit; ++depth) {
+    if (num_workers <= 1) {
+      for (RootChild& child : children) {
+        child.values = _maxn(child.state.get(), depth - 1, value_function,
+                             /*best_action=*/nullptr, transposition_table);
+      }
+    } else {
+      std::vector<Thread> workers;
+      workers.reserve(num_workers);
+      for (int t = 0; t < num_workers; ++t) {
+        workers.emplace_back([t, num_workers, depth, &children,
+                              &value_function, transposition_table]() {
+          for (int i = t; i < children.size(); i += num_workers) {
+            children[i].values =
+                _maxn(children[i].state.get(), depth - 1, value_function,
+                      /*best_action=*/nullptr, transposition_table);
+          }
+        });
+      }
+      for (Thread& worker : workers) worker.join();
+    }
+
+    // Order the strongest line first for the next, deeper pass.
+    std::stable_sort(children.begin(), children.end(),
+                     [player](const RootChild& a, const RootChild& b) {
+                       return a.values[player] > b.values[player];
+                     });
+  }
+
+  return {children.front().values, children.front().action};
+}
+
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -19,15 +19,39 @@
 #include <utility>
 #include <vector>
 
+#include "open_spiel/algorithms/transposition_table.h"
 #include "open_spiel/spiel.h"
 
 namespace open_spiel {
 namespace algorithms {
 
+// transposition_table, when non-null, caches the value vectors of interior
+// decision nodes so positions reached through several move orders (or shared
+// across searches, e.g. PIMC determinizations) are evaluated once. See
+// transposition_table.h for reuse semantics.
 std::pair<std::vector<double>, Action> MaxNSearch(
     const Game& game, const State* state,
     std::function<double(const State&, Player player)> value_function,
-    int depth_limit);
+    int depth_limit, TranspositionTable* transposition_table = nullptr);
+
+// Root-parallel, iterative-deepening variant of MaxNSearch. Depths
+// 1..depth_limit are searched in turn, with the root actions re-ordered by
+// the previous depth's value for the player to move; max^n has no pruning
+// window, so the ordering pays off through the (shared, thread-safe)
+// transposition table rather than through cutoffs. At each depth the root
+// subtrees are split across num_threads workers, each searching its own
+// state copies.
+//
+// Without a value_function there is nothing to evaluate shallow horizons
+// with, so only depth_limit itself is searched (still root-parallel). The
+// root value for the player to move matches MaxNSearch; the chosen action
+// (and the other players' values) can differ from the serial search only
+// when root actions tie exactly.
+std::pair<std::vector<double>, Action> MaxNSearchRootParallel(
+    const Game& game, const State* state,
+    std::function<double(const State&, Player player)> value_function,
+    int depth_limit, int num_threads,
+    TranspositionTable* transposition_table = nullptr);
 
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -0,0 +1,96 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/maxn.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/algorithms/transposition_table.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void RootParallelMatchesSerialFullDepthTest() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  state->ApplyAction(4);
+  state->ApplyAction(0);
+
+  // Without a value function there is no iterative deepening, so both
+  // searches walk the same full tree.
+  std::pair<std::vector<double>, Action> serial =
+      MaxNSearch(*game, state.get(), {}, game->MaxGameLength());
+  std::pair<std::vector<double>, Action> parallel = MaxNSearchRootParallel(
+      *game, state.get(), {}, game->MaxGameLength(), /*num_threads=*/3);
+  SPIEL_CHECK_TRUE(serial.first == parallel.first);
+}
+
+void RootParallelIterativeDeepeningTest() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  state->ApplyAction(4);
+
+  // A crude evaluation so shallow horizons are well defined: prefer holding
+  // the center (index 5 of the string rendering, "...\n.X.\n...").
+  auto value_function = [](const State& s, Player p) {
+    return s.ToString()[5] == (p == 0 ? 'x' : 'o') ? 0.5 : 0.0;
+  };
+
+  for (int depth = 2; depth <= 4; ++depth) {
+    std::pair<std::vector<double>, Action> serial =
+        MaxNSearch(*game, state.get(), value_function, depth);
+    std::pair<std::vector<double>, Action> parallel = MaxNSearchRootParallel(
+        *game, state.get(), value_function, depth, /*num_threads=*/4);
+    const Player player = state->CurrentPlayer();
+    SPIEL_CHECK_FLOAT_NEAR(serial.first[player], parallel.first[player],
+                           1e-12);
+  }
+}
+
+void RootParallelSharedTableTest() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  state->ApplyAction(4);
+  state->ApplyAction(0);
+
+  TranspositionTable table;
+  std::pair<std::vector<double>, Action> without =
+      MaxNSearch(*game, state.get(), {}, game->MaxGameLength());
+  std::pair<std::vector<double>, Action> with = MaxNSearchRootParallel(
+      *game, state.get(), {}, game->MaxGameLength(), /*num_threads=*/3,
+      &table);
+  SPIEL_CHECK_TRUE(without.first == with.first);
+  SPIEL_CHECK_GT(table.NumEntries(), 0);
+
+  // A second search at the same depth is answered from the shared table.
+  std::pair<std::vector<double>, Action> again = MaxNSearchRootParallel(
+      *game, state.get(), {}, game->MaxGameLength(), /*num_threads=*/3,
+      &table);
+  SPIEL_CHECK_TRUE(again.first == with.first);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::RootParallelMatchesSerialFullDepthTest();
+  open_spiel::algorithms::RootParallelIterativeDeepeningTest();
+  open_spiel::algorithms::RootParallelSharedTableTest();
+}
@@ -19,50 +19,56 @@
 #include <limits>
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
-#include "open_spiel/abseil-cpp/absl/random/distributions.h"
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_format.h"
 #include "open_spiel/abseil-cpp/absl/time/clock.h"
 #include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
 
 int MIN_GC_LIMIT = 5;
 
-int MemoryUsedMb(int nodes) {
-  return nodes * sizeof(SearchNode) / (1 << 20);
+FastRng& RandomRolloutEvaluator::GetThreadRNG() {
+  std::lock_guard<std::mutex> lock(rngs_mutex_);
+  auto [it, inserted] = rngs_.try_emplace(std::this_thread::get_id());
+  if (inserted) it->second.Seed(next_seed_++);
+  return it->second;
 }
 
 std::vector<double> RandomRolloutEvaluator::Evaluate(const State& state) {
-  std::vector<double> result;
+  FastRng& rng = GetThreadRNG();
+  std::vector<double> result(state.NumPlayers(), 0.0);
+  // Reused across rollouts; ReturnsInto fills it without allocating.
+  std::vector<double> returns(state.NumPlayers());
+  // Reused across rollout steps; inline capacity keeps the hot loop off the
+  // allocator for typical branching factors.
+  InlinedActionsVector actions;
   for (int i = 0; i < n_rollouts_; ++i) {
     std::unique_ptr<State> working_state = state.Clone();
     while (!working_state->IsTerminal()) {
       if (working_state->IsChanceNode()) {
-        ActionsAndProbs outcomes = working_state->ChanceOutcomes();
-        working_state->ApplyAction(SampleAction(outcomes, rng_).first);
-      } else {
-        std::vector<Action> actions = working_state->LegalActions();
         working_state->ApplyAction(
-            actions[absl::Uniform(rng_, 0u, actions.size())]);
+            working_state->SampleChanceOutcome(rng.UniformDouble()).first);
+      } else {
+        working_state->LegalActions(&actions);
+        working_state->ApplyAction(actions[rng.UniformInt(actions.size())]);
       }
     }
 
-    std::vector<double> returns = working_state->Returns();
-    if (result.empty()) {
-      result.swap(returns);
-    } else {
-      SPIEL_CHECK_EQ(returns.size(), result.size());
-      for (int i = 0; i < result.size(); ++i) {
-        result[i] += returns[i];
-      }
+    working_state->ReturnsInto(absl::MakeSpan(returns));
+    for (int i = 0; i < result.size(); ++i) {
+      result[i] += returns[i];
     }
   }
   for (int i = 0; i < result.size(); ++i) {
@@ -86,6 +92,63 @@ ActionsAndProbs RandomRolloutEvaluator::Prior(const State& state) {
   }
 }
 
+FastRng& DepthLimitedRolloutEvaluator::GetThreadRNG() {
+  std::lock_guard<std::mutex> lock(rngs_mutex_);
+  auto [it, inserted] = rngs_.try_emplace(std::this_thread::get_id());
+  if (inserted) it->second.Seed(next_seed_++);
+  return it->second;
+}
+
+std::vector<double> DepthLimitedRolloutEvaluator::Evaluate(
+    const State& state) {
+  FastRng& rng = GetThreadRNG();
+  std::vector<double> result(state.NumPlayers(), 0.0);
+  std::vector<double> returns(state.NumPlayers());
+  InlinedActionsVector actions;
+  for (int i = 0; i < n_rollouts_; ++i) {
+    std::unique_ptr<State> working_state = state.Clone();
+    int moves = 0;
+    while (!working_state->IsTerminal() && moves < max_rollout_length_) {
+      if (working_state->IsChanceNode()) {
+        // Chance moves don't count against the cutoff: a long deal would
+        // otherwise eat the whole budget before any decision is played.
+        working_state->ApplyAction(
+            working_state->SampleChanceOutcome(rng.UniformDouble()).first);
+      } else {
+        working_state->LegalActions(&actions);
+        working_state->ApplyAction(actions[rng.UniformInt(actions.size())]);
+        ++moves;
+      }
+    }
+
+    if (working_state->IsTerminal()) {
+      working_state->ReturnsInto(absl::MakeSpan(returns));
+    } else {
+      returns = leaf_evaluator_->Evaluate(*working_state);
+    }
+    for (int p = 0; p < result.size(); ++p) {
+      result[p] += returns[p];
+    }
+  }
+  for (int p = 0; p < result.size(); ++p) {
+    result[p] /= n_rollouts_;
+  }
+  return result;
+}
+
+ActionsAndProbs DepthLimitedRolloutEvaluator::Prior(const State& state) {
+  if (state.IsChanceNode()) {
+    return state.ChanceOutcomes();
+  }
+  std::vector<Action> legal_actions = state.LegalActions();
+  ActionsAndProbs prior;
+  prior.reserve(legal_actions.size());
+  for (const Action& action : legal_actions) {
+    prior.emplace_back(action, 1.0 / legal_actions.size());
+  }
+  return prior;
+}
+
 // UCT value of given child
 double SearchNode::UCTValue(int parent_explore_count, double uct_c) const {
   if (!outcome.empty()) {
@@ -206,10 +269,12 @@ MCTSBot::MCTSBot(const Game& game, std::shared_ptr<Evaluator> evaluator,
                  bool solve, int seed, bool verbose,
                  ChildSelectionPolicy child_selection_policy,
                  double dirichlet_alpha, double dirichlet_epsilon,
-                 bool dont_return_chance_node)
+                 bool dont_return_chance_node, int num_threads,
+                 double first_play_urgency, double progressive_widening_c,
+                 double progressive_widening_alpha)
     : uct_c_{uct_c},
       max_simulations_{max_simulations},
-      max_nodes_((max_memory_mb << 20) / sizeof(SearchNode) + 1),
+      max_nodes_((max_memory_mb << 20) / num_threads / sizeof(PoolNode) + 1),
       nodes_(0),
       gc_limit_(MIN_GC_LIMIT),
       verbose_(verbose),
@@ -218,28 +283,71 @@ MCTSBot::MCTSBot(const Game& game, std::shared_ptr<Evaluator> evaluator,
       dirichlet_alpha_(dirichlet_alpha),
       dirichlet_epsilon_(dirichlet_epsilon),
       dont_return_chance_node_(dont_return_chance_node),
+      first_play_urgency_(first_play_urgency),
+      progressive_widening_c_(progressive_widening_c),
+      progressive_widening_alpha_(progressive_widening_alpha),
       rng_(seed),
       child_selection_policy_(child_selection_policy),
       evaluator_(evaluator) {
+  SPIEL_CHECK_GE(num_threads, 1);
+  if (progressive_widening_c_ > 0) {
+    SPIEL_CHECK_GT(progressive_widening_alpha_, 0);
+    SPIEL_CHECK_LE(progressive_widening_alpha_, 1);
+  }
   GameType game_type = game.GetType();
   if (game_type.reward_model != GameType::RewardModel::kTerminal)
     SpielFatalError("Game must have terminal rewards.");
   if (game_type.dynamics != GameType::Dynamics::kSequential)
     SpielFatalError("Game must have sequential turns.");
+  if (num_threads > 1) {
+    // Root-parallel workers: independent single-threaded trees with their own
+    // seeds, sharing the memory budget. They stay quiet even in verbose mode
+    // to keep the report readable.
+    int64_t worker_memory_mb =
+        max_memory_mb > 0 ? std::max<int64_t>(1, max_memory_mb / num_threads)
+                          : 0;
+    workers_.reserve(num_threads - 1);
+    for (int t = 1; t < num_threads; ++t) {
+      workers_.emplace_back(new MCTSBot(
+          game, evaluator, uct_c, max_simulations, worker_memory_mb, solve,
+          seed + t, /*verbose=*/false, child_selection_policy, dirichlet_alpha,
+          dirichlet_epsilon, dont_return_chance_node, /*num_threads=*/1,
+          first_play_urgency, progressive_widening_c,
+          progressive_widening_alpha));
+    }
+  }
 }
 
 Action MCTSBot::Step(const State& state) {
+  StopPondering();
+  if (opening_book_ != nullptr) {
+    absl::optional<Action> book_action =
+        opening_book_->Lookup(state.InformationStateHash());
+    if (book_action.has_value()) return *book_action;
+  }
   absl::Time start = absl::Now();
-  std::unique_ptr<SearchNode> root = MCTSearch(state);
+  if (game_time_budget_ > 0) {
+    // One slice of the remaining clock; the deadline and the early-stop /
+    // extension rules are applied inside RunSearch (see TimedSearchStop).
+    tm_slice_seconds_ = time_remaining_ / tm_moves_horizon_;
+    tm_search_start_ = start;
+    tm_deadline_ = start + absl::Seconds(tm_slice_seconds_);
+    tm_extended_ = false;
+    tm_active_ = true;
+  }
+  Action chosen = kInvalidAction;
+  if (max_simulations_ <= 1 || verbose_) {
+    // These paths need the materialized tree: SampleFromPrior is a SearchNode
+    // method, and the verbose report prints SearchNode trees.
+    std::unique_ptr<SearchNode> root = MCTSearch(state);
 
-  if (max_simulations_ <= 1) {
-    // sample from prior
-    return root->SampleFromPrior(state, evaluator_.get(), &rng_);
-  } else {
-    // return best action
-    const SearchNode& best = root->BestChild();
+    if (max_simulations_ <= 1) {
+      // sample from prior
+      chosen = root->SampleFromPrior(state, evaluator_.get(), &rng_);
+    } else {
+      // return best action
+      const SearchNode& best = root->BestChild();
 
-    if (verbose_) {
       double seconds = absl::ToDoubleSeconds(absl::Now() - start);
       std::cerr << absl::StrFormat(
                        ("Finished %d sims in %.3f secs, %.1f sims/s, "
@@ -258,8 +366,48 @@ Action MCTSBot::Step(const State& state) {
         std::cerr << "Children of chosen:" << std::endl;
         std::cerr << best.ChildrenStr(*chosen_state) << std::endl;
       }
+      chosen = best.action;
     }
-    return best.action;
+  } else if (workers_.empty()) {
+    // Fast path: pick the best action straight off the pool(s), without
+    // materializing a SearchNode tree.
+    RunSearch(state);
+    chosen = pool_[BestChildIndex(0)].action;
+  } else {
+    RunParallelSearch(state);
+    std::vector<PoolNode> merged = MergedRootChildren();
+    chosen =
+        std::max_element(merged.begin(), merged.end(), &CompareFinal)->action;
+  }
+  if (tm_active_) {
+    // Settle the clock with what the search actually spent, extension
+    // included. A stopped clock yields near-zero slices — the bot then
+    // answers from single simulations rather than overshooting further.
+    tm_active_ = false;
+    time_remaining_ = std::max(
+        0.0, time_remaining_ - absl::ToDoubleSeconds(absl::Now() - start));
+  }
+  if (collect_step_stats_) RecordStepStats(start);
+  // The searched state stays current until the next call arrives; spend the
+  // wait growing its tree (the opponent's think time is otherwise idle).
+  StartPondering(state);
+  return chosen;
+}
+
+void MCTSBot::RecordStepStats(absl::Time start) {
+  last_step_stats_ = {};
+  last_step_stats_.wall_time_seconds =
+      absl::ToDoubleSeconds(absl::Now() - start);
+  if (!pool_.empty()) {
+    last_step_stats_.simulations = pool_[0].explore_count;
+  }
+  last_step_stats_.nodes_expanded = nodes_;
+  // Root-parallel search: the workers' pools hold trees of their own.
+  for (const std::unique_ptr<MCTSBot>& worker : workers_) {
+    if (!worker->pool_.empty()) {
+      last_step_stats_.simulations += worker->pool_[0].explore_count;
+    }
+    last_step_stats_.nodes_expanded += worker->nodes_;
   }
 }
 
@@ -268,18 +416,82 @@ std::pair<ActionsAndProbs, Action> MCTSBot::StepWithPolicy(const State& state) {
   return {{{action, 1.}}, action};
 }
 
+double MCTSBot::UCTValue(const PoolNode& child,
+                         int parent_explore_count) const {
+  if (!child.outcome.empty()) {
+    return child.outcome[child.player];
+  }
+
+  if (child.explore_count == 0) return first_play_urgency_;
+
+  // The "greedy-value" of choosing a given child is always with respect to
+  // the current player for this node.
+  return child.total_reward / child.explore_count +
+         uct_c_ * std::sqrt(std::log(parent_explore_count) /
+                            child.explore_count);
+}
+
+double MCTSBot::PUCTValue(const PoolNode& child,
+                          int parent_explore_count) const {
+  if (!child.outcome.empty()) {
+    return child.outcome[child.player];
+  }
+
+  // The classic PUCT formula gives an unvisited child an exploitation term of
+  // 0; a finite first-play urgency replaces that 0, leaving the prior-driven
+  // exploration term untouched.
+  return ((child.explore_count != 0
+               ? child.total_reward / child.explore_count
+               : (std::isinf(first_play_urgency_) ? 0 : first_play_urgency_)) +
+          uct_c_ * child.prior * std::sqrt(parent_explore_count) /
+              (child.explore_count + 1));
+}
+
+bool MCTSBot::CompareFinal(const PoolNode& a, const PoolNode& b) {
+  // Same ordering as SearchNode::CompareFinal.
+  double out = (a.outcome.empty() ? 0 : a.outcome[a.player]);
+  double out_b = (b.outcome.empty() ? 0 : b.outcome[b.player]);
+  if (out != out_b) {
+    return out < out_b;
+  }
+  if (a.explore_count != b.explore_count) {
+    return a.explore_count < b.explore_count;
+  }
+  return a.total_reward < b.total_reward;
+}
+
+uint32_t MCTSBot::BestChildIndex(uint32_t parent_index) const {
+  const PoolNode& parent = pool_[parent_index];
+  SPIEL_CHECK_GT(parent.num_children, 0u);
+  uint32_t best = parent.first_child;
+  for (uint32_t i = parent.first_child + 1;
+       i < parent.first_child + parent.num_children; ++i) {
+    if (CompareFinal(pool_[best], pool_[i])) best = i;
+  }
+  return best;
+}
+
+uint32_t MCTSBot::WidenedChildCount(const PoolNode& node) const {
+  double budget = progressive_widening_c_ *
+                  std::pow(std::max(node.explore_count, 1),
+                           progressive_widening_alpha_);
+  uint32_t count = std::max<uint32_t>(1, std::ceil(budget));
+  return std::min(count, node.num_children);
+}
+
 std::unique_ptr<State> MCTSBot::ApplyTreePolicy(
-    SearchNode* root, const State& state,
-    std::vector<SearchNode*>* visit_path) {
-  visit_path->push_back(root);
+    uint32_t root_index, const State& state,
+    std::vector<uint32_t>* visit_path) {
+  visit_path->push_back(root_index);
   std::unique_ptr<State> working_state = state.Clone();
-  SearchNode* current_node = root;
-  while ((!working_state->IsTerminal() && current_node->explore_count > 0) ||
+  uint32_t current = root_index;
+  while ((!working_state->IsTerminal() &&
+          pool_[current].explore_count > 0) ||
          (working_state->IsChanceNode() && dont_return_chance_node_)) {
-    if (current_node->children.empty()) {
+    if (pool_[current].num_children == 0) {
       // For a new node, initialize its state, then choose a child as normal.
       ActionsAndProbs legal_actions = evaluator_->Prior(*working_state);
-      if (current_node == root && dirichlet_alpha_ > 0) {
+      if (current == root_index && dirichlet_alpha_ > 0) {
         std::vector<double> noise =
             dirichlet_noise(legal_actions.size(), dirichlet_alpha_, &rng_);
         for (int i = 0; i < legal_actions.size(); i++) {
@@ -290,188 +502,578 @@ std::unique_ptr<State> MCTSBot::ApplyTreePolicy(
       }
       // Reduce bias from move generation order.
       std::shuffle(legal_actions.begin(), legal_actions.end(), rng_);
+      if (progressive_widening_c_ > 0 && !working_state->IsChanceNode()) {
+        // Widening considers a prior-descending prefix of the sibling block;
+        // the stable sort keeps the shuffled order among equal priors.
+        std::stable_sort(legal_actions.begin(), legal_actions.end(),
+                         [](const std::pair<Action, double>& a,
+                            const std::pair<Action, double>& b) {
+                           return a.second > b.second;
+                         });
+      }
       Player player = working_state->CurrentPlayer();
-      current_node->children.reserve(legal_actions.size());
-      for (auto [action, prior] : legal_actions) {
-        current_node->children.emplace_back(action, player, prior);
+      // Allocate the sibling block (recycled or appended), then fix up the
+      // parent; the allocation may grow the pool, so the parent must be
+      // re-indexed afterwards.
+      uint32_t first_child = AllocateChildren(legal_actions.size());
+      for (uint32_t c = 0; c < legal_actions.size(); ++c) {
+        PoolNode& child = pool_[first_child + c];
+        child.action = legal_actions[c].first;
+        child.prior = legal_actions[c].second;
+        child.player = player;
       }
-      nodes_ += current_node->children.capacity();
+      pool_[current].first_child = first_child;
+      pool_[current].num_children = legal_actions.size();
+      nodes_ += legal_actions.size();
     }
 
     Action selected_action;
-    if (current_node->children.empty()) {
+    const PoolNode& current_node = pool_[current];
+    if (current_node.num_children == 0) {
       // no children, sample from prior
-      selected_action = current_node->SampleFromPrior(state, evaluator_.get(),
-                                                      &rng_);
+      std::unique_ptr<State> cloned_state = state.Clone();
+      ActionsAndProbs prior = evaluator_->Prior(*cloned_state);
+      selected_action = SampleAction(prior, rng_).first;
     } else {
       // look at children
-      SearchNode* chosen_child = nullptr;
+      uint32_t chosen_child = current_node.first_child;
+      uint32_t end = current_node.first_child + current_node.num_children;
       if (working_state->IsChanceNode()) {
         // For chance nodes, rollout according to chance node's probability
         // distribution
         Action chosen_action =
-            SampleAction(working_state->ChanceOutcomes(), rng_).first;
+            working_state
+                ->SampleChanceOutcome(
+                    std::uniform_real_distribution<double>()(rng_))
+                .first;
 
-        for (SearchNode& child : current_node->children) {
-          if (child.action == chosen_action) {
-            chosen_child = &child;
+        for (uint32_t i = current_node.first_child; i < end; ++i) {
+          if (pool_[i].action == chosen_action) {
+            chosen_child = i;
             break;
           }
         }
       } else {
-        // Otherwise choose node with largest UCT value.
+        // Otherwise choose node with largest UCT value, among the widened
+        // prefix of the children when progressive widening is on.
+        if (progressive_widening_c_ > 0) {
+          end = current_node.first_child + WidenedChildCount(current_node);
+        }
         double max_value = -std::numeric_limits<double>::infinity();
-        for (SearchNode& child : current_node->children) {
+        for (uint32_t i = current_node.first_child; i < end; ++i) {
           double val;
           switch (child_selection_policy_) {
             case ChildSelectionPolicy::UCT:
-              val = child.UCTValue(current_node->explore_count, uct_c_);
+              val = UCTValue(pool_[i], current_node.explore_count);
               break;
             case ChildSelectionPolicy::PUCT:
-              val = child.PUCTValue(current_node->explore_count, uct_c_);
+              val = PUCTValue(pool_[i], current_node.explore_count);
               break;
           }
           if (val > max_value) {
             max_value = val;
-            chosen_child = &child;
+            chosen_child = i;
           }
         }
       }
-      selected_action = chosen_child->action;
-      current_node = chosen_child;
+      selected_action = pool_[chosen_child].action;
+      current = chosen_child;
     }
 
     working_state->ApplyAction(selected_action);
-    visit_path->push_back(current_node);
+    visit_path->push_back(current);
   }
 
   return working_state;
 }
 
 std::unique_ptr<SearchNode> MCTSBot::MCTSearch(const State& state) {
-  nodes_ = 1;
+  StopPondering();
+  if (workers_.empty()) {
+    RunSearch(state);
+    return MaterializeTree();
+  }
+  RunParallelSearch(state);
+  std::unique_ptr<SearchNode> root = MaterializeTree();
+  MergeRootStats(root.get());
+  return root;
+}
+
+void MCTSBot::RunParallelSearch(const State& state) {
+  // Workers only read `state` (each search immediately clones it), so it can
+  // be shared without synchronization.
+  std::vector<Thread> threads;
+  threads.reserve(workers_.size());
+  for (std::unique_ptr<MCTSBot>& worker : workers_) {
+    // Same timed window on every tree; each worker judges the early stop
+    // and its one extension on its own root, so no cross-tree locking.
+    worker->tm_active_ = tm_active_;
+    worker->tm_slice_seconds_ = tm_slice_seconds_;
+    worker->tm_search_start_ = tm_search_start_;
+    worker->tm_deadline_ = tm_deadline_;
+    worker->tm_extended_ = false;
+    MCTSBot* bot = worker.get();
+    threads.emplace_back([bot, &state]() { bot->RunSearch(state); });
+  }
+  RunSearch(state);  // The primary tree grows on the calling thread.
+  for (Thread& thread : threads) thread.join();
+}
+
+std::vector<MCTSBot::PoolNode> MCTSBot::MergedRootChildren() const {
+  absl::flat_hash_map<Action, int> index_by_action;
+  std::vector<PoolNode> merged;
+  auto accumulate = [&](const std::vector<PoolNode>& pool) {
+    if (pool.empty()) return;
+    const PoolNode& root = pool[0];
+    for (uint32_t i = root.first_child;
+         i < root.first_child + root.num_children; ++i) {
+      const PoolNode& child = pool[i];
+      auto [it, inserted] =
+          index_by_action.emplace(child.action, merged.size());
+      if (inserted) {
+        PoolNode& entry = merged.emplace_back();
+        entry.action = child.action;
+        entry.prior = child.prior;
+        entry.player = child.player;
+      }
+      PoolNode& entry = merged[it->second];
+      entry.explore_count += child.explore_count;
+      entry.total_reward += child.total_reward;
+      // A proof in any tree is a proof; they agree when several trees have
+      // one.
+      if (entry.outcome.empty() && !child.outcome.empty()) {
+        entry.outcome = child.outcome;
+      }
+    }
+  };
+  accumulate(pool_);
+  for (const std::unique_ptr<MCTSBot>& worker : workers_) {
+    accumulate(worker->pool_);
+  }
+  return merged;
+}
+
+void MCTSBot::MergeRootStats(SearchNode* root) const {
+  std::vector<PoolNode> merged = MergedRootChildren();
+  absl::flat_hash_map<Action, const PoolNode*> by_action;
+  for (const PoolNode& entry : merged) by_action[entry.action] = &entry;
+  root->explore_count = pool_[0].explore_count;
+  for (const std::unique_ptr<MCTSBot>& worker : workers_) {
+    root->explore_count += worker->pool_[0].explore_count;
+    root->total_reward += worker->pool_[0].total_reward;
+    if (root->outcome.empty() && !worker->pool_[0].outcome.empty()) {
+      root->outcome = worker->pool_[0].outcome;
+    }
+  }
+  for (SearchNode& child : root->children) {
+    auto it = by_action.find(child.action);
+    if (it == by_action.end()) continue;
+    child.explore_count = it->second->explore_count;
+    child.total_reward = it->second->total_reward;
+    if (child.outcome.empty()) child.outcome = it->second->outcome;
+  }
+}
+
+void MCTSBot::RunSearch(const State& state) {
   gc_limit_ = MIN_GC_LIMIT;
-  auto root = std::make_unique<SearchNode>(kInvalidAction,
-                                           state.CurrentPlayer(), 1);
-  std::vector<SearchNode*> visit_path;
+  if (!reuse_tree_ || !AdvanceRootTo(state)) {
+    nodes_ = 1;
+    // clear() keeps the pool's capacity, so after the first search of a
+    // similarly-sized tree no per-move allocation remains.
+    pool_.clear();
+    free_blocks_.clear();
+    free_node_count_ = 0;
+    PoolNode& root = pool_.emplace_back();
+    root.player = state.CurrentPlayer();
+    root.prior = 1;
+  }
+  if (reuse_tree_) last_search_history_ = state.History();
+  std::vector<uint32_t> visit_path;
   std::vector<double> returns;
   visit_path.reserve(64);
   for (int i = 0; i < max_simulations_; ++i) {
-    visit_path.clear();
-    returns.clear();
+    if (SimulateOnce(state, &visit_path, &returns)) break;
+    if (tm_active_ && TimedSearchStop(i + 1)) break;
+    MaybeRecycleNodes(i);
+  }
+}
 
-    std::unique_ptr<State> working_state =
-        ApplyTreePolicy(root.get(), state, &visit_path);
+bool MCTSBot::SimulateOnce(const State& state,
+                           std::vector<uint32_t>* visit_path_storage,
+                           std::vector<double>* returns_storage) {
+  std::vector<uint32_t>& visit_path = *visit_path_storage;
+  std::vector<double>& returns = *returns_storage;
+  visit_path.clear();
+  returns.clear();
 
-    bool solved;
-    if (working_state->IsTerminal()) {
-      returns = working_state->Returns();
-      visit_path[visit_path.size() - 1]->outcome = returns;
-      solved = solve_;
-    } else {
-      returns = evaluator_->Evaluate(*working_state);
-      solved = false;
-    }
+  std::unique_ptr<State> working_state =
+      ApplyTreePolicy(0, state, &visit_path);
 
-    // Propagate values back.
-    while (!visit_path.empty()) {
-      int decision_node_idx = visit_path.size() - 1;
-      SearchNode* node = visit_path[decision_node_idx];
+  bool solved;
+  if (working_state->IsTerminal()) {
+    returns.resize(working_state->NumPlayers());
+    working_state->ReturnsInto(absl::MakeSpan(returns));
+    pool_[visit_path[visit_path.size() - 1]].outcome = returns;
+    solved = solve_;
+  } else {
+    returns = evaluator_->Evaluate(*working_state);
+    solved = false;
+  }
 
-      // If it's a chance node, find the parent player id.
-      while (visit_path[decision_node_idx]->player == kChancePlayerId) {
-        decision_node_idx--;
-      }
+  // Propagate values back.
+  while (!visit_path.empty()) {
+    int decision_node_idx = visit_path.size() - 1;
+    PoolNode& node = pool_[visit_path[decision_node_idx]];
 
-      node->total_reward += returns[visit_path[decision_node_idx]->player];
-      node->explore_count += 1;
-      visit_path.pop_back();
-
-      // Back up solved results as well.
-      if (solved && !node->children.empty()) {
-        Player player = node->children[0].player;
-        if (player == kChancePlayerId) {
-          // Only back up chance nodes if all have the same outcome.
-          // An alternative would be to back up the weighted average of
-          // outcomes if all children are solved, but that is less clear.
-          const std::vector<double>& outcome = node->children[0].outcome;
-          if (!outcome.empty() &&
-              std::all_of(node->children.begin() + 1, node->children.end(),
-                          [&outcome](const SearchNode& c) {
-                            return c.outcome == outcome;
-                          })) {
-            node->outcome = outcome;
-          } else {
-            solved = false;
-          }
+    // If it's a chance node, find the parent player id.
+    while (pool_[visit_path[decision_node_idx]].player == kChancePlayerId) {
+      decision_node_idx--;
+    }
+
+    node.total_reward += returns[pool_[visit_path[decision_node_idx]].player];
+    node.explore_count += 1;
+    visit_path.pop_back();
+
+    // Back up solved results as well.
+    if (solved && node.num_children > 0) {
+      uint32_t begin = node.first_child;
+      uint32_t end = node.first_child + node.num_children;
+      Player player = pool_[begin].player;
+      if (player == kChancePlayerId) {
+        // Only back up chance nodes if all have the same outcome.
+        // An alternative would be to back up the weighted average of
+        // outcomes if all children are solved, but that is less clear.
+        const std::vector<double>& outcome = pool_[begin].outcome;
+        if (!outcome.empty() &&
+            std::all_of(pool_.begin() + begin + 1, pool_.begin() + end,
+                        [&outcome](const PoolNode& c) {
+                          return c.outcome == outcome;
+                        })) {
+          node.outcome = outcome;
         } else {
-          // If any have max utility (won?), or all children are solved,
-          // choose the one best for the player choosing.
-          const SearchNode* best = nullptr;
-          bool all_solved = true;
-          for (const SearchNode& child : node->children) {
-            if (child.outcome.empty()) {
-              all_solved = false;
-            } else if (best == nullptr ||
-                       child.outcome[player] > best->outcome[player]) {
-              best = &child;
-            }
-          }
-          if (best != nullptr &&
-              (all_solved || best->outcome[player] == max_utility_)) {
-            node->outcome = best->outcome;
-          } else {
-            solved = false;
+          solved = false;
+        }
+      } else {
+        // If any have max utility (won?), or all children are solved,
+        // choose the one best for the player choosing.
+        const PoolNode* best = nullptr;
+        bool all_solved = true;
+        for (uint32_t c = begin; c < end; ++c) {
+          const PoolNode& child = pool_[c];
+          if (child.outcome.empty()) {
+            all_solved = false;
+          } else if (best == nullptr ||
+                     child.outcome[player] > best->outcome[player]) {
+            best = &child;
           }
         }
+        if (best != nullptr &&
+            (all_solved || best->outcome[player] == max_utility_)) {
+          node.outcome = best->outcome;
+        } else {
+          solved = false;
+        }
       }
     }
+  }
 
-    if (!root->outcome.empty() ||  // Full game tree is solved.
-        root->children.size() == 1) {
-      break;
+  return !pool_[0].outcome.empty() ||  // Full game tree is solved.
+         pool_[0].num_children == 1;
+}
+
+void MCTSBot::MaybeRecycleNodes(int simulations_done) {
+  if (max_nodes_ > 1 && static_cast<int>(pool_.size()) >= max_nodes_ &&
+      free_node_count_ < max_nodes_ / 8) {
+    // Note that actual memory used as counted by ps/top might exceed the
+    // counted value here, possibly by a significant margin (1.5x even!). Part
+    // of that is not counting the outcome array, but most of that is due to
+    // memory fragmentation and is out of our control without writing our own
+    // memory manager.
+    if (verbose_) {
+      std::cerr << absl::StrFormat(
+          ("Approx %d mb in %d nodes after %d sims, recycling with "
+           "limit %d ... "),
+          MemoryUsedMb(static_cast<int>(pool_.size())), nodes_,
+          simulations_done, gc_limit_);
     }
-    if (max_nodes_ > 1 && nodes_ >= max_nodes_) {
-      // Note that actual memory used as counted by ps/top might exceed the
-      // counted value here, possibly by a significant margin (1.5x even!). Part
-      // of that is not counting the outcome array, but most of that is due to
-      // memory fragmentation and is out of our control without writing our own
-      // memory manager.
-      if (verbose_) {
-        std::cerr << absl::StrFormat(
-            ("Approx %d mb in %d nodes after %d sims, garbage collecting with "
-             "limit %d ... "),
-            MemoryUsedMb(nodes_), nodes_, i, gc_limit_);
-      }
-      GarbageCollect(root.get());
-
-      // Slowly increase or decrease to target releasing half the memory.
-      gc_limit_ *= (nodes_ > max_nodes_ / 2 ? 1.25 : 0.9);
-      gc_limit_ = std::max(MIN_GC_LIMIT, gc_limit_);
-      if (verbose_) {
-        std::cerr << absl::StrFormat(
-            "%d mb in %d nodes remaining\n",
-            MemoryUsedMb(nodes_), nodes_);
+    RecycleNodes();
+
+    // Slowly increase or decrease to target releasing half the storage.
+    gc_limit_ *= (free_node_count_ < max_nodes_ / 2 ? 1.25 : 0.9);
+    gc_limit_ = std::max(MIN_GC_LIMIT, gc_limit_);
+    if (verbose_) {
+      std::cerr << absl::StrFormat(
+          "%d nodes live, %d free\n", nodes_, free_node_count_);
+    }
+  }
+}
+
+void MCTSBot::PonderLoop() {
+  // The ponder thread is the only mutator of the search structures while it
+  // runs: StartPondering hands them over, StopPondering joins before any
+  // other entry point touches them.
+  const State& state = *ponder_state_;
+  std::vector<uint32_t> visit_path;
+  std::vector<double> returns;
+  visit_path.reserve(64);
+  for (int i = 0;
+       max_ponder_simulations_ <= 0 || i < max_ponder_simulations_; ++i) {
+    if (ponder_stop_.load(std::memory_order_relaxed)) break;
+    if (SimulateOnce(state, &visit_path, &returns)) break;
+    MaybeRecycleNodes(i);
+  }
+}
+
+void MCTSBot::StartPondering(const State& state) {
+  if (!ponder_ || pool_.empty()) return;
+  for (std::unique_ptr<MCTSBot>& worker : workers_) {
+    worker->StartPondering(state);
+  }
+  ponder_state_ = state.Clone();
+  ponder_stop_.store(false, std::memory_order_relaxed);
+  ponder_thread_ = std::make_unique<Thread>([this]() { PonderLoop(); });
+}
+
+void MCTSBot::StopPondering() {
+  for (std::unique_ptr<MCTSBot>& worker : workers_) {
+    worker->StopPondering();
+  }
+  if (ponder_thread_ == nullptr) return;
+  ponder_stop_.store(true, std::memory_order_relaxed);
+  ponder_thread_->join();
+  ponder_thread_.reset();
+  ponder_state_.reset();
+}
+
+void MCTSBot::SetPondering(bool ponder, int max_ponder_simulations) {
+  SPIEL_CHECK_GE(max_ponder_simulations, 0);
+  StopPondering();
+  ponder_ = ponder;
+  max_ponder_simulations_ = max_ponder_simulations;
+  // Pondered simulations only pay off if the tree survives to the next Step.
+  if (ponder) SetTreeReuse(true);
+  for (std::unique_ptr<MCTSBot>& worker : workers_) {
+    worker->SetPondering(ponder, max_ponder_simulations);
+  }
+}
+
+bool MCTSBot::TimedSearchStop(int simulations_done) {
+  const PoolNode& root = pool_[0];
+  if (root.num_children < 2) return false;  // Covered by the solved break.
+  int best = 0;
+  int second = 0;
+  for (uint32_t c = root.first_child;
+       c < root.first_child + root.num_children; ++c) {
+    const int count = pool_[c].explore_count;
+    if (count > best) {
+      second = best;
+      best = count;
+    } else if (count > second) {
+      second = count;
+    }
+  }
+  // Insurmountable lead: even if every remaining simulation visited the
+  // runner-up, it could not catch the leader, so the chosen action is
+  // already decided and the rest of the slice is better spent on a later
+  // move. The remaining simulations are bounded by both the simulation cap
+  // and what is left of the window at the observed rate.
+  const absl::Time now = absl::Now();
+  const double elapsed =
+      std::max(absl::ToDoubleSeconds(now - tm_search_start_), 1e-6);
+  const double window_left = absl::ToDoubleSeconds(tm_deadline_ - now);
+  const double remaining =
+      std::min<double>(max_simulations_ - simulations_done,
+                       simulations_done / elapsed * std::max(window_left, 0.0));
+  if (best - second > remaining) return true;
+  if (window_left > 0) return false;
+  // Window expired. A close top-two means more simulations can still swing
+  // the choice: extend the deadline once, to tm_extension_factor_ times the
+  // original slice.
+  if (!tm_extended_ && second >= (1.0 - tm_close_margin_) * best) {
+    tm_extended_ = true;
+    tm_deadline_ = tm_search_start_ +
+                   absl::Seconds(tm_extension_factor_ * tm_slice_seconds_);
+    return false;
+  }
+  return true;
+}
+
+uint32_t MCTSBot::AllocateChildren(uint32_t count) {
+  // Best fit from the free list; a larger block is split and its tail put
+  // back. Only when nothing fits does the pool itself grow.
+  auto it = free_blocks_.lower_bound(count);
+  if (it != free_blocks_.end()) {
+    const uint32_t block_size = it->first;
+    const uint32_t first = it->second.back();
+    it->second.pop_back();
+    if (it->second.empty()) free_blocks_.erase(it);
+    if (block_size > count) {
+      free_blocks_[block_size - count].push_back(first + count);
+    }
+    free_node_count_ -= count;
+    return first;
+  }
+  const uint32_t first = pool_.size();
+  pool_.resize(pool_.size() + count);
+  return first;
+}
+
+void MCTSBot::FreeSubtree(uint32_t first_child, uint32_t num_children) {
+  // Iterative walk over sibling blocks; every visited node is reset so the
+  // eviction scan skips it and reallocation hands out clean storage.
+  std::vector<std::pair<uint32_t, uint32_t>> stack;
+  stack.emplace_back(first_child, num_children);
+  while (!stack.empty()) {
+    auto [first, count] = stack.back();
+    stack.pop_back();
+    for (uint32_t i = first; i < first + count; ++i) {
+      PoolNode& node = pool_[i];
+      if (node.num_children > 0) {
+        stack.emplace_back(node.first_child, node.num_children);
       }
+      node = PoolNode();
     }
+    free_blocks_[count].push_back(first);
+    free_node_count_ += count;
   }
+}
 
-  return root;
+void MCTSBot::RecycleNodes() {
+  // Evict the subtrees below under-explored nodes (the policy the old
+  // compacting collector applied) into the free list. The root's own child
+  // block is never evicted. Parents precede their children only among
+  // appended blocks, but FreeSubtree resets every descendant, so a node
+  // whose subtree was already freed is skipped by the num_children test.
+  for (uint32_t i = 1; i < pool_.size(); ++i) {
+    if (pool_[i].num_children > 0 && pool_[i].explore_count < gc_limit_) {
+      FreeSubtree(pool_[i].first_child, pool_[i].num_children);
+      pool_[i].first_child = 0;
+      pool_[i].num_children = 0;
+    }
+  }
+  nodes_ = pool_.size() - free_node_count_;
 }
 
-void MCTSBot::GarbageCollect(SearchNode* node) {
-  if (node->children.empty()) {
-    return;
+MCTSBot::~MCTSBot() { StopPondering(); }
+
+void MCTSBot::Restart() {
+  StopPondering();
+  pool_.clear();
+  free_blocks_.clear();
+  free_node_count_ = 0;
+  last_search_history_.clear();
+  nodes_ = 0;
+  time_remaining_ = game_time_budget_;  // A fresh game gets a fresh clock.
+  for (std::unique_ptr<MCTSBot>& worker : workers_) worker->Restart();
+}
+
+void MCTSBot::SetTimeManagement(double game_time_seconds, int moves_horizon,
+                                double close_margin, double extension_factor) {
+  SPIEL_CHECK_GE(game_time_seconds, 0);
+  SPIEL_CHECK_GE(moves_horizon, 1);
+  SPIEL_CHECK_GE(close_margin, 0);
+  SPIEL_CHECK_LT(close_margin, 1);
+  SPIEL_CHECK_GE(extension_factor, 1);
+  game_time_budget_ = game_time_seconds;
+  time_remaining_ = game_time_seconds;
+  tm_moves_horizon_ = moves_horizon;
+  tm_close_margin_ = close_margin;
+  tm_extension_factor_ = extension_factor;
+  // Workers inherit the knobs; the per-search window itself is handed to
+  // them by RunParallelSearch, and the clock lives only on the primary.
+  for (std::unique_ptr<MCTSBot>& worker : workers_) {
+    worker->tm_close_margin_ = close_margin;
+    worker->tm_extension_factor_ = extension_factor;
+  }
+}
+
+void MCTSBot::SetTreeReuse(bool reuse) {
+  reuse_tree_ = reuse;
+  if (!reuse) {
+    last_search_history_.clear();
+  }
+  for (std::unique_ptr<MCTSBot>& worker : workers_) {
+    worker->SetTreeReuse(reuse);
+  }
+}
+
+bool MCTSBot::AdvanceRootTo(const State& state) {
+  if (pool_.empty()) return false;
+  const std::vector<Action> history = state.History();
+  if (history.size() < last_search_history_.size() ||
+      !std::equal(last_search_history_.begin(), last_search_history_.end(),
+                  history.begin())) {
+    return false;
   }
-  bool clear_children = node->explore_count < gc_limit_;
-  for (SearchNode& child : node->children) {
-    GarbageCollect(&child);
+  // Walk the retained tree along the actions played since the last search.
+  uint32_t current = 0;
+  for (size_t i = last_search_history_.size(); i < history.size(); ++i) {
+    const PoolNode& node = pool_[current];
+    const uint32_t end = node.first_child + node.num_children;
+    uint32_t found = end;
+    for (uint32_t c = node.first_child; c < end; ++c) {
+      if (pool_[c].action == history[i]) {
+        found = c;
+        break;
+      }
+    }
+    if (found == end) return false;
+    current = found;
+  }
+  // An unexplored node carries no statistics worth keeping.
+  if (pool_[current].explore_count == 0) return false;
+  ReRoot(current);
+  // The root slot keeps the root conventions of a fresh search.
+  pool_[0].action = kInvalidAction;
+  pool_[0].prior = 1;
+  pool_[0].player = state.CurrentPlayer();
+  return true;
+}
+
+void MCTSBot::ReRoot(uint32_t new_root) {
+  // Mark-compact walk keeping every node below new_root and nothing else.
+  // Compaction renumbers the pool, so the free list is dropped with the
+  // unreachable nodes.
+  free_blocks_.clear();
+  free_node_count_ = 0;
+  gc_pool_.clear();
+  gc_pool_.reserve(pool_.size());
+  gc_pool_.push_back(std::move(pool_[new_root]));
+  for (uint32_t i = 0; i < gc_pool_.size(); ++i) {
+    uint32_t first_child = gc_pool_[i].first_child;
+    uint32_t num_children = gc_pool_[i].num_children;
+    if (num_children == 0) continue;
+    gc_pool_[i].first_child = gc_pool_.size();
+    for (uint32_t c = 0; c < num_children; ++c) {
+      gc_pool_.push_back(std::move(pool_[first_child + c]));
+    }
   }
-  if (clear_children) {
-    nodes_ -= node->children.capacity();
-    node->children.clear();
-    node->children.shrink_to_fit();  // release the memory
+  pool_.swap(gc_pool_);
+  nodes_ = pool_.size();
+}
+
+std::unique_ptr<SearchNode> MCTSBot::MaterializeTree() const {
+  auto root = std::make_unique<SearchNode>();
+  // Pairs of (pool index, destination). A destination stays valid because its
+  // parent's children vector is fully sized before any child is pushed.
+  std::vector<std::pair<uint32_t, SearchNode*>> stack;
+  stack.emplace_back(0, root.get());
+  while (!stack.empty()) {
+    auto [index, out] = stack.back();
+    stack.pop_back();
+    const PoolNode& node = pool_[index];
+    out->action = node.action;
+    out->prior = node.prior;
+    out->player = node.player;
+    out->explore_count = node.explore_count;
+    out->total_reward = node.total_reward;
+    out->outcome = node.outcome;
+    out->children.resize(node.num_children);
+    for (uint32_t c = 0; c < node.num_children; ++c) {
+      stack.emplace_back(node.first_child + c, &out->children[c]);
+    }
   }
+  return root;
 }
 
 }  // namespace algorithms
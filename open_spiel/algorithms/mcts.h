@@ -17,14 +17,24 @@
 
 #include <stdint.h>
 
+#include <atomic>
+#include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/node_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+
+#include "open_spiel/algorithms/opening_book.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_bots.h"
+#include "open_spiel/utils/thread.h"
 
 // A vanilla Monte Carlo Tree Search algorithm.
 //
@@ -94,10 +104,14 @@ class Evaluator {
 // A simple evaluator that returns the average outcome of playing random actions
 // from the given state until the end of the game.
 // n_rollouts is the number of random outcomes to be considered.
+//
+// Evaluate is safe to call from multiple threads: each thread draws from its
+// own generator (streams are seeded seed, seed + 1, ... in order of first
+// use), so a single-threaded caller sees the same stream as before.
 class RandomRolloutEvaluator : public Evaluator {
  public:
   explicit RandomRolloutEvaluator(int n_rollouts, int seed)
-      : n_rollouts_(n_rollouts), rng_(seed) {}
+      : n_rollouts_(n_rollouts), next_seed_(seed) {}
 
   // Runs random games, returning the average returns.
   std::vector<double> Evaluate(const State& state) override;
@@ -106,8 +120,57 @@ class RandomRolloutEvaluator : public Evaluator {
   ActionsAndProbs Prior(const State& state) override;
 
  private:
+  // Returns the calling thread's generator, creating it on first use. The
+  // node_hash_map keeps references stable across inserts, so the returned
+  // reference stays valid outside the lock.
+  FastRng& GetThreadRNG();
+
   int n_rollouts_;
-  std::mt19937 rng_;
+  int next_seed_;
+  std::mutex rngs_mutex_;
+  absl::node_hash_map<std::thread::id, FastRng> rngs_;
+};
+
+// A rollout evaluator with a depth cutoff. Each rollout plays random actions
+// for at most max_rollout_length decision moves (chance moves are free) and,
+// if the game has not ended by then, scores the position with the leaf
+// evaluator's Evaluate() — typically a cheap static evaluation (e.g.
+// durak::DurakStaticEvaluator). Games whose random playouts run long spend
+// most of their rollout time far past the point where the playout still
+// carries signal; cutting off early trades that tail for more simulations
+// per second at the same time budget.
+//
+// Evaluate is safe to call from multiple threads under the same conditions
+// as RandomRolloutEvaluator (per-thread generators seeded seed, seed + 1,
+// ... in order of first use), provided the leaf evaluator's Evaluate is
+// itself thread-safe.
+class DepthLimitedRolloutEvaluator : public Evaluator {
+ public:
+  DepthLimitedRolloutEvaluator(int n_rollouts, int max_rollout_length,
+                               std::shared_ptr<Evaluator> leaf_evaluator,
+                               int seed)
+      : n_rollouts_(n_rollouts),
+        max_rollout_length_(max_rollout_length),
+        leaf_evaluator_(std::move(leaf_evaluator)),
+        next_seed_(seed) {}
+
+  // Runs depth-limited random games, returning the average of the terminal
+  // returns and the leaf evaluations of the cut-off positions.
+  std::vector<double> Evaluate(const State& state) override;
+
+  // Returns equal probability for each action.
+  ActionsAndProbs Prior(const State& state) override;
+
+ private:
+  // See RandomRolloutEvaluator::GetThreadRNG.
+  FastRng& GetThreadRNG();
+
+  int n_rollouts_;
+  int max_rollout_length_;
+  std::shared_ptr<Evaluator> leaf_evaluator_;
+  int next_seed_;
+  std::mutex rngs_mutex_;
+  absl::node_hash_map<std::thread::id, FastRng> rngs_;
 };
 
 // A node in the search tree for MCTS
@@ -158,6 +221,27 @@ class MCTSBot : public Bot {
   // std::shared_ptr<Evaluator>. This is because using a
   // std::shared_ptr<Evaluator> in the constructor leads to the Julia API test
   // failing. We don't know why right now, but intend to fix this.
+  //
+  // With num_threads > 1, each search runs root-parallel: every thread grows
+  // an independent tree (seeded seed, seed + 1, ...) over the full simulation
+  // budget, and the root-child statistics — visit counts, total rewards, and
+  // proven outcomes — are summed across trees to choose the action. The
+  // max_memory_mb budget is split across the trees, and the evaluator must be
+  // safe to call from multiple threads (RandomRolloutEvaluator is).
+  //
+  // first_play_urgency is the selection value given to an unvisited child.
+  // The default (infinity for UCT, and for PUCT an exploitation term of 0,
+  // matching the classic formulas) makes every child get one visit before any
+  // is revisited. A finite value lets a visited child with a good running
+  // value win the comparison, so simulations concentrate earlier at wide
+  // nodes; values near the game's loss utility make the search greedier.
+  //
+  // progressive_widening_c > 0 enables progressive widening: a node visited
+  // n times only offers its top ceil(c * n^alpha) children (by prior) to the
+  // selection policy, so a small simulation budget is not spread across a
+  // large branching factor. Chance nodes are never widened (the sampled
+  // outcome must always be reachable), and all children are still allocated
+  // up front — widening limits selection, not memory.
   MCTSBot(
       const Game& game, std::shared_ptr<Evaluator> evaluator, double uct_c,
       int max_simulations,
@@ -166,11 +250,77 @@ class MCTSBot : public Bot {
       int seed, bool verbose,
       ChildSelectionPolicy child_selection_policy = ChildSelectionPolicy::UCT,
       double dirichlet_alpha = 0, double dirichlet_epsilon = 0,
-      bool dont_return_chance_node = false);
-  ~MCTSBot() = default;
+      bool dont_return_chance_node = false,
+      int num_threads = 1,
+      double first_play_urgency = std::numeric_limits<double>::infinity(),
+      double progressive_widening_c = 0,      // 0 disables widening.
+      double progressive_widening_alpha = 0.5);
+  ~MCTSBot() override;
+
+  void Restart() override;
+  void RestartAt(const State& state) override { Restart(); }
+
+  // Opt-in subtree reuse across moves. When enabled, the tree is retained
+  // after each search; the next Step compares the state's history against
+  // the previous search's and, when it extends it, advances the root along
+  // the played actions, discarding only the unreachable siblings. The moves
+  // of a match usually land inside the previous tree, so a large fraction of
+  // its simulations carry over for free. Restart()/RestartAt() drop the
+  // retained tree; searches stay independent when reuse is off (default).
+  // Note that with Dirichlet noise a reused root keeps the noise mixed into
+  // its priors at its original expansion.
+  void SetTreeReuse(bool reuse);
+
+  // Opt-in time management for matches played on a per-game clock (off by
+  // default). Each Step is allotted a slice of the remaining clock,
+  // game_time_seconds / moves_horizon at the start of a game and shrinking
+  // proportionally as the clock runs down, and the search stops at the
+  // slice's deadline instead of always running max_simulations (which stays
+  // in force as a cap). Two refinements move the saved time to where it
+  // matters:
+  //   - Early stop: once the most-visited root child leads the runner-up by
+  //     more visits than the remaining slice could still run (at the
+  //     observed simulation rate), the choice can no longer change, so the
+  //     search stops and banks the rest of the slice. Forced and obvious
+  //     moves therefore cost almost nothing.
+  //   - Extension: if the slice expires while the runner-up is within
+  //     close_margin of the leader's visit count, the decision is genuinely
+  //     close and the deadline is extended once, to extension_factor times
+  //     the original slice.
+  // The clock refills to game_time_seconds on Restart()/RestartAt(). Time
+  // management applies to Step/StepWithPolicy; a direct MCTSearch call runs
+  // the plain simulation budget. With num_threads > 1 every tree observes
+  // the same deadline but judges the early stop and the extension on its
+  // own root statistics. Pass game_time_seconds = 0 to switch back off.
+  void SetTimeManagement(double game_time_seconds, int moves_horizon = 40,
+                         double close_margin = 0.1,
+                         double extension_factor = 2.0);
+
+  // Opt-in pondering (off by default; implies tree reuse, which it turns
+  // on). After Step returns its move, a background thread keeps running
+  // simulations on the retained tree — concentrating, through the selection
+  // policy, on the chosen move's subtree and the likely replies — until the
+  // next Step (or Restart/RestartAt/MCTSearch) arrives and stops it; tree
+  // reuse then promotes the subtree matching the actions actually played,
+  // so the opponent's think time turns into extra visits on the positions
+  // the game is heading into. With root parallelism every tree ponders on
+  // its own thread. max_ponder_simulations bounds the background work per
+  // move (0: unlimited); note that an unbounded ponder runs until the next
+  // call on the bot, so call Restart() when a match ends rather than
+  // leaving the bot idle. The per-game clock is not charged for pondering.
+  void SetPondering(bool ponder, int max_ponder_simulations = 0);
+
+  // Seconds left on the per-game clock; meaningful only with time
+  // management enabled.
+  double TimeRemaining() const { return time_remaining_; }
+
+  // Attaches a precomputed opening book (shared across bots). Step answers
+  // from the book — a hash-map probe on the state's infostate hash — before
+  // falling back to search; pass nullptr to detach.
+  void SetOpeningBook(std::shared_ptr<const OpeningBook> book) {
+    opening_book_ = std::move(book);
+  }
 
-  void Restart() override {}
-  void RestartAt(const State& state) override {}
   // Run MCTS for one step, choosing the action, and printing some information.
   Action Step(const State& state) override;
 
@@ -181,9 +331,70 @@ class MCTSBot : public Bot {
       const State& state) override;
 
   // Run MCTS on a given state, and return the resulting search tree.
+  //
+  // The search itself runs on an internal node pool (see PoolNode below); this
+  // materializes the pool into a SearchNode tree for the caller, which costs
+  // one pass over the tree and a transient second copy of it. Callers that
+  // only need the chosen action should use Step, which skips that conversion.
+  //
+  // When root-parallel (num_threads > 1), the returned tree is the primary
+  // thread's tree with the root and its children carrying the statistics
+  // summed across all trees; deeper nodes are the primary tree's own.
   std::unique_ptr<SearchNode> MCTSearch(const State& state);
 
  private:
+  // The node representation the search actually runs on. Nodes live in a
+  // single pool (pool_) owned by the bot and refer to their children by index
+  // rather than by pointer: a node's children occupy the contiguous index
+  // range [first_child, first_child + num_children). This keeps sibling
+  // blocks adjacent in memory for the selection loop, costs no per-node
+  // allocation (outcome only allocates for the rare solved nodes), and makes
+  // teardown between moves a pool_.clear() that keeps the pool's capacity.
+  // Note that appending children can grow the pool, so the search holds
+  // indices, never references, across expansions.
+  struct PoolNode {
+    Action action = kInvalidAction;  // The action taken to get to this node.
+    double prior = 0;             // The prior probability of this action.
+    Player player = 0;            // Which player gets to make this action.
+    int explore_count = 0;        // Number of times this node was explored.
+    double total_reward = 0;      // Total reward passing through this node.
+    uint32_t first_child = 0;     // Pool index of the first child.
+    uint32_t num_children = 0;    // Number of children; 0 if unexpanded.
+    std::vector<double> outcome;  // The reward if each player plays perfectly.
+  };
+
+  // Runs the simulations for one search from the given state, filling pool_
+  // with the resulting tree. The root is pool_[0].
+  void RunSearch(const State& state);
+
+  // One simulation against pool_ rooted at `state`: tree policy to a leaf,
+  // evaluation or terminal returns, value (and proof) backup. The storage
+  // vectors are scratch the caller keeps across simulations. Returns true
+  // when further simulations are pointless: the root is solved or has a
+  // single child.
+  bool SimulateOnce(const State& state,
+                    std::vector<uint32_t>* visit_path_storage,
+                    std::vector<double>* returns_storage);
+
+  // Recycles node storage if the pool has reached the memory cap; the
+  // simulation count only labels the verbose report.
+  void MaybeRecycleNodes(int simulations_done);
+
+  // Pondering (see SetPondering): the background loop, and starting and
+  // stopping it. Every public entry point that touches the pool stops the
+  // ponder thread first, so the search structures are only ever mutated
+  // from one thread at a time.
+  void PonderLoop();
+  void StartPondering(const State& state);
+  void StopPondering();
+
+  // Whether a time-managed search should stop after `simulations_done`
+  // simulations: true at the slice deadline (unless the top-two root
+  // children are close enough to earn the one-off extension) and as soon as
+  // the leader's visit lead is insurmountable. Only called while a timed
+  // window is active (tm_active_).
+  bool TimedSearchStop(int simulations_done);
+
   // Applies the UCT policy to play the game until reaching a leaf node.
   //
   // A leaf node is defined as a node that is terminal or has not been evaluated
@@ -191,16 +402,75 @@ class MCTSBot : public Bot {
   // expanded, then expand it's children and continue.
   //
   // Args:
-  //   root: The root node in the search tree.
+  //   root_index: The pool index of the root node in the search tree.
   //   state: The state of the game at the root node.
-  //   visit_path: A vector of nodes to be filled in descending from the root
-  //     node to a leaf node.
+  //   visit_path: A vector of pool indices to be filled in descending from the
+  //     root node to a leaf node.
   //
   // Returns: The state of the game at the leaf node.
-  std::unique_ptr<State> ApplyTreePolicy(SearchNode* root, const State& state,
-                                         std::vector<SearchNode*>* visit_path);
-
-  void GarbageCollect(SearchNode* node);
+  std::unique_ptr<State> ApplyTreePolicy(uint32_t root_index,
+                                         const State& state,
+                                         std::vector<uint32_t>* visit_path);
+
+  // Child-selection values and the BestChild ordering, on pool nodes. These
+  // mirror the SearchNode methods of the same names.
+  double UCTValue(const PoolNode& child, int parent_explore_count) const;
+  double PUCTValue(const PoolNode& child, int parent_explore_count) const;
+  static bool CompareFinal(const PoolNode& a, const PoolNode& b);
+  uint32_t BestChildIndex(uint32_t parent_index) const;
+
+  // The number of children of `node` the selection policy may consider, under
+  // progressive widening: min(num_children, ceil(c * n^alpha)), at least 1.
+  // Children are stored in prior-descending order when widening is on, so the
+  // considered set is always the highest-prior prefix of the sibling block.
+  uint32_t WidenedChildCount(const PoolNode& node) const;
+
+  // Node recycling under the memory cap. When pool_ storage reaches
+  // max_nodes_, RecycleNodes evicts the subtrees below nodes explored fewer
+  // than gc_limit_ times, pushing their sibling blocks onto a free list;
+  // AllocateChildren then serves new expansions from that list (best fit,
+  // splitting larger blocks) before growing the pool. Storage therefore
+  // stays at the cap while the search keeps expanding, instead of the old
+  // stop-the-world compaction.
+  uint32_t AllocateChildren(uint32_t count);
+  void FreeSubtree(uint32_t first_child, uint32_t num_children);
+  void RecycleNodes();
+
+  // Tree reuse: if the retained pool has a node whose path from the previous
+  // search root matches the actions appended to `state`'s history since
+  // then, re-roots the pool at that node (dropping everything else) and
+  // returns true. Returns false — leaving the pool to be rebuilt — when
+  // there is no retained tree, the history diverged, or the matching node
+  // was never explored.
+  bool AdvanceRootTo(const State& state);
+
+  // Compacts pool_ so that the subtree below `new_root` becomes the whole
+  // pool, with the subtree root at index 0.
+  void ReRoot(uint32_t new_root);
+
+  // Runs the primary search and all root-parallel workers concurrently; each
+  // fills its own pool.
+  void RunParallelSearch(const State& state);
+
+  // Sums the root-child statistics (visits, rewards, first proven outcome)
+  // across the primary pool and all worker pools, keyed by action. Only
+  // meaningful after RunParallelSearch.
+  std::vector<PoolNode> MergedRootChildren() const;
+
+  // Overwrites the statistics of root and its children with the merged
+  // cross-tree statistics.
+  void MergeRootStats(SearchNode* root) const;
+
+  // Converts pool_ into the public SearchNode representation.
+  std::unique_ptr<SearchNode> MaterializeTree() const;
+
+  // Fills last_step_stats_ from the pool(s) built by the search that began
+  // at `start`. Called from Step when stats collection is enabled.
+  void RecordStepStats(absl::Time start);
+
+  int MemoryUsedMb(int nodes) const {
+    return nodes * sizeof(PoolNode) / (1 << 20);
+  }
 
   double uct_c_;
   int max_simulations_;
@@ -213,9 +483,49 @@ class MCTSBot : public Bot {
   double dirichlet_alpha_;
   double dirichlet_epsilon_;
   bool dont_return_chance_node_;
+  double first_play_urgency_;
+  double progressive_widening_c_;
+  double progressive_widening_alpha_;
   std::mt19937 rng_;
   const ChildSelectionPolicy child_selection_policy_;
   std::shared_ptr<Evaluator> evaluator_;
+  std::vector<PoolNode> pool_;      // The current search tree; root at 0.
+  std::vector<PoolNode> gc_pool_;   // Scratch space for ReRoot.
+  // Free list of recycled sibling blocks, keyed by block size (see
+  // RecycleNodes), and the number of pool slots currently on it.
+  std::map<uint32_t, std::vector<uint32_t>> free_blocks_;
+  int free_node_count_ = 0;
+  // Subtree reuse (see SetTreeReuse): whether to retain the tree between
+  // searches, and the history of the state the retained tree was built from.
+  bool reuse_tree_ = false;
+  std::vector<Action> last_search_history_;
+  // Time management (see SetTimeManagement): the per-game clock, the knobs,
+  // and the window of the search in flight. Step sets tm_active_ and the
+  // window before searching and settles the clock after; RunSearch only
+  // consults them.
+  double game_time_budget_ = 0;  // Seconds per game; 0 disables.
+  double time_remaining_ = 0;
+  int tm_moves_horizon_ = 40;
+  double tm_close_margin_ = 0.1;
+  double tm_extension_factor_ = 2.0;
+  bool tm_active_ = false;
+  bool tm_extended_ = false;
+  double tm_slice_seconds_ = 0;
+  absl::Time tm_search_start_;
+  absl::Time tm_deadline_;
+  // Pondering (see SetPondering): configuration, the state the retained
+  // tree is rooted at while the ponder thread runs, and the thread itself
+  // with its stop flag.
+  bool ponder_ = false;
+  int max_ponder_simulations_ = 0;
+  std::atomic<bool> ponder_stop_{false};
+  std::unique_ptr<State> ponder_state_;
+  std::unique_ptr<Thread> ponder_thread_;
+  // Optional opening book probed at the top of Step.
+  std::shared_ptr<const OpeningBook> opening_book_;
+  // Root-parallel worker bots (num_threads - 1 of them), each single-threaded
+  // with its own pool and rng; empty when num_threads == 1.
+  std::vector<std::unique_ptr<MCTSBot>> workers_;
 };
 
 // Returns a vector of noise sampled from a dirichlet distribution. See:
@@ -14,8 +14,13 @@
 
 #include "open_spiel/algorithms/mcts.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <random>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
@@ -152,7 +157,7 @@ void MCTSTest_SolveWin() {
   SPIEL_CHECK_EQ(state->ActionToString(best.player, best.action), "x(0,2)");
 }
 
-void MCTSTest_GarbageCollect() {
+void MCTSTest_NodeRecycling() {
   auto game = LoadGame("tic_tac_toe");
   std::unique_ptr<State> state = game->NewInitialState();
   auto evaluator = std::make_shared<RandomRolloutEvaluator>(1, 42);
@@ -167,6 +172,282 @@ void MCTSTest_GarbageCollect() {
                    root->explore_count == 1000000);
 }
 
+void MCTSTest_RootParallelSearch() {
+  auto game = LoadGame("tic_tac_toe");
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  algorithms::MCTSBot bot(*game, evaluator, UCT_C,
+                          /*max_simulations=*/ 2500,
+                          /*max_memory_mb=*/ 10,
+                          /*solve=*/ true,
+                          /*seed=*/ 42,
+                          /*verbose=*/ false,
+                          algorithms::ChildSelectionPolicy::UCT,
+                          /*dirichlet_alpha=*/ 0,
+                          /*dirichlet_epsilon=*/ 0,
+                          /*dont_return_chance_node=*/ false,
+                          /*num_threads=*/ 4);
+  // A position where x wins by playing x(0,2); every tree should prove it, and
+  // the merged statistics must still pick it.
+  std::unique_ptr<State> state = game->NewInitialState();
+  for (const auto& action_str : {"x(0,1)", "o(2,2)"})
+    state->ApplyAction(GetAction(*state, action_str));
+  std::unique_ptr<algorithms::SearchNode> root = bot.MCTSearch(*state);
+  SPIEL_CHECK_EQ(root->outcome[root->player], 1);
+  const algorithms::SearchNode& best = root->BestChild();
+  SPIEL_CHECK_EQ(best.outcome[best.player], 1);
+  // The merged fast path in Step must return a legal action too.
+  open_spiel::Action step_action = bot.Step(*state);
+  std::vector<open_spiel::Action> legal_actions = state->LegalActions();
+  SPIEL_CHECK_TRUE(std::find(legal_actions.begin(), legal_actions.end(),
+                             step_action) != legal_actions.end());
+}
+
+void MCTSTest_PoolReuseAcrossSearches() {
+  // The node pool is reset and reused between searches; back-to-back searches
+  // from different states with one bot must not see each other's trees.
+  auto game = LoadGame("tic_tac_toe");
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  algorithms::MCTSBot bot(*game, evaluator, UCT_C,
+                          /*max_simulations=*/ 10000,
+                          /*max_memory_mb=*/ 10,
+                          /*solve=*/ true,
+                          /*seed=*/ 42,
+                          /*verbose=*/ false);
+  // A won position for x, then a drawn position; both must be solved exactly.
+  std::unique_ptr<State> win_state = game->NewInitialState();
+  for (const auto& action_str : {"x(0,1)", "o(2,2)"})
+    win_state->ApplyAction(GetAction(*win_state, action_str));
+  std::unique_ptr<algorithms::SearchNode> root = bot.MCTSearch(*win_state);
+  SPIEL_CHECK_EQ(root->outcome[root->player], 1);
+
+  std::unique_ptr<State> draw_state = game->NewInitialState();
+  for (const auto& action_str : {"x(1,1)", "o(0,0)", "x(2,2)"})
+    draw_state->ApplyAction(GetAction(*draw_state, action_str));
+  root = bot.MCTSearch(*draw_state);
+  SPIEL_CHECK_EQ(root->outcome[root->player], 0);
+}
+
+void MCTSTest_TreeReuse() {
+  auto game = LoadGame("tic_tac_toe");
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  algorithms::MCTSBot bot(*game, evaluator, UCT_C,
+                          /*max_simulations=*/ 100,
+                          /*max_memory_mb=*/ 10,
+                          /*solve=*/ false,
+                          /*seed=*/ 42,
+                          /*verbose=*/ false);
+  bot.SetTreeReuse(true);
+  bot.SetCollectStepStats(true);
+
+  // Play a full game where the bot moves as x; after the first move every
+  // search root lands inside the previous tree, so the retained simulations
+  // show up on top of the per-step budget.
+  std::unique_ptr<State> state = game->NewInitialState();
+  std::mt19937 rng(17);
+  bool reused_some = false;
+  int steps = 0;
+  while (!state->IsTerminal()) {
+    if (state->CurrentPlayer() == 0) {
+      open_spiel::Action action = bot.Step(*state);
+      std::vector<open_spiel::Action> legal_actions = state->LegalActions();
+      SPIEL_CHECK_TRUE(std::find(legal_actions.begin(), legal_actions.end(),
+                                 action) != legal_actions.end());
+      if (++steps > 1 && bot.GetLastStepStats().simulations > 100) {
+        reused_some = true;
+      }
+      state->ApplyAction(action);
+    } else {
+      std::vector<open_spiel::Action> legal_actions = state->LegalActions();
+      state->ApplyAction(legal_actions[rng() % legal_actions.size()]);
+    }
+  }
+  SPIEL_CHECK_TRUE(reused_some);
+
+  // Restart drops the retained tree: the next step is a fresh search.
+  bot.Restart();
+  std::unique_ptr<State> fresh = game->NewInitialState();
+  bot.Step(*fresh);
+  SPIEL_CHECK_EQ(bot.GetLastStepStats().simulations, 100);
+}
+
+void MCTSTest_Pondering() {
+  auto game = LoadGame("tic_tac_toe");
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  {
+    algorithms::MCTSBot bot(*game, evaluator, UCT_C,
+                            /*max_simulations=*/ 50,
+                            /*max_memory_mb=*/ 10,
+                            /*solve=*/ false,
+                            /*seed=*/ 42,
+                            /*verbose=*/ false);
+    bot.SetCollectStepStats(true);
+    bot.SetPondering(true);  // Implies tree reuse.
+
+    // Play as x against random moves, sleeping during the "opponent's"
+    // turn so the ponder thread gets think time. Pondered simulations land
+    // in the retained tree and show up in later steps' counts on top of
+    // the per-step budget.
+    std::unique_ptr<State> state = game->NewInitialState();
+    std::mt19937 rng(17);
+    bool extra_simulations = false;
+    while (!state->IsTerminal()) {
+      if (state->CurrentPlayer() == 0) {
+        open_spiel::Action action = bot.Step(*state);
+        std::vector<open_spiel::Action> legal_actions = state->LegalActions();
+        SPIEL_CHECK_TRUE(std::find(legal_actions.begin(), legal_actions.end(),
+                                   action) != legal_actions.end());
+        if (bot.GetLastStepStats().simulations > 50) {
+          extra_simulations = true;
+        }
+        state->ApplyAction(action);
+      } else {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::vector<open_spiel::Action> legal_actions = state->LegalActions();
+        state->ApplyAction(legal_actions[rng() % legal_actions.size()]);
+      }
+    }
+    SPIEL_CHECK_TRUE(extra_simulations);
+
+    // Restart stops the ponder thread and drops the tree, so the next step
+    // is exactly one fresh budget.
+    bot.Restart();
+    std::unique_ptr<State> fresh = game->NewInitialState();
+    bot.Step(*fresh);
+    SPIEL_CHECK_EQ(bot.GetLastStepStats().simulations, 50);
+    // Leaving scope while the post-step ponder runs: the destructor joins.
+  }
+
+  // A capped ponder finishes on its own; the next step still joins cleanly
+  // and a root-parallel bot ponders one thread per tree.
+  algorithms::MCTSBot parallel_bot(*game, evaluator, UCT_C,
+                                   /*max_simulations=*/ 50,
+                                   /*max_memory_mb=*/ 10,
+                                   /*solve=*/ false,
+                                   /*seed=*/ 42,
+                                   /*verbose=*/ false,
+                                   algorithms::ChildSelectionPolicy::UCT,
+                                   /*dirichlet_alpha=*/ 0,
+                                   /*dirichlet_epsilon=*/ 0,
+                                   /*dont_return_chance_node=*/ false,
+                                   /*num_threads=*/ 3);
+  parallel_bot.SetPondering(true, /*max_ponder_simulations=*/ 25);
+  std::unique_ptr<State> state = game->NewInitialState();
+  open_spiel::Action first = parallel_bot.Step(*state);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  state->ApplyAction(first);
+  state->ApplyAction(state->LegalActions()[0]);
+  open_spiel::Action second = parallel_bot.Step(*state);
+  std::vector<open_spiel::Action> legal_actions = state->LegalActions();
+  SPIEL_CHECK_TRUE(std::find(legal_actions.begin(), legal_actions.end(),
+                             second) != legal_actions.end());
+}
+
+void MCTSTest_ProgressiveWideningAndFPU() {
+  auto game = LoadGame("tic_tac_toe");
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  // Aggressive widening and a finite first-play urgency; the search must
+  // still play legally and, with solving on, still prove a forced win —
+  // widening only delays when children enter the selection window.
+  algorithms::MCTSBot bot(*game, evaluator, UCT_C,
+                          /*max_simulations=*/ 10000,
+                          /*max_memory_mb=*/ 10,
+                          /*solve=*/ true,
+                          /*seed=*/ 42,
+                          /*verbose=*/ false,
+                          algorithms::ChildSelectionPolicy::UCT,
+                          /*dirichlet_alpha=*/ 0,
+                          /*dirichlet_epsilon=*/ 0,
+                          /*dont_return_chance_node=*/ false,
+                          /*num_threads=*/ 1,
+                          /*first_play_urgency=*/ 0.5,
+                          /*progressive_widening_c=*/ 1,
+                          /*progressive_widening_alpha=*/ 0.4);
+  std::unique_ptr<State> state = game->NewInitialState();
+  for (const auto& action_str : {"x(0,1)", "o(2,2)"})
+    state->ApplyAction(GetAction(*state, action_str));
+  std::unique_ptr<algorithms::SearchNode> root = bot.MCTSearch(*state);
+  SPIEL_CHECK_EQ(root->outcome[root->player], 1);
+  const algorithms::SearchNode& best = root->BestChild();
+  SPIEL_CHECK_EQ(best.outcome[best.player], 1);
+
+  // Self-play with PUCT + both knobs from the opening stays legal and zero-sum,
+  // including through a chance-free full game.
+  algorithms::MCTSBot puct_bot(*game, evaluator, UCT_C,
+                               /*max_simulations=*/ 100,
+                               /*max_memory_mb=*/ 5,
+                               /*solve=*/ false,
+                               /*seed=*/ 7,
+                               /*verbose=*/ false,
+                               algorithms::ChildSelectionPolicy::PUCT,
+                               /*dirichlet_alpha=*/ 0,
+                               /*dirichlet_epsilon=*/ 0,
+                               /*dont_return_chance_node=*/ false,
+                               /*num_threads=*/ 1,
+                               /*first_play_urgency=*/ -0.2,
+                               /*progressive_widening_c=*/ 2,
+                               /*progressive_widening_alpha=*/ 0.5);
+  auto results = EvaluateBots(game->NewInitialState().get(),
+                              {&puct_bot, &puct_bot}, 42);
+  SPIEL_CHECK_EQ(results[0] + results[1], 0);
+}
+
+void MCTSTest_TimeManagement() {
+  auto game = LoadGame("tic_tac_toe");
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(1, 42);
+  // A simulation cap far beyond what the clock allows: every step must be
+  // cut short by its time slice (or the early stop), never by the cap.
+  algorithms::MCTSBot bot(*game, evaluator, UCT_C,
+                          /*max_simulations=*/ 10000000,
+                          /*max_memory_mb=*/ 10,
+                          /*solve=*/ false,
+                          /*seed=*/ 42,
+                          /*verbose=*/ false);
+  bot.SetTimeManagement(/*game_time_seconds=*/ 0.5, /*moves_horizon=*/ 10);
+  bot.SetCollectStepStats(true);
+  SPIEL_CHECK_EQ(bot.TimeRemaining(), 0.5);
+
+  std::unique_ptr<State> state = game->NewInitialState();
+  double previous_remaining = bot.TimeRemaining();
+  while (!state->IsTerminal()) {
+    open_spiel::Action action = bot.Step(*state);
+    std::vector<open_spiel::Action> legal_actions = state->LegalActions();
+    SPIEL_CHECK_TRUE(std::find(legal_actions.begin(), legal_actions.end(),
+                               action) != legal_actions.end());
+    SPIEL_CHECK_LT(bot.GetLastStepStats().simulations, 10000000);
+    // Each move spends clock; the clock never goes negative.
+    SPIEL_CHECK_LT(bot.TimeRemaining(), previous_remaining);
+    SPIEL_CHECK_GE(bot.TimeRemaining(), 0.0);
+    previous_remaining = bot.TimeRemaining();
+    state->ApplyAction(action);
+  }
+
+  // Restart is a fresh game: the clock refills.
+  bot.Restart();
+  SPIEL_CHECK_EQ(bot.TimeRemaining(), 0.5);
+}
+
+void MCTSTest_StepStats() {
+  auto game = LoadGame("tic_tac_toe");
+  const int max_simulations = 100;
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(20, 42);
+  auto bot = InitBot(*game, max_simulations, evaluator);
+  std::unique_ptr<State> state = game->NewInitialState();
+
+  // Collection is off by default: the struct stays zero-initialized.
+  bot->Step(*state);
+  SPIEL_CHECK_EQ(bot->GetLastStepStats().simulations, 0);
+  SPIEL_CHECK_EQ(bot->GetLastStepStats().nodes_expanded, 0);
+
+  bot->SetCollectStepStats(true);
+  bot->Step(*state);
+  const BotStepStats& stats = bot->GetLastStepStats();
+  SPIEL_CHECK_GT(stats.wall_time_seconds, 0.0);
+  // From the empty board nothing is solved in 100 simulations, so the root
+  // is visited exactly once per simulation.
+  SPIEL_CHECK_EQ(stats.simulations, max_simulations);
+  SPIEL_CHECK_GT(stats.nodes_expanded, 1);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -179,5 +460,12 @@ int main(int argc, char** argv) {
   open_spiel::MCTSTest_SolveDraw();
   open_spiel::MCTSTest_SolveLoss();
   open_spiel::MCTSTest_SolveWin();
-  open_spiel::MCTSTest_GarbageCollect();
+  open_spiel::MCTSTest_NodeRecycling();
+  open_spiel::MCTSTest_PoolReuseAcrossSearches();
+  open_spiel::MCTSTest_RootParallelSearch();
+  open_spiel::MCTSTest_TreeReuse();
+  open_spiel::MCTSTest_Pondering();
+  open_spiel::MCTSTest_ProgressiveWideningAndFPU();
+  open_spiel::MCTSTest_TimeManagement();
+  open_spiel::MCTSTest_StepStats();
 }
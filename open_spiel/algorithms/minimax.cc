@@ -15,9 +15,12 @@
 #include "open_spiel/algorithms/minimax.h"
 
 #include <algorithm>  // std::max
+#include <cstdint>
 #include <limits>
 #include <memory>
+#include <utility>
 
+#include "open_spiel/algorithms/transposition_table.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 
@@ -43,13 +46,16 @@ namespace {
 //   maximizing_player_id: The id of the MAX player. The other player is assumed
 //     to be MIN.
 //   use_undo: use the State::Undo for faster run-time.
+//   transposition_table: optional cache of interior-node results; see
+//     transposition_table.h. nullptr disables caching.
 //
 // Returns:
 //   The optimal value of the sub-game starting in state (given alpha/beta).
 double _alpha_beta(State* state, int depth, double alpha, double beta,
                    std::function<double(const State&)> value_function,
                    Player maximizing_player, Action* best_action,
-                   bool use_undo) {
+                   bool use_undo,
+                   TranspositionTable* transposition_table) {
   if (state->IsTerminal()) {
     return state->PlayerReturn(maximizing_player);
   }
@@ -60,13 +66,40 @@ double _alpha_beta(State* state, int depth, double alpha, double beta,
         "Try increasing depth or provide a value_function.");
   }
 
+  // Only interior nodes go through the table: the root must run its full
+  // loop so that best_action is always filled in.
+  const bool use_table =
+      transposition_table != nullptr && best_action == nullptr;
+  uint64_t key = 0;
+  if (use_table) {
+    key = TranspositionTable::KeyFor(*state);
+    TranspositionTable::Entry entry;
+    if (transposition_table->Lookup(key, &entry) && entry.depth >= depth) {
+      if (entry.bound == TranspositionTable::kExact) return entry.value;
+      if (entry.bound == TranspositionTable::kLowerBound) {
+        alpha = std::max(alpha, entry.value);
+      } else {
+        beta = std::min(beta, entry.value);
+      }
+      if (alpha >= beta) return entry.value;
+    }
+  }
+
   if (depth == 0) {
-    return value_function(*state);
+    double value = value_function(*state);
+    if (use_table) {
+      transposition_table->Store(
+          key, {/*depth=*/0, TranspositionTable::kExact, value, {}});
+    }
+    return value;
   }
 
+  const double original_alpha = alpha;
+  const double original_beta = beta;
+  double value;
   Player player = state->CurrentPlayer();
   if (player == maximizing_player) {
-    double value = -std::numeric_limits<double>::infinity();
+    value = -std::numeric_limits<double>::infinity();
 
     for (Action action : state->LegalActions()) {
       double child_value = 0;
@@ -75,14 +108,16 @@ double _alpha_beta(State* state, int depth, double alpha, double beta,
         child_value =
             _alpha_beta(state, /*depth=*/depth - 1, /*alpha=*/alpha,
                         /*beta=*/beta, value_function, maximizing_player,
-                        /*best_action=*/nullptr, use_undo);
+                        /*best_action=*/nullptr, use_undo,
+                        transposition_table);
         state->UndoAction(player, action);
       } else {
         std::unique_ptr<State> child_state = state->Child(action);
         child_value =
             _alpha_beta(child_state.get(), /*depth=*/depth - 1, /*alpha=*/alpha,
                         /*beta=*/beta, value_function, maximizing_player,
-                        /*best_action=*/nullptr, use_undo);
+                        /*best_action=*/nullptr, use_undo,
+                        transposition_table);
       }
 
       if (child_value > value) {
@@ -97,10 +132,8 @@ double _alpha_beta(State* state, int depth, double alpha, double beta,
         break;  // beta cut-off
       }
     }
-
-    return value;
   } else {
-    double value = std::numeric_limits<double>::infinity();
+    value = std::numeric_limits<double>::infinity();
 
     for (Action action : state->LegalActions()) {
       double child_value = 0;
@@ -109,14 +142,16 @@ double _alpha_beta(State* state, int depth, double alpha, double beta,
         child_value =
             _alpha_beta(state, /*depth=*/depth - 1, /*alpha=*/alpha,
                         /*beta=*/beta, value_function, maximizing_player,
-                        /*best_action=*/nullptr, use_undo);
+                        /*best_action=*/nullptr, use_undo,
+                        transposition_table);
         state->UndoAction(player, action);
       } else {
         std::unique_ptr<State> child_state = state->Child(action);
         child_value =
             _alpha_beta(child_state.get(), /*depth=*/depth - 1, /*alpha=*/alpha,
                         /*beta=*/beta, value_function, maximizing_player,
-                        /*best_action=*/nullptr, use_undo);
+                        /*best_action=*/nullptr, use_undo,
+                        transposition_table);
       }
 
       if (child_value < value) {
@@ -131,27 +166,57 @@ double _alpha_beta(State* state, int depth, double alpha, double beta,
         break;  // alpha cut-off
       }
     }
+  }
 
-    return value;
+  if (use_table) {
+    TranspositionTable::Entry entry;
+    entry.depth = depth;
+    entry.value = value;
+    if (value <= original_alpha) {
+      entry.bound = TranspositionTable::kUpperBound;
+    } else if (value >= original_beta) {
+      entry.bound = TranspositionTable::kLowerBound;
+    } else {
+      entry.bound = TranspositionTable::kExact;
+    }
+    transposition_table->Store(key, std::move(entry));
   }
+  return value;
 }
 
-// Expectiminimax algorithm.
+// Expectiminimax algorithm with alpha-beta windows and Star1 chance-node
+// pruning.
 //
-// Runs expectiminimax until the specified depth.
-// See https://en.wikipedia.org/wiki/Expectiminimax for details.
+// Runs expectiminimax until the specified depth. Decision nodes take the
+// usual alpha-beta cutoffs. When the search runs to terminals (no value
+// function), every node value lies in [min_utility, max_utility], and a
+// chance node can bound its expectation while resolving outcomes: each
+// remaining outcome is assumed at its utility extreme, the expectation is
+// cut off as soon as even the extremes cannot bring it back inside the
+// window, and each child is searched with the tightest window under which
+// its value can still matter (Ballard, "The *-minimax search procedure for
+// trees containing chance nodes", 1983). Outcomes are resolved in
+// descending probability order so the most mass — and hence the most
+// bound-tightening — comes first. With a value function the chance windows
+// are not sound (its range need not respect the game's utility bounds), so
+// chance nodes fall back to the full expectation over children searched
+// with open windows; pruning still applies within decision-node chains.
 //
 // Arguments:
 //   state: The state to start the search from.
 //   depth: The depth of the search (not counting chance nodes).
+//   alpha/beta: the current search window, in terms of maximizing_player.
+//   min_utility/max_utility: the game's terminal utility range.
 //   value_function: A value function, taking in a state and returning a value,
 //     in terms of the maximizing_player_id.
 //   maximizing_player_id: The player running the search (current player at root
 //     of the search tree).
 //
 // Returns:
-//   The optimal value of the sub-game starting in state.
-double _expectiminimax(const State* state, int depth,
+//   The optimal value of the sub-game starting in state (given alpha/beta;
+//   on a cutoff the returned value is a bound in the cutoff's direction).
+double _expectiminimax(const State* state, int depth, double alpha,
+                       double beta, double min_utility, double max_utility,
                        std::function<double(const State&)> value_function,
                        Player maximizing_player, Action* best_action) {
   if (state->IsTerminal()) {
@@ -170,23 +235,72 @@ double _expectiminimax(const State* state, int depth,
 
   Player player = state->CurrentPlayer();
   if (state->IsChanceNode()) {
-    double value = 0;
-    for (const auto& actionprob : state->ChanceOutcomes()) {
-      std::unique_ptr<State> child_state = state->Child(actionprob.first);
-      double child_value =
-          _expectiminimax(child_state.get(), depth, value_function,
-                          maximizing_player, /*best_action=*/nullptr);
-      value += actionprob.second * child_value;
+    if (value_function) {
+      // Unbounded node values: exact expectation, children searched with
+      // open windows (a pruned child would return a bound, which must not
+      // enter an expectation).
+      double value = 0;
+      const double infinity = std::numeric_limits<double>::infinity();
+      for (const auto& actionprob : state->ChanceOutcomes()) {
+        std::unique_ptr<State> child_state = state->Child(actionprob.first);
+        double child_value = _expectiminimax(
+            child_state.get(), depth, /*alpha=*/-infinity, /*beta=*/infinity,
+            min_utility, max_utility, value_function, maximizing_player,
+            /*best_action=*/nullptr);
+        value += actionprob.second * child_value;
+      }
+      return value;
     }
-    return value;
+    // Star1. Highest-probability outcomes first: the sooner most of the
+    // probability mass is resolved, the sooner the extreme-value bounds on
+    // the rest become decisive. The action tie-break keeps the order (and
+    // the summation) deterministic.
+    ActionsAndProbs outcomes = state->ChanceOutcomes();
+    std::sort(outcomes.begin(), outcomes.end(),
+              [](const std::pair<Action, double>& a,
+                 const std::pair<Action, double>& b) {
+                return a.second > b.second ||
+                       (a.second == b.second && a.first < b.first);
+              });
+    double weighted_sum = 0;
+    double remaining = 1;  // Outcome probabilities sum to one.
+    for (const auto& [outcome, prob] : outcomes) {
+      // The tightest child window under which this child's value can still
+      // move the expectation inside (alpha, beta), assuming every
+      // unresolved outcome lands at its utility extreme. A child value at
+      // or outside the window makes the matching cutoff below fire.
+      const double others_max = weighted_sum + (remaining - prob) * max_utility;
+      const double others_min = weighted_sum + (remaining - prob) * min_utility;
+      const double child_alpha =
+          std::max(min_utility, (alpha - others_max) / prob);
+      const double child_beta =
+          std::min(max_utility, (beta - others_min) / prob);
+      std::unique_ptr<State> child_state = state->Child(outcome);
+      const double child_value = _expectiminimax(
+          child_state.get(), depth, child_alpha, child_beta, min_utility,
+          max_utility, value_function, maximizing_player,
+          /*best_action=*/nullptr);
+      weighted_sum += prob * child_value;
+      remaining -= prob;
+      // Cut off on the proven bound: even the extremes for the unresolved
+      // outcomes cannot bring the expectation back inside the window.
+      if (weighted_sum + remaining * max_utility <= alpha) {
+        return weighted_sum + remaining * max_utility;
+      }
+      if (weighted_sum + remaining * min_utility >= beta) {
+        return weighted_sum + remaining * min_utility;
+      }
+    }
+    return weighted_sum;
   } else if (player == maximizing_player) {
     double value = -std::numeric_limits<double>::infinity();
 
     for (Action action : state->LegalActions()) {
       std::unique_ptr<State> child_state = state->Child(action);
       double child_value = _expectiminimax(child_state.get(),
-                                           /*depth=*/depth - 1, value_function,
-                                           maximizing_player,
+                                           /*depth=*/depth - 1, alpha, beta,
+                                           min_utility, max_utility,
+                                           value_function, maximizing_player,
                                            /*best_action=*/nullptr);
 
       if (child_value > value) {
@@ -195,6 +309,11 @@ double _expectiminimax(const State* state, int depth,
           *best_action = action;
         }
       }
+
+      alpha = std::max(alpha, value);
+      if (alpha >= beta) {
+        break;  // beta cut-off
+      }
     }
     return value;
   } else {
@@ -203,8 +322,9 @@ double _expectiminimax(const State* state, int depth,
     for (Action action : state->LegalActions()) {
       std::unique_ptr<State> child_state = state->Child(action);
       double child_value = _expectiminimax(child_state.get(),
-                                           /*depth=*/depth - 1, value_function,
-                                           maximizing_player,
+                                           /*depth=*/depth - 1, alpha, beta,
+                                           min_utility, max_utility,
+                                           value_function, maximizing_player,
                                            /*best_action=*/nullptr);
 
       if (child_value < value) {
@@ -213,6 +333,11 @@ double _expectiminimax(const State* state, int depth,
           *best_action = action;
         }
       }
+
+      beta = std::min(beta, value);
+      if (alpha >= beta) {
+        break;  // alpha cut-off
+      }
     }
     return value;
   }
@@ -222,7 +347,8 @@ double _expectiminimax(const State* state, int depth,
 std::pair<double, Action> AlphaBetaSearch(
     const Game& game, const State* state,
     std::function<double(const State&)> value_function, int depth_limit,
-    Player maximizing_player, bool use_undo) {
+    Player maximizing_player, bool use_undo,
+    TranspositionTable* transposition_table) {
   SPIEL_CHECK_LE(game.NumPlayers(), 2);
 
   // Check to ensure the correct setup intended for this algorithm.
@@ -250,7 +376,7 @@ std::pair<double, Action> AlphaBetaSearch(
   double value = _alpha_beta(
       search_root.get(), /*depth=*/depth_limit, /*alpha=*/-infinity,
       /*beta=*/infinity, value_function, maximizing_player, &best_action,
-      use_undo);
+      use_undo, transposition_table);
 
   return {value, best_action};
 }
@@ -282,10 +408,12 @@ std::pair<double, Action> ExpectiminimaxSearch(
     maximizing_player = search_root->CurrentPlayer();
   }
 
+  double infinity = std::numeric_limits<double>::infinity();
   Action best_action = kInvalidAction;
-  double value =
-      _expectiminimax(search_root.get(), /*depth=*/depth_limit, value_function,
-                      maximizing_player, &best_action);
+  double value = _expectiminimax(
+      search_root.get(), /*depth=*/depth_limit, /*alpha=*/-infinity,
+      /*beta=*/infinity, game.MinUtility(), game.MaxUtility(), value_function,
+      maximizing_player, &best_action);
 
   return {value, best_action};
 }
@@ -18,6 +18,7 @@
 #include <memory>
 #include <utility>
 
+#include "open_spiel/algorithms/transposition_table.h"
 #include "open_spiel/spiel.h"
 
 namespace open_spiel {
@@ -37,6 +38,10 @@ namespace algorithms {
 //   maximizing_player_id: The id of the MAX player. The other player is assumed
 //     to be MIN. Passing in kInvalidPlayer will set this to the search root's
 //     current player.
+//   transposition_table: An optional table caching interior-node results, so
+//     positions reached through several move orders (or shared across
+//     searches, e.g. PIMC determinizations) are evaluated once. See
+//     transposition_table.h; pass nullptr for no caching.
 
 //   Returns:
 //     A pair of the value of the game for the maximizing player when both
@@ -45,10 +50,22 @@ namespace algorithms {
 std::pair<double, Action> AlphaBetaSearch(
     const Game& game, const State* state,
     std::function<double(const State&)> value_function, int depth_limit,
-    Player maximizing_player, bool use_undo = true);
+    Player maximizing_player, bool use_undo = true,
+    TranspositionTable* transposition_table = nullptr);
 
 // Solves stochastic, 2-players, perfect-information 0-sum game.
 //
+// Decision nodes are searched with alpha-beta cutoffs. When no value function
+// is given (the search runs to terminals), chance nodes additionally apply
+// Star1 pruning (Ballard 1983): the window is propagated through each
+// expectation using the game's MinUtility/MaxUtility as bounds on the
+// unresolved outcomes, and outcomes are visited in descending probability
+// order so the bounds tighten as early as possible. The returned value and
+// action are the same as for the unpruned search; only fewer nodes are
+// expanded. With a value function, chance-node pruning is disabled (the
+// function's range need not respect the game's utility bounds), but
+// alpha-beta cutoffs at decision nodes still apply.
+//
 // Arguments:
 //   game: The game to analyze, as returned by `LoadGame`.
 //   state: The state to start from. If nullptr, starts from initial state.
@@ -14,7 +14,9 @@
 
 #include "open_spiel/algorithms/minimax.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "open_spiel/games/pig/pig.h"
 #include "open_spiel/games/tic_tac_toe/tic_tac_toe.h"
@@ -81,6 +83,46 @@ void ExpectiminimaxSearchTest_Pig() {
   SPIEL_CHECK_EQ(/*kRoll=*/0, value_and_action.second);
 }
 
+// Unpruned expectiminimax, the ground truth the Star1-pruned search must
+// reproduce.
+double FullExpectiminimax(const State& state, Player maximizing_player) {
+  if (state.IsTerminal()) {
+    return state.PlayerReturn(maximizing_player);
+  }
+  if (state.IsChanceNode()) {
+    double value = 0;
+    for (const auto& [action, prob] : state.ChanceOutcomes()) {
+      value += prob * FullExpectiminimax(*state.Child(action),
+                                         maximizing_player);
+    }
+    return value;
+  }
+  double value = state.CurrentPlayer() == maximizing_player
+                     ? -std::numeric_limits<double>::infinity()
+                     : std::numeric_limits<double>::infinity();
+  for (Action action : state.LegalActions()) {
+    double child_value =
+        FullExpectiminimax(*state.Child(action), maximizing_player);
+    value = state.CurrentPlayer() == maximizing_player
+                ? std::max(value, child_value)
+                : std::min(value, child_value);
+  }
+  return value;
+}
+
+void ExpectiminimaxSearchTest_Pig_StarPruningMatchesFullExpansion() {
+  // Small enough to solve to terminals; the pruned search must return the
+  // exact game value despite cutting off chance and decision subtrees.
+  std::shared_ptr<const Game> game =
+      LoadGame("pig", {{"winscore", GameParameter(3)},
+                       {"diceoutcomes", GameParameter(2)},
+                       {"horizon", GameParameter(8)}});
+  double reference = FullExpectiminimax(*game->NewInitialState(), Player{0});
+  std::pair<double, Action> value_and_action =
+      ExpectiminimaxSearch(*game, nullptr, {}, -1, Player{0});
+  SPIEL_CHECK_FLOAT_NEAR(value_and_action.first, reference, 1e-12);
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -90,4 +132,6 @@ int main(int argc, char **argv) {
   open_spiel::algorithms::AlphaBetaSearchTest_TicTacToe_Win();
   open_spiel::algorithms::AlphaBetaSearchTest_TicTacToe_Loss();
   open_spiel::algorithms::ExpectiminimaxSearchTest_Pig();
+  open_spiel::algorithms::
+      ExpectiminimaxSearchTest_Pig_StarPruningMatchesFullExpansion();
 }
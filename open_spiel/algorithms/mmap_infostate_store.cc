@@ -0,0 +1,303 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/mmap_infostate_store.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+#include <cstring>
+#include <fstream>
+
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// File layout: Header, then capacity slots. Each slot is
+//   uint64_t key (0 = empty)
+//   int32_t num_actions
+//   int32_t actions[max_actions]
+//   CFRValue cumulative_regrets[max_actions]
+//   CFRValue cumulative_policy[max_actions]
+// packed without padding (all offsets are 8- or 4-byte aligned by
+// construction since max_actions is rounded up to even in the constructor).
+struct Header {
+  uint64_t magic;
+  int64_t capacity;
+  int32_t max_actions;
+  int32_t padding;
+  int64_t num_entries;
+};
+
+// "OSMCCFR1" for double tables, "OSMCCFR2" for float32 tables
+// (OPEN_SPIEL_CFR_FLOAT32_VALUES); the distinct magic keeps a build from
+// silently reinterpreting a store written by the other mode.
+constexpr uint64_t kStoreMagic =
+    0x4f53'4d43'4346'5230ULL + (sizeof(CFRValue) == 4 ? 2 : 1);
+
+// Beyond this load factor linear probe chains degrade sharply; better to die
+// with a clear message than to quietly grind.
+constexpr double kMaxLoadFactor = 0.9;
+
+uint64_t SlotKey(const char* slot) {
+  uint64_t key;
+  std::memcpy(&key, slot, sizeof(key));
+  return key;
+}
+
+#ifdef __linux__
+// Returns a bitmask of the online NUMA nodes ("0-1,4" style list from
+// sysfs), or 0 if it cannot be determined or only one node is online.
+uint64_t OnlineNumaNodeMask() {
+  std::ifstream online("/sys/devices/system/node/online");
+  std::string list;
+  if (!online || !std::getline(online, list)) return 0;
+  uint64_t mask = 0;
+  for (absl::string_view range : absl::StrSplit(list, ',')) {
+    int lo, hi;
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    if (!absl::SimpleAtoi(bounds.first, &lo)) return 0;
+    if (bounds.second.empty()) {
+      hi = lo;
+    } else if (!absl::SimpleAtoi(bounds.second, &hi)) {
+      return 0;
+    }
+    if (lo < 0 || hi < lo || hi >= 64) return 0;
+    for (int node = lo; node <= hi; ++node) mask |= uint64_t{1} << node;
+  }
+  // A single node means there is nothing to interleave over.
+  return (mask & (mask - 1)) == 0 ? 0 : mask;
+}
+#endif  // __linux__
+
+// Applies the requested placement advisories to a fresh mapping. Failures
+// are deliberately ignored: both options only affect performance, and the
+// mapping is fully usable with default placement.
+void ApplyPlacement(void* addr, int64_t length,
+                    const MmapStoreOptions& options) {
+#ifdef __linux__
+  if (options.huge_pages) {
+#ifdef MADV_HUGEPAGE
+    ::madvise(addr, length, MADV_HUGEPAGE);
+#endif
+  }
+  if (options.numa_interleave) {
+#ifdef SYS_mbind
+    uint64_t nodemask = OnlineNumaNodeMask();
+    if (nodemask != 0) {
+      constexpr int kMpolInterleave = 3;  // MPOL_INTERLEAVE from numaif.h.
+      // maxnode counts one past the highest representable node bit. Called
+      // directly to avoid a libnuma dependency.
+      ::syscall(SYS_mbind, addr, length, kMpolInterleave, &nodemask,
+                sizeof(nodemask) * 8 + 1, 0);
+    }
+#endif
+  }
+#else
+  (void)addr;
+  (void)length;
+  (void)options;
+#endif  // __linux__
+}
+
+}  // namespace
+
+uint64_t MmapInfoStateStore::KeyFor(const std::string& info_state) {
+  // FNV-1a, 64-bit: deterministic across processes, unlike absl::Hash.
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (unsigned char c : info_state) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+#ifndef _WIN32
+
+MmapInfoStateStore::MmapInfoStateStore(const std::string& filename,
+                                       int64_t capacity, int max_actions,
+                                       const MmapStoreOptions& options)
+    : capacity_(capacity), max_actions_((max_actions + 1) & ~1) {
+  SPIEL_CHECK_GT(capacity_, 0);
+  SPIEL_CHECK_GT(max_actions, 0);
+  slot_size_ = sizeof(uint64_t) + sizeof(int32_t) +
+               max_actions_ * (sizeof(int32_t) + 2 * sizeof(CFRValue));
+  // Keep every slot 8-byte aligned.
+  slot_size_ = (slot_size_ + 7) & ~int64_t{7};
+  file_size_ = sizeof(Header) + capacity_ * slot_size_;
+
+  const bool existed = ::access(filename.c_str(), F_OK) == 0;
+  int fd = ::open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd < 0) {
+    SpielFatalError(absl::StrCat("MmapInfoStateStore: cannot open ", filename));
+  }
+  if (!existed && ::ftruncate(fd, file_size_) != 0) {
+    ::close(fd);
+    SpielFatalError(
+        absl::StrCat("MmapInfoStateStore: cannot size ", filename));
+  }
+  void* mapping = ::mmap(nullptr, file_size_, PROT_READ | PROT_WRITE,
+                         MAP_SHARED, fd, 0);
+  ::close(fd);  // The mapping keeps the file alive.
+  if (mapping == MAP_FAILED) {
+    SpielFatalError(absl::StrCat("MmapInfoStateStore: mmap failed for ",
+                                 filename));
+  }
+  data_ = static_cast<char*>(mapping);
+  ApplyPlacement(data_, file_size_, options);
+
+  Header* header = reinterpret_cast<Header*>(data_);
+  if (existed) {
+    if (header->magic != kStoreMagic || header->capacity != capacity_ ||
+        header->max_actions != max_actions_) {
+      SpielFatalError(absl::StrCat(
+          "MmapInfoStateStore: ", filename,
+          " exists with a different geometry than requested."));
+    }
+  } else {
+    header->magic = kStoreMagic;
+    header->capacity = capacity_;
+    header->max_actions = max_actions_;
+    header->padding = 0;
+    header->num_entries = 0;
+  }
+}
+
+MmapInfoStateStore::~MmapInfoStateStore() {
+  if (data_ != nullptr) ::munmap(data_, file_size_);
+}
+
+void MmapInfoStateStore::Flush() {
+  ::msync(data_, file_size_, MS_SYNC);
+}
+
+#else  // _WIN32
+
+MmapInfoStateStore::MmapInfoStateStore(const std::string& filename,
+                                       int64_t capacity, int max_actions,
+                                       const MmapStoreOptions& options)
+    : capacity_(capacity), max_actions_(max_actions) {
+  SpielFatalError("MmapInfoStateStore is not supported on Windows.");
+}
+MmapInfoStateStore::~MmapInfoStateStore() {}
+void MmapInfoStateStore::Flush() {}
+
+#endif  // _WIN32
+
+char* MmapInfoStateStore::FindSlot(uint64_t key, bool for_insert) const {
+  SPIEL_CHECK_NE(key, 0u);
+  char* slots = data_ + sizeof(Header);
+  int64_t index = static_cast<int64_t>(key % static_cast<uint64_t>(capacity_));
+  for (int64_t probes = 0; probes < capacity_; ++probes) {
+    char* slot = slots + index * slot_size_;
+    uint64_t slot_key = SlotKey(slot);
+    if (slot_key == key) return slot;
+    if (slot_key == 0) return for_insert ? slot : nullptr;
+    index = (index + 1) % capacity_;
+  }
+  SpielFatalError("MmapInfoStateStore: table is full.");
+}
+
+void MmapInfoStateStore::Prefetch(uint64_t key) const {
+#if defined(__GNUC__) || defined(__clang__)
+  const char* slots = data_ + sizeof(Header);
+  int64_t index = static_cast<int64_t>(key % static_cast<uint64_t>(capacity_));
+  // For write: entries fetched by the solvers are almost always stored back.
+  __builtin_prefetch(slots + index * slot_size_, /*rw=*/1, /*locality=*/1);
+#endif
+}
+
+bool MmapInfoStateStore::Load(uint64_t key, CFRInfoStateValues* values) const {
+  const char* slot = FindSlot(key, /*for_insert=*/false);
+  if (slot == nullptr) return false;
+
+  int32_t num_actions;
+  std::memcpy(&num_actions, slot + sizeof(uint64_t), sizeof(num_actions));
+  const char* actions_ptr = slot + sizeof(uint64_t) + sizeof(int32_t);
+  const char* regrets_ptr = actions_ptr + max_actions_ * sizeof(int32_t);
+  const char* policy_ptr = regrets_ptr + max_actions_ * sizeof(CFRValue);
+
+  std::vector<Action> legal_actions(num_actions);
+  for (int i = 0; i < num_actions; ++i) {
+    int32_t action;
+    std::memcpy(&action, actions_ptr + i * sizeof(int32_t), sizeof(action));
+    legal_actions[i] = action;
+  }
+  *values = CFRInfoStateValues(legal_actions);
+  std::memcpy(values->cumulative_regrets.data(), regrets_ptr,
+              num_actions * sizeof(CFRValue));
+  std::memcpy(values->cumulative_policy.data(), policy_ptr,
+              num_actions * sizeof(CFRValue));
+  return true;
+}
+
+void MmapInfoStateStore::LoadOrCreate(uint64_t key,
+                                      const std::vector<Action>& legal_actions,
+                                      double initial_value,
+                                      CFRInfoStateValues* values) {
+  if (Load(key, values)) return;
+  SPIEL_CHECK_LE(static_cast<int>(legal_actions.size()), max_actions_);
+  if (num_entries() >= capacity_ * kMaxLoadFactor) {
+    SpielFatalError(absl::StrCat(
+        "MmapInfoStateStore: past ", kMaxLoadFactor,
+        " load factor; recreate the store with a larger capacity."));
+  }
+  *values = CFRInfoStateValues(legal_actions, initial_value);
+  char* slot = FindSlot(key, /*for_insert=*/true);
+  std::memcpy(slot, &key, sizeof(key));
+  Store(key, *values);
+  Header* header = reinterpret_cast<Header*>(data_);
+  ++header->num_entries;
+}
+
+void MmapInfoStateStore::Store(uint64_t key, const CFRInfoStateValues& values) {
+  char* slot = FindSlot(key, /*for_insert=*/false);
+  if (slot == nullptr) {
+    SpielFatalError("MmapInfoStateStore::Store: key not found.");
+  }
+  const int32_t num_actions = values.num_actions();
+  SPIEL_CHECK_LE(num_actions, max_actions_);
+  char* actions_ptr = slot + sizeof(uint64_t) + sizeof(int32_t);
+  char* regrets_ptr = actions_ptr + max_actions_ * sizeof(int32_t);
+  char* policy_ptr = regrets_ptr + max_actions_ * sizeof(CFRValue);
+
+  std::memcpy(slot + sizeof(uint64_t), &num_actions, sizeof(num_actions));
+  for (int i = 0; i < num_actions; ++i) {
+    int32_t action = static_cast<int32_t>(values.legal_actions[i]);
+    std::memcpy(actions_ptr + i * sizeof(int32_t), &action, sizeof(action));
+  }
+  std::memcpy(regrets_ptr, values.cumulative_regrets.data(),
+              num_actions * sizeof(CFRValue));
+  std::memcpy(policy_ptr, values.cumulative_policy.data(),
+              num_actions * sizeof(CFRValue));
+}
+
+int64_t MmapInfoStateStore::num_entries() const {
+  return reinterpret_cast<const Header*>(data_)->num_entries;
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
@@ -0,0 +1,125 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_MMAP_INFOSTATE_STORE_H_
+#define OPEN_SPIEL_ALGORITHMS_MMAP_INFOSTATE_STORE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open_spiel/algorithms/cfr.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// A file-backed table of MCCFR infostate values for runs whose tables exceed
+// RAM. The file is one open-addressed hash table of fixed-size slots
+// (linear probing, 64-bit keys) mapped with MAP_SHARED, so the operating
+// system's page cache is the hot set: recently touched slots stay resident,
+// cold regions are paged out under memory pressure, and nothing is lost on a
+// clean close because dirty pages are written back by the kernel. Reopening
+// an existing file resumes the run in the time it takes to map it.
+//
+// Keys are 64-bit hashes of the infostate string, produced by KeyFor() with
+// a fixed (seedless) hash so that keys are stable across processes and
+// restarts. With a 64-bit key space, collisions are vanishingly unlikely at
+// the scales this is built for, but they are silent: two colliding
+// infostates would share one entry.
+//
+// Slots store the legal actions plus the cumulative regrets and cumulative
+// average policy. current_policy is derived data (regret matching), so it is
+// recomputed on Load rather than stored; this matches how the MCCFR solvers
+// use their in-memory tables (regret matching is applied to a local copy).
+//
+// Capacity and the per-slot action bound are fixed at creation. The store
+// dies with an informative error when it fills up past its load limit, and
+// it is not thread-safe; multi-threaded runs need external locking, e.g. the
+// striped locks used by OutcomeSamplingMCCFRSolver::RunIterationsParallel.
+// Memory placement options for the table mapping. Both are best-effort
+// advisories to the kernel: on platforms or kernels that do not support
+// them they are silently ignored and the mapping gets default placement.
+struct MmapStoreOptions {
+  // Ask for transparent huge pages behind the mapping (Linux MADV_HUGEPAGE).
+  // A 2MB page covers 512 slots-worth of 4KB pages with one TLB entry, which
+  // matters when the probe pattern of a 100GB+ table defeats the TLB. The
+  // kernel only honors this for mappings it can back with huge pages.
+  bool huge_pages = false;
+  // Interleave the mapping's pages round-robin across all online NUMA nodes
+  // (Linux mbind with MPOL_INTERLEAVE). Under first-touch default placement
+  // the whole table lands on whichever socket faults it in first, and
+  // sampler threads on the other socket pay remote latency for every probe;
+  // interleaving makes the average latency uniform across sockets.
+  bool numa_interleave = false;
+};
+
+class MmapInfoStateStore {
+ public:
+  // Creates `filename` with room for `capacity` entries of up to
+  // `max_actions` actions each, or opens it if it already exists (in which
+  // case capacity/max_actions must match the file header).
+  MmapInfoStateStore(const std::string& filename, int64_t capacity,
+                     int max_actions,
+                     const MmapStoreOptions& options = MmapStoreOptions());
+  ~MmapInfoStateStore();
+
+  MmapInfoStateStore(const MmapInfoStateStore&) = delete;
+  MmapInfoStateStore& operator=(const MmapInfoStateStore&) = delete;
+
+  // Stable 64-bit key for an infostate string (FNV-1a; never returns the
+  // empty-slot sentinel 0).
+  static uint64_t KeyFor(const std::string& info_state);
+
+  // Issues a software prefetch for the first slot of `key`'s probe chain so
+  // a following Load/LoadOrCreate finds the line in cache. Purely a hint;
+  // callers issue it as soon as the key is known and do independent work
+  // before the actual lookup.
+  void Prefetch(uint64_t key) const;
+
+  // Copies the entry for `key` into *values; returns false if absent.
+  bool Load(uint64_t key, CFRInfoStateValues* values) const;
+
+  // As Load, but creates the entry (with `initial_value` in both cumulative
+  // arrays) if absent.
+  void LoadOrCreate(uint64_t key, const std::vector<Action>& legal_actions,
+                    double initial_value, CFRInfoStateValues* values);
+
+  // Writes the cumulative regrets and cumulative policy of `values` back to
+  // the entry for `key`, which must exist.
+  void Store(uint64_t key, const CFRInfoStateValues& values);
+
+  // Asks the kernel to write dirty pages back now (e.g. before snapshotting
+  // the file). Not needed for correctness on a clean close.
+  void Flush();
+
+  int64_t num_entries() const;
+  int64_t capacity() const { return capacity_; }
+
+ private:
+  // Returns a pointer to the slot for `key`, or, if `for_insert`, to the
+  // first empty slot in its probe sequence; null on lookup miss.
+  char* FindSlot(uint64_t key, bool for_insert) const;
+
+  const int64_t capacity_;
+  const int max_actions_;
+  int64_t slot_size_ = 0;
+  int64_t file_size_ = 0;
+  char* data_ = nullptr;  // The whole mapping; slots start after the header.
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_MMAP_INFOSTATE_STORE_H_
@@ -0,0 +1,146 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/mmap_policy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/algorithms/mmap_infostate_store.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+constexpr char kMagic[8] = {'O', 'S', 'M', 'P', 'O', 'L', '0', '1'};
+constexpr int64_t kHeaderSize = 16;      // magic + entry count
+constexpr int64_t kIndexEntrySize = 16;  // key + record offset
+constexpr int64_t kActionPairSize = 8;   // int32 action + float probability
+
+// All record/index reads go through memcpy: the mapping guarantees no
+// particular alignment for the packed fields.
+template <typename T>
+T ReadAs(const char* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+template <typename T>
+void AppendAs(std::string* out, T value) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+}  // namespace
+
+void WriteMmapPolicy(const TabularPolicy& policy,
+                     const std::string& filename) {
+  // Sort the index by key; a duplicate key means two infostates collided
+  // under the 64-bit hash and the file would silently serve one of them for
+  // both, so die instead.
+  std::vector<std::pair<uint64_t, const ActionsAndProbs*>> entries;
+  entries.reserve(policy.PolicyTable().size());
+  for (const auto& [info_state, state_policy] : policy.PolicyTable()) {
+    entries.push_back({MmapInfoStateStore::KeyFor(info_state), &state_policy});
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+  for (size_t i = 1; i < entries.size(); ++i) {
+    if (entries[i].first == entries[i - 1].first) {
+      SpielFatalError(absl::StrCat("WriteMmapPolicy: key collision on ",
+                                   entries[i].first));
+    }
+  }
+
+  std::string index;
+  index.reserve(entries.size() * kIndexEntrySize);
+  std::string records;
+  for (const auto& [key, state_policy] : entries) {
+    AppendAs<uint64_t>(&index, key);
+    AppendAs<uint64_t>(&index, records.size());
+    AppendAs<int32_t>(&records, state_policy->size());
+    for (const auto& [action, prob] : *state_policy) {
+      SPIEL_CHECK_GE(action, 0);
+      SPIEL_CHECK_LE(action, std::numeric_limits<int32_t>::max());
+      AppendAs<int32_t>(&records, static_cast<int32_t>(action));
+      AppendAs<float>(&records, static_cast<float>(prob));
+    }
+  }
+
+  file::File out(filename, "wb");
+  std::string header(kMagic, sizeof(kMagic));
+  AppendAs<int64_t>(&header, entries.size());
+  SPIEL_CHECK_TRUE(out.Write(header));
+  SPIEL_CHECK_TRUE(out.Write(index));
+  SPIEL_CHECK_TRUE(out.Write(records));
+  SPIEL_CHECK_TRUE(out.Flush());
+}
+
+MmapPolicy::MmapPolicy(const std::string& filename) : mapping_(filename) {
+  SPIEL_CHECK_GE(mapping_.size(), kHeaderSize);
+  SPIEL_CHECK_EQ(std::memcmp(mapping_.data(), kMagic, sizeof(kMagic)), 0);
+  num_entries_ = ReadAs<int64_t>(mapping_.data() + sizeof(kMagic));
+  SPIEL_CHECK_GE(num_entries_, 0);
+  index_ = mapping_.data() + kHeaderSize;
+  records_ = index_ + num_entries_ * kIndexEntrySize;
+  SPIEL_CHECK_LE(records_ - mapping_.data(), mapping_.size());
+}
+
+ActionsAndProbs MmapPolicy::GetStatePolicyByKey(uint64_t key) const {
+  // Binary search over the sorted (key, offset) index.
+  int64_t lo = 0;
+  int64_t hi = num_entries_;
+  while (lo < hi) {
+    const int64_t mid = lo + (hi - lo) / 2;
+    const uint64_t mid_key = ReadAs<uint64_t>(index_ + mid * kIndexEntrySize);
+    if (mid_key < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == num_entries_ ||
+      ReadAs<uint64_t>(index_ + lo * kIndexEntrySize) != key) {
+    return {};
+  }
+  const uint64_t offset =
+      ReadAs<uint64_t>(index_ + lo * kIndexEntrySize + sizeof(uint64_t));
+  const char* record = records_ + offset;
+  const int32_t num_actions = ReadAs<int32_t>(record);
+  record += sizeof(int32_t);
+  ActionsAndProbs state_policy;
+  state_policy.reserve(num_actions);
+  for (int32_t i = 0; i < num_actions; ++i) {
+    const int32_t action = ReadAs<int32_t>(record);
+    const float prob = ReadAs<float>(record + sizeof(int32_t));
+    state_policy.push_back({action, prob});
+    record += kActionPairSize;
+  }
+  return state_policy;
+}
+
+ActionsAndProbs MmapPolicy::GetStatePolicy(
+    const std::string& info_state) const {
+  return GetStatePolicyByKey(MmapInfoStateStore::KeyFor(info_state));
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
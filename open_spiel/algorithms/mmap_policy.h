@@ -0,0 +1,72 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_MMAP_POLICY_H_
+#define OPEN_SPIEL_ALGORITHMS_MMAP_POLICY_H_
+
+#include <cstdint>
+#include <string>
+
+#include "open_spiel/policy.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// An immutable on-disk policy format for serving: instead of parsing a
+// multi-gigabyte policy into TabularPolicy's unordered_map at startup, the
+// file is mapped read-only and queried in place, so opening takes
+// milliseconds and the page cache shares one copy of the policy across
+// every replica on the machine.
+//
+// Layout (little-endian, fixed-width):
+//   header:  8-byte magic, int64 entry count
+//   index:   count x { uint64 key, uint64 record offset }, sorted by key
+//   records: per entry, int32 action count followed by that many packed
+//            { int32 action, float probability } pairs
+//
+// Keys are the same stable 64-bit infostate hashes the mmap infostate store
+// uses (MmapInfoStateStore::KeyFor), with the same caveat: a collision
+// between two infostates is silent, and the writer dies if one occurs
+// within the policy being written. Probabilities are stored as float --
+// serving picks actions from them, it does not accumulate them.
+
+// Writes `policy` in the format above, replacing `filename` if it exists.
+// Fails if any action id does not fit in 32 bits.
+void WriteMmapPolicy(const TabularPolicy& policy, const std::string& filename);
+
+// Read-only Policy over a written file. GetStatePolicy binary-searches the
+// mapped index; a miss returns an empty ActionsAndProbs, like TabularPolicy.
+// The mapping lives as long as the policy object.
+class MmapPolicy : public Policy {
+ public:
+  explicit MmapPolicy(const std::string& filename);
+
+  ActionsAndProbs GetStatePolicy(const std::string& info_state) const override;
+  // Lookup by precomputed key, for callers that cache hashes.
+  ActionsAndProbs GetStatePolicyByKey(uint64_t key) const;
+
+  int64_t num_entries() const { return num_entries_; }
+
+ private:
+  file::MappedFile mapping_;
+  int64_t num_entries_ = 0;
+  const char* index_ = nullptr;    // first index entry
+  const char* records_ = nullptr;  // start of the record block
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_MMAP_POLICY_H_
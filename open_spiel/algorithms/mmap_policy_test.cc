@@ -0,0 +1,86 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/mmap_policy.h"
+
+#include <memory>
+#include <string>
+
+#include "open_spiel/algorithms/cfr.h"
+#include "open_spiel/algorithms/tabular_exploitability.h"
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void TestRoundTrip() {
+  std::string filename = file::GetTmpDir() + "/mmap_policy_test.bin";
+  if (file::Exists(filename)) file::Remove(filename);
+
+  // A non-trivial policy: a few CFR iterations on Kuhn poker.
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  CFRSolver solver(*game);
+  for (int i = 0; i < 20; ++i) solver.EvaluateAndUpdatePolicy();
+  const TabularPolicy tabular = solver.TabularAveragePolicy();
+
+  WriteMmapPolicy(tabular, filename);
+  MmapPolicy mapped(filename);
+  SPIEL_CHECK_EQ(mapped.num_entries(),
+                 static_cast<int64_t>(tabular.PolicyTable().size()));
+
+  // Every entry must come back with the same actions and float-rounded
+  // probabilities.
+  for (const auto& [info_state, state_policy] : tabular.PolicyTable()) {
+    const ActionsAndProbs mapped_policy = mapped.GetStatePolicy(info_state);
+    SPIEL_CHECK_EQ(mapped_policy.size(), state_policy.size());
+    for (int i = 0; i < state_policy.size(); ++i) {
+      SPIEL_CHECK_EQ(mapped_policy[i].first, state_policy[i].first);
+      SPIEL_CHECK_FLOAT_NEAR(mapped_policy[i].second, state_policy[i].second,
+                             1e-6);
+    }
+  }
+  SPIEL_CHECK_TRUE(mapped.GetStatePolicy("no such infostate").empty());
+
+  // The mapped policy must be usable in place of the tabular one.
+  const double tabular_expl = Exploitability(*game, tabular);
+  const double mapped_expl = Exploitability(*game, mapped);
+  SPIEL_CHECK_FLOAT_NEAR(mapped_expl, tabular_expl, 1e-5);
+
+  file::Remove(filename);
+}
+
+void TestEmptyPolicy() {
+  std::string filename = file::GetTmpDir() + "/mmap_policy_empty_test.bin";
+  if (file::Exists(filename)) file::Remove(filename);
+
+  WriteMmapPolicy(TabularPolicy(), filename);
+  MmapPolicy mapped(filename);
+  SPIEL_CHECK_EQ(mapped.num_entries(), 0);
+  SPIEL_CHECK_TRUE(mapped.GetStatePolicy("anything").empty());
+
+  file::Remove(filename);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::TestRoundTrip();
+  open_spiel::algorithms::TestEmptyPolicy();
+}
@@ -14,7 +14,11 @@
 
 #include "open_spiel/algorithms/nfg_writer.h"
 
+#include <algorithm>
 #include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/strings/ascii.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
@@ -22,51 +26,112 @@
 #include "open_spiel/abseil-cpp/absl/strings/str_join.h"
 #include "open_spiel/normal_form_game.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
-const std::string GameToNFGString(const Game& game) {
-  // NFG 1 R "Selten (IJGT, 75), Figure 2, normal form"
-  // { "Player 1" "Player 2" } { 3 2 }
-  // 1 1 0 2 0 2 1 1 0 3 2 0
+namespace {
+
+// Payoff rows per block in GameToNFGFile; one block is the unit of both
+// flushing and parallel work.
+constexpr int kNFGRowsPerBlock = 8192;
+
+const NormalFormGame* AsNormalFormGame(const Game& game) {
   const auto* nfg = dynamic_cast<const NormalFormGame*>(&game);
   if (nfg == nullptr) {
     SpielFatalError("Must be a normal-form game");
   }
+  return nfg;
+}
 
-  int num_players = nfg->NumPlayers();
-  std::vector<std::vector<Action>> legal_actions(num_players);
-  std::unique_ptr<State> initial_state = nfg->NewInitialState();
-  for (Player player = 0; player < num_players; ++player) {
-    legal_actions[player] = initial_state->LegalActions(player);
-  }
-
-  // Line 1.
-  std::string nfg_text =
-      absl::StrCat("NFG 1 R \"OpenSpiel export of ", nfg->ToString(), "\"\n");
-
-  // Line 2.
-  absl::StrAppend(&nfg_text, "{");
+// The two header lines, e.g.
+// NFG 1 R "Selten (IJGT, 75), Figure 2, normal form"
+// { "Player 1" "Player 2" } { 3 2 }
+std::string NFGHeader(const NormalFormGame& nfg, const State& initial_state) {
+  int num_players = nfg.NumPlayers();
+  std::string header =
+      absl::StrCat("NFG 1 R \"OpenSpiel export of ", nfg.ToString(), "\"\n");
+  absl::StrAppend(&header, "{");
   for (Player p = 0; p < num_players; ++p) {
-    absl::StrAppend(&nfg_text, " \"Player ", p, "\"");
+    absl::StrAppend(&header, " \"Player ", p, "\"");
   }
-  absl::StrAppend(&nfg_text, " } {");
+  absl::StrAppend(&header, " } {");
   for (Player p = 0; p < num_players; ++p) {
-    absl::StrAppend(&nfg_text, " ", legal_actions[p].size());
+    absl::StrAppend(&header, " ", initial_state.LegalActions(p).size());
+  }
+  absl::StrAppend(&header, " }\n\n");
+  return header;
+}
+
+// One payoff row, trailing-space-stripped and newline-terminated.
+void AppendPayoffRow(const State& initial_state, Action flat_joint_action,
+                     std::string* out) {
+  std::vector<double> returns =
+      initial_state.Child(flat_joint_action)->Returns();
+  const size_t row_start = out->size();
+  for (Player p = 0; p < returns.size(); ++p) {
+    absl::StrAppendFormat(out, "%.15g ", returns[p]);
   }
-  absl::StrAppend(&nfg_text, " }\n\n");
+  if (out->size() > row_start) out->pop_back();  // Trailing space.
+  absl::StrAppend(out, "\n");
+}
+
+}  // namespace
+
+const std::string GameToNFGString(const Game& game) {
+  const NormalFormGame* nfg = AsNormalFormGame(game);
+  std::unique_ptr<State> initial_state = nfg->NewInitialState();
+  std::string nfg_text = NFGHeader(*nfg, *initial_state);
 
   // Now the payoffs.
   for (auto flat_joint_action : initial_state->LegalActions()) {
-    std::vector<double> returns =
-        initial_state->Child(flat_joint_action)->Returns();
-    for (Player p = 0; p < returns.size(); ++p) {
-      absl::StrAppendFormat(&nfg_text, "%.15g ", returns[p]);
-    }
-    absl::StripAsciiWhitespace(&nfg_text);
-    absl::StrAppend(&nfg_text, "\n");
+    AppendPayoffRow(*initial_state, flat_joint_action, &nfg_text);
   }
-
   return nfg_text;
 }
 
+void GameToNFGFile(const Game& game, const std::string& filename,
+                   int num_threads) {
+  SPIEL_CHECK_GE(num_threads, 1);
+  const NormalFormGame* nfg = AsNormalFormGame(game);
+  std::unique_ptr<State> initial_state = nfg->NewInitialState();
+  const std::vector<Action> joint_actions = initial_state->LegalActions();
+
+  std::ofstream nfg_file(filename);
+  nfg_file << NFGHeader(*nfg, *initial_state);
+
+  // Blocks are processed in batches of num_threads: the blocks of a batch
+  // are filled concurrently (Child() only reads the shared initial state),
+  // then written in row order, so at most num_threads blocks are ever in
+  // memory and the file contents do not depend on the thread count.
+  const int num_rows = static_cast<int>(joint_actions.size());
+  const int num_blocks = (num_rows + kNFGRowsPerBlock - 1) / kNFGRowsPerBlock;
+  std::vector<std::string> blocks(num_threads);
+  for (int batch_start = 0; batch_start < num_blocks;
+       batch_start += num_threads) {
+    const int batch_size = std::min(num_threads, num_blocks - batch_start);
+    auto fill_block = [&joint_actions, &initial_state, &blocks, num_rows,
+                       batch_start](int slot) {
+      const int begin = (batch_start + slot) * kNFGRowsPerBlock;
+      const int end = std::min(num_rows, begin + kNFGRowsPerBlock);
+      blocks[slot].clear();
+      for (int row = begin; row < end; ++row) {
+        AppendPayoffRow(*initial_state, joint_actions[row], &blocks[slot]);
+      }
+    };
+    if (batch_size == 1) {
+      fill_block(0);
+    } else {
+      std::vector<Thread> workers;
+      workers.reserve(batch_size);
+      for (int slot = 0; slot < batch_size; ++slot) {
+        workers.emplace_back([&fill_block, slot]() { fill_block(slot); });
+      }
+      for (Thread& worker : workers) worker.join();
+    }
+    for (int slot = 0; slot < batch_size; ++slot) {
+      nfg_file << blocks[slot];
+    }
+  }
+}
+
 }  // namespace open_spiel
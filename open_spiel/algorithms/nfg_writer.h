@@ -27,6 +27,15 @@ namespace open_spiel {
 // Get the string representation of this normal-form game.
 const std::string GameToNFGString(const Game& game);
 
+// Streams the same export straight to `filename` instead of materializing
+// it in memory: payoff rows are produced in fixed-size blocks and flushed
+// as they complete, so peak memory is a few blocks regardless of how many
+// joint actions the game has. With num_threads > 1 the blocks of a batch
+// are filled by worker threads and written to the file in row order, making
+// the output byte-identical to GameToNFGString for any thread count.
+void GameToNFGFile(const Game& game, const std::string& filename,
+                   int num_threads = 1);
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_ALGORITHMS_NFG_WRITER_H_
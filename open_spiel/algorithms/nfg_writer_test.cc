@@ -14,8 +14,12 @@
 
 #include "open_spiel/algorithms/nfg_writer.h"
 
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/normal_form_game.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/file.h"
 
 namespace open_spiel {
 namespace {
@@ -75,6 +79,23 @@ void BasicNFSWriterTestMP3P() {
   std::string mp3p_nfg_text = GameToNFGString(*mp3p);
   SPIEL_CHECK_EQ(mp3p_nfg_text, kMP3PNFG);
 }
+
+void NFGFileWriterTest() {
+  std::string filename =
+      absl::StrCat(file::GetTmpDir(), "/open_spiel_nfg_writer_test.nfg");
+  for (const char* game_name :
+       {"matrix_rps", "matrix_pd", "matching_pennies_3p"}) {
+    std::shared_ptr<const Game> game = LoadGame(game_name);
+    std::string expected = GameToNFGString(*game);
+    // The streamed export must be byte-identical to the in-memory one,
+    // serial or parallel.
+    for (int num_threads : {1, 3}) {
+      GameToNFGFile(*game, filename, num_threads);
+      SPIEL_CHECK_EQ(file::ReadContentsFromFile(filename, "r"), expected);
+      SPIEL_CHECK_TRUE(file::Remove(filename));
+    }
+  }
+}
 }  // namespace
 }  // namespace open_spiel
 
@@ -82,4 +103,5 @@ int main(int argc, char** argv) {
   open_spiel::BasicNFSWriterTestRPS();
   open_spiel::BasicNFSWriterTestPD();
   open_spiel::BasicNFSWriterTestMP3P();
+  open_spiel::NFGFileWriterTest();
 }
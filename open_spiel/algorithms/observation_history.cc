@@ -14,7 +14,11 @@
 
 #include "open_spiel/algorithms/observation_history.h"
 
+#include <algorithm>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
@@ -193,6 +197,146 @@ std::string ActionObservationHistory::ToString() const {
   return s;
 }
 
+// -----------------------------------------------------------------------------
+// ObservationInternPool
+// -----------------------------------------------------------------------------
+
+int ObservationInternPool::Intern(const std::string& observation) {
+  auto iter_and_bool =
+      ids_.insert({observation, static_cast<int>(ids_.size())});
+  if (iter_and_bool.second) {
+    by_id_.push_back(&iter_and_bool.first->first);
+  }
+  return iter_and_bool.first->second;
+}
+
+int ObservationInternPool::Lookup(const std::string& observation) const {
+  auto iter = ids_.find(observation);
+  return iter == ids_.end() ? -1 : iter->second;
+}
+
+const std::string& ObservationInternPool::StringOf(int id) const {
+  SPIEL_CHECK_GE(id, 0);
+  SPIEL_CHECK_LT(id, by_id_.size());
+  return *by_id_[id];
+}
+
+// -----------------------------------------------------------------------------
+// CompactActionObservationHistory
+// -----------------------------------------------------------------------------
+
+CompactActionObservationHistory::CompactActionObservationHistory(
+    Player player, const State& target,
+    std::shared_ptr<ObservationInternPool> pool)
+    : player_(player), pool_(std::move(pool)) {
+  SPIEL_CHECK_GE(player_, 0);
+  SPIEL_CHECK_LT(player_, target.NumPlayers());
+  SPIEL_CHECK_TRUE(target.GetGame()->GetType().provides_observation_string);
+  SPIEL_CHECK_TRUE(pool_ != nullptr);
+
+  const std::vector<State::PlayerAction>& history = target.FullHistory();
+  entries_.reserve(history.size() + 1);
+
+  std::unique_ptr<State> state = target.GetGame()->NewInitialState();
+  entries_.push_back(
+      {kInvalidAction, pool_->Intern(state->ObservationString(player_))});
+  for (int i = 0; i < history.size(); i++) {
+    const auto& [history_player, action] = history[i];
+    const bool is_acting = state->CurrentPlayer() == player_;
+    state->ApplyAction(action);
+    entries_.push_back({is_acting ? action : kInvalidAction,
+                        pool_->Intern(state->ObservationString(player_))});
+  }
+}
+
+CompactActionObservationHistory::CompactActionObservationHistory(
+    const ActionObservationHistory& aoh,
+    std::shared_ptr<ObservationInternPool> pool)
+    : player_(aoh.GetPlayer()), pool_(std::move(pool)) {
+  SPIEL_CHECK_TRUE(pool_ != nullptr);
+  entries_.reserve(aoh.History().size());
+  for (const auto& [action, observation] : aoh.History()) {
+    entries_.push_back({action.has_value() ? *action : kInvalidAction,
+                        pool_->Intern(observation)});
+  }
+}
+
+int CompactActionObservationHistory::MoveNumber() const {
+  SPIEL_CHECK_FALSE(entries_.empty());
+  SPIEL_CHECK_EQ(entries_[0].action, kInvalidAction);
+  return entries_.size() - 1;
+}
+
+absl::optional<Action> CompactActionObservationHistory::ActionAt(
+    int time) const {
+  const Action action = entries_.at(time).action;
+  return action == kInvalidAction
+             ? absl::nullopt
+             : static_cast<absl::optional<Action>>(action);
+}
+
+const std::string& CompactActionObservationHistory::ObservationAt(
+    int time) const {
+  return pool_->StringOf(entries_.at(time).observation_id);
+}
+
+bool CompactActionObservationHistory::CorrespondsTo(
+    const CompactActionObservationHistory& other) const {
+  return player_ == other.player_ && entries_ == other.entries_;
+}
+
+bool CompactActionObservationHistory::IsPrefixOf(
+    const CompactActionObservationHistory& other) const {
+  if (player_ != other.player_) return false;
+
+  if (CorrespondsToInitialState()) return true;
+  if (other.CorrespondsToInitialState()) return false;
+
+  const auto& a = entries_;
+  const auto& b = other.entries_;
+  if (a.size() > b.size()) return false;
+  return std::equal(a.begin(), a.end(), b.begin());
+}
+
+bool CompactActionObservationHistory::IsExtensionOf(
+    const CompactActionObservationHistory& other) const {
+  return other.IsPrefixOf(*this);
+}
+
+void CompactActionObservationHistory::Extend(
+    absl::optional<Action> action, const std::string& observation_string) {
+  ExtendById(action, pool_->Intern(observation_string));
+}
+
+void CompactActionObservationHistory::ExtendById(absl::optional<Action> action,
+                                                 int observation_id) {
+  SPIEL_CHECK_GE(observation_id, 0);
+  SPIEL_CHECK_LT(observation_id, pool_->size());
+  entries_.push_back(
+      {action.has_value() ? *action : kInvalidAction, observation_id});
+}
+
+void CompactActionObservationHistory::RemoveLast() {
+  SPIEL_CHECK_GT(entries_.size(), 0);
+  entries_.pop_back();
+}
+
+ActionObservationHistory CompactActionObservationHistory::ToHistory() const {
+  std::vector<std::pair<absl::optional<Action>, std::string>> history;
+  history.reserve(entries_.size());
+  for (const Entry& entry : entries_) {
+    history.push_back({entry.action == kInvalidAction
+                           ? absl::nullopt
+                           : static_cast<absl::optional<Action>>(entry.action),
+                       pool_->StringOf(entry.observation_id)});
+  }
+  return ActionObservationHistory(player_, std::move(history));
+}
+
+std::string CompactActionObservationHistory::ToString() const {
+  return ToHistory().ToString();
+}
+
 // -----------------------------------------------------------------------------
 // PublicObservationHistory
 // -----------------------------------------------------------------------------
@@ -15,11 +15,14 @@
 #ifndef OPEN_SPIEL_FOG_OBSERVATION_HISTORY_H_
 #define OPEN_SPIEL_FOG_OBSERVATION_HISTORY_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
@@ -230,6 +233,118 @@ class PublicObservationHistory {
                                             int until_time) const;
 };
 
+// An intern pool mapping observation strings to dense integer ids. A pool is
+// shared by the CompactActionObservationHistory instances of one game (and
+// typically by all players), so each distinct observation string is stored,
+// and its hash computed, once per process rather than once per history entry.
+class ObservationInternPool {
+ public:
+  // Returns the id for this observation, registering it if it is new.
+  int Intern(const std::string& observation);
+
+  // Returns the id for this observation, or -1 if it was never registered.
+  int Lookup(const std::string& observation) const;
+
+  // The observation string for a previously interned id.
+  const std::string& StringOf(int id) const;
+
+  int size() const { return by_id_.size(); }
+
+ private:
+  std::unordered_map<std::string, int> ids_;
+  // Pointers into ids_ keys; std::unordered_map keys are reference-stable.
+  std::vector<const std::string*> by_id_;
+};
+
+// An ActionObservationHistory with observation strings replaced by interned
+// ids: each timestep is a fixed-width (action, observation id) entry, so
+// equality, prefix tests and hashing are integer compares over a contiguous
+// vector with no per-step string allocation. Intended for AOH-keyed
+// algorithms (e.g. subgame identification) running over long matches; the
+// string-based ActionObservationHistory above remains the reference
+// representation, and ToHistory() converts back to it.
+class CompactActionObservationHistory {
+ public:
+  struct Entry {
+    Action action;            // kInvalidAction when the player was not acting.
+    int32_t observation_id;   // Id in the shared ObservationInternPool.
+
+    bool operator==(const Entry& other) const {
+      return action == other.action && observation_id == other.observation_id;
+    }
+    template <typename H>
+    friend H AbslHashValue(H h, const Entry& entry) {
+      return H::combine(std::move(h), entry.action, entry.observation_id);
+    }
+  };
+
+  // Constructs the compact history for `player` at the target state,
+  // interning observations into `pool`. Like the string-based constructor,
+  // this traverses the state's history and can be expensive; the point is
+  // that every comparison and hash afterwards is allocation-free.
+  CompactActionObservationHistory(Player player, const State& target,
+                                  std::shared_ptr<ObservationInternPool> pool);
+
+  // Converts an existing string-based history, interning its observations.
+  CompactActionObservationHistory(const ActionObservationHistory& aoh,
+                                  std::shared_ptr<ObservationInternPool> pool);
+
+  CompactActionObservationHistory(const CompactActionObservationHistory&) =
+      default;
+
+  Player GetPlayer() const { return player_; }
+  const std::vector<Entry>& Entries() const { return entries_; }
+  const std::shared_ptr<ObservationInternPool>& pool() const { return pool_; }
+
+  // As for ActionObservationHistory, this corresponds to State::MoveNumber().
+  int MoveNumber() const;
+
+  // The action at the given time, or nullopt if the player was not acting.
+  absl::optional<Action> ActionAt(int time) const;
+
+  // The interned observation id at the given time. Root node has time 0.
+  int ObservationIdAt(int time) const { return entries_.at(time).observation_id; }
+
+  // The observation string at the given time, resolved through the pool.
+  const std::string& ObservationAt(int time) const;
+
+  bool CorrespondsToInitialState() const { return MoveNumber() == 0; }
+
+  // Equality; meaningful only between histories sharing one intern pool.
+  bool CorrespondsTo(const CompactActionObservationHistory& other) const;
+
+  bool IsPrefixOf(const CompactActionObservationHistory& other) const;
+  bool IsExtensionOf(const CompactActionObservationHistory& other) const;
+
+  // Appends one timestep. Extend interns the observation string (one hash of
+  // the string, no allocation if it was seen before); ExtendById takes an
+  // already interned id and touches no strings at all.
+  void Extend(absl::optional<Action> action,
+              const std::string& observation_string);
+  void ExtendById(absl::optional<Action> action, int observation_id);
+
+  void RemoveLast();
+
+  // The equivalent string-based history (copies the observation strings).
+  ActionObservationHistory ToHistory() const;
+
+  std::string ToString() const;
+
+  bool operator==(const CompactActionObservationHistory& other) const {
+    return CorrespondsTo(other);
+  }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const CompactActionObservationHistory& aoh) {
+    return H::combine(std::move(h), aoh.player_, aoh.entries_);
+  }
+
+ private:
+  Player player_;
+  std::shared_ptr<ObservationInternPool> pool_;
+  std::vector<Entry> entries_;
+};
+
 std::ostream& operator<<(std::ostream& os, const ActionObservationHistory& aoh);
 std::ostream& operator<<(std::ostream& os, const PublicObservationHistory& poh);
 
@@ -14,6 +14,9 @@
 
 #include "open_spiel/algorithms/observation_history.h"
 
+#include <memory>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 
@@ -91,9 +94,67 @@ void CheckKuhnPokerObservationHistory() {
                                      {NONE, "122"}}));
 }
 
+void CheckCompactKuhnPokerObservationHistory() {
+  using AOH = ActionObservationHistory;
+  using CompactAOH = CompactActionObservationHistory;
+
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  auto pool = std::make_shared<ObservationInternPool>();
+
+  std::unique_ptr<State> s = game->NewInitialState();
+  for (Action action : {2, 1, 0, 1, 1}) s->ApplyAction(action);
+  SPIEL_CHECK_TRUE(s->IsTerminal());
+
+  for (Player pl = 0; pl < 2; ++pl) {
+    AOH aoh(pl, *s);
+    CompactAOH compact(pl, *s, pool);
+
+    // The compact form must agree with the string form timestep by timestep
+    // and convert back to an equal history.
+    SPIEL_CHECK_EQ(compact.MoveNumber(), aoh.MoveNumber());
+    for (int t = 0; t <= aoh.MoveNumber(); ++t) {
+      SPIEL_CHECK_EQ(compact.ActionAt(t), aoh.ActionAt(t));
+      SPIEL_CHECK_EQ(compact.ObservationAt(t), aoh.ObservationAt(t));
+      SPIEL_CHECK_EQ(pool->StringOf(compact.ObservationIdAt(t)),
+                     aoh.ObservationAt(t));
+    }
+    SPIEL_CHECK_TRUE(compact.ToHistory() == aoh);
+
+    // Converting the string form must give the same entries (and ids) as
+    // building from the state directly.
+    SPIEL_CHECK_TRUE(CompactAOH(aoh, pool) == compact);
+
+    // Prefix relations via RemoveLast/Extend round-trip.
+    CompactAOH prefix = compact;
+    prefix.RemoveLast();
+    SPIEL_CHECK_TRUE(prefix.IsPrefixOf(compact));
+    SPIEL_CHECK_TRUE(compact.IsExtensionOf(prefix));
+    SPIEL_CHECK_FALSE(compact.IsPrefixOf(prefix));
+    prefix.Extend(compact.ActionAt(compact.MoveNumber()),
+                  compact.ObservationAt(compact.MoveNumber()));
+    SPIEL_CHECK_TRUE(prefix == compact);
+  }
+
+  // Histories of different players never correspond, even over one pool.
+  SPIEL_CHECK_FALSE(CompactAOH(0, *s, pool) == CompactAOH(1, *s, pool));
+
+  // The pool de-duplicates: Kuhn has far fewer distinct observation strings
+  // than timesteps across both players.
+  SPIEL_CHECK_GT(pool->size(), 0);
+  SPIEL_CHECK_LT(pool->size(), 2 * (s->MoveNumber() + 1));
+
+  // Compact histories are hashable; equal histories hash equally.
+  absl::flat_hash_map<CompactAOH, int> counts;
+  counts[CompactAOH(0, *s, pool)] += 1;
+  counts[CompactAOH(0, *s, pool)] += 1;
+  SPIEL_CHECK_EQ(counts.size(), 1);
+  SPIEL_CHECK_EQ(counts.begin()->second, 2);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::CheckKuhnPokerObservationHistory();
+  open_spiel::CheckCompactKuhnPokerObservationHistory();
 }
@@ -144,6 +144,25 @@ ActionsAndProbs TargetedPolicy::GetStatePolicy(const State& h) const {
   return policy;
 }
 
+ActionsAndProbs TargetedPolicy::GetBelowTargetPolicy(const State& h) const {
+  ActionsAndProbs policy;
+  if (h.IsChanceNode()) {
+    policy = h.ChanceOutcomes();
+  } else if (h.IsPlayerNode()) {
+    policy = CFRCurrentPolicy::GetStatePolicy(h);
+  } else {
+    SpielFatalError("Could not get policy for this state.");
+  }
+
+  // No action can be banned below the target, so the policy is already
+  // normalized -- just mix in exploration.
+  const double unif = 1. / policy.size();
+  for (auto& [_, prob] : policy) {
+    prob = bias_exploration_ * unif + (1 - bias_exploration_) * prob;
+  }
+  return policy;
+}
+
 bool TargetedPolicy::IsAllowedAction(const State& h,
                                      const Action& action) const {
   if (targeting_ == kDoNotUseTargeting) return true;
@@ -263,10 +282,11 @@ OOSAlgorithm::OOSAlgorithm(std::shared_ptr<const Game> game)
 
 void OOSAlgorithm::RunUnbiasedIterations(int iterations) {
   bias_policy_->NoTargeting();
+  if (!root_state_) root_state_ = game_->NewInitialState();
 
   for (int t = 0; t < iterations; ++t) {
     for (Player exploringPl = 0; exploringPl < 2; ++exploringPl) {
-      std::unique_ptr<State> h = game_->NewInitialState();
+      std::unique_ptr<State> h = root_state_->Clone();
       is_biased_iteration_ = false;
       is_below_target_ = true;
 
@@ -301,10 +321,11 @@ void OOSAlgorithm::RunTargetedIterations(int iterations) {
   if (target_biasing_ == 0.) {
     return RunUnbiasedIterations(iterations);
   }
+  if (!root_state_) root_state_ = game_->NewInitialState();
 
   for (int t = 0; t < iterations; ++t) {
     for (Player exploringPl = 0; exploringPl < 2; ++exploringPl) {
-      std::unique_ptr<State> h = game_->NewInitialState();
+      std::unique_ptr<State> h = root_state_->Clone();
       is_biased_iteration_ = random_->RandomUniform() <= target_biasing_;
       // We always have a target, which cannot be a root node
       // (this was handled by publicly facing methods)
@@ -526,7 +547,12 @@ bool OOSAlgorithm::IsBiasingApplicable(double bs_h_all) {
 
 TakeAction OOSAlgorithm::SelectAction(State* h, bool do_biased_sample) {
   const ActionsAndProbs& sample_probs = sample_policy_->GetStatePolicy(*h);
-  const ActionsAndProbs& biased_probs = bias_policy_->GetStatePolicy(*h);
+  // Below the target every action leads to it, so skip the per-action child
+  // construction and extension checks of the targeted policy -- it reduces
+  // to the exploration mixture there.
+  const ActionsAndProbs& biased_probs =
+      is_below_target_ ? bias_policy_->GetBelowTargetPolicy(*h)
+                       : bias_policy_->GetStatePolicy(*h);
 
   // Check what comes out of policies are proper distributions.
   SPIEL_DCHECK_TRUE(IsValidProbDistribution(biased_probs));
@@ -218,6 +218,13 @@ class TargetedPolicy : public CFRCurrentPolicy {
   bool IsTargetHit(const State& h);
 
   ActionsAndProbs GetStatePolicy(const State& h) const;
+
+  // The biased policy for states where every action is known to lead to the
+  // target (i.e. the current history is at or below it). This skips the
+  // per-action child construction and observation-history extension checks
+  // of GetStatePolicy and reduces to the exploration mixture, which is what
+  // GetStatePolicy would return when no action is banned.
+  ActionsAndProbs GetBelowTargetPolicy(const State& h) const;
   void TrackStatistics(OnlineStats* stats) { stats_ = stats; }
 
  private:
@@ -339,6 +346,13 @@ class OOSAlgorithm {
 
   const std::shared_ptr<const Game> game_;
   std::unique_ptr<OOSInfoStateValuesTable> values_;
+  // Cached initial state of the game, created lazily on the first iteration.
+  // Each iteration clones this state instead of calling NewInitialState(),
+  // which avoids re-running the game's initial setup on every sample. Note
+  // that the values table also persists across Run*Iterations calls, so
+  // regret entries accumulated during earlier searches of the same match
+  // stay warm for later ones.
+  std::unique_ptr<State> root_state_;
   std::unique_ptr<Random> random_;
   std::unique_ptr<Policy> sample_policy_;
   std::unique_ptr<TargetedPolicy> bias_policy_;
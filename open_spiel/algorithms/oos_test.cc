@@ -79,8 +79,10 @@ void EpsExploreSamplingPolicyTest() {
   auto pl1_info_state = player1_plays->InformationStateString();
   table[pl0_info_state] = CFRInfoStateValues(player0_plays->LegalActions());
   table[pl1_info_state] = CFRInfoStateValues(player1_plays->LegalActions());
-  table[pl0_info_state].current_policy = current_policy;
-  table[pl1_info_state].current_policy = current_policy;
+  table[pl0_info_state].current_policy.assign(current_policy.begin(),
+                                              current_policy.end());
+  table[pl1_info_state].current_policy.assign(current_policy.begin(),
+                                              current_policy.end());
 
   auto p = ExplorativeSamplingPolicy(table, 0.4);
   SPIEL_CHECK_TRUE(StatePoliciesEqual(p.GetStatePolicy(*card_to_player0),
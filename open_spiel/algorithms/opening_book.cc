@@ -0,0 +1,118 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/opening_book.h"
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+template <typename T>
+void AppendAs(std::string* out, T value) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T ReadAs(const char* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+}  // namespace
+
+OpeningBook::OpeningBook(const std::string& filename) {
+  file::MappedFile mapping(filename);
+  SPIEL_CHECK_GE(mapping.size(), static_cast<int64_t>(sizeof(int64_t)));
+  const int64_t count = ReadAs<int64_t>(mapping.data());
+  const int64_t entry_size = sizeof(uint64_t) + sizeof(Action);
+  SPIEL_CHECK_EQ(mapping.size(),
+                 static_cast<int64_t>(sizeof(int64_t)) + count * entry_size);
+  entries_.reserve(count);
+  const char* cursor = mapping.data() + sizeof(int64_t);
+  for (int64_t i = 0; i < count; ++i) {
+    const uint64_t key = ReadAs<uint64_t>(cursor);
+    const Action action = ReadAs<Action>(cursor + sizeof(uint64_t));
+    entries_[key] = action;
+    cursor += entry_size;
+  }
+}
+
+void OpeningBook::Save(const std::string& filename) const {
+  std::string buffer;
+  buffer.reserve(sizeof(int64_t) +
+                 entries_.size() * (sizeof(uint64_t) + sizeof(Action)));
+  AppendAs<int64_t>(&buffer, entries_.size());
+  for (const auto& [key, action] : entries_) {
+    AppendAs<uint64_t>(&buffer, key);
+    AppendAs<Action>(&buffer, action);
+  }
+  file::File out(filename, "wb");
+  SPIEL_CHECK_TRUE(out.Write(buffer));
+  SPIEL_CHECK_TRUE(out.Flush());
+}
+
+OpeningBook BuildOpeningBook(const Game& game, Bot* search_bot,
+                             const OpeningBookConfig& config) {
+  SPIEL_CHECK_GT(config.max_move_number, 0);
+  SPIEL_CHECK_GT(config.num_playthroughs, 0);
+  SPIEL_CHECK_GE(config.min_frequency, 1);
+
+  // Pass 1: count how often each early infostate is visited, keeping one
+  // representative state per key for the search pass.
+  struct Candidate {
+    std::unique_ptr<State> state;
+    int count = 0;
+  };
+  absl::flat_hash_map<uint64_t, Candidate> candidates;
+  std::mt19937 rng(config.seed);
+  for (int p = 0; p < config.num_playthroughs; ++p) {
+    std::unique_ptr<State> state = game.NewInitialState();
+    while (!state->IsTerminal() && state->MoveNumber() < config.max_move_number) {
+      if (state->IsChanceNode()) {
+        state->ApplyAction(
+            SampleAction(state->ChanceOutcomes(),
+                         std::uniform_real_distribution<double>(0.0, 1.0)(rng))
+                .first);
+        continue;
+      }
+      Candidate& candidate = candidates[state->InformationStateHash()];
+      if (candidate.count == 0) candidate.state = state->Clone();
+      ++candidate.count;
+      const std::vector<Action> legal_actions = state->LegalActions();
+      state->ApplyAction(legal_actions[std::uniform_int_distribution<int>(
+          0, legal_actions.size() - 1)(rng)]);
+    }
+  }
+
+  // Pass 2: deep search at each frequent infostate's representative state.
+  OpeningBook book;
+  for (const auto& [key, candidate] : candidates) {
+    if (candidate.count < config.min_frequency) continue;
+    book.Add(key, search_bot->Step(*candidate.state));
+  }
+  return book;
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
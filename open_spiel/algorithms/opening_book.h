@@ -0,0 +1,84 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_OPENING_BOOK_H_
+#define OPEN_SPIEL_ALGORITHMS_OPENING_BOOK_H_
+
+#include <cstdint>
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_bots.h"
+
+// A precomputed opening book: the early decisions that recur across millions
+// of matches are searched once, deeply, offline, and served from a hash map
+// afterwards. Entries are keyed by State::InformationStateHash(), so games
+// with a compact canonical hash (Durak overrides it) probe without
+// allocating; the hash caveat from spiel.h applies — distinct infostates may
+// collide, in which case the book would answer one of them with the other's
+// move. Keep books to the early moves, where the infostate space is small
+// enough for that to be a non-issue.
+//
+// MCTSBot and ISMCTSBot take a book via SetOpeningBook and answer Step from
+// it before falling back to search.
+
+namespace open_spiel {
+namespace algorithms {
+
+class OpeningBook {
+ public:
+  OpeningBook() = default;
+  // Loads a book written by Save.
+  explicit OpeningBook(const std::string& filename);
+
+  void Add(uint64_t key, Action action) { entries_[key] = action; }
+  absl::optional<Action> Lookup(uint64_t key) const {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return absl::nullopt;
+    return it->second;
+  }
+
+  int64_t size() const { return entries_.size(); }
+
+  // Writes the book as a flat binary file (count, then key/action pairs).
+  void Save(const std::string& filename) const;
+
+ private:
+  absl::flat_hash_map<uint64_t, Action> entries_;
+};
+
+struct OpeningBookConfig {
+  // Only states with MoveNumber() below this are booked.
+  int max_move_number = 4;
+  // Uniformly random playthroughs used to find the frequent infostates.
+  int num_playthroughs = 10000;
+  // An infostate enters the book once this many playthroughs visited it.
+  int min_frequency = 10;
+  int seed = 0;
+};
+
+// Finds the early infostates at least min_frequency of the sampled
+// playthroughs pass through and asks `search_bot` (typically an MCTSBot with
+// a far larger simulation budget than serving could afford) for the move at
+// one representative state of each. The bot must handle arbitrary states in
+// Step, as the MCTS bots do.
+OpeningBook BuildOpeningBook(const Game& game, Bot* search_bot,
+                             const OpeningBookConfig& config);
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_OPENING_BOOK_H_
@@ -0,0 +1,92 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/opening_book.h"
+
+#include <memory>
+#include <string>
+
+#include "open_spiel/algorithms/is_mcts.h"
+#include "open_spiel/algorithms/mcts.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void TestBuildProbeAndRoundTrip() {
+  std::string filename = file::GetTmpDir() + "/opening_book_test.bin";
+  if (file::Exists(filename)) file::Remove(filename);
+
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(1, 42);
+  MCTSBot search_bot(*game, evaluator, /*uct_c=*/2, /*max_simulations=*/200,
+                     /*max_memory_mb=*/10, /*solve=*/true, /*seed=*/42,
+                     /*verbose=*/false);
+
+  OpeningBookConfig config;
+  config.max_move_number = 2;
+  config.num_playthroughs = 200;
+  config.min_frequency = 5;
+  const OpeningBook book = BuildOpeningBook(*game, &search_bot, config);
+  // The root and all nine first replies recur constantly.
+  SPIEL_CHECK_GT(book.size(), 1);
+
+  std::unique_ptr<State> root = game->NewInitialState();
+  const absl::optional<Action> root_move =
+      book.Lookup(root->InformationStateHash());
+  SPIEL_CHECK_TRUE(root_move.has_value());
+
+  book.Save(filename);
+  const OpeningBook loaded(filename);
+  SPIEL_CHECK_EQ(loaded.size(), book.size());
+  SPIEL_CHECK_TRUE(loaded.Lookup(root->InformationStateHash()) == root_move);
+
+  // A bot holding the book must answer booked states with the booked move.
+  MCTSBot serving_bot(*game, evaluator, /*uct_c=*/2, /*max_simulations=*/2,
+                      /*max_memory_mb=*/10, /*solve=*/true, /*seed=*/7,
+                      /*verbose=*/false);
+  serving_bot.SetOpeningBook(std::make_shared<const OpeningBook>(loaded));
+  SPIEL_CHECK_EQ(serving_bot.Step(*root), *root_move);
+
+  file::Remove(filename);
+}
+
+void TestISMCTSProbe() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (state->IsChanceNode()) {
+    state->ApplyAction(state->ChanceOutcomes()[0].first);
+  }
+
+  auto book = std::make_shared<OpeningBook>();
+  const Action booked_move = state->LegalActions()[1];
+  book->Add(state->InformationStateHash(), booked_move);
+
+  auto evaluator = std::make_shared<RandomRolloutEvaluator>(1, 5);
+  ISMCTSBot bot(/*seed=*/5, evaluator, /*uct_c=*/2, /*max_simulations=*/10);
+  bot.SetOpeningBook(book);
+  SPIEL_CHECK_EQ(bot.Step(*state), booked_move);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::TestBuildProbeAndRoundTrip();
+  open_spiel::algorithms::TestISMCTSProbe();
+}
@@ -0,0 +1,261 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/ortools/double_oracle.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/algorithms/best_response.h"
+#include "open_spiel/algorithms/evaluate_bots.h"
+#include "open_spiel/algorithms/expected_returns.h"
+#include "open_spiel/algorithms/ortools/lp_solver.h"
+#include "open_spiel/matrix_game.h"
+#include "open_spiel/spiel_bots.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace ortools {
+namespace {
+
+// Returns the probabilities of `legal_actions` at `info_state` under
+// `policy`, treating a missing table entry as uniform (a best-response
+// component only covers the infostates its computation visited).
+std::vector<double> ComponentProbs(const TabularPolicy& policy,
+                                   const std::string& info_state,
+                                   const std::vector<Action>& legal_actions) {
+  std::vector<double> probs(legal_actions.size());
+  const ActionsAndProbs state_policy = policy.GetStatePolicy(info_state);
+  if (state_policy.empty()) {
+    std::fill(probs.begin(), probs.end(), 1.0 / legal_actions.size());
+    return probs;
+  }
+  for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+    const double prob = GetProb(state_policy, legal_actions[aidx]);
+    probs[aidx] = prob > 0 ? prob : 0.0;
+  }
+  return probs;
+}
+
+// Depth-first traversal behind AggregateMixturePolicy. `own_reach[k]` is the
+// product of `player`'s own action probabilities along the path under
+// component k; each of the player's infostates is blended on first visit
+// (under perfect recall every history of an infostate carries the same own
+// reach, so one visit suffices).
+void AggregateRecursive(const State& state, Player player,
+                        const std::vector<TabularPolicy>& policies,
+                        const std::vector<double>& weights,
+                        const std::vector<double>& own_reach,
+                        std::unordered_map<std::string, ActionsAndProbs>* out) {
+  if (state.IsTerminal()) return;
+  if (state.IsChanceNode()) {
+    for (const std::pair<Action, double>& outcome : state.ChanceOutcomes()) {
+      AggregateRecursive(*state.Child(outcome.first), player, policies,
+                         weights, own_reach, out);
+    }
+    return;
+  }
+  const std::vector<Action> legal_actions = state.LegalActions();
+  if (state.CurrentPlayer() != player) {
+    for (Action action : legal_actions) {
+      AggregateRecursive(*state.Child(action), player, policies, weights,
+                         own_reach, out);
+    }
+    return;
+  }
+
+  const std::string info_state = state.InformationStateString(player);
+  std::vector<std::vector<double>> component_probs;
+  component_probs.reserve(policies.size());
+  for (const TabularPolicy& policy : policies) {
+    component_probs.push_back(
+        ComponentProbs(policy, info_state, legal_actions));
+  }
+
+  if (out->find(info_state) == out->end()) {
+    std::vector<double> blended(legal_actions.size(), 0.0);
+    double denominator = 0;
+    for (int k = 0; k < policies.size(); ++k) {
+      const double mass = weights[k] * own_reach[k];
+      denominator += mass;
+      for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+        blended[aidx] += mass * component_probs[k][aidx];
+      }
+    }
+    ActionsAndProbs& entry = (*out)[info_state];
+    entry.reserve(legal_actions.size());
+    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+      // An infostate the player never reaches under any component gets a
+      // uniform policy, so the aggregate covers every infostate and a best
+      // responder can query it anywhere.
+      entry.push_back({legal_actions[aidx],
+                       denominator > 0 ? blended[aidx] / denominator
+                                       : 1.0 / legal_actions.size()});
+    }
+  }
+
+  std::vector<double> child_reach(policies.size());
+  for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+    for (int k = 0; k < policies.size(); ++k) {
+      child_reach[k] = own_reach[k] * component_probs[k][aidx];
+    }
+    AggregateRecursive(*state.Child(legal_actions[aidx]), player, policies,
+                       weights, child_reach, out);
+  }
+}
+
+// Player 0's expected return when `policy0` meets `policy1`; exact or
+// sampled per the config.
+double EvaluateCell(const Game& game, const TabularPolicy& policy0,
+                    const TabularPolicy& policy1,
+                    const DoubleOracleConfig& config, int cell_seed) {
+  if (config.num_eval_episodes > 0) {
+    auto shared0 = std::make_shared<TabularPolicy>(policy0);
+    auto shared1 = std::make_shared<TabularPolicy>(policy1);
+    const BotEvaluationResults results = EvaluateBotsBatch(
+        game,
+        [&game, cell_seed, shared0, shared1](Player player) {
+          return MakePolicyBot(game, player, cell_seed + player,
+                               player == 0 ? shared0 : shared1);
+        },
+        config.num_eval_episodes, cell_seed, /*num_threads=*/1);
+    return results.mean_returns[0];
+  }
+  return ExpectedReturns(*game.NewInitialState(), {&policy0, &policy1},
+                         /*depth_limit=*/-1)[0];
+}
+
+// Grows `payoffs` to cover the current strategy pools, evaluating only the
+// cells the previous iterations have not filled. The missing cells are
+// independent, so they are distributed round-robin over
+// config.num_threads workers.
+void ExpandPayoffMatrix(const Game& game,
+                        const std::vector<std::vector<TabularPolicy>>& pools,
+                        const DoubleOracleConfig& config,
+                        std::vector<std::vector<double>>* payoffs) {
+  const int old_rows = payoffs->size();
+  const int old_cols = old_rows > 0 ? (*payoffs)[0].size() : 0;
+  const int rows = pools[0].size();
+  const int cols = pools[1].size();
+  payoffs->resize(rows);
+  std::vector<std::pair<int, int>> missing;
+  for (int i = 0; i < rows; ++i) {
+    (*payoffs)[i].resize(cols, 0.0);
+    for (int j = 0; j < cols; ++j) {
+      if (i >= old_rows || j >= old_cols) missing.push_back({i, j});
+    }
+  }
+  if (missing.empty()) return;
+
+  const int num_workers =
+      std::min<int>(config.num_threads, static_cast<int>(missing.size()));
+  if (num_workers <= 1) {
+    for (const auto& [i, j] : missing) {
+      (*payoffs)[i][j] = EvaluateCell(game, pools[0][i], pools[1][j], config,
+                                      config.seed + i * 7919 + j);
+    }
+    return;
+  }
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    workers.emplace_back([w, num_workers, &game, &pools, &config, &missing,
+                          payoffs]() {
+      for (int idx = w; idx < missing.size(); idx += num_workers) {
+        const auto& [i, j] = missing[idx];
+        (*payoffs)[i][j] = EvaluateCell(game, pools[0][i], pools[1][j],
+                                        config, config.seed + i * 7919 + j);
+      }
+    });
+  }
+  for (Thread& worker : workers) worker.join();
+}
+
+}  // namespace
+
+TabularPolicy AggregateMixturePolicy(
+    const Game& game, Player player,
+    const std::vector<TabularPolicy>& policies,
+    const std::vector<double>& weights) {
+  SPIEL_CHECK_EQ(policies.size(), weights.size());
+  SPIEL_CHECK_GT(policies.size(), 0);
+  std::unordered_map<std::string, ActionsAndProbs> table;
+  const std::vector<double> own_reach(policies.size(), 1.0);
+  AggregateRecursive(*game.NewInitialState(), player, policies, weights,
+                     own_reach, &table);
+  return TabularPolicy(table);
+}
+
+DoubleOracleResult RunDoubleOracle(const Game& game,
+                                   const DoubleOracleConfig& config) {
+  SPIEL_CHECK_EQ(game.NumPlayers(), 2);
+  SPIEL_CHECK_TRUE(game.GetType().utility == GameType::Utility::kZeroSum);
+  SPIEL_CHECK_TRUE(game.GetType().dynamics == GameType::Dynamics::kSequential);
+  SPIEL_CHECK_GE(config.num_threads, 1);
+
+  DoubleOracleResult result;
+  result.strategies.resize(2);
+  const TabularPolicy uniform = GetUniformPolicy(game);
+  result.strategies[0].push_back(uniform);
+  result.strategies[1].push_back(uniform);
+  ExpandPayoffMatrix(game, result.strategies, config, &result.payoff_matrix);
+
+  const std::unique_ptr<State> root = game.NewInitialState();
+  for (int iter = 1; iter <= config.max_iterations; ++iter) {
+    result.iterations = iter;
+
+    // Solve the restricted meta-game over the current pools.
+    std::vector<std::vector<double>> col_utils = result.payoff_matrix;
+    for (auto& row : col_utils) {
+      for (double& u : row) u = -u;
+    }
+    const ZeroSumGameSolution solution = SolveZeroSumMatrixGame(
+        *matrix_game::CreateMatrixGame(result.payoff_matrix, col_utils));
+    result.game_value = solution.values[0];
+    result.meta_strategies = solution.strategies;
+
+    // Collapse each mixture to a behavior policy and best-respond to it.
+    result.mixture_policies.clear();
+    for (Player player : {Player{0}, Player{1}}) {
+      result.mixture_policies.push_back(
+          AggregateMixturePolicy(game, player, result.strategies[player],
+                                 solution.strategies[player]));
+    }
+    TabularBestResponse br0(game, Player{0}, &result.mixture_policies[1]);
+    TabularBestResponse br1(game, Player{1}, &result.mixture_policies[0]);
+    const double gain0 = br0.Value(*root) - solution.values[0];
+    const double gain1 = br1.Value(*root) - solution.values[1];
+    result.nash_conv = gain0 + gain1;
+    if (result.nash_conv <= config.tolerance) break;
+
+    // Not converged: the best responses are provably outside the pools
+    // (every pooled strategy achieves at most the restricted value against
+    // the equilibrium mixture), so add them and grow the matrix.
+    result.strategies[0].push_back(br0.GetBestResponsePolicy());
+    result.strategies[1].push_back(br1.GetBestResponsePolicy());
+    ExpandPayoffMatrix(game, result.strategies, config,
+                       &result.payoff_matrix);
+  }
+  return result;
+}
+
+}  // namespace ortools
+}  // namespace algorithms
+}  // namespace open_spiel
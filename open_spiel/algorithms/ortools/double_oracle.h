@@ -0,0 +1,102 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_ORTOOLS_DOUBLE_ORACLE_H_
+#define OPEN_SPIEL_ALGORITHMS_ORTOOLS_DOUBLE_ORACLE_H_
+
+#include <vector>
+
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+
+// A double-oracle / PSRO driver for two-player zero-sum games, run entirely
+// in C++: each iteration solves the restricted meta-game over the strategies
+// found so far (ortools/lp_solver.h), collapses each player's equilibrium
+// mixture into a single behavior policy, computes an exact best response to
+// it (best_response.h), and expands the payoff matrix with the new
+// strategies. Payoff cells are evaluated exactly through ExpectedReturns by
+// default, or by sampled play through EvaluateBotsBatch for games too large
+// for exact evaluation; either way the missing cells of an iteration are
+// filled in parallel.
+//
+// See McMahan, Gordon & Blum, "Planning in the Presence of Cost Functions
+// Controlled by an Adversary" (ICML 2003), and Lanctot et al., "A Unified
+// Game-Theoretic Approach to Multiagent Reinforcement Learning" (NeurIPS
+// 2017) for the PSRO view.
+
+namespace open_spiel {
+namespace algorithms {
+namespace ortools {
+
+struct DoubleOracleConfig {
+  // Hard cap on oracle iterations; each iteration adds at most one strategy
+  // per player.
+  int max_iterations = 100;
+  // Convergence threshold on the sum of both players' best-response gains
+  // over the restricted-game value. This is exactly the NashConv of the
+  // meta-game solution in the full game, so the final mixture is a
+  // `tolerance`-Nash equilibrium.
+  double tolerance = 1e-9;
+  // Worker threads for payoff-matrix expansion.
+  int num_threads = 1;
+  // 0 evaluates each payoff cell exactly with ExpectedReturns; a positive
+  // value plays that many episodes per cell with EvaluateBotsBatch instead.
+  int num_eval_episodes = 0;
+  // Base seed for sampled cell evaluation; unused in exact mode.
+  int seed = 0;
+};
+
+struct DoubleOracleResult {
+  // The strategy pools, in discovery order; strategies[p][0] is the uniform
+  // policy both pools are seeded with.
+  std::vector<std::vector<TabularPolicy>> strategies;
+  // Each player's equilibrium mixture over their pool at the final
+  // restricted game.
+  std::vector<std::vector<double>> meta_strategies;
+  // Each player's mixture collapsed to a single behavior policy; this is the
+  // approximate equilibrium strategy to deploy.
+  std::vector<TabularPolicy> mixture_policies;
+  // Player 0's payoff in the restricted game, U[i][j] = player 0's expected
+  // return when row strategy i meets column strategy j.
+  std::vector<std::vector<double>> payoff_matrix;
+  // Player 0's value of the final restricted game.
+  double game_value = 0;
+  // The last measured sum of best-response gains; <= config.tolerance unless
+  // max_iterations was hit first.
+  double nash_conv = 0;
+  int iterations = 0;
+};
+
+// Collapses a weighted mixture of behavior policies for `player` into the
+// single equivalent behavior policy: at each of the player's infostates, the
+// mixture components are blended in proportion to weight times the player's
+// own realization probability of reaching the infostate under that
+// component. Policies with no entry for a reachable infostate contribute a
+// uniform policy there. `weights` must sum to 1 and match `policies` in
+// length.
+TabularPolicy AggregateMixturePolicy(const Game& game, Player player,
+                                     const std::vector<TabularPolicy>& policies,
+                                     const std::vector<double>& weights);
+
+// Runs the double-oracle loop on a two-player zero-sum game until the
+// best-response gains fall below config.tolerance or config.max_iterations
+// is reached.
+DoubleOracleResult RunDoubleOracle(const Game& game,
+                                   const DoubleOracleConfig& config = {});
+
+}  // namespace ortools
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_ORTOOLS_DOUBLE_ORACLE_H_
@@ -0,0 +1,91 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/ortools/double_oracle.h"
+
+#include <memory>
+#include <vector>
+
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace ortools {
+namespace {
+
+void TestAggregateSingleComponentIsIdentity() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  const TabularPolicy uniform = GetUniformPolicy(*game);
+  const TabularPolicy aggregate =
+      AggregateMixturePolicy(*game, Player{0}, {uniform}, {1.0});
+  // A one-component mixture must reproduce the component on every infostate
+  // of the player.
+  for (const auto& [info_state, state_policy] : aggregate.PolicyTable()) {
+    for (const auto& [action, prob] : state_policy) {
+      SPIEL_CHECK_FLOAT_NEAR(prob, GetProb(uniform.GetStatePolicy(info_state),
+                                           action),
+                             1e-12);
+    }
+  }
+}
+
+void TestDoubleOracleKuhnPoker() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  DoubleOracleConfig config;
+  config.max_iterations = 50;
+  config.tolerance = 1e-6;
+  config.num_threads = 2;
+  const DoubleOracleResult result = RunDoubleOracle(*game, config);
+
+  SPIEL_CHECK_LE(result.nash_conv, config.tolerance);
+  SPIEL_CHECK_LT(result.iterations, config.max_iterations);
+  // 1/18 is the Nash value. See https://en.wikipedia.org/wiki/Kuhn_poker
+  SPIEL_CHECK_FLOAT_NEAR(result.game_value, -1.0 / 18.0, 1e-4);
+  SPIEL_CHECK_EQ(result.strategies[0].size(), result.meta_strategies[0].size());
+  SPIEL_CHECK_EQ(result.strategies[1].size(), result.meta_strategies[1].size());
+  SPIEL_CHECK_EQ(result.payoff_matrix.size(), result.strategies[0].size());
+}
+
+void TestDoubleOracleKuhnPokerSampled() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  DoubleOracleConfig config;
+  config.max_iterations = 10;
+  // Sampled payoffs carry Monte-Carlo noise, so only ask for a loose gap.
+  config.tolerance = 0.1;
+  config.num_eval_episodes = 2000;
+  config.num_threads = 2;
+  config.seed = 17;
+  const DoubleOracleResult result = RunDoubleOracle(*game, config);
+
+  SPIEL_CHECK_EQ(result.mixture_policies.size(), 2);
+  SPIEL_CHECK_GT(result.iterations, 0);
+  // The restricted-game value should be in the right neighbourhood even with
+  // sampled cells.
+  SPIEL_CHECK_FLOAT_NEAR(result.game_value, -1.0 / 18.0, 0.05);
+}
+
+}  // namespace
+}  // namespace ortools
+}  // namespace algorithms
+}  // namespace open_spiel
+
+namespace algorithms = open_spiel::algorithms;
+
+int main(int argc, char** argv) {
+  algorithms::ortools::TestAggregateSingleComponentIsIdentity();
+  algorithms::ortools::TestDoubleOracleKuhnPoker();
+  algorithms::ortools::TestDoubleOracleKuhnPokerSampled();
+}
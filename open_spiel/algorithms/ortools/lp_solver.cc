@@ -14,11 +14,16 @@
 
 #include "open_spiel/algorithms/ortools/lp_solver.h"
 
+#include <algorithm>
+#include <memory>
 #include <numeric>
+#include <vector>
 
+#include "open_spiel/abseil-cpp/absl/memory/memory.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/algorithms/corr_dist.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread.h"
 #include "ortools/linear_solver/linear_solver.h"
 
 namespace open_spiel {
@@ -51,7 +56,13 @@ std::pair<opres::MPVariable*, opres::MPObjective*> SetupVariablesAndObjective(
   return {v, objective};
 }
 
-ZeroSumGameSolution SolveZeroSumMatrixGame(
+ZeroSumMatrixGameSolver::ZeroSumMatrixGameSolver()
+    : solver_(absl::make_unique<opres::MPSolver>(
+          "solver", opres::MPSolver::GLOP_LINEAR_PROGRAMMING)) {}
+
+ZeroSumMatrixGameSolver::~ZeroSumMatrixGameSolver() = default;
+
+ZeroSumGameSolution ZeroSumMatrixGameSolver::Solve(
     const matrix_game::MatrixGame& matrix_game) {
   SPIEL_CHECK_EQ(matrix_game.GetType().information,
                  GameType::Information::kOneShot);
@@ -83,55 +94,97 @@ ZeroSumGameSolution SolveZeroSumMatrixGame(
       {0, 0},
       {std::vector<double>(num_rows, 0), std::vector<double>(num_cols, 0)}};
 
+  // One LP per player; Clear() keeps the underlying GLOP interface alive, so
+  // only the model is rebuilt between instances.
+
   // First, the row player (player 0).
-  opres::MPSolver p0_solver("solver", opres::MPSolver::GLOP_LINEAR_PROGRAMMING);
-  std::vector<opres::MPVariable*> p0_vars;
+  solver_->Clear();
+  scratch_vars_.clear();
   auto [p0_v, p0_objective] = SetupVariablesAndObjective(
-      &p0_solver, &p0_vars, num_rows, min_utility, max_utility);
+      solver_.get(), &scratch_vars_, num_rows, min_utility, max_utility);
 
   // Utility constriants
   for (int c = 0; c < num_cols; ++c) {
-    opres::MPConstraint* const constraint = p0_solver.MakeRowConstraint();
+    opres::MPConstraint* const constraint = solver_->MakeRowConstraint();
     constraint->SetLB(0.0);
     constraint->SetCoefficient(p0_v, -1.0);
     for (int r = 0; r < num_rows; ++r) {
-      constraint->SetCoefficient(p0_vars[r],
+      constraint->SetCoefficient(scratch_vars_[r],
                                  matrix_game.PlayerUtility(0, r, c));
     }
   }
 
-  p0_solver.Solve();
+  solver_->Solve();
   solution.values[0] = p0_objective->Value();
   for (int r = 0; r < num_rows; ++r) {
-    solution.strategies[0][r] = p0_vars[r]->solution_value();
+    solution.strategies[0][r] = scratch_vars_[r]->solution_value();
   }
 
   // Now, the column player.
-  opres::MPSolver p1_solver("solver", opres::MPSolver::GLOP_LINEAR_PROGRAMMING);
-  std::vector<opres::MPVariable*> p1_vars;
+  solver_->Clear();
+  scratch_vars_.clear();
   auto [p1_v, p1_objective] = SetupVariablesAndObjective(
-      &p1_solver, &p1_vars, num_cols, min_utility, max_utility);
+      solver_.get(), &scratch_vars_, num_cols, min_utility, max_utility);
 
   // Utility constriants
   for (int r = 0; r < num_rows; ++r) {
-    opres::MPConstraint* const constraint = p1_solver.MakeRowConstraint();
+    opres::MPConstraint* const constraint = solver_->MakeRowConstraint();
     constraint->SetLB(0.0);
     constraint->SetCoefficient(p1_v, -1.0);
     for (int c = 0; c < num_cols; ++c) {
-      constraint->SetCoefficient(p1_vars[c],
+      constraint->SetCoefficient(scratch_vars_[c],
                                  matrix_game.PlayerUtility(1, r, c));
     }
   }
 
-  p1_solver.Solve();
+  solver_->Solve();
   solution.values[1] = p1_objective->Value();
   for (int c = 0; c < num_cols; ++c) {
-    solution.strategies[1][c] = p1_vars[c]->solution_value();
+    solution.strategies[1][c] = scratch_vars_[c]->solution_value();
   }
 
   return solution;
 }
 
+ZeroSumGameSolution SolveZeroSumMatrixGame(
+    const matrix_game::MatrixGame& matrix_game) {
+  ZeroSumMatrixGameSolver solver;
+  return solver.Solve(matrix_game);
+}
+
+std::vector<ZeroSumGameSolution> SolveZeroSumMatrixGames(
+    const std::vector<const matrix_game::MatrixGame*>& matrix_games,
+    int num_threads) {
+  SPIEL_CHECK_GE(num_threads, 1);
+  std::vector<ZeroSumGameSolution> solutions(matrix_games.size());
+
+  const int num_workers =
+      std::min<int>(num_threads, matrix_games.size());
+  if (num_workers <= 1) {
+    ZeroSumMatrixGameSolver solver;
+    for (int i = 0; i < matrix_games.size(); ++i) {
+      solutions[i] = solver.Solve(*matrix_games[i]);
+    }
+    return solutions;
+  }
+
+  // The matrices are independent, so workers take strided subsets, each with
+  // its own reusable solver.
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int t = 0; t < num_workers; ++t) {
+    workers.emplace_back([t, num_workers, &matrix_games, &solutions]() {
+      ZeroSumMatrixGameSolver solver;
+      for (int i = t; i < matrix_games.size(); i += num_workers) {
+        solutions[i] = solver.Solve(*matrix_games[i]);
+      }
+    });
+  }
+  for (Thread& worker : workers) worker.join();
+
+  return solutions;
+}
+
 NormalFormCorrelationDevice ComputeCorrelatedEquilibrium(
     const NormalFormGame& normal_form_game, CorrEqObjType obj_type,
     double social_welfare_lower_bound) {
@@ -15,11 +15,17 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_ORTOOLS_LP_SOLVER_H_
 #define OPEN_SPIEL_ALGORITHMS_ORTOOLS_LP_SOLVER_H_
 
+#include <memory>
 #include <vector>
 
 #include "open_spiel/algorithms/corr_dist.h"
 #include "open_spiel/matrix_game.h"
 
+namespace operations_research {
+class MPSolver;
+class MPVariable;
+}  // namespace operations_research
+
 namespace open_spiel {
 namespace algorithms {
 namespace ortools {
@@ -38,6 +44,31 @@ enum class CorrEqObjType {
 ZeroSumGameSolution SolveZeroSumMatrixGame(
     const matrix_game::MatrixGame& matrix_game);
 
+// A reusable solver for zero-sum matrix games. The underlying LP solver is
+// constructed once and cleared between instances, so solving many small
+// matrices (e.g. subgame payoff matrices in a resolver) amortizes the solver
+// setup that dominates at those sizes. Not thread-safe; give each thread its
+// own instance.
+class ZeroSumMatrixGameSolver {
+ public:
+  ZeroSumMatrixGameSolver();
+  ~ZeroSumMatrixGameSolver();
+
+  // Same result as SolveZeroSumMatrixGame above.
+  ZeroSumGameSolution Solve(const matrix_game::MatrixGame& matrix_game);
+
+ private:
+  std::unique_ptr<operations_research::MPSolver> solver_;
+  std::vector<operations_research::MPVariable*> scratch_vars_;
+};
+
+// Solves a batch of independent zero-sum matrix games. With num_threads > 1
+// the matrices are distributed over that many threads, each with its own
+// reusable solver; solutions are returned in input order.
+std::vector<ZeroSumGameSolution> SolveZeroSumMatrixGames(
+    const std::vector<const matrix_game::MatrixGame*>& matrix_games,
+    int num_threads = 1);
+
 NormalFormCorrelationDevice ComputeCorrelatedEquilibrium(
     const NormalFormGame& normal_form_game, CorrEqObjType obj_type,
     double social_welfare_lower_bound);
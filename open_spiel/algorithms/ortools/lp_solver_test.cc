@@ -42,6 +42,46 @@ void TestSolveMatrixGame() {
   }
 }
 
+void TestSolveMatrixGameBatch() {
+  std::shared_ptr<const matrix_game::MatrixGame> rps =
+      LoadMatrixGame("matrix_rps");
+  std::shared_ptr<const matrix_game::MatrixGame> mp =
+      LoadMatrixGame("matrix_mp");
+  std::vector<const matrix_game::MatrixGame*> batch;
+  for (int i = 0; i < 10; ++i) {
+    batch.push_back(i % 2 == 0 ? rps.get() : mp.get());
+  }
+
+  // A reused solver, the serial batch, and the threaded batch must all agree
+  // with the one-shot API.
+  ZeroSumMatrixGameSolver reused_solver;
+  std::vector<ZeroSumGameSolution> serial = SolveZeroSumMatrixGames(batch);
+  std::vector<ZeroSumGameSolution> parallel =
+      SolveZeroSumMatrixGames(batch, /*num_threads=*/3);
+  SPIEL_CHECK_EQ(serial.size(), batch.size());
+  SPIEL_CHECK_EQ(parallel.size(), batch.size());
+  for (int i = 0; i < batch.size(); ++i) {
+    ZeroSumGameSolution expected = SolveZeroSumMatrixGame(*batch[i]);
+    ZeroSumGameSolution reused = reused_solver.Solve(*batch[i]);
+    for (Player p : {0, 1}) {
+      SPIEL_CHECK_FLOAT_NEAR(serial[i].values[p], expected.values[p],
+                             kErrorTolerance);
+      SPIEL_CHECK_FLOAT_NEAR(parallel[i].values[p], expected.values[p],
+                             kErrorTolerance);
+      SPIEL_CHECK_FLOAT_NEAR(reused.values[p], expected.values[p],
+                             kErrorTolerance);
+      for (int a = 0; a < expected.strategies[p].size(); ++a) {
+        SPIEL_CHECK_FLOAT_NEAR(serial[i].strategies[p][a],
+                               expected.strategies[p][a], kErrorTolerance);
+        SPIEL_CHECK_FLOAT_NEAR(parallel[i].strategies[p][a],
+                               expected.strategies[p][a], kErrorTolerance);
+        SPIEL_CHECK_FLOAT_NEAR(reused.strategies[p][a],
+                               expected.strategies[p][a], kErrorTolerance);
+      }
+    }
+  }
+}
+
 void TestCorrelatedEquilibrium() {
   // Wikipedia example:
   // https://en.wikipedia.org/wiki/Correlated_equilibrium#An_example
@@ -102,5 +142,6 @@ namespace algorithms = open_spiel::algorithms;
 
 int main(int argc, char **argv) {
   algorithms::ortools::TestSolveMatrixGame();
+  algorithms::ortools::TestSolveMatrixGameBatch();
   algorithms::ortools::TestCorrelatedEquilibrium();
 }
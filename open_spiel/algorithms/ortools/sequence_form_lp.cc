@@ -51,27 +51,31 @@ SequenceFormLpSpecification::SequenceFormLpSpecification(
 
 void SequenceFormLpSpecification::SpecifyReachProbsConstraints(
     InfostateNode* player_node) {
-  node_spec_[player_node].var_reach_prob = solver_->MakeNumVar(
+  // Note: the reference stays valid across the recursive calls below
+  // (unordered_map never invalidates references on insert).
+  NodeSpecification& node_data = node_spec_[player_node];
+  node_data.var_reach_prob = solver_->MakeNumVar(
       /*lb=*/0.0, /*ub=*/1., "");
 
   if (player_node->type() == kTerminalInfostateNode) return;  // Nothing to do.
   if (player_node->type() == kObservationInfostateNode) {
     for (InfostateNode* player_child : player_node->child_iterator()) {
       SpecifyReachProbsConstraints(player_child);
+      NodeSpecification& child_data = node_spec_[player_child];
 
       // Equality constraint: parent = child
-      opres::MPConstraint* ct = node_spec_[player_child].ct_parent_reach_prob =
+      opres::MPConstraint* ct = child_data.ct_parent_reach_prob =
           solver_->MakeRowConstraint(/*lb=*/0, /*ub=*/0, "");
-      ct->SetCoefficient(node_spec_[player_node].var_reach_prob, -1);
-      ct->SetCoefficient(node_spec_[player_child].var_reach_prob, 1);
+      ct->SetCoefficient(node_data.var_reach_prob, -1);
+      ct->SetCoefficient(child_data.var_reach_prob, 1);
     }
     return;
   }
   if (player_node->type() == kDecisionInfostateNode) {
     // Equality constraint: parent = sum of children
-    opres::MPConstraint* ct = node_spec_[player_node].ct_child_reach_prob =
+    opres::MPConstraint* ct = node_data.ct_child_reach_prob =
         solver_->MakeRowConstraint(/*lb=*/0, /*ub=*/0, "");
-    ct->SetCoefficient(node_spec_[player_node].var_reach_prob, -1);
+    ct->SetCoefficient(node_data.var_reach_prob, -1);
     for (InfostateNode* player_child : player_node->child_iterator()) {
       SpecifyReachProbsConstraints(player_child);
       ct->SetCoefficient(node_spec_[player_child].var_reach_prob, 1);
@@ -84,26 +88,28 @@ void SequenceFormLpSpecification::SpecifyReachProbsConstraints(
 
 void SequenceFormLpSpecification::SpecifyCfValuesConstraints(
     InfostateNode* opponent_node) {
-  node_spec_[opponent_node].var_cf_value = solver_->MakeNumVar(
+  NodeSpecification& node_data = node_spec_[opponent_node];
+  node_data.var_cf_value = solver_->MakeNumVar(
       /*lb=*/-opres::MPSolver::infinity(),
       /*ub=*/opres::MPSolver::infinity(), "");
 
   if (opponent_node->type() == kDecisionInfostateNode) {
     for (InfostateNode* opponent_child : opponent_node->child_iterator()) {
       SpecifyCfValuesConstraints(opponent_child);
-      opres::MPConstraint* ct = node_spec_[opponent_child].ct_parent_cf_value =
+      NodeSpecification& child_data = node_spec_[opponent_child];
+      opres::MPConstraint* ct = child_data.ct_parent_cf_value =
           solver_->MakeRowConstraint();
       ct->SetUB(0.);
-      ct->SetCoefficient(node_spec_[opponent_node].var_cf_value, -1);
-      ct->SetCoefficient(node_spec_[opponent_child].var_cf_value, 1);
+      ct->SetCoefficient(node_data.var_cf_value, -1);
+      ct->SetCoefficient(child_data.var_cf_value, 1);
     }
     return;
   }
 
-  opres::MPConstraint* ct = node_spec_[opponent_node].ct_child_cf_value =
+  opres::MPConstraint* ct = node_data.ct_child_cf_value =
       solver_->MakeRowConstraint();
   ct->SetUB(0.);
-  ct->SetCoefficient(node_spec_[opponent_node].var_cf_value, -1);
+  ct->SetCoefficient(node_data.var_cf_value, -1);
 
   if (opponent_node->type() == kTerminalInfostateNode) {
     const std::map<const InfostateNode*, const InfostateNode*>& terminal_map =
@@ -153,6 +159,7 @@ void SequenceFormLpSpecification::ClearSpecification() {
     spec.ct_child_reach_prob = nullptr;
     spec.ct_parent_reach_prob = nullptr;
   }
+  specified_player_ = kInvalidPlayer;
 }
 
 void SequenceFormLpSpecification::SpecifyLinearProgram(Player pl) {
@@ -166,10 +173,39 @@ void SequenceFormLpSpecification::SpecifyLinearProgram(Player pl) {
       /*opponent_node=*/trees_[1 - pl]->mutable_root());
   SpecifyObjective(
       /*opponent_root_node=*/trees_[1 - pl]->mutable_root());
+  specified_player_ = pl;
+}
+
+double SequenceFormLpSpecification::ResolvePerturbed(
+    Player pl,
+    const std::unordered_map<const InfostateNode*, double>&
+        terminal_utilities) {
+  SPIEL_CHECK_TRUE(pl == 0 || pl == 1);
+  if (specified_player_ != pl) SpecifyLinearProgram(pl);
+  // Only the payoff coefficients in the terminal cf-value constraints are
+  // rewritten; variables and constraints are untouched, so the solver re-uses
+  // the basis from the previous solve.
+  const std::map<const InfostateNode*, const InfostateNode*>& terminal_map =
+      terminal_bijection_.association(trees_[1 - pl]->acting_player());
+  for (const auto& [opponent_node, new_utility] : terminal_utilities) {
+    SPIEL_CHECK_EQ(opponent_node->type(), kTerminalInfostateNode);
+    const InfostateNode* player_node = terminal_map.at(opponent_node);
+    const double value =
+        new_utility * opponent_node->terminal_chance_reach_prob();
+    node_spec_[opponent_node].ct_child_cf_value->SetCoefficient(
+        node_spec_[player_node].var_reach_prob, value);
+  }
+  return Solve();
 }
 
 double SequenceFormLpSpecification::Solve() {
-  opres::MPSolver::ResultStatus status = solver_->Solve();
+  // Incremental re-solves: when the model was only perturbed since the last
+  // call (see ResolvePerturbed), the underlying solver warm starts from its
+  // previous basis instead of solving from scratch.
+  opres::MPSolverParameters params;
+  params.SetIntegerParam(opres::MPSolverParameters::INCREMENTALITY,
+                         opres::MPSolverParameters::INCREMENTALITY_ON);
+  opres::MPSolver::ResultStatus status = solver_->Solve(params);
   //  // Export the model if the result was not optimal.
   //  // You can then use external debugging tools (like cplex studio).
   //  if (status != opres::MPSolver::ResultStatus::OPTIMAL) {
@@ -93,8 +93,23 @@ class SequenceFormLpSpecification {
 
   // Solve the linear program.
   // Returns the root value for the player whose strategy was computed.
+  // Solves are incremental: if the program structure was not cleared since
+  // the last call, the solver warm starts from its previous basis.
   double Solve();
 
+  // Re-solves the LP for the given player after perturbing terminal payoffs,
+  // reusing the existing variables and constraints (and therefore the
+  // solver's basis) instead of rebuilding the whole program.
+  // `terminal_utilities` maps terminal nodes of the *opponent's* tree (the
+  // tree whose cf-value constraints carry the payoffs) to their new
+  // utilities, un-weighted by chance reach probabilities; terminals not in
+  // the map keep their current coefficient. If the program has not been
+  // specified for this player yet, it is built from scratch first.
+  double ResolvePerturbed(
+      Player pl,
+      const std::unordered_map<const InfostateNode*, double>&
+          terminal_utilities);
+
   // Reset the solver and erase all pointers.
   // This is called automatically when you call SpecifyLinearProgram.
   void ClearSpecification();
@@ -130,6 +145,10 @@ class SequenceFormLpSpecification {
   const BijectiveContainer<const InfostateNode*> terminal_bijection_;
   std::unique_ptr<operations_research::MPSolver> solver_;
   std::unordered_map<const InfostateNode*, NodeSpecification> node_spec_;
+  // The player the program is currently specified for, or kInvalidPlayer if
+  // the specification was cleared. Used to decide whether ResolvePerturbed
+  // can reuse the existing program.
+  Player specified_player_ = kInvalidPlayer;
 
   void SpecifyReachProbsConstraints(InfostateNode* player_node);
   void SpecifyCfValuesConstraints(InfostateNode* opponent_node);
@@ -55,6 +55,31 @@ void TestGameValueAndExploitability(const std::string& game_name,
                          kErrorTolerance);
 }
 
+void TestResolvePerturbed() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  SequenceFormLpSpecification specification(*game);
+  specification.SpecifyLinearProgram(0);
+  double base_value = specification.Solve();
+
+  // Re-solving with unchanged terminal utilities must reproduce the value
+  // without respecifying the program.
+  std::unordered_map<const InfostateNode*, double> utilities;
+  const InfostateTree& opponent_tree = *specification.trees()[1];
+  for (InfostateNode* leaf : opponent_tree.leaf_nodes()) {
+    utilities[leaf] = leaf->terminal_utility();
+  }
+  double resolved_value = specification.ResolvePerturbed(0, utilities);
+  SPIEL_CHECK_FLOAT_NEAR(resolved_value, base_value, kErrorTolerance);
+
+  // The opponent tree carries player 1's utilities. Shifting them all by a
+  // constant raises player 1's best-response value by that constant, so the
+  // returned value (player 0's) drops by the same amount.
+  constexpr double kShift = 0.25;
+  for (auto& [leaf, utility] : utilities) utility += kShift;
+  double shifted_value = specification.ResolvePerturbed(0, utilities);
+  SPIEL_CHECK_FLOAT_NEAR(shifted_value, base_value - kShift, kErrorTolerance);
+}
+
 }  // namespace
 }  // namespace ortools
 }  // namespace algorithms
@@ -69,4 +94,5 @@ int main(int argc, char** argv) {
                                                       -0.085606424078);
   algorithms::ortools::TestGameValueAndExploitability(
       "goofspiel(players=2,num_cards=3,imp_info=True)", 0.);
+  algorithms::ortools::TestResolvePerturbed();
 }
@@ -15,14 +15,19 @@
 #include "open_spiel/algorithms/outcome_sampling_mccfr.h"
 
 #include <cmath>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <random>
+#include <shared_mutex>
 
-#include "open_spiel/abseil-cpp/absl/random/discrete_distribution.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
 #include "open_spiel/algorithms/cfr.h"
+#include "open_spiel/algorithms/mmap_infostate_store.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -54,7 +59,6 @@ OutcomeSamplingMCCFRSolver::OutcomeSamplingMCCFRSolver(
     : game_(game),
       epsilon_(epsilon),
       rng_(rng),
-      dist_(0.0, 1.0),
       default_policy_(default_policy) {
   if (game_->GetType().dynamics != GameType::Dynamics::kSequential) {
     SpielFatalError(
@@ -65,11 +69,15 @@ OutcomeSamplingMCCFRSolver::OutcomeSamplingMCCFRSolver(
 }
 
 void OutcomeSamplingMCCFRSolver::RunIteration(std::mt19937* rng) {
+  // Episodes sample with a counter-based stream keyed by one draw of the
+  // caller's generator, so the iteration remains a pure function of the
+  // mt19937 state that Serialize() stores.
+  CounterRng episode_rng((*rng)(), /*stream=*/0);
   // for (Player update_player = Player{0}; update_player < game_->NumPlayers();
   // ++update_player) {
   for (Player p = Player{0}; p < game_->NumPlayers(); ++p) {
     std::unique_ptr<State> state = game_->NewInitialState();
-    SampleEpisode(state.get(), p, rng, 1.0, 1.0, 1.0);
+    SampleEpisode(state.get(), p, &episode_rng, 1.0, 1.0, 1.0);
   }
 }
 
@@ -110,26 +118,11 @@ std::string OutcomeSamplingMCCFRSolver::Serialize(int double_precision,
   return str;
 }
 
-std::vector<double> OutcomeSamplingMCCFRSolver::SamplePolicy(
-    const CFRInfoStateValues& info_state) const {
-  std::vector<double> policy = info_state.current_policy;
-  for (int i = 0; i < policy.size(); ++i) {
-    policy[i] = epsilon_ * 1.0 / policy.size() + (1 - epsilon_) * policy[i];
-  }
-  return policy;
-}
-
-double OutcomeSamplingMCCFRSolver::Baseline(
-    const State& state, const CFRInfoStateValues& info_state, int aidx) const {
-  // Default to vanilla outcome sampling.
-  return 0;
-}
-
 // Applies Eq. 9 of Schmid et al. '19
 double OutcomeSamplingMCCFRSolver::BaselineCorrectedChildValue(
-    const State& state, const CFRInfoStateValues& info_state, int sampled_aidx,
-    int aidx, double child_value, double sample_prob) const {
-  double baseline = Baseline(state, info_state, aidx);
+    const std::vector<double>& baselines, int sampled_aidx, int aidx,
+    double child_value, double sample_prob) const {
+  double baseline = Baseline(baselines, aidx);
   if (aidx == sampled_aidx) {
     return baseline + (child_value - baseline) / sample_prob;
   } else {
@@ -137,14 +130,61 @@ double OutcomeSamplingMCCFRSolver::BaselineCorrectedChildValue(
   }
 }
 
+std::vector<double> OutcomeSamplingMCCFRSolver::LookupBaselines(
+    const std::string& is_key, int num_actions) {
+  if (!use_baselines_) return {};
+  if (parallel_context_ == nullptr) {
+    auto iter_and_result =
+        baselines_.insert({is_key, std::vector<double>(num_actions, 0.0)});
+    return iter_and_result.first->second;
+  }
+
+  ParallelContext& ctx = *parallel_context_;
+  std::mutex& value_mutex =
+      ctx.value_mutexes[absl::Hash<std::string>()(is_key) %
+                        kNumValueMutexStripes];
+  {
+    std::shared_lock<std::shared_mutex> map_lock(ctx.baseline_map_mutex);
+    auto iter = baselines_.find(is_key);
+    if (iter != baselines_.end()) {
+      std::lock_guard<std::mutex> value_lock(value_mutex);
+      return iter->second;
+    }
+  }
+  std::unique_lock<std::shared_mutex> map_lock(ctx.baseline_map_mutex);
+  auto iter_and_result =
+      baselines_.insert({is_key, std::vector<double>(num_actions, 0.0)});
+  return iter_and_result.first->second;
+}
+
+void OutcomeSamplingMCCFRSolver::UpdateBaseline(const std::string& is_key,
+                                                int aidx, double value) {
+  if (parallel_context_ == nullptr) {
+    double& baseline = baselines_[is_key][aidx];
+    baseline = (1.0 - kBaselineDecay) * baseline + kBaselineDecay * value;
+    return;
+  }
+
+  ParallelContext& ctx = *parallel_context_;
+  std::mutex& value_mutex =
+      ctx.value_mutexes[absl::Hash<std::string>()(is_key) %
+                        kNumValueMutexStripes];
+  std::shared_lock<std::shared_mutex> map_lock(ctx.baseline_map_mutex);
+  auto iter = baselines_.find(is_key);
+  SPIEL_CHECK_TRUE(iter != baselines_.end());
+  std::lock_guard<std::mutex> value_lock(value_mutex);
+  double& baseline = iter->second[aidx];
+  baseline = (1.0 - kBaselineDecay) * baseline + kBaselineDecay * value;
+}
+
 double OutcomeSamplingMCCFRSolver::SampleEpisode(
-    State* state, Player update_player, std::mt19937* rng, double my_reach,
+    State* state, Player update_player, CounterRng* rng, double my_reach,
     double opp_reach, double sample_reach) {
   if (state->IsTerminal()) {
     return state->PlayerReturn(update_player);
   } else if (state->IsChanceNode()) {
     std::pair<Action, double> outcome_and_prob =
-        SampleAction(state->ChanceOutcomes(), dist_(*rng));
+        SampleAction(state->ChanceOutcomes(), rng->UniformDouble());
     SPIEL_CHECK_PROB(outcome_and_prob.second);
     SPIEL_CHECK_GT(outcome_and_prob.second, 0);
     state->ApplyAction(outcome_and_prob.first);
@@ -163,23 +203,23 @@ double OutcomeSamplingMCCFRSolver::SampleEpisode(
   std::string is_key = state->InformationStateString(player);
   std::vector<Action> legal_actions = state->LegalActions();
 
-  // The insert here only inserts the default value if the key is not found,
-  // otherwise returns the entry in the map.
-  auto iter_and_result = info_states_.insert(
-      {is_key, CFRInfoStateValues(legal_actions, kInitialTableValues)});
-
-  CFRInfoStateValues info_state_copy = iter_and_result.first->second;
+  CFRInfoStateValues info_state_copy = LookupInfoState(is_key, legal_actions);
   info_state_copy.ApplyRegretMatching();
-
-  const std::vector<double>& sample_policy =
-      (player == update_player ? SamplePolicy(info_state_copy)
-                               : info_state_copy.current_policy);
-
-  absl::discrete_distribution<int> action_dist(sample_policy.begin(),
-                                               sample_policy.end());
-  int sampled_aidx = action_dist(*rng);
-  SPIEL_CHECK_PROB(sample_policy[sampled_aidx]);
-  SPIEL_CHECK_GT(sample_policy[sampled_aidx], 0);
+  // Fetched before descending so the correction uses values independent of
+  // this node's sampled outcome; empty when baselines are disabled.
+  std::vector<double> baselines =
+      LookupBaselines(is_key, legal_actions.size());
+
+  // The update player explores with epsilon-greedy mixing, the opponent
+  // samples the current policy. Sampling straight from the info state values
+  // avoids materializing a mixed-policy vector on every visited node.
+  const double sample_epsilon = (player == update_player) ? epsilon_ : 0.0;
+  const int sampled_aidx =
+      info_state_copy.SampleActionIndex(sample_epsilon, rng->UniformDouble());
+  const double sample_prob =
+      info_state_copy.SampledPolicyProb(sampled_aidx, sample_epsilon);
+  SPIEL_CHECK_PROB(sample_prob);
+  SPIEL_CHECK_GT(sample_prob, 0);
 
   state->ApplyAction(legal_actions[sampled_aidx]);
   double child_value = SampleEpisode(
@@ -190,14 +230,19 @@ double OutcomeSamplingMCCFRSolver::SampleEpisode(
       player == update_player
           ? opp_reach
           : opp_reach * info_state_copy.current_policy[sampled_aidx],
-      sample_reach * sample_policy[sampled_aidx]);
+      sample_reach * sample_prob);
 
-  // Compute each of the child estimated values.
+  // The sampled action's baseline decays toward the episode's estimate of
+  // its subtree value; the corrections below use the pre-update copy fetched
+  // above.
+  if (use_baselines_) UpdateBaseline(is_key, sampled_aidx, child_value);
+
+  // Compute each of the child estimated values. The sample probability is
+  // only read for the sampled action (Eq. 9's importance correction).
   std::vector<double> child_values(legal_actions.size(), 0);
   for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
-    child_values[aidx] =
-        BaselineCorrectedChildValue(*state, info_state_copy, sampled_aidx, aidx,
-                                    child_value, sample_policy[aidx]);
+    child_values[aidx] = BaselineCorrectedChildValue(
+        baselines, sampled_aidx, aidx, child_value, sample_prob);
   }
 
   // Compute the value of this history for this policy.
@@ -209,36 +254,137 @@ double OutcomeSamplingMCCFRSolver::SampleEpisode(
 
   if (player == update_player) {
     // Now the regret and avg strategy updates.
-    CFRInfoStateValues& info_state = info_states_[is_key];
-    info_state.ApplyRegretMatching();
-
-    // Estimate for the counterfactual value of the policy.
-    double cf_value = value_estimate * opp_reach / sample_reach;
-
-    // Update regrets.
-    //
-    // Note: different from Chapter 4 of Lanctot '13 thesis, the utilities
-    // coming back from the recursion are already multiplied by the players'
-    // tail reaches and divided by the sample tail reach. So when adding regrets
-    // to the table, we need only multiply by the opponent reach and divide by
-    // the sample reach to this point.
-    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
-      // Estimate for the counterfactual value of the policy replaced by always
-      // choosing sampled_aidx at this information state.
-      double cf_action_value = child_values[aidx] * opp_reach / sample_reach;
-      info_state.cumulative_regrets[aidx] += (cf_action_value - cf_value);
-    }
+    UpdateInfoState(is_key, [&](CFRInfoStateValues& info_state) {
+      info_state.ApplyRegretMatching();
+
+      // Estimate for the counterfactual value of the policy.
+      double cf_value = value_estimate * opp_reach / sample_reach;
+
+      // Update regrets.
+      //
+      // Note: different from Chapter 4 of Lanctot '13 thesis, the utilities
+      // coming back from the recursion are already multiplied by the players'
+      // tail reaches and divided by the sample tail reach. So when adding
+      // regrets to the table, we need only multiply by the opponent reach and
+      // divide by the sample reach to this point.
+      for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+        // Estimate for the counterfactual value of the policy replaced by
+        // always choosing sampled_aidx at this information state.
+        double cf_action_value = child_values[aidx] * opp_reach / sample_reach;
+        info_state.cumulative_regrets[aidx] += (cf_action_value - cf_value);
+      }
+
+      // Update the average policy.
+      for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
+        double increment =
+            my_reach * info_state.current_policy[aidx] / sample_reach;
+        SPIEL_CHECK_FALSE(std::isnan(increment) || std::isinf(increment));
+        info_state.cumulative_policy[aidx] += increment;
+      }
+    });
+  }
+
+  return value_estimate;
+}
 
-    // Update the average policy.
-    for (int aidx = 0; aidx < legal_actions.size(); ++aidx) {
-      double increment =
-          my_reach * info_state.current_policy[aidx] / sample_reach;
-      SPIEL_CHECK_FALSE(std::isnan(increment) || std::isinf(increment));
-      info_state.cumulative_policy[aidx] += increment;
+CFRInfoStateValues OutcomeSamplingMCCFRSolver::LookupInfoState(
+    const std::string& is_key, const std::vector<Action>& legal_actions) {
+  if (backing_store_ != nullptr) {
+    CFRInfoStateValues values;
+    backing_store_->LoadOrCreate(MmapInfoStateStore::KeyFor(is_key),
+                                 legal_actions, kInitialTableValues, &values);
+    return values;
+  }
+  if (parallel_context_ == nullptr) {
+    // The insert here only inserts the default value if the key is not found,
+    // otherwise returns the entry in the map.
+    auto iter_and_result = info_states_.insert(
+        {is_key, CFRInfoStateValues(legal_actions, kInitialTableValues)});
+    return iter_and_result.first->second;
+  }
+
+  ParallelContext& ctx = *parallel_context_;
+  std::mutex& value_mutex =
+      ctx.value_mutexes[absl::Hash<std::string>()(is_key) %
+                        kNumValueMutexStripes];
+  {
+    std::shared_lock<std::shared_mutex> map_lock(ctx.map_mutex);
+    auto iter = info_states_.find(is_key);
+    if (iter != info_states_.end()) {
+      // The value lock orders this copy against concurrent updates; holding
+      // the map lock shared meanwhile keeps the entry from being moved by an
+      // inserting thread's rehash.
+      std::lock_guard<std::mutex> value_lock(value_mutex);
+      return iter->second;
     }
   }
+  // Miss: insert under the exclusive lock. Another thread may have inserted
+  // the key since the shared lock was dropped; insert() handles that.
+  std::unique_lock<std::shared_mutex> map_lock(ctx.map_mutex);
+  auto iter_and_result = info_states_.insert(
+      {is_key, CFRInfoStateValues(legal_actions, kInitialTableValues)});
+  return iter_and_result.first->second;
+}
 
-  return value_estimate;
+template <typename UpdateFn>
+void OutcomeSamplingMCCFRSolver::UpdateInfoState(const std::string& is_key,
+                                                 UpdateFn update) {
+  if (backing_store_ != nullptr) {
+    const uint64_t store_key = MmapInfoStateStore::KeyFor(is_key);
+    CFRInfoStateValues values;
+    SPIEL_CHECK_TRUE(backing_store_->Load(store_key, &values));
+    update(values);
+    backing_store_->Store(store_key, values);
+    return;
+  }
+  if (parallel_context_ == nullptr) {
+    update(info_states_[is_key]);
+    return;
+  }
+
+  ParallelContext& ctx = *parallel_context_;
+  std::mutex& value_mutex =
+      ctx.value_mutexes[absl::Hash<std::string>()(is_key) %
+                        kNumValueMutexStripes];
+  std::shared_lock<std::shared_mutex> map_lock(ctx.map_mutex);
+  auto iter = info_states_.find(is_key);
+  SPIEL_CHECK_TRUE(iter != info_states_.end());
+  std::lock_guard<std::mutex> value_lock(value_mutex);
+  update(iter->second);
+}
+
+void OutcomeSamplingMCCFRSolver::RunIterationsParallel(int num_iterations,
+                                                       int num_threads) {
+  SPIEL_CHECK_GE(num_iterations, 1);
+  SPIEL_CHECK_GE(num_threads, 1);
+  // The backing store is single-threaded; see SetBackingStore.
+  SPIEL_CHECK_TRUE(backing_store_ == nullptr);
+  parallel_context_ = std::make_unique<ParallelContext>();
+
+  // One base key for the whole batch; iteration i samples from the
+  // counter-based stream (episode_seed, i) no matter which thread runs it,
+  // so the sampled episodes are bit-identical across thread counts.
+  const uint64_t episode_seed = rng_();
+
+  std::vector<Thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([this, episode_seed, t, num_iterations,
+                          num_threads]() {
+      const int begin = t * num_iterations / num_threads;
+      const int end = (t + 1) * num_iterations / num_threads;
+      for (int i = begin; i < end; ++i) {
+        CounterRng episode_rng(episode_seed, /*stream=*/i);
+        for (auto p = Player{0}; p < game_->NumPlayers(); ++p) {
+          std::unique_ptr<State> state = game_->NewInitialState();
+          SampleEpisode(state.get(), p, &episode_rng, /*my_reach=*/1.0,
+                        /*opp_reach=*/1.0, /*sample_reach=*/1.0);
+        }
+      }
+    });
+  }
+  for (Thread& thread : threads) thread.join();
+  parallel_context_.reset();
 }
 
 std::unique_ptr<OutcomeSamplingMCCFRSolver>
@@ -15,14 +15,19 @@
 #ifndef OPEN_SPIEL_ALGORITHMS_OUTCOME_SAMPLING_MCCFR_H_
 #define OPEN_SPIEL_ALGORITHMS_OUTCOME_SAMPLING_MCCFR_H_
 
+#include <array>
 #include <memory>
+#include <mutex>
 #include <random>
+#include <shared_mutex>
+#include <string>
 #include <vector>
 
-#include "open_spiel/abseil-cpp/absl/random/uniform_real_distribution.h"
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/algorithms/cfr.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/random.h"
 
 // An implementation of outcome sampling Monte Carlo Counterfactual Regret
 // Minimization (CFR). This version is implemented in a way that is closer to
@@ -37,6 +42,8 @@
 namespace open_spiel {
 namespace algorithms {
 
+class MmapInfoStateStore;
+
 class OutcomeSamplingMCCFRSolver {
  public:
   static inline constexpr double kInitialTableValues = 0.000001;
@@ -65,6 +72,41 @@ class OutcomeSamplingMCCFRSolver {
   // Same as above, but uses the specified random number generator instead.
   void RunIteration(std::mt19937* rng);
 
+  // Runs `num_iterations` iterations split across `num_threads` sampler
+  // threads sharing the table. Table contention is kept off the fast path by
+  // two levels of locking: entry lookups take the map lock shared (exclusive
+  // only for the rare insert of a new infostate), and read-modify-write of an
+  // entry's values takes one of kNumValueMutexStripes mutexes selected by the
+  // infostate hash, so two threads only wait on each other when they touch
+  // infostates in the same stripe at the same moment. Updates from different
+  // threads interleave at infostate granularity; as with any asynchronous
+  // MCCFR, each remains an unbiased sampled update.
+  //
+  // Each iteration samples its episodes from a counter-based stream keyed by
+  // the iteration index (see CounterRng), so the set of sampled episodes is
+  // identical for any num_threads and any thread schedule; only the order in
+  // which their table updates land can differ.
+  void RunIterationsParallel(int num_iterations, int num_threads);
+
+  // Routes all infostate reads and updates through `store` (see
+  // mmap_infostate_store.h) instead of the in-memory table, for runs whose
+  // tables exceed RAM. Pass nullptr to go back to the in-memory table; the
+  // store is borrowed, not owned, and must outlive its use here. The store
+  // is not thread-safe, so it cannot be combined with
+  // RunIterationsParallel; AveragePolicy() still reads the in-memory table,
+  // so out-of-core runs should read results from the store.
+  void SetBackingStore(MmapInfoStateStore* store) { backing_store_ = store; }
+
+  // Enables VR-MCCFR learned baselines (Schmid et al. '19): each infostate
+  // action keeps an exponentially decayed average of the sampled value
+  // estimates of its subtree, subtracted control-variate style in the child
+  // value corrections. This leaves the updates unbiased but cuts their
+  // variance, which matters most in games with long trajectories. Baselines
+  // live alongside the info state values in a table of their own; they only
+  // affect the sampling noise, not the fixed point, so they are not
+  // serialized and restart from zero on deserialization.
+  void SetUseBaselines(bool use_baselines) { use_baselines_ = use_baselines; }
+
   CFRInfoStateValuesTable& InfoStateValuesTable() { return info_states_; }
 
   // Computes the average policy, containing the policy for all players.
@@ -85,26 +127,74 @@ class OutcomeSamplingMCCFRSolver {
                         std::string delimiter = "<~>") const;
 
  private:
-  double SampleEpisode(State* state, Player update_player, std::mt19937* rng,
+  static constexpr int kNumValueMutexStripes = 256;
+
+  // Striped locking state, allocated only while RunIterationsParallel runs;
+  // null means single-threaded operation and lock-free table access.
+  struct ParallelContext {
+    // Guards the map structure: shared for lookups, exclusive for inserts
+    // (which may rehash and move entries).
+    std::shared_mutex map_mutex;
+    // Same, for the baselines_ map.
+    std::shared_mutex baseline_map_mutex;
+    // Guards entry values (info state and baseline alike, selected by
+    // infostate hash; both tables share the stripes).
+    std::array<std::mutex, kNumValueMutexStripes> value_mutexes;
+  };
+
+  double SampleEpisode(State* state, Player update_player, CounterRng* rng,
                        double my_reach, double opp_reach, double sample_reach);
-  std::vector<double> SamplePolicy(const CFRInfoStateValues& info_state) const;
 
-  // The b_i function from  Schmid et al. '19.
-  double Baseline(const State& state, const CFRInfoStateValues& info_state,
-                  int aidx) const;
+  // Returns a copy of the entry for is_key, inserting a default-initialized
+  // entry if absent. All SampleEpisode reads go through the copy, so no
+  // reference into the table outlives the locks that protect it.
+  CFRInfoStateValues LookupInfoState(const std::string& is_key,
+                                     const std::vector<Action>& legal_actions);
+
+  // Applies `update` to the entry for is_key under the appropriate locks (or
+  // directly when single-threaded). The entry must already exist.
+  template <typename UpdateFn>
+  void UpdateInfoState(const std::string& is_key, UpdateFn update);
+
+  // The b_i function from Schmid et al. '19: the learned per-action baseline
+  // when enabled (`baselines` fetched by LookupBaselines), zero otherwise.
+  double Baseline(const std::vector<double>& baselines, int aidx) const {
+    return baselines.empty() ? 0.0 : baselines[aidx];
+  }
 
   // Applies Eq. 9 of Schmid et al. '19
-  double BaselineCorrectedChildValue(const State& state,
-                                     const CFRInfoStateValues& info_state,
+  double BaselineCorrectedChildValue(const std::vector<double>& baselines,
                                      int sampled_aidx, int aidx,
                                      double child_value,
                                      double sample_prob) const;
 
+  // Returns a copy of the baseline values for is_key, inserting a zero entry
+  // if absent; returns an empty vector when baselines are disabled. Same
+  // locking discipline as LookupInfoState.
+  std::vector<double> LookupBaselines(const std::string& is_key,
+                                      int num_actions);
+
+  // Decays the sampled action's baseline toward `value`, the episode's value
+  // estimate of that action's subtree. The entry must already exist.
+  void UpdateBaseline(const std::string& is_key, int aidx, double value);
+
+  // Decay rate of the learned baselines: b <- (1 - rate) * b + rate * sample.
+  static constexpr double kBaselineDecay = 0.5;
+
   std::shared_ptr<const Game> game_;
   double epsilon_;
   CFRInfoStateValuesTable info_states_;
+  // Learned per-infostate, per-action baselines (see SetUseBaselines). Kept
+  // beside info_states_ rather than inside CFRInfoStateValues so the entry
+  // format and its serialization stay unchanged.
+  bool use_baselines_ = false;
+  absl::flat_hash_map<std::string, std::vector<double>> baselines_;
+  std::unique_ptr<ParallelContext> parallel_context_;
+  MmapInfoStateStore* backing_store_ = nullptr;
+  // The solver's seed/serialization generator; episodes are sampled with
+  // counter-based streams keyed from it (see RunIteration and
+  // RunIterationsParallel).
   std::mt19937 rng_;
-  absl::uniform_real_distribution<double> dist_;
   std::shared_ptr<Policy> default_policy_;
 };
 
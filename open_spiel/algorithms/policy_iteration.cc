@@ -15,6 +15,12 @@
 #include "open_spiel/algorithms/policy_iteration.h"
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
+#include <string>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/spiel_globals.h"
@@ -24,111 +30,187 @@ namespace open_spiel {
 namespace algorithms {
 namespace {
 
-using std::vector;
+// Number of states per block. Blocks are the unit of parallel work and of
+// residual tracking during policy evaluation.
+constexpr int kBlockSize = 1024;
 
-struct MDPState {
-  std::unique_ptr<State> state;  // The state of the MDP
-  double value;                  // The value of this state
-  absl::flat_hash_map<Action, std::vector<std::pair<std::string, double>>>
-      transitions;  // The transitions from this state, for each action, with
-                    // the correponding probability
-  Action optimal_action;  // The optimal action from this state
+// Maximum evaluation sweeps per phase before handing control back to policy
+// improvement (modified policy iteration). Improvement with partially
+// evaluated values is sound because the outer loop does not terminate until
+// both the policy is stable and the evaluation residual is below threshold.
+constexpr int kMaxEvaluationSweeps = 32;
+
+// The whole MDP with dense integer state ids, built once up front so the
+// evaluation and improvement sweeps never touch a string key again. Ids are
+// assigned in the (sorted) iteration order of the GetAllStates map.
+struct IndexedMdp {
+  std::vector<std::string> keys;  // id -> state key.
+  std::vector<bool> terminal;     // id -> is the state terminal?
+  std::vector<Player> player;     // id -> player to act (terminals unused).
+  // id -> the state's legal actions, parallel to transitions.
+  std::vector<std::vector<Action>> legal_actions;
+  // id -> per legal action, the outcomes as (next state id, probability).
+  // A next id of -1 denotes a state outside the depth limit; its value is
+  // treated as 0, matching the behavior of the previous string-keyed
+  // implementation.
+  std::vector<std::vector<std::vector<std::pair<int, double>>>> transitions;
+  // id -> index into legal_actions of the current greedy action.
+  std::vector<int> policy;
+  // id -> initial value (the terminal return for terminals, otherwise 0).
+  std::vector<double> initial_value;
+
+  int NumStates() const { return keys.size(); }
+  int NumBlocks() const { return (NumStates() + kBlockSize - 1) / kBlockSize; }
 };
 
-// Adds transitions and transition probability from a given state
-void AddTransition(
-    absl::flat_hash_map<Action, vector<std::pair<std::string, double>>>*
-        transitions,
-    const std::string& key, const std::unique_ptr<State>& state) {
-  for (Action action : state->LegalActions()) {
-    std::unique_ptr<State> next_state = state->Child(action);
-    vector<std::pair<std::string, double>> possibilities;
-    if (next_state->IsChanceNode()) {
-      // For a chance node, record the transition probabilities
-      for (const auto& actionprob : next_state->ChanceOutcomes()) {
-        std::unique_ptr<State> realized_next_state = next_state->Child(action);
-        possibilities.emplace_back(realized_next_state->ToString(),
-                                   actionprob.second);
-      }
-    } else {
-      // A non-chance node is equivalent to transition with probability 1
-      possibilities.emplace_back(next_state->ToString(), 1.0);
-    }
-    (*transitions)[action] = possibilities;
+IndexedMdp BuildIndexedMdp(
+    const std::map<std::string, std::unique_ptr<State>>& states) {
+  IndexedMdp mdp;
+  const int num_states = states.size();
+  mdp.keys.reserve(num_states);
+  absl::flat_hash_map<std::string, int> key_to_id;
+  key_to_id.reserve(num_states);
+  for (const auto& kv : states) {
+    key_to_id[kv.first] = mdp.keys.size();
+    mdp.keys.push_back(kv.first);
   }
-}
+  auto lookup_id = [&key_to_id](const std::string& key) {
+    auto it = key_to_id.find(key);
+    return it == key_to_id.end() ? -1 : it->second;
+  };
 
-// Initialize transition map and value map
-void InitializeMaps(
-    const std::map<std::string, std::unique_ptr<State>>& states,
-    absl::flat_hash_map<std::string, MDPState>* mdp_state_nodes) {
+  mdp.terminal.resize(num_states, false);
+  mdp.player.resize(num_states, kInvalidPlayer);
+  mdp.legal_actions.resize(num_states);
+  mdp.transitions.resize(num_states);
+  mdp.policy.resize(num_states, 0);
+  mdp.initial_value.resize(num_states, 0.0);
   for (const auto& kv : states) {
-    const std::string& key = kv.first;
+    const int id = key_to_id.at(kv.first);
     if (kv.second->IsTerminal()) {
+      mdp.terminal[id] = true;
       // For both 1-player and 2-player zero sum games, suffices to look at
-      // player 0's utility
-      (*mdp_state_nodes)[key].value = kv.second->PlayerReturn(Player{0});
-      // No action possible from a terminal state.
-      (*mdp_state_nodes)[key].optimal_action = kInvalidAction;
-    } else {
-      absl::flat_hash_map<Action, std::vector<std::pair<std::string, double>>>&
-          transitions = (*mdp_state_nodes)[key].transitions;
-      AddTransition(&transitions, key, kv.second);
-      (*mdp_state_nodes)[key].value = 0;
-      // Assign any random action as the optimal action, initially.
-      (*mdp_state_nodes)[key].optimal_action = kv.second->LegalActions()[0];
+      // player 0's utility.
+      mdp.initial_value[id] = kv.second->PlayerReturn(Player{0});
+      continue;
+    }
+    mdp.player[id] = kv.second->CurrentPlayer();
+    mdp.legal_actions[id] = kv.second->LegalActions();
+    mdp.transitions[id].reserve(mdp.legal_actions[id].size());
+    for (Action action : mdp.legal_actions[id]) {
+      std::unique_ptr<State> next_state = kv.second->Child(action);
+      std::vector<std::pair<int, double>> possibilities;
+      if (next_state->IsChanceNode()) {
+        // For a chance node, record the transition probabilities.
+        for (const auto& actionprob : next_state->ChanceOutcomes()) {
+          std::unique_ptr<State> realized_next_state =
+              next_state->Child(actionprob.first);
+          possibilities.emplace_back(lookup_id(realized_next_state->ToString()),
+                                     actionprob.second);
+        }
+      } else {
+        // A non-chance node is equivalent to transition with probability 1.
+        possibilities.emplace_back(lookup_id(next_state->ToString()), 1.0);
+      }
+      mdp.transitions[id].push_back(std::move(possibilities));
     }
   }
+  return mdp;
 }
 
-double QValue(const absl::flat_hash_map<std::string, MDPState>& mdp_state_nodes,
-              const std::unique_ptr<State>& state, const Action& action) {
-  if (!mdp_state_nodes.contains(state->ToString()) ||
-      !mdp_state_nodes.at(state->ToString()).transitions.contains(action)) {
-    // This action is not possible from this state.
-    return 0;
+double QValue(const IndexedMdp& mdp,
+              const std::vector<std::atomic<double>>& values, int id,
+              int action_index) {
+  double value = 0;
+  for (const auto& [next_id, prob] : mdp.transitions[id][action_index]) {
+    if (next_id < 0) continue;  // Beyond the depth limit; value 0.
+    value += prob * values[next_id].load(std::memory_order_relaxed);
   }
+  return value;
+}
 
-  double value = 0;
-  const vector<std::pair<std::string, double>>& possibilities =
-      mdp_state_nodes.at(state->ToString()).transitions.at(action);
-  for (const auto& outcome : possibilities) {
-    if (mdp_state_nodes.contains(outcome.first)) {
-      value += outcome.second * mdp_state_nodes.at(outcome.first).value;
+// Runs the given per-block function over all blocks, spread over num_threads
+// worker threads pulling blocks off a shared atomic counter.
+template <class BlockFn>
+void ForAllBlocks(const IndexedMdp& mdp, int num_threads, BlockFn block_fn) {
+  const int num_blocks = mdp.NumBlocks();
+  if (num_threads == 1) {
+    for (int block = 0; block < num_blocks; ++block) block_fn(block);
+    return;
+  }
+  std::atomic<int> next_block(0);
+  auto worker = [&]() {
+    for (int block = next_block++; block < num_blocks; block = next_block++) {
+      block_fn(block);
     }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) threads.emplace_back(worker);
+  for (std::thread& thread : threads) thread.join();
+}
+
+// One in-place evaluation sweep of a block under the current greedy policy.
+// Returns the block's residual.
+double EvaluateBlock(const IndexedMdp& mdp, int block,
+                     std::vector<std::atomic<double>>* values) {
+  const int begin = block * kBlockSize;
+  const int end = std::min<int>(begin + kBlockSize, mdp.NumStates());
+  double residual = 0;
+  for (int id = begin; id < end; ++id) {
+    if (mdp.terminal[id]) continue;
+    const double value = QValue(mdp, *values, id, mdp.policy[id]);
+    const double stored = (*values)[id].load(std::memory_order_relaxed);
+    residual = std::max(std::abs(stored - value), residual);
+    (*values)[id].store(value, std::memory_order_relaxed);
   }
-  return value;
+  return residual;
 }
 
-// Given a player and a state, gets the best possible action from this state
-Action GetBestAction(
-    const absl::flat_hash_map<std::string, MDPState>& mdp_state_nodes,
-    const std::unique_ptr<State>& state, const Player& player,
-    const double& min_utility, const double& max_utility) {
-  vector<Action> legal_actions = state->LegalActions();
-  Action optimal_action = kInvalidAction;
-
-  // Initialize value to be the minimum utility if current player
-  // is the maximizing player (i.e. player 0), and to maximum utility
-  // if current player is the minimizing player (i.e. player 1).
-  double value = (player == Player{0}) ? min_utility : max_utility;
-  for (Action action : legal_actions) {
-    double q_val = QValue(mdp_state_nodes, state, action);
-    bool is_best_so_far = (player == Player{0} && q_val >= value) ||
-                          (player == Player{1} && q_val <= value);
-    if (is_best_so_far) {
-      value = q_val;
-      optimal_action = action;
+// Greedy policy improvement over a block. Returns whether the policy changed
+// (by more than threshold in value) anywhere in the block.
+bool ImproveBlock(const IndexedMdp& mdp, int block,
+                  const std::vector<std::atomic<double>>& values,
+                  double threshold, double min_utility, double max_utility,
+                  std::vector<int>* policy) {
+  const int begin = block * kBlockSize;
+  const int end = std::min<int>(begin + kBlockSize, mdp.NumStates());
+  bool changed = false;
+  for (int id = begin; id < end; ++id) {
+    if (mdp.terminal[id]) continue;
+
+    // Initialize value to be the minimum utility if current player
+    // is the maximizing player (i.e. player 0), and to maximum utility
+    // if current player is the minimizing player (i.e. player 1).
+    const Player player = mdp.player[id];
+    double value = (player == Player{0}) ? min_utility : max_utility;
+    int best_action_index = (*policy)[id];
+    for (int i = 0; i < mdp.transitions[id].size(); ++i) {
+      const double q_val = QValue(mdp, values, id, i);
+      const bool is_best_so_far = (player == Player{0} && q_val >= value) ||
+                                  (player == Player{1} && q_val <= value);
+      if (is_best_so_far) {
+        value = q_val;
+        best_action_index = i;
+      }
+    }
+
+    const double stored = values[id].load(std::memory_order_relaxed);
+    if (std::abs(stored - value) > threshold) {
+      changed = true;
+      (*policy)[id] = best_action_index;
     }
   }
-  return optimal_action;
+  return changed;
 }
 
 }  // namespace
 
 absl::flat_hash_map<std::string, double> PolicyIteration(const Game& game,
                                                          int depth_limit,
-                                                         double threshold) {
+                                                         double threshold,
+                                                         int num_threads) {
+  SPIEL_CHECK_GE(num_threads, 1);
   // Currently only supports 1-player or 2-player zero sum games
   SPIEL_CHECK_TRUE(game.NumPlayers() == 1 || game.NumPlayers() == 2);
   if (game.NumPlayers() == 2) {
@@ -144,62 +226,74 @@ absl::flat_hash_map<std::string, double> PolicyIteration(const Game& game,
   std::map<std::string, std::unique_ptr<State>> states =
       GetAllStates(game, depth_limit, /*include_terminals=*/true,
                    /*include_chance_states=*/false);
-  absl::flat_hash_map<std::string, MDPState> mdp_state_nodes;
+  IndexedMdp mdp = BuildIndexedMdp(states);
+  const int num_states = mdp.NumStates();
+  const int num_blocks = mdp.NumBlocks();
 
-  InitializeMaps(states, &mdp_state_nodes);
+  std::vector<std::atomic<double>> values(num_states);
+  for (int id = 0; id < num_states; ++id) {
+    values[id].store(mdp.initial_value[id], std::memory_order_relaxed);
+  }
+
+  const double min_utility = game.MinUtility();
+  const double max_utility = game.MaxUtility();
 
   bool policy_stable;
+  double eval_residual;
   do {
-    // Policy evaluation done in place
-    double error;
-    do {
-      error = 0;
-      for (const auto& kv : states) {
-        const std::string& key = kv.first;
-        if (kv.second->IsTerminal()) continue;
-
-        // Evaluate the state value function
-        Action curr_optimal_action = mdp_state_nodes.at(key).optimal_action;
-        double value = QValue(mdp_state_nodes, kv.second, curr_optimal_action);
-
-        double* stored_value = &mdp_state_nodes.at(key).value;
-        error = std::max(std::abs(*stored_value - value), error);
-        *stored_value = value;
-      }
-    } while (error > threshold);
-
-    // Policy improvement
-    double min_utility = game.MinUtility();
-    double max_utility = game.MaxUtility();
-    policy_stable = true;
-    for (const auto& kv : states) {
-      const std::string& key = kv.first;
-      if (kv.second->IsTerminal()) continue;
-
-      Player player = kv.second->CurrentPlayer();
-
-      // Choose the action with the highest possible action value function
-      Action curr_optimal_action = GetBestAction(
-          mdp_state_nodes, kv.second, player, min_utility, max_utility);
-
-      double curr_value =
-          QValue(mdp_state_nodes, kv.second, curr_optimal_action);
-
-      double* stored_value = &mdp_state_nodes.at(key).value;
-      Action* stored_optimal_action = &mdp_state_nodes.at(key).optimal_action;
-      if (std::abs(*stored_value - curr_value) > threshold) {
-        policy_stable = false;
-        *stored_optimal_action = curr_optimal_action;
+    // Policy evaluation, done in place: blocked sweeps under the current
+    // greedy policy, skipping blocks whose residual has already settled, for
+    // at most kMaxEvaluationSweeps sweeps (modified policy iteration).
+    std::vector<double> block_residual(
+        num_blocks, std::numeric_limits<double>::infinity());
+    for (int sweep = 0; sweep < kMaxEvaluationSweeps; ++sweep) {
+      ForAllBlocks(mdp, num_threads, [&](int block) {
+        if (block_residual[block] > threshold) {
+          block_residual[block] = EvaluateBlock(mdp, block, &values);
+        }
+      });
+      eval_residual = *std::max_element(block_residual.begin(),
+                                        block_residual.end());
+      if (eval_residual <= threshold) {
+        // Settled blocks are skipped above, so re-sweep everything once to
+        // verify before trusting the residual.
+        std::fill(block_residual.begin(), block_residual.end(),
+                  std::numeric_limits<double>::infinity());
+        ForAllBlocks(mdp, num_threads, [&](int block) {
+          block_residual[block] = EvaluateBlock(mdp, block, &values);
+        });
+        eval_residual = *std::max_element(block_residual.begin(),
+                                          block_residual.end());
+        if (eval_residual <= threshold) break;
       }
     }
-  } while (!policy_stable);
 
-  absl::flat_hash_map<std::string, double> values;
-  for (const auto& kv : states) {
-    std::string state_string = kv.first;
-    values[state_string] = mdp_state_nodes[state_string].value;
+    // Policy improvement, greedy per block against the current values.
+    std::atomic<bool> changed(false);
+    ForAllBlocks(mdp, num_threads, [&](int block) {
+      if (ImproveBlock(mdp, block, values, threshold, min_utility, max_utility,
+                       &mdp.policy)) {
+        changed.store(true, std::memory_order_relaxed);
+      }
+    });
+    policy_stable = !changed.load(std::memory_order_relaxed);
+    // Truncated evaluation can leave the values unconverged even when the
+    // policy no longer changes; keep iterating until both have settled.
+  } while (!policy_stable || eval_residual > threshold);
+
+  absl::flat_hash_map<std::string, double> result;
+  result.reserve(num_states);
+  for (int id = 0; id < num_states; ++id) {
+    result[mdp.keys[id]] = values[id].load(std::memory_order_relaxed);
   }
-  return values;
+  return result;
+}
+
+absl::flat_hash_map<std::string, double> PolicyIteration(const Game& game,
+                                                         int depth_limit,
+                                                         double threshold) {
+  return PolicyIteration(game, depth_limit, threshold, /*num_threads=*/1);
 }
+
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -31,12 +31,26 @@ namespace algorithms {
 // Currently works for sequential 1-player or 2-player zero-sum games,
 // with or without chance nodes.
 //
-// Based on the implementation in Sutton & Barto '18.
+// Based on the implementation in Sutton & Barto '18, run as modified policy
+// iteration: evaluation phases are bounded in sweep count, and improvement
+// then proceeds against the partially evaluated values. The outer loop only
+// terminates once the policy is stable and the evaluation residual is below
+// threshold.
+//
+// Internally the states are indexed with dense integer ids (built once, up
+// front) and processed in blocks with per-block residual tracking, so settled
+// blocks are skipped during evaluation. With num_threads > 1 the blocks of
+// each evaluation and improvement sweep are processed concurrently.
 
 absl::flat_hash_map<std::string, double> PolicyIteration(const Game& game,
                                                          int depth_limit,
                                                          double threshold);
 
+absl::flat_hash_map<std::string, double> PolicyIteration(const Game& game,
+                                                         int depth_limit,
+                                                         double threshold,
+                                                         int num_threads);
+
 }  // namespace algorithms
 }  // namespace open_spiel
 
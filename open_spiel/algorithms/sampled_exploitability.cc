@@ -0,0 +1,248 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/sampled_exploitability.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
+#include "open_spiel/algorithms/best_response.h"
+#include "open_spiel/game_transforms/game_wrapper.h"
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// The sampled deals as a trie over the game's opening run of chance nodes
+// (a "deal" is the chance-action sequence from the root to the first
+// decision node; in card games, the whole deal, whether it is one chance
+// node or a dozen). Keys are chance-action prefixes; values are the allowed
+// next chance actions with their original probabilities renormalized over
+// the allowed subset at that node.
+using DealTrie = absl::flat_hash_map<std::vector<Action>, ActionsAndProbs>;
+
+// The underlying game with its opening chance nodes restricted to the
+// sampled deal trie. Everything at and below the first decision node
+// forwards to the wrapped state, so infostate strings (and hence the
+// policy's keying) are unchanged; the responder's infosets simply span
+// fewer deals.
+class DealSubsetState : public WrappedState {
+ public:
+  DealSubsetState(std::shared_ptr<const Game> game,
+                  std::unique_ptr<State> state,
+                  std::shared_ptr<const DealTrie> deals)
+      : WrappedState(game, std::move(state)), deals_(std::move(deals)) {}
+  DealSubsetState(const DealSubsetState& other) = default;
+
+  std::vector<Action> LegalActions() const override {
+    const ActionsAndProbs* restricted = RestrictedOutcomes();
+    if (restricted == nullptr) return state_->LegalActions();
+    std::vector<Action> actions;
+    actions.reserve(restricted->size());
+    for (const auto& [action, prob] : *restricted) actions.push_back(action);
+    return actions;
+  }
+
+  ActionsAndProbs ChanceOutcomes() const override {
+    const ActionsAndProbs* restricted = RestrictedOutcomes();
+    if (restricted == nullptr) return state_->ChanceOutcomes();
+    return *restricted;
+  }
+
+  std::vector<Action> LegalChanceOutcomes() const override {
+    if (RestrictedOutcomes() != nullptr) return LegalActions();
+    return state_->LegalChanceOutcomes();
+  }
+
+  std::unique_ptr<State> Clone() const override {
+    return std::make_unique<DealSubsetState>(*this);
+  }
+
+ private:
+  // Non-null while this state is inside the sampled deal trie (the opening
+  // chance phase); every action taken so far is then a chance action, so
+  // history_ is exactly a trie key.
+  const ActionsAndProbs* RestrictedOutcomes() const {
+    if (!state_->IsChanceNode()) return nullptr;
+    auto node = deals_->find(History());
+    return node == deals_->end() ? nullptr : &node->second;
+  }
+
+  std::shared_ptr<const DealTrie> deals_;
+};
+
+class DealSubsetGame : public WrappedGame {
+ public:
+  DealSubsetGame(std::shared_ptr<const Game> game, DealTrie deals)
+      : WrappedGame(game, game->GetType(), game->GetParameters()),
+        deals_(std::make_shared<const DealTrie>(std::move(deals))) {}
+
+  std::unique_ptr<State> NewInitialState() const override {
+    return std::make_unique<DealSubsetState>(
+        shared_from_this(), game_->NewInitialState(), deals_);
+  }
+
+ private:
+  std::shared_ptr<const DealTrie> deals_;
+};
+
+// Samples complete deals (chance playouts from the root to the first
+// decision node) until `num_deals` distinct ones are collected, and builds
+// the restriction trie over them. Probabilities at each trie node are the
+// original chance probabilities renormalized over the allowed actions.
+// Returns the number of distinct deals collected, which can fall short of
+// num_deals when the game has fewer (or when rare deals elude the draw
+// budget).
+int SampleDealTrie(const State& root, int num_deals, std::mt19937* rng,
+                   DealTrie* trie) {
+  // Ordered so the per-node probabilities are reproducible, and keyed by
+  // action so repeated traversals of shared prefixes are idempotent.
+  absl::flat_hash_map<std::vector<Action>, std::map<Action, double>> allowed;
+  absl::flat_hash_set<std::string> seen_deals;
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  int distinct = 0;
+  const int max_draws = 100 * num_deals;
+  for (int draw = 0; draw < max_draws && distinct < num_deals; ++draw) {
+    std::unique_ptr<State> state = root.Clone();
+    std::vector<Action> prefix;
+    std::vector<ActionsAndProbs> outcomes_along;
+    while (state->IsChanceNode()) {
+      ActionsAndProbs outcomes = state->ChanceOutcomes();
+      const Action action = SampleAction(outcomes, uniform(*rng)).first;
+      outcomes_along.push_back(std::move(outcomes));
+      prefix.push_back(action);
+      state->ApplyAction(action);
+    }
+    if (!seen_deals.insert(state->HistoryString()).second) continue;
+    ++distinct;
+    std::vector<Action> key;
+    for (int depth = 0; depth < prefix.size(); ++depth) {
+      std::map<Action, double>& node = allowed[key];
+      for (const auto& [action, prob] : outcomes_along[depth]) {
+        if (action == prefix[depth]) node[action] = prob;
+      }
+      key.push_back(prefix[depth]);
+    }
+  }
+
+  for (auto& [key, node] : allowed) {
+    double total_prob = 0.0;
+    for (const auto& [action, prob] : node) total_prob += prob;
+    ActionsAndProbs outcomes;
+    outcomes.reserve(node.size());
+    for (const auto& [action, prob] : node) {
+      outcomes.push_back({action, prob / total_prob});
+    }
+    (*trie)[key] = std::move(outcomes);
+  }
+  return distinct;
+}
+
+}  // namespace
+
+SampledExploitabilityResult SampledExploitability(const Game& game,
+                                                  const Policy& policy,
+                                                  int deals_per_batch,
+                                                  int num_batches, int seed,
+                                                  int num_threads) {
+  GameType game_type = game.GetType();
+  if (game_type.dynamics != GameType::Dynamics::kSequential) {
+    SpielFatalError("The game must be turn-based.");
+  }
+  if (game_type.utility != GameType::Utility::kZeroSum &&
+      game_type.utility != GameType::Utility::kConstantSum) {
+    SpielFatalError("The game must have zero- or constant-sum utility.");
+  }
+  SPIEL_CHECK_GT(deals_per_batch, 0);
+  SPIEL_CHECK_GT(num_batches, 0);
+
+  std::unique_ptr<State> root = game.NewInitialState();
+  if (!root->IsChanceNode()) {
+    SpielFatalError(
+        "SampledExploitability requires a game starting with a chance node "
+        "(the deal).");
+  }
+  const int num_players = game.NumPlayers();
+  const double utility_sum = *game.UtilitySum();
+
+  // Sampling is sequential so results are reproducible regardless of
+  // num_threads; the expensive best responses below are not.
+  std::mt19937 rng(seed);
+  std::vector<std::shared_ptr<const Game>> batch_games;
+  batch_games.reserve(num_batches);
+  int num_deals = 0;
+  for (int b = 0; b < num_batches; ++b) {
+    DealTrie trie;
+    num_deals += SampleDealTrie(*root, deals_per_batch, &rng, &trie);
+    batch_games.push_back(std::make_shared<DealSubsetGame>(
+        game.shared_from_this(), std::move(trie)));
+  }
+
+  // One task per (batch, player) best response, strided over the workers.
+  const int num_tasks = num_batches * num_players;
+  std::vector<double> values(num_tasks, 0.0);
+  const int num_workers = std::max(1, std::min(num_threads, num_tasks));
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    workers.emplace_back([&batch_games, &policy, &values, w, num_workers,
+                          num_tasks, num_players]() {
+      for (int task = w; task < num_tasks; task += num_workers) {
+        const Game& batch_game = *batch_games[task / num_players];
+        const Player p = task % num_players;
+        TabularBestResponse best_response(batch_game, p, &policy);
+        values[task] = best_response.Value(*batch_game.NewInitialState());
+      }
+    });
+  }
+  for (Thread& worker : workers) worker.join();
+
+  std::vector<double> batch_estimates(num_batches, 0.0);
+  for (int b = 0; b < num_batches; ++b) {
+    double nash_conv = 0.0;
+    for (Player p = 0; p < num_players; ++p) {
+      nash_conv += values[b * num_players + p];
+    }
+    batch_estimates[b] = (nash_conv - utility_sum) / num_players;
+  }
+
+  double mean = 0.0;
+  for (double estimate : batch_estimates) mean += estimate;
+  mean /= num_batches;
+  double variance = 0.0;
+  for (double estimate : batch_estimates) {
+    variance += (estimate - mean) * (estimate - mean);
+  }
+  double std_error =
+      num_batches > 1
+          ? std::sqrt(variance / (num_batches - 1) / num_batches)
+          : 0.0;
+  return SampledExploitabilityResult{mean, std_error, num_deals};
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
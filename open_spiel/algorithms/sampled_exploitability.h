@@ -0,0 +1,66 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_SAMPLED_EXPLOITABILITY_H_
+#define OPEN_SPIEL_ALGORITHMS_SAMPLED_EXPLOITABILITY_H_
+
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// A sampled-deal exploitability estimate; see SampledExploitability below.
+struct SampledExploitabilityResult {
+  // Mean of the per-batch exploitability estimates.
+  double exploitability;
+  // Standard error of the mean across batches (0 with a single batch).
+  double std_error;
+  // Total number of distinct deals sampled across all batches.
+  int num_deals;
+};
+
+// Estimates Exploitability() for games whose full best-response computation
+// is intractable but whose hardness lives in the opening chance nodes (the
+// deal — the chance-action sequence from the root to the first decision
+// node, whether that is one chance node or a dozen). Each of `num_batches`
+// independent batches samples `deals_per_batch` distinct deals from the
+// chance distribution, restricts the game's opening chance nodes to those
+// deals (with probabilities renormalized at each node), and computes the
+// exact TabularBestResponse exploitability of the restricted game. The
+// reported estimate is the mean of the batch values and the standard error
+// is their spread, so doubling num_batches tightens the confidence interval
+// by sqrt(2) at proportional cost.
+//
+// The per-batch value is exact for the restricted game but biased for the
+// full game in either direction: the responder's infosets span only the
+// sampled deals, so it can exploit knowing the deal is in the sample, while
+// the policy is only probed on a fraction of its infosets. The bias vanishes
+// as deals_per_batch approaches the full deal count; in practice the
+// estimate tracks the convergence of a solver run long before the exact
+// number is computable.
+//
+// Batches and per-player best responses are distributed over `num_threads`
+// threads. The game must be sequential, zero- or constant-sum, and start
+// with a chance node.
+SampledExploitabilityResult SampledExploitability(const Game& game,
+                                                  const Policy& policy,
+                                                  int deals_per_batch,
+                                                  int num_batches, int seed,
+                                                  int num_threads = 1);
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_SAMPLED_EXPLOITABILITY_H_
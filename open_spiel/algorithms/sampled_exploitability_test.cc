@@ -0,0 +1,80 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/sampled_exploitability.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include "open_spiel/algorithms/tabular_exploitability.h"
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// With every deal in a single batch, the restricted game is the full game
+// and the estimate must reproduce the exact exploitability.
+// `total_deals` is the game's number of complete deals (chance playouts to
+// the first decision node), e.g. 3 * 2 = 6 for Kuhn.
+void FullDealSubsetMatchesExact(const std::string& game_name,
+                                int total_deals) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  TabularPolicy policy = GetUniformPolicy(*game);
+  const double exact = Exploitability(*game, policy);
+  SampledExploitabilityResult result = SampledExploitability(
+      *game, policy, /*deals_per_batch=*/total_deals, /*num_batches=*/1,
+      /*seed=*/17);
+  SPIEL_CHECK_EQ(result.num_deals, total_deals);
+  SPIEL_CHECK_FLOAT_NEAR(result.exploitability, exact, 1e-10);
+  SPIEL_CHECK_EQ(result.std_error, 0.0);
+}
+
+// Sampled batches give a finite estimate with a finite spread, the same
+// value regardless of thread count, and stay within a loose window of the
+// exact exploitability on a small game.
+void SampledBatchesAreReasonable(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  TabularPolicy policy = GetUniformPolicy(*game);
+  const double exact = Exploitability(*game, policy);
+  SampledExploitabilityResult result = SampledExploitability(
+      *game, policy, /*deals_per_batch=*/3, /*num_batches=*/8, /*seed=*/23);
+  SampledExploitabilityResult parallel = SampledExploitability(
+      *game, policy, /*deals_per_batch=*/3, /*num_batches=*/8, /*seed=*/23,
+      /*num_threads=*/3);
+  SPIEL_CHECK_FLOAT_NEAR(result.exploitability, parallel.exploitability,
+                         1e-12);
+  SPIEL_CHECK_GE(result.std_error, 0.0);
+  SPIEL_CHECK_EQ(result.num_deals, 24);
+  // Generous window: the estimator is biased for small subsets but must
+  // stay in the neighborhood of the exact value.
+  SPIEL_CHECK_GT(result.exploitability, 0.0);
+  SPIEL_CHECK_LT(std::abs(result.exploitability - exact),
+                 exact + 10 * result.std_error + 0.5);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::FullDealSubsetMatchesExact("kuhn_poker",
+                                                     /*total_deals=*/6);
+  open_spiel::algorithms::FullDealSubsetMatchesExact("leduc_poker",
+                                                     /*total_deals=*/30);
+  open_spiel::algorithms::SampledBatchesAreReasonable("kuhn_poker");
+}
@@ -0,0 +1,381 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/subgame_resolving.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/algorithms/expected_returns.h"
+#include "open_spiel/algorithms/infostate_tree.h"
+#include "open_spiel/observer.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// The opponent's two choices at the top of the gadget.
+enum GadgetAction : Action { kFollowAction = 0, kTerminateAction = 1 };
+
+class ResolverGadgetGame;
+
+// A gadget history has three phases: the root chance pick of an underlying
+// history, the opponent's Follow/Terminate choice, and (after Follow) pure
+// delegation to a clone of the picked history.
+class ResolverGadgetState : public State {
+ public:
+  explicit ResolverGadgetState(std::shared_ptr<const Game> game);
+  ResolverGadgetState(const ResolverGadgetState& other);
+
+  Player CurrentPlayer() const override;
+  std::vector<Action> LegalActions() const override;
+  std::vector<std::pair<Action, double>> ChanceOutcomes() const override;
+  std::string ActionToString(Player player, Action action_id) const override;
+  std::string ToString() const override;
+  bool IsTerminal() const override;
+  std::vector<double> Returns() const override;
+  std::string InformationStateString(Player player) const override;
+  std::unique_ptr<State> Clone() const override;
+
+ protected:
+  void DoApplyAction(Action action_id) override;
+
+ private:
+  const ResolverGadgetGame& gadget() const;
+
+  int root_index_ = -1;
+  bool followed_ = false;
+  bool terminated_ = false;
+  // Clone of the picked root history; delegated to after Follow.
+  std::unique_ptr<State> state_;
+};
+
+class ResolverGadgetGame : public Game {
+ public:
+  ResolverGadgetGame(const SubgameSpec& spec, Player resolving_player,
+                     const std::vector<double>& opponent_values);
+
+  int NumDistinctActions() const override {
+    return std::max(base_game_->NumDistinctActions(), 2);
+  }
+  std::unique_ptr<State> NewInitialState() const override {
+    return std::make_unique<ResolverGadgetState>(shared_from_this());
+  }
+  int NumPlayers() const override { return 2; }
+  double MinUtility() const override {
+    return std::min(base_game_->MinUtility(), -max_abs_terminate_value_);
+  }
+  double MaxUtility() const override {
+    return std::max(base_game_->MaxUtility(), max_abs_terminate_value_);
+  }
+  int MaxGameLength() const override { return base_game_->MaxGameLength() + 1; }
+  int MaxChanceOutcomes() const override {
+    return std::max<int>(base_game_->MaxChanceOutcomes(), roots_.size());
+  }
+
+  int num_roots() const { return roots_.size(); }
+  const State& root(int index) const { return *roots_[index]; }
+  double chance_prob(int index) const { return chance_probs_[index]; }
+  double terminate_value(int index) const { return terminate_values_[index]; }
+  Player resolving_player() const { return resolving_player_; }
+  Player opponent() const { return 1 - resolving_player_; }
+
+ private:
+  static GameType MakeGadgetType(const GameType& base_type);
+
+  std::shared_ptr<const Game> base_game_;
+  std::vector<std::unique_ptr<State>> roots_;
+  std::vector<double> chance_probs_;
+  std::vector<double> terminate_values_;
+  double max_abs_terminate_value_ = 0;
+  Player resolving_player_;
+};
+
+GameType ResolverGadgetGame::MakeGadgetType(const GameType& base_type) {
+  GameType type = base_type;
+  type.short_name = absl::StrCat("resolver_gadget(", base_type.short_name, ")");
+  type.long_name = absl::StrCat("Re-solving gadget over ", base_type.long_name);
+  type.dynamics = GameType::Dynamics::kSequential;
+  type.chance_mode = GameType::ChanceMode::kExplicitStochastic;
+  type.information = GameType::Information::kImperfectInformation;
+  type.utility = GameType::Utility::kZeroSum;
+  type.max_num_players = 2;
+  type.min_num_players = 2;
+  type.provides_information_state_string = true;
+  type.provides_information_state_tensor = false;
+  type.provides_observation_string = false;
+  type.provides_observation_tensor = false;
+  type.parameter_specification = {};
+  return type;
+}
+
+ResolverGadgetGame::ResolverGadgetGame(
+    const SubgameSpec& spec, Player resolving_player,
+    const std::vector<double>& opponent_values)
+    : Game(MakeGadgetType(spec.states.front()->GetGame()->GetType()),
+           GameParameters()),
+      base_game_(spec.states.front()->GetGame()),
+      terminate_values_(opponent_values),
+      resolving_player_(resolving_player) {
+  SPIEL_CHECK_EQ(base_game_->NumPlayers(), 2);
+  SPIEL_CHECK_EQ(spec.states.size(), spec.reach_probs.size());
+  SPIEL_CHECK_EQ(spec.states.size(), opponent_values.size());
+  roots_.reserve(spec.states.size());
+  for (const std::unique_ptr<State>& state : spec.states) {
+    roots_.push_back(state->Clone());
+  }
+  const double total_reach =
+      std::accumulate(spec.reach_probs.begin(), spec.reach_probs.end(), 0.0);
+  SPIEL_CHECK_GT(total_reach, 0);
+  chance_probs_.reserve(spec.reach_probs.size());
+  for (double reach : spec.reach_probs) {
+    SPIEL_CHECK_GE(reach, 0);
+    chance_probs_.push_back(reach / total_reach);
+  }
+  for (double value : terminate_values_) {
+    max_abs_terminate_value_ =
+        std::max(max_abs_terminate_value_, std::abs(value));
+  }
+}
+
+ResolverGadgetState::ResolverGadgetState(std::shared_ptr<const Game> game)
+    : State(std::move(game)) {}
+
+ResolverGadgetState::ResolverGadgetState(const ResolverGadgetState& other)
+    : State(other),
+      root_index_(other.root_index_),
+      followed_(other.followed_),
+      terminated_(other.terminated_),
+      state_(other.state_ ? other.state_->Clone() : nullptr) {}
+
+const ResolverGadgetGame& ResolverGadgetState::gadget() const {
+  return down_cast<const ResolverGadgetGame&>(*game_);
+}
+
+Player ResolverGadgetState::CurrentPlayer() const {
+  if (root_index_ < 0) return kChancePlayerId;
+  if (terminated_) return kTerminalPlayerId;
+  if (!followed_) return gadget().opponent();
+  return state_->CurrentPlayer();
+}
+
+std::vector<Action> ResolverGadgetState::LegalActions() const {
+  if (root_index_ < 0) {
+    std::vector<Action> actions(gadget().num_roots());
+    std::iota(actions.begin(), actions.end(), 0);
+    return actions;
+  }
+  if (terminated_) return {};
+  if (!followed_) return {kFollowAction, kTerminateAction};
+  return state_->LegalActions();
+}
+
+std::vector<std::pair<Action, double>> ResolverGadgetState::ChanceOutcomes()
+    const {
+  if (root_index_ < 0) {
+    std::vector<std::pair<Action, double>> outcomes;
+    outcomes.reserve(gadget().num_roots());
+    for (int i = 0; i < gadget().num_roots(); ++i) {
+      outcomes.push_back({i, gadget().chance_prob(i)});
+    }
+    return outcomes;
+  }
+  return state_->ChanceOutcomes();
+}
+
+std::string ResolverGadgetState::ActionToString(Player player,
+                                                Action action_id) const {
+  if (root_index_ < 0) return absl::StrCat("Deal history ", action_id);
+  if (!followed_ && !terminated_) {
+    return action_id == kTerminateAction ? "Terminate" : "Follow";
+  }
+  return state_->ActionToString(player, action_id);
+}
+
+std::string ResolverGadgetState::ToString() const {
+  if (root_index_ < 0) return "(gadget root)";
+  return absl::StrCat(terminated_ ? "[terminated] "
+                      : followed_ ? "[followed] "
+                                  : "[follow?] ",
+                      state_->ToString());
+}
+
+bool ResolverGadgetState::IsTerminal() const {
+  return terminated_ || (followed_ && state_->IsTerminal());
+}
+
+std::vector<double> ResolverGadgetState::Returns() const {
+  std::vector<double> returns(2, 0.0);
+  if (terminated_) {
+    const double value = gadget().terminate_value(root_index_);
+    returns[gadget().opponent()] = value;
+    returns[gadget().resolving_player()] = -value;
+    return returns;
+  }
+  if (followed_ && state_->IsTerminal()) return state_->Returns();
+  return returns;
+}
+
+std::string ResolverGadgetState::InformationStateString(Player player) const {
+  SPIEL_CHECK_GE(player, 0);
+  SPIEL_CHECK_LT(player, 2);
+  if (root_index_ < 0) return "(gadget root)";
+  // The opponent's Follow/Terminate infostate is keyed by what they know at
+  // the subgame root; the suffix keeps it from colliding with the underlying
+  // infostate they act from right after Follow.
+  if (!followed_ && !terminated_ && player == gadget().opponent()) {
+    return absl::StrCat(state_->InformationStateString(player), " [follow?]");
+  }
+  return state_->InformationStateString(player);
+}
+
+std::unique_ptr<State> ResolverGadgetState::Clone() const {
+  return std::make_unique<ResolverGadgetState>(*this);
+}
+
+void ResolverGadgetState::DoApplyAction(Action action_id) {
+  if (root_index_ < 0) {
+    SPIEL_CHECK_LT(action_id, gadget().num_roots());
+    root_index_ = action_id;
+    state_ = gadget().root(root_index_).Clone();
+  } else if (!followed_ && !terminated_) {
+    if (action_id == kTerminateAction) {
+      terminated_ = true;
+    } else {
+      SPIEL_CHECK_EQ(action_id, kFollowAction);
+      followed_ = true;
+    }
+  } else {
+    state_->ApplyAction(action_id);
+  }
+}
+
+}  // namespace
+
+std::vector<double> OpponentBlueprintValues(const SubgameSpec& spec,
+                                            Player opponent,
+                                            const Policy& blueprint) {
+  std::vector<double> values;
+  values.reserve(spec.states.size());
+  for (const std::unique_ptr<State>& state : spec.states) {
+    values.push_back(
+        ExpectedReturns(*state, blueprint, /*depth_limit=*/-1)[opponent]);
+  }
+  return values;
+}
+
+std::shared_ptr<const Game> MakeResolverGadgetGame(
+    const SubgameSpec& spec, Player resolving_player,
+    const std::vector<double>& opponent_values) {
+  SPIEL_CHECK_FALSE(spec.states.empty());
+  return std::make_shared<const ResolverGadgetGame>(spec, resolving_player,
+                                                    opponent_values);
+}
+
+SubgameResolver::SubgameResolver(std::shared_ptr<const Game> game,
+                                 std::shared_ptr<Policy> blueprint,
+                                 const SubgameResolvingConfig& config)
+    : game_(std::move(game)),
+      blueprint_(std::move(blueprint)),
+      config_(config) {
+  SPIEL_CHECK_EQ(game_->NumPlayers(), 2);
+  SPIEL_CHECK_TRUE(game_->GetType().utility == GameType::Utility::kZeroSum);
+}
+
+int64_t SubgameResolver::SubgameLeafCount(const SubgameSpec& spec,
+                                          Player resolving_player) const {
+  std::vector<const State*> start_states;
+  start_states.reserve(spec.states.size());
+  for (const std::unique_ptr<State>& state : spec.states) {
+    start_states.push_back(state.get());
+  }
+  return MakeInfostateTree(start_states, spec.reach_probs,
+                           game_->MakeObserver(kInfoStateObsType, {}),
+                           resolving_player)
+      ->num_leaves();
+}
+
+void SubgameResolver::Reset() {
+  solver_.reset();
+  gadget_.reset();
+  resolved_policy_.reset();
+  covered_infostates_.clear();
+  resolved_player_ = kInvalidPlayer;
+}
+
+const Policy* SubgameResolver::ResolveAt(const State& state,
+                                         const SubgameSpec& spec) {
+  const Player resolver = state.CurrentPlayer();
+  SPIEL_CHECK_GE(resolver, 0);
+  SPIEL_CHECK_LT(resolver, game_->NumPlayers());
+  const std::string info_state = state.InformationStateString(resolver);
+
+  // Later decision inside the subgame we already solved: keep the gadget and
+  // optionally refine the warm solver instead of re-solving.
+  if (solver_ != nullptr && resolver == resolved_player_ &&
+      covered_infostates_.contains(info_state)) {
+    for (int i = 0; i < config_.refinement_iterations; ++i) {
+      solver_->EvaluateAndUpdatePolicy();
+    }
+    return resolved_policy_.get();
+  }
+
+  // The infostate tree over the spec both sizes the subgame for the gate and
+  // enumerates the decisions the solve will cover.
+  std::vector<const State*> start_states;
+  start_states.reserve(spec.states.size());
+  for (const std::unique_ptr<State>& root : spec.states) {
+    start_states.push_back(root.get());
+  }
+  std::shared_ptr<InfostateTree> tree = MakeInfostateTree(
+      start_states, spec.reach_probs,
+      game_->MakeObserver(kInfoStateObsType, {}), resolver);
+  if (config_.max_subgame_leaves > 0 &&
+      static_cast<int64_t>(tree->num_leaves()) > config_.max_subgame_leaves) {
+    return blueprint_.get();
+  }
+
+  const std::vector<double> opponent_values =
+      OpponentBlueprintValues(spec, 1 - resolver, *blueprint_);
+  gadget_ = MakeResolverGadgetGame(spec, resolver, opponent_values);
+  solver_ = std::make_unique<CFRPlusSolver>(*gadget_);
+
+  const bool timed = config_.time_budget_ms > 0;
+  const absl::Time deadline =
+      absl::Now() + absl::Milliseconds(config_.time_budget_ms);
+  for (int i = 0; i < config_.max_iterations; ++i) {
+    solver_->EvaluateAndUpdatePolicy();
+    if (timed && absl::Now() >= deadline) break;
+  }
+
+  covered_infostates_.clear();
+  for (const InfostateNode* node : tree->AllDecisionInfostates()) {
+    covered_infostates_.insert(node->infostate_string());
+  }
+  resolved_player_ = resolver;
+  resolved_policy_ = solver_->AveragePolicy();
+  return resolved_policy_.get();
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
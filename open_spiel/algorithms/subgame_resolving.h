@@ -0,0 +1,131 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_SUBGAME_RESOLVING_H_
+#define OPEN_SPIEL_ALGORITHMS_SUBGAME_RESOLVING_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_set.h"
+#include "open_spiel/algorithms/cfr.h"
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+
+// Safe subgame re-solving for two-player zero-sum games, after Burch,
+// Johanson & Bowling, "Solving Imperfect Information Games Using
+// Decomposition" (AAAI 2014). When play reaches a small-enough public state,
+// the histories consistent with it are gathered into a SubgameSpec, the
+// opponent's counterfactual values under the blueprint are computed, and a
+// re-solving gadget game is built: chance deals one of the histories
+// proportionally to the opponent's counterfactual reach, after which the
+// opponent may either accept their blueprint value or play the subgame out.
+// Running CFR on the gadget yields a subgame strategy for the resolving
+// player that is no more exploitable than the blueprint, and usually much
+// less. The driver caches the solved gadget so consecutive decisions inside
+// the same subgame reuse it (optionally refining it by a few iterations per
+// decision) instead of re-solving from scratch.
+//
+// Building the spec is the serving stack's job since it owns the beliefs;
+// for Durak endgames the consistent histories come from enumerating the
+// opponent hands a DurakBeliefTracker considers possible and determinizing
+// each into its own state.
+
+namespace open_spiel {
+namespace algorithms {
+
+// The root of a subgame: every history consistent with the current public
+// state, with its counterfactual reach for the opponent (chance reach times
+// the resolving player's blueprint reach; the opponent's own actions do not
+// weight their beliefs). Reaches need not be normalized.
+struct SubgameSpec {
+  std::vector<std::unique_ptr<State>> states;
+  std::vector<double> reach_probs;
+};
+
+struct SubgameResolvingConfig {
+  // CFR iterations per fresh solve.
+  int max_iterations = 1000;
+  // Wall-clock budget per fresh solve in milliseconds; 0 solves for
+  // max_iterations regardless of time.
+  double time_budget_ms = 0;
+  // Extra CFR iterations run when a cached solve is reused for a later
+  // decision in the same subgame; 0 reuses the cached policy as is.
+  int refinement_iterations = 0;
+  // Refuse to resolve subgames whose infostate tree has more leaves than
+  // this, returning the blueprint instead; 0 disables the gate.
+  int64_t max_subgame_leaves = 0;
+};
+
+// The opponent's expected value at each root history when both players
+// follow `blueprint` from there on; these are the gadget's terminate
+// payoffs.
+std::vector<double> OpponentBlueprintValues(const SubgameSpec& spec,
+                                            Player opponent,
+                                            const Policy& blueprint);
+
+// Builds the re-solving gadget over the spec's histories. The gadget is a
+// two-player zero-sum game: a root chance node picks history i with
+// probability proportional to spec.reach_probs[i], the opponent then chooses
+// to Terminate (receiving opponent_values[i], the resolving player its
+// negation) or to Follow into a clone of the history. Infostate strings
+// below Follow are the underlying game's; the opponent's Follow/Terminate
+// infostates are suffixed so they cannot collide with them.
+std::shared_ptr<const Game> MakeResolverGadgetGame(
+    const SubgameSpec& spec, Player resolving_player,
+    const std::vector<double>& opponent_values);
+
+// Online re-solving driver: owns the blueprint, builds and solves gadgets on
+// demand, and reuses a solve across the consecutive decisions it covers.
+class SubgameResolver {
+ public:
+  SubgameResolver(std::shared_ptr<const Game> game,
+                  std::shared_ptr<Policy> blueprint,
+                  const SubgameResolvingConfig& config);
+
+  // Returns the policy to act from `state` (the resolving player must be the
+  // state's current player): the cached subgame solution when the state's
+  // infostate lies inside it, a fresh solve of `spec` otherwise, or the
+  // blueprint when the subgame is larger than the configured gate. The
+  // returned policy stays valid until the next ResolveAt or Reset call.
+  const Policy* ResolveAt(const State& state, const SubgameSpec& spec);
+
+  // The number of leaves of the resolving player's infostate tree over the
+  // spec, i.e. the size gated by max_subgame_leaves.
+  int64_t SubgameLeafCount(const SubgameSpec& spec,
+                           Player resolving_player) const;
+
+  // Drops the cached solve, e.g. at the start of a new match.
+  void Reset();
+
+ private:
+  std::shared_ptr<const Game> game_;
+  std::shared_ptr<Policy> blueprint_;
+  SubgameResolvingConfig config_;
+
+  // The live solve: the gadget keeps the solver's game alive, the solver
+  // keeps the average policy's tables alive, and the infostate set tells
+  // which decisions the solve covers.
+  std::shared_ptr<const Game> gadget_;
+  std::unique_ptr<CFRPlusSolver> solver_;
+  std::shared_ptr<Policy> resolved_policy_;
+  absl::flat_hash_set<std::string> covered_infostates_;
+  Player resolved_player_ = kInvalidPlayer;
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_SUBGAME_RESOLVING_H_
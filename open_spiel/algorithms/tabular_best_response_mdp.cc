@@ -14,11 +14,14 @@
 
 #include "open_spiel/algorithms/tabular_best_response_mdp.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/abseil-cpp/absl/memory/memory.h"
@@ -26,6 +29,7 @@
 #include "open_spiel/policy.h"
 #include "open_spiel/simultaneous_move_game.h"
 #include "open_spiel/spiel_globals.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -68,42 +72,96 @@ MDPNode *MDP::LookupOrCreateNode(const std::string &node_key, bool terminal) {
   }
 }
 
-double MDP::Solve(double tolerance, TabularPolicy *br_policy) {
-  double delta = 0;
+void MDP::MergeFrom(MDP *other) {
+  for (auto &key_and_node : other->node_map_) {
+    MDPNode *other_node = key_and_node.second.get();
+    MDPNode *node = LookupOrCreateNode(key_and_node.first,
+                                       other_node->terminal());
+    if (other_node->terminal()) {
+      node->set_terminal(true);
+      node->set_value(other_node->value());
+    }
+    // Both roots carry the 1.0 placed there by the constructor; every other
+    // weight is a sum over the histories the partial MDP covered.
+    if (key_and_node.first != kRootKey) {
+      node->add_weight(other_node->total_weight());
+    }
+    for (auto &action_and_children : other_node->children()) {
+      for (auto &child_and_weight : action_and_children.second) {
+        MDPNode *other_child = child_and_weight.first;
+        MDPNode *child = LookupOrCreateNode(other_child->node_key(),
+                                            other_child->terminal());
+        if (other_child->terminal()) {
+          child->set_terminal(true);
+        }
+        node->IncTransitionWeight(action_and_children.first, child,
+                                  child_and_weight.second);
+      }
+    }
+  }
+}
 
-  do {
-    delta = 0.0;
-    for (auto &key_and_node : node_map_) {
-      MDPNode *node = key_and_node.second.get();
+double MDP::Solve(double tolerance, TabularPolicy *br_policy) {
+  // Value iteration makes many sweeps over every transition, so first compact
+  // the per-node transition maps into one flat array, sorted by action within
+  // each node, with precomputed probabilities. The maps stay as built; the
+  // flat form is just the iteration-friendly view of them.
+  struct FlatTransition {
+    Action action;
+    MDPNode *child;
+    double prob;
+  };
+  std::vector<MDPNode*> nodes;
+  nodes.reserve(num_nonterminal_nodes_);
+  for (auto &key_and_node : node_map_) {
+    if (!key_and_node.second->terminal()) {
+      nodes.push_back(key_and_node.second.get());
+    }
+  }
 
-      if (node->terminal()) {
-        continue;
+  std::vector<FlatTransition> transitions;
+  std::vector<int> offsets;  // Node i's transitions: [offsets[i], offsets[i+1])
+  offsets.reserve(nodes.size() + 1);
+  offsets.push_back(0);
+  for (MDPNode *node : nodes) {
+    const int start = offsets.back();
+    double node_weight = node->total_weight();
+    SPIEL_CHECK_GE(node_weight, 0.0);
+    for (const auto &action_and_children : node->children()) {
+      for (const auto &child_and_weight : action_and_children.second) {
+        SPIEL_CHECK_TRUE(child_and_weight.first != nullptr);
+        double prob = child_and_weight.second / node_weight;
+        if (std::isnan(prob)) {
+          // When transition_weight = node_weight = 0, set to 0
+          prob = 0.0;
+        }
+        SPIEL_CHECK_PROB(prob);
+        transitions.push_back(
+            {action_and_children.first, child_and_weight.first, prob});
       }
+    }
+    std::sort(transitions.begin() + start, transitions.end(),
+              [](const FlatTransition &a, const FlatTransition &b) {
+                return a.action < b.action;
+              });
+    offsets.push_back(transitions.size());
+  }
 
+  double delta = 0;
+  do {
+    delta = 0.0;
+    for (int i = 0; i < nodes.size(); ++i) {
+      MDPNode *node = nodes[i];
       double max_value = -std::numeric_limits<double>::infinity();
       Action max_action = kInvalidAction;
-      double node_weight = node->total_weight();
-      SPIEL_CHECK_GE(node_weight, 0.0);
 
       // Compute Bellman value from children.
-      for (const auto &action_and_child : node->children()) {
+      for (int t = offsets[i]; t < offsets[i + 1];) {
+        const Action action = transitions[t].action;
         double action_value = 0.0;
-        Action action = action_and_child.first;
-
-        for (auto &child_value : node->children()[action]) {
-          MDPNode *child = child_value.first;
-          double transition_weight = child_value.second;
-          SPIEL_CHECK_TRUE(child != nullptr);
-          double prob = transition_weight / node_weight;
-          if (std::isnan(prob)) {
-            // When transition_weight = node_weight = 0, set to 0
-            prob = 0.0;
-          }
-
-          SPIEL_CHECK_PROB(prob);
-          action_value += prob * child->value();
+        for (; t < offsets[i + 1] && transitions[t].action == action; ++t) {
+          action_value += transitions[t].prob * transitions[t].child->value();
         }
-
         if (action_value > max_value) {
           max_value = action_value;
           max_action = action;
@@ -113,17 +171,32 @@ double MDP::Solve(double tolerance, TabularPolicy *br_policy) {
       SPIEL_CHECK_NE(max_action, kInvalidAction);
       delta += std::abs(node->value() - max_value);
       node->set_value(max_value);
+    }
+  } while (delta > tolerance);
 
-      // Set the best response to the maximum-value action, if it's non-null.
-      if (node->node_key() != kRootKey) {
-        ActionsAndProbs br_state_policy;
-        for (const auto &[action, child] : node->children()) {
-          SetProb(&br_state_policy, action, action == max_action ? 1.0 : 0.0);
-        }
-        br_policy->SetStatePolicy(node->node_key(), br_state_policy);
+  // Extract the best response from the converged values.
+  for (int i = 0; i < nodes.size(); ++i) {
+    MDPNode *node = nodes[i];
+    if (node->node_key() == kRootKey) continue;
+
+    double max_value = -std::numeric_limits<double>::infinity();
+    Action max_action = kInvalidAction;
+    ActionsAndProbs br_state_policy;
+    for (int t = offsets[i]; t < offsets[i + 1];) {
+      const Action action = transitions[t].action;
+      double action_value = 0.0;
+      for (; t < offsets[i + 1] && transitions[t].action == action; ++t) {
+        action_value += transitions[t].prob * transitions[t].child->value();
+      }
+      if (action_value > max_value) {
+        max_value = action_value;
+        max_action = action;
       }
+      SetProb(&br_state_policy, action, 0.0);
     }
-  } while (delta > tolerance);
+    SetProb(&br_state_policy, max_action, 1.0);
+    br_policy->SetStatePolicy(node->node_key(), br_state_policy);
+  }
 
   return RootNode()->value();
 }
@@ -141,7 +214,8 @@ TabularBestResponseMDP::OpponentReach(const std::vector<double>& reach_probs,
 }
 
 void TabularBestResponseMDP::BuildMDPs(
-    const State &state, const std::vector<double>& reach_probs,
+    std::vector<std::unique_ptr<MDP>>* mdps, const State &state,
+    const std::vector<double>& reach_probs,
     const std::vector<MDPNode*>& parent_nodes,
     const std::vector<Action>& parent_actions, Player only_for_player) {
   if (state.IsTerminal()) {
@@ -149,7 +223,7 @@ void TabularBestResponseMDP::BuildMDPs(
     for (Player p = 0; p < game_.NumPlayers(); ++p) {
       if (only_for_player == kInvalidPlayer || only_for_player == p) {
         std::string node_key = state.ToString();
-        MDPNode *node = mdps_.at(p)->CreateTerminalNode(node_key);
+        MDPNode *node = mdps->at(p)->CreateTerminalNode(node_key);
         node->set_value(terminal_values[p]);
         double opponent_reach = OpponentReach(reach_probs, p);
         SPIEL_CHECK_GE(opponent_reach, 0.0);
@@ -173,8 +247,8 @@ void TabularBestResponseMDP::BuildMDPs(
       std::vector<double> new_reach_probs = reach_probs;
       // Chance prob is at the end of the vector.
       new_reach_probs[game_.NumPlayers()] *= prob;
-      BuildMDPs(*state_copy, new_reach_probs, parent_nodes, parent_actions,
-                only_for_player);
+      BuildMDPs(mdps, *state_copy, new_reach_probs, parent_nodes,
+                parent_actions, only_for_player);
     }
   } else if (state.IsSimultaneousNode()) {
     // Several nodes are created: one for each player as the maximizer.
@@ -186,7 +260,8 @@ void TabularBestResponseMDP::BuildMDPs(
     for (Player player = 0; player < num_players_; ++player) {
       if (only_for_player == kInvalidPlayer || only_for_player == player) {
         node_keys[player] = GetNodeKey(state, player);
-        nodes[player] = mdps_.at(player)->LookupOrCreateNode(node_keys[player]);
+        nodes[player] =
+            mdps->at(player)->LookupOrCreateNode(node_keys[player]);
         opponent_reaches[player] = OpponentReach(reach_probs, player);
 
         SPIEL_CHECK_GE(opponent_reaches[player], 0.0);
@@ -234,7 +309,7 @@ void TabularBestResponseMDP::BuildMDPs(
         new_parent_actions[player] = actions[player];
       }
 
-      BuildMDPs(*state_copy, new_reach_probs, new_parent_nodes,
+      BuildMDPs(mdps, *state_copy, new_reach_probs, new_parent_nodes,
                 new_parent_actions, only_for_player);
     }
   } else {
@@ -248,7 +323,7 @@ void TabularBestResponseMDP::BuildMDPs(
     if (only_for_player == kInvalidPlayer || only_for_player == player) {
       std::string node_key = GetNodeKey(state, player);
 
-      node = mdps_.at(player)->LookupOrCreateNode(node_key);
+      node = mdps->at(player)->LookupOrCreateNode(node_key);
       double opponent_reach = OpponentReach(reach_probs, player);
 
       SPIEL_CHECK_GE(opponent_reach, 0.0);
@@ -290,7 +365,7 @@ void TabularBestResponseMDP::BuildMDPs(
       std::vector<Action> new_parent_actions = parent_actions;
       new_parent_actions[player] = action;
 
-      BuildMDPs(*state_copy, new_reach_probs, new_parent_nodes,
+      BuildMDPs(mdps, *state_copy, new_reach_probs, new_parent_nodes,
                 new_parent_actions, only_for_player);
     }
   }
@@ -310,9 +385,72 @@ std::string TabularBestResponseMDP::GetNodeKey(const State &state,
 }
 
 TabularBestResponseMDP::TabularBestResponseMDP(const Game &game,
-                                               const Policy &fixed_policy)
+                                               const Policy &fixed_policy,
+                                               int num_threads)
     : game_(game), fixed_policy_(fixed_policy),
-      num_players_(game.NumPlayers()) {}
+      num_players_(game.NumPlayers()), num_build_threads_(num_threads) {
+  SPIEL_CHECK_GE(num_build_threads_, 1);
+}
+
+void TabularBestResponseMDP::BuildMDPsFromRoot(const State &root,
+                                               Player only_for_player) {
+  std::vector<MDPNode*> parent_nodes(num_players_, nullptr);
+  for (Player p = 0; p < num_players_; ++p) {
+    if (mdps_[p] != nullptr) {
+      parent_nodes[p] = mdps_[p]->RootNode();
+    }
+  }
+  std::vector<double> reach_probs(num_players_ + 1, 1.0);  // include chance.
+  std::vector<Action> parent_actions(num_players_, 0);
+
+  if (num_build_threads_ <= 1 || !root.IsChanceNode()) {
+    BuildMDPs(&mdps_, root, reach_probs, parent_nodes, parent_actions,
+              only_for_player);
+    return;
+  }
+
+  // Each worker traverses a strided subset of the root chance outcomes into
+  // private MDPs, sharing nothing, and the partial MDPs are then merged by
+  // node key into mdps_.
+  ActionsAndProbs outcomes = root.ChanceOutcomes();
+  const int num_workers =
+      std::min<int>(num_build_threads_, outcomes.size());
+  std::vector<std::vector<std::unique_ptr<MDP>>> partial_mdps(num_workers);
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int t = 0; t < num_workers; ++t) {
+    workers.emplace_back([this, t, num_workers, &root, &outcomes,
+                          &partial_mdps, only_for_player]() {
+      std::vector<std::unique_ptr<MDP>> &mdps = partial_mdps[t];
+      mdps.resize(num_players_);
+      std::vector<MDPNode*> worker_parents(num_players_, nullptr);
+      for (Player p = 0; p < num_players_; ++p) {
+        if (only_for_player == kInvalidPlayer || only_for_player == p) {
+          mdps[p] = absl::make_unique<MDP>();
+          worker_parents[p] = mdps[p]->RootNode();
+        }
+      }
+      std::vector<Action> worker_actions(num_players_, 0);
+      for (int i = t; i < outcomes.size(); i += num_workers) {
+        std::unique_ptr<State> state = root.Clone();
+        state->ApplyAction(outcomes[i].first);
+        std::vector<double> worker_reach(num_players_ + 1, 1.0);
+        worker_reach[num_players_] = outcomes[i].second;
+        BuildMDPs(&mdps, *state, worker_reach, worker_parents, worker_actions,
+                  only_for_player);
+      }
+    });
+  }
+  for (Thread &worker : workers) worker.join();
+
+  for (int t = 0; t < num_workers; ++t) {
+    for (Player p = 0; p < num_players_; ++p) {
+      if (partial_mdps[t][p] != nullptr) {
+        mdps_[p]->MergeFrom(partial_mdps[t][p].get());
+      }
+    }
+  }
+}
 
 int TabularBestResponseMDP::TotalNumNonterminals() const {
   int total_num_nonterminals = 0;
@@ -340,16 +478,8 @@ TabularBestResponseMDPInfo TabularBestResponseMDP::ComputeBestResponses() {
     }
   }
 
-  std::vector<MDPNode*> parent_nodes;
-  parent_nodes.reserve(num_players_);
-  for (Player p = 0; p < num_players_; p++) {
-    parent_nodes.push_back(mdps_[p]->RootNode());
-  }
-  std::vector<double> reach_probs(num_players_ + 1, 1.0);  // include chance.
-  std::vector<Action> parent_actions(num_players_, 0);
-
   std::unique_ptr<State> initial_state = game_.NewInitialState();
-  BuildMDPs(*initial_state, reach_probs, parent_nodes, parent_actions);
+  BuildMDPsFromRoot(*initial_state, kInvalidPlayer);
 
   for (Player p = 0; p < num_players_; p++) {
     br_info.br_values[p] =
@@ -368,14 +498,8 @@ TabularBestResponseMDP::ComputeBestResponse(Player max_player) {
     mdps_[max_player] = absl::make_unique<MDP>();
   }
 
-  std::vector<MDPNode*> parent_nodes(num_players_, nullptr);
-  parent_nodes[max_player] = mdps_[max_player]->RootNode();
-  std::vector<double> reach_probs(num_players_ + 1, 1.0);  // include chance.
-  std::vector<Action> parent_actions(num_players_, 0);
-
   std::unique_ptr<State> initial_state = game_.NewInitialState();
-  BuildMDPs(*initial_state, reach_probs, parent_nodes, parent_actions,
-            max_player);
+  BuildMDPsFromRoot(*initial_state, max_player);
 
   br_info.br_values[max_player] =
         mdps_[max_player]->Solve(kSolveTolerance,
@@ -109,6 +109,11 @@ class MDP {
                               bool terminal = false);
   MDPNode* RootNode() { return node_map_[kRootKey].get(); }
 
+  // Merges a partial MDP (built over a subset of the game's histories) into
+  // this one: nodes are matched by key, and node and transition weights are
+  // added. Used to combine the per-thread MDPs of a parallel build.
+  void MergeFrom(MDP* other);
+
   double Solve(double tolerance, TabularPolicy* br_policy);
   int NumNonTerminalNodes() const { return num_nonterminal_nodes_; }
   int TotalSize() const { return node_map_.size(); }
@@ -140,7 +145,13 @@ struct TabularBestResponseMDPInfo {
 
 class TabularBestResponseMDP {
  public:
-  TabularBestResponseMDP(const Game& game, const Policy& fixed_policy);
+  // If num_threads > 1, the MDP build is parallelized across the outcomes of
+  // the root chance node (if any): each thread traverses its share of the
+  // subtrees into private MDPs which are then merged by node key. The merged
+  // MDPs match a single-threaded build up to floating-point summation order
+  // of the transition weights.
+  TabularBestResponseMDP(const Game& game, const Policy& fixed_policy,
+                         int num_threads = 1);
 
   // Compute best responses for all players.
   TabularBestResponseMDPInfo ComputeBestResponses();
@@ -164,11 +175,17 @@ class TabularBestResponseMDP {
   // by the opponents' policies. The transition probabilities are obtained by
   // summing the weights (h, a, h') that satisfy (s, a, s') and normalizing by
   // the weight obtained by the condition of having reached s.
-  void BuildMDPs(const State &state, const std::vector<double> &reach_probs,
+  void BuildMDPs(std::vector<std::unique_ptr<MDP>>* mdps, const State &state,
+                 const std::vector<double> &reach_probs,
                  const std::vector<MDPNode*> &parent_nodes,
                  const std::vector<Action> &parent_actions,
                  Player only_for_player = kInvalidPlayer);
 
+  // Builds the MDPs in mdps_ from the root, splitting the traversal over the
+  // root chance outcomes across num_build_threads_ when possible, and falling
+  // back to the serial traversal otherwise.
+  void BuildMDPsFromRoot(const State &root, Player only_for_player);
+
   std::string GetNodeKey(const State &state, Player player) const;
 
   double OpponentReach(const std::vector<double> &reach_probs, Player p) const;
@@ -177,6 +194,7 @@ class TabularBestResponseMDP {
   const Game &game_;
   const Policy &fixed_policy_;
   const int num_players_;
+  const int num_build_threads_;
 };
 
 }  // namespace algorithms
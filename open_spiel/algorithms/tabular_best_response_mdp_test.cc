@@ -69,6 +69,31 @@ void OnlyFirstPlayerTests() {
 }
 
 
+void ParallelBuildTests() {
+  UniformPolicy uniform_policy;
+  // The parallel build splits the traversal across root chance outcomes and
+  // merges the per-thread MDPs; the result must match the serial build.
+  for (std::string game_string : {"kuhn_poker", "leduc_poker",
+                                  "kuhn_poker(players=3)"}) {
+    std::shared_ptr<const Game> game = LoadGame(game_string);
+    TabularBestResponseMDP serial(*game, uniform_policy);
+    TabularBestResponseMDP parallel(*game, uniform_policy, /*num_threads=*/3);
+    TabularBestResponseMDPInfo serial_info = serial.NashConv();
+    TabularBestResponseMDPInfo parallel_info = parallel.NashConv();
+    SPIEL_CHECK_FLOAT_NEAR(parallel_info.nash_conv, serial_info.nash_conv,
+                           kFloatTolerance);
+    SPIEL_CHECK_EQ(parallel.TotalSize(), serial.TotalSize());
+    SPIEL_CHECK_EQ(parallel.TotalNumNonterminals(),
+                   serial.TotalNumNonterminals());
+  }
+
+  // Games without a root chance node fall back to the serial traversal.
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  TabularBestResponseMDP tbr(*game, uniform_policy, /*num_threads=*/2);
+  TabularBestResponseMDPInfo br_info = tbr.ComputeBestResponse(0);
+  SPIEL_CHECK_GT(br_info.br_values[0], 0);
+}
+
 void KuhnLeduc3pTests() {
   UniformPolicy uniform_policy;
   NashConvTest("kuhn_poker(players=3)", uniform_policy, 2.0625);
@@ -208,6 +233,7 @@ int main(int argc, char **argv) {
   open_spiel::algorithms::LeducNashConvTests();
   open_spiel::algorithms::OnlyFirstPlayerTests();
   open_spiel::algorithms::KuhnLeduc3pTests();
+  open_spiel::algorithms::ParallelBuildTests();
   open_spiel::algorithms::RPSGameTests();
   open_spiel::algorithms::OshiZumoGameTests();
   open_spiel::algorithms::GoofspielGameTests();
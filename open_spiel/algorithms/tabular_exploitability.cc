@@ -14,20 +14,101 @@
 
 #include "open_spiel/algorithms/tabular_exploitability.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <unordered_set>
+#include <vector>
 
 #include "open_spiel/algorithms/best_response.h"
 #include "open_spiel/algorithms/expected_returns.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
+namespace {
+
+// Computes each player's best-response value against the policy, each player
+// on its own thread when num_threads > 1. A single best-response tree is not
+// split further: best-response decisions couple histories across initial
+// chance outcomes, since an infoset spans every deal consistent with the
+// responder's private information.
+std::vector<double> BestResponseValues(const Game& game, const Policy& policy,
+                                       int num_threads) {
+  std::vector<double> values(game.NumPlayers());
+  if (num_threads <= 1) {
+    std::unique_ptr<State> root = game.NewInitialState();
+    for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
+      TabularBestResponse best_response(game, p, &policy);
+      values[p] = best_response.Value(*root);
+    }
+    return values;
+  }
+  std::vector<Thread> threads;
+  threads.reserve(game.NumPlayers());
+  for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
+    threads.emplace_back([&game, &policy, &values, p]() {
+      std::unique_ptr<State> root = game.NewInitialState();
+      TabularBestResponse best_response(game, p, &policy);
+      values[p] = best_response.Value(*root);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  return values;
+}
+
+// On-policy expected returns. When the root is a chance node (e.g. the deal)
+// and num_threads > 1, the outcomes are divided round-robin over the threads
+// and each accumulates a chance-weighted partial sum, merged at the end; the
+// traversal below distinct outcomes is independent.
+std::vector<double> ParallelExpectedReturns(const State& root,
+                                            const Policy& policy,
+                                            bool use_infostate_get_policy,
+                                            int num_threads) {
+  if (num_threads <= 1 || !root.IsChanceNode()) {
+    return ExpectedReturns(root, policy, /*depth_limit=*/-1,
+                           use_infostate_get_policy);
+  }
+  ActionsAndProbs outcomes = root.ChanceOutcomes();
+  const int num_workers =
+      std::min<int>(num_threads, static_cast<int>(outcomes.size()));
+  std::vector<std::vector<double>> partial_sums(
+      num_workers, std::vector<double>(root.NumPlayers(), 0.0));
+  std::vector<Thread> threads;
+  threads.reserve(num_workers);
+  for (int t = 0; t < num_workers; ++t) {
+    threads.emplace_back([&root, &policy, &outcomes, &partial_sums,
+                          use_infostate_get_policy, num_workers, t]() {
+      std::vector<double>& sums = partial_sums[t];
+      for (int i = t; i < outcomes.size(); i += num_workers) {
+        const auto& [action, prob] = outcomes[i];
+        std::unique_ptr<State> child = root.Child(action);
+        std::vector<double> returns = ExpectedReturns(
+            *child, policy, /*depth_limit=*/-1, use_infostate_get_policy);
+        for (int p = 0; p < sums.size(); ++p) sums[p] += prob * returns[p];
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  std::vector<double> values(root.NumPlayers(), 0.0);
+  for (const std::vector<double>& sums : partial_sums) {
+    for (int p = 0; p < values.size(); ++p) values[p] += sums[p];
+  }
+  return values;
+}
+
+}  // namespace
 
 double Exploitability(const Game& game, const Policy& policy) {
+  return Exploitability(game, policy, /*num_threads=*/1);
+}
+
+double Exploitability(const Game& game, const Policy& policy,
+                      int num_threads) {
   GameType game_type = game.GetType();
   if (game_type.dynamics != GameType::Dynamics::kSequential) {
     SpielFatalError("The game must be turn-based.");
@@ -37,11 +118,11 @@ double Exploitability(const Game& game, const Policy& policy) {
     SpielFatalError("The game must have zero- or constant-sum utility.");
   }
 
-  std::unique_ptr<State> root = game.NewInitialState();
+  std::vector<double> best_response_values =
+      BestResponseValues(game, policy, num_threads);
   double nash_conv = 0;
-  for (auto i = Player{0}; i < game.NumPlayers(); ++i) {
-    TabularBestResponse best_response(game, i, &policy);
-    nash_conv += best_response.Value(*root);
+  for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
+    nash_conv += best_response_values[p];
   }
   return (nash_conv - *game.UtilitySum()) / game.NumPlayers();
 }
@@ -59,19 +140,21 @@ double NashConv(const Game& game, const Policy& policy) {
 
 double NashConv(const Game& game, const Policy& policy,
                 bool use_state_get_policy) {
+  return NashConv(game, policy, use_state_get_policy, /*num_threads=*/1);
+}
+
+double NashConv(const Game& game, const Policy& policy,
+                bool use_state_get_policy, int num_threads) {
   GameType game_type = game.GetType();
   if (game_type.dynamics != GameType::Dynamics::kSequential) {
     SpielFatalError("The game must be turn-based.");
   }
 
   std::unique_ptr<State> root = game.NewInitialState();
-  std::vector<double> best_response_values(game.NumPlayers());
-  for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
-    TabularBestResponse best_response(game, p, &policy);
-    best_response_values[p] = best_response.Value(*root);
-  }
-  std::vector<double> on_policy_values =
-      ExpectedReturns(*root, policy, -1, !use_state_get_policy);
+  std::vector<double> best_response_values =
+      BestResponseValues(game, policy, num_threads);
+  std::vector<double> on_policy_values = ParallelExpectedReturns(
+      *root, policy, !use_state_get_policy, num_threads);
   SPIEL_CHECK_EQ(best_response_values.size(), on_policy_values.size());
   double nash_conv = 0;
   for (auto p = Player{0}; p < game.NumPlayers(); ++p) {
@@ -33,6 +33,13 @@ namespace algorithms {
 // an error.
 double Exploitability(const Game& game, const Policy& policy);
 
+// Same as above, computing each player's best response on its own thread.
+// Best-response decisions couple histories across initial chance outcomes
+// (an infoset spans all deals consistent with the responder's cards), so the
+// best-response trees themselves are not split further; use num_threads <= 1
+// for the single-threaded behavior.
+double Exploitability(const Game& game, const Policy& policy, int num_threads);
+
 // Same function provided for easy Python compatibility.
 double Exploitability(
     const Game& game,
@@ -58,6 +65,13 @@ double NashConv(const Game& game, const Policy& policy,
 // Same as above with use_state_get_policy set to false.
 double NashConv(const Game& game, const Policy& policy);
 
+// Parallel variant: computes each player's best response on its own thread
+// and splits the on-policy expected-returns traversal across the initial
+// chance outcomes (e.g. deals), with per-thread accumulators merged at the
+// end. num_threads <= 1 recovers the single-threaded behavior.
+double NashConv(const Game& game, const Policy& policy,
+                bool use_state_get_policy, int num_threads);
+
 // Same function provided for easy Python compatibility.
 double NashConv(const Game& game,
                 const std::unordered_map<std::string, ActionsAndProbs>& policy);
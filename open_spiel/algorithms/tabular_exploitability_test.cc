@@ -457,6 +457,18 @@ void TestNashConv(const std::string& game_name,
   }
 }
 
+// The parallel variants must agree with the single-threaded ones.
+void TestParallelMatchesSerial(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  TabularPolicy policy = GetUniformPolicy(*game);
+  SPIEL_CHECK_FLOAT_EQ(Exploitability(*game, policy, /*num_threads=*/4),
+                       Exploitability(*game, policy));
+  SPIEL_CHECK_FLOAT_EQ(
+      NashConv(*game, policy, /*use_state_get_policy=*/false,
+               /*num_threads=*/4),
+      NashConv(*game, policy));
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -497,4 +509,7 @@ int main(int argc, char** argv) {
                                        open_spiel::GetFirstActionPolicy, 2.);
   open_spiel::algorithms::TestNashConv("leduc_poker",
                                        open_spiel::GetFirstActionPolicy, 2.);
+
+  open_spiel::algorithms::TestParallelMatchesSerial("kuhn_poker");
+  open_spiel::algorithms::TestParallelMatchesSerial("leduc_poker");
 }
@@ -15,7 +15,12 @@
 #include "open_spiel/algorithms/tabular_q_learning.h"
 
 #include <algorithm>
+#include <atomic>
 #include <random>
+#include <string>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
@@ -128,11 +133,121 @@ TabularQLearningSolver::TabularQLearningSolver(
                  GameType::Information::kPerfectInformation);
 }
 
-const absl::flat_hash_map<std::pair<std::string, Action>, double>&
+const TabularQLearningSolver::QValueTable&
 TabularQLearningSolver::GetQValueTable() const {
   return values_;
 }
 
+void TabularQLearningSolver::RunParallelIterations(int num_episodes,
+                                                   int num_threads) {
+  SPIEL_CHECK_GT(num_episodes, 0);
+  SPIEL_CHECK_GE(num_threads, 1);
+  // Eligibility traces sweep the whole table on every step; only plain
+  // Q-learning shards across workers.
+  SPIEL_CHECK_EQ(lambda_, 0);
+
+  const double min_utility = game_->MinUtility();
+
+  // Draw worker seeds up front so the member RNG is not touched concurrently.
+  std::vector<std::mt19937::result_type> seeds;
+  seeds.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) seeds.push_back(rng_());
+
+  // Each worker learns on its own copy of the current table; values_ itself
+  // stays untouched during the run and serves as the merge baseline.
+  std::vector<QValueTable> local_tables(num_threads, values_);
+  std::atomic<int> next_episode(0);
+
+  auto worker = [&](int thread_num) {
+    std::mt19937 rng(seeds[thread_num]);
+    QValueTable& values = local_tables[thread_num];
+    auto lookup = [&values](const std::string& key, Action action) {
+      auto it = values.find(std::make_pair(key, action));
+      return it == values.end() ? 0.0 : it->second;
+    };
+    auto sample_chance = [&rng](State* state) {
+      while (state->IsChanceNode() && !state->IsTerminal()) {
+        state->ApplyAction(SampleAction(state->ChanceOutcomes(), rng).first);
+      }
+    };
+    auto best_action_value = [&](const std::string& key,
+                                 const std::vector<Action>& legal_actions) {
+      Action best_action = legal_actions[0];
+      double value = min_utility;
+      for (const Action& action : legal_actions) {
+        double q_val = lookup(key, action);
+        if (q_val >= value) {
+          value = q_val;
+          best_action = action;
+        }
+      }
+      return std::make_pair(best_action, value);
+    };
+
+    for (int episode = next_episode++; episode < num_episodes;
+         episode = next_episode++) {
+      std::unique_ptr<State> curr_state = game_->NewInitialState();
+      sample_chance(curr_state.get());
+      // The state key is built once per state and carried across the step,
+      // instead of re-stringifying the state for every table access.
+      std::string curr_key = curr_state->ToString();
+
+      while (!curr_state->IsTerminal()) {
+        const Player player = curr_state->CurrentPlayer();
+        const std::vector<Action> legal_actions = curr_state->LegalActions();
+        SPIEL_CHECK_GT(legal_actions.size(), 0);
+
+        Action curr_action;
+        if (absl::Uniform(rng, 0.0, 1.0) < epsilon_) {
+          curr_action =
+              legal_actions[absl::Uniform<int>(rng, 0, legal_actions.size())];
+        } else {
+          curr_action = best_action_value(curr_key, legal_actions).first;
+        }
+
+        std::unique_ptr<State> next_state = curr_state->Child(curr_action);
+        sample_chance(next_state.get());
+        std::string next_key = next_state->ToString();
+
+        const double reward = next_state->Rewards()[player];
+        double next_q_value = 0.0;
+        if (!next_state->IsTerminal()) {
+          next_q_value =
+              (player != next_state->CurrentPlayer() ? -1 : 1) *
+              best_action_value(next_key, next_state->LegalActions()).second;
+        }
+
+        const double prev_q_val = lookup(curr_key, curr_action);
+        values[{curr_key, curr_action}] =
+            prev_q_val + learning_rate_ * (reward +
+                                           discount_factor_ * next_q_value -
+                                           prev_q_val);
+
+        curr_state = std::move(next_state);
+        curr_key = std::move(next_key);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) threads.emplace_back(worker, i);
+  for (std::thread& thread : threads) thread.join();
+
+  // Sum each worker's learned deltas (relative to the shared baseline) back
+  // into the table.
+  QValueTable merged = values_;
+  for (const QValueTable& local : local_tables) {
+    for (const auto& [key, value] : local) {
+      auto baseline_it = values_.find(key);
+      const double baseline =
+          baseline_it == values_.end() ? 0.0 : baseline_it->second;
+      merged[key] += value - baseline;
+    }
+  }
+  values_ = std::move(merged);
+}
+
 void TabularQLearningSolver::RunIteration() {
   const double min_utility = game_->MinUtility();
   // Choose start state
@@ -51,6 +51,9 @@ class TabularQLearningSolver {
   static inline constexpr double kDefaultLambda = 0;
 
  public:
+  using QValueTable = absl::flat_hash_map<std::pair<std::string, Action>,
+                                          double>;
+
   TabularQLearningSolver(std::shared_ptr<const Game> game);
 
   TabularQLearningSolver(std::shared_ptr<const Game> game, double depth_limit,
@@ -59,8 +62,16 @@ class TabularQLearningSolver {
 
   void RunIteration();
 
-  const absl::flat_hash_map<std::pair<std::string, Action>, double>&
-  GetQValueTable() const;
+  // Runs num_episodes episodes spread over num_threads worker threads. Each
+  // worker learns on its own copy of the Q-value table (seeded from the
+  // current table) and the per-worker deltas are summed back into the shared
+  // table at the end, so workers read values that are stale with respect to
+  // each other within one call -- the usual batched-parallel Q-learning
+  // trade-off. Only supported for lambda == 0: eligibility traces touch the
+  // whole table on every step and do not shard.
+  void RunParallelIterations(int num_episodes, int num_threads);
+
+  const QValueTable& GetQValueTable() const;
 
  private:
   // Given a player and a state, gets the best possible action from this state
@@ -87,9 +98,8 @@ class TabularQLearningSolver {
   double discount_factor_;
   double lambda_;
   std::mt19937 rng_;
-  absl::flat_hash_map<std::pair<std::string, Action>, double> values_;
-  absl::flat_hash_map<std::pair<std::string, Action>, double>
-      eligibility_traces_;
+  QValueTable values_;
+  QValueTable eligibility_traces_;
 };
 
 }  // namespace algorithms
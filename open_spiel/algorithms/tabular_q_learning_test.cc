@@ -127,6 +127,21 @@ void TabularQLearningTest_Catch_Lambda00_Win() {
   SPIEL_CHECK_EQ(reward, 1);
 }
 
+void TabularQLearningTest_Catch_Lambda00_Parallel_Win() {
+  // Same as the serial win test, with the episodes spread over workers.
+  std::shared_ptr<const Game> game = LoadGame("catch");
+  auto tabular_q_learning_solver = QLearningSolver(game, 0);
+
+  tabular_q_learning_solver->RunParallelIterations(/*num_episodes=*/1000,
+                                                   /*num_threads=*/4);
+  const absl::flat_hash_map<std::pair<std::string, Action>, double>& q_values =
+      tabular_q_learning_solver->GetQValueTable();
+  std::unique_ptr<State> state = game->NewInitialState();
+
+  double reward = PlayCatch(q_values, state, 42);
+  SPIEL_CHECK_EQ(reward, 1);
+}
+
 void TabularQLearningTest_Catch_Lambda01_Win() {
   // Player wins after 100 train iterations
   std::shared_ptr<const Game> game = LoadGame("catch");
@@ -221,6 +236,7 @@ void TabularQLearningTest_TicTacToe_Lambda01_Tie() {
 int main(int argc, char **argv) {
   open_spiel::TabularQLearningTest_Catch_Lambda00_Loss();
   open_spiel::TabularQLearningTest_Catch_Lambda00_Win();
+  open_spiel::TabularQLearningTest_Catch_Lambda00_Parallel_Win();
   open_spiel::TabularQLearningTest_Catch_Lambda01_Win();
   open_spiel::TabularQLearningTest_Catch_Lambda01FasterThanLambda00();
   open_spiel::TabularQLearningTest_TicTacToe_Lambda01_Win();
@@ -14,9 +14,16 @@
 
 #include "open_spiel/algorithms/tensor_game_utils.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "open_spiel/algorithms/deterministic_policy.h"
 #include "open_spiel/algorithms/expected_returns.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace algorithms {
@@ -40,13 +47,16 @@ std::shared_ptr<const TensorGame> LoadTensorGame(const std::string& name) {
   return std::static_pointer_cast<const TensorGame>(game);
 }
 
-std::shared_ptr<const TensorGame> AsTensorGame(const Game* game) {
+std::shared_ptr<const TensorGame> AsTensorGame(const Game* game,
+                                               int num_threads) {
   const NormalFormGame* nfg = dynamic_cast<const NormalFormGame*>(game);
   SPIEL_CHECK_TRUE(nfg);
-  return AsTensorGame(nfg);
+  return AsTensorGame(nfg, num_threads);
 }
 
-std::shared_ptr<const TensorGame> AsTensorGame(const NormalFormGame* game) {
+std::shared_ptr<const TensorGame> AsTensorGame(const NormalFormGame* game,
+                                               int num_threads) {
+  SPIEL_CHECK_GE(num_threads, 1);
   const int num_players = game->NumPlayers();
   std::unique_ptr<State> initial_state = game->NewInitialState();
   std::vector<std::vector<Action>> legal_actions(num_players);
@@ -58,33 +68,58 @@ std::shared_ptr<const TensorGame> AsTensorGame(const NormalFormGame* game) {
           initial_state->ActionToString(player, action));
     }
   }
-  std::vector<std::vector<double>> utils(num_players);
 
   GameType type = game->GetType();
   type.min_num_players = num_players;
   type.max_num_players = num_players;
 
-  std::vector<Action> actions(num_players);
-  bool last_entry;
-  do {
-    std::unique_ptr<State> clone = initial_state->Clone();
-    clone->ApplyActions(actions);
-    SPIEL_CHECK_TRUE(clone->IsTerminal());
-    std::vector<double> returns = clone->Returns();
-    SPIEL_CHECK_EQ(returns.size(), num_players);
-    for (Player player = 0; player < num_players; ++player) {
-      utils[player].push_back(returns[player]);
-    }
-    last_entry = true;
-    for (Player player = num_players - 1; player >= 0; --player) {
-      if (++actions[player] < legal_actions[player].size()) {
-        last_entry = false;
-        break;
-      } else {
-        actions[player] = 0;
+  // The utility tensor is flattened with the last player's action as the
+  // least significant digit, so cell `flat` decodes to one joint action and
+  // the cells can be filled in any order.
+  int64_t num_cells = 1;
+  for (Player player = 0; player < num_players; ++player) {
+    num_cells *= legal_actions[player].size();
+  }
+  std::vector<std::vector<double>> utils(
+      num_players, std::vector<double>(num_cells));
+
+  auto fill_cells = [&legal_actions, &utils, num_players, num_cells](
+                        const State& base, int64_t first_cell, int stride) {
+    std::vector<Action> actions(num_players);
+    for (int64_t flat = first_cell; flat < num_cells; flat += stride) {
+      int64_t remainder = flat;
+      for (Player player = num_players - 1; player >= 0; --player) {
+        actions[player] =
+            legal_actions[player][remainder % legal_actions[player].size()];
+        remainder /= legal_actions[player].size();
       }
+      std::unique_ptr<State> clone = base.Clone();
+      clone->ApplyActions(actions);
+      SPIEL_CHECK_TRUE(clone->IsTerminal());
+      std::vector<double> returns = clone->Returns();
+      SPIEL_CHECK_EQ(returns.size(), num_players);
+      for (Player player = 0; player < num_players; ++player) {
+        utils[player][flat] = returns[player];
+      }
+    }
+  };
+  const int num_workers = std::min<int64_t>(num_threads, num_cells);
+  if (num_workers <= 1) {
+    fill_cells(*initial_state, 0, 1);
+  } else {
+    std::vector<std::unique_ptr<State>> worker_states;
+    for (int t = 0; t < num_workers; ++t) {
+      worker_states.push_back(initial_state->Clone());
     }
-  } while (!last_entry);
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int t = 0; t < num_workers; ++t) {
+      workers.emplace_back([&fill_cells, &worker_states, t, num_workers]() {
+        fill_cells(*worker_states[t], t, num_workers);
+      });
+    }
+    for (Thread& worker : workers) worker.join();
+  }
 
   return std::shared_ptr<TensorGame>(
       new TensorGame(type, {}, action_names, utils));
@@ -30,12 +30,16 @@ namespace algorithms {
 std::shared_ptr<const tensor_game::TensorGame> LoadTensorGame(
     const std::string& name);
 
-// Clones a normal-form game and returns it as a TensorGame.
+// Clones a normal-form game and returns it as a TensorGame. With
+// num_threads > 1 the utility cells (one joint action each) are evaluated on
+// worker threads over disjoint stripes of the flattened tensor; the
+// resulting game is identical to the serial conversion.
 
 std::shared_ptr<const tensor_game::TensorGame> AsTensorGame(
-    const NormalFormGame* game);
+    const NormalFormGame* game, int num_threads = 1);
 
-std::shared_ptr<const tensor_game::TensorGame> AsTensorGame(const Game* game);
+std::shared_ptr<const tensor_game::TensorGame> AsTensorGame(
+    const Game* game, int num_threads = 1);
 
 }  // namespace algorithms
 }  // namespace open_spiel
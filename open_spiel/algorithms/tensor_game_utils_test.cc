@@ -33,10 +33,33 @@ void ConvertToTensorGameTest() {
             << tensor_blotto->PlayerUtility(Player{2}, {0, 15, 3}) << std::endl;
 }
 
+void ParallelConversionTest() {
+  // Cells are independent, so the threaded conversion must match the serial
+  // one exactly.
+  std::shared_ptr<const Game> blotto = LoadGame("blotto(players=3,coins=5)");
+  std::shared_ptr<const tensor_game::TensorGame> serial =
+      AsTensorGame(blotto.get());
+  std::shared_ptr<const tensor_game::TensorGame> parallel =
+      AsTensorGame(blotto.get(), /*num_threads=*/3);
+  SPIEL_CHECK_TRUE(serial->Shape() == parallel->Shape());
+  const std::vector<int>& shape = serial->Shape();
+  for (int a0 = 0; a0 < shape[0]; ++a0) {
+    for (int a1 = 0; a1 < shape[1]; ++a1) {
+      for (int a2 = 0; a2 < shape[2]; ++a2) {
+        for (Player p = 0; p < 3; ++p) {
+          SPIEL_CHECK_EQ(serial->PlayerUtility(p, {a0, a1, a2}),
+                         parallel->PlayerUtility(p, {a0, a1, a2}));
+        }
+      }
+    }
+  }
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::algorithms::ConvertToTensorGameTest();
+  open_spiel::algorithms::ParallelConversionTest();
 }
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 
@@ -220,6 +221,116 @@ BatchedTrajectory RecordBatchedTrajectory(
                                  max_unroll_length);
 }
 
+ColumnarBatchedTrajectory::ColumnarBatchedTrajectory(int batch_size,
+                                                     int max_length,
+                                                     int observation_size,
+                                                     int num_distinct_actions,
+                                                     int num_players)
+    : batch_size(batch_size),
+      max_length(max_length),
+      observation_size(observation_size),
+      num_distinct_actions(num_distinct_actions),
+      num_players(num_players) {
+  SPIEL_CHECK_GT(batch_size, 0);
+  SPIEL_CHECK_GT(max_length, 0);
+  SPIEL_CHECK_GT(observation_size, 0);
+  SPIEL_CHECK_GT(num_distinct_actions, 0);
+  SPIEL_CHECK_GT(num_players, 0);
+  const size_t num_steps = static_cast<size_t>(batch_size) * max_length;
+  observations.resize(num_steps * observation_size, 0.);
+  legal_actions.resize(num_steps * num_distinct_actions, 0);
+  if (num_distinct_actions <= 64) legal_masks.resize(num_steps, 0);
+  player_policies.resize(num_steps * num_distinct_actions, 0.);
+  actions.resize(num_steps, 0);
+  player_ids.resize(num_steps, 0);
+  valid.resize(num_steps, 0);
+  next_is_terminal.resize(num_steps, 0);
+  rewards.resize(static_cast<size_t>(batch_size) * num_players, 0.);
+  lengths.resize(batch_size, 0);
+}
+
+void ColumnarBatchedTrajectory::Clear() {
+  std::fill(observations.begin(), observations.end(), 0.);
+  std::fill(legal_actions.begin(), legal_actions.end(), 0);
+  std::fill(legal_masks.begin(), legal_masks.end(), 0);
+  std::fill(player_policies.begin(), player_policies.end(), 0.);
+  std::fill(actions.begin(), actions.end(), 0);
+  std::fill(player_ids.begin(), player_ids.end(), 0);
+  std::fill(valid.begin(), valid.end(), 0);
+  std::fill(next_is_terminal.begin(), next_is_terminal.end(), 0);
+  std::fill(rewards.begin(), rewards.end(), 0.);
+  std::fill(lengths.begin(), lengths.end(), 0);
+}
+
+void RecordColumnarTrajectory(const Game& game,
+                              const std::vector<TabularPolicy>& policies,
+                              ColumnarBatchedTrajectory* trajectory,
+                              std::mt19937* rng) {
+  SPIEL_CHECK_EQ(trajectory->observation_size,
+                 game.InformationStateTensorSize());
+  SPIEL_CHECK_EQ(trajectory->num_distinct_actions, game.NumDistinctActions());
+  SPIEL_CHECK_EQ(trajectory->num_players, game.NumPlayers());
+  trajectory->Clear();
+  for (int b = 0; b < trajectory->batch_size; ++b) {
+    std::unique_ptr<State> state = game.NewInitialState();
+    int t = 0;
+    while (!state->IsTerminal() && t < trajectory->max_length) {
+      Action action = kInvalidAction;
+      if (state->IsChanceNode()) {
+        action = open_spiel::SampleAction(
+                     state->ChanceOutcomes(),
+                     std::uniform_real_distribution<double>(0.0, 1.0)(*rng))
+                     .first;
+      } else if (state->IsSimultaneousNode()) {
+        open_spiel::SpielFatalError(
+            "We do not support games with simultaneous actions.");
+      } else {
+        // Decision node: write this step straight into the flat buffers.
+        const int step = trajectory->StepOffset(b, t);
+        state->InformationStateTensor(
+            state->CurrentPlayer(),
+            absl::MakeSpan(trajectory->observations)
+                .subspan(static_cast<size_t>(step) *
+                             trajectory->observation_size,
+                         trajectory->observation_size));
+        const size_t row =
+            static_cast<size_t>(step) * trajectory->num_distinct_actions;
+        uint64_t mask = 0;
+        for (Action legal_action : state->LegalActions()) {
+          trajectory->legal_actions[row + legal_action] = 1;
+          if (!trajectory->legal_masks.empty()) {
+            mask |= uint64_t{1} << legal_action;
+          }
+        }
+        if (!trajectory->legal_masks.empty()) {
+          trajectory->legal_masks[step] = mask;
+        }
+        ActionsAndProbs policy =
+            policies.at(state->CurrentPlayer())
+                .GetStatePolicy(state->InformationStateString());
+        for (const std::pair<Action, double>& pair : policy) {
+          trajectory->player_policies[row + pair.first] = pair.second;
+        }
+        trajectory->player_ids[step] = state->CurrentPlayer();
+        trajectory->valid[step] = 1;
+        action = SampleAction(policy, *rng).first;
+        trajectory->actions[step] = action;
+        ++t;
+      }
+      SPIEL_CHECK_NE(action, kInvalidAction);
+      state->ApplyAction(action);
+    }
+    trajectory->lengths[b] = t;
+    if (state->IsTerminal() && t > 0) {
+      trajectory->next_is_terminal[trajectory->StepOffset(b, t - 1)] = 1;
+    }
+    const std::vector<double> returns = state->Returns();
+    for (int p = 0; p < trajectory->num_players; ++p) {
+      trajectory->rewards[b * trajectory->num_players + p] = returns[p];
+    }
+  }
+}
+
 BatchedTrajectory RecordTrajectory(
     const Game& game, const std::vector<TabularPolicy>& policies,
     const std::unordered_map<std::string, int>& state_to_index,
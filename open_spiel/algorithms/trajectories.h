@@ -107,6 +107,65 @@ BatchedTrajectory RecordBatchedTrajectory(
     const std::unordered_map<std::string, int>& state_to_index, int batch_size,
     bool include_full_observations, int seed, int max_unroll_length = -1);
 
+// Columnar counterpart of BatchedTrajectory: every per-step field lives in a
+// single contiguous buffer, batch-major with a fixed time stride of
+// max_length, so step t of episode b starts at offset (b * max_length + t)
+// times the field width. All buffers are allocated once in the constructor
+// and Clear() only zeroes them in place, so a data-generation loop that
+// reuses one instance across batches does no per-step allocations.
+struct ColumnarBatchedTrajectory {
+  ColumnarBatchedTrajectory(int batch_size, int max_length,
+                            int observation_size, int num_distinct_actions,
+                            int num_players);
+
+  // Zeroes all buffers without changing their sizes (or capacities) so the
+  // instance can be refilled by another recording pass.
+  void Clear();
+
+  // Offset of step t of episode b in the per-step scalar buffers. Multiply
+  // by observation_size or num_distinct_actions for the tensor buffers.
+  int StepOffset(int b, int t) const { return b * max_length + t; }
+
+  int batch_size;
+  int max_length;
+  int observation_size;
+  int num_distinct_actions;
+  int num_players;
+
+  // [B * T * observation_size]: InformationStateTensor of the acting player.
+  std::vector<float> observations;
+  // [B * T * num_distinct_actions]: 0/1 legal-action masks.
+  std::vector<int> legal_actions;
+  // [B * T]: the same legal-action masks packed into one uint64_t per step
+  // (bit `a` set iff action `a` is legal). Only filled for games with at
+  // most 64 distinct actions (e.g. Durak's 39) and left empty otherwise;
+  // consumers that can mask with bit operations read this instead of the
+  // wide `legal_actions` rows.
+  std::vector<uint64_t> legal_masks;
+  // [B * T * num_distinct_actions]: dense policy of the acting player.
+  std::vector<double> player_policies;
+  // Per-step scalars, each [B * T].
+  std::vector<Action> actions;
+  std::vector<int> player_ids;
+  std::vector<int> valid;
+  std::vector<int> next_is_terminal;
+  // [B * num_players]: terminal returns of each episode.
+  std::vector<double> rewards;
+  // [B]: number of recorded steps per episode.
+  std::vector<int> lengths;
+};
+
+// Records trajectory->batch_size episodes into the preallocated buffers of
+// `trajectory` (after clearing it). Episodes with more than
+// trajectory->max_length decision nodes are truncated. Each step is written
+// straight into the flat buffers; the remaining steady-state allocations are
+// the small temporaries made by the State and Policy APIs (LegalActions,
+// ChanceOutcomes, GetStatePolicy, Returns).
+void RecordColumnarTrajectory(const Game& game,
+                              const std::vector<TabularPolicy>& policies,
+                              ColumnarBatchedTrajectory* trajectory,
+                              std::mt19937* rng_ptr);
+
 // Stateful version of RecordTrajectory. There are several optimisations that
 // this allows. Currently, the only optimisation is preventing making multiple
 // copies of the state_to_index class. When state_to_index.empty() is false,
@@ -253,6 +253,48 @@ void BatchedTrajectoryResizesCorrectly(const std::string& game_name) {
   }
 }
 
+void ColumnarTrajectoryIsCorrectAndReusesBuffers(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  std::vector<TabularPolicy> policies(2, GetUniformPolicy(*game));
+  std::mt19937 rng;
+  ColumnarBatchedTrajectory trajectory(
+      kBatchSize, game->MaxGameLength(), game->InformationStateTensorSize(),
+      game->NumDistinctActions(), game->NumPlayers());
+  const float* observations_data = trajectory.observations.data();
+  RecordColumnarTrajectory(*game, policies, &trajectory, &rng);
+  for (int b = 0; b < trajectory.batch_size; ++b) {
+    const int length = trajectory.lengths[b];
+    SPIEL_CHECK_GT(length, 0);
+    std::unique_ptr<open_spiel::State> state = game->NewInitialState();
+    for (int t = 0; t < length; ++t) {
+      while (state->IsChanceNode()) {
+        state->ApplyAction(state->LegalActions()[0]);
+      }
+      const int step = trajectory.StepOffset(b, t);
+      SPIEL_CHECK_EQ(trajectory.valid[step], 1);
+      if (!state->IsTerminal() && !state->IsChanceNode()) {
+        SPIEL_CHECK_EQ(trajectory.player_ids[step], state->CurrentPlayer());
+        const std::vector<int> mask = state->LegalActionsMask();
+        for (int a = 0; a < game->NumDistinctActions(); ++a) {
+          SPIEL_CHECK_EQ(
+              trajectory.legal_actions[step * game->NumDistinctActions() + a],
+              mask[a]);
+        }
+      }
+      state->ApplyAction(trajectory.actions[step]);
+      SPIEL_CHECK_EQ(state->IsTerminal(),
+                     trajectory.next_is_terminal[step] == 1);
+    }
+    // Everything past the recorded length is padding.
+    for (int t = length; t < trajectory.max_length; ++t) {
+      SPIEL_CHECK_EQ(trajectory.valid[trajectory.StepOffset(b, t)], 0);
+    }
+  }
+  // Recording another batch into the same instance must not reallocate.
+  RecordColumnarTrajectory(*game, policies, &trajectory, &rng);
+  SPIEL_CHECK_EQ(trajectory.observations.data(), observations_data);
+}
+
 }  // namespace
 }  // namespace algorithms
 }  // namespace open_spiel
@@ -276,5 +318,6 @@ int main() {
     alg::RecordBatchedTrajectoryPlayerIdsIsCorrect(game_name);
     alg::RecordBatchedTrajectoryNextIsTerminalIsCorrect(game_name);
     alg::BatchedTrajectoryResizesCorrectly(game_name);
+    alg::ColumnarTrajectoryIsCorrectAndReusesBuffers(game_name);
   }
 }
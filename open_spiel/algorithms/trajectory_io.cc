@@ -0,0 +1,334 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/trajectory_io.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <utility>
+
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// File layout:
+//   FileHeader
+//   chunks: ChunkHeader followed by compressed_size bytes each
+//   index: num_chunks IndexEntry records
+//   Trailer
+// The reader finds the index through the fixed-size trailer at the end of
+// the file.
+struct FileHeader {
+  uint64_t magic;
+  int32_t observation_size;
+  int32_t num_distinct_actions;
+  int32_t num_players;
+  int32_t codec;
+};
+
+struct ChunkHeader {
+  int32_t batch_size;
+  int32_t max_length;
+  int64_t raw_size;
+  int64_t compressed_size;
+};
+
+struct Trailer {
+  int64_t index_offset;
+  int64_t num_chunks;
+  uint64_t magic;
+};
+
+constexpr uint64_t kTrajectoryMagic = 0x4f53'5452'414a'3031ULL;  // "OSTRAJ01"
+constexpr int32_t kCodecZeroRle = 1;
+
+// Zero runs shorter than this are cheaper to keep as literals than to
+// encode as a literal-length/run-length varint pair.
+constexpr int64_t kMinZeroRun = 8;
+
+template <typename T>
+absl::string_view StructBytes(const T& value) {
+  return absl::string_view(reinterpret_cast<const char*>(&value),
+                           sizeof(value));
+}
+
+// The flat buffers of a trajectory, in their fixed serialization order.
+std::vector<std::pair<const char*, size_t>> TrajectoryRegions(
+    const ColumnarBatchedTrajectory& t) {
+  auto region = [](const auto& v) {
+    return std::make_pair(reinterpret_cast<const char*>(v.data()),
+                          v.size() * sizeof(v[0]));
+  };
+  return {region(t.observations),     region(t.legal_actions),
+          region(t.player_policies),  region(t.actions),
+          region(t.player_ids),       region(t.valid),
+          region(t.next_is_terminal), region(t.rewards),
+          region(t.lengths)};
+}
+
+// Writes a decompressed byte stream across the (non-contiguous) flat
+// buffers of a trajectory, in the same order the writer serialized them.
+class RegionSink {
+ public:
+  explicit RegionSink(ColumnarBatchedTrajectory* t) {
+    for (const std::pair<const char*, size_t>& region :
+         TrajectoryRegions(*t)) {
+      regions_.emplace_back(const_cast<char*>(region.first), region.second);
+    }
+  }
+
+  void WriteBytes(const char* src, size_t n) { Fill(src, n); }
+  void WriteZeros(size_t n) { Fill(nullptr, n); }
+
+ private:
+  void Fill(const char* src, size_t n) {
+    while (n > 0) {
+      SPIEL_CHECK_LT(region_, regions_.size());
+      char* dst = regions_[region_].first + offset_;
+      const size_t available = regions_[region_].second - offset_;
+      const size_t take = std::min(available, n);
+      if (src != nullptr) {
+        std::memcpy(dst, src, take);
+        src += take;
+      } else {
+        std::memset(dst, 0, take);
+      }
+      offset_ += take;
+      n -= take;
+      if (offset_ == regions_[region_].second) {
+        ++region_;
+        offset_ = 0;
+      }
+    }
+  }
+
+  std::vector<std::pair<char*, size_t>> regions_;
+  size_t region_ = 0;
+  size_t offset_ = 0;
+};
+
+void AppendVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+uint64_t ReadVarint(const char** p, const char* end) {
+  uint64_t value = 0;
+  int shift = 0;
+  for (;;) {
+    SPIEL_CHECK_TRUE(*p < end);
+    const uint8_t byte = static_cast<uint8_t>(*(*p)++);
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) return value;
+    shift += 7;
+  }
+}
+
+// Encodes `raw` as alternating (literal-length, literal bytes, zero-run
+// length) records.
+std::string ZeroRleCompress(const std::string& raw) {
+  std::string out;
+  const size_t n = raw.size();
+  size_t i = 0;
+  while (i < n) {
+    // Find the start of the next zero run worth encoding (or the end).
+    size_t literal_end = i;
+    while (literal_end < n) {
+      if (raw[literal_end] != 0) {
+        ++literal_end;
+        continue;
+      }
+      size_t run_end = literal_end;
+      while (run_end < n && raw[run_end] == 0) ++run_end;
+      if (run_end - literal_end >= kMinZeroRun) break;
+      literal_end = run_end;
+    }
+    size_t run_end = literal_end;
+    while (run_end < n && raw[run_end] == 0) ++run_end;
+    AppendVarint(literal_end - i, &out);
+    out.append(raw, i, literal_end - i);
+    AppendVarint(run_end - literal_end, &out);
+    i = run_end;
+  }
+  return out;
+}
+
+void ZeroRleDecompress(const char* src, int64_t compressed_size,
+                       int64_t raw_size, RegionSink* sink) {
+  const char* p = src;
+  const char* end = src + compressed_size;
+  int64_t produced = 0;
+  while (produced < raw_size) {
+    const uint64_t literal = ReadVarint(&p, end);
+    SPIEL_CHECK_LE(literal, static_cast<uint64_t>(end - p));
+    sink->WriteBytes(p, literal);
+    p += literal;
+    const uint64_t zeros = ReadVarint(&p, end);
+    sink->WriteZeros(zeros);
+    produced += literal + zeros;
+  }
+  SPIEL_CHECK_EQ(produced, raw_size);
+  SPIEL_CHECK_TRUE(p == end);
+}
+
+}  // namespace
+
+TrajectoryChunkWriter::TrajectoryChunkWriter(const std::string& filename,
+                                             int observation_size,
+                                             int num_distinct_actions,
+                                             int num_players,
+                                             int max_queued_chunks)
+    : observation_size_(observation_size),
+      num_distinct_actions_(num_distinct_actions),
+      num_players_(num_players),
+      fd_(filename, "wb"),
+      queue_(max_queued_chunks) {
+  SPIEL_CHECK_GT(observation_size_, 0);
+  SPIEL_CHECK_GT(num_distinct_actions_, 0);
+  SPIEL_CHECK_GT(num_players_, 0);
+  SPIEL_CHECK_GT(max_queued_chunks, 0);
+  FileHeader header = {kTrajectoryMagic, observation_size_,
+                       num_distinct_actions_, num_players_, kCodecZeroRle};
+  SPIEL_CHECK_TRUE(fd_.Write(StructBytes(header)));
+  writer_thread_.emplace([this]() { WriterLoop(); });
+}
+
+TrajectoryChunkWriter::~TrajectoryChunkWriter() {
+  queue_.Push(nullptr);  // Shutdown sentinel; drains everything before it.
+  writer_thread_->join();
+  Trailer trailer;
+  trailer.index_offset = fd_.Tell();
+  trailer.num_chunks = static_cast<int64_t>(index_.size());
+  trailer.magic = kTrajectoryMagic;
+  for (const IndexEntry& entry : index_) {
+    SPIEL_CHECK_TRUE(fd_.Write(StructBytes(entry)));
+  }
+  SPIEL_CHECK_TRUE(fd_.Write(StructBytes(trailer)));
+}
+
+void TrajectoryChunkWriter::Write(const ColumnarBatchedTrajectory& trajectory) {
+  SPIEL_CHECK_EQ(trajectory.observation_size, observation_size_);
+  SPIEL_CHECK_EQ(trajectory.num_distinct_actions, num_distinct_actions_);
+  SPIEL_CHECK_EQ(trajectory.num_players, num_players_);
+  auto chunk = std::make_shared<PendingChunk>();
+  chunk->batch_size = trajectory.batch_size;
+  chunk->max_length = trajectory.max_length;
+  size_t raw_size = 0;
+  const std::vector<std::pair<const char*, size_t>> regions =
+      TrajectoryRegions(trajectory);
+  for (const std::pair<const char*, size_t>& region : regions) {
+    raw_size += region.second;
+  }
+  chunk->raw.reserve(raw_size);
+  for (const std::pair<const char*, size_t>& region : regions) {
+    chunk->raw.append(region.first, region.second);
+  }
+  num_enqueued_.fetch_add(1);
+  SPIEL_CHECK_TRUE(queue_.Push(chunk));
+}
+
+void TrajectoryChunkWriter::Flush() {
+  const int64_t target = num_enqueued_.load();
+  while (num_written_.load() < target) std::this_thread::yield();
+  fd_.Flush();
+}
+
+void TrajectoryChunkWriter::WriterLoop() {
+  for (;;) {
+    absl::optional<std::shared_ptr<PendingChunk>> item = queue_.Pop();
+    if (!item.has_value() || *item == nullptr) return;
+    const PendingChunk& chunk = **item;
+    const std::string compressed = ZeroRleCompress(chunk.raw);
+    ChunkHeader header;
+    header.batch_size = chunk.batch_size;
+    header.max_length = chunk.max_length;
+    header.raw_size = static_cast<int64_t>(chunk.raw.size());
+    header.compressed_size = static_cast<int64_t>(compressed.size());
+    index_.push_back({fd_.Tell(), chunk.batch_size, chunk.max_length});
+    SPIEL_CHECK_TRUE(fd_.Write(StructBytes(header)));
+    SPIEL_CHECK_TRUE(fd_.Write(compressed));
+    num_written_.fetch_add(1);
+  }
+}
+
+int TrajectoryChunkReader::chunk_batch_size(int64_t chunk) const {
+  SPIEL_CHECK_GE(chunk, 0);
+  SPIEL_CHECK_LT(chunk, num_chunks());
+  return index_[chunk].batch_size;
+}
+
+int TrajectoryChunkReader::chunk_max_length(int64_t chunk) const {
+  SPIEL_CHECK_GE(chunk, 0);
+  SPIEL_CHECK_LT(chunk, num_chunks());
+  return index_[chunk].max_length;
+}
+
+TrajectoryChunkReader::TrajectoryChunkReader(const std::string& filename)
+    : mapping_(filename) {
+  SPIEL_CHECK_GE(mapping_.size(),
+                 static_cast<int64_t>(sizeof(FileHeader) + sizeof(Trailer)));
+  const char* data = mapping_.data();
+
+  FileHeader header;
+  std::memcpy(&header, data, sizeof(header));
+  SPIEL_CHECK_EQ(header.magic, kTrajectoryMagic);
+  SPIEL_CHECK_EQ(header.codec, kCodecZeroRle);
+  observation_size_ = header.observation_size;
+  num_distinct_actions_ = header.num_distinct_actions;
+  num_players_ = header.num_players;
+
+  Trailer trailer;
+  std::memcpy(&trailer, data + mapping_.size() - sizeof(trailer),
+              sizeof(trailer));
+  SPIEL_CHECK_EQ(trailer.magic, kTrajectoryMagic);
+  SPIEL_CHECK_GE(trailer.num_chunks, 0);
+  SPIEL_CHECK_EQ(trailer.index_offset +
+                     trailer.num_chunks *
+                         static_cast<int64_t>(sizeof(IndexEntry)) +
+                     static_cast<int64_t>(sizeof(Trailer)),
+                 mapping_.size());
+  index_.resize(trailer.num_chunks);
+  std::memcpy(index_.data(), data + trailer.index_offset,
+              trailer.num_chunks * sizeof(IndexEntry));
+}
+
+void TrajectoryChunkReader::ReadChunk(
+    int64_t chunk, ColumnarBatchedTrajectory* trajectory) const {
+  SPIEL_CHECK_GE(chunk, 0);
+  SPIEL_CHECK_LT(chunk, num_chunks());
+  const IndexEntry& entry = index_[chunk];
+  ChunkHeader header;
+  std::memcpy(&header, mapping_.data() + entry.offset, sizeof(header));
+  SPIEL_CHECK_EQ(trajectory->batch_size, header.batch_size);
+  SPIEL_CHECK_EQ(trajectory->max_length, header.max_length);
+  SPIEL_CHECK_EQ(trajectory->observation_size, observation_size_);
+  SPIEL_CHECK_EQ(trajectory->num_distinct_actions, num_distinct_actions_);
+  SPIEL_CHECK_EQ(trajectory->num_players, num_players_);
+  SPIEL_CHECK_LE(entry.offset + static_cast<int64_t>(sizeof(header)) +
+                     header.compressed_size,
+                 mapping_.size());
+  RegionSink sink(trajectory);
+  ZeroRleDecompress(mapping_.data() + entry.offset + sizeof(header),
+                    header.compressed_size, header.raw_size, &sink);
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
@@ -0,0 +1,142 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_TRAJECTORY_IO_H_
+#define OPEN_SPIEL_ALGORITHMS_TRAJECTORY_IO_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/algorithms/trajectories.h"
+#include "open_spiel/utils/file.h"
+#include "open_spiel/utils/thread.h"
+#include "open_spiel/utils/threaded_queue.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// A chunked on-disk format for ColumnarBatchedTrajectory batches, built for
+// high-volume self-play pipelines. Each Write() serializes one batch (a
+// cheap flat-buffer copy on the calling thread) and hands it to a background
+// thread that compresses it and appends it to the file as one chunk, so
+// recording threads never block on disk or compression. An index of chunk
+// offsets and shapes is written as a footer when the writer is closed, which
+// lets a reader seek straight to any chunk.
+//
+// Chunks are compressed with a zero-run-length codec: columnar batches are
+// mostly zeros (padding past each episode's length, sparse legal-action
+// masks and policies), so runs of zero bytes dominate. The chunk header
+// carries a codec id, so a general-purpose codec such as LZ4 can be slotted
+// in later without a format change once the dependency is available.
+//
+// The byte layout is host-endian, like the other binary stores in this
+// directory: files are not portable across endianness.
+class TrajectoryChunkWriter {
+ public:
+  // Creates (truncates) `filename`. The tensor sizes are fixed per file and
+  // checked against every written batch. Write() blocks only when
+  // `max_queued_chunks` serialized batches are already waiting for the
+  // background thread.
+  TrajectoryChunkWriter(const std::string& filename, int observation_size,
+                        int num_distinct_actions, int num_players,
+                        int max_queued_chunks = 16);
+
+  // Drains the queue, writes the index footer and closes the file.
+  ~TrajectoryChunkWriter();
+
+  TrajectoryChunkWriter(const TrajectoryChunkWriter&) = delete;
+  TrajectoryChunkWriter& operator=(const TrajectoryChunkWriter&) = delete;
+
+  // Serializes the batch and enqueues it for the background thread.
+  void Write(const ColumnarBatchedTrajectory& trajectory);
+
+  // Blocks until every batch queued so far has been written to disk.
+  void Flush();
+
+  // Number of chunks written to disk so far.
+  int64_t num_chunks_written() const { return num_written_.load(); }
+
+ private:
+  struct PendingChunk {
+    int32_t batch_size;
+    int32_t max_length;
+    std::string raw;  // Concatenated flat buffers, uncompressed.
+  };
+  struct IndexEntry {
+    int64_t offset;
+    int32_t batch_size;
+    int32_t max_length;
+  };
+
+  void WriterLoop();
+
+  const int32_t observation_size_;
+  const int32_t num_distinct_actions_;
+  const int32_t num_players_;
+  file::File fd_;
+  // shared_ptr because ThreadedQueue copies its elements; nullptr is the
+  // shutdown sentinel.
+  ThreadedQueue<std::shared_ptr<PendingChunk>> queue_;
+  std::atomic<int64_t> num_enqueued_{0};
+  std::atomic<int64_t> num_written_{0};
+  std::vector<IndexEntry> index_;  // Only touched by the writer thread.
+  absl::optional<Thread> writer_thread_;
+};
+
+// Reader for files produced by TrajectoryChunkWriter. The whole file is
+// mapped read-only through file::MappedFile, so opening is O(1), chunks are
+// faulted in on demand by the page cache, and many training processes can
+// share one copy of the (compressed) data.
+class TrajectoryChunkReader {
+ public:
+  explicit TrajectoryChunkReader(const std::string& filename);
+
+  TrajectoryChunkReader(const TrajectoryChunkReader&) = delete;
+  TrajectoryChunkReader& operator=(const TrajectoryChunkReader&) = delete;
+
+  int64_t num_chunks() const { return static_cast<int64_t>(index_.size()); }
+  int observation_size() const { return observation_size_; }
+  int num_distinct_actions() const { return num_distinct_actions_; }
+  int num_players() const { return num_players_; }
+  int chunk_batch_size(int64_t chunk) const;
+  int chunk_max_length(int64_t chunk) const;
+
+  // Decompresses chunk `chunk` into `trajectory`, whose shape must match
+  // the chunk (construct it from chunk_batch_size/chunk_max_length and the
+  // file's tensor sizes). Reusing one trajectory across calls makes reading
+  // allocation-free.
+  void ReadChunk(int64_t chunk, ColumnarBatchedTrajectory* trajectory) const;
+
+ private:
+  struct IndexEntry {
+    int64_t offset;
+    int32_t batch_size;
+    int32_t max_length;
+  };
+
+  int32_t observation_size_ = 0;
+  int32_t num_distinct_actions_ = 0;
+  int32_t num_players_ = 0;
+  std::vector<IndexEntry> index_;
+  file::MappedFile mapping_;
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_TRAJECTORY_IO_H_
@@ -0,0 +1,96 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/trajectory_io.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open_spiel/algorithms/trajectories.h"
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+constexpr int kBatchSize = 8;
+constexpr int kNumChunks = 3;
+
+void TestWriteReadRoundTrip() {
+  const std::string filename =
+      file::GetTmpDir() + "/trajectory_io_test.bin";
+  if (file::Exists(filename)) file::Remove(filename);
+
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  std::vector<TabularPolicy> policies(2, GetUniformPolicy(*game));
+  std::mt19937 rng(1234);
+
+  // Record a few batches and stream them to disk.
+  std::vector<ColumnarBatchedTrajectory> batches;
+  {
+    TrajectoryChunkWriter writer(filename, game->InformationStateTensorSize(),
+                                 game->NumDistinctActions(),
+                                 game->NumPlayers());
+    for (int i = 0; i < kNumChunks; ++i) {
+      ColumnarBatchedTrajectory batch(
+          kBatchSize, game->MaxGameLength(), game->InformationStateTensorSize(),
+          game->NumDistinctActions(), game->NumPlayers());
+      RecordColumnarTrajectory(*game, policies, &batch, &rng);
+      writer.Write(batch);
+      batches.push_back(batch);
+    }
+    writer.Flush();
+    SPIEL_CHECK_EQ(writer.num_chunks_written(), kNumChunks);
+  }  // Destructor writes the index footer.
+
+  TrajectoryChunkReader reader(filename);
+  SPIEL_CHECK_EQ(reader.num_chunks(), kNumChunks);
+  SPIEL_CHECK_EQ(reader.observation_size(),
+                 game->InformationStateTensorSize());
+  SPIEL_CHECK_EQ(reader.num_distinct_actions(), game->NumDistinctActions());
+  SPIEL_CHECK_EQ(reader.num_players(), game->NumPlayers());
+
+  // One reused trajectory: reads after the first are allocation-free.
+  ColumnarBatchedTrajectory decoded(
+      kBatchSize, game->MaxGameLength(), game->InformationStateTensorSize(),
+      game->NumDistinctActions(), game->NumPlayers());
+  for (int i = 0; i < kNumChunks; ++i) {
+    SPIEL_CHECK_EQ(reader.chunk_batch_size(i), kBatchSize);
+    SPIEL_CHECK_EQ(reader.chunk_max_length(i), game->MaxGameLength());
+    reader.ReadChunk(i, &decoded);
+    SPIEL_CHECK_TRUE(decoded.observations == batches[i].observations);
+    SPIEL_CHECK_TRUE(decoded.legal_actions == batches[i].legal_actions);
+    SPIEL_CHECK_TRUE(decoded.player_policies == batches[i].player_policies);
+    SPIEL_CHECK_TRUE(decoded.actions == batches[i].actions);
+    SPIEL_CHECK_TRUE(decoded.player_ids == batches[i].player_ids);
+    SPIEL_CHECK_TRUE(decoded.valid == batches[i].valid);
+    SPIEL_CHECK_TRUE(decoded.next_is_terminal == batches[i].next_is_terminal);
+    SPIEL_CHECK_TRUE(decoded.rewards == batches[i].rewards);
+    SPIEL_CHECK_TRUE(decoded.lengths == batches[i].lengths);
+  }
+
+  file::Remove(filename);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::TestWriteReadRoundTrip();
+}
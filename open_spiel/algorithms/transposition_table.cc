@@ -0,0 +1,67 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/transposition_table.h"
+
+#include <string>
+#include <utility>
+
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+uint64_t TranspositionTable::KeyFor(const State& state) {
+  return absl::Hash<std::pair<Player, std::string>>()(
+      {state.CurrentPlayer(), state.ToString()});
+}
+
+bool TranspositionTable::Lookup(uint64_t key, Entry* entry) const {
+  const Shard& shard = shards_[key % kNumShards];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto iter = shard.map.find(key);
+  if (iter == shard.map.end()) return false;
+  *entry = iter->second;
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void TranspositionTable::Store(uint64_t key, Entry entry) {
+  Shard& shard = shards_[key % kNumShards];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto [iter, inserted] = shard.map.try_emplace(key, std::move(entry));
+  if (!inserted && entry.depth >= iter->second.depth) {
+    iter->second = std::move(entry);
+  }
+}
+
+void TranspositionTable::Clear() {
+  for (Shard& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.map.clear();
+  }
+  hits_.store(0, std::memory_order_relaxed);
+}
+
+size_t TranspositionTable::NumEntries() const {
+  size_t total = 0;
+  for (const Shard& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    total += shard.map.size();
+  }
+  return total;
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
@@ -0,0 +1,104 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_TRANSPOSITION_TABLE_H_
+#define OPEN_SPIEL_ALGORITHMS_TRANSPOSITION_TABLE_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/spiel.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// A thread-safe transposition table for the search routines in minimax.h and
+// maxn.h, so that repeated subgame evaluations - e.g. near-identical endgame
+// positions showing up across PIMC determinizations - are computed once.
+//
+// Positions are keyed by the 64-bit hash of (current player, State::ToString),
+// which identifies the full determinized state (for card games, the public
+// state plus the hand assignment). A hash collision silently returns the
+// other position's entry; at the table sizes one decision's searches build,
+// the chance of that is negligible.
+//
+// Entries record the depth they were computed to, and lookups only reuse
+// entries at least as deep as the request. With a depth-limited value
+// function this means a cached result can come from deeper lookahead than
+// the uncached search would have used.
+//
+// The table is sharded: each shard holds its own map behind its own mutex,
+// so concurrent searches (e.g. parallel PIMC determinizations) mostly touch
+// different shards.
+class TranspositionTable {
+ public:
+  enum Bound : uint8_t {
+    kExact = 0,
+    kLowerBound = 1,  // The true value is >= value (beta cut-off).
+    kUpperBound = 2,  // The true value is <= value (failed low).
+  };
+
+  struct Entry {
+    int depth = 0;
+    Bound bound = kExact;
+    // Two-player alpha-beta stores the value for the maximizing player here;
+    // max^n stores the per-player value vector below (and is always exact).
+    double value = 0;
+    std::vector<double> values;
+  };
+
+  TranspositionTable() = default;
+
+  // Not copyable (each shard owns a mutex).
+  TranspositionTable(const TranspositionTable&) = delete;
+  TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+  // Returns the table key for a state.
+  static uint64_t KeyFor(const State& state);
+
+  // Copies the entry for key into *entry, returning false if absent.
+  bool Lookup(uint64_t key, Entry* entry) const;
+
+  // Stores the entry, replacing an existing one only if the new entry is at
+  // least as deep.
+  void Store(uint64_t key, Entry entry);
+
+  // Removes all entries and resets the hit counter.
+  void Clear();
+
+  size_t NumEntries() const;
+
+  // Number of successful lookups since construction or the last Clear().
+  int64_t NumHits() const { return hits_.load(std::memory_order_relaxed); }
+
+ private:
+  static constexpr int kNumShards = 64;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    absl::flat_hash_map<uint64_t, Entry> map;
+  };
+
+  std::array<Shard, kNumShards> shards_;
+  mutable std::atomic<int64_t> hits_{0};
+};
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_TRANSPOSITION_TABLE_H_
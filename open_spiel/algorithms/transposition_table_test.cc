@@ -0,0 +1,130 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/transposition_table.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/algorithms/maxn.h"
+#include "open_spiel/algorithms/minimax.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+void StoreLookupTest() {
+  TranspositionTable table;
+  uint64_t key = 12345;
+
+  TranspositionTable::Entry entry;
+  SPIEL_CHECK_FALSE(table.Lookup(key, &entry));
+  SPIEL_CHECK_EQ(table.NumHits(), 0);  // Misses do not count as hits.
+
+  table.Store(key, {/*depth=*/3, TranspositionTable::kExact, 0.5, {}});
+  SPIEL_CHECK_TRUE(table.Lookup(key, &entry));
+  SPIEL_CHECK_EQ(entry.depth, 3);
+  SPIEL_CHECK_EQ(entry.bound, TranspositionTable::kExact);
+  SPIEL_CHECK_EQ(entry.value, 0.5);
+  SPIEL_CHECK_EQ(table.NumEntries(), 1);
+  SPIEL_CHECK_EQ(table.NumHits(), 1);
+
+  // A shallower entry must not replace a deeper one.
+  table.Store(key, {/*depth=*/1, TranspositionTable::kExact, -1.0, {}});
+  SPIEL_CHECK_TRUE(table.Lookup(key, &entry));
+  SPIEL_CHECK_EQ(entry.depth, 3);
+  SPIEL_CHECK_EQ(entry.value, 0.5);
+
+  // A deeper entry replaces it.
+  table.Store(key, {/*depth=*/5, TranspositionTable::kLowerBound, 1.0, {}});
+  SPIEL_CHECK_TRUE(table.Lookup(key, &entry));
+  SPIEL_CHECK_EQ(entry.depth, 5);
+  SPIEL_CHECK_EQ(entry.bound, TranspositionTable::kLowerBound);
+  SPIEL_CHECK_EQ(entry.value, 1.0);
+
+  SPIEL_CHECK_EQ(table.NumHits(), 3);
+
+  table.Clear();
+  SPIEL_CHECK_EQ(table.NumEntries(), 0);
+  SPIEL_CHECK_EQ(table.NumHits(), 0);
+  SPIEL_CHECK_FALSE(table.Lookup(key, &entry));
+}
+
+void KeyForDistinguishesStatesTest() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state_a = game->NewInitialState();
+  std::unique_ptr<State> state_b = game->NewInitialState();
+  state_b->ApplyAction(4);
+
+  SPIEL_CHECK_EQ(TranspositionTable::KeyFor(*state_a),
+                 TranspositionTable::KeyFor(*state_a->Clone()));
+  SPIEL_CHECK_NE(TranspositionTable::KeyFor(*state_a),
+                 TranspositionTable::KeyFor(*state_b));
+}
+
+// Full-depth searches with and without the table must agree: every cached
+// value is exact, so the table can only change how often subtrees are walked.
+void AlphaBetaWithTableMatchesWithoutTest() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  state->ApplyAction(4);
+  state->ApplyAction(1);
+
+  TranspositionTable table;
+  std::pair<double, Action> without =
+      AlphaBetaSearch(*game, state.get(), {}, -1, kInvalidPlayer);
+  std::pair<double, Action> with =
+      AlphaBetaSearch(*game, state.get(), {}, -1, kInvalidPlayer,
+                      /*use_undo=*/true, &table);
+  SPIEL_CHECK_EQ(without.first, with.first);
+  SPIEL_CHECK_EQ(without.second, with.second);
+  SPIEL_CHECK_GT(table.NumEntries(), 0);
+
+  // A second search over the now-populated table agrees too.
+  std::pair<double, Action> again =
+      AlphaBetaSearch(*game, state.get(), {}, -1, kInvalidPlayer,
+                      /*use_undo=*/true, &table);
+  SPIEL_CHECK_EQ(without.first, again.first);
+  SPIEL_CHECK_EQ(without.second, again.second);
+}
+
+void MaxNWithTableMatchesWithoutTest() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> state = game->NewInitialState();
+  state->ApplyAction(4);
+  state->ApplyAction(1);
+
+  TranspositionTable table;
+  std::pair<std::vector<double>, Action> without =
+      MaxNSearch(*game, state.get(), {}, game->MaxGameLength());
+  std::pair<std::vector<double>, Action> with =
+      MaxNSearch(*game, state.get(), {}, game->MaxGameLength(), &table);
+  SPIEL_CHECK_TRUE(without.first == with.first);
+  SPIEL_CHECK_EQ(without.second, with.second);
+  SPIEL_CHECK_GT(table.NumEntries(), 0);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::StoreLookupTest();
+  open_spiel::algorithms::KeyForDistinguishesStatesTest();
+  open_spiel::algorithms::AlphaBetaWithTableMatchesWithoutTest();
+  open_spiel::algorithms::MaxNWithTableMatchesWithoutTest();
+}
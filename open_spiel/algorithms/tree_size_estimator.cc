@@ -0,0 +1,188 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/tree_size_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/random/distributions.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// Per-probe quantities, indexed as below. Each probe produces one unbiased
+// sample of each; the estimator keeps their running sums and sums of
+// squares for the mean and its standard error.
+enum Metric {
+  kHistories = 0,
+  kDecisionNodes = 1,
+  kChanceNodes = 2,
+  kTerminals = 3,
+  kInfostates = 4,
+  kNumMetrics = 5,
+};
+
+struct ProbeSums {
+  double sum[kNumMetrics] = {0};
+  double sum_sq[kNumMetrics] = {0};
+
+  void Add(const double probe[kNumMetrics]) {
+    for (int m = 0; m < kNumMetrics; ++m) {
+      sum[m] += probe[m];
+      sum_sq[m] += probe[m] * probe[m];
+    }
+  }
+  void Merge(const ProbeSums& other) {
+    for (int m = 0; m < kNumMetrics; ++m) {
+      sum[m] += other.sum[m];
+      sum_sq[m] += other.sum_sq[m];
+    }
+  }
+};
+
+// One random descent. The weight carried down is the reciprocal of the
+// probability of reaching the current node, so adding it to a metric's
+// accumulator contributes an unbiased count of such nodes.
+void RunProbe(
+    const Game& game,
+    const std::function<double(const State&)>& histories_per_infostate,
+    std::mt19937* rng, double probe[kNumMetrics]) {
+  for (int m = 0; m < kNumMetrics; ++m) probe[m] = 0;
+  std::unique_ptr<State> state = game.NewInitialState();
+  double weight = 1;
+  while (true) {
+    probe[kHistories] += weight;
+    if (state->IsTerminal()) {
+      probe[kTerminals] += weight;
+      return;
+    }
+    if (state->IsChanceNode()) {
+      probe[kChanceNodes] += weight;
+      // Successors are chosen uniformly regardless of their chance
+      // probabilities: the estimator counts nodes, not measure.
+      ActionsAndProbs outcomes = state->ChanceOutcomes();
+      const int branching = outcomes.size();
+      SPIEL_CHECK_GT(branching, 0);
+      weight *= branching;
+      state->ApplyAction(
+          outcomes[absl::Uniform<int>(*rng, 0, branching)].first);
+      continue;
+    }
+    probe[kDecisionNodes] += weight;
+    // A decision node contributes a full unit to its player's infostate
+    // count only when it is that infostate's sole history; in general it
+    // contributes 1/|histories in the infostate| so that the infostate is
+    // counted exactly once in total.
+    probe[kInfostates] +=
+        histories_per_infostate
+            ? weight / histories_per_infostate(*state)
+            : weight;
+    std::vector<Action> legal_actions = state->LegalActions();
+    const int branching = legal_actions.size();
+    SPIEL_CHECK_GT(branching, 0);
+    weight *= branching;
+    state->ApplyAction(legal_actions[absl::Uniform<int>(*rng, 0, branching)]);
+  }
+}
+
+TreeSizeEstimate MakeEstimate(double sum, double sum_sq, int n) {
+  TreeSizeEstimate estimate;
+  estimate.estimate = sum / n;
+  if (n > 1) {
+    // Sample variance of the probes; the mean's variance is 1/n of it.
+    const double variance =
+        std::max(0.0, (sum_sq - sum * sum / n) / (n - 1));
+    estimate.std_error = std::sqrt(variance / n);
+  }
+  return estimate;
+}
+
+}  // namespace
+
+std::string TreeSizeEstimate::ToString() const {
+  return absl::StrFormat("%.3g (95%% ci [%.3g, %.3g])", estimate,
+                         Ci95Lower(), Ci95Upper());
+}
+
+std::string TreeSizeEstimates::ToString() const {
+  return absl::StrCat(
+      "histories: ", histories.ToString(),
+      "\ndecision nodes: ", decision_nodes.ToString(),
+      "\nchance nodes: ", chance_nodes.ToString(),
+      "\nterminals: ", terminals.ToString(),
+      "\ninfostates: ", infostates.ToString(),
+      "\nprobes: ", num_probes);
+}
+
+TreeSizeEstimates EstimateTreeSize(
+    const Game& game, int num_probes, int seed, int num_threads,
+    std::function<double(const State&)> histories_per_infostate) {
+  SPIEL_CHECK_GT(num_probes, 0);
+  SPIEL_CHECK_GE(num_threads, 1);
+  SPIEL_CHECK_TRUE(game.GetType().dynamics == GameType::Dynamics::kSequential);
+
+  // Probes are independent and each carries its own probe-indexed seed, so
+  // the sampled descents depend on (seed, num_probes) but not on the thread
+  // count; only floating-point summation order varies with it. Per-worker
+  // sums merge in worker order after the join, keeping a given
+  // configuration bit-for-bit reproducible.
+  const int num_workers = std::min(num_threads, num_probes);
+  std::vector<ProbeSums> worker_sums(num_workers);
+  std::vector<Thread> workers;
+  workers.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    workers.emplace_back([&, w]() {
+      double probe[kNumMetrics];
+      for (int p = w; p < num_probes; p += num_workers) {
+        std::mt19937 rng(seed + p);
+        RunProbe(game, histories_per_infostate, &rng, probe);
+        worker_sums[w].Add(probe);
+      }
+    });
+  }
+  for (Thread& worker : workers) worker.join();
+  ProbeSums totals;
+  for (const ProbeSums& local : worker_sums) totals.Merge(local);
+
+  TreeSizeEstimates estimates;
+  estimates.histories =
+      MakeEstimate(totals.sum[kHistories], totals.sum_sq[kHistories],
+                   num_probes);
+  estimates.decision_nodes =
+      MakeEstimate(totals.sum[kDecisionNodes], totals.sum_sq[kDecisionNodes],
+                   num_probes);
+  estimates.chance_nodes =
+      MakeEstimate(totals.sum[kChanceNodes], totals.sum_sq[kChanceNodes],
+                   num_probes);
+  estimates.terminals =
+      MakeEstimate(totals.sum[kTerminals], totals.sum_sq[kTerminals],
+                   num_probes);
+  estimates.infostates =
+      MakeEstimate(totals.sum[kInfostates], totals.sum_sq[kInfostates],
+                   num_probes);
+  estimates.num_probes = num_probes;
+  return estimates;
+}
+
+}  // namespace algorithms
+}  // namespace open_spiel
@@ -0,0 +1,86 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_ALGORITHMS_TREE_SIZE_ESTIMATOR_H_
+#define OPEN_SPIEL_ALGORITHMS_TREE_SIZE_ESTIMATOR_H_
+
+#include <functional>
+#include <string>
+
+#include "open_spiel/spiel.h"
+
+namespace open_spiel {
+namespace algorithms {
+
+// Monte Carlo estimates of game tree sizes, for sizing a run before
+// committing compute to it: where GetAllStates cannot tell a 10^8-state
+// configuration from a 10^11 one without walking to completion, a few
+// thousand random probes answer in seconds.
+//
+// Each probe is one random descent from the root: at a node with b
+// successors one is chosen uniformly and the probe's weight multiplies by
+// b, making the weight at any visited node the reciprocal of the
+// probability of reaching it. Summing the weights of the visited nodes of a
+// kind is therefore an unbiased estimate of how many nodes of that kind the
+// tree contains (Knuth, "Estimating the efficiency of backtrack programs",
+// 1975). Point estimates average independent probes; the confidence
+// intervals use the normal approximation over the sample variance across
+// probes. The price of the speed is variance: deep trees whose branching
+// differs a lot between subtrees need more probes for tight intervals, and
+// an interval spanning an order of magnitude is itself the answer that more
+// probes are needed.
+
+// One estimated quantity with its uncertainty across probes.
+struct TreeSizeEstimate {
+  double estimate = 0;
+  double std_error = 0;  // Standard error of the mean.
+  double Ci95Lower() const { return estimate - 1.96 * std_error; }
+  double Ci95Upper() const { return estimate + 1.96 * std_error; }
+  std::string ToString() const;  // e.g. "2.31e+09 (95% ci [2.1e+09, 2.5e+09])"
+};
+
+struct TreeSizeEstimates {
+  TreeSizeEstimate histories;       // Every node: decision, chance, terminal.
+  TreeSizeEstimate decision_nodes;  // Histories where a player acts.
+  TreeSizeEstimate chance_nodes;
+  TreeSizeEstimate terminals;
+  // Estimated number of distinct infostates, summed over players. Exact
+  // counting needs to know, at a sampled decision node, how many histories
+  // share its infostate; see the histories_per_infostate parameter below.
+  // Without it this falls back to decision_nodes, an upper bound that is
+  // loose in games where an infostate backs many histories (in Durak, one
+  // per consistent hidden deal).
+  TreeSizeEstimate infostates;
+  int num_probes = 0;
+  std::string ToString() const;
+};
+
+// Runs `num_probes` random descents, split across `num_threads` workers.
+// Each probe is seeded from `seed` and its own index, so the sampled
+// descents do not depend on the thread count (only floating-point summation
+// order does). Only sequential games are supported.
+//
+// `histories_per_infostate`, if provided, must return for a decision node
+// the number of histories whose current player's infostate equals this
+// one's; the infostate count is then estimated unbiasedly as the weighted
+// sum of its reciprocal. Pass nullptr when no such count is available and
+// read TreeSizeEstimates::infostates as the decision-node upper bound.
+TreeSizeEstimates EstimateTreeSize(
+    const Game& game, int num_probes, int seed = 0, int num_threads = 1,
+    std::function<double(const State&)> histories_per_infostate = nullptr);
+
+}  // namespace algorithms
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_ALGORITHMS_TREE_SIZE_ESTIMATOR_H_
@@ -0,0 +1,124 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/algorithms/tree_size_estimator.h"
+
+#include <memory>
+#include <string>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace algorithms {
+namespace {
+
+// Exact counts from a full walk, the ground truth the estimates must hit.
+struct ExactCounts {
+  double histories = 0;
+  double decision_nodes = 0;
+  double chance_nodes = 0;
+  double terminals = 0;
+  // Decision histories per infostate string; its size is the exact number
+  // of distinct infostates over all players.
+  absl::flat_hash_map<std::string, int> infostate_histories;
+};
+
+void Walk(const State& state, ExactCounts* counts) {
+  counts->histories += 1;
+  if (state.IsTerminal()) {
+    counts->terminals += 1;
+    return;
+  }
+  if (state.IsChanceNode()) {
+    counts->chance_nodes += 1;
+    for (const auto& [action, prob] : state.ChanceOutcomes()) {
+      Walk(*state.Child(action), counts);
+    }
+    return;
+  }
+  counts->decision_nodes += 1;
+  ++counts->infostate_histories[state.InformationStateString()];
+  for (Action action : state.LegalActions()) {
+    Walk(*state.Child(action), counts);
+  }
+}
+
+void CheckWithin(const TreeSizeEstimate& estimate, double truth,
+                 double relative_tolerance) {
+  SPIEL_CHECK_GT(estimate.estimate, (1 - relative_tolerance) * truth);
+  SPIEL_CHECK_LT(estimate.estimate, (1 + relative_tolerance) * truth);
+  SPIEL_CHECK_GE(estimate.Ci95Upper(), estimate.Ci95Lower());
+}
+
+void TestEstimatesMatchExactCounts() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  ExactCounts exact;
+  Walk(*game->NewInitialState(), &exact);
+
+  // Kuhn is small and evenly branched, so this many probes pins every
+  // count well inside a 10% band.
+  TreeSizeEstimates estimates =
+      EstimateTreeSize(*game, /*num_probes=*/20000, /*seed=*/29,
+                       /*num_threads=*/3);
+  SPIEL_CHECK_EQ(estimates.num_probes, 20000);
+  CheckWithin(estimates.histories, exact.histories, 0.1);
+  CheckWithin(estimates.decision_nodes, exact.decision_nodes, 0.1);
+  CheckWithin(estimates.chance_nodes, exact.chance_nodes, 0.1);
+  CheckWithin(estimates.terminals, exact.terminals, 0.1);
+  // Without a per-infostate history count the infostate estimate is the
+  // decision-node upper bound, computed from the very same samples.
+  SPIEL_CHECK_FLOAT_EQ(estimates.infostates.estimate,
+                       estimates.decision_nodes.estimate);
+  SPIEL_CHECK_FALSE(estimates.ToString().empty());
+
+  // With the exact counts supplied the infostate estimate is unbiased and
+  // must land on the true number of distinct infostates.
+  auto per_infostate = [&exact](const State& state) {
+    return static_cast<double>(
+        exact.infostate_histories.at(state.InformationStateString()));
+  };
+  TreeSizeEstimates with_infostates =
+      EstimateTreeSize(*game, /*num_probes=*/20000, /*seed=*/29,
+                       /*num_threads=*/3, per_infostate);
+  CheckWithin(with_infostates.infostates,
+              exact.infostate_histories.size(), 0.1);
+}
+
+void TestThreadCountDoesNotChangeProbes() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  TreeSizeEstimates sequential =
+      EstimateTreeSize(*game, /*num_probes=*/2000, /*seed=*/7,
+                       /*num_threads=*/1);
+  TreeSizeEstimates parallel =
+      EstimateTreeSize(*game, /*num_probes=*/2000, /*seed=*/7,
+                       /*num_threads=*/4);
+  // The sampled descents are identical; only summation order differs.
+  SPIEL_CHECK_FLOAT_NEAR(sequential.histories.estimate,
+                         parallel.histories.estimate, 1e-9);
+  SPIEL_CHECK_FLOAT_NEAR(sequential.terminals.estimate,
+                         parallel.terminals.estimate, 1e-9);
+  SPIEL_CHECK_FLOAT_NEAR(sequential.infostates.estimate,
+                         parallel.infostates.estimate, 1e-9);
+}
+
+}  // namespace
+}  // namespace algorithms
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::algorithms::TestEstimatesMatchExactCounts();
+  open_spiel::algorithms::TestThreadCountDoesNotChangeProbes();
+}
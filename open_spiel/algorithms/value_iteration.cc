@@ -15,66 +15,141 @@
 #include "open_spiel/algorithms/value_iteration.h"
 
 #include <algorithm>
-
+#include <atomic>
+#include <limits>
+#include <string>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/spiel_utils.h"
 
 namespace open_spiel {
 namespace algorithms {
 namespace {
 
-using std::map;
-using std::vector;
-using state_pointer = std::unique_ptr<State>;
-using state_action = std::pair<std::string, Action>;
-using state_prob = std::pair<std::string, double>;
-
-// Adds transitions and transition probability from a given state
-void AddTransition(map<state_action, vector<state_prob>>* transitions,
-                   std::string key, const state_pointer& state) {
-  for (auto action : state->LegalActions()) {
-    auto next_state = state->Clone();
-    next_state->ApplyAction(action);
-    vector<state_prob> possibilities;
-    if (next_state->IsChanceNode()) {
-      // For a chance node, record the transition probabilities
-      for (const auto& actionprob : next_state->ChanceOutcomes()) {
-        auto realized_next_state = next_state->Clone();
-        realized_next_state->ApplyAction(actionprob.first);
-        possibilities.emplace_back(realized_next_state->ToString(),
-                                   actionprob.second);
+// Number of states per sweep block. Blocks are the unit of parallel work and
+// of residual tracking: a block whose residual has dropped below the
+// threshold is skipped until a full verification sweep re-checks it.
+constexpr int kBlockSize = 1024;
+
+// The whole MDP with dense integer state ids, built once up front so the
+// sweeps never touch a string key again. Ids are assigned in the (sorted)
+// iteration order of the GetAllStates map.
+struct IndexedMdp {
+  std::vector<std::string> keys;  // id -> state key.
+  std::vector<bool> terminal;     // id -> is the state terminal?
+  std::vector<Player> player;     // id -> player to act (terminals unused).
+  // id -> per legal action, the outcomes as (next state id, probability).
+  // A next id of -1 denotes a state outside the depth limit; its value is
+  // treated as 0, matching the behavior of the previous string-keyed
+  // implementation.
+  std::vector<std::vector<std::vector<std::pair<int, double>>>> transitions;
+  // id -> initial value (the terminal return for terminals, otherwise 0).
+  std::vector<double> initial_value;
+
+  int NumStates() const { return keys.size(); }
+};
+
+IndexedMdp BuildIndexedMdp(
+    const std::map<std::string, std::unique_ptr<State>>& states) {
+  IndexedMdp mdp;
+  const int num_states = states.size();
+  mdp.keys.reserve(num_states);
+  absl::flat_hash_map<std::string, int> key_to_id;
+  key_to_id.reserve(num_states);
+  for (const auto& kv : states) {
+    key_to_id[kv.first] = mdp.keys.size();
+    mdp.keys.push_back(kv.first);
+  }
+  auto lookup_id = [&key_to_id](const std::string& key) {
+    auto it = key_to_id.find(key);
+    return it == key_to_id.end() ? -1 : it->second;
+  };
+
+  mdp.terminal.resize(num_states, false);
+  mdp.player.resize(num_states, kInvalidPlayer);
+  mdp.transitions.resize(num_states);
+  mdp.initial_value.resize(num_states, 0.0);
+  for (const auto& kv : states) {
+    const int id = key_to_id.at(kv.first);
+    if (kv.second->IsTerminal()) {
+      mdp.terminal[id] = true;
+      // For both 1-player and 2-player zero sum games, suffices to look at
+      // player 0's utility.
+      mdp.initial_value[id] = kv.second->PlayerReturn(Player{0});
+      continue;
+    }
+    mdp.player[id] = kv.second->CurrentPlayer();
+    std::vector<Action> legal_actions = kv.second->LegalActions();
+    mdp.transitions[id].reserve(legal_actions.size());
+    for (Action action : legal_actions) {
+      std::unique_ptr<State> next_state = kv.second->Child(action);
+      std::vector<std::pair<int, double>> possibilities;
+      if (next_state->IsChanceNode()) {
+        // For a chance node, record the transition probabilities.
+        for (const auto& actionprob : next_state->ChanceOutcomes()) {
+          std::unique_ptr<State> realized_next_state =
+              next_state->Child(actionprob.first);
+          possibilities.emplace_back(lookup_id(realized_next_state->ToString()),
+                                     actionprob.second);
+        }
+      } else {
+        // A non-chance node is equivalent to transition with probability 1.
+        possibilities.emplace_back(lookup_id(next_state->ToString()), 1.0);
       }
-    } else {
-      // A non-chance node is equivalent to transition with probability 1
-      possibilities.emplace_back(next_state->ToString(), 1.0);
+      mdp.transitions[id].push_back(std::move(possibilities));
     }
-    (*transitions)[std::make_pair(key, action)] = possibilities;
   }
+  return mdp;
 }
 
-// Initialize transition map and value map
-void InitializeMaps(const map<std::string, state_pointer>& states,
-                    map<std::string, double>* values,
-                    map<state_action, vector<state_prob>>* transitions) {
-  for (const auto& kv : states) {
-    auto key = kv.first;
-    if (kv.second->IsTerminal()) {
-      // For both 1-player and 2-player zero sum games, suffices to look at
-      // player 0's utility
-      (*values)[key] = kv.second->PlayerReturn(Player{0});
-    } else {
-      (*values)[key] = 0;
-      AddTransition(transitions, key, kv.second);
+// Runs one Gauss-Seidel sweep over the given block (updates are in place, so
+// later states in the block see the new values of earlier ones; across
+// concurrently processed blocks the reads may be one sweep stale, which
+// asynchronous value iteration tolerates). Returns the block's residual.
+double SweepBlock(const IndexedMdp& mdp, int block,
+                  std::vector<std::atomic<double>>* values, double min_utility,
+                  double max_utility) {
+  const int begin = block * kBlockSize;
+  const int end = std::min<int>(begin + kBlockSize, mdp.NumStates());
+  double residual = 0;
+  for (int id = begin; id < end; ++id) {
+    if (mdp.terminal[id]) continue;
+
+    // Initialize value to be the minimum utility if current player
+    // is the maximizing player (i.e. player 0), and to maximum utility
+    // if current player is the minimizing player (i.e. player 1).
+    double value =
+        (mdp.player[id] == Player{0}) ? min_utility : max_utility;
+    for (const auto& possibilities : mdp.transitions[id]) {
+      double q_value = 0;
+      for (const auto& [next_id, prob] : possibilities) {
+        if (next_id < 0) continue;  // Beyond the depth limit; value 0.
+        q_value += prob * (*values)[next_id].load(std::memory_order_relaxed);
+      }
+      // Player 0 is maximizing the value (which is w.r.t. player 0),
+      // player 1 is minimizing the value.
+      if (mdp.player[id] == Player{0})
+        value = std::max(value, q_value);
+      else
+        value = std::min(value, q_value);
     }
+
+    const double stored = (*values)[id].load(std::memory_order_relaxed);
+    residual = std::max(std::abs(stored - value), residual);
+    (*values)[id].store(value, std::memory_order_relaxed);
   }
+  return residual;
 }
 
 }  // namespace
 
 std::map<std::string, double> ValueIteration(const Game& game, int depth_limit,
-                                             double threshold) {
-  using state_action = std::pair<std::string, Action>;
-  using state_prob = std::pair<std::string, double>;
-
+                                             double threshold,
+                                             int num_threads) {
+  SPIEL_CHECK_GE(num_threads, 1);
   // Currently only supports 1-player or 2-player zero sum games
   SPIEL_CHECK_TRUE(game.NumPlayers() == 1 || game.NumPlayers() == 2);
   if (game.NumPlayers() == 2) {
@@ -90,48 +165,70 @@ std::map<std::string, double> ValueIteration(const Game& game, int depth_limit,
   auto states = GetAllStates(game, depth_limit, /*include_terminals=*/true,
                              /*include_chance_states=*/false,
                              /*stop_at_duplicates*/true);
-  std::map<std::string, double> values;
-  std::map<state_action, std::vector<state_prob>> transitions;
-
-  InitializeMaps(states, &values, &transitions);
-
-  double error;
-  double min_utility = game.MinUtility();
-  double max_utility = game.MaxUtility();
-  do {
-    error = 0;
-    for (const auto& kv : states) {
-      auto key = kv.first;
-
-      if (kv.second->IsTerminal()) continue;
-
-      auto player = kv.second->CurrentPlayer();
-
-      // Initialize value to be the minimum utility if current player
-      // is the maximizing player (i.e. player 0), and to maximum utility
-      // if current player is the minimizing player (i.e. player 1).
-      double value = (player == Player{0}) ? min_utility : max_utility;
-      for (auto action : kv.second->LegalActions()) {
-        auto possibilities = transitions[std::make_pair(key, action)];
-        double q_value = 0;
-        for (const auto& outcome : possibilities) {
-          q_value += outcome.second * values[outcome.first];
-        }
-        // Player 0 is maximizing the value (which is w.r.t. player 0)
-        // Player 1 is minimizing the value
-        if (player == Player{0})
-          value = std::max(value, q_value);
-        else
-          value = std::min(value, q_value);
+  const IndexedMdp mdp = BuildIndexedMdp(states);
+  const int num_states = mdp.NumStates();
+  const int num_blocks = (num_states + kBlockSize - 1) / kBlockSize;
+
+  std::vector<std::atomic<double>> values(num_states);
+  for (int id = 0; id < num_states; ++id) {
+    values[id].store(mdp.initial_value[id], std::memory_order_relaxed);
+  }
+
+  const double min_utility = game.MinUtility();
+  const double max_utility = game.MaxUtility();
+
+  std::vector<double> block_residual(
+      num_blocks, std::numeric_limits<double>::infinity());
+  while (true) {
+    // Sweep only the blocks whose residual is still above the threshold;
+    // once they have all settled, run one full verification sweep since
+    // updates elsewhere may have disturbed a settled block.
+    std::vector<int> sweep_blocks;
+    for (int block = 0; block < num_blocks; ++block) {
+      if (block_residual[block] > threshold) sweep_blocks.push_back(block);
+    }
+    const bool full_sweep = sweep_blocks.empty();
+    if (full_sweep) {
+      sweep_blocks.resize(num_blocks);
+      for (int block = 0; block < num_blocks; ++block) {
+        sweep_blocks[block] = block;
+      }
+    }
+
+    std::atomic<int> next_block(0);
+    auto worker = [&]() {
+      for (int i = next_block++; i < sweep_blocks.size(); i = next_block++) {
+        const int block = sweep_blocks[i];
+        block_residual[block] =
+            SweepBlock(mdp, block, &values, min_utility, max_utility);
       }
+    };
+    if (num_threads == 1) {
+      worker();
+    } else {
+      std::vector<std::thread> threads;
+      threads.reserve(num_threads);
+      for (int i = 0; i < num_threads; ++i) threads.emplace_back(worker);
+      for (std::thread& thread : threads) thread.join();
+    }
 
-      double* stored_value = &values[key];
-      error = std::max(std::abs(*stored_value - value), error);
-      *stored_value = value;
+    if (full_sweep &&
+        *std::max_element(block_residual.begin(), block_residual.end()) <=
+            threshold) {
+      break;
     }
-  } while (error > threshold);
+  }
+
+  std::map<std::string, double> result;
+  for (int id = 0; id < num_states; ++id) {
+    result[mdp.keys[id]] = values[id].load(std::memory_order_relaxed);
+  }
+  return result;
+}
 
-  return values;
+std::map<std::string, double> ValueIteration(const Game& game, int depth_limit,
+                                             double threshold) {
+  return ValueIteration(game, depth_limit, threshold, /*num_threads=*/1);
 }
 
 }  // namespace algorithms
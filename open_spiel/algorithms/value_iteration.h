@@ -29,10 +29,22 @@ namespace algorithms {
 //
 // Currently works for sequential 1-player or 2-player zero-sum games,
 // with or without chance nodes.
+//
+// Internally the states are indexed with dense integer ids (built once, up
+// front) and swept Gauss-Seidel style in blocks with per-block residual
+// tracking: blocks whose residual has dropped below the threshold are skipped
+// until a full verification sweep confirms convergence everywhere. With
+// num_threads > 1 the blocks of one sweep are processed concurrently; reads
+// across blocks may then be one sweep stale, which only affects the number of
+// sweeps needed, not the fixed point.
 
 std::map<std::string, double> ValueIteration(const Game& game, int depth_limit,
                                              double threshold);
 
+std::map<std::string, double> ValueIteration(const Game& game, int depth_limit,
+                                             double threshold,
+                                             int num_threads);
+
 }  // namespace algorithms
 }  // namespace open_spiel
 
@@ -0,0 +1,94 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/bots/decision_service.h"
+
+#include <memory>
+#include <utility>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+
+// The per-match handle: all state lives in the service, so a handle is just
+// a pointer and the default no-op Bot methods.
+class DecisionServiceBot : public Bot {
+ public:
+  explicit DecisionServiceBot(DecisionService* service) : service_(service) {}
+
+  Action Step(const State& state) override { return service_->Decide(state); }
+
+ private:
+  DecisionService* service_;
+};
+
+DecisionService::DecisionService(
+    std::shared_ptr<const Game> game,
+    std::shared_ptr<algorithms::Evaluator> evaluator, int num_workers,
+    double uct_c, int max_simulations, int64_t max_memory_mb, int seed,
+    int max_queue_size)
+    : game_(std::move(game)),
+      evaluator_(std::move(evaluator)),
+      queue_(max_queue_size),
+      uct_c_(uct_c),
+      max_simulations_(max_simulations),
+      max_memory_mb_(max_memory_mb),
+      seed_(seed) {
+  SPIEL_CHECK_GE(num_workers, 1);
+  workers_.reserve(num_workers);
+  for (int w = 0; w < num_workers; ++w) {
+    workers_.emplace_back([this, w]() { Worker(w); });
+  }
+}
+
+DecisionService::~DecisionService() { Shutdown(); }
+
+std::unique_ptr<Bot> DecisionService::CreateBot() {
+  return std::make_unique<DecisionServiceBot>(this);
+}
+
+void DecisionService::Shutdown() {
+  if (shut_down_) return;
+  shut_down_ = true;
+  // Blocked pushes make further Decide() calls fail; pops keep draining the
+  // queue, so the workers serve everything already enqueued before exiting.
+  queue_.BlockNewValues();
+  for (Thread& worker : workers_) worker.join();
+}
+
+Action DecisionService::Decide(const State& state) {
+  Request request{&state, {}};
+  std::future<Action> result = request.promise.get_future();
+  if (!queue_.Push(&request)) {
+    SpielFatalError("DecisionService: Step() called after Shutdown().");
+  }
+  return result.get();
+}
+
+void DecisionService::Worker(int worker_id) {
+  // One search bot per worker, all sharing the service's evaluator; with a
+  // batching evaluator the concurrent workers' leaf evaluations coalesce
+  // into joint inference batches across matches.
+  algorithms::MCTSBot bot(*game_, evaluator_, uct_c_, max_simulations_,
+                          max_memory_mb_, /*solve=*/false, seed_ + worker_id,
+                          /*verbose=*/false);
+  while (absl::optional<Request*> request = queue_.Pop()) {
+    // Successive requests usually come from different matches; restarting
+    // keeps them fully isolated.
+    bot.Restart();
+    (*request)->promise.set_value(bot.Step(*(*request)->state));
+  }
+}
+
+}  // namespace open_spiel
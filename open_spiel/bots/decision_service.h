@@ -0,0 +1,102 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_BOTS_DECISION_SERVICE_H_
+#define OPEN_SPIEL_BOTS_DECISION_SERVICE_H_
+
+#include <cstdint>
+#include <future>  // NOLINT
+#include <memory>
+#include <vector>
+
+#include "open_spiel/algorithms/mcts.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_bots.h"
+#include "open_spiel/utils/thread.h"
+#include "open_spiel/utils/threaded_queue.h"
+
+// A decision service multiplexing many concurrent matches onto a shared pool
+// of search workers. One bot instance per match means leaf evaluations
+// arrive one search at a time, which caps the batch a neural evaluator can
+// assemble at the per-bot simulation width. The service instead hands every
+// match a thin Bot handle whose Step() enqueues the decision; a fixed pool
+// of workers runs the searches, all against one shared evaluator. When that
+// evaluator batches concurrent requests internally (as
+// torch_az::VPNetEvaluator does), the leaves of searches from different
+// matches land in the same inference batch, so the effective batch size
+// scales with the number of in-flight decisions instead of with one bot's
+// simulation count. With a plain CPU evaluator the service still bounds the
+// total search parallelism to the worker count regardless of how many
+// matches are live.
+
+namespace open_spiel {
+
+class DecisionService {
+ public:
+  // The search parameters mirror MCTSBot's: every worker owns one MCTSBot
+  // built from them against the shared evaluator (workers are seeded seed,
+  // seed + 1, ...). max_queue_size bounds the number of decisions waiting
+  // for a worker; Step() blocks while the queue is full.
+  DecisionService(std::shared_ptr<const Game> game,
+                  std::shared_ptr<algorithms::Evaluator> evaluator,
+                  int num_workers, double uct_c, int max_simulations,
+                  int64_t max_memory_mb, int seed,
+                  int max_queue_size = 1024);
+
+  // Serves queued decisions to completion, then joins the workers.
+  ~DecisionService();
+
+  DecisionService(const DecisionService&) = delete;
+  DecisionService& operator=(const DecisionService&) = delete;
+
+  // Returns a bot handle for one match. Handles are cheap, must not outlive
+  // the service, and any number can exist concurrently; each handle's
+  // Step() blocks until a worker has searched the state and returns the
+  // chosen action. Matches are isolated: workers restart their search tree
+  // for every decision, so nothing leaks between matches that happen to be
+  // served by the same worker.
+  std::unique_ptr<Bot> CreateBot();
+
+  // Stops accepting new decisions (Step() on any handle becomes a fatal
+  // error), serves the already queued ones and joins the workers. Called by
+  // the destructor; exposed for callers that want to drain explicitly.
+  void Shutdown();
+
+ private:
+  friend class DecisionServiceBot;
+
+  struct Request {
+    const State* state;
+    std::promise<Action> promise;
+  };
+
+  // Enqueues `state` and blocks until a worker has decided.
+  Action Decide(const State& state);
+
+  void Worker(int worker_id);
+
+  std::shared_ptr<const Game> game_;
+  std::shared_ptr<algorithms::Evaluator> evaluator_;
+  ThreadedQueue<Request*> queue_;
+  std::vector<Thread> workers_;
+  const double uct_c_;
+  const int max_simulations_;
+  const int64_t max_memory_mb_;
+  const int seed_;
+  bool shut_down_ = false;
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_BOTS_DECISION_SERVICE_H_
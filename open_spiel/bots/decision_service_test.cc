@@ -0,0 +1,98 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/bots/decision_service.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/algorithm/container.h"
+#include "open_spiel/algorithms/mcts.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_bots.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
+
+namespace open_spiel {
+namespace {
+
+constexpr int kSeed = 472993873;
+
+// Plays one full match where every player steps through its own service
+// handle; chance is sampled locally.
+void PlayMatch(const Game& game, DecisionService* service, int match_seed) {
+  std::mt19937 rng(match_seed);
+  std::vector<std::unique_ptr<Bot>> bots;
+  for (Player p = 0; p < game.NumPlayers(); ++p) {
+    bots.push_back(service->CreateBot());
+  }
+  std::unique_ptr<State> state = game.NewInitialState();
+  while (!state->IsTerminal()) {
+    Action action;
+    if (state->IsChanceNode()) {
+      action = SampleAction(state->ChanceOutcomes(),
+                            std::uniform_real_distribution<double>()(rng))
+                   .first;
+    } else {
+      action = bots[state->CurrentPlayer()]->Step(*state);
+      SPIEL_CHECK_TRUE(
+          absl::c_linear_search(state->LegalActions(), action));
+    }
+    state->ApplyAction(action);
+  }
+}
+
+void ConcurrentMatchesTest() {
+  // More live matches than workers: decisions from different matches queue
+  // up on the shared pool and complete; every returned action is legal.
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  auto evaluator =
+      std::make_shared<algorithms::RandomRolloutEvaluator>(1, kSeed);
+  DecisionService service(game, evaluator, /*num_workers=*/2, /*uct_c=*/2.0,
+                          /*max_simulations=*/20, /*max_memory_mb=*/10,
+                          kSeed);
+
+  const int num_matches = 4;
+  std::vector<Thread> matches;
+  matches.reserve(num_matches);
+  for (int m = 0; m < num_matches; ++m) {
+    matches.emplace_back(
+        [&game, &service, m]() { PlayMatch(*game, &service, kSeed + m); });
+  }
+  for (Thread& match : matches) match.join();
+}
+
+void ShutdownDrainsTest() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  auto evaluator =
+      std::make_shared<algorithms::RandomRolloutEvaluator>(1, kSeed);
+  auto service = std::make_unique<DecisionService>(
+      game, evaluator, /*num_workers=*/1, /*uct_c=*/2.0,
+      /*max_simulations=*/10, /*max_memory_mb=*/10, kSeed);
+  std::unique_ptr<Bot> bot = service->CreateBot();
+  std::unique_ptr<State> state = game->NewInitialState();
+  Action action = bot->Step(*state);
+  SPIEL_CHECK_TRUE(absl::c_linear_search(state->LegalActions(), action));
+  // Destruction joins the workers with nothing in flight.
+  service.reset();
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::ConcurrentMatchesTest();
+  open_spiel::ShutdownDrainsTest();
+}
@@ -14,6 +14,8 @@
 
 #include "open_spiel/bots/pimc_bot.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -22,22 +24,44 @@
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/random/distributions.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/algorithms/maxn.h"
 #include "open_spiel/algorithms/minimax.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
+namespace {
+
+// Adaptive allocation: never stop on the statistical rule before this many
+// worlds have voted, and require the leader's margin to exceed this many
+// standard deviations of the vote count before calling it settled. Each
+// additional world changes the margin by at most one, so its standard
+// deviation after n votes is bounded by sqrt(n).
+constexpr int kMinWorldsBeforeConfidenceStop = 8;
+constexpr double kVoteConfidenceZ = 2.0;
+
+}  // namespace
 
 PIMCBot::PIMCBot(
     std::function<double(const State&, Player player)> value_function,
-    Player player_id, uint32_t seed, int num_determinizations, int depth_limit)
+    Player player_id, uint32_t seed, int num_determinizations, int depth_limit,
+    int num_threads, bool use_transposition_table, bool adaptive_allocation)
     : rng_(seed),
       value_function_(value_function),
       player_id_(player_id),
       num_determinizations_(num_determinizations),
-      depth_limit_(depth_limit) {}
+      depth_limit_(depth_limit),
+      num_threads_(num_threads),
+      adaptive_allocation_(adaptive_allocation) {
+  SPIEL_CHECK_GE(num_threads_, 1);
+  if (use_transposition_table) {
+    transposition_table_ = std::make_unique<algorithms::TranspositionTable>();
+  }
+}
 
 Action PIMCBot::Step(const State& state) {
   std::pair<std::vector<int>, Action> search_result = Search(state);
@@ -69,8 +93,15 @@ ActionsAndProbs PIMCBot::PolicyFromBestAction(const State& state,
 }
 
 std::pair<std::vector<int>, Action> PIMCBot::Search(const State& root_state) {
+  const absl::Time start = collect_step_stats_ ? absl::Now() : absl::Time();
   int num_determinizations = num_determinizations_;
 
+  // Cached entries from previous decisions are for states that can no longer
+  // be reached; dropping them bounds the table to one decision's worth.
+  if (transposition_table_ != nullptr) {
+    transposition_table_->Clear();
+  }
+
   GameType type = root_state.GetGame()->GetType();
   if (type.information == GameType::Information::kPerfectInformation) {
     num_determinizations = 1;
@@ -90,33 +121,115 @@ std::pair<std::vector<int>, Action> PIMCBot::Search(const State& root_state) {
     return absl::Uniform<double>(this->rng_, 0.0, 1.0);
   };
 
+  // Resample the worlds sequentially so the rng stream - and therefore the
+  // set of determinizations searched - does not depend on the thread count.
+  std::vector<std::unique_ptr<State>> worlds;
+  worlds.reserve(num_determinizations);
   for (int i = 0; i < num_determinizations; ++i) {
-    std::unique_ptr<State> state = nullptr;
-
     if (num_determinizations == 1) {
-      state = root_state.Clone();
+      worlds.push_back(root_state.Clone());
     } else {
-      state = root_state.ResampleFromInfostate(player, rng_func);
+      worlds.push_back(root_state.ResampleFromInfostate(player, rng_func));
     }
+  }
 
-    if (type.utility == GameType::Utility::kZeroSum &&
-        type.chance_mode == GameType::ChanceMode::kDeterministic &&
-        root_state.NumPlayers() == 2) {
+  const bool use_alpha_beta =
+      type.utility == GameType::Utility::kZeroSum &&
+      type.chance_mode == GameType::ChanceMode::kDeterministic &&
+      root_state.NumPlayers() == 2;
+  auto search_world = [this, player, use_alpha_beta](State* state) -> Action {
+    if (use_alpha_beta) {
       // Special case for two-player zero-sum deterministic games: use
       // alpha-beta.
       std::pair<double, Action> search_result = algorithms::AlphaBetaSearch(
-          *state->GetGame(), state.get(),
+          *state->GetGame(), state,
           [this, player](const State& state) {
             return this->value_function_(state, player);
           },
-          depth_limit_, player, /*use_undo*/ false);
-      action_counts[search_result.second] += 1;
+          depth_limit_, player, /*use_undo*/ false,
+          transposition_table_.get());
+      return search_result.second;
     } else {
       std::pair<std::vector<double>, Action> search_result =
-          algorithms::MaxNSearch(*state->GetGame(), state.get(),
-                                 value_function_, depth_limit_);
-      action_counts[search_result.second] += 1;
+          algorithms::MaxNSearch(*state->GetGame(), state, value_function_,
+                                 depth_limit_, transposition_table_.get());
+      return search_result.second;
+    }
+  };
+
+  // Worlds searched so far; with adaptive allocation the remaining worlds are
+  // skipped once the vote is settled (see vote_settled below).
+  int searched = 0;
+  auto vote_settled = [&]() -> bool {
+    if (!adaptive_allocation_) return false;
+    int best = 0;
+    int second = 0;
+    for (const auto& [action, count] : action_counts) {
+      if (count >= best) {
+        second = best;
+        best = count;
+      } else if (count > second) {
+        second = count;
+      }
+    }
+    const int lead = best - second;
+    // Settled exactly: the runner-up cannot catch up even if it wins every
+    // remaining world, so the chosen action is already final.
+    if (lead > num_determinizations - searched) return true;
+    // Settled statistically: the lead is far outside the sampling noise of
+    // the vote, so the remaining worlds are very unlikely to flip it.
+    return searched >= kMinWorldsBeforeConfidenceStop &&
+           lead >= kVoteConfidenceZ * std::sqrt(static_cast<double>(searched));
+  };
+
+  if (num_threads_ <= 1 || num_determinizations <= 1) {
+    for (const std::unique_ptr<State>& world : worlds) {
+      action_counts[search_world(world.get())] += 1;
+      ++searched;
+      if (vote_settled()) break;
+    }
+  } else if (adaptive_allocation_) {
+    // Search the worlds in rounds of one per worker, re-checking settlement
+    // between rounds. The worlds keep their sequential sampling order, so the
+    // votes cast are a prefix of the single-threaded ones.
+    int num_workers = std::min(num_threads_, num_determinizations);
+    while (searched < num_determinizations && !vote_settled()) {
+      const int batch = std::min(num_workers, num_determinizations - searched);
+      std::vector<Action> batch_votes(batch, kInvalidAction);
+      std::vector<Thread> workers;
+      workers.reserve(batch);
+      for (int b = 0; b < batch; ++b) {
+        workers.emplace_back([&, b]() {
+          batch_votes[b] = search_world(worlds[searched + b].get());
+        });
+      }
+      for (Thread& worker : workers) worker.join();
+      for (Action vote : batch_votes) {
+        action_counts[vote] += 1;
+      }
+      searched += batch;
     }
+  } else {
+    // Each worker searches a round-robin share of the worlds into its own
+    // vote table; the tables are summed after the join.
+    int num_workers = std::min(num_threads_, num_determinizations);
+    std::vector<absl::flat_hash_map<Action, int>> worker_counts(num_workers);
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int w = 0; w < num_workers; ++w) {
+      workers.emplace_back([&, w]() {
+        for (int i = w; i < num_determinizations; i += num_workers) {
+          worker_counts[w][search_world(worlds[i].get())] += 1;
+        }
+      });
+    }
+    for (Thread& worker : workers) worker.join();
+    for (const absl::flat_hash_map<Action, int>& votes : worker_counts) {
+      for (const auto& [action, count] : votes) {
+        action_counts[action] += count;
+      }
+    }
+    searched = num_determinizations;
   }
 
   Action best_action = kInvalidAction;
@@ -130,6 +243,20 @@ std::pair<std::vector<int>, Action> PIMCBot::Search(const State& root_state) {
     }
   }
 
+  if (collect_step_stats_) {
+    last_step_stats_ = {};
+    last_step_stats_.wall_time_seconds =
+        absl::ToDoubleSeconds(absl::Now() - start);
+    // With adaptive allocation this can be less than the configured budget.
+    last_step_stats_.simulations = searched;
+    // Search cleared the table on entry, so the hit count covers exactly this
+    // decision. nodes_expanded stays 0: the underlying minimax searches do
+    // not count nodes.
+    if (transposition_table_ != nullptr) {
+      last_step_stats_.cache_hits = transposition_table_->NumHits();
+    }
+  }
+
   return {counts, best_action};
 }
 }  // namespace open_spiel
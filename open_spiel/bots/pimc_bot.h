@@ -22,6 +22,7 @@
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/algorithms/transposition_table.h"
 #include "open_spiel/games/gin_rummy/gin_rummy_utils.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_bots.h"
@@ -31,9 +32,31 @@ namespace open_spiel {
 
 class PIMCBot : public Bot {
  public:
+  // With num_threads > 1, the independent determinization searches run on a
+  // worker pool and their votes are summed afterwards. Determinizations are
+  // still resampled sequentially from the bot's own rng stream, so the chosen
+  // action does not depend on the thread count. The value function must be
+  // safe to call from multiple threads.
+  //
+  // With use_transposition_table, the determinization searches share a
+  // thread-safe table of interior-node results. Determinizations of the same
+  // root state differ only in the hidden cards, so their search trees overlap
+  // heavily (especially in card-game endgames) and positions reached in one
+  // search are served from cache in the others. The table is cleared at the
+  // start of each Search so memory stays bounded by one decision.
+  //
+  // With adaptive_allocation, the worlds are searched incrementally and the
+  // vote stops early once it is settled: exactly, when the leader's margin
+  // exceeds the number of unsearched worlds, or statistically, once the
+  // margin is far outside the sampling noise of the vote. The chosen action
+  // can then differ from the full-budget vote only where the full vote would
+  // itself have been decided by a statistically insignificant margin;
+  // GetLastStepStats().simulations reports how many worlds were searched.
   PIMCBot(std::function<double(const State&, Player player)> value_function,
           Player player_id, uint32_t seed, int num_determinizations,
-          int depth_limit);
+          int depth_limit, int num_threads = 1,
+          bool use_transposition_table = false,
+          bool adaptive_allocation = false);
 
   Action Step(const State& state) override;
 
@@ -54,6 +77,9 @@ class PIMCBot : public Bot {
   const Player player_id_;
   const int num_determinizations_;
   const int depth_limit_;
+  const int num_threads_;
+  const bool adaptive_allocation_;
+  std::unique_ptr<algorithms::TranspositionTable> transposition_table_;
 };
 
 }  // namespace open_spiel
@@ -14,6 +14,7 @@
 
 #include "open_spiel/bots/uci/uci_bot.h"
 
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -85,11 +86,8 @@ UCIBot::~UCIBot() {
     std::cerr << "Uci sub-process failed" << std::endl;
   }
 
-  // Close the input stream
-  fclose(input_stream_);
-  // Free the input stream buffer allocated in ReadLine
-  free(input_stream_buffer_);
-  // Close the output pipe
+  // Close both ends of the pipe pair.
+  close(input_fd_);
   close(output_fd_);
 }
 
@@ -114,6 +112,9 @@ std::pair<Action, std::string> UCIBot::StepVerbose(const State& state) {
   auto chess_state = down_cast<const chess::ChessState&>(state);
   auto chess_game = down_cast<const chess::ChessGame*>(state.GetGame().get());
   if (ponder_ && ponder_move_) {
+    // Pick up the search output the engine produced while the opponent was
+    // thinking before issuing any further commands.
+    DrainPendingLines();
     if (!was_ponder_hit_) {
       Stop();
       PositionFromState(chess_state);
@@ -155,6 +156,9 @@ void UCIBot::RestartAt(const State& state) {
 }
 
 void UCIBot::InformAction(const State& state, Player player_id, Action action) {
+  // Keep the pipe drained while the engine ponders: a full pipe would block
+  // the engine's own writes and stall its background search.
+  if (ponder_) DrainPendingLines();
   auto chess_state = down_cast<const chess::ChessState&>(state);
   auto chess_game = down_cast<const chess::ChessGame*>(state.GetGame().get());
   chess::Move move = chess::ActionToMove(action, chess_state.Board());
@@ -184,10 +188,7 @@ void UCIBot::StartProcess(const std::string& bot_binary_path) {
     close(input_pipe[1]);
 
     output_fd_ = output_pipe[1];
-    input_stream_ = fdopen(input_pipe[0], "r");
-    if (input_stream_ == nullptr) {
-      SpielFatalError("Opening the UCI input pipe as a file stream failed");
-    }
+    input_fd_ = input_pipe[0];
 
   } else {  // child
     dup2(output_pipe[0], STDIN_FILENO);
@@ -283,13 +284,13 @@ std::pair<std::string, absl::optional<std::string>> UCIBot::ReadBestMove(
   while (true) {
     // istringstream can't use a string_view so we need to copy to a string.
     std::string response = ReadLine();
-    // Save the most recent info string if requested. Specifying that the string
-    // contains the number of nodes makes sure that we don't save strings of the
-    // form "info depth 30 currmove c2c1 currmovenumber 22", we want the ones
-    // with metadata about the search.
-    if (info_string.has_value() && absl::StartsWith(response, "info") &&
+    // Save the most recent info string. Specifying that the string contains
+    // the number of nodes makes sure that we don't save strings of the form
+    // "info depth 30 currmove c2c1 currmovenumber 22", we want the ones with
+    // metadata about the search.
+    if (absl::StartsWith(response, "info") &&
         absl::StrContains(response, "nodes")) {
-      *info_string.value() = response;
+      last_info_ = response;
     }
     std::istringstream response_line(response);
     std::string token;
@@ -305,6 +306,11 @@ std::pair<std::string, absl::optional<std::string>> UCIBot::ReadBestMove(
       }
     }
     if (!move_str.empty()) {
+      // Report the freshest search metadata, including lines already parsed
+      // while draining the pipe during ponder time.
+      if (info_string.has_value()) {
+        *info_string.value() = last_info_;
+      }
       return std::make_pair(move_str, ponder_str);
     }
   }
@@ -317,19 +323,57 @@ void UCIBot::Write(const std::string& msg) const {
   }
 }
 
+void UCIBot::FillLineQueue(bool block) {
+  pollfd pfd;
+  pfd.fd = input_fd_;
+  pfd.events = POLLIN;
+  int ret = poll(&pfd, /*nfds=*/1, /*timeout=*/block ? -1 : 0);
+  if (ret < 0) {
+    if (errno == EINTR) return;
+    SpielFatalError("Polling the uci sub-process pipe failed");
+  }
+  if (ret == 0) return;  // Nothing buffered and we must not block.
+
+  char chunk[4096];
+  ssize_t bytes_read = read(input_fd_, chunk, sizeof(chunk));
+  if (bytes_read <= 0) {
+    std::cerr << "Failed to read from input stream: " << std::strerror(errno)
+              << "\n";
+    SpielFatalError("Reading a line from uci sub-process failed");
+  }
+  input_buffer_.append(chunk, bytes_read);
+
+  // Move every complete line into the queue; a trailing partial line stays
+  // buffered until the rest of it arrives.
+  size_t start = 0;
+  for (size_t pos; (pos = input_buffer_.find('\n', start)) != std::string::npos;
+       start = pos + 1) {
+    absl::string_view line(input_buffer_.data() + start, pos - start);
+    line_queue_.emplace_back(absl::StripTrailingAsciiWhitespace(line));
+  }
+  input_buffer_.erase(0, start);
+}
+
 std::string UCIBot::ReadLine() {
-  if (auto bytes_read = ::getline(&input_stream_buffer_,
-                                  &input_stream_buffer_size_, input_stream_);
-      bytes_read != -1) {
-    absl::string_view response =
-        absl::string_view(input_stream_buffer_, bytes_read);
-    // Remove the trailing newline that getline left in the string.
-    // Using a string_view as input saves us from copying the string.
-    return std::string(absl::StripTrailingAsciiWhitespace(response));
+  while (line_queue_.empty()) {
+    FillLineQueue(/*block=*/true);
+  }
+  std::string line = std::move(line_queue_.front());
+  line_queue_.pop_front();
+  return line;
+}
+
+void UCIBot::DrainPendingLines() {
+  FillLineQueue(/*block=*/false);
+  while (!line_queue_.empty() &&
+         !absl::StartsWith(line_queue_.front(), "bestmove")) {
+    std::string line = std::move(line_queue_.front());
+    line_queue_.pop_front();
+    if (absl::StartsWith(line, "info") && absl::StrContains(line, "nodes")) {
+      last_info_ = std::move(line);
+    }
+    if (line_queue_.empty()) FillLineQueue(/*block=*/false);
   }
-  std::cerr << "Failed to read from input stream: " << std::strerror(errno)
-            << "\n";
-  SpielFatalError("Reading a line from uci sub-process failed");
 }
 
 std::unique_ptr<Bot> MakeUCIBot(const std::string& bot_binary_path,
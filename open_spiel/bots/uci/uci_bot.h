@@ -15,7 +15,7 @@
 #ifndef OPEN_SPIEL_BOTS_UCI_BOT_H_
 #define OPEN_SPIEL_BOTS_UCI_BOT_H_
 
-#include <cstdio>   // for size_t, needed by ::getline
+#include <deque>
 #include <map>
 #include <memory>
 #include <string>
@@ -68,6 +68,11 @@ class UCIBot : public Bot {
   void Write(const std::string& msg) const;
   // Always blocks until a line is read.
   std::string ReadLine();
+  // Drains whatever the engine has already written without blocking, parsing
+  // "info" lines incrementally. Called while the engine is pondering so a full
+  // pipe never stalls its search; a queued "bestmove" line is left for the
+  // next blocking read.
+  void DrainPendingLines();
 
   void Position(const std::string& fen,
                 const std::vector<std::string>& moves = {});
@@ -88,6 +93,9 @@ class UCIBot : public Bot {
       absl::optional<std::string*> info_string = absl::nullopt);
   void PositionFromState(const chess::ChessState& state,
                          const std::vector<std::string>& extra_moves = {});
+  // Reads available bytes from the engine pipe into the line queue. If
+  // `block` is true, waits until at least one byte arrives.
+  void FillLineQueue(bool block);
 
   pid_t pid_ = -1;
   int output_fd_ = -1;
@@ -100,10 +108,14 @@ class UCIBot : public Bot {
   bool ponder_;
   bool use_game_history_for_position_ = false;
 
-  // Input stream member variables for the bot.
-  FILE* input_stream_ = nullptr;
-  char* input_stream_buffer_ = nullptr;
-  size_t input_stream_buffer_size_ = 0;
+  // Buffered pipe input: raw bytes not yet forming a full line, and complete
+  // lines waiting to be consumed.
+  int input_fd_ = -1;
+  std::string input_buffer_;
+  std::deque<std::string> line_queue_;
+  // Most recent search-metadata "info" line seen, including ones parsed while
+  // draining the pipe during ponder time.
+  std::string last_info_;
 };
 
 /**
@@ -53,6 +53,15 @@ ABSL_FLAG(int, replay_buffer_size, 1 << 16,
           "How many states to store in the replay buffer.");
 ABSL_FLAG(double, replay_buffer_reuse, 3,
           "How many times to reuse each state in the replay buffer.");
+ABSL_FLAG(double, prioritized_replay_alpha, 0,
+          "Sample replay states proportional to their last training "
+          "loss^alpha; 0 keeps uniform sampling.");
+ABSL_FLAG(double, prioritized_replay_beta, 0.4,
+          "Importance-weight exponent correcting the prioritized sampling "
+          "bias.");
+ABSL_FLAG(bool, suit_augmentation, false,
+          "Durak games only: randomly relabel the non-trump suits of each "
+          "sampled training batch element.");
 ABSL_FLAG(int, checkpoint_freq, 100, "Save a checkpoint every N steps.");
 ABSL_FLAG(int, max_simulations, 300, "How many simulations to run.");
 ABSL_FLAG(int, train_batch_size, 1 << 10,
@@ -60,12 +69,16 @@ ABSL_FLAG(int, train_batch_size, 1 << 10,
 ABSL_FLAG(int, inference_batch_size, 1,
           "How many threads to wait for for inference.");
 ABSL_FLAG(int, inference_threads, 0, "How many threads to run inference.");
+ABSL_FLAG(bool, inference_fp16, false,
+          "Run self-play inference in half precision (CUDA devices only).");
 ABSL_FLAG(int, inference_cache, 1 << 18,
           "Whether to cache the results from inference.");
 ABSL_FLAG(std::string, devices, "/cpu:0",
           "Comma separated list of devices. The first device listed is used "
           "also as the learner. Allowable device names: cpu, cuda:0, cuda:1, "
           "cuda:2, cuda:3, ... Where cuda:n implies the n'th GPU resource.");
+ABSL_FLAG(int, learning_devices, 1,
+          "How many leading devices to train on (data parallel).");
 ABSL_FLAG(bool, explicit_learning, false,
           "The way the first device handles learning, either 'false' "
           "(while learning, the first device also takes on inference "
@@ -74,6 +87,10 @@ ABSL_FLAG(bool, explicit_learning, false,
           "multiple devices are available).");
 ABSL_FLAG(bool, verbose, false, "Show the MCTS stats of possible moves.");
 ABSL_FLAG(int, actors, 4, "How many actors to run.");
+ABSL_FLAG(int, games_per_actor, 1,
+          "How many games each actor keeps in flight. Self-play is "
+          "inference-bound, so more in-flight games per actor keep the "
+          "inference batches full with fewer actors.");
 ABSL_FLAG(int, evaluators, 2, "How many evaluators to run.");
 ABSL_FLAG(int, eval_levels, 7,
           ("Play evaluation games vs MCTS+Solver, with max_simulations*10^(n/2)"
@@ -82,6 +99,18 @@ ABSL_FLAG(int, eval_levels, 7,
 ABSL_FLAG(int, max_steps, 0, "How many learn steps to run.");
 ABSL_FLAG(int, evaluation_window, 100,
           "Number of games to average results over.");
+ABSL_FLAG(std::string, actor_affinity, "",
+          "Pin actor threads to these cpus (Linux, taskset-style list, e.g. "
+          "'0-15,32'). Several groups may be separated by ';', e.g. "
+          "'0-31;32-63' alternates actors between two sockets. Empty leaves "
+          "placement to the OS scheduler.");
+ABSL_FLAG(std::string, evaluator_affinity, "",
+          "Pin evaluator threads to these cpus; same format as "
+          "actor_affinity.");
+ABSL_FLAG(std::string, learner_affinity, "",
+          "Pin the learner thread to these cpus, ideally the cores PCIe-local "
+          "to the learning device; same format as actor_affinity without "
+          "groups.");
 
 open_spiel::StopToken stop_token;
 
@@ -137,11 +166,17 @@ int main(int argc, char** argv) {
     config.nn_depth = absl::GetFlag(FLAGS_nn_depth);
     config.devices = absl::GetFlag(FLAGS_devices);
     config.explicit_learning = absl::GetFlag(FLAGS_explicit_learning);
+    config.learning_devices = absl::GetFlag(FLAGS_learning_devices);
     config.learning_rate = absl::GetFlag(FLAGS_learning_rate);
     config.weight_decay = absl::GetFlag(FLAGS_weight_decay);
     config.train_batch_size = absl::GetFlag(FLAGS_train_batch_size);
     config.replay_buffer_size = absl::GetFlag(FLAGS_replay_buffer_size);
     config.replay_buffer_reuse = absl::GetFlag(FLAGS_replay_buffer_reuse);
+    config.prioritized_replay_alpha =
+        absl::GetFlag(FLAGS_prioritized_replay_alpha);
+    config.prioritized_replay_beta =
+        absl::GetFlag(FLAGS_prioritized_replay_beta);
+    config.suit_augmentation = absl::GetFlag(FLAGS_suit_augmentation);
     config.checkpoint_freq = absl::GetFlag(FLAGS_checkpoint_freq);
     config.evaluation_window = absl::GetFlag(FLAGS_evaluation_window);
     config.uct_c = absl::GetFlag(FLAGS_uct_c);
@@ -150,6 +185,7 @@ int main(int argc, char** argv) {
     config.inference_batch_size = absl::GetFlag(FLAGS_inference_batch_size);
     config.inference_threads = absl::GetFlag(FLAGS_inference_threads);
     config.inference_cache = absl::GetFlag(FLAGS_inference_cache);
+    config.inference_fp16 = absl::GetFlag(FLAGS_inference_fp16);
     config.policy_alpha = absl::GetFlag(FLAGS_policy_alpha);
     config.policy_epsilon = absl::GetFlag(FLAGS_policy_epsilon);
     config.temperature = absl::GetFlag(FLAGS_temperature);
@@ -157,9 +193,13 @@ int main(int argc, char** argv) {
     config.cutoff_probability = absl::GetFlag(FLAGS_cutoff_probability);
     config.cutoff_value = absl::GetFlag(FLAGS_cutoff_value);
     config.actors = absl::GetFlag(FLAGS_actors);
+    config.games_per_actor = absl::GetFlag(FLAGS_games_per_actor);
     config.evaluators = absl::GetFlag(FLAGS_evaluators);
     config.eval_levels = absl::GetFlag(FLAGS_eval_levels);
     config.max_steps = absl::GetFlag(FLAGS_max_steps);
+    config.actor_affinity = absl::GetFlag(FLAGS_actor_affinity);
+    config.evaluator_affinity = absl::GetFlag(FLAGS_evaluator_affinity);
+    config.learner_affinity = absl::GetFlag(FLAGS_learner_affinity);
   }
 
   return !AlphaZero(config, &stop_token, resuming);
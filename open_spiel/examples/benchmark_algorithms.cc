@@ -0,0 +1,221 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmarks for the algorithm hot paths (as opposed to benchmark_game,
+// which only exercises raw game operations). Each benchmark prints one CSV
+// line "benchmark,game,work,seconds,rate" to stdout so that regressions can
+// be tracked mechanically; pass --csv_header to emit the column names first.
+//
+// The set of games per benchmark is a flag. The defaults exercise the games
+// we care about most: the poker games for the tree-walking algorithms (CFR
+// needs a tractable tree; IS-MCTS needs ResampleFromInfostate, which durak
+// does not implement), and durak / durak_with_transfers for the simulation,
+// tensor and clone paths.
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/flags/flag.h"
+#include "open_spiel/abseil-cpp/absl/flags/parse.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/algorithms/cfr.h"
+#include "open_spiel/algorithms/is_mcts.h"
+#include "open_spiel/algorithms/mcts.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+ABSL_FLAG(std::string, cfr_games, "kuhn_poker,leduc_poker",
+          "Games for the CFR iteration benchmark (full tree traversals; "
+          "keep these small).");
+ABSL_FLAG(std::string, mcts_games,
+          "tic_tac_toe,durak,durak_with_transfers",
+          "Games for the MCTS simulations/sec benchmark.");
+ABSL_FLAG(std::string, is_mcts_games, "kuhn_poker,leduc_poker",
+          "Games for the IS-MCTS decisions/sec benchmark. These must "
+          "implement State::ResampleFromInfostate.");
+ABSL_FLAG(std::string, tensor_games, "durak,durak_with_transfers",
+          "Games for the observation-tensor fill benchmark.");
+ABSL_FLAG(std::string, clone_games, "durak,durak_with_transfers",
+          "Games for the State::Clone throughput benchmark.");
+ABSL_FLAG(int, cfr_iterations, 10, "CFR iterations to time per game.");
+ABSL_FLAG(int, mcts_simulations, 2000, "MCTS simulations per measured step.");
+ABSL_FLAG(int, is_mcts_simulations, 200, "Simulations per IS-MCTS decision.");
+ABSL_FLAG(int, tensor_fills, 20000, "Observation tensor fills to time.");
+ABSL_FLAG(int, clones, 20000, "State clones to time.");
+ABSL_FLAG(int, seed, 1234, "Seed for all randomized benchmarks.");
+ABSL_FLAG(bool, csv_header, true, "Whether to print the CSV header line.");
+
+namespace open_spiel {
+namespace {
+
+void Report(const std::string& benchmark, const std::string& game, int64_t work,
+            double seconds, const char* rate_unit) {
+  std::cout << absl::StrFormat("%s,%s,%d,%.6f,%.1f\n", benchmark, game, work,
+                               seconds, work / seconds);
+  (void)rate_unit;
+}
+
+// Advances the state past any chance nodes (e.g. the durak deal) so that the
+// search benchmarks start from a decision node.
+void SkipChanceNodes(State* state, std::mt19937* rng) {
+  while (state->IsChanceNode()) {
+    ActionsAndProbs outcomes = state->ChanceOutcomes();
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    state->ApplyAction(SampleAction(outcomes, dist(*rng)).first);
+  }
+}
+
+// Plays a uniform-random move at a decision node.
+void ApplyRandomAction(State* state, std::mt19937* rng) {
+  std::vector<Action> actions = state->LegalActions();
+  std::uniform_int_distribution<int> dist(0, actions.size() - 1);
+  state->ApplyAction(actions[dist(*rng)]);
+}
+
+void BenchmarkCfr(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  algorithms::CFRSolver solver(*game);
+  const int iterations = absl::GetFlag(FLAGS_cfr_iterations);
+  // One untimed iteration so table construction is not billed to the loop.
+  solver.EvaluateAndUpdatePolicy();
+  absl::Time start = absl::Now();
+  for (int i = 0; i < iterations; ++i) {
+    solver.EvaluateAndUpdatePolicy();
+  }
+  double seconds = absl::ToDoubleSeconds(absl::Now() - start);
+  Report("cfr_iterations", game_name, iterations, seconds, "iters/s");
+}
+
+void BenchmarkMcts(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  std::mt19937 rng(absl::GetFlag(FLAGS_seed));
+  const int simulations = absl::GetFlag(FLAGS_mcts_simulations);
+  auto evaluator = std::make_shared<algorithms::RandomRolloutEvaluator>(
+      /*n_rollouts=*/1, absl::GetFlag(FLAGS_seed));
+  algorithms::MCTSBot bot(*game, evaluator, /*uct_c=*/2.0, simulations,
+                          /*max_memory_mb=*/1000, /*solve=*/false,
+                          /*seed=*/absl::GetFlag(FLAGS_seed),
+                          /*verbose=*/false);
+  std::unique_ptr<State> state = game->NewInitialState();
+  SkipChanceNodes(state.get(), &rng);
+  absl::Time start = absl::Now();
+  bot.Step(*state);
+  double seconds = absl::ToDoubleSeconds(absl::Now() - start);
+  Report("mcts_simulations", game_name, simulations, seconds, "sims/s");
+}
+
+void BenchmarkIsMcts(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  std::mt19937 rng(absl::GetFlag(FLAGS_seed));
+  auto evaluator = std::make_shared<algorithms::RandomRolloutEvaluator>(
+      /*n_rollouts=*/1, absl::GetFlag(FLAGS_seed));
+  algorithms::ISMCTSBot bot(absl::GetFlag(FLAGS_seed), evaluator,
+                            /*uct_c=*/2.0,
+                            absl::GetFlag(FLAGS_is_mcts_simulations));
+  // Time every decision across one full playthrough.
+  std::unique_ptr<State> state = game->NewInitialState();
+  int decisions = 0;
+  double seconds = 0;
+  while (!state->IsTerminal()) {
+    if (state->IsChanceNode()) {
+      SkipChanceNodes(state.get(), &rng);
+      continue;
+    }
+    absl::Time start = absl::Now();
+    Action action = bot.Step(*state);
+    seconds += absl::ToDoubleSeconds(absl::Now() - start);
+    ++decisions;
+    state->ApplyAction(action);
+  }
+  Report("is_mcts_decisions", game_name, decisions, seconds, "decisions/s");
+}
+
+void BenchmarkTensorFill(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  SPIEL_CHECK_TRUE(game->GetType().provides_observation_tensor);
+  std::mt19937 rng(absl::GetFlag(FLAGS_seed));
+  std::unique_ptr<State> state = game->NewInitialState();
+  SkipChanceNodes(state.get(), &rng);
+  // Walk to roughly mid-game so the observation is representative.
+  for (int i = 0; i < 6 && !state->IsTerminal(); ++i) {
+    ApplyRandomAction(state.get(), &rng);
+    SkipChanceNodes(state.get(), &rng);
+  }
+  const Player player =
+      state->CurrentPlayer() >= 0 ? state->CurrentPlayer() : Player{0};
+  std::vector<float> buffer(game->ObservationTensorSize());
+  const int fills = absl::GetFlag(FLAGS_tensor_fills);
+  absl::Time start = absl::Now();
+  for (int i = 0; i < fills; ++i) {
+    state->ObservationTensor(player, absl::MakeSpan(buffer));
+  }
+  double seconds = absl::ToDoubleSeconds(absl::Now() - start);
+  Report("tensor_fills", game_name, fills, seconds, "fills/s");
+}
+
+void BenchmarkClone(const std::string& game_name) {
+  std::shared_ptr<const Game> game = LoadGame(game_name);
+  std::mt19937 rng(absl::GetFlag(FLAGS_seed));
+  std::unique_ptr<State> state = game->NewInitialState();
+  SkipChanceNodes(state.get(), &rng);
+  for (int i = 0; i < 6 && !state->IsTerminal(); ++i) {
+    ApplyRandomAction(state.get(), &rng);
+    SkipChanceNodes(state.get(), &rng);
+  }
+  const int clones = absl::GetFlag(FLAGS_clones);
+  absl::Time start = absl::Now();
+  for (int i = 0; i < clones; ++i) {
+    std::unique_ptr<State> clone = state->Clone();
+    // Touch the clone so the copy can't be elided.
+    if (clone->MoveNumber() < 0) SpielFatalError("Unexpected move number.");
+  }
+  double seconds = absl::ToDoubleSeconds(absl::Now() - start);
+  Report("clones", game_name, clones, seconds, "clones/s");
+}
+
+void RunAll() {
+  if (absl::GetFlag(FLAGS_csv_header)) {
+    std::cout << "benchmark,game,work,seconds,rate" << std::endl;
+  }
+  for (const auto& game :
+       absl::StrSplit(absl::GetFlag(FLAGS_cfr_games), ',', absl::SkipEmpty()))
+    BenchmarkCfr(std::string(game));
+  for (const auto& game :
+       absl::StrSplit(absl::GetFlag(FLAGS_mcts_games), ',', absl::SkipEmpty()))
+    BenchmarkMcts(std::string(game));
+  for (const auto& game : absl::StrSplit(absl::GetFlag(FLAGS_is_mcts_games),
+                                         ',', absl::SkipEmpty()))
+    BenchmarkIsMcts(std::string(game));
+  for (const auto& game : absl::StrSplit(absl::GetFlag(FLAGS_tensor_games),
+                                         ',', absl::SkipEmpty()))
+    BenchmarkTensorFill(std::string(game));
+  for (const auto& game :
+       absl::StrSplit(absl::GetFlag(FLAGS_clone_games), ',',
+                      absl::SkipEmpty()))
+    BenchmarkClone(std::string(game));
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+  open_spiel::RunAll();
+}
@@ -101,6 +101,7 @@ void RunFSICFR() {
   std::cout << "Graph has " << graph->size() << " nodes." << std::endl;
   std::cout << "Topologically sorting the nodes." << std::endl;
   graph->TopSort();
+  graph->Finalize({6, 6});
   FSICFRSolver solver(*game, kSeed, {6, 6}, graph.get());
 
   std::cout << "Running iterations" << std::endl;
@@ -0,0 +1,106 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Microbenchmark for CFRInfoStateValues::ApplyRegretMatching, comparing the
+// vectorized kernel against a scalar reference implementation over a mix of
+// action counts typical of card games.
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "open_spiel/algorithms/cfr.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+// The pre-vectorization implementation, kept here as the baseline.
+void ScalarRegretMatching(algorithms::CFRInfoStateValues* values) {
+  double sum_positive_regrets = 0.0;
+  for (int aidx = 0; aidx < values->num_actions(); ++aidx) {
+    if (values->cumulative_regrets[aidx] > 0) {
+      sum_positive_regrets += values->cumulative_regrets[aidx];
+    }
+  }
+  for (int aidx = 0; aidx < values->num_actions(); ++aidx) {
+    if (sum_positive_regrets > 0) {
+      values->current_policy[aidx] =
+          values->cumulative_regrets[aidx] > 0
+              ? values->cumulative_regrets[aidx] / sum_positive_regrets
+              : 0;
+    } else {
+      values->current_policy[aidx] = 1.0 / values->legal_actions.size();
+    }
+  }
+}
+
+void RunBenchmark(int num_infostates, int num_rounds) {
+  std::mt19937 rng(17);
+  std::uniform_real_distribution<double> regret_dist(-1.0, 1.0);
+  std::uniform_int_distribution<int> actions_dist(2, 16);
+
+  std::vector<algorithms::CFRInfoStateValues> table;
+  table.reserve(num_infostates);
+  for (int i = 0; i < num_infostates; ++i) {
+    int num_actions = actions_dist(rng);
+    std::vector<Action> actions(num_actions);
+    for (int a = 0; a < num_actions; ++a) actions[a] = a;
+    table.emplace_back(actions);
+    for (int a = 0; a < num_actions; ++a) {
+      table.back().cumulative_regrets[a] = regret_dist(rng);
+    }
+  }
+
+  auto time_pass = [&](auto&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < num_rounds; ++round) {
+      for (auto& values : table) fn(&values);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+  };
+
+  double scalar_secs =
+      time_pass([](algorithms::CFRInfoStateValues* v) {
+        ScalarRegretMatching(v);
+      });
+  double kernel_secs =
+      time_pass([](algorithms::CFRInfoStateValues* v) {
+        v->ApplyRegretMatching();
+      });
+
+  // The two must agree (modulo summation order) on every infostate.
+  for (auto& values : table) {
+    std::vector<double> kernel_policy(values.current_policy.begin(),
+                                      values.current_policy.end());
+    ScalarRegretMatching(&values);
+    for (int a = 0; a < values.num_actions(); ++a) {
+      SPIEL_CHECK_FLOAT_EQ(kernel_policy[a], values.current_policy[a]);
+    }
+  }
+
+  std::printf("infostates=%d rounds=%d scalar=%.3fs kernel=%.3fs (%.2fx)\n",
+              num_infostates, num_rounds, scalar_secs, kernel_secs,
+              scalar_secs / kernel_secs);
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::RunBenchmark(/*num_infostates=*/100000, /*num_rounds=*/100);
+  return 0;
+}
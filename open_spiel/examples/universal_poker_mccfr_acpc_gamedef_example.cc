@@ -49,6 +49,9 @@ END GAMEDEF
 ABSL_FLAG(std::string, acpc_gamedef, kCustom3PlayerAcpcGamedef,
           "ACPC gamedef.");
 ABSL_FLAG(int, num_iters, 2000, "How many iters to run for.");
+ABSL_FLAG(bool, suit_isomorphism, false,
+          "Merge suit-isomorphic deals into one infostate (lossless for "
+          "equilibrium computation; shrinks the MCCFR tables).");
 // Note: reporting exploitability too frequently can be expensive!
 ABSL_FLAG(int, report_every, 500, "How often to report exploitability.");
 
@@ -62,6 +65,13 @@ int main(int argc, char** argv) {
   std::shared_ptr<const open_spiel::Game> game =
       open_spiel::universal_poker::LoadUniversalPokerGameFromACPCGamedef(
           absl::GetFlag(FLAGS_acpc_gamedef));
+  if (absl::GetFlag(FLAGS_suit_isomorphism)) {
+    // ACPC gamedefs cannot express OpenSpiel-only parameters, so reload the
+    // converted game with suit canonicalization turned on.
+    open_spiel::GameParameters params = game->GetParameters();
+    params["suitIsomorphism"] = open_spiel::GameParameter(true);
+    game = open_spiel::LoadGame("universal_poker", params);
+  }
 
   // Downcasting to UniversalPokerGame so we can call GetACPCGame(), which isn't
   // on the higher level open_spiel::Game.
@@ -14,6 +14,7 @@
 
 #include "open_spiel/game_parameters.h"
 
+#include <algorithm>
 #include <list>
 #include <map>
 #include <string>
@@ -169,6 +170,23 @@ std::string GameParametersToString(const GameParameters& game_params) {
   return str;
 }
 
+CompiledGameParameters::CompiledGameParameters(const GameParameters& params)
+    : text_(GameParametersToString(params)) {
+  names_.reserve(params.size());
+  values_.reserve(params.size());
+  // GameParameters is an ordered map, so the ids come out sorted by name.
+  for (const auto& [name, value] : params) {
+    names_.push_back(name);
+    values_.push_back(value);
+  }
+}
+
+int CompiledGameParameters::FieldId(const std::string& name) const {
+  auto it = std::lower_bound(names_.begin(), names_.end(), name);
+  if (it == names_.end() || *it != name) return kInvalidFieldId;
+  return static_cast<int>(it - names_.begin());
+}
+
 GameParameter GameParameterFromString(const std::string& str) {
   if (str == "True" || str == "true") {
     return GameParameter(true);
@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/spiel_utils.h"
@@ -204,6 +205,47 @@ inline bool IsParameterSpecified(const GameParameters& table,
   return table.find(key) != table.end();
 }
 
+// A GameParameters map compiled once into a flat, typed block for hot
+// paths. Field names are resolved to small integer ids a single time
+// (FieldId), after which every read is an index into a vector — no
+// string-keyed map search per access. The canonical text form
+// (GameParametersToString) is rendered once at construction and returned by
+// const reference, so string round-trips of an unchanged parameter set
+// allocate nothing per call.
+class CompiledGameParameters {
+ public:
+  static constexpr int kInvalidFieldId = -1;
+
+  explicit CompiledGameParameters(const GameParameters& params);
+
+  // Number of fields; valid ids are [0, NumFields()).
+  int NumFields() const { return static_cast<int>(names_.size()); }
+
+  // The id for `name`, or kInvalidFieldId if the parameter is absent.
+  // O(log n) string comparisons; resolve once at setup and keep the id.
+  int FieldId(const std::string& name) const;
+
+  const std::string& FieldName(int id) const { return names_[id]; }
+  GameParameter::Type FieldType(int id) const { return values_[id].type(); }
+
+  // Typed reads; reading a field as the wrong type fails the same checks as
+  // GameParameter's accessors.
+  int IntValue(int id) const { return values_[id].int_value(); }
+  double DoubleValue(int id) const { return values_[id].double_value(); }
+  const std::string& StringValue(int id) const {
+    return values_[id].string_value();
+  }
+  bool BoolValue(int id) const { return values_[id].bool_value(); }
+
+  // The cached GameParametersToString rendering of the parameter set.
+  const std::string& ToString() const { return text_; }
+
+ private:
+  std::vector<std::string> names_;     // Sorted; the id is the index.
+  std::vector<GameParameter> values_;  // Parallel to names_.
+  std::string text_;
+};
+
 template <typename T>
 T ParameterValue(const GameParameters& params, const std::string& key,
                  absl::optional<T> default_value = absl::nullopt) {
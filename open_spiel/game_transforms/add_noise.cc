@@ -14,6 +14,8 @@
 
 #include "open_spiel/game_transforms/add_noise.h"
 
+#include <cstdint>
+
 #include "open_spiel/spiel.h"
 
 namespace open_spiel {
@@ -58,30 +60,35 @@ std::shared_ptr<const Game> Factory(const GameParameters& params) {
 
 REGISTER_SPIEL_GAME(kGameType, Factory);
 
+// Finalizer from the splitmix64 generator; bijective, so distinct rolling
+// hashes stay distinct through the mix.
+uint64_t SplitMix64(uint64_t z) {
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+constexpr uint64_t kInitialHistoryHash = 0x6e6f697379757469ULL;
+
 }  // namespace
 
 AddNoiseGame::AddNoiseGame(std::shared_ptr<const Game> game, GameType game_type,
                            GameParameters game_parameters)
     : WrappedGame(game, game_type, game_parameters),
       epsilon_(ParameterValue<double>("epsilon")),
-      rng_(ParameterValue<int>("seed")) {}
+      seed_(static_cast<uint64_t>(ParameterValue<int>("seed"))) {}
 
 std::unique_ptr<State> AddNoiseGame::NewInitialState() const {
   return std::make_unique<AddNoiseState>(shared_from_this(),
                                          game_->NewInitialState());
 }
 
-double AddNoiseGame::GetNoise(const AddNoiseState& state) {
-  std::string state_str = state.HistoryString();
-  auto it = noise_table_.find(state_str);
-  if (it != noise_table_.end()) {
-    return it->second;
-  }
-
-  std::uniform_real_distribution<double> dist(-epsilon_, epsilon_);
-  double noise = dist(rng_);
-  noise_table_[state_str] = noise;
-  return noise;
+double AddNoiseGame::GetNoise(const AddNoiseState& state) const {
+  // Deterministic in (seed, action sequence): the top 53 bits of the mixed
+  // hash give a uniform draw from [0, 1), mapped to [-epsilon, epsilon].
+  uint64_t mixed = SplitMix64(state.history_hash() ^ SplitMix64(seed_));
+  double uniform = (mixed >> 11) * (1.0 / 9007199254740992.0);  // 2^-53.
+  return (2.0 * uniform - 1.0) * epsilon_;
 }
 
 double AddNoiseGame::MaxUtility() const {
@@ -94,15 +101,30 @@ double AddNoiseGame::MinUtility() const {
 
 AddNoiseState::AddNoiseState(std::shared_ptr<const Game> transformed_game,
                              std::unique_ptr<State> state)
-    : WrappedState(transformed_game, std::move(state)) {}
+    : WrappedState(transformed_game, std::move(state)),
+      history_hash_(kInitialHistoryHash) {}
+
+void AddNoiseState::DoApplyAction(Action action_id) {
+  WrappedState::DoApplyAction(action_id);
+  history_hash_ =
+      SplitMix64(history_hash_ + static_cast<uint64_t>(action_id) +
+                 0x9e3779b97f4a7c15ULL);
+}
+
+void AddNoiseState::DoApplyActions(const std::vector<Action>& actions) {
+  WrappedState::DoApplyActions(actions);
+  for (Action action : actions) {
+    history_hash_ = SplitMix64(history_hash_ + static_cast<uint64_t>(action) +
+                               0x9e3779b97f4a7c15ULL);
+  }
+}
 
 std::vector<double> AddNoiseState::Returns() const {
   std::vector<double> returns = state_->Returns();
   SPIEL_CHECK_EQ(returns.size(), 2);
 
   if (state_->IsTerminal()) {
-    auto const_noise_game = down_cast<const AddNoiseGame*>(game_.get());
-    AddNoiseGame* noise_game = const_cast<AddNoiseGame*>(const_noise_game);
+    auto noise_game = down_cast<const AddNoiseGame*>(game_.get());
     double noise = noise_game->GetNoise(*this);
     returns[0] += noise;
     returns[1] -= noise;
@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_GAME_TRANSFORMS_ADD_NOISE_H_
 #define OPEN_SPIEL_GAME_TRANSFORMS_ADD_NOISE_H_
 
+#include <cstdint>
 #include <memory>
 
 #include "open_spiel/game_transforms/game_wrapper.h"
@@ -26,6 +27,11 @@
 // The noise is sampled from uniform distribution of [-epsilon, epsilon]
 // independently for each terminal history.
 // The transformation can be seeded for reproducibility.
+//
+// The noise for a terminal is derived from a 64-bit hash of the action
+// sequence, rolled forward incrementally as actions are applied, so querying
+// terminal utilities costs O(1) instead of hashing the whole history string
+// per evaluation.
 
 namespace open_spiel {
 namespace add_noise {
@@ -39,6 +45,16 @@ class AddNoiseState : public WrappedState {
   }
   std::vector<double> Returns() const override;
   std::vector<double> Rewards() const override;
+
+  // Rolling hash of the action sequence leading to this state.
+  uint64_t history_hash() const { return history_hash_; }
+
+ protected:
+  void DoApplyAction(Action action_id) override;
+  void DoApplyActions(const std::vector<Action>& actions) override;
+
+ private:
+  uint64_t history_hash_;
 };
 
 class AddNoiseGame : public WrappedGame {
@@ -46,7 +62,10 @@ class AddNoiseGame : public WrappedGame {
   AddNoiseGame(std::shared_ptr<const Game> game, GameType game_type,
                GameParameters game_parameters);
   std::unique_ptr<State> NewInitialState() const override;
-  double GetNoise(const AddNoiseState& state);
+
+  // The terminal noise, a deterministic function of the seed and the state's
+  // rolling action hash.
+  double GetNoise(const AddNoiseState& state) const;
 
   double MinUtility() const override;
 
@@ -54,8 +73,7 @@ class AddNoiseGame : public WrappedGame {
 
  private:
   const double epsilon_;
-  std::mt19937 rng_;
-  std::unordered_map<std::string, double> noise_table_;
+  const uint64_t seed_;
 };
 
 }  // namespace add_noise
@@ -14,6 +14,10 @@
 
 #include "open_spiel/game_transforms/add_noise.h"
 
+#include <cmath>
+#include <memory>
+#include <vector>
+
 #include "open_spiel/spiel.h"
 #include "open_spiel/tests/basic_tests.h"
 
@@ -29,8 +33,44 @@ void BasicTests() {
       *LoadGame("add_noise(epsilon=1.,seed=1,game=kuhn_poker())"), 100);
 }
 
+void NoiseDeterminismTests() {
+  std::shared_ptr<const Game> game =
+      LoadGame("add_noise(epsilon=0.5,seed=17,game=kuhn_poker())");
+  std::shared_ptr<const Game> same_seed =
+      LoadGame("add_noise(epsilon=0.5,seed=17,game=kuhn_poker())");
+  std::shared_ptr<const Game> other_seed =
+      LoadGame("add_noise(epsilon=0.5,seed=18,game=kuhn_poker())");
+
+  const std::vector<Action> actions = {2, 1, 0, 1, 1};
+  auto play_out = [&actions](const Game& g) {
+    std::unique_ptr<State> state = g.NewInitialState();
+    for (Action action : actions) state->ApplyAction(action);
+    SPIEL_CHECK_TRUE(state->IsTerminal());
+    return state->Returns();
+  };
+
+  // The noise is a pure function of (seed, action sequence): re-walking the
+  // same terminal, in the same or another game instance, gives identical
+  // returns, and querying twice changes nothing.
+  std::vector<double> returns = play_out(*game);
+  SPIEL_CHECK_TRUE(returns == play_out(*game));
+  SPIEL_CHECK_TRUE(returns == play_out(*same_seed));
+  SPIEL_CHECK_FALSE(returns == play_out(*other_seed));
+
+  // Zero-sum noise within the epsilon bound.
+  std::unique_ptr<State> plain_state =
+      LoadGame("kuhn_poker")->NewInitialState();
+  for (Action action : actions) plain_state->ApplyAction(action);
+  std::vector<double> plain = plain_state->Returns();
+  SPIEL_CHECK_FLOAT_NEAR(returns[0] + returns[1], plain[0] + plain[1], 1e-12);
+  SPIEL_CHECK_LE(std::abs(returns[0] - plain[0]), 0.5);
+}
+
 }  // namespace
 }  // namespace add_noise
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::add_noise::BasicTests(); }
+int main(int argc, char** argv) {
+  open_spiel::add_noise::BasicTests();
+  open_spiel::add_noise::NoiseDeterminismTests();
+}
@@ -50,11 +50,19 @@ const GameType kGameType{
     /*provides_observation_string=*/true,
     /*provides_observation_tensor=*/true,
     {{"game",
-      GameParameter(GameParameter::Type::kGame, /*is_mandatory=*/true)}},
+      GameParameter(GameParameter::Type::kGame, /*is_mandatory=*/true)},
+     // Opt-in: merge states whose ToString() matches into a single node.
+     // Only safe for games whose state string is canonical.
+     {"merge_transpositions", GameParameter(false)}},
     /*default_loadable=*/false};
 
 std::shared_ptr<const Game> Factory(const GameParameters& params) {
-  return ConvertToCachedTree(*LoadGame(params.at("game").game_value()));
+  const bool merge_transpositions =
+      params.count("merge_transpositions") > 0
+          ? params.at("merge_transpositions").bool_value()
+          : false;
+  return ConvertToCachedTree(*LoadGame(params.at("game").game_value()),
+                             merge_transpositions);
 }
 
 REGISTER_SPIEL_GAME(kGameType, Factory);
@@ -68,9 +76,11 @@ GameType ConvertType(GameType type) {
   return type;
 }
 
-GameParameters ConvertParams(const GameType& type, GameParameters params) {
+GameParameters ConvertParams(const GameType& type, GameParameters params,
+                             bool merge_transpositions) {
   params["name"] = GameParameter(type.short_name);
   GameParameters new_params{{"game", GameParameter{params}}};
+  new_params["merge_transpositions"] = GameParameter(merge_transpositions);
   return new_params;
 }
 
@@ -241,15 +251,39 @@ std::vector<Action> CachedTreeState::ActionsConsistentWithInformationFrom(
   return legal_actions_consistent_with_information_from;
 }
 
+Node* CachedTreeGame::NewNode() const {
+  nodes_.emplace_back();
+  return &nodes_.back();
+}
+
+Node* CachedTreeGame::NodeForState(std::unique_ptr<State> child_state) const {
+  if (merge_transpositions_) {
+    std::string key = child_state->ToString();
+    auto [iter, inserted] = transpositions_.try_emplace(key, nullptr);
+    if (!inserted) {
+      // Transposition: reuse the node reached earlier via a different move
+      // order; the freshly built state is discarded.
+      return iter->second;
+    }
+    Node* node = NewNode();
+    node->state = std::move(child_state);
+    // Keep the string we just computed.
+    node->to_string = std::move(key);
+    iter->second = node;
+    return node;
+  }
+  Node* node = NewNode();
+  node->state = std::move(child_state);
+  return node;
+}
+
 Node* CachedTreeGame::CreateChildNode(Node* parent,
                                       const CachedTreeState* state,
                                       Action action) const {
   SPIEL_CHECK_TRUE(parent != nullptr);
   SPIEL_CHECK_TRUE(state != nullptr);
   SPIEL_CHECK_TRUE(action != kInvalidAction);
-  nodes_.push_back(std::make_unique<Node>());
-  Node* child_node = nodes_.back().get();
-  child_node->state = parent->state->Child(action);
+  Node* child_node = NodeForState(parent->state->Child(action));
   parent->children[action] = child_node;
   return child_node;
 }
@@ -261,11 +295,9 @@ Node* CachedTreeGame::CreateChildNode(
   SPIEL_CHECK_TRUE(parent != nullptr);
   SPIEL_CHECK_TRUE(state != nullptr);
   SPIEL_CHECK_FALSE(joint_action.empty());
-  nodes_.push_back(std::make_unique<Node>());
-  Node* child_node = nodes_.back().get();
   auto actual_child_state = parent->state->Clone();
   actual_child_state->ApplyActions(joint_action);
-  child_node->state = std::move(actual_child_state);
+  Node* child_node = NodeForState(std::move(actual_child_state));
   parent->joint_action_children[joint_action] = child_node;
   return child_node;
 }
@@ -273,9 +305,9 @@ Node* CachedTreeGame::CreateChildNode(
 std::unique_ptr<State> CachedTreeGame::NewInitialState() const {
   if (root_ == nullptr) {
     SPIEL_CHECK_EQ(nodes_.size(), 0);
-    nodes_.push_back(std::make_unique<Node>());
-    root_ = nodes_.back().get();
-    root_->state = game_->NewInitialState();
+    // NodeForState also registers the root in the transposition map, so a
+    // path transposing back to the initial state merges into it.
+    root_ = NodeForState(game_->NewInitialState());
   }
   return std::make_unique<CachedTreeState>(shared_from_this(), root_);
 }
@@ -294,24 +326,30 @@ double CachedTreeGame::MaxUtility() const {
   return max_utility_.value();
 }
 
-CachedTreeGame::CachedTreeGame(std::shared_ptr<const Game> game)
+CachedTreeGame::CachedTreeGame(std::shared_ptr<const Game> game,
+                               bool merge_transpositions)
     : WrappedGame(game, ConvertType(game->GetType()),
-                  ConvertParams(game->GetType(), game->GetParameters())) {}
+                  ConvertParams(game->GetType(), game->GetParameters(),
+                                merge_transpositions)),
+      merge_transpositions_(merge_transpositions) {}
 
-std::shared_ptr<const Game> ConvertToCachedTree(const Game& game) {
+std::shared_ptr<const Game> ConvertToCachedTree(const Game& game,
+                                                bool merge_transpositions) {
   return std::shared_ptr<const CachedTreeGame>(
-      new CachedTreeGame(game.shared_from_this()));
+      new CachedTreeGame(game.shared_from_this(), merge_transpositions));
 }
 
-std::shared_ptr<const Game> LoadGameAsCachedTree(const std::string& name) {
+std::shared_ptr<const Game> LoadGameAsCachedTree(const std::string& name,
+                                                 bool merge_transpositions) {
   auto game = LoadGame(name);
-  return ConvertToCachedTree(*game);
+  return ConvertToCachedTree(*game, merge_transpositions);
 }
 
 std::shared_ptr<const Game> LoadGameAsCachedTree(const std::string& name,
-                                                const GameParameters& params) {
+                                                 const GameParameters& params,
+                                                 bool merge_transpositions) {
   auto game = LoadGame(name, params);
-  return ConvertToCachedTree(*game);
+  return ConvertToCachedTree(*game, merge_transpositions);
 }
 
 }  // namespace cached_tree
@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_GAME_TRANSFORMS_CACHED_TREE_H_
 #define OPEN_SPIEL_GAME_TRANSFORMS_CACHED_TREE_H_
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -32,6 +33,15 @@
 // A tree built dynamically built and cached in memory. This wrapper can be used
 // to speed up the traversals of the game tree and corresponding functions like
 // information state keys and tensors for games whose tree is not too large.
+//
+// With merge_transpositions=true, child nodes are additionally deduplicated by
+// the wrapped state's ToString(): two action sequences reaching states with
+// the same string share a single cached node (and its cached strings, tensors
+// and children). This turns the cached tree into a DAG and can shrink it
+// dramatically for games like durak where permuted move orders transpose into
+// identical states. Only enable it for games whose state string is canonical,
+// i.e. fully determines the state including whose turn it is and all hidden
+// information.
 
 namespace open_spiel {
 namespace cached_tree {
@@ -101,7 +111,8 @@ class CachedTreeState : public WrappedState {
 
 class CachedTreeGame : public WrappedGame {
  public:
-  explicit CachedTreeGame(std::shared_ptr<const Game> game);
+  explicit CachedTreeGame(std::shared_ptr<const Game> game,
+                          bool merge_transpositions = false);
   std::unique_ptr<State> NewInitialState() const override;
   double MinUtility() const override;
   double MaxUtility() const override;
@@ -113,18 +124,35 @@ class CachedTreeGame : public WrappedGame {
 
 
  private:
+  // Allocates a node from the arena. Addresses are stable for the lifetime of
+  // the game.
+  Node* NewNode() const;
+  // Returns the node for this freshly built state: with transposition merging
+  // enabled, an existing node with the same ToString() if there is one
+  // (discarding the passed state), otherwise a new arena node taking
+  // ownership of it.
+  Node* NodeForState(std::unique_ptr<State> child_state) const;
+
   // protected member game_ is inherited from WrappedGame.
+  const bool merge_transpositions_;
   mutable absl::optional<double> min_utility_;
   mutable absl::optional<double> max_utility_;
   mutable Node* root_ = nullptr;
-  mutable std::vector<std::unique_ptr<Node>> nodes_;
+  // Arena storage for the nodes: a deque allocates in blocks rather than one
+  // heap allocation per node, and never relocates existing elements.
+  mutable std::deque<Node> nodes_;
+  // Maps canonical state strings to their unique node when merging.
+  mutable absl::flat_hash_map<std::string, Node*> transpositions_;
 };
 
 // Helper function to convert
-std::shared_ptr<const Game> ConvertToCachedTree(const Game& game);
-std::shared_ptr<const Game> LoadGameAsCachedTree(const std::string& name);
-std::shared_ptr<const Game> LoadGameAsCachedTree(const std::string& name,
-                                                 const GameParameters& params);
+std::shared_ptr<const Game> ConvertToCachedTree(
+    const Game& game, bool merge_transpositions = false);
+std::shared_ptr<const Game> LoadGameAsCachedTree(
+    const std::string& name, bool merge_transpositions = false);
+std::shared_ptr<const Game> LoadGameAsCachedTree(
+    const std::string& name, const GameParameters& params,
+    bool merge_transpositions = false);
 
 
 }  // namespace cached_tree
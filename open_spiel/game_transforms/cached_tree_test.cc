@@ -67,6 +67,20 @@ void CFRTest(const Game& game,
   }
 }
 
+void TranspositionMergingTests() {
+  // Tic-tac-toe's state string is the board, which is canonical, and permuted
+  // move orders transpose heavily.
+  testing::LoadGameTest(
+      "cached_tree(game=tic_tac_toe(),merge_transpositions=true)");
+  testing::RandomSimTest(
+      *LoadGame("cached_tree(game=tic_tac_toe(),merge_transpositions=true)"),
+      10);
+  // CFR over the merged tree must reach the same equilibrium as over the
+  // unmerged one.
+  CFRTest(*LoadGame("cached_tree(game=kuhn_poker(),merge_transpositions=true)"),
+          300, -1.0 / 18.0, 0.001, 0.05);
+}
+
 void CFRTest_KuhnPoker() {
   CFRTest(*LoadGame("cached_tree(game=kuhn_poker())"), 300, -1.0 / 18.0, 0.001,
            0.05);
@@ -83,6 +97,7 @@ void CFRTest_LeducPoker() {
 int main(int argc, char** argv) {
   open_spiel::Init("", &argc, &argv, false);
   open_spiel::cached_tree::BasicTests();
+  open_spiel::cached_tree::TranspositionMergingTests();
   open_spiel::cached_tree::CFRTest_KuhnPoker();
   open_spiel::cached_tree::CFRTest_LeducPoker();
 }
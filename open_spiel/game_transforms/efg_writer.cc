@@ -14,12 +14,15 @@
 
 #include "open_spiel/game_transforms/efg_writer.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
 
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 
@@ -55,11 +58,13 @@ void EFGWriter::Write() {
   efg_file.close();
 }
 
-void EFGWriter::Write(std::ostream& f, const State& state) {
+void EFGWriter::WriteNode(std::ostream& f, const State& state,
+                          int* chance_counter, int* terminal_counter,
+                          bool allow_new_infostates) {
   if (state.IsTerminal()) {
     f << "t \"\" ";
-    f << terminal_node_counter_;
-    terminal_node_counter_++;
+    f << *terminal_counter;
+    (*terminal_counter)++;
     f << " \"\" ";
     f << "{ ";
     for (auto r : state.Returns()) {
@@ -69,8 +74,8 @@ void EFGWriter::Write(std::ostream& f, const State& state) {
     return;
   } else if (state.IsChanceNode()) {
     f << "c \"\" ";
-    f << chance_node_counter_;
-    chance_node_counter_++;
+    f << *chance_counter;
+    (*chance_counter)++;
     f << " \"\" ";
     f << "{ ";
     for (auto action_and_probs : state.ChanceOutcomes()) {
@@ -90,10 +95,16 @@ void EFGWriter::Write(std::ostream& f, const State& state) {
     int idx = state.CurrentPlayer();
     if (!separate_infostate_numbers_) idx = 0;  // Only use one map.
 
-    if (infostate_numbers_[idx].find(key) == infostate_numbers_[idx].end()) {
-      infostate_numbers_[idx][key] = infostate_numbers_[idx].size();
+    auto it = infostate_numbers_[idx].find(key);
+    if (it == infostate_numbers_[idx].end()) {
+      if (!allow_new_infostates) {
+        SpielFatalError("EFGWriter: infostate missing from numbering pass.");
+      }
+      it = infostate_numbers_[idx]
+               .emplace(key, infostate_numbers_[idx].size())
+               .first;
     }
-    f << infostate_numbers_[idx][key] + 1;  // Infostate numbering starts at 1.
+    f << it->second + 1;  // Infostate numbering starts at 1.
     f << " \"\" { ";
     for (auto action : state.LegalActions()) {
       if (action_names_) {
@@ -104,9 +115,152 @@ void EFGWriter::Write(std::ostream& f, const State& state) {
     }
     f << "} 0\n";
   }
+}
+
+void EFGWriter::Write(std::ostream& f, const State& state) {
+  WriteNode(f, state, &chance_node_counter_, &terminal_node_counter_,
+            /*allow_new_infostates=*/true);
+  if (state.IsTerminal()) return;
   for (auto action : state.LegalActions()) {
     Write(f, *state.Child(action));
   }
 }
 
+void EFGWriter::CollectSubtree(
+    const State& state, std::vector<std::map<std::string, int>>* seen,
+    std::vector<std::vector<std::string>>* first_visits, int* chance_nodes,
+    int* terminal_nodes) const {
+  if (state.IsTerminal()) {
+    (*terminal_nodes)++;
+    return;
+  }
+  if (state.IsChanceNode()) {
+    (*chance_nodes)++;
+  } else {
+    std::string key = state.InformationStateString();
+    int idx = separate_infostate_numbers_ ? state.CurrentPlayer() : 0;
+    if ((*seen)[idx].emplace(key, (*seen)[idx].size()).second) {
+      (*first_visits)[idx].push_back(std::move(key));
+    }
+  }
+  for (auto action : state.LegalActions()) {
+    CollectSubtree(*state.Child(action), seen, first_visits, chance_nodes,
+                   terminal_nodes);
+  }
+}
+
+void EFGWriter::EmitSubtree(std::ostream& f, const State& state,
+                            int* chance_counter, int* terminal_counter) {
+  WriteNode(f, state, chance_counter, terminal_counter,
+            /*allow_new_infostates=*/false);
+  if (state.IsTerminal()) return;
+  for (auto action : state.LegalActions()) {
+    EmitSubtree(f, *state.Child(action), chance_counter, terminal_counter);
+  }
+}
+
+void EFGWriter::Write(int num_threads) {
+  SPIEL_CHECK_GE(num_threads, 1);
+  if (num_threads == 1) {
+    Write();
+    return;
+  }
+
+  std::ofstream efg_file(filename_);
+  efg_file << "EFG 2 R";
+  efg_file << " \"" << game_.ToString() << "\" { ";
+  infostate_numbers_.clear();
+  for (int i = 1; i <= game_.NumPlayers(); i++) {
+    efg_file << '"' << "Player " << i << "\" ";
+    infostate_numbers_.push_back(std::map<std::string, int>());
+  }
+  efg_file << "}\n";
+  chance_node_counter_ = 1;
+  terminal_node_counter_ = 1;
+
+  // The root's record is written sequentially; the subtrees under its
+  // actions are the parallel work units.
+  std::unique_ptr<State> root = game_.NewInitialState();
+  WriteNode(efg_file, *root, &chance_node_counter_, &terminal_node_counter_,
+            /*allow_new_infostates=*/true);
+  if (root->IsTerminal()) return;
+  const std::vector<Action> root_actions = root->LegalActions();
+  const int num_subtrees = static_cast<int>(root_actions.size());
+  const int num_maps = static_cast<int>(infostate_numbers_.size());
+
+  // Numbering pass: per-subtree node counts and first-visit infostates.
+  std::vector<std::vector<std::vector<std::string>>> first_visits(
+      num_subtrees,
+      std::vector<std::vector<std::string>>(num_maps));
+  std::vector<int> chance_nodes(num_subtrees, 0);
+  std::vector<int> terminal_nodes(num_subtrees, 0);
+  {
+    const int num_workers = std::min(num_threads, num_subtrees);
+    std::vector<Thread> workers;
+    workers.reserve(num_workers);
+    for (int w = 0; w < num_workers; ++w) {
+      workers.emplace_back([this, w, num_workers, num_subtrees, num_maps,
+                            &root, &root_actions, &first_visits, &chance_nodes,
+                            &terminal_nodes]() {
+        for (int i = w; i < num_subtrees; i += num_workers) {
+          std::vector<std::map<std::string, int>> seen(num_maps);
+          CollectSubtree(*root->Child(root_actions[i]), &seen,
+                         &first_visits[i], &chance_nodes[i],
+                         &terminal_nodes[i]);
+        }
+      });
+    }
+    for (Thread& worker : workers) worker.join();
+  }
+
+  // Stitch the numbering together in subtree order: first-visit order per
+  // subtree, subtrees in order, is exactly the sequential first-visit order.
+  std::vector<int> chance_offsets(num_subtrees);
+  std::vector<int> terminal_offsets(num_subtrees);
+  for (int i = 0; i < num_subtrees; ++i) {
+    chance_offsets[i] = chance_node_counter_;
+    terminal_offsets[i] = terminal_node_counter_;
+    chance_node_counter_ += chance_nodes[i];
+    terminal_node_counter_ += terminal_nodes[i];
+    for (int idx = 0; idx < num_maps; ++idx) {
+      for (std::string& key : first_visits[i][idx]) {
+        infostate_numbers_[idx].emplace(std::move(key),
+                                        infostate_numbers_[idx].size());
+      }
+    }
+  }
+  first_visits.clear();
+
+  // Render pass, one batch of num_threads subtree chunks at a time so only
+  // that many rendered subtrees are ever held in memory. Workers read
+  // infostate_numbers_ concurrently but never modify it.
+  std::vector<std::string> chunks(num_threads);
+  for (int batch_start = 0; batch_start < num_subtrees;
+       batch_start += num_threads) {
+    const int batch_size = std::min(num_threads, num_subtrees - batch_start);
+    std::vector<Thread> workers;
+    workers.reserve(batch_size);
+    for (int slot = 0; slot < batch_size; ++slot) {
+      workers.emplace_back([this, slot, batch_start, &root, &root_actions,
+                            &chance_offsets, &terminal_offsets, &chunks]() {
+        const int i = batch_start + slot;
+        std::ostringstream out;
+        // The sequential writer's setprecision(10) at chance nodes is
+        // sticky on its stream; reproduce the precision this subtree
+        // would inherit from the nodes written before it.
+        if (chance_offsets[i] > 1) out << std::setprecision(10);
+        int chance_counter = chance_offsets[i];
+        int terminal_counter = terminal_offsets[i];
+        EmitSubtree(out, *root->Child(root_actions[i]), &chance_counter,
+                    &terminal_counter);
+        chunks[slot] = out.str();
+      });
+    }
+    for (Thread& worker : workers) worker.join();
+    for (int slot = 0; slot < batch_size; ++slot) {
+      efg_file << chunks[slot];
+    }
+  }
+}
+
 }  // namespace open_spiel
@@ -37,6 +37,17 @@ class EFGWriter {
             bool action_names = true, bool separate_infostate_numbers = true);
   void Write();
 
+  // As Write(), but the subtrees under the root are exported by up to
+  // `num_threads` workers. A first (parallel) pass over each subtree counts
+  // its chance and terminal nodes and records its infostates in first-visit
+  // order; stitching those records together in subtree order reproduces the
+  // sequential numbering exactly, after which the second pass renders the
+  // subtrees concurrently and appends them to the file in order, one batch
+  // of num_threads subtree chunks at a time. The output is byte-identical
+  // to Write() and peak memory is bounded by the rendered size of
+  // num_threads subtrees rather than the whole tree.
+  void Write(int num_threads);
+
  private:
   const Game& game_;
   const std::string filename_;
@@ -51,6 +62,25 @@ class EFGWriter {
   std::vector<std::map<std::string, int>> infostate_numbers_;
 
   void Write(std::ostream& f, const State& state);
+
+  // Emits the one-line record for `state`. With allow_new_infostates the
+  // state's infostate may be assigned the next free number (the sequential
+  // path); otherwise it must already be numbered (the parallel render pass,
+  // where workers read infostate_numbers_ concurrently).
+  void WriteNode(std::ostream& f, const State& state, int* chance_counter,
+                 int* terminal_counter, bool allow_new_infostates);
+
+  // First parallel pass: per-subtree chance/terminal counts plus each
+  // player map's infostates in first-visit order ("new" within the
+  // subtree; duplicates across subtrees are resolved when stitching).
+  void CollectSubtree(const State& state,
+                      std::vector<std::map<std::string, int>>* seen,
+                      std::vector<std::vector<std::string>>* first_visits,
+                      int* chance_nodes, int* terminal_nodes) const;
+
+  // Second parallel pass: renders a subtree with pre-assigned numbering.
+  void EmitSubtree(std::ostream& f, const State& state, int* chance_counter,
+                   int* terminal_counter);
 };
 
 }  // namespace open_spiel
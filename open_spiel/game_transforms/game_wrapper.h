@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -164,6 +165,162 @@ class WrappedGame : public Game {
   std::shared_ptr<const Game> game_;
 };
 
+// Statically typed counterpart of WrappedState, for transform stacks whose
+// composition is known at compile time. The wrapped state is stored with its
+// concrete type, so the forwarding calls below are direct member calls that
+// the compiler can inline; stacking several such wrappers pays virtual
+// dispatch only at the outermost layer, instead of once per layer as with
+// WrappedState. Transforms adopting it become templates over the inner state
+// type and are instantiated per known combination; the runtime-typed
+// WrappedState above remains the right choice for transforms over games only
+// chosen at LoadGame time. Mark concrete leaf classes `final` so the
+// compiler can also devirtualize calls into the innermost game state.
+//
+// `Derived` must be copy-constructible; Clone() is provided here in terms of
+// the copy constructor.
+template <class Derived, class InnerState = State>
+class StaticWrappedState : public State {
+ public:
+  static_assert(std::is_base_of<State, InnerState>::value,
+                "InnerState must derive from State.");
+
+  StaticWrappedState(std::shared_ptr<const Game> game,
+                     std::unique_ptr<InnerState> state)
+      : State(game), state_(std::move(state)) {}
+  StaticWrappedState(const StaticWrappedState& other)
+      : State(other),
+        state_(down_cast<InnerState*>(other.state_->Clone().release())) {}
+
+  Player CurrentPlayer() const override { return state_->CurrentPlayer(); }
+
+  // LegalActions is forwarded through the base type: InnerState is concrete
+  // here, and a state that declares only one LegalActions overload (nearly
+  // all of them) hides the other, so the direct member call would not
+  // compile. The call stays virtual, so a state that does override the
+  // requested overload still receives it.
+  std::vector<Action> LegalActions(Player player) const override {
+    return static_cast<const State&>(*state_).LegalActions(player);
+  }
+
+  std::vector<Action> LegalActions() const override {
+    return static_cast<const State&>(*state_).LegalActions();
+  }
+
+  std::string ActionToString(Player player, Action action_id) const override {
+    return state_->ActionToString(player, action_id);
+  }
+
+  std::string ToString() const override { return state_->ToString(); }
+
+  bool IsTerminal() const override { return state_->IsTerminal(); }
+
+  std::vector<double> Rewards() const override { return state_->Rewards(); }
+
+  std::vector<double> Returns() const override { return state_->Returns(); }
+
+  std::string InformationStateString(Player player) const override {
+    return state_->InformationStateString(player);
+  }
+
+  void InformationStateTensor(Player player,
+                              absl::Span<float> values) const override {
+    state_->InformationStateTensor(player, values);
+  }
+
+  std::string ObservationString(Player player) const override {
+    return state_->ObservationString(player);
+  }
+
+  void ObservationTensor(Player player,
+                         absl::Span<float> values) const override {
+    state_->ObservationTensor(player, values);
+  }
+
+  std::unique_ptr<State> Clone() const override {
+    return std::make_unique<Derived>(static_cast<const Derived&>(*this));
+  }
+
+  void UndoAction(Player player, Action action) override {
+    state_->UndoAction(player, action);
+    history_.pop_back();
+  }
+
+  ActionsAndProbs ChanceOutcomes() const override {
+    return state_->ChanceOutcomes();
+  }
+
+  std::vector<Action> LegalChanceOutcomes() const override {
+    return state_->LegalChanceOutcomes();
+  }
+
+  const InnerState& GetWrappedState() const { return *state_; }
+
+  std::vector<Action> ActionsConsistentWithInformationFrom(
+      Action action) const override {
+    return state_->ActionsConsistentWithInformationFrom(action);
+  }
+
+ protected:
+  void DoApplyAction(Action action_id) override {
+    state_->ApplyAction(action_id);
+  }
+
+  void DoApplyActions(const std::vector<Action>& actions) override {
+    state_->ApplyActions(actions);
+  }
+
+  std::unique_ptr<InnerState> state_;
+};
+
+// Statically typed counterpart of WrappedGame; see StaticWrappedState.
+template <class Derived, class InnerGame = Game>
+class StaticWrappedGame : public Game {
+ public:
+  static_assert(std::is_base_of<Game, InnerGame>::value,
+                "InnerGame must derive from Game.");
+
+  StaticWrappedGame(std::shared_ptr<const InnerGame> game, GameType game_type,
+                    GameParameters game_parameters)
+      : Game(game_type, game_parameters), game_(game) {}
+
+  int NumDistinctActions() const override {
+    return game_->NumDistinctActions();
+  }
+
+  int MaxChanceOutcomes() const override { return game_->MaxChanceOutcomes(); }
+  int NumPlayers() const override { return game_->NumPlayers(); }
+  double MinUtility() const override { return game_->MinUtility(); }
+  double MaxUtility() const override { return game_->MaxUtility(); }
+  absl::optional<double> UtilitySum() const override {
+    return game_->UtilitySum();
+  }
+
+  std::vector<int> InformationStateTensorShape() const override {
+    return game_->InformationStateTensorShape();
+  }
+
+  std::vector<int> ObservationTensorShape() const override {
+    return game_->ObservationTensorShape();
+  }
+
+  TensorLayout InformationStateTensorLayout() const override {
+    return game_->InformationStateTensorLayout();
+  }
+  TensorLayout ObservationTensorLayout() const override {
+    return game_->ObservationTensorLayout();
+  }
+  std::vector<int> PolicyTensorShape() const override {
+    return game_->PolicyTensorShape();
+  }
+  int MaxGameLength() const override { return game_->MaxGameLength(); }
+  int MaxChanceNodesInHistory() const override {
+    return game_->MaxChanceNodesInHistory();
+  }
+
+ protected:
+  std::shared_ptr<const InnerGame> game_;
+};
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_GAME_TRANSFORMS_GAME_WRAPPER_H_
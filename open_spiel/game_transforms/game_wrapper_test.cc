@@ -0,0 +1,72 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/game_transforms/game_wrapper.h"
+
+#include <memory>
+#include <utility>
+
+#include "open_spiel/games/tic_tac_toe/tic_tac_toe.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+// A do-nothing transform used to check that a statically composed stack
+// behaves exactly like the game it wraps.
+template <class InnerState>
+class PassThroughState final
+    : public StaticWrappedState<PassThroughState<InnerState>, InnerState> {
+ public:
+  using Base = StaticWrappedState<PassThroughState<InnerState>, InnerState>;
+  using Base::Base;
+};
+
+void TestStaticStackMatchesWrappedGame() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> reference = game->NewInitialState();
+
+  // Two statically typed pass-through layers over the concrete game state.
+  std::unique_ptr<tic_tac_toe::TicTacToeState> inner(
+      down_cast<tic_tac_toe::TicTacToeState*>(
+          game->NewInitialState().release()));
+  auto middle = std::make_unique<PassThroughState<tic_tac_toe::TicTacToeState>>(
+      game, std::move(inner));
+  PassThroughState<PassThroughState<tic_tac_toe::TicTacToeState>> stacked(
+      game, std::move(middle));
+
+  for (Action action : {0, 4, 1, 3, 2}) {
+    SPIEL_CHECK_EQ(stacked.LegalActions(), reference->LegalActions());
+    SPIEL_CHECK_EQ(stacked.CurrentPlayer(), reference->CurrentPlayer());
+    stacked.ApplyAction(action);
+    reference->ApplyAction(action);
+    SPIEL_CHECK_EQ(stacked.ToString(), reference->ToString());
+  }
+  SPIEL_CHECK_TRUE(stacked.IsTerminal());
+  SPIEL_CHECK_EQ(stacked.Returns(), reference->Returns());
+
+  // Clone() goes through the Derived copy constructor and keeps the stack's
+  // concrete type.
+  std::unique_ptr<State> clone = stacked.Clone();
+  SPIEL_CHECK_EQ(clone->ToString(), reference->ToString());
+  SPIEL_CHECK_TRUE(clone->IsTerminal());
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestStaticStackMatchesWrappedGame();
+}
@@ -23,6 +23,7 @@ namespace {
 
 constexpr bool kDefaultEnableInformationState = false;
 constexpr int kDefaultRecall = 1;
+constexpr bool kDefaultBoundedRecall = false;
 
 // These parameters represent the most general case. Game specific params are
 // parsed once the actual stage game is supplied.
@@ -45,7 +46,8 @@ const GameType kGameType{
       GameParameter(GameParameter::Type::kGame, /*is_mandatory=*/true)},
      {"num_repetitions",
       GameParameter(GameParameter::Type::kInt, /*is_mandatory=*/true)},
-     {"recall", GameParameter(kDefaultRecall)}},
+     {"recall", GameParameter(kDefaultRecall)},
+     {"bounded_recall", GameParameter(kDefaultBoundedRecall)}},
      /*default_loadable=*/false};
 
 std::shared_ptr<const Game> Factory(const GameParameters& params) {
@@ -60,14 +62,45 @@ REGISTER_SPIEL_GAME(kGameType, Factory);
 RepeatedState::RepeatedState(std::shared_ptr<const Game> game,
                              std::shared_ptr<const Game> stage_game,
                              int num_repetitions,
-                             int recall)
+                             int recall, bool bounded_recall)
     : SimMoveState(game),
       stage_game_(stage_game),
       stage_game_state_(stage_game->NewInitialState()),
       num_repetitions_(num_repetitions),
-      recall_(recall) {
-  actions_history_.reserve(num_repetitions_);
-  rewards_history_.reserve(num_repetitions_);
+      recall_(recall),
+      bounded_recall_(bounded_recall),
+      bounded_actions_(recall),
+      bounded_rewards_(recall),
+      cumulative_returns_(num_players_, 0.0) {
+  if (!bounded_recall_) {
+    actions_history_.reserve(num_repetitions_);
+    rewards_history_.reserve(num_repetitions_);
+  }
+}
+
+int RepeatedState::StagesPlayed() const {
+  return bounded_recall_ ? static_cast<int>(bounded_actions_.TotalAdded())
+                         : static_cast<int>(actions_history_.size());
+}
+
+const std::vector<Action>& RepeatedState::StageActionsFromBack(int j) const {
+  SPIEL_CHECK_GE(j, 0);
+  if (bounded_recall_) {
+    SPIEL_CHECK_LT(j, bounded_actions_.Size());
+    return bounded_actions_[(bounded_actions_.TotalAdded() - 1 - j) % recall_];
+  }
+  SPIEL_CHECK_LT(j, actions_history_.size());
+  return actions_history_[actions_history_.size() - 1 - j];
+}
+
+const std::vector<double>& RepeatedState::StageRewardsFromBack(int j) const {
+  SPIEL_CHECK_GE(j, 0);
+  if (bounded_recall_) {
+    SPIEL_CHECK_LT(j, bounded_rewards_.Size());
+    return bounded_rewards_[(bounded_rewards_.TotalAdded() - 1 - j) % recall_];
+  }
+  SPIEL_CHECK_LT(j, rewards_history_.size());
+  return rewards_history_[rewards_history_.size() - 1 - j];
 }
 
 void RepeatedState::DoApplyActions(const std::vector<Action>& actions) {
@@ -77,23 +110,37 @@ void RepeatedState::DoApplyActions(const std::vector<Action>& actions) {
   std::unique_ptr<State> stage_game_state = stage_game_state_->Clone();
   stage_game_state->ApplyActions(actions);
   SPIEL_CHECK_TRUE(stage_game_state->IsTerminal());
-  actions_history_.push_back(actions);
-  rewards_history_.push_back(stage_game_state->Returns());
+  std::vector<double> rewards = stage_game_state->Returns();
+  if (bounded_recall_) {
+    bounded_actions_.Add(actions);
+    bounded_rewards_.Add(rewards);
+    for (int i = 0; i < rewards.size(); ++i) {
+      cumulative_returns_[i] += rewards[i];
+    }
+  } else {
+    actions_history_.push_back(actions);
+    rewards_history_.push_back(std::move(rewards));
+  }
 }
 
 std::string RepeatedState::ToString() const {
   std::string rv;
-  for (int i = 0; i < actions_history_.size(); ++i) {
-    absl::StrAppend(&rv, "Round ", i, ":\n");
+  // In bounded-recall mode only the retained window is printed; the round
+  // numbers remain the absolute stage indices.
+  int window = bounded_recall_ ? bounded_actions_.Size() : StagesPlayed();
+  for (int j = window - 1; j >= 0; --j) {
+    int round = StagesPlayed() - 1 - j;
+    absl::StrAppend(&rv, "Round ", round, ":\n");
     absl::StrAppend(&rv, "Actions: ");
-    for (int j = 0; j < num_players_; ++j) {
+    for (int i = 0; i < num_players_; ++i) {
       absl::StrAppend(
-          &rv, stage_game_state_->ActionToString(j, actions_history_[i][j]),
+          &rv,
+          stage_game_state_->ActionToString(i, StageActionsFromBack(j)[i]),
           " ");
     }
     absl::StrAppend(&rv, "\n");
     absl::StrAppend(&rv, "Rewards: ");
-    for (auto player_reward : rewards_history_[i])
+    for (auto player_reward : StageRewardsFromBack(j))
       absl::StrAppend(&rv, player_reward, " ");
     absl::StrAppend(&rv, "\n");
   }
@@ -103,15 +150,16 @@ std::string RepeatedState::ToString() const {
 }
 
 bool RepeatedState::IsTerminal() const {
-  return actions_history_.size() == num_repetitions_;
+  return StagesPlayed() == num_repetitions_;
 }
 
 std::vector<double> RepeatedState::Rewards() const {
-  return rewards_history_.empty() ? std::vector<double>(num_players_, 0.0)
-                                  : rewards_history_.back();
+  return StagesPlayed() == 0 ? std::vector<double>(num_players_, 0.0)
+                             : StageRewardsFromBack(0);
 }
 
 std::vector<double> RepeatedState::Returns() const {
+  if (bounded_recall_) return cumulative_returns_;
   std::vector<double> returns(num_players_, 0.0);
   for (auto rewards : rewards_history_) {
     for (int i = 0; i < rewards.size(); ++i) {
@@ -137,18 +185,14 @@ std::string RepeatedState::InformationStateString(Player /*player*/) const {
 
 std::string RepeatedState::ObservationString(Player /*player*/) const {
   std::string rv;
-  if (actions_history_.empty()) { return rv; }
+  if (StagesPlayed() == 0) { return rv; }
 
   // Starting from the back of the history, show each player's moves:
-  for (int j = 0;
-       j < recall_ && static_cast<int>(actions_history_.size()) - 1 - j >= 0;
-       ++j) {
-    int hist_idx = actions_history_.size() - 1 - j;
-    SPIEL_CHECK_GE(hist_idx, 0);
-    SPIEL_CHECK_LT(hist_idx, actions_history_.size());
+  for (int j = 0; j < recall_ && j < StagesPlayed(); ++j) {
     for (int i = 0; i < num_players_; ++i) {
-      absl::StrAppend(&rv,
-          stage_game_state_->ActionToString(i, actions_history_[hist_idx][i]),
+      absl::StrAppend(
+          &rv,
+          stage_game_state_->ActionToString(i, StageActionsFromBack(j)[i]),
           " ");
     }
   }
@@ -180,18 +224,13 @@ void RepeatedState::ObservationTensor(Player player,
 
   SPIEL_CHECK_EQ(values.size(), game_->ObservationTensorSize());
   std::fill(values.begin(), values.end(), 0.0);
-  if (actions_history_.empty()) return;
+  if (StagesPlayed() == 0) return;
 
   auto ptr = values.begin();
   // Starting from the back of the history, show each player's moves:
-  for (int j = 0;
-       j < recall_ && static_cast<int>(actions_history_.size()) - 1 - j >= 0;
-       j++) {
-    int hist_idx = static_cast<int>(actions_history_.size()) - 1 - j;
-    SPIEL_CHECK_GE(hist_idx, 0);
-    SPIEL_CHECK_LT(hist_idx, actions_history_.size());
+  for (int j = 0; j < recall_ && j < StagesPlayed(); j++) {
     for (int i = 0; i < num_players_; ++i) {
-      ptr[actions_history_[hist_idx][i]] = 1;
+      ptr[StageActionsFromBack(j)[i]] = 1;
       ptr += stage_game_state_->LegalActions(i).size();
     }
   }
@@ -206,7 +245,7 @@ void RepeatedState::ObliviousObservationTensor(Player player,
 
   SPIEL_CHECK_EQ(values.size(), game_->ObservationTensorSize());
   std::fill(values.begin(), values.end(), 1.0);
-  if (actions_history_.empty()) return;
+  if (StagesPlayed() == 0) return;
 }
 
 std::vector<Action> RepeatedState::LegalActions(Player player) const {
@@ -250,8 +289,14 @@ RepeatedGame::RepeatedGame(std::shared_ptr<const Game> stage_game,
           params),
       stage_game_(stage_game),
       num_repetitions_(ParameterValue<int>("num_repetitions")),
-      recall_(ParameterValue<int>("recall", kDefaultRecall)) {
+      recall_(ParameterValue<int>("recall", kDefaultRecall)),
+      bounded_recall_(
+          ParameterValue<bool>("bounded_recall", kDefaultBoundedRecall)) {
   SPIEL_CHECK_GE(recall_, 1);
+  // The full-length information state requires the complete match history.
+  if (bounded_recall_) {
+    SPIEL_CHECK_FALSE(GetType().provides_information_state_string);
+  }
 }
 
 std::shared_ptr<const Game> CreateRepeatedGame(const Game& stage_game,
@@ -280,7 +325,7 @@ std::shared_ptr<const Game> CreateRepeatedGame(
 std::unique_ptr<State> RepeatedGame::NewInitialState() const {
   return std::unique_ptr<State>(
       new RepeatedState(shared_from_this(), stage_game_,
-                        num_repetitions_, recall_));
+                        num_repetitions_, recall_, bounded_recall_));
 }
 
 std::vector<int> RepeatedGame::InformationStateTensorShape() const {
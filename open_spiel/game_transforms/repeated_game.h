@@ -21,6 +21,7 @@
 
 #include "open_spiel/simultaneous_move_game.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/circular_buffer.h"
 
 // Transform for creating a repeated game from a normal-form game.
 // https://en.wikipedia.org/wiki/Repeated_game.
@@ -34,6 +35,12 @@
 //   "recall"             int      Number of previous steps that defines the
 //                                 observations when enable_infostate is false
 //                                 (default: 1).
+//   "bounded_recall"     bool     Keep only the last `recall` rounds in the
+//                                 state rather than the full match history,
+//                                 making Clone() cost O(recall) instead of
+//                                 O(num_repetitions). Observations, rewards,
+//                                 and returns are unchanged; requires
+//                                 enable_infostate=false (default: false).
 
 namespace open_spiel {
 
@@ -41,7 +48,7 @@ class RepeatedState : public SimMoveState {
  public:
   RepeatedState(std::shared_ptr<const Game> game,
                 std::shared_ptr<const Game> stage_game, int num_repetitions,
-                int recall);
+                int recall, bool bounded_recall);
 
   Player CurrentPlayer() const override {
     return IsTerminal() ? kTerminalPlayerId : kSimultaneousPlayerId;
@@ -67,14 +74,28 @@ class RepeatedState : public SimMoveState {
   void ObliviousObservationTensor(Player player,
                                   absl::Span<float> values) const;
 
+  // Number of stage games played so far, in either storage mode.
+  int StagesPlayed() const;
+  // Joint actions / rewards of the stage played j rounds ago (j=0 is the most
+  // recent round). In bounded-recall mode only j < recall is retained.
+  const std::vector<Action>& StageActionsFromBack(int j) const;
+  const std::vector<double>& StageRewardsFromBack(int j) const;
+
   std::shared_ptr<const Game> stage_game_;
   // Store a reference initial state of the stage game for efficient calls
   // to state functions (e.g. LegalActions()).
   std::shared_ptr<const State> stage_game_state_;
   int num_repetitions_;
   int recall_;
+  bool bounded_recall_;
+  // Full-match storage, used when bounded_recall_ is false.
   std::vector<std::vector<Action>> actions_history_{};
   std::vector<std::vector<double>> rewards_history_{};
+  // Bounded storage: only the last recall_ rounds plus running returns, so
+  // cloning does not grow with the number of stages already played.
+  CircularBuffer<std::vector<Action>> bounded_actions_;
+  CircularBuffer<std::vector<double>> bounded_rewards_;
+  std::vector<double> cumulative_returns_;
 };
 
 class RepeatedGame : public SimMoveGame {
@@ -108,6 +129,7 @@ class RepeatedGame : public SimMoveGame {
   std::shared_ptr<const Game> stage_game_;
   const int num_repetitions_;
   const int recall_;
+  const bool bounded_recall_;
 };
 
 // Creates a repeated game based on the stage game.
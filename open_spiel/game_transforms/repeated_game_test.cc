@@ -170,6 +170,51 @@ void RepeatedRockPaperScissorsInfoStateEnabledTest() {
 }
 
 
+void RepeatedRockPaperScissorsBoundedRecallTest() {
+  GameParameters params;
+  params["num_repetitions"] = GameParameter(1000);
+  params["recall"] = GameParameter(2);
+  std::shared_ptr<const Game> full_game =
+      CreateRepeatedGame("matrix_rps", params);
+  params["bounded_recall"] = GameParameter(true);
+  std::shared_ptr<const Game> bounded_game =
+      CreateRepeatedGame("matrix_rps", params);
+
+  // RandomSimTest round-trips through serialization, which needs the
+  // stage_game parameter only the game string carries; games built via
+  // CreateRepeatedGame cannot be deserialized.
+  open_spiel::testing::RandomSimTest(
+      *LoadGame("repeated_game(stage_game=matrix_rps(),num_repetitions=1000,"
+                "recall=2,bounded_recall=True)"),
+      1);
+
+  // Bounded recall changes only the state's storage: observations, rewards,
+  // and returns match the full-history game round for round.
+  std::unique_ptr<State> full_state = full_game->NewInitialState();
+  std::unique_ptr<State> bounded_state = bounded_game->NewInitialState();
+  int step = 0;
+  while (!full_state->IsTerminal()) {
+    SPIEL_CHECK_FALSE(bounded_state->IsTerminal());
+    SPIEL_CHECK_EQ(bounded_state->ObservationString(0),
+                   full_state->ObservationString(0));
+    SPIEL_CHECK_TRUE(absl::c_equal(bounded_state->ObservationTensor(0),
+                                   full_state->ObservationTensor(0)));
+    SPIEL_CHECK_TRUE(absl::c_equal(bounded_state->Rewards(),
+                                   full_state->Rewards()));
+    SPIEL_CHECK_TRUE(absl::c_equal(bounded_state->Returns(),
+                                   full_state->Returns()));
+    std::vector<Action> actions = {step % 3, (step + 1) % 3};
+    full_state->ApplyActions(actions);
+    bounded_state->ApplyActions(actions);
+    // Cloning must not depend on how many stages were already played.
+    bounded_state = bounded_state->Clone();
+    step += 1;
+  }
+  SPIEL_CHECK_TRUE(bounded_state->IsTerminal());
+  SPIEL_CHECK_TRUE(absl::c_equal(bounded_state->Returns(),
+                                 full_state->Returns()));
+}
+
 void RepeatedPrisonersDilemaTest() {
   GameParameters params;
   params["num_repetitions"] = GameParameter(2);
@@ -214,5 +259,6 @@ int main(int argc, char** argv) {
   open_spiel::RepeatedRockPaperScissorsDefaultsTest();
   open_spiel::RepeatedRockPaperScissorsRecallTwoTest();
   open_spiel::RepeatedRockPaperScissorsInfoStateEnabledTest();
+  open_spiel::RepeatedRockPaperScissorsBoundedRecallTest();
   open_spiel::RepeatedPrisonersDilemaTest();
 }
@@ -185,7 +185,9 @@ RestrictedNashResponseState::ChanceOutcomes() const {
       return state_->ChanceOutcomes();
     } else if (use_fixed_policy_ && fixed_ &&
                state_->CurrentPlayer() == fixed_player_) {
-      return fixed_policy_->GetStatePolicy(*state_);
+      const auto& game =
+          open_spiel::down_cast<const RestrictedNashResponseGame&>(*game_);
+      return game.FixedStatePolicy(*state_);
     }
   }
   return {};
@@ -336,6 +338,34 @@ RestrictedNashResponseGame::RestrictedNashResponseGame(
       std::make_shared<RestrictedNashResponseObserver>(kInfoStateObsType);
 }
 
+ActionsAndProbs RestrictedNashResponseGame::FixedStatePolicy(
+    const State& underlying_state) const {
+  SPIEL_CHECK_TRUE(fixed_policy_ != nullptr);
+  if (!game_->GetType().provides_information_state_string) {
+    // Nothing sound to key the cache by.
+    return fixed_policy_->GetStatePolicy(underlying_state);
+  }
+  std::string info_state = underlying_state.InformationStateString();
+  {
+    absl::MutexLock lock(&fixed_policy_cache_mutex_);
+    auto iter = fixed_policy_cache_.find(info_state);
+    if (iter != fixed_policy_cache_.end()) {
+      return iter->second;
+    }
+  }
+  // Computed outside the lock: policy lookups can be expensive and other
+  // states may be querying different infostates meanwhile.
+  ActionsAndProbs policy = fixed_policy_->GetStatePolicy(underlying_state);
+  absl::MutexLock lock(&fixed_policy_cache_mutex_);
+  return fixed_policy_cache_.emplace(std::move(info_state), std::move(policy))
+      .first->second;
+}
+
+void RestrictedNashResponseGame::ClearFixedPolicyCache() const {
+  absl::MutexLock lock(&fixed_policy_cache_mutex_);
+  fixed_policy_cache_.clear();
+}
+
 std::shared_ptr<const Game> ConvertToRNR(
     const Game& game, Player fixed_player, double p,
     std::shared_ptr<Policy> fixed_policy) {
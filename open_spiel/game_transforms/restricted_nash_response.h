@@ -21,6 +21,8 @@
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 #include "open_spiel/game_transforms/game_wrapper.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/policy.h"
@@ -175,6 +177,17 @@ class RestrictedNashResponseGame : public WrappedGame {
       return game_->MaxChanceNodesInHistory();
     }
   }
+  // The fixed player's policy at the underlying state, memoized by infostate
+  // string. The fixed policy does not change within a solve, and solvers
+  // revisit the converted chance nodes on every traversal, so without the
+  // cache each visit pays a full policy lookup. Falls through to the policy
+  // when the underlying game has no infostate strings to key by.
+  ActionsAndProbs FixedStatePolicy(const State& underlying_state) const;
+
+  // Drops the memoized lookups. Call when the fixed policy object is mutated
+  // in place between solves (a new RNR game does not need it).
+  void ClearFixedPolicyCache() const;
+
   // old observation API
   std::shared_ptr<RestrictedNashResponseObserver> default_observer_;
   std::shared_ptr<RestrictedNashResponseObserver> info_state_observer_;
@@ -185,6 +198,10 @@ class RestrictedNashResponseGame : public WrappedGame {
   const double p_;
   // Constants for the fixed strategy and if we use explicit fixed strategy
   std::shared_ptr<Policy> fixed_policy_;
+  // Memoized FixedStatePolicy() lookups, shared by all states of this game.
+  mutable absl::Mutex fixed_policy_cache_mutex_;
+  mutable absl::flat_hash_map<std::string, ActionsAndProbs>
+      fixed_policy_cache_ ABSL_GUARDED_BY(fixed_policy_cache_mutex_);
 };
 
 // Return back a transformed clone of the game.
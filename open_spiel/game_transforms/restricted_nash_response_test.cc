@@ -238,6 +238,40 @@ void TestFixedPolicyGame() {
   }
 }
 
+void TestFixedPolicyCache() {
+  // Repeated traversals of the fixed part serve the fixed player's policy
+  // from the game's cache; mutating the policy in place only shows through
+  // after ClearFixedPolicyCache().
+  Player fixed_player = 0;
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  std::shared_ptr<TabularPolicy> fixed_policy =
+      std::make_shared<TabularPolicy>(GetUniformPolicy(*game));
+  std::shared_ptr<const Game> rnr_game =
+      ConvertToRNR(*game, fixed_player, 0.5, fixed_policy);
+
+  auto state = rnr_game->NewInitialState();
+  state->ApplyAction(kFixedAction);
+  state->ApplyAction(0);  // Deal to the fixed player.
+  state->ApplyAction(1);  // Deal to the free player.
+  SPIEL_CHECK_TRUE(state->IsChanceNode());  // Fixed player's converted node.
+  std::string info_state = down_cast<const RestrictedNashResponseState&>(
+                               *state)
+                               .GetOriginalState()
+                               ->InformationStateString(fixed_player);
+  auto first = state->ChanceOutcomes();
+  SPIEL_CHECK_TRUE(first == state->ChanceOutcomes());
+
+  fixed_policy->SetStatePolicy(info_state, {{0, 0.25}, {1, 0.75}});
+  // Stale on purpose: the cache is only dropped on request.
+  SPIEL_CHECK_TRUE(first == state->ChanceOutcomes());
+  down_cast<const RestrictedNashResponseGame&>(*rnr_game)
+      .ClearFixedPolicyCache();
+  auto updated = state->ChanceOutcomes();
+  SPIEL_CHECK_FALSE(first == updated);
+  SPIEL_CHECK_FLOAT_EQ(updated[0].second, 0.25);
+  SPIEL_CHECK_FLOAT_EQ(updated[1].second, 0.75);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -246,4 +280,5 @@ int main(int argc, char **argv) {
   open_spiel::TestBasicCreation();
   open_spiel::TestMatchingPenniesCreation();
   open_spiel::TestFixedPolicyGame();
+  open_spiel::TestFixedPolicyCache();
 }
@@ -18,6 +18,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_globals.h"
@@ -111,7 +112,11 @@ void TurnBasedSimultaneousState::DoApplyAction(Action action_id) {
       RolloutModeIncrementCurrentPlayer();
       // Check if we then need to apply it.
       if (current_player_ == num_players_) {
-        state_->ApplyActions(action_vector_);
+        // The wrapped API takes a std::vector, so the joint action is copied
+        // out of the inline buffer here -- once per joint move rather than
+        // once per Clone().
+        state_->ApplyActions(
+            std::vector<Action>(action_vector_.begin(), action_vector_.end()));
         DetermineWhoseTurn();
       }
     } else {
@@ -20,6 +20,7 @@
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/inlined_vector.h"
 #include "open_spiel/spiel.h"
 
 // This wrapper turns any n-player simultaneous move game into an equivalent
@@ -68,10 +69,11 @@ class TurnBasedSimultaneousState : public State {
 
   std::unique_ptr<State> state_;
 
-  // A vector of actions that is used primarily to store the intermediate
+  // A buffer of actions that is used primarily to store the intermediate
   // actions taken by the players when extending the simultaneous move nodes
-  // to be turn-based.
-  std::vector<Action> action_vector_;
+  // to be turn-based. Stored inline for typical player counts so that
+  // copying it in Clone() does not allocate.
+  absl::InlinedVector<Action, 8> action_vector_;
 
   // The current player (which will never be kSimultaneousPlayerId).
   Player current_player_;
@@ -538,6 +538,15 @@ class ChessBoard {
                                 PseudoLegalMoveSettings settings,
                                 Offset offset_step, const YieldFn& yield) const;
 
+  // Magic-bitboard path for the sliding pieces (8x8 boards only): the
+  // occupancy a slider's rays stop at under the given settings, and the
+  // yield loop over a precomputed attack set.
+  uint64_t SliderBlockers_(Color color,
+                           PseudoLegalMoveSettings settings) const;
+  template <typename YieldFn>
+  void GenerateSliderDestinations_(uint64_t attacks, Color color,
+                                   const YieldFn& yield) const;
+
   void SetIrreversibleMoveCounter(int c);
   void SetMovenumber(int move_number);
   bool EpSquareThreatened(Square ep_square) const;
@@ -547,6 +556,10 @@ class ChessBoard {
   bool allow_pass_move_;
 
   std::array<Piece, k2dMaxBoardSize> board_;
+  // Per-color occupancy bitboards over SquareToIndex_, kept in sync by
+  // set_square. On 8x8 boards they feed the magic-bitboard sliding-attack
+  // lookups; smaller boards ignore them and walk rays.
+  uint64_t occupancy_[2] = {0, 0};
   Color to_play_;
   Square ep_square_;
   int32_t irreversible_move_counter_;
@@ -117,6 +117,7 @@ CrazyEightsState::CrazyEightsState(std::shared_ptr<const Game> game,
   absl::c_fill(dealer_deck_, num_decks_);
   for (int i = 0; i < num_players; ++i) {
     hands_.push_back(std::vector<int>(kNumCards, 0));
+    hand_masks_.push_back(0);
     returns_.push_back(0);
   }
 }
@@ -426,7 +427,7 @@ void CrazyEightsState::ApplyDealAction(int action) {
 
   num_cards_left_--;
   dealer_deck_[action]--;
-  hands_[current_player_][action]++;
+  AddCardToHand(current_player_, action);
 
   SPIEL_CHECK_GE(dealer_deck_[action], 0);
   SPIEL_CHECK_LE(dealer_deck_[action], num_decks_);
@@ -468,7 +469,7 @@ void CrazyEightsState::ApplyDealAction(int action) {
       // put back
       dealer_deck_[action]++;
       num_cards_left_++;
-      hands_[current_player_][action]--;
+      RemoveCardFromHand(current_player_, action);
       return;
     }
   }
@@ -559,13 +560,12 @@ std::vector<Action> CrazyEightsState::PlayLegalActions() const {
     if (!start_draw_twos_) {
       for (int suit = kClubs; suit <= kSpades; ++suit) {
         int duo_card = GetAction(static_cast<Suit>(suit), kDrawTwoRank);
-        if (hands_[current_player_][duo_card])
+        if (card_set::Contains(hand_masks_[current_player_], duo_card))
           legal_actions.push_back(duo_card);
       }
     }
   } else {
-    for (int card = 0; card < kNumCards; ++card) {
-      if (hands_[current_player_][card] == 0) continue;
+    card_set::ForEachCard(hand_masks_[current_player_], [&](int card) {
       Suit suit = GetSuit(card);
       int rank = GetRank(card);
       if (rank == kEightRank) {
@@ -573,7 +573,7 @@ std::vector<Action> CrazyEightsState::PlayLegalActions() const {
       } else if (last_suit_ == suit || GetRank(last_card_) == rank) {
         legal_actions.push_back(card);
       }
-    }
+    });
     if (num_cards_left_ && num_draws_before_play_ != max_draw_cards_) {
       SPIEL_CHECK_FALSE(can_pass_action_);
       legal_actions.push_back(kDraw);
@@ -585,12 +585,8 @@ std::vector<Action> CrazyEightsState::PlayLegalActions() const {
 
 bool CrazyEightsState::CheckAllCardsPlayed(int action) {
   SPIEL_CHECK_GT(hands_[current_player_][action], 0);
-  hands_[current_player_][action]--;
-  bool all_played = true;
-  for (int card = 0; card < kNumCards; ++card) {
-    all_played &= !hands_[current_player_][card];
-  }
-  return all_played;
+  RemoveCardFromHand(current_player_, action);
+  return hand_masks_[current_player_] == 0;
 }
 
 void CrazyEightsState::ApplyPlayAction(int action) {
@@ -694,8 +690,7 @@ Player CrazyEightsState::CurrentPlayer() const {
 
 void CrazyEightsState::ScoreUp() {
   for (int player = 0; player < num_players_; ++player) {
-    for (int card = 0; card < kNumCards; ++card) {
-      if (!hands_[player][card]) continue;
+    card_set::ForEachCard(hand_masks_[player], [&](int card) {
       int rank = GetRank(card);
       if (rank == kEightRank) {
         returns_[player] -= 50 * hands_[player][card];
@@ -704,7 +699,7 @@ void CrazyEightsState::ScoreUp() {
       } else {
         returns_[player] -= (card + 2) * hands_[player][card];
       }
-    }
+    });
   }
 }
 
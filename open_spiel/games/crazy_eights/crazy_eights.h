@@ -73,6 +73,7 @@
 
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/spiel.h"
+#include "open_spiel/utils/card_set.h"
 
 namespace open_spiel {
 namespace crazy_eights {
@@ -176,6 +177,21 @@ class CrazyEightsState : public State {
   std::vector<double> returns_;
   std::array<int, kNumCards> dealer_deck_{};
   std::vector<std::vector<int>> hands_;
+  // hand_masks_[player] has bit c set iff hands_[player][c] > 0. The counts
+  // above remain authoritative (two decks allow duplicates); the masks let
+  // hand scans visit only the cards actually held.
+  std::vector<card_set::CardSet> hand_masks_;
+
+  void AddCardToHand(Player player, int card) {
+    hands_[player][card]++;
+    hand_masks_[player] |= card_set::CardBit(card);
+  }
+  void RemoveCardFromHand(Player player, int card) {
+    hands_[player][card]--;
+    if (hands_[player][card] == 0) {
+      hand_masks_[player] &= ~card_set::CardBit(card);
+    }
+  }
 };
 
 class CrazyEightsGame : public Game {
@@ -1,662 +1,1400 @@
-// Copyright 2025
-// C++ Durak implementation for OpenSpiel
-//
-// durak.cc: logic, state transitions, observer, etc.
-
-#include "open_spiel/games/durak/durak.h"
-
-#include <algorithm>
-#include <random>
-#include <sstream>
-#include <string>
-#include <utility>
-
-#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
-#include "open_spiel/game_parameters.h"
-#include "open_spiel/observer.h"
-#include "open_spiel/spiel_utils.h"
-
-namespace open_spiel {
-namespace durak {
-namespace {
-
-// Construct a GameType object with enough info for standard usage.
-const GameType kGameType{
-    /*short_name=*/"durak",
-    /*long_name=*/"Durak",
-    GameType::Dynamics::kSequential,
-    GameType::ChanceMode::kExplicitStochastic,
-    GameType::Information::kImperfectInformation,
-    GameType::Utility::kZeroSum,
-    GameType::RewardModel::kTerminal,
-    /*max_num_players=*/kNumPlayers,
-    /*min_num_players=*/kNumPlayers,
-    /*provides_information_state_string=*/true,
-    /*provides_information_state_tensor=*/true,
-    /*provides_observation_string=*/true,
-    /*provides_observation_tensor=*/true,
-    /*parameter_specification=*/{
-      {"init_deck", GameParameter(std::string(""))},
-      {"rng_seed", GameParameter(0)},
-    },
-    /*default_loadable=*/true,
-    /*provides_factored_observation_string=*/true
-};
-
-const GameInfo kGameInfo{
-    /*num_distinct_actions=*/kNumCards + 3,
-    /*max_chance_outcomes=*/kNumCards,
-    /*num_players=*/kNumPlayers,
-    /*min_utility=*/-1.0,
-    /*max_utility=*/1.0,
-    /*utility_sum=*/0.0,
-    /*max_game_length=*/300
-};
-
-// Register the game with OpenSpiel
-std::shared_ptr<const Game> Factory(const GameParameters& params) {
-  return std::make_shared<DurakGame>(params);
-}
-
-// We register the game with OpenSpiel's internal catalog.
-REGISTER_SPIEL_GAME(kGameType, Factory);
-
-}  // namespace
-
-// -----------------------------------------------------------------------------
-// DurakGame implementation
-// -----------------------------------------------------------------------------
-
-DurakGame::DurakGame(const GameParameters& params)
-    : Game(kGameType, params),
-      rng_seed_(ParameterValue<int>("rng_seed")) {
-}
-
-std::unique_ptr<State> DurakGame::NewInitialState() const {
-  return std::unique_ptr<State>(new DurakState(shared_from_this(), rng_seed_));
-}
-
-void ShuffleDeck(std::mt19937* rng, std::vector<int>& deck, int begin, int end) {
-  for (int i = begin; i < end - 1; ++i) {
-    int j = i + (*rng)() % (end - i);
-    std::swap(deck[i], deck[j]);
-  }
-}
-
-std::vector<int> DurakGame::InformationStateTensorShape() const {
-  // A simplistic shape example: 
-  // See the Python for references. We have up to 1-hot for trump_suit (4),
-  // 1-hot for RoundPhase (4), 1-hot for trump_card (36), deck_size, player bits, etc.
-  // plus optionally the entire hand (36). 
-  // The final shape is up to your design. For example:
-  //     [2] (which player) + 4 (trump_suit) + 4 (phase) + 1 (deck_size) +
-  //     2 (attacker_ind, defender_ind) + 36 (trump_card) + 36 (my_cards) + ...
-  // We'll just define a possible dimension that matches the Python approach.
-
-  // As a rough total:
-  //   player: 2
-  //   trump_suit: 4
-  //   phase: 4
-  //   deck_size: 1
-  //   attacker_ind + defender_ind: 2
-  //   trump_card: 36
-  //   my_cards: 36
-  //   table_attack + table_defense: 36 + 36 = 72  (if perfect recall or public info)
-
-  // For simplicity, let's choose a single large dimension.
-  // We'll just give a max shape for the union of all possibilities.
-  return {157};  // A single vector dimension that can store all bits.
-}
-
-std::vector<int> DurakGame::ObservationTensorShape() const {
-  // Typically, the same or similar shape. Possibly fewer bits if we exclude private info.
-  // Let's reuse the same dimension for simplicity.
-  return {157};
-}
-
-std::shared_ptr<Observer> DurakGame::MakeObserver(
-    absl::optional<IIGObservationType> iig_obs_type,
-    const GameParameters& params) const {
-  // Construct or fill out the fields on IIGObservationType:
-  IIGObservationType obs_type = iig_obs_type.value_or(IIGObservationType());
-  obs_type.public_info = false;
-  obs_type.perfect_recall = false;
-  obs_type.private_info = PrivateInfoType::kSinglePlayer;
-
-  return std::make_shared<DurakObserver>(obs_type);
-}
-
-// -----------------------------------------------------------------------------
-// DurakState implementation
-// -----------------------------------------------------------------------------
-
-DurakState::DurakState(std::shared_ptr<const Game> game, int rng_seed)
-    : State(game), rng_seed_(rng_seed) {  // Initialize rng_seed_
-  const DurakGame* durak_game = down_cast<const DurakGame*>(game.get());
-  auto param_map = durak_game->GetParameters();
-  auto it = param_map.find("init_deck");
-  std::string deck_str = (it != param_map.end()) ? it->second.string_value() : "";
-
-  if (deck_str.empty()) {
-    // Initialize a standard ordered deck
-    for (int i = 0; i < kNumCards; i++) {
-      deck_.push_back(i);
-    }
-
-    // Create a reproducible random engine
-    std::mt19937 rng(rng_seed_);
-
-    // Shuffle the deck using the free function
-    ShuffleDeck(&rng, deck_, 0, kNumCards);
-  } else {
-    // Parse the deck string
-    std::stringstream ss(deck_str);
-    for (int i = 0; i < kNumCards; i++) {
-      int c;
-      char comma;
-      ss >> c;
-      deck_.push_back(c);
-      if (i < kNumCards - 1) ss >> comma;  // consume comma
-    }
-  }
-
-  // 2) Initialize hands, table, discard, etc.
-  for (int p = 0; p < kNumPlayers; ++p) {
-    hands_[p].clear();
-  }
-  table_cards_.clear();
-  discard_.clear();
-  trump_suit_ = -1;
-  trump_card_ = -1;
-  cards_dealt_ = 0;
-  deck_pos_ = 0;
-
-  attacker_ = 0;
-  defender_ = 1;
-  phase_ = RoundPhase::kChance;
-  round_starter_ = 0;
-  game_over_ = false;
-}
-
-Player DurakState::CurrentPlayer() const {
-  if (game_over_) return kTerminalPlayerId;
-  if (phase_ == RoundPhase::kChance) return kChancePlayerId;
-  // Attack or Additional => attacker, Defense => defender
-  if (phase_ == RoundPhase::kAttack || phase_ == RoundPhase::kAdditional) {
-    return attacker_;
-  }
-  return defender_;
-}
-
-bool DurakState::IsTerminal() const {
-  return game_over_;
-}
-
-std::vector<double> DurakState::Returns() const {
-  if (!game_over_) {
-    return {0.0, 0.0};
-  }
-
-  // Count how many players still hold cards.
-  std::vector<int> players_with_cards;
-  for (int p = 0; p < kNumPlayers; ++p) {
-    if (!hands_[p].empty()) {
-      players_with_cards.push_back(p);
-    }
-  }
-
-  // If exactly one player still has cards => that player is the loser: -1
-  // The other is winner => +1
-  if (players_with_cards.size() == 1) {
-    std::vector<double> result(kNumPlayers, 0.0);
-    int loser = players_with_cards[0];
-    result[loser] = -1.0;
-    result[1 - loser] = 1.0;
-    return result;
-  }
-
-  // If both have cards, or 0 with cards but deck not empty => treat as [0,0].
-  if (players_with_cards.size() == 2) {
-    return {0.0, 0.0};
-  }
-
-  // If neither has cards => check deck. If deck is empty => last attacker wins. 
-  if (players_with_cards.empty()) {
-    if (deck_pos_ >= static_cast<int>(deck_.size())) {
-      // attacker wins
-      std::vector<double> result(kNumPlayers, 0.0);
-      result[attacker_] = 1.0;
-      result[1 - attacker_] = -1.0;
-      return result;
-    } else {
-      // Deck not empty => fallback or partial: return [0, 0].
-      return {0.0, 0.0};
-    }
-  }
-
-  // If some other scenario arises, fallback to [0,0].
-  return {0.0, 0.0};
-}
-
-void DurakState::CheckGameOver() {
-  // This method is called after each move to see if game is done.
-
-  // If a player is out of cards and deck is also empty => game over
-  bool p0_empty = hands_[0].empty();
-  bool p1_empty = hands_[1].empty();
-
-  if ((p0_empty || p1_empty) && deck_pos_ >= static_cast<int>(deck_.size())) {
-    game_over_ = true;
-    return;
-  }
-
-  // If both players have no cards
-  if (p0_empty && p1_empty) {
-    // If deck is also empty => done
-    if (deck_pos_ >= static_cast<int>(deck_.size())) {
-      game_over_ = true;
-      return;
-    } else {
-      // Refill
-      RefillHands();
-    }
-  }
-}
-
-std::string DurakState::ToString() const {
-  std::string str;
-  absl::StrAppend(&str, "Phase=", static_cast<int>(phase_),
-                  " Attack=", attacker_, " Defend=", defender_,
-                  " DeckPos=", deck_pos_, "/", deck_.size(),
-                  " TrumpSuit=", trump_suit_,
-                  " TrumpCard=", trump_card_ < 0 ? "None" : CardToString(trump_card_),
-                  " game_over=", (game_over_ ? "true" : "false"), "\n");
-  for (int p = 0; p < kNumPlayers; ++p) {
-    absl::StrAppend(&str, "Player ", p, " hand: ");
-    for (int c : hands_[p]) {
-      absl::StrAppend(&str, CardToString(c), " ");
-    }
-    absl::StrAppend(&str, "\n");
-  }
-  absl::StrAppend(&str, "Table: ");
-  for (auto &pair : table_cards_) {
-    int ac = pair.first;
-    int dc = pair.second;
-    absl::StrAppend(&str, CardToString(ac), "->",
-                    (dc < 0 ? "?" : CardToString(dc)), "  ");
-  }
-  absl::StrAppend(&str, "\nDiscard: ", discard_.size(), " cards\n");
-  return str;
-}
-
-std::unique_ptr<State> DurakState::Clone() const {
-  return std::unique_ptr<State>(new DurakState(*this));
-}
-
-bool DurakState::IsChanceNode() const {
-  return (phase_ == RoundPhase::kChance);
-}
-
-std::vector<std::pair<Action, double>> DurakState::ChanceOutcomes() const {
-  std::vector<std::pair<Action, double>> outcomes;
-  if (cards_dealt_ < kCardsPerPlayer * kNumPlayers) {
-    int next_card = deck_[deck_pos_];
-    outcomes.push_back({next_card, 1.0});
-  } else {
-    if (trump_card_ < 0) {
-      int bottom_card = deck_.back();
-      outcomes.push_back({bottom_card, 1.0});
-    }
-  }
-  return outcomes;
-}
-
-void DurakState::ApplyChanceAction(Action outcome) {
-  // If we haven't dealt 6 cards each to both players, deal from top
-  if (cards_dealt_ < kCardsPerPlayer * kNumPlayers) {
-    // Deal this card to the next player
-    int player_idx = cards_dealt_ % kNumPlayers;
-    hands_[player_idx].push_back(outcome);
-    ++deck_pos_;
-    ++cards_dealt_;
-  } else {
-    // Reveal the last card as trump
-    trump_card_ = deck_.back();
-    trump_suit_ = SuitOf(deck_.back());
-    DecideFirstAttacker();
-    phase_ = RoundPhase::kAttack;
-    round_starter_ = attacker_;
-  }
-}
-
-void DurakState::DoApplyAction(Action move) {
-  if (IsChanceNode()) {
-    ApplyChanceAction(move);
-    CheckGameOver();
-    return;
-  }
-  if (game_over_) return;
-
-  Player player = CurrentPlayer();
-  if (move >= kNumCards) {
-    if (move == kExtraActionTakeCards) {
-      DefenderTakesCards();
-    } else if (move == kExtraActionFinishAttack) {
-      AttackerFinishesAttack();
-    } else if (move == kExtraActionFinishDefense) {
-      DefenderFinishesDefense();
-    }
-    CheckGameOver();
-    return;
-  }
-
-  auto &hand = hands_[player];
-  auto it = std::find(hand.begin(), hand.end(), move);
-  if (it == hand.end()) {
-    return;  // invalid
-  }
-
-  if ((phase_ == RoundPhase::kAttack || phase_ == RoundPhase::kAdditional) &&
-      (player == attacker_)) {
-    hand.erase(it);
-    table_cards_.push_back(std::make_pair(move, -1));
-    phase_ = RoundPhase::kAttack;
-  } else if (phase_ == RoundPhase::kDefense && (player == defender_)) {
-    int uncovered_index = -1;
-    for (int i = 0; i < static_cast<int>(table_cards_.size()); ++i) {
-      if (table_cards_[i].second < 0) {
-        uncovered_index = i;
-        break;
-      }
-    }
-    if (uncovered_index >= 0) {
-      int att_card = table_cards_[uncovered_index].first;
-      if (CanDefendCard(move, att_card)) {
-        hand.erase(it);
-        table_cards_[uncovered_index].second = move;
-        bool all_covered = true;
-        for (auto &pair : table_cards_) {
-          if (pair.second < 0) {
-            all_covered = false;
-            break;
-          }
-        }
-        if (all_covered) {
-          phase_ = RoundPhase::kAdditional;
-        }
-      }
-    }
-  }
-
-  CheckGameOver();
-}
-
-std::vector<Action> DurakState::LegalActions() const {
-  if (game_over_) return {};
-  if (IsChanceNode()) {
-    // Return the forced dealing outcome(s)
-    std::vector<Action> actions;
-    auto co = ChanceOutcomes();
-    for (auto &o : co) {
-      actions.push_back(o.first);
-    }
-    return actions;
-  }
-
-  std::vector<Action> moves;
-  Player player = CurrentPlayer();
-  const auto &hand = hands_[player];
-
-  if (phase_ == RoundPhase::kAttack || phase_ == RoundPhase::kAdditional) {
-    if (player == attacker_) {
-      if (table_cards_.empty()) {
-        // can place any card
-        for (int c : hand) {
-          moves.push_back(c);
-        }
-      } else if (static_cast<int>(table_cards_.size()) < kCardsPerPlayer && !hands_[defender_].empty()) {
-        // can only place ranks that appear on the table
-        std::vector<int> ranks_on_table;
-        ranks_on_table.reserve(table_cards_.size() * 2);
-        for (auto &pair : table_cards_) {
-          ranks_on_table.push_back(RankOf(pair.first));
-          if (pair.second >= 0) {
-            ranks_on_table.push_back(RankOf(pair.second));
-          }
-        }
-        for (int c : hand) {
-          int r = RankOf(c);
-          if (std::find(ranks_on_table.begin(), ranks_on_table.end(), r)
-              != ranks_on_table.end()) {
-            moves.push_back(c);
-          }
-        }
-      }
-      // can always FINISH_ATTACK if there's at least 1 card on the table
-      if (!table_cards_.empty()) {
-        moves.push_back(kExtraActionFinishAttack);
-      }
-    }
-  } else if (phase_ == RoundPhase::kDefense) {
-    // can TAKE_CARDS, or cover earliest uncovered, or FINISH_DEFENSE if none uncovered
-    if (player == defender_) {
-      bool any_uncovered = false;
-      int earliest_uncovered = -1;
-      for (int i = 0; i < static_cast<int>(table_cards_.size()); ++i) {
-        if (table_cards_[i].second < 0) {
-          any_uncovered = true;
-          if (earliest_uncovered < 0) earliest_uncovered = i;
-        }
-      }
-      if (!any_uncovered) {
-        moves.push_back(kExtraActionFinishDefense);
-      } else {
-        moves.push_back(kExtraActionTakeCards);
-      // try to cover earliest
-        if (earliest_uncovered >= 0) {
-          int att_card = table_cards_[earliest_uncovered].first;
-          for (int c : hand) {
-            if (CanDefendCard(c, att_card)) {
-              moves.push_back(c);
-            }
-          }
-        }
-      }
-    }
-  }
-
-  std::sort(moves.begin(), moves.end());
-  return moves;
-}
-
-std::string DurakState::ActionToString(Player /*player*/, Action action_id) const {
-  if (action_id == kExtraActionTakeCards) return "TAKE_CARDS";
-  if (action_id == kExtraActionFinishAttack) return "FINISH_ATTACK";
-  if (action_id == kExtraActionFinishDefense) return "FINISH_DEFENSE";
-  if (action_id >= 0 && action_id < kNumCards) {
-    return absl::StrCat("Play:", CardToString(action_id));
-  }
-  return "UnknownAction";
-}
-
-void DurakState::UndoAction(Player /*player*/, Action /*move*/) {
-  SpielFatalError("UndoAction is not implemented for Durak.");
-}
-
-// Helper: decide first attacker by lowest trump card
-void DurakState::DecideFirstAttacker() {
-  int lowest_trump = -1;
-  Player who = 0;
-  for (int p = 0; p < kNumPlayers; ++p) {
-    for (int c : hands_[p]) {
-      if (SuitOf(c) == trump_suit_) {
-        if (lowest_trump < 0 || RankOf(c) < RankOf(lowest_trump)) {
-          lowest_trump = c;
-          who = p;
-        }
-      }
-    }
-  }
-  attacker_ = who;
-  defender_ = 1 - who;
-}
-
-// Helper: can defense_card cover attack_card?
-bool DurakState::CanDefendCard(int defense_card, int attack_card) const {
-  int att_s = SuitOf(attack_card);
-  int att_r = RankOf(attack_card);
-  int def_s = SuitOf(defense_card);
-  int def_r = RankOf(defense_card);
-
-  if (att_s == def_s && def_r > att_r) {
-    return true;
-  }
-  if (def_s == trump_suit_ && att_s != trump_suit_) {
-    return true;
-  }
-  if (att_s == trump_suit_ && def_s == trump_suit_ && def_r > att_r) {
-    return true;
-  }
-  return false;
-}
-
-// The defender picks up all table cards
-void DurakState::DefenderTakesCards() {
-  for (auto &pair : table_cards_) {
-    hands_[defender_].push_back(pair.first);
-    if (pair.second >= 0) {
-      hands_[defender_].push_back(pair.second);
-    }
-  }
-  table_cards_.clear();
-  phase_ = RoundPhase::kAttack;
-  RefillHands();
-}
-
-// The attacker decides not to lay more cards
-void DurakState::AttackerFinishesAttack() {
-  if (table_cards_.empty()) {
-    return;
-  }
-  phase_ = RoundPhase::kDefense;
-}
-
-// The defender says "done" if all are covered; else effectively picks up
-void DurakState::DefenderFinishesDefense() {
-  // if uncovered => pick up, else discard
-  bool uncovered = false;
-  for (auto &pair : table_cards_) {
-    if (pair.second < 0) {
-      uncovered = true;
-      break;
-    }
-  }
-  if (uncovered) {
-    // Takes cards
-    DefenderTakesCards();
-  } else {
-    for (auto &pair : table_cards_) {
-      discard_.push_back(pair.first);
-      if (pair.second >= 0) {
-        discard_.push_back(pair.second);
-      }
-    }
-    table_cards_.clear();
-    Player old_attacker = attacker_;
-    attacker_ = defender_;
-    defender_ = old_attacker;
-    RefillHands();
-    phase_ = RoundPhase::kAttack;
-  }
-}
-
-// Refill each player's hand up to 6, starting with the attacker
-void DurakState::RefillHands() {
-  std::array<Player, kNumPlayers> order = {attacker_, defender_};
-  while (deck_pos_ < static_cast<int>(deck_.size())) {
-    bool all_full = true;
-    for (auto p : order) {
-      if (static_cast<int>(hands_[p].size()) < kCardsPerPlayer &&
-          deck_pos_ < static_cast<int>(deck_.size())) {
-        hands_[p].push_back(deck_[deck_pos_]);
-        deck_pos_++;
-      }
-    }
-    for (auto p : order) {
-      if (static_cast<int>(hands_[p].size()) < kCardsPerPlayer) {
-        all_full = false;
-      }
-    }
-    if (all_full) break;
-  }
-}
-
-// Observations (unchanged, placeholders)
-std::string DurakState::InformationStateString(Player player) const {
-  // For single-player private info style, it's typically the same as
-  // ObservationString if we are only exposing that player's hand.
-  return ObservationString(player);
-}
-
-std::string DurakState::ObservationString(Player player) const {
-  std::string str = absl::StrCat("Player ", player, " viewpoint. Phase=",
-                                 static_cast<int>(phase_),
-                                 " Attacker=", attacker_,
-                                 " Defender=", defender_, "\n");
-  absl::StrAppend(&str, "Trump card: ",
-                  (trump_card_ < 0 ? "None" : CardToString(trump_card_)), "\n");
-  absl::StrAppend(&str, "My Hand: ");
-  for (int c : hands_[player]) {
-    absl::StrAppend(&str, CardToString(c), " ");
-  }
-  absl::StrAppend(&str, "\nTable: ");
-  for (auto &pair : table_cards_) {
-    int ac = pair.first;
-    int dc = pair.second;
-    absl::StrAppend(&str, CardToString(ac), "->",
-                    (dc < 0 ? "?" : CardToString(dc)), "  ");
-  }
-  absl::StrAppend(&str, "\nDeckRemaining=", (deck_.size() - deck_pos_), "\n");
-  return str;
-}
-
-void DurakState::InformationStateTensor(Player player,
-                                        absl::Span<float> values) const {
-  ObservationTensor(player, values);
-}
-
-void DurakState::ObservationTensor(Player player,
-                                   absl::Span<float> values) const {
-  SPIEL_CHECK_EQ(values.size(), 157);
-  for (int i = 0; i < 157; i++) {
-    values[i] = 0.f;
-  }
-}
-
-// -----------------------------------------------------------------------------
-// DurakObserver
-// -----------------------------------------------------------------------------
-
-DurakObserver::DurakObserver(IIGObservationType iig_obs_type)
-    : Observer(/*has_string=*/true, /*has_tensor=*/true),
-      iig_obs_type_(iig_obs_type) {}
-
-void DurakObserver::WriteTensor(const State& observed_state, int player,
-                                Allocator* allocator) const {
-  const DurakState& state = open_spiel::down_cast<const DurakState&>(observed_state);
-  auto out = allocator->Get("observation", {157});
-  std::vector<float> tmp(157, 0.f);
-  state.ObservationTensor(player, absl::MakeSpan(tmp));
-  for (int i = 0; i < 157; ++i) {
-    out.at(i) = tmp[i];
-  }
-}
-
-std::string DurakObserver::StringFrom(const State& observed_state,
-                                      int player) const {
-  const DurakState& state = open_spiel::down_cast<const DurakState&>(observed_state);
-  return state.ObservationString(player);
-}
-
-}  // namespace durak
-}  // namespace open_spiel
+// Copyright 2025
+// C++ Durak implementation for OpenSpiel
+//
+// durak.cc: logic, state transitions, observer, etc.
+//
+// Everything below is templated on the rank count (see DurakDeck in durak.h)
+// and explicitly instantiated at the bottom of this file for the three
+// registered deck sizes.
+
+#include "open_spiel/games/durak/durak.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "open_spiel/abseil-cpp/absl/random/distributions.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/game_parameters.h"
+#include "open_spiel/observer.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/tensor_view.h"
+
+namespace open_spiel {
+namespace durak {
+namespace {
+
+// Construct a GameType object with enough info for standard usage. The
+// variants share everything but the name (see MakeGameType below).
+const GameType kGameType{
+    /*short_name=*/"durak",
+    /*long_name=*/"Durak",
+    GameType::Dynamics::kSequential,
+    GameType::ChanceMode::kExplicitStochastic,
+    GameType::Information::kImperfectInformation,
+    GameType::Utility::kZeroSum,
+    GameType::RewardModel::kTerminal,
+    /*max_num_players=*/kNumPlayers,
+    /*min_num_players=*/kNumPlayers,
+    /*provides_information_state_string=*/true,
+    /*provides_information_state_tensor=*/true,
+    /*provides_observation_string=*/true,
+    /*provides_observation_tensor=*/true,
+    /*parameter_specification=*/{
+      {"init_deck", GameParameter(std::string(""))},
+      {"rng_seed", GameParameter(0)},
+      // When true, the entire deal (12 cards plus the trump reveal) is one
+      // composite chance outcome applied in a single step, and the game
+      // reports itself as kSampledStochastic. Tree algorithms that sample
+      // chance then pay one chance level instead of ~13; full-deal
+      // enumeration is deliberately unavailable in this mode.
+      {"sampled_deal", GameParameter(false)},
+    },
+    /*default_loadable=*/true,
+    /*provides_factored_observation_string=*/true,
+    /*provides_legal_actions_cache=*/true,
+    // Every chance node reveals the single predetermined next card of the
+    // shuffled deck (probability 1), which is trivially uniform.
+    /*uniform_chance_outcomes=*/true,
+    /*provides_bounded_history=*/true
+};
+
+const GameInfo kGameInfo{
+    /*num_distinct_actions=*/kNumCards + 3,
+    /*max_chance_outcomes=*/kNumCards,
+    /*num_players=*/kNumPlayers,
+    /*min_utility=*/-1.0,
+    /*max_utility=*/1.0,
+    /*utility_sum=*/0.0,
+    /*max_game_length=*/300
+};
+
+template <int NumRanks>
+GameType MakeGameType() {
+  GameType game_type = kGameType;
+  if constexpr (NumRanks == 6) {
+    game_type.short_name = "durak_short";
+    game_type.long_name = "Durak (24-card deck)";
+  } else if constexpr (NumRanks == 13) {
+    game_type.short_name = "durak52";
+    game_type.long_name = "Durak (52-card deck)";
+  }
+  return game_type;
+}
+
+template <int NumRanks>
+std::shared_ptr<const Game> Factory(const GameParameters& params) {
+  return std::make_shared<DurakGameT<NumRanks>>(params);
+}
+
+// We register the variants with OpenSpiel's internal catalog.
+REGISTER_SPIEL_GAME(MakeGameType<9>(), Factory<9>);
+REGISTER_SPIEL_GAME(MakeGameType<6>(), Factory<6>);
+REGISTER_SPIEL_GAME(MakeGameType<13>(), Factory<13>);
+
+// Offsets into the flat tensor; see the layout comment in durak.h. Only the
+// card planes move with the deck size: the 13-entry scalar head is fixed.
+template <int NumRanks>
+struct TensorOffsets {
+  static constexpr int kNumCards = DurakDeck<NumRanks>::kNumCards;
+  static constexpr int kPlayer = 0;
+  static constexpr int kTrumpSuit = 2;
+  static constexpr int kPhase = 6;
+  static constexpr int kDeckSize = 10;
+  static constexpr int kRoles = 11;
+  static constexpr int kTrumpCard = 13;
+  static constexpr int kMyCards = kTrumpCard + kNumCards;
+  static constexpr int kTableAttack = kMyCards + kNumCards;
+  static constexpr int kTableDefense = kTableAttack + kNumCards;
+};
+
+// Offsets into the compact feature vector; see the layout comment next to
+// DurakDeck::kCompactTensorSize. No entry depends on the deck size except
+// the rank multi-hot tail, so the struct is not templated.
+struct CompactOffsets {
+  static constexpr int kPlayer = 0;
+  static constexpr int kTrumpSuit = 2;
+  static constexpr int kPhase = 6;
+  static constexpr int kDeckSize = 10;
+  static constexpr int kRoles = 11;
+  static constexpr int kTrumpRevealed = 13;
+  static constexpr int kTrumpRank = 14;
+  static constexpr int kSuitCounts = 15;
+  static constexpr int kSuitMeanRank = 19;
+  static constexpr int kHoldsTrump = 23;
+  static constexpr int kHighestTrump = 24;
+  static constexpr int kHandSize = 25;
+  static constexpr int kOppHandSize = 26;
+  static constexpr int kDiscardSize = 27;
+  static constexpr int kTableCounts = 28;
+  static constexpr int kCoverable = 31;
+  static constexpr int kCoverOptions = 32;
+  static constexpr int kDeckEmpty = 33;
+  static constexpr int kTableRanks = 34;
+};
+
+// Patches a card plane so it matches `now`, touching only the entries whose
+// membership changed since `before`.
+void PatchCardPlane(float* plane, CardSet before, CardSet now) {
+  for (CardSet diff = before ^ now; diff != 0; diff &= diff - 1) {
+    int c = LowestCard(diff);
+    plane[c] = ((now >> c) & 1) ? 1.f : 0.f;
+  }
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// DurakGameT implementation
+// -----------------------------------------------------------------------------
+
+template <int NumRanks>
+DurakGameT<NumRanks>::DurakGameT(const GameParameters& params)
+    : Game(MakeGameType<NumRanks>(), params),
+      rng_seed_(ParameterValue<int>("rng_seed")),
+      sampled_deal_(ParameterValue<bool>("sampled_deal")) {
+  if (sampled_deal_) {
+    game_type_.chance_mode = GameType::ChanceMode::kSampledStochastic;
+  }
+}
+
+template <int NumRanks>
+std::unique_ptr<State> DurakGameT<NumRanks>::NewInitialState() const {
+  return std::unique_ptr<State>(
+      new DurakStateT<NumRanks>(shared_from_this(), rng_seed_));
+}
+
+template <int NumRanks>
+std::vector<int> DurakGameT<NumRanks>::InformationStateTensorShape() const {
+  // A single flat dimension covering the whole layout (see durak.h):
+  //     [2] (which player) + 4 (trump_suit) + 4 (phase) + 1 (deck_size) +
+  //     2 (attacker_ind, defender_ind) + kNumCards (trump_card) +
+  //     kNumCards (my_cards) + 2 * kNumCards (table_attack, table_defense).
+  return {Deck::kTensorSize};
+}
+
+template <int NumRanks>
+std::vector<int> DurakGameT<NumRanks>::ObservationTensorShape() const {
+  // Typically, the same or similar shape. Possibly fewer bits if we exclude
+  // private info. Let's reuse the same dimension for simplicity.
+  return {Deck::kTensorSize};
+}
+
+template <int NumRanks>
+std::shared_ptr<Observer> DurakGameT<NumRanks>::MakeObserver(
+    absl::optional<IIGObservationType> iig_obs_type,
+    const GameParameters& params) const {
+  // Construct or fill out the fields on IIGObservationType:
+  IIGObservationType obs_type = iig_obs_type.value_or(IIGObservationType());
+  obs_type.public_info = false;
+  obs_type.perfect_recall = false;
+  obs_type.private_info = PrivateInfoType::kSinglePlayer;
+
+  // Observer parameter {"compact", true} selects the engineered feature
+  // vector instead of the card planes (see DurakCompactObserverT in
+  // durak.h).
+  auto compact_it = params.find("compact");
+  if (compact_it != params.end() && compact_it->second.bool_value()) {
+    return std::make_shared<DurakCompactObserverT<NumRanks>>(obs_type);
+  }
+
+  return std::make_shared<DurakObserverT<NumRanks>>(obs_type);
+}
+
+// -----------------------------------------------------------------------------
+// DurakStateT implementation
+// -----------------------------------------------------------------------------
+
+template <int NumRanks>
+DurakStateT<NumRanks>::DurakStateT(std::shared_ptr<const Game> game,
+                                   int rng_seed)
+    : State(game), rng_seed_(rng_seed) {  // Initialize rng_seed_
+  const auto* durak_game = down_cast<const DurakGameT<NumRanks>*>(game.get());
+  sampled_deal_ = durak_game->sampled_deal();
+  auto param_map = durak_game->GetParameters();
+  auto it = param_map.find("init_deck");
+  std::string deck_str = (it != param_map.end()) ? it->second.string_value() : "";
+
+  if (deck_str.empty()) {
+    // Initialize a standard ordered deck
+    for (int i = 0; i < kNumCards; i++) {
+      deck_.push_back(i);
+    }
+
+    // Create a reproducible random engine
+    FastRng rng(rng_seed_);
+
+    // Shuffle the deck using the free function
+    ShuffleDeck(&rng, deck_, 0, kNumCards);
+  } else {
+    // Parse the deck string
+    std::stringstream ss(deck_str);
+    for (int i = 0; i < kNumCards; i++) {
+      int c;
+      char comma;
+      ss >> c;
+      deck_.push_back(c);
+      if (i < kNumCards - 1) ss >> comma;  // consume comma
+    }
+  }
+
+  // 2) Initialize hands, table, discard, etc.
+  for (int p = 0; p < kNumPlayers; ++p) {
+    hands_[p] = 0;
+  }
+  table_cards_.clear();
+  discard_ = 0;
+  trump_suit_ = -1;
+  trump_card_ = -1;
+  cards_dealt_ = 0;
+  deck_pos_ = 0;
+
+  attacker_ = 0;
+  defender_ = 1;
+  phase_ = RoundPhase::kChance;
+  round_starter_ = 0;
+  game_over_ = false;
+}
+
+template <int NumRanks>
+Player DurakStateT<NumRanks>::CurrentPlayer() const {
+  if (game_over_) return kTerminalPlayerId;
+  if (phase_ == RoundPhase::kChance) return kChancePlayerId;
+  // Attack or Additional => attacker, Defense => defender
+  if (phase_ == RoundPhase::kAttack || phase_ == RoundPhase::kAdditional) {
+    return attacker_;
+  }
+  return defender_;
+}
+
+template <int NumRanks>
+bool DurakStateT<NumRanks>::IsTerminal() const {
+  return game_over_;
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::ReturnsInto(absl::Span<double> returns) const {
+  SPIEL_CHECK_EQ(returns.size(), kNumPlayers);
+  returns[0] = 0.0;
+  returns[1] = 0.0;
+  if (!game_over_) return;
+
+  bool p0_has_cards = (hands_[0] != 0);
+  bool p1_has_cards = (hands_[1] != 0);
+
+  // If exactly one player still has cards => that player is the loser: -1
+  // The other is winner => +1
+  if (p0_has_cards != p1_has_cards) {
+    int loser = p0_has_cards ? 0 : 1;
+    returns[loser] = -1.0;
+    returns[1 - loser] = 1.0;
+    return;
+  }
+
+  // If neither has cards => check deck. If deck is empty => last attacker
+  // wins. Both with cards, or deck not empty, falls through to [0, 0].
+  if (!p0_has_cards && !p1_has_cards &&
+      deck_pos_ >= static_cast<int>(deck_.size())) {
+    returns[attacker_] = 1.0;
+    returns[1 - attacker_] = -1.0;
+  }
+}
+
+template <int NumRanks>
+std::vector<double> DurakStateT<NumRanks>::Returns() const {
+  std::vector<double> returns(kNumPlayers);
+  ReturnsInto(absl::MakeSpan(returns));
+  return returns;
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::CheckGameOver() {
+  // This method is called after each move to see if game is done.
+
+  // If a player is out of cards and deck is also empty => game over
+  bool p0_empty = (hands_[0] == 0);
+  bool p1_empty = (hands_[1] == 0);
+
+  if ((p0_empty || p1_empty) && deck_pos_ >= static_cast<int>(deck_.size())) {
+    game_over_ = true;
+    return;
+  }
+
+  // If both players have no cards
+  if (p0_empty && p1_empty) {
+    // If deck is also empty => done
+    if (deck_pos_ >= static_cast<int>(deck_.size())) {
+      game_over_ = true;
+      return;
+    } else {
+      // Refill
+      RefillHands();
+    }
+  }
+}
+
+template <int NumRanks>
+std::string DurakStateT<NumRanks>::ToString() const {
+  std::string str;
+  absl::StrAppend(&str, "Phase=", static_cast<int>(phase_),
+                  " Attack=", attacker_, " Defend=", defender_,
+                  " DeckPos=", deck_pos_, "/", deck_.size(),
+                  " TrumpSuit=", trump_suit_,
+                  " TrumpCard=", trump_card_ < 0 ? "None" : CardToString(trump_card_),
+                  " game_over=", (game_over_ ? "true" : "false"), "\n");
+  for (int p = 0; p < kNumPlayers; ++p) {
+    absl::StrAppend(&str, "Player ", p, " hand: ");
+    for (CardSet m = hands_[p]; m != 0; m &= m - 1) {
+      absl::StrAppend(&str, CardToString(LowestCard(m)), " ");
+    }
+    absl::StrAppend(&str, "\n");
+  }
+  absl::StrAppend(&str, "Table: ");
+  for (auto &pair : table_cards_) {
+    int ac = pair.first;
+    int dc = pair.second;
+    absl::StrAppend(&str, CardToString(ac), "->",
+                    (dc < 0 ? "?" : CardToString(dc)), "  ");
+  }
+  absl::StrAppend(&str, "\nDiscard: ", CardSetSize(discard_), " cards\n");
+  return str;
+}
+
+template <int NumRanks>
+std::unique_ptr<State> DurakStateT<NumRanks>::Clone() const {
+  return std::unique_ptr<State>(new DurakStateT(*this));
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::DealFromMask(Player observer, CardSet unseen_mask,
+                                         FastRng* rng) {
+  SPIEL_CHECK_TRUE(phase_ != RoundPhase::kChance);
+  SPIEL_CHECK_GE(observer, 0);
+  SPIEL_CHECK_LT(observer, kNumPlayers);
+  const Player opponent = 1 - observer;
+
+  // Pack the unseen cards into a flat array and shuffle them once.
+  int cards[kNumCards];
+  int n = 0;
+  for (CardSet m = unseen_mask; m != 0; m &= m - 1) {
+    cards[n++] = LowestCard(m);
+  }
+  for (int i = 0; i < n - 1; ++i) {
+    int j = i + static_cast<int>(rng->UniformInt(n - i));
+    std::swap(cards[i], cards[j]);
+  }
+
+  const int deck_size = static_cast<int>(deck_.size());
+  // The revealed trump card sits at the bottom of the deck and is public
+  // knowledge; it keeps its slot if it has not been drawn yet.
+  const bool trump_in_deck = (deck_pos_ < deck_size);
+  const int opp_size = CardSetSize(hands_[opponent]);
+  const int hidden_deck_cards =
+      (deck_size - deck_pos_) - (trump_in_deck ? 1 : 0);
+  SPIEL_CHECK_EQ(n, opp_size + hidden_deck_cards);
+
+  // First opp_size shuffled cards form the opponent's hand; the rest fill
+  // the undealt deck slots above the trump card.
+  CardSet opp_hand = 0;
+  for (int i = 0; i < opp_size; ++i) opp_hand |= CardBit(cards[i]);
+  hands_[opponent] = opp_hand;
+  for (int i = 0; i < hidden_deck_cards; ++i) {
+    deck_[deck_pos_ + i] = cards[opp_size + i];
+  }
+  InvalidateLegalActionsCache();
+}
+
+template <int NumRanks>
+std::unique_ptr<State> DurakStateT<NumRanks>::ResampleFromInfostate(
+    int player_id, std::function<double()> rng) const {
+  SPIEL_CHECK_TRUE(phase_ != RoundPhase::kChance);
+  SPIEL_CHECK_GE(player_id, 0);
+  SPIEL_CHECK_LT(player_id, kNumPlayers);
+  auto clone = std::make_unique<DurakStateT>(*this);
+  const Player opponent = 1 - player_id;
+
+  // The unseen pool is the opponent's hand plus the hidden deck cards; the
+  // revealed trump card is public and keeps its slot at the bottom.
+  const int deck_size = static_cast<int>(deck_.size());
+  const bool trump_in_deck = (deck_pos_ < deck_size);
+  const int hidden_deck_cards =
+      (deck_size - deck_pos_) - (trump_in_deck ? 1 : 0);
+  int cards[kNumCards];
+  int n = 0;
+  for (CardSet m = hands_[opponent]; m != 0; m &= m - 1) {
+    cards[n++] = LowestCard(m);
+  }
+  for (int i = 0; i < hidden_deck_cards; ++i) {
+    cards[n++] = deck_[deck_pos_ + i];
+  }
+
+  // One Fisher-Yates pass driven by the caller's rng; the first opp_size
+  // shuffled cards become the opponent's hand, the rest refill the hidden
+  // deck slots (same layout as DealFromMask).
+  for (int i = 0; i < n - 1; ++i) {
+    int j = i + static_cast<int>(rng() * (n - i));
+    j = std::min(j, n - 1);  // Guard against rng() rounding up to 1.
+    std::swap(cards[i], cards[j]);
+  }
+  const int opp_size = CardSetSize(hands_[opponent]);
+  CardSet opp_hand = 0;
+  for (int i = 0; i < opp_size; ++i) opp_hand |= CardBit(cards[i]);
+  clone->hands_[opponent] = opp_hand;
+  for (int i = 0; i < hidden_deck_cards; ++i) {
+    clone->deck_[deck_pos_ + i] = cards[opp_size + i];
+  }
+  clone->InvalidateLegalActionsCache();
+  return clone;
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::CloneInto(DurakStateT* dest) const {
+  SPIEL_CHECK_TRUE(dest != nullptr);
+  SPIEL_CHECK_TRUE(dest->game_.get() == game_.get());
+  // Vector assignments below reuse the destination's existing capacity; all
+  // remaining members are plain scalars or fixed-size arrays.
+  dest->history_ = history_;
+  dest->move_number_ = move_number_;
+  dest->deck_ = deck_;
+  dest->hands_ = hands_;
+  dest->table_cards_ = table_cards_;
+  dest->discard_ = discard_;
+  dest->rng_seed_ = rng_seed_;
+  dest->sampled_deal_ = sampled_deal_;
+  dest->trump_suit_ = trump_suit_;
+  dest->trump_card_ = trump_card_;
+  dest->cards_dealt_ = cards_dealt_;
+  dest->deck_pos_ = deck_pos_;
+  dest->attacker_ = attacker_;
+  dest->defender_ = defender_;
+  dest->phase_ = phase_;
+  dest->round_starter_ = round_starter_;
+  dest->game_over_ = game_over_;
+  dest->tensor_cache_ = tensor_cache_;
+  dest->tensor_cache_valid_ = tensor_cache_valid_;
+  dest->cached_hand_ = cached_hand_;
+  dest->cached_table_attack_ = cached_table_attack_;
+  dest->cached_table_defense_ = cached_table_defense_;
+  dest->cached_trump_card_ = cached_trump_card_;
+}
+
+namespace {
+
+// Fixed-size head of the binary state snapshot (see SerializeBinary); the
+// deck order and the table pairs follow as single bytes. Host-endian, like
+// the SerializeGameAndStateBinary container it travels in.
+struct BinaryStateHeader {
+  uint64_t hands[kNumPlayers];
+  uint64_t discard;
+  int32_t rng_seed;
+  int32_t trump_suit;
+  int32_t trump_card;
+  int32_t cards_dealt;
+  int32_t deck_pos;
+  int32_t attacker;
+  int32_t defender;
+  int32_t phase;
+  int32_t round_starter;
+  int32_t move_number;
+  uint8_t game_over;
+  uint8_t deck_size;
+  uint8_t num_table_pairs;
+};
+
+}  // namespace
+
+template <int NumRanks>
+std::string DurakStateT<NumRanks>::SerializeBinary() const {
+  BinaryStateHeader header = {};
+  for (int p = 0; p < kNumPlayers; ++p) header.hands[p] = hands_[p];
+  header.discard = discard_;
+  header.rng_seed = rng_seed_;
+  header.trump_suit = trump_suit_;
+  header.trump_card = trump_card_;
+  header.cards_dealt = cards_dealt_;
+  header.deck_pos = deck_pos_;
+  header.attacker = attacker_;
+  header.defender = defender_;
+  header.phase = static_cast<int32_t>(phase_);
+  header.round_starter = round_starter_;
+  header.move_number = move_number_;
+  header.game_over = game_over_ ? 1 : 0;
+  header.deck_size = static_cast<uint8_t>(deck_.size());
+  header.num_table_pairs = static_cast<uint8_t>(table_cards_.size());
+
+  std::string out(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.reserve(sizeof(header) + deck_.size() + 2 * table_cards_.size());
+  for (int card : deck_) out.push_back(static_cast<char>(card));
+  for (const auto& [attack_card, defense_card] : table_cards_) {
+    out.push_back(static_cast<char>(attack_card));
+    // -1 (uncovered attack) round-trips through the signed byte.
+    out.push_back(static_cast<char>(defense_card));
+  }
+  return out;
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::RestoreFromBinary(const std::string& str) {
+  SPIEL_CHECK_GE(str.size(), sizeof(BinaryStateHeader));
+  BinaryStateHeader header;
+  std::memcpy(&header, str.data(), sizeof(header));
+  SPIEL_CHECK_EQ(
+      str.size(),
+      sizeof(header) + header.deck_size + 2 * header.num_table_pairs);
+
+  for (int p = 0; p < kNumPlayers; ++p) hands_[p] = header.hands[p];
+  discard_ = header.discard;
+  rng_seed_ = header.rng_seed;
+  trump_suit_ = header.trump_suit;
+  trump_card_ = header.trump_card;
+  cards_dealt_ = header.cards_dealt;
+  deck_pos_ = header.deck_pos;
+  attacker_ = header.attacker;
+  defender_ = header.defender;
+  phase_ = static_cast<RoundPhase>(header.phase);
+  round_starter_ = header.round_starter;
+  game_over_ = header.game_over != 0;
+
+  size_t offset = sizeof(header);
+  deck_.clear();
+  for (int i = 0; i < header.deck_size; ++i) {
+    deck_.push_back(static_cast<int8_t>(str[offset++]));
+  }
+  table_cards_.clear();
+  for (int i = 0; i < header.num_table_pairs; ++i) {
+    int attack_card = static_cast<int8_t>(str[offset++]);
+    int defense_card = static_cast<int8_t>(str[offset++]);
+    table_cards_.emplace_back(attack_card, defense_card);
+  }
+
+  // The snapshot carries no history (restoring without replay is the point).
+  history_.clear();
+  move_number_ = header.move_number;
+  tensor_cache_valid_ = {false, false};
+  InvalidateLegalActionsCache();
+}
+
+template <int NumRanks>
+std::unique_ptr<State> DurakGameT<NumRanks>::DeserializeStateBinary(
+    const std::string& str) const {
+  std::unique_ptr<State> state = NewInitialState();
+  down_cast<DurakStateT<NumRanks>*>(state.get())->RestoreFromBinary(str);
+  return state;
+}
+
+template <int NumRanks>
+bool DurakStateT<NumRanks>::IsChanceNode() const {
+  return (phase_ == RoundPhase::kChance);
+}
+
+template <int NumRanks>
+std::vector<std::pair<Action, double>> DurakStateT<NumRanks>::ChanceOutcomes()
+    const {
+  std::vector<std::pair<Action, double>> outcomes;
+  if (sampled_deal_) {
+    // kSampledStochastic style: one composite outcome standing for the
+    // whole deal, sampled internally from the pre-shuffled deck.
+    outcomes.push_back({0, 1.0});
+    return outcomes;
+  }
+  if (cards_dealt_ < kCardsPerPlayer * kNumPlayers) {
+    int next_card = deck_[deck_pos_];
+    outcomes.push_back({next_card, 1.0});
+  } else {
+    if (trump_card_ < 0) {
+      int bottom_card = deck_.back();
+      outcomes.push_back({bottom_card, 1.0});
+    }
+  }
+  return outcomes;
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::ApplyChanceAction(Action outcome) {
+  if (sampled_deal_) {
+    // The composite deal: all initial cards plus the trump reveal in one
+    // step. Same card placement as the explicit chance walk below.
+    while (cards_dealt_ < kCardsPerPlayer * kNumPlayers) {
+      hands_[cards_dealt_ % kNumPlayers] |= CardBit(deck_[deck_pos_]);
+      ++deck_pos_;
+      ++cards_dealt_;
+    }
+    trump_card_ = deck_.back();
+    trump_suit_ = SuitOf(deck_.back());
+    DecideFirstAttacker();
+    phase_ = RoundPhase::kAttack;
+    round_starter_ = attacker_;
+    return;
+  }
+  // If we haven't dealt 6 cards each to both players, deal from top
+  if (cards_dealt_ < kCardsPerPlayer * kNumPlayers) {
+    // Deal this card to the next player
+    int player_idx = cards_dealt_ % kNumPlayers;
+    hands_[player_idx] |= CardBit(outcome);
+    ++deck_pos_;
+    ++cards_dealt_;
+  } else {
+    // Reveal the last card as trump
+    trump_card_ = deck_.back();
+    trump_suit_ = SuitOf(deck_.back());
+    DecideFirstAttacker();
+    phase_ = RoundPhase::kAttack;
+    round_starter_ = attacker_;
+  }
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::DoApplyAction(Action move) {
+  if (IsChanceNode()) {
+    ApplyChanceAction(move);
+    CheckGameOver();
+    return;
+  }
+  if (game_over_) return;
+
+  Player player = CurrentPlayer();
+  if (move >= kNumCards) {
+    if (move == kExtraActionTakeCards) {
+      DefenderTakesCards();
+    } else if (move == kExtraActionFinishAttack) {
+      AttackerFinishesAttack();
+    } else if (move == kExtraActionFinishDefense) {
+      DefenderFinishesDefense();
+    }
+    CheckGameOver();
+    return;
+  }
+
+  CardSet &hand = hands_[player];
+  if ((hand & CardBit(move)) == 0) {
+    return;  // invalid
+  }
+
+  if ((phase_ == RoundPhase::kAttack || phase_ == RoundPhase::kAdditional) &&
+      (player == attacker_)) {
+    hand &= ~CardBit(move);
+    table_cards_.push_back(std::make_pair(move, -1));
+    phase_ = RoundPhase::kAttack;
+  } else if (phase_ == RoundPhase::kDefense && (player == defender_)) {
+    int uncovered_index = -1;
+    for (int i = 0; i < static_cast<int>(table_cards_.size()); ++i) {
+      if (table_cards_[i].second < 0) {
+        uncovered_index = i;
+        break;
+      }
+    }
+    if (uncovered_index >= 0) {
+      int att_card = table_cards_[uncovered_index].first;
+      if (CanDefendCard(move, att_card)) {
+        hand &= ~CardBit(move);
+        table_cards_[uncovered_index].second = move;
+        bool all_covered = true;
+        for (auto &pair : table_cards_) {
+          if (pair.second < 0) {
+            all_covered = false;
+            break;
+          }
+        }
+        if (all_covered) {
+          phase_ = RoundPhase::kAdditional;
+        }
+      }
+    }
+  }
+
+  CheckGameOver();
+}
+
+template <int NumRanks>
+template <class Vector>
+void DurakStateT<NumRanks>::GenerateLegalActions(Vector* moves) const {
+  moves->clear();
+  if (game_over_) return;
+  if (IsChanceNode()) {
+    // Return the forced dealing outcome(s)
+    auto co = ChanceOutcomes();
+    for (auto &o : co) {
+      moves->push_back(o.first);
+    }
+    return;
+  }
+
+  Player player = CurrentPlayer();
+  const CardSet hand = hands_[player];
+
+  if (phase_ == RoundPhase::kAttack || phase_ == RoundPhase::kAdditional) {
+    if (player == attacker_) {
+      if (table_cards_.empty()) {
+        // can place any card
+        for (CardSet m = hand; m != 0; m &= m - 1) {
+          moves->push_back(LowestCard(m));
+        }
+      } else if (static_cast<int>(table_cards_.size()) < kCardsPerPlayer &&
+                 hands_[defender_] != 0) {
+        // can only place ranks that appear on the table
+        uint32_t ranks_on_table = 0;  // kNumRanks-bit rank mask
+        for (auto &pair : table_cards_) {
+          ranks_on_table |= uint32_t{1} << RankOf(pair.first);
+          if (pair.second >= 0) {
+            ranks_on_table |= uint32_t{1} << RankOf(pair.second);
+          }
+        }
+        for (CardSet m = hand; m != 0; m &= m - 1) {
+          int c = LowestCard(m);
+          if ((ranks_on_table >> RankOf(c)) & 1) {
+            moves->push_back(c);
+          }
+        }
+      }
+      // can always FINISH_ATTACK if there's at least 1 card on the table
+      if (!table_cards_.empty()) {
+        moves->push_back(kExtraActionFinishAttack);
+      }
+    }
+  } else if (phase_ == RoundPhase::kDefense) {
+    // can TAKE_CARDS, or cover earliest uncovered, or FINISH_DEFENSE if none uncovered
+    if (player == defender_) {
+      bool any_uncovered = false;
+      int earliest_uncovered = -1;
+      for (int i = 0; i < static_cast<int>(table_cards_.size()); ++i) {
+        if (table_cards_[i].second < 0) {
+          any_uncovered = true;
+          if (earliest_uncovered < 0) earliest_uncovered = i;
+        }
+      }
+      if (!any_uncovered) {
+        moves->push_back(kExtraActionFinishDefense);
+      } else {
+        moves->push_back(kExtraActionTakeCards);
+      // try to cover earliest
+        if (earliest_uncovered >= 0) {
+          int att_card = table_cards_[earliest_uncovered].first;
+          for (CardSet m = hand & kBeatsTable[trump_suit_][att_card]; m != 0;
+               m &= m - 1) {
+            moves->push_back(LowestCard(m));
+          }
+        }
+      }
+    }
+  }
+
+  std::sort(moves->begin(), moves->end());
+}
+
+template <int NumRanks>
+std::vector<Action> DurakStateT<NumRanks>::LegalActions() const {
+  std::vector<Action> moves;
+  GenerateLegalActions(&moves);
+  return moves;
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::LegalActions(InlinedActionsVector* actions) const {
+  GenerateLegalActions(actions);
+}
+
+template <int NumRanks>
+std::string DurakStateT<NumRanks>::ActionToString(Player /*player*/,
+                                                  Action action_id) const {
+  if (sampled_deal_ && phase_ == RoundPhase::kChance) return "SAMPLED_DEAL";
+  if (action_id == kExtraActionTakeCards) return "TAKE_CARDS";
+  if (action_id == kExtraActionFinishAttack) return "FINISH_ATTACK";
+  if (action_id == kExtraActionFinishDefense) return "FINISH_DEFENSE";
+  if (action_id >= 0 && action_id < kNumCards) {
+    return absl::StrCat("Play:", CardToString(action_id));
+  }
+  return "UnknownAction";
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::UndoAction(Player /*player*/, Action /*move*/) {
+  SpielFatalError("UndoAction is not implemented for Durak.");
+}
+
+// Helper: decide first attacker by lowest trump card
+template <int NumRanks>
+void DurakStateT<NumRanks>::DecideFirstAttacker() {
+  int lowest_trump = -1;
+  Player who = 0;
+  for (int p = 0; p < kNumPlayers; ++p) {
+    for (CardSet m = hands_[p]; m != 0; m &= m - 1) {
+      int c = LowestCard(m);
+      if (SuitOf(c) == trump_suit_) {
+        if (lowest_trump < 0 || RankOf(c) < RankOf(lowest_trump)) {
+          lowest_trump = c;
+          who = p;
+        }
+      }
+    }
+  }
+  attacker_ = who;
+  defender_ = 1 - who;
+}
+
+// Helper: can defense_card cover attack_card?
+template <int NumRanks>
+bool DurakStateT<NumRanks>::CanDefendCard(int defense_card,
+                                          int attack_card) const {
+  if (trump_suit_ < 0) return false;
+  return (kBeatsTable[trump_suit_][attack_card] & CardBit(defense_card)) != 0;
+}
+
+// The defender picks up all table cards
+template <int NumRanks>
+void DurakStateT<NumRanks>::DefenderTakesCards() {
+  for (auto &pair : table_cards_) {
+    hands_[defender_] |= CardBit(pair.first);
+    if (pair.second >= 0) {
+      hands_[defender_] |= CardBit(pair.second);
+    }
+  }
+  table_cards_.clear();
+  phase_ = RoundPhase::kAttack;
+  RefillHands();
+}
+
+// The attacker decides not to lay more cards
+template <int NumRanks>
+void DurakStateT<NumRanks>::AttackerFinishesAttack() {
+  if (table_cards_.empty()) {
+    return;
+  }
+  phase_ = RoundPhase::kDefense;
+}
+
+// The defender says "done" if all are covered; else effectively picks up
+template <int NumRanks>
+void DurakStateT<NumRanks>::DefenderFinishesDefense() {
+  // if uncovered => pick up, else discard
+  bool uncovered = false;
+  for (auto &pair : table_cards_) {
+    if (pair.second < 0) {
+      uncovered = true;
+      break;
+    }
+  }
+  if (uncovered) {
+    // Takes cards
+    DefenderTakesCards();
+  } else {
+    for (auto &pair : table_cards_) {
+      discard_ |= CardBit(pair.first);
+      if (pair.second >= 0) {
+        discard_ |= CardBit(pair.second);
+      }
+    }
+    table_cards_.clear();
+    Player old_attacker = attacker_;
+    attacker_ = defender_;
+    defender_ = old_attacker;
+    RefillHands();
+    phase_ = RoundPhase::kAttack;
+  }
+}
+
+// Refill each player's hand up to 6, starting with the attacker
+template <int NumRanks>
+void DurakStateT<NumRanks>::RefillHands() {
+  std::array<Player, kNumPlayers> order = {attacker_, defender_};
+  while (deck_pos_ < static_cast<int>(deck_.size())) {
+    bool all_full = true;
+    for (auto p : order) {
+      if (CardSetSize(hands_[p]) < kCardsPerPlayer &&
+          deck_pos_ < static_cast<int>(deck_.size())) {
+        hands_[p] |= CardBit(deck_[deck_pos_]);
+        deck_pos_++;
+      }
+    }
+    for (auto p : order) {
+      if (CardSetSize(hands_[p]) < kCardsPerPlayer) {
+        all_full = false;
+      }
+    }
+    if (all_full) break;
+  }
+}
+
+// Observations (unchanged, placeholders)
+template <int NumRanks>
+std::string DurakStateT<NumRanks>::InformationStateString(
+    Player player) const {
+  // For single-player private info style, it's typically the same as
+  // ObservationString if we are only exposing that player's hand.
+  return ObservationString(player);
+}
+
+namespace {
+
+// splitmix64 finalizer; a full-avalanche mixer for combining the packed
+// state words in InformationStateHash.
+inline uint64_t SplitMix64(uint64_t z) {
+  z += 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+inline uint64_t HashCombine64(uint64_t h, uint64_t v) {
+  return SplitMix64(h ^ SplitMix64(v));
+}
+
+}  // namespace
+
+template <int NumRanks>
+uint64_t DurakStateT<NumRanks>::InformationStateHash(Player player) const {
+  SPIEL_CHECK_GE(player, 0);
+  SPIEL_CHECK_LT(player, kNumPlayers);
+  // Everything InformationStateString depends on, packed into a few words:
+  // the scalars fit comfortably in one, the hand mask is already a word, and
+  // each ordered table pair contributes one (order matters, so the pairs are
+  // chained through the combiner rather than XOR-ed).
+  uint64_t scalars = static_cast<uint64_t>(player);
+  scalars = scalars << 2 | static_cast<uint64_t>(phase_);
+  scalars = scalars << 1 | static_cast<uint64_t>(attacker_);
+  scalars = scalars << 6 | static_cast<uint64_t>(trump_card_ + 1);
+  scalars = scalars << 6 | static_cast<uint64_t>(deck_.size() - deck_pos_);
+  uint64_t h = HashCombine64(0x6475726b'68617368ULL, scalars);
+  h = HashCombine64(h, hands_[player]);
+  for (const auto& [attack_card, defense_card] : table_cards_) {
+    h = HashCombine64(h, static_cast<uint64_t>(attack_card + 1) << 7 |
+                             static_cast<uint64_t>(defense_card + 1));
+  }
+  return h;
+}
+
+template <int NumRanks>
+uint64_t DurakStateT<NumRanks>::PublicStateId() const {
+  // Same packing scheme as InformationStateHash, but restricted to public
+  // information: the private hand masks are replaced by their sizes, and the
+  // discard pile (public: both players saw every card that reached it)
+  // contributes its mask.
+  uint64_t scalars = static_cast<uint64_t>(phase_);
+  scalars = scalars << 1 | static_cast<uint64_t>(attacker_);
+  scalars = scalars << 1 | static_cast<uint64_t>(game_over_);
+  scalars = scalars << 6 | static_cast<uint64_t>(trump_card_ + 1);
+  scalars = scalars << 6 | static_cast<uint64_t>(deck_.size() - deck_pos_);
+  scalars = scalars << 6 | static_cast<uint64_t>(CardSetSize(hands_[0]));
+  scalars = scalars << 6 | static_cast<uint64_t>(CardSetSize(hands_[1]));
+  uint64_t h = HashCombine64(0x6475726b'70756231ULL, scalars);
+  h = HashCombine64(h, discard_);
+  for (const auto& [attack_card, defense_card] : table_cards_) {
+    h = HashCombine64(h, static_cast<uint64_t>(attack_card + 1) << 7 |
+                             static_cast<uint64_t>(defense_card + 1));
+  }
+  return h;
+}
+
+template <int NumRanks>
+std::string DurakStateT<NumRanks>::ObservationString(Player player) const {
+  std::string str = absl::StrCat("Player ", player, " viewpoint. Phase=",
+                                 static_cast<int>(phase_),
+                                 " Attacker=", attacker_,
+                                 " Defender=", defender_, "\n");
+  absl::StrAppend(&str, "Trump card: ",
+                  (trump_card_ < 0 ? "None" : CardToString(trump_card_)), "\n");
+  absl::StrAppend(&str, "My Hand: ");
+  for (CardSet m = hands_[player]; m != 0; m &= m - 1) {
+    absl::StrAppend(&str, CardToString(LowestCard(m)), " ");
+  }
+  absl::StrAppend(&str, "\nTable: ");
+  for (auto &pair : table_cards_) {
+    int ac = pair.first;
+    int dc = pair.second;
+    absl::StrAppend(&str, CardToString(ac), "->",
+                    (dc < 0 ? "?" : CardToString(dc)), "  ");
+  }
+  absl::StrAppend(&str, "\nDeckRemaining=", (deck_.size() - deck_pos_), "\n");
+  return str;
+}
+
+template <int NumRanks>
+std::string DurakStateT<NumRanks>::CanonicalInfoStateString(
+    Player player) const {
+  SPIEL_CHECK_GE(trump_suit_, 0);
+
+  // Per-suit rank masks of everything the player observes.
+  std::array<uint32_t, 4> hand_ranks = {};
+  std::array<uint32_t, 4> attack_ranks = {};
+  std::array<uint32_t, 4> defense_ranks = {};
+  for (CardSet m = hands_[player]; m != 0; m &= m - 1) {
+    const int c = LowestCard(m);
+    hand_ranks[SuitOf(c)] |= 1u << RankOf(c);
+  }
+  for (const auto& [attack_card, defense_card] : table_cards_) {
+    attack_ranks[SuitOf(attack_card)] |= 1u << RankOf(attack_card);
+    if (defense_card >= 0) {
+      defense_ranks[SuitOf(defense_card)] |= 1u << RankOf(defense_card);
+    }
+  }
+
+  // Trump takes slot 0. Non-trump suits with hand cards come next in their
+  // concrete order — keeping that order makes the relabeling monotone on
+  // the hand, so sorted legal action lists stay aligned across the states
+  // this key merges. The hand-free suits fill the remaining slots, ordered
+  // by their table masks so suits that differ only by name coincide.
+  std::array<int, 4> slot_of_suit;
+  slot_of_suit[trump_suit_] = 0;
+  int next_slot = 1;
+  for (int s = 0; s < 4; ++s) {
+    if (s != trump_suit_ && hand_ranks[s] != 0) slot_of_suit[s] = next_slot++;
+  }
+  std::array<int, 4> rest;
+  int num_rest = 0;
+  for (int s = 0; s < 4; ++s) {
+    if (s != trump_suit_ && hand_ranks[s] == 0) rest[num_rest++] = s;
+  }
+  std::stable_sort(rest.begin(), rest.begin() + num_rest, [&](int a, int b) {
+    return std::make_pair(attack_ranks[a], defense_ranks[a]) >
+           std::make_pair(attack_ranks[b], defense_ranks[b]);
+  });
+  for (int i = 0; i < num_rest; ++i) slot_of_suit[rest[i]] = next_slot++;
+
+  const auto relabel = [&slot_of_suit](int card) {
+    return slot_of_suit[SuitOf(card)] * kNumRanks + RankOf(card);
+  };
+
+  std::string key = absl::StrCat(
+      "Phase=", static_cast<int>(phase_),
+      " Role=", player == attacker_ ? "A" : "D",
+      " Deck=", deck_.size() - deck_pos_,
+      " TrumpRank=", trump_card_ < 0 ? -1 : RankOf(trump_card_), " Hand:");
+  for (int s = 0; s < 4; ++s) {
+    // Slot order, not suit order: find the suit occupying each slot.
+    for (int suit = 0; suit < 4; ++suit) {
+      if (slot_of_suit[suit] == s) {
+        absl::StrAppend(&key, " ", hand_ranks[suit]);
+        break;
+      }
+    }
+  }
+  absl::StrAppend(&key, " Table:");
+  for (const auto& [attack_card, defense_card] : table_cards_) {
+    absl::StrAppend(&key, " ", relabel(attack_card), ">",
+                    defense_card < 0 ? -1 : relabel(defense_card));
+  }
+  return key;
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::InformationStateTensor(
+    Player player, absl::Span<float> values) const {
+  ObservationTensor(player, values);
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::UpdateTensorCache(Player player) const {
+  using Off = TensorOffsets<NumRanks>;
+  std::array<float, kTensorSize>& buf = tensor_cache_[player];
+  if (!tensor_cache_valid_[player]) {
+    buf.fill(0.f);
+    cached_hand_[player] = 0;
+    cached_table_attack_[player] = 0;
+    cached_table_defense_[player] = 0;
+    cached_trump_card_[player] = -1;
+    tensor_cache_valid_[player] = true;
+  }
+
+  // The scalar head (13 entries) is cheap enough to rewrite every call.
+  std::fill(buf.begin(), buf.begin() + Off::kTrumpCard, 0.f);
+  buf[Off::kPlayer + player] = 1.f;
+  if (trump_suit_ >= 0) buf[Off::kTrumpSuit + trump_suit_] = 1.f;
+  buf[Off::kPhase + static_cast<int>(phase_)] = 1.f;
+  buf[Off::kDeckSize] =
+      static_cast<float>(deck_.size() - deck_pos_) / kNumCards;
+  if (player == attacker_) buf[Off::kRoles] = 1.f;
+  if (player == defender_) buf[Off::kRoles + 1] = 1.f;
+
+  // The trump card plane changes at most once per game.
+  if (trump_card_ != cached_trump_card_[player]) {
+    if (cached_trump_card_[player] >= 0) {
+      buf[Off::kTrumpCard + cached_trump_card_[player]] = 0.f;
+    }
+    if (trump_card_ >= 0) buf[Off::kTrumpCard + trump_card_] = 1.f;
+    cached_trump_card_[player] = trump_card_;
+  }
+
+  // Card planes: patch only the bits that moved since the last encode.
+  PatchCardPlane(&buf[Off::kMyCards], cached_hand_[player], hands_[player]);
+  cached_hand_[player] = hands_[player];
+
+  CardSet attack_mask = 0;
+  CardSet defense_mask = 0;
+  for (auto &pair : table_cards_) {
+    attack_mask |= CardBit(pair.first);
+    if (pair.second >= 0) defense_mask |= CardBit(pair.second);
+  }
+  PatchCardPlane(&buf[Off::kTableAttack], cached_table_attack_[player],
+                 attack_mask);
+  cached_table_attack_[player] = attack_mask;
+  PatchCardPlane(&buf[Off::kTableDefense], cached_table_defense_[player],
+                 defense_mask);
+  cached_table_defense_[player] = defense_mask;
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::ObservationTensor(Player player,
+                                              absl::Span<float> values) const {
+  SPIEL_CHECK_GE(player, 0);
+  SPIEL_CHECK_LT(player, kNumPlayers);
+  SPIEL_CHECK_EQ(values.size(), kTensorSize);
+  UpdateTensorCache(player);
+  std::copy(tensor_cache_[player].begin(), tensor_cache_[player].end(),
+            values.begin());
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::ObservationBits(Player player,
+                                            absl::Span<uint8_t> values) const {
+  using Off = TensorOffsets<NumRanks>;
+  SPIEL_CHECK_GE(player, 0);
+  SPIEL_CHECK_LT(player, kNumPlayers);
+  SPIEL_CHECK_EQ(values.size(), kTensorSize);
+  std::fill(values.begin(), values.end(), 0);
+
+  values[Off::kPlayer + player] = 1;
+  if (trump_suit_ >= 0) values[Off::kTrumpSuit + trump_suit_] = 1;
+  values[Off::kPhase + static_cast<int>(phase_)] = 1;
+  // The one non-binary entry: the raw remaining-deck count.
+  values[Off::kDeckSize] = static_cast<uint8_t>(deck_.size() - deck_pos_);
+  if (player == attacker_) values[Off::kRoles] = 1;
+  if (player == defender_) values[Off::kRoles + 1] = 1;
+  if (trump_card_ >= 0) values[Off::kTrumpCard + trump_card_] = 1;
+
+  SetBitsFromMask(values.subspan(Off::kMyCards, kNumCards), hands_[player]);
+  for (const auto& [attack_card, defense_card] : table_cards_) {
+    values[Off::kTableAttack + attack_card] = 1;
+    if (defense_card >= 0) values[Off::kTableDefense + defense_card] = 1;
+  }
+}
+
+template <int NumRanks>
+void DurakStateT<NumRanks>::CompactObservationTensor(
+    Player player, absl::Span<float> values) const {
+  using Off = CompactOffsets;
+  constexpr int R = NumRanks;
+  SPIEL_CHECK_GE(player, 0);
+  SPIEL_CHECK_LT(player, kNumPlayers);
+  SPIEL_CHECK_EQ(values.size(), Deck::kCompactTensorSize);
+  std::fill(values.begin(), values.end(), 0.f);
+
+  values[Off::kPlayer + player] = 1.f;
+  if (trump_suit_ >= 0) values[Off::kTrumpSuit + trump_suit_] = 1.f;
+  values[Off::kPhase + static_cast<int>(phase_)] = 1.f;
+  const int deck_remaining = static_cast<int>(deck_.size()) - deck_pos_;
+  values[Off::kDeckSize] = static_cast<float>(deck_remaining) / kNumCards;
+  if (player == attacker_) values[Off::kRoles] = 1.f;
+  if (player == defender_) values[Off::kRoles + 1] = 1.f;
+  if (trump_card_ >= 0) {
+    values[Off::kTrumpRevealed] = 1.f;
+    values[Off::kTrumpRank] = static_cast<float>(RankOf(trump_card_)) / (R - 1);
+  }
+
+  const CardSet hand = hands_[player];
+  const int hand_size = CardSetSize(hand);
+  for (int suit = 0; suit < 4; ++suit) {
+    const CardSet suit_cards = hand & card_set::SuitMask(suit, R);
+    const int count = CardSetSize(suit_cards);
+    values[Off::kSuitCounts + suit] = static_cast<float>(count) / R;
+    if (count > 0) {
+      int rank_sum = 0;
+      card_set::ForEachCard(suit_cards,
+                            [&](int card) { rank_sum += RankOf(card); });
+      values[Off::kSuitMeanRank + suit] =
+          static_cast<float>(rank_sum) / (count * (R - 1));
+    }
+  }
+  if (trump_suit_ >= 0) {
+    const CardSet trumps = hand & card_set::SuitMask(trump_suit_, R);
+    if (trumps != 0) {
+      values[Off::kHoldsTrump] = 1.f;
+      // Cards iterate in increasing order, so the last one is the highest.
+      int highest = -1;
+      card_set::ForEachCard(trumps, [&](int card) { highest = card; });
+      values[Off::kHighestTrump] = static_cast<float>(RankOf(highest)) / (R - 1);
+    }
+  }
+  values[Off::kHandSize] = static_cast<float>(hand_size) / kNumCards;
+  values[Off::kOppHandSize] =
+      static_cast<float>(CardSetSize(hands_[1 - player])) / kNumCards;
+  values[Off::kDiscardSize] = static_cast<float>(CardSetSize(discard_)) /
+                              kNumCards;
+
+  // Table coverage: counts plus two relations between the uncovered attacks
+  // and the observer's hand, computed from the beats-table masks.
+  const int num_attacks = static_cast<int>(table_cards_.size());
+  int num_covered = 0;
+  int beatable = 0;
+  float beating_options = 0.f;
+  for (const auto& [attack_card, defense_card] : table_cards_) {
+    values[Off::kTableRanks + RankOf(attack_card)] = 1.f;
+    if (defense_card >= 0) {
+      ++num_covered;
+      values[Off::kTableRanks + RankOf(defense_card)] = 1.f;
+    } else if (trump_suit_ >= 0) {
+      const CardSet beats = kBeatsTable[trump_suit_][attack_card] & hand;
+      if (beats != 0) ++beatable;
+      if (hand_size > 0) {
+        beating_options += static_cast<float>(CardSetSize(beats)) / hand_size;
+      }
+    }
+  }
+  const int num_uncovered = num_attacks - num_covered;
+  values[Off::kTableCounts] = static_cast<float>(num_attacks) / kCardsPerPlayer;
+  values[Off::kTableCounts + 1] =
+      static_cast<float>(num_covered) / kCardsPerPlayer;
+  values[Off::kTableCounts + 2] =
+      static_cast<float>(num_uncovered) / kCardsPerPlayer;
+  if (num_uncovered > 0) {
+    values[Off::kCoverable] = static_cast<float>(beatable) / num_uncovered;
+    values[Off::kCoverOptions] = beating_options / num_uncovered;
+  }
+  if (deck_remaining == 0) values[Off::kDeckEmpty] = 1.f;
+}
+
+// -----------------------------------------------------------------------------
+// DurakObserverT
+// -----------------------------------------------------------------------------
+
+template <int NumRanks>
+DurakObserverT<NumRanks>::DurakObserverT(IIGObservationType iig_obs_type)
+    : Observer(/*has_string=*/true, /*has_tensor=*/true),
+      iig_obs_type_(iig_obs_type) {}
+
+template <int NumRanks>
+void DurakObserverT<NumRanks>::WriteTensor(const State& observed_state,
+                                           int player,
+                                           Allocator* allocator) const {
+  const auto& state =
+      open_spiel::down_cast<const DurakStateT<NumRanks>&>(observed_state);
+  // Write straight into the allocator's span; no scratch buffer.
+  auto out = allocator->Get("observation", {DurakDeck<NumRanks>::kTensorSize});
+  state.ObservationTensor(player, out.data());
+}
+
+template <int NumRanks>
+std::string DurakObserverT<NumRanks>::StringFrom(const State& observed_state,
+                                                 int player) const {
+  const auto& state =
+      open_spiel::down_cast<const DurakStateT<NumRanks>&>(observed_state);
+  return state.ObservationString(player);
+}
+
+// -----------------------------------------------------------------------------
+// DurakCompactObserverT
+// -----------------------------------------------------------------------------
+
+template <int NumRanks>
+DurakCompactObserverT<NumRanks>::DurakCompactObserverT(
+    IIGObservationType iig_obs_type)
+    : Observer(/*has_string=*/true, /*has_tensor=*/true),
+      iig_obs_type_(iig_obs_type) {}
+
+template <int NumRanks>
+void DurakCompactObserverT<NumRanks>::WriteTensor(const State& observed_state,
+                                                  int player,
+                                                  Allocator* allocator) const {
+  const auto& state =
+      open_spiel::down_cast<const DurakStateT<NumRanks>&>(observed_state);
+  auto out = allocator->Get("observation",
+                            {DurakDeck<NumRanks>::kCompactTensorSize});
+  state.CompactObservationTensor(player, out.data());
+}
+
+template <int NumRanks>
+std::string DurakCompactObserverT<NumRanks>::StringFrom(
+    const State& observed_state, int player) const {
+  // The string form stays the exact observation; only the tensor is
+  // compressed.
+  const auto& state =
+      open_spiel::down_cast<const DurakStateT<NumRanks>&>(observed_state);
+  return state.ObservationString(player);
+}
+
+// -----------------------------------------------------------------------------
+// Suit-permutation data augmentation
+// -----------------------------------------------------------------------------
+
+int SuitAugmentationRanks(const std::string& short_name) {
+  if (short_name == "durak" || short_name == "durak_with_transfers") return 9;
+  if (short_name == "durak_short") return 6;
+  if (short_name == "durak52") return 13;
+  return 0;
+}
+
+void AugmentWithSuitPermutation(int num_ranks, absl::Span<float> observation,
+                                std::vector<Action>* legal_actions,
+                                ActionsAndProbs* policy, std::mt19937* rng) {
+  const int num_cards = num_ranks * 4;
+  SPIEL_CHECK_EQ(observation.size(), 13 + 4 * num_cards);
+
+  // The trump suit, read from the one-hot head (see TensorOffsets). Before
+  // the reveal there is nothing card-indexed to permute.
+  int trump_suit = -1;
+  for (int suit = 0; suit < 4; ++suit) {
+    if (observation[2 + suit] != 0) trump_suit = suit;
+  }
+  if (trump_suit < 0) return;
+
+  // Uniform permutation of the other three suits, identity included.
+  std::array<int, 4> suit_map = {0, 1, 2, 3};
+  std::array<int, 3> others;
+  int n = 0;
+  for (int suit = 0; suit < 4; ++suit) {
+    if (suit != trump_suit) others[n++] = suit;
+  }
+  std::array<int, 3> targets = others;
+  for (int i = 2; i > 0; --i) {
+    std::swap(targets[i], targets[absl::Uniform<int>(*rng, 0, i + 1)]);
+  }
+  for (int i = 0; i < 3; ++i) suit_map[others[i]] = targets[i];
+
+  // The suit-major card layout moves whole rank blocks: suit s's block
+  // lands at suit_map[s]'s position in each of the four card planes.
+  std::array<float, 52> scratch;  // Sized for the largest deck.
+  for (int plane = 0; plane < 4; ++plane) {
+    float* data = observation.data() + 13 + plane * num_cards;
+    std::copy(data, data + num_cards, scratch.begin());
+    for (int suit = 0; suit < 4; ++suit) {
+      std::copy(scratch.begin() + suit * num_ranks,
+                scratch.begin() + (suit + 1) * num_ranks,
+                data + suit_map[suit] * num_ranks);
+    }
+  }
+
+  // Remap the card-indexed actions; the extra actions sit above num_cards
+  // and keep their ids. Re-sort so the lists stay in canonical order.
+  const auto map_card = [&](Action card) {
+    return suit_map[card / num_ranks] * num_ranks + card % num_ranks;
+  };
+  for (Action& action : *legal_actions) {
+    if (action < num_cards) action = map_card(action);
+  }
+  std::sort(legal_actions->begin(), legal_actions->end());
+  for (auto& [action, prob] : *policy) {
+    if (action < num_cards) action = map_card(action);
+  }
+  std::sort(policy->begin(), policy->end());
+}
+
+// -----------------------------------------------------------------------------
+// Explicit instantiations for the registered deck sizes.
+// -----------------------------------------------------------------------------
+
+template class DurakStateT<6>;
+template class DurakStateT<9>;
+template class DurakStateT<13>;
+template class DurakGameT<6>;
+template class DurakGameT<9>;
+template class DurakGameT<13>;
+template class DurakObserverT<6>;
+template class DurakObserverT<9>;
+template class DurakObserverT<13>;
+template class DurakCompactObserverT<6>;
+template class DurakCompactObserverT<9>;
+template class DurakCompactObserverT<13>;
+
+}  // namespace durak
+}  // namespace open_spiel
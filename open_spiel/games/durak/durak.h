@@ -1,199 +1,557 @@
-#ifndef OPEN_SPIEL_GAMES_DURAK_H_
-#define OPEN_SPIEL_GAMES_DURAK_H_
-
-#include <array>
-#include <memory>
-#include <string>
-#include <utility>
-#include <vector>
-
-#include "open_spiel/observer.h"
-#include "open_spiel/spiel.h"
-
-namespace open_spiel {
-namespace durak {
-
-// -----------------------------------------------------------------------------
-// Global definitions and constants
-// -----------------------------------------------------------------------------
-
-constexpr int kNumPlayers = 2;
-constexpr int kNumCards = 36;          // 9 ranks (6..A) * 4 suits
-constexpr int kCardsPerPlayer = 6;
-constexpr int kExtraActionTakeCards      = kNumCards;     // 36
-constexpr int kExtraActionFinishAttack   = kNumCards + 1; // 37
-constexpr int kExtraActionFinishDefense  = kNumCards + 2; // 38
-
-enum class RoundPhase {
-  kChance = 0,
-  kAttack = 1,
-  kDefense = 2,
-  kAdditional = 3
-};
-
-// Helper functions to interpret 0..35 as card indices.
-inline int SuitOf(int card) { return card / 9; }
-inline int RankOf(int card) { return card % 9; }
-
-// A small helper for debugging/logging if needed.
-inline std::string CardToString(int card) {
-  if (card < 0 || card >= kNumCards) return "None";
-  static const std::array<const char*, 4> suit_symbols = {"♠", "♣", "♦", "♥"};
-  static const std::array<const char*, 9> rank_symbols =
-      {"6", "7", "8", "9", "10", "J", "Q", "K", "A"};
-  int s = SuitOf(card);
-  int r = RankOf(card);
-  return std::string(rank_symbols[r]) + suit_symbols[s];
-}
-
-// Implement deck shuffling.
-void ShuffleDeck(std::mt19937* rng, std::vector<int>& deck, int begin, int end);
-
-// Forward declarations
-class DurakGame;
-class DurakObserver;
-
-// -----------------------------------------------------------------------------
-// DurakState: the game state container & logic
-// -----------------------------------------------------------------------------
-
-class DurakState : public State {
- public:
-  explicit DurakState(std::shared_ptr<const Game> game, int rng_seed);
-  DurakState(const DurakState&) = default;
-  DurakState& operator=(const DurakState&) = delete;
-
-  // Core API
-  Player CurrentPlayer() const override;
-  std::vector<Action> LegalActions() const override;
-  std::string ActionToString(Player player, Action action_id) const override;
-  bool IsTerminal() const override;
-  std::vector<double> Returns() const override;
-  std::string ToString() const override;
-  std::unique_ptr<State> Clone() const override;
-  void UndoAction(Player player, Action move) override;
-
-  // Chance handling
-  bool IsChanceNode() const override;
-  std::vector<std::pair<Action, double>> ChanceOutcomes() const override;
-
-  // Observations
-  std::string InformationStateString(Player player) const override;
-  std::string ObservationString(Player player) const override;
-  void InformationStateTensor(Player player,
-                              absl::Span<float> values) const override;
-  void ObservationTensor(Player player,
-                         absl::Span<float> values) const override;
-
- protected:
-  // ApplyAction is the main method that modifies the state in response to moves.
-  void DoApplyAction(Action move) override;
-
- private:
-  // ---------- Helper/Private Methods ----------
-
-  // For dealing chance cards and revealing the trump.
-  void ApplyChanceAction(Action outcome);
-
-  // Determines the first attacker based on the lowest trump in any player's hand.
-  void DecideFirstAttacker();
-
-  // Helpers for valid defense coverage, picking up cards, finishing phases, etc.
-  bool CanDefendCard(int defense_card, int attack_card) const;
-  void DefenderTakesCards();
-  void AttackerFinishesAttack();
-  void DefenderFinishesDefense();
-  void RefillHands();
-  void CheckGameOver();
-
-  // Game state
-  std::vector<int> deck_;  
-  std::array<std::vector<int>, kNumPlayers> hands_;
-  std::vector<std::pair<int, int>> table_cards_;
-  std::vector<int> discard_;
-
-  // Random number generator seed
-  int rng_seed_ = 0;
-
-  // Which suit is trump? 0..3, or -1 if unknown.
-  int trump_suit_ = -1;
-  // The actual trump card index, or -1 if not revealed yet.
-  int trump_card_ = -1;
-
-  // Dealing progress: how many total cards have been dealt so far?
-  int cards_dealt_ = 0;
-  // Deck position for the next card to be dealt from the top. 
-  int deck_pos_ = 0;
-
-  // Roles
-  Player attacker_ = 0;
-  Player defender_ = 1;
-  // Which phase are we in?
-  RoundPhase phase_ = RoundPhase::kChance;
-
-  // For reference or special rules: who started this round as attacker?
-  Player round_starter_ = 0;
-
-  // Game over flag
-  bool game_over_ = false;
-};
-
-// -----------------------------------------------------------------------------
-// DurakGame
-// -----------------------------------------------------------------------------
-
-class DurakGame : public Game {
- public:
-  explicit DurakGame(const GameParameters& params);
-
-  // Implement the base interface:
-  int NumDistinctActions() const override { return kNumCards + 3; }
-  std::unique_ptr<State> NewInitialState() const override;
-  int MaxChanceOutcomes() const override { return kNumCards; }
-  int NumPlayers() const override { return kNumPlayers; }
-  double MinUtility() const override { return -1.0; }
-  double MaxUtility() const override { return 1.0; }
-  absl::optional<double> UtilitySum() const override { return 0.0; }
-
-  // For Durak, a safe upper bound on game length could be fairly high.
-  int MaxGameLength() const override { return 300; }
-
-  // We do have up to 12 dealing moves for the initial cards, plus 1 for trump reveal,
-  // so max chance nodes might be 13 for the initial plus a few refills. But 36 is also safe.
-  int MaxChanceNodesInHistory() const override { return 36; }
-
-  // Observations
-  std::vector<int> InformationStateTensorShape() const override;
-  std::vector<int> ObservationTensorShape() const override;
-
-  // Construct an observer that knows how to interpret states (see durak.cc).
-  std::shared_ptr<Observer> MakeObserver(
-      absl::optional<IIGObservationType> iig_obs_type,
-      const GameParameters& params) const override;
-
- private:
-  mutable int rng_seed_ = 0;
-};
-
-// -----------------------------------------------------------------------------
-// An Observer
-// -----------------------------------------------------------------------------
-
-class DurakObserver : public Observer {
- public:
-  explicit DurakObserver(IIGObservationType iig_obs_type);
-
-  void WriteTensor(const State& observed_state, int player,
-                   Allocator* allocator) const override;
-
-  std::string StringFrom(const State& observed_state,
-                         int player) const override;
-
- private:
-  IIGObservationType iig_obs_type_;
-};
-
-}  // namespace durak
-}  // namespace open_spiel
-
-#endif  // OPEN_SPIEL_GAMES_DURAK_H_
+#ifndef OPEN_SPIEL_GAMES_DURAK_H_
+#define OPEN_SPIEL_GAMES_DURAK_H_
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/observer.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/utils/card_set.h"
+
+namespace open_spiel {
+namespace durak {
+
+// -----------------------------------------------------------------------------
+// Global definitions and constants
+// -----------------------------------------------------------------------------
+
+constexpr int kNumPlayers = 2;
+constexpr int kCardsPerPlayer = 6;
+
+enum class RoundPhase {
+  kChance = 0,
+  kAttack = 1,
+  kDefense = 2,
+  kAdditional = 3
+};
+
+// Card sets (hands, discard pile) are stored as 64-bit masks; see
+// open_spiel/utils/card_set.h. Every deck below fits in a single uint64_t,
+// so membership tests, insertion/removal and counting are all single
+// instructions and copying a state is a flat memcpy.
+using card_set::CardSet;
+using card_set::CardBit;
+using card_set::CardSetSize;
+using card_set::LowestCard;
+
+// Deck shuffling, shared with the other packed-card-set games.
+using card_set::ShuffleDeck;
+
+// -----------------------------------------------------------------------------
+// Deck geometry
+//
+// The game logic is templated on the number of ranks so that the card count,
+// the action ids, the beats-tables and the tensor layout are all constexpr
+// per instantiation and every per-card loop is statically sized. Suits are
+// always 4. The registered variants (see durak.cc):
+//   durak        36 cards (9 ranks, 6..A)   - the default game
+//   durak_short  24 cards (6 ranks, 9..A)
+//   durak52      52 cards (13 ranks, 2..A)
+// -----------------------------------------------------------------------------
+
+// BeatsMask<N>(t, c) is the mask of cards that beat card c when suit t is
+// trump: higher cards of the same suit, plus every trump when c is not a
+// trump itself. Computed at compile time so defense move generation is a
+// single table load and mask intersection with the defender's hand.
+template <int NumRanks>
+constexpr CardSet BeatsMask(int trump_suit, int attack_card) {
+  CardSet mask = 0;
+  for (int d = 0; d < NumRanks * 4; ++d) {
+    const bool same_suit_higher =
+        card_set::SuitOf(d, NumRanks) == card_set::SuitOf(attack_card, NumRanks) &&
+        card_set::RankOf(d, NumRanks) > card_set::RankOf(attack_card, NumRanks);
+    const bool trump_over_plain =
+        card_set::SuitOf(d, NumRanks) == trump_suit &&
+        card_set::SuitOf(attack_card, NumRanks) != trump_suit;
+    if (same_suit_higher || trump_over_plain) mask |= CardBit(d);
+  }
+  return mask;
+}
+
+template <int NumRanks>
+constexpr std::array<std::array<CardSet, NumRanks * 4>, 4> MakeBeatsTable() {
+  std::array<std::array<CardSet, NumRanks * 4>, 4> table = {};
+  for (int t = 0; t < 4; ++t) {
+    for (int c = 0; c < NumRanks * 4; ++c) {
+      table[t][c] = BeatsMask<NumRanks>(t, c);
+    }
+  }
+  return table;
+}
+
+// All geometry derived from the rank count, bundled so the state, game and
+// observer templates pull their constants from one place.
+template <int NumRanks>
+struct DurakDeck {
+  static constexpr int kNumRanks = NumRanks;
+  static constexpr int kNumSuits = 4;
+  static constexpr int kNumCards = NumRanks * kNumSuits;
+  static constexpr int kExtraActionTakeCards = kNumCards;
+  static constexpr int kExtraActionFinishAttack = kNumCards + 1;
+  static constexpr int kExtraActionFinishDefense = kNumCards + 2;
+
+  // Flat observation/information-state tensor layout (here N = kNumCards):
+  //   [0,2)          observing player (one-hot)
+  //   [2,6)          trump suit (one-hot)
+  //   [6,10)         round phase (one-hot)
+  //   [10]           normalized deck size
+  //   [11,13)        observer-is-attacker, observer-is-defender indicators
+  //   [13,13+N)      revealed trump card (one-hot over cards)
+  //   [13+N,13+2N)   observer's hand (multi-hot over cards)
+  //   [13+2N,13+3N)  attack cards on the table (multi-hot)
+  //   [13+3N,13+4N)  defense cards on the table (multi-hot)
+  static constexpr int kTensorSize = 13 + 4 * kNumCards;
+
+  // Compact engineered feature layout (see DurakCompactObserverT): scalar
+  // summaries — suit counts, trump holdings, table coverage relations, deck
+  // depth — instead of the one-hot card planes above. With R = kNumRanks:
+  //   [0,2)      observing player (one-hot)
+  //   [2,6)      trump suit (one-hot)
+  //   [6,10)     round phase (one-hot)
+  //   [10]       remaining deck size / kNumCards
+  //   [11,13)    observer-is-attacker, observer-is-defender indicators
+  //   [13]       trump card revealed
+  //   [14]       trump card rank / (R-1)
+  //   [15,19)    per-suit hand counts / R
+  //   [19,23)    per-suit mean hand rank / (R-1), 0 when the suit is empty
+  //   [23]       observer holds at least one trump
+  //   [24]       highest trump rank held / (R-1)
+  //   [25]       hand size / kNumCards
+  //   [26]       opponent hand size / kNumCards
+  //   [27]       discard pile size / kNumCards
+  //   [28,31)    attack / covered / uncovered table counts, / kCardsPerPlayer
+  //   [31]       fraction of uncovered attacks the observer can beat
+  //   [32]       mean beating cards per uncovered attack / hand size
+  //   [33]       deck exhausted indicator
+  //   [34,34+R)  ranks present on the table (multi-hot)
+  static constexpr int kCompactTensorSize = 34 + NumRanks;
+
+  // Helpers to interpret 0..kNumCards-1 as card indices (suit-major layout).
+  static constexpr int SuitOf(int card) {
+    return card_set::SuitOf(card, kNumRanks);
+  }
+  static constexpr int RankOf(int card) {
+    return card_set::RankOf(card, kNumRanks);
+  }
+
+  // kBeatsTable[t][c] is BeatsMask<NumRanks>(t, c); shared between the state
+  // and the batch rollout engine.
+  static constexpr std::array<std::array<CardSet, kNumCards>, 4> kBeatsTable =
+      MakeBeatsTable<NumRanks>();
+
+  // A small helper for debugging/logging if needed.
+  static std::string CardToString(int card) {
+    if (card < 0 || card >= kNumCards) return "None";
+    static const std::array<const char*, 4> suit_symbols =
+        {"♠", "♣", "♦", "♥"};
+    // Rank 0 of an N-rank deck is the (13 - N)-th rank of the full 2..A
+    // order: the short decks drop the low ranks.
+    static const std::array<const char*, 13> rank_symbols =
+        {"2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K", "A"};
+    return std::string(rank_symbols[13 - kNumRanks + RankOf(card)]) +
+           suit_symbols[SuitOf(card)];
+  }
+};
+
+// The default 36-card geometry at namespace scope. The helper modules in
+// this directory (rollout engine, belief tracker, tablebase) are written
+// against the default deck and keep using these names.
+constexpr int kNumRanks = 9;
+using DefaultDeck = DurakDeck<kNumRanks>;
+constexpr int kNumCards = DefaultDeck::kNumCards;              // 36
+constexpr int kExtraActionTakeCards = DefaultDeck::kExtraActionTakeCards;
+constexpr int kExtraActionFinishAttack = DefaultDeck::kExtraActionFinishAttack;
+constexpr int kExtraActionFinishDefense =
+    DefaultDeck::kExtraActionFinishDefense;
+constexpr int kTensorSize = DefaultDeck::kTensorSize;          // 157
+constexpr int kCompactTensorSize = DefaultDeck::kCompactTensorSize;  // 43
+
+inline constexpr int SuitOf(int card) { return DefaultDeck::SuitOf(card); }
+inline constexpr int RankOf(int card) { return DefaultDeck::RankOf(card); }
+inline constexpr auto& kBeatsTable = DefaultDeck::kBeatsTable;
+inline std::string CardToString(int card) {
+  return DefaultDeck::CardToString(card);
+}
+
+// Forward declarations
+template <int NumRanks> class DurakStateT;
+template <int NumRanks> class DurakGameT;
+template <int NumRanks> class DurakObserverT;
+template <int NumRanks> class DurakCompactObserverT;
+class DurakRolloutEngine;
+class DurakBeliefTracker;
+class DurakTablebase;
+
+// -----------------------------------------------------------------------------
+// DurakStateT: the game state container & logic
+// -----------------------------------------------------------------------------
+
+// Declared final so that solvers instantiated directly against the concrete
+// class (see CFRSolverBase::BindStateType) can bind the State interface
+// statically instead of through the vtable.
+template <int NumRanks>
+class DurakStateT final : public State {
+ public:
+  using Deck = DurakDeck<NumRanks>;
+  static constexpr int kNumRanks = Deck::kNumRanks;
+  static constexpr int kNumCards = Deck::kNumCards;
+  static constexpr int kTensorSize = Deck::kTensorSize;
+  static constexpr int kExtraActionTakeCards = Deck::kExtraActionTakeCards;
+  static constexpr int kExtraActionFinishAttack =
+      Deck::kExtraActionFinishAttack;
+  static constexpr int kExtraActionFinishDefense =
+      Deck::kExtraActionFinishDefense;
+  static constexpr auto& kBeatsTable = Deck::kBeatsTable;
+  static constexpr int SuitOf(int card) { return Deck::SuitOf(card); }
+  static constexpr int RankOf(int card) { return Deck::RankOf(card); }
+  static std::string CardToString(int card) {
+    return Deck::CardToString(card);
+  }
+
+  explicit DurakStateT(std::shared_ptr<const Game> game, int rng_seed);
+  DurakStateT(const DurakStateT&) = default;
+  DurakStateT& operator=(const DurakStateT&) = delete;
+
+  // Core API
+  Player CurrentPlayer() const override;
+  std::vector<Action> LegalActions() const override;
+  // Allocation-free variant; fills `actions` directly from the hand masks.
+  void LegalActions(InlinedActionsVector* actions) const override;
+  std::string ActionToString(Player player, Action action_id) const override;
+  bool IsTerminal() const override;
+  std::vector<double> Returns() const override;
+  // Allocation-free variant; writes both players' returns into the span.
+  void ReturnsInto(absl::Span<double> returns) const override;
+  std::string ToString() const override;
+  std::unique_ptr<State> Clone() const override;
+  void UndoAction(Player player, Action move) override;
+
+  // Copies this state into an existing state (created from the same game),
+  // reusing the destination's vector capacity instead of allocating a
+  // fresh state. Rollout loops that keep one scratch state per thread can
+  // refresh it with this call and avoid the heap traffic of Clone() entirely
+  // once the scratch state's buffers are warm.
+  void CloneInto(DurakStateT* dest) const;
+
+  // Bulk redeal for determinization. Redistributes the cards in unseen_mask
+  // uniformly at random between the opponent of `observer` and the undealt
+  // part of the deck in a single Fisher-Yates pass, replacing the
+  // card-by-card ChanceOutcomes()/ApplyAction() walk. unseen_mask must hold
+  // exactly the opponent's hand plus the undealt deck cards, excluding the
+  // revealed trump card (which is public and keeps its place at the bottom).
+  // Only valid once the initial deal is complete.
+  void DealFromMask(Player observer, CardSet unseen_mask, FastRng* rng);
+
+  // Native determinization for IS-MCTS and belief samplers: clones this
+  // state and redistributes the unseen cards (the opponent's hand plus the
+  // hidden deck cards) uniformly between the opponent and the undealt deck
+  // slots, straight from the masks as in DealFromMask. Runs in O(cards)
+  // with no chance replay. The infostate here is the current observation
+  // (this game is not perfect recall), so a uniform draw from the unseen
+  // pool is consistent with it; use DurakBeliefTracker to additionally
+  // condition on cards the opponent was seen picking up.
+  std::unique_ptr<State> ResampleFromInfostate(
+      int player_id, std::function<double()> rng) const override;
+
+  // Compact binary snapshot of the concrete state: the card masks, the deck
+  // order and the role/phase scalars, a few dozen bytes in total. Restored
+  // by DurakGameT::DeserializeStateBinary with a flat copy instead of
+  // replaying the action history; the restored state has an empty History()
+  // (MoveNumber() is preserved).
+  std::string SerializeBinary() const override;
+
+  // Chance handling
+  bool IsChanceNode() const override;
+  std::vector<std::pair<Action, double>> ChanceOutcomes() const override;
+
+  // Observations
+  std::string InformationStateString(Player player) const override;
+  // Allocation-free 64-bit infostate hash, mixed straight from the packed
+  // fields that InformationStateString prints (observer, phase and roles,
+  // trump card, hand mask, ordered table pairs, remaining deck size), so
+  // equal strings always hash equally.
+  uint64_t InformationStateHash(Player player) const override;
+  // Compact hash-based id of the public state — everything both players can
+  // see: phase and roles, trump card, ordered table pairs, discard pile,
+  // hand sizes, remaining deck size and the game-over flag. Equal public
+  // states always produce equal ids; distinct ones may collide, though with
+  // 64 bits this is vanishingly unlikely. Used as the public-state key by
+  // graph-building algorithms such as FSICFR (see algorithms/fsicfr.h).
+  uint64_t PublicStateId() const;
+  std::string ObservationString(Player player) const override;
+
+  // Canonical infostate key, invariant under permutations of the three
+  // non-trump suits (Durak's rules never distinguish them). Intended for the
+  // InfoStateKeyFn hook of the CFR solvers: it merges suit-isomorphic
+  // infostates into one table entry, shrinking the solvable game by up to
+  // the 3! = 6 relabelings.
+  //
+  // The trump suit keeps slot 0; suits holding cards of the player's hand
+  // keep their relative order (so the relabeling is order-preserving on the
+  // hand and the legal action lists of merged infostates correspond
+  // position by position, which the positional regret tables require); the
+  // remaining suits are ordered by their table footprint. Only valid at
+  // decision nodes, once the trump is revealed.
+  std::string CanonicalInfoStateString(Player player) const;
+  void InformationStateTensor(Player player,
+                              absl::Span<float> values) const override;
+  void ObservationTensor(Player player,
+                         absl::Span<float> values) const override;
+  // Byte-per-entry encoding of the same layout: every entry is 0/1 except
+  // the deck-size slot, which holds the raw remaining-deck count (the float
+  // tensor stores it normalized by kNumCards).
+  void ObservationBits(Player player,
+                       absl::Span<uint8_t> values) const override;
+  // Engineered summary features for the compact observer: the
+  // Deck::kCompactTensorSize-float layout documented in durak.h, computed
+  // straight from the card masks.
+  void CompactObservationTensor(Player player,
+                                absl::Span<float> values) const;
+
+ protected:
+  // ApplyAction is the main method that modifies the state in response to moves.
+  void DoApplyAction(Action move) override;
+
+ private:
+  // The batch rollout engine seeds its slots directly from a state's
+  // internal representation (see durak_rollout_engine.h).
+  friend class DurakRolloutEngine;
+  // The belief tracker reads the public part of the representation and
+  // rewrites the hidden part when determinizing (see durak_belief_tracker.h).
+  friend class DurakBeliefTracker;
+  // The endgame tablebase constructs deck-empty positions directly and keys
+  // probes by the raw masks (see durak_tablebase.h).
+  friend class DurakTablebase;
+  // The static evaluator reads the hand masks and deck counters directly
+  // (see durak_mcts_evaluator.h).
+  friend class DurakStaticEvaluator;
+  // DeserializeStateBinary restores states through RestoreFromBinary.
+  friend class DurakGameT<NumRanks>;
+
+  // Inverse of SerializeBinary; overwrites this state in place.
+  void RestoreFromBinary(const std::string& str);
+
+  // ---------- Helper/Private Methods ----------
+
+  // For dealing chance cards and revealing the trump.
+  void ApplyChanceAction(Action outcome);
+
+  // Determines the first attacker based on the lowest trump in any player's hand.
+  void DecideFirstAttacker();
+
+  // Helpers for valid defense coverage, picking up cards, finishing phases, etc.
+  bool CanDefendCard(int defense_card, int attack_card) const;
+  void DefenderTakesCards();
+  void AttackerFinishesAttack();
+  void DefenderFinishesDefense();
+  void RefillHands();
+  void CheckGameOver();
+
+  // Shared move generator behind both LegalActions() overloads; Vector is
+  // any container with clear/push_back (std::vector, InlinedActionsVector).
+  template <class Vector>
+  void GenerateLegalActions(Vector* moves) const;
+
+  // Brings player's cached tensor buffer up to date by patching only the
+  // entries that changed since the last encode (see ObservationTensor).
+  void UpdateTensorCache(Player player) const;
+
+  // Game state
+  std::vector<int> deck_;
+  // Per-player hands and the discard pile as card masks (see CardSet above).
+  std::array<CardSet, kNumPlayers> hands_ = {0, 0};
+  // The table keeps explicit (attack, defense) pairs because the pairing and
+  // the order of placement matter; it is bounded by kCardsPerPlayer entries.
+  std::vector<std::pair<int, int>> table_cards_;
+  CardSet discard_ = 0;
+
+  // Random number generator seed
+  int rng_seed_ = 0;
+
+  // Mirrors DurakGameT::sampled_deal(): the whole deal is one composite
+  // chance outcome instead of ~13 single-card chance nodes.
+  bool sampled_deal_ = false;
+
+  // Which suit is trump? 0..3, or -1 if unknown.
+  int trump_suit_ = -1;
+  // The actual trump card index, or -1 if not revealed yet.
+  int trump_card_ = -1;
+
+  // Dealing progress: how many total cards have been dealt so far?
+  int cards_dealt_ = 0;
+  // Deck position for the next card to be dealt from the top.
+  int deck_pos_ = 0;
+
+  // Roles
+  Player attacker_ = 0;
+  Player defender_ = 1;
+  // Which phase are we in?
+  RoundPhase phase_ = RoundPhase::kChance;
+
+  // For reference or special rules: who started this round as attacker?
+  Player round_starter_ = 0;
+
+  // Game over flag
+  bool game_over_ = false;
+
+  // Lazily maintained per-player tensor buffers. Instead of rebuilding the
+  // full tensor on every query, ObservationTensor() diffs the current card
+  // sets against the snapshot taken at the last encode and patches only the
+  // entries that changed, so per-move cost is proportional to the number of
+  // cards that actually moved.
+  mutable std::array<std::array<float, kTensorSize>, kNumPlayers>
+      tensor_cache_ = {};
+  mutable std::array<bool, kNumPlayers> tensor_cache_valid_ = {false, false};
+  mutable std::array<CardSet, kNumPlayers> cached_hand_ = {0, 0};
+  mutable std::array<CardSet, kNumPlayers> cached_table_attack_ = {0, 0};
+  mutable std::array<CardSet, kNumPlayers> cached_table_defense_ = {0, 0};
+  mutable std::array<int, kNumPlayers> cached_trump_card_ = {-1, -1};
+};
+
+// -----------------------------------------------------------------------------
+// DurakGameT
+// -----------------------------------------------------------------------------
+
+template <int NumRanks>
+class DurakGameT : public Game {
+ public:
+  using Deck = DurakDeck<NumRanks>;
+
+  explicit DurakGameT(const GameParameters& params);
+
+  // Implement the base interface:
+  int NumDistinctActions() const override { return Deck::kNumCards + 3; }
+  std::unique_ptr<State> NewInitialState() const override;
+  int MaxChanceOutcomes() const override { return Deck::kNumCards; }
+  int NumPlayers() const override { return kNumPlayers; }
+  double MinUtility() const override { return -1.0; }
+  double MaxUtility() const override { return 1.0; }
+  absl::optional<double> UtilitySum() const override { return 0.0; }
+
+  // For Durak, a safe upper bound on game length could be fairly high; the
+  // 52-card deck gets extra headroom.
+  int MaxGameLength() const override {
+    return Deck::kNumCards <= 36 ? 300 : 450;
+  }
+
+  // We have kCardsPerPlayer * kNumPlayers dealing moves for the initial
+  // cards, plus 1 for the trump reveal, so the chance node count is small;
+  // the deck size is a safe bound.
+  int MaxChanceNodesInHistory() const override { return Deck::kNumCards; }
+
+  // With sampled_deal=true the whole deal (12 cards plus the trump reveal)
+  // is one composite chance outcome and the game reports itself as
+  // kSampledStochastic; see the parameter comment in durak.cc.
+  bool sampled_deal() const { return sampled_deal_; }
+
+  // Observations
+  std::vector<int> InformationStateTensorShape() const override;
+  std::vector<int> ObservationTensorShape() const override;
+
+  // Construct an observer that knows how to interpret states (see durak.cc).
+  std::shared_ptr<Observer> MakeObserver(
+      absl::optional<IIGObservationType> iig_obs_type,
+      const GameParameters& params) const override;
+
+  // Binary state snapshots (see DurakStateT::SerializeBinary).
+  bool ProvidesBinaryStateSerialization() const override { return true; }
+
+  // Byte observations (see DurakStateT::ObservationBits).
+  bool ProvidesObservationBits() const override { return true; }
+  std::unique_ptr<State> DeserializeStateBinary(
+      const std::string& str) const override;
+
+ private:
+  mutable int rng_seed_ = 0;
+  bool sampled_deal_ = false;
+};
+
+// -----------------------------------------------------------------------------
+// An Observer
+// -----------------------------------------------------------------------------
+
+template <int NumRanks>
+class DurakObserverT : public Observer {
+ public:
+  explicit DurakObserverT(IIGObservationType iig_obs_type);
+
+  void WriteTensor(const State& observed_state, int player,
+                   Allocator* allocator) const override;
+
+  std::string StringFrom(const State& observed_state,
+                         int player) const override;
+
+ private:
+  IIGObservationType iig_obs_type_;
+};
+
+// Compact alternative to DurakObserverT, selected by passing the observer
+// parameter {"compact", true} to DurakGameT::MakeObserver. Emits the
+// engineered Deck::kCompactTensorSize-float summary (see the layout in
+// DurakDeck) instead of the full card planes — roughly a quarter of the
+// input width — so value networks trained on it can be proportionally
+// smaller at equal strength.
+template <int NumRanks>
+class DurakCompactObserverT : public Observer {
+ public:
+  explicit DurakCompactObserverT(IIGObservationType iig_obs_type);
+
+  void WriteTensor(const State& observed_state, int player,
+                   Allocator* allocator) const override;
+
+  std::string StringFrom(const State& observed_state,
+                         int player) const override;
+
+ private:
+  IIGObservationType iig_obs_type_;
+};
+
+// The default 36-card game keeps the unsuffixed names; everything in this
+// directory and beyond that says DurakState means this instantiation.
+using DurakState = DurakStateT<kNumRanks>;
+using DurakGame = DurakGameT<kNumRanks>;
+using DurakObserver = DurakObserverT<kNumRanks>;
+using DurakCompactObserver = DurakCompactObserverT<kNumRanks>;
+
+// The variant decks ("durak_short" and "durak52" in the game registry).
+using DurakShortState = DurakStateT<6>;
+using DurakShortGame = DurakGameT<6>;
+using Durak52State = DurakStateT<13>;
+using Durak52Game = DurakGameT<13>;
+
+// -----------------------------------------------------------------------------
+// Suit-permutation data augmentation
+// -----------------------------------------------------------------------------
+//
+// Durak positions are equivalent under any relabeling of the three non-trump
+// suits, so one recorded training example stands for up to 3! = 6. These
+// helpers let training pipelines (see the suit_augmentation option of the
+// AlphaZero learner) multiply their data by applying sampled relabelings.
+
+// The rank count behind a supported game's short name ("durak",
+// "durak_short", "durak52", "durak_with_transfers" — all of which share the
+// 13 + 4 * kNumCards observer layout), or 0 for games without this
+// symmetry.
+int SuitAugmentationRanks(const std::string& short_name);
+
+// Applies a uniformly sampled relabeling of the three non-trump suits
+// (identity included) to a training example in place: the four card planes
+// of the observer tensor, and every card-indexed action in the legal-action
+// list and the policy target, which are re-sorted afterwards. The scalar
+// tensor head and the non-card actions (take/finish/transfer) are
+// unaffected; the trump suit keeps its label. Reads the trump suit from the
+// tensor's one-hot head and is a no-op before the trump is revealed.
+void AugmentWithSuitPermutation(int num_ranks, absl::Span<float> observation,
+                                std::vector<Action>* legal_actions,
+                                ActionsAndProbs* policy, std::mt19937* rng);
+
+}  // namespace durak
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_GAMES_DURAK_H_
@@ -0,0 +1,255 @@
+#include "open_spiel/games/durak/durak_belief_tracker.h"
+
+#include <algorithm>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace durak {
+
+DurakBeliefTracker::DurakBeliefTracker(int num_particles, uint64_t seed)
+    : hands_(num_particles, 0), weights_(num_particles, 1.0), rng_(seed) {
+  SPIEL_CHECK_GT(num_particles, 0);
+  scratch_hands_.reserve(num_particles);
+}
+
+void DurakBeliefTracker::ResetFrom(const DurakState& state, Player observer) {
+  SPIEL_CHECK_TRUE(state.phase_ != RoundPhase::kChance);
+  SPIEL_CHECK_GE(observer, 0);
+  SPIEL_CHECK_LT(observer, kNumPlayers);
+  observer_ = observer;
+  const Player opponent = 1 - observer;
+
+  const int deck_size = static_cast<int>(state.deck_.size());
+  const bool trump_in_deck = state.deck_pos_ < deck_size;
+  CardSet hidden_deck = 0;
+  for (int i = state.deck_pos_; i < deck_size; ++i) {
+    hidden_deck |= CardBit(state.deck_[i]);
+  }
+  if (trump_in_deck) hidden_deck &= ~CardBit(state.trump_card_);
+
+  // The face-up trump is public knowledge even once drawn, so if the
+  // opponent holds it, it counts as known rather than unseen.
+  const CardSet opp_hand = state.hands_[opponent];
+  known_opponent_cards_ = 0;
+  if (!trump_in_deck && state.trump_card_ >= 0) {
+    known_opponent_cards_ = opp_hand & CardBit(state.trump_card_);
+  }
+  unseen_pool_ = (opp_hand & ~known_opponent_cards_) | hidden_deck;
+  opponent_hand_size_ = CardSetSize(opp_hand);
+
+  RebuildFromConstraints();
+}
+
+void DurakBeliefTracker::ObserveTransition(const DurakState& before,
+                                           Action action,
+                                           const DurakState& after) {
+  SPIEL_CHECK_TRUE(before.phase_ != RoundPhase::kChance);
+  const Player opponent = 1 - observer_;
+  const int n = num_particles();
+
+  // The opponent's explicit action.
+  if (before.CurrentPlayer() == opponent) {
+    if (action < kNumCards) {
+      // A card play: every particle not holding the card is inconsistent,
+      // the rest give it up. The card is public now, so it leaves the pool.
+      const CardSet bit = CardBit(action);
+      if ((unseen_pool_ & bit) != 0) {
+        for (int i = 0; i < n; ++i) {
+          if ((hands_[i] & bit) == 0) weights_[i] = 0;
+          hands_[i] &= ~bit;
+        }
+        unseen_pool_ &= ~bit;
+      } else {
+        // A publicly known card; every particle holds it.
+        for (CardSet& hand : hands_) hand &= ~bit;
+      }
+      known_opponent_cards_ &= ~bit;
+      --opponent_hand_size_;
+    } else {
+      // A take, either explicit or a finish-defense with uncovered attacks,
+      // moves the public table cards into the opponent's hand.
+      bool takes = (action == kExtraActionTakeCards);
+      if (action == kExtraActionFinishDefense) {
+        for (const auto& [attack_card, defense_card] : before.table_cards_) {
+          if (defense_card < 0) {
+            takes = true;
+            break;
+          }
+        }
+      }
+      if (takes) {
+        CardSet table = 0;
+        for (const auto& [attack_card, defense_card] : before.table_cards_) {
+          table |= CardBit(attack_card);
+          if (defense_card >= 0) table |= CardBit(defense_card);
+        }
+        for (CardSet& hand : hands_) hand |= table;
+        known_opponent_cards_ |= table;
+        opponent_hand_size_ += CardSetSize(table);
+      }
+    }
+  }
+
+  // If the deck ran out during this move, whoever refilled last took the
+  // face-up trump, which is public knowledge.
+  const int trump_card = before.trump_card_;
+  const bool trump_was_in_deck =
+      before.deck_pos_ < static_cast<int>(before.deck_.size());
+  const bool deck_now_empty =
+      after.deck_pos_ >= static_cast<int>(after.deck_.size());
+  if (trump_was_in_deck && deck_now_empty && trump_card >= 0 &&
+      (after.hands_[opponent] & CardBit(trump_card)) != 0) {
+    for (CardSet& hand : hands_) hand |= CardBit(trump_card);
+    known_opponent_cards_ |= CardBit(trump_card);
+    ++opponent_hand_size_;
+  }
+
+  // The observer's own deck draws reveal cards the particles may have
+  // guessed into the opponent's hand. Table pickups by the observer are
+  // already public and never sit in the pool, so they fall out of the mask.
+  const CardSet observer_draws =
+      after.hands_[observer_] & ~before.hands_[observer_] & unseen_pool_;
+  for (CardSet m = observer_draws; m != 0; m &= m - 1) {
+    const CardSet bit = CardBit(__builtin_ctzll(m));
+    for (int i = 0; i < n; ++i) {
+      if ((hands_[i] & bit) != 0) weights_[i] = 0;
+    }
+  }
+  unseen_pool_ &= ~observer_draws;
+
+  // Hidden opponent draws: each particle draws from its own view of the
+  // remaining deck (the pool minus its hypothesized hand). The drawn cards
+  // stay in the pool; only their hand-vs-deck split is hypothesized.
+  const int target_size = CardSetSize(after.hands_[opponent]);
+  const int draws = target_size - opponent_hand_size_;
+  SPIEL_CHECK_GE(draws, 0);
+  if (draws > 0) {
+    for (int i = 0; i < n; ++i) {
+      if (weights_[i] == 0) continue;
+      const CardSet available = unseen_pool_ & ~hands_[i];
+      if (CardSetSize(available) < draws) {
+        weights_[i] = 0;
+        continue;
+      }
+      hands_[i] |= SampleSubset(available, draws);
+    }
+    opponent_hand_size_ = target_size;
+  }
+
+  double total = 0;
+  for (double weight : weights_) total += weight;
+  if (total == 0) {
+    // Every particle contradicted the observations; restart from what is
+    // publicly certain.
+    RebuildFromConstraints();
+    return;
+  }
+  if (EffectiveSampleSize() < 0.5 * n) Resample();
+}
+
+double DurakBeliefTracker::EffectiveSampleSize() const {
+  double sum = 0;
+  double sum_sq = 0;
+  for (double weight : weights_) {
+    sum += weight;
+    sum_sq += weight * weight;
+  }
+  return sum_sq == 0 ? 0 : sum * sum / sum_sq;
+}
+
+void DurakBeliefTracker::Resample() {
+  const int n = num_particles();
+  double total = 0;
+  for (double weight : weights_) total += weight;
+  SPIEL_CHECK_GT(total, 0);
+
+  // Systematic resampling: one uniform offset, then equally spaced targets
+  // through the cumulative weights.
+  const double step = total / n;
+  double target = rng_.UniformDouble() * step;
+  scratch_hands_.clear();
+  int j = 0;
+  double cumulative = weights_[0];
+  for (int i = 0; i < n; ++i) {
+    while (cumulative < target && j < n - 1) {
+      ++j;
+      cumulative += weights_[j];
+    }
+    scratch_hands_.push_back(hands_[j]);
+    target += step;
+  }
+  hands_.swap(scratch_hands_);
+  std::fill(weights_.begin(), weights_.end(), 1.0);
+}
+
+CardSet DurakBeliefTracker::SampleHand() {
+  double total = 0;
+  for (double weight : weights_) total += weight;
+  if (total == 0) {
+    RebuildFromConstraints();
+    total = num_particles();
+  }
+  double target = rng_.UniformDouble() * total;
+  for (int i = 0; i < num_particles(); ++i) {
+    target -= weights_[i];
+    if (target <= 0) return hands_[i];
+  }
+  return hands_[num_particles() - 1];
+}
+
+void DurakBeliefTracker::DeterminizeInto(DurakState* state) {
+  SPIEL_CHECK_TRUE(state != nullptr);
+  SPIEL_CHECK_TRUE(state->phase_ != RoundPhase::kChance);
+  const Player opponent = 1 - observer_;
+  const CardSet hand = SampleHand();
+  SPIEL_CHECK_EQ(CardSetSize(hand), CardSetSize(state->hands_[opponent]));
+  state->hands_[opponent] = hand;
+
+  // Shuffle the remaining unseen cards into the undealt deck slots above the
+  // public trump card, as in DealFromMask.
+  const int deck_size = static_cast<int>(state->deck_.size());
+  const bool trump_in_deck = state->deck_pos_ < deck_size;
+  const int hidden_deck_cards =
+      (deck_size - state->deck_pos_) - (trump_in_deck ? 1 : 0);
+  int cards[kNumCards];
+  int num_cards = 0;
+  for (CardSet m = unseen_pool_ & ~hand; m != 0; m &= m - 1) {
+    cards[num_cards++] = __builtin_ctzll(m);
+  }
+  SPIEL_CHECK_EQ(num_cards, hidden_deck_cards);
+  for (int i = 0; i < num_cards - 1; ++i) {
+    int j = i + static_cast<int>(rng_.UniformInt(num_cards - i));
+    std::swap(cards[i], cards[j]);
+  }
+  for (int i = 0; i < num_cards; ++i) {
+    state->deck_[state->deck_pos_ + i] = cards[i];
+  }
+  state->InvalidateLegalActionsCache();
+}
+
+void DurakBeliefTracker::RebuildFromConstraints() {
+  const int hidden = opponent_hand_size_ - CardSetSize(known_opponent_cards_);
+  SPIEL_CHECK_GE(hidden, 0);
+  SPIEL_CHECK_LE(hidden, CardSetSize(unseen_pool_));
+  for (int i = 0; i < num_particles(); ++i) {
+    hands_[i] = known_opponent_cards_ | SampleSubset(unseen_pool_, hidden);
+    weights_[i] = 1.0;
+  }
+}
+
+CardSet DurakBeliefTracker::SampleSubset(CardSet pool, int count) {
+  CardSet chosen = 0;
+  const int available = CardSetSize(pool);
+  SPIEL_CHECK_LE(count, available);
+  for (int k = 0; k < count; ++k) {
+    int index = static_cast<int>(rng_.UniformInt(available - k));
+    CardSet m = pool & ~chosen;
+    while (index-- > 0) m &= m - 1;
+    chosen |= CardBit(__builtin_ctzll(m));
+  }
+  return chosen;
+}
+
+}  // namespace durak
+}  // namespace open_spiel
@@ -0,0 +1,102 @@
+#ifndef OPEN_SPIEL_GAMES_DURAK_BELIEF_TRACKER_H_
+#define OPEN_SPIEL_GAMES_DURAK_BELIEF_TRACKER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "open_spiel/games/durak/durak.h"
+
+namespace open_spiel {
+namespace durak {
+
+// A particle filter over the opponent's hidden Durak hand.
+//
+// Serving-side belief tracking through the generic
+// UpdateIncrementalStateDistribution() clones every particle State and
+// recomputes infostate strings on each update. For Durak the only hidden
+// information is which of the unseen cards sit in the opponent's hand versus
+// the undealt deck, so a particle is just a CardSet hand mask. The tracker
+// keeps the masks and their weights in flat parallel arrays: observation
+// updates are a single pass over the arrays (a popcount/mask test per
+// particle), hidden opponent draws are sampled per particle, and resampling
+// is done systematically in place. Typical use on the serving path:
+//
+//   DurakBeliefTracker tracker(/*num_particles=*/1024, /*seed=*/17);
+//   tracker.ResetFrom(state, /*observer=*/0);
+//   ...
+//   tracker.ObserveTransition(before, action, after);  // every real move
+//   tracker.DeterminizeInto(search_state);             // before each search
+class DurakBeliefTracker {
+ public:
+  DurakBeliefTracker(int num_particles, uint64_t seed);
+
+  // (Re)initializes the belief from the observer's view of `state`, which
+  // must be past its chance nodes: the unseen pool is the opponent's hand
+  // plus the hidden deck cards (excluding the public trump card), and every
+  // particle draws an opponent hand uniformly from it.
+  void ResetFrom(const DurakState& state, Player observer);
+
+  // Folds one observed transition into the belief. `before` is the state the
+  // action was applied to and `after` its successor; the tracker reads only
+  // public information and the observer's own hand from them. Opponent card
+  // plays zero out the particles that do not hold the card, public pickups
+  // are added to every particle, the observer's own deck draws eliminate the
+  // particles that guessed those cards, and hidden opponent draws are
+  // sampled per particle from its view of the remaining deck. Rebuilds the
+  // filter from the public constraints if every particle became
+  // inconsistent, and resamples in place when the effective sample size
+  // drops below half the particle count.
+  void ObserveTransition(const DurakState& before, Action action,
+                         const DurakState& after);
+
+  // Systematic in-place resampling back to uniform weights.
+  void Resample();
+
+  // Effective sample size (sum w)^2 / (sum w^2) of the current weights.
+  double EffectiveSampleSize() const;
+
+  // Draws an opponent hand from the belief, proportionally to the weights.
+  CardSet SampleHand();
+
+  // Overwrites the hidden information of `state` (which must be the tracked
+  // public state) with one sample from the belief: the opponent's hand is a
+  // weighted particle draw and the remaining unseen cards are shuffled into
+  // the undealt deck slots, as in DurakState::DealFromMask.
+  void DeterminizeInto(DurakState* state);
+
+  int num_particles() const { return static_cast<int>(hands_.size()); }
+  const std::vector<CardSet>& particles() const { return hands_; }
+  const std::vector<double>& weights() const { return weights_; }
+  Player observer() const { return observer_; }
+  // Cards whose location (opponent hand vs. hidden deck) is unknown.
+  CardSet unseen_pool() const { return unseen_pool_; }
+  // Cards publicly known to be in the opponent's hand (table pickups, the
+  // revealed trump once drawn).
+  CardSet known_opponent_cards() const { return known_opponent_cards_; }
+  int opponent_hand_size() const { return opponent_hand_size_; }
+
+ private:
+  // Resets every particle to known cards plus a uniform draw from the pool;
+  // used at initialization and when all weights hit zero.
+  void RebuildFromConstraints();
+
+  // Draws `count` distinct cards uniformly from `pool`.
+  CardSet SampleSubset(CardSet pool, int count);
+
+  Player observer_ = 0;
+  int opponent_hand_size_ = 0;
+  CardSet unseen_pool_ = 0;
+  CardSet known_opponent_cards_ = 0;
+
+  // Flat particle storage; index i is one hypothesis for the opponent hand.
+  std::vector<CardSet> hands_;
+  std::vector<double> weights_;
+  std::vector<CardSet> scratch_hands_;  // reused by Resample()
+
+  FastRng rng_;
+};
+
+}  // namespace durak
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_GAMES_DURAK_BELIEF_TRACKER_H_
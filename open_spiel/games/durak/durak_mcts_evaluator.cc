@@ -0,0 +1,116 @@
+#include "open_spiel/games/durak/durak_mcts_evaluator.h"
+
+#include <cmath>
+#include <utility>
+
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace durak {
+
+DurakRolloutEvaluator::ThreadContext&
+DurakRolloutEvaluator::GetThreadContext() {
+  std::lock_guard<std::mutex> lock(contexts_mutex_);
+  auto it = contexts_.find(std::this_thread::get_id());
+  if (it == contexts_.end()) {
+    it = contexts_
+             .try_emplace(std::this_thread::get_id(), n_rollouts_,
+                          next_seed_++)
+             .first;
+  }
+  return it->second;
+}
+
+std::vector<double> DurakRolloutEvaluator::Evaluate(const State& state) {
+  SPIEL_CHECK_EQ(state.GetGame()->GetType().short_name, "durak");
+
+  const DurakState* durak_state = down_cast<const DurakState*>(&state);
+  if (tablebase_ != nullptr) {
+    absl::optional<double> value0 = tablebase_->Probe(*durak_state);
+    if (value0.has_value()) return {*value0, -*value0};
+  }
+
+  ThreadContext& context = GetThreadContext();
+  std::unique_ptr<State> owned;
+  if (state.IsChanceNode()) {
+    // The engine takes positions past the deal; play the remaining chance
+    // moves out once and evaluate the resulting position.
+    owned = state.Clone();
+    while (owned->IsChanceNode()) {
+      ActionsAndProbs outcomes = owned->ChanceOutcomes();
+      owned->ApplyAction(SampleAction(outcomes, context.rng).first);
+    }
+    durak_state = down_cast<const DurakState*>(owned.get());
+  }
+
+  context.engine.ResetFrom(*durak_state);
+  double value0 = context.engine.RunUniformRandom(0);
+  return {value0, -value0};
+}
+
+ActionsAndProbs DurakRolloutEvaluator::Prior(const State& state) {
+  if (state.IsChanceNode()) {
+    return state.ChanceOutcomes();
+  }
+  std::vector<Action> legal_actions = state.LegalActions();
+  ActionsAndProbs prior;
+  prior.reserve(legal_actions.size());
+  for (const Action& action : legal_actions) {
+    prior.emplace_back(action, 1.0 / legal_actions.size());
+  }
+  return prior;
+}
+
+namespace {
+
+// Heuristic weights, hand-picked rather than tuned: a trump is worth a bit
+// more than an early spare card, and the hand differential overtakes the
+// trump count once the deck runs out. Only the relative magnitudes matter;
+// tanh keeps the value inside the game's [-1, 1] utility range either way.
+constexpr double kTrumpWeight = 0.12;
+constexpr double kHandWeight = 0.04;
+constexpr double kHandEndgameWeight = 0.16;
+
+}  // namespace
+
+std::vector<double> DurakStaticEvaluator::Evaluate(const State& state) {
+  SPIEL_CHECK_EQ(state.GetGame()->GetType().short_name, "durak");
+  if (state.IsTerminal()) return state.Returns();
+
+  const DurakState& durak_state = down_cast<const DurakState&>(state);
+  const int hand0 = CardSetSize(durak_state.hands_[0]);
+  const int hand1 = CardSetSize(durak_state.hands_[1]);
+  int trump_diff = 0;
+  if (durak_state.trump_suit_ >= 0) {
+    const CardSet trumps =
+        card_set::SuitMask(durak_state.trump_suit_, kNumRanks);
+    trump_diff = CardSetSize(durak_state.hands_[0] & trumps) -
+                 CardSetSize(durak_state.hands_[1] & trumps);
+  }
+  const int deck_remaining =
+      static_cast<int>(durak_state.deck_.size()) - durak_state.deck_pos_;
+  const double depletion =
+      1.0 - static_cast<double>(deck_remaining) / kNumCards;
+  const double margin =
+      kTrumpWeight * trump_diff +
+      (kHandWeight + kHandEndgameWeight * depletion) * (hand1 - hand0);
+  const double value0 = std::tanh(margin);
+  return {value0, -value0};
+}
+
+ActionsAndProbs DurakStaticEvaluator::Prior(const State& state) {
+  if (state.IsChanceNode()) {
+    return state.ChanceOutcomes();
+  }
+  std::vector<Action> legal_actions = state.LegalActions();
+  ActionsAndProbs prior;
+  prior.reserve(legal_actions.size());
+  for (const Action& action : legal_actions) {
+    prior.emplace_back(action, 1.0 / legal_actions.size());
+  }
+  return prior;
+}
+
+}  // namespace durak
+}  // namespace open_spiel
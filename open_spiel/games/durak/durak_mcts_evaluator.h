@@ -0,0 +1,98 @@
+#ifndef OPEN_SPIEL_GAMES_DURAK_MCTS_EVALUATOR_H_
+#define OPEN_SPIEL_GAMES_DURAK_MCTS_EVALUATOR_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/node_hash_map.h"
+#include "open_spiel/algorithms/mcts.h"
+#include "open_spiel/games/durak/durak.h"
+#include "open_spiel/games/durak/durak_rollout_engine.h"
+#include "open_spiel/games/durak/durak_tablebase.h"
+
+namespace open_spiel {
+namespace durak {
+
+// An algorithms::Evaluator for MCTSBot on Durak that runs leaf rollouts
+// through DurakRolloutEngine instead of RandomRolloutEvaluator's per-rollout
+// State::Clone loop: all n_rollouts playouts for a leaf share one batch of
+// reusable struct-of-arrays slots and one engine-wide random stream, so
+// evaluating a leaf does no per-rollout allocation and no virtual dispatch
+// per move.
+//
+// Only the base "durak" game is supported (the engine implements its rules);
+// passing states of another game is an error. Like RandomRolloutEvaluator,
+// Evaluate is safe to call from multiple search threads: each thread gets its
+// own engine, seeded seed, seed + 1, ... in order of first use.
+class DurakRolloutEvaluator : public algorithms::Evaluator {
+ public:
+  DurakRolloutEvaluator(int n_rollouts, uint64_t seed)
+      : n_rollouts_(n_rollouts), next_seed_(seed) {}
+
+  // As above, but leaves covered by `tablebase` are scored with their exact
+  // value instead of rollouts (see DurakTablebase::Probe).
+  DurakRolloutEvaluator(int n_rollouts, uint64_t seed,
+                        std::shared_ptr<DurakTablebase> tablebase)
+      : n_rollouts_(n_rollouts),
+        next_seed_(seed),
+        tablebase_(std::move(tablebase)) {}
+
+  // Returns the mean rollout return for each player.
+  std::vector<double> Evaluate(const State& state) override;
+
+  // Returns equal probability for each action (chance nodes keep their own
+  // distribution), matching RandomRolloutEvaluator.
+  ActionsAndProbs Prior(const State& state) override;
+
+ private:
+  // Per-thread rollout state: the engine's slots and the generator used to
+  // play out chance nodes before handing the position to the engine.
+  struct ThreadContext {
+    ThreadContext(int batch_size, uint64_t seed)
+        : engine(batch_size, seed), rng(seed) {}
+    DurakRolloutEngine engine;
+    std::mt19937 rng;
+  };
+
+  // Returns the calling thread's context, creating it on first use. The
+  // node_hash_map keeps references stable across inserts, so the returned
+  // reference stays valid outside the lock.
+  ThreadContext& GetThreadContext();
+
+  int n_rollouts_;
+  uint64_t next_seed_;
+  std::shared_ptr<DurakTablebase> tablebase_;
+  std::mutex contexts_mutex_;
+  absl::node_hash_map<std::thread::id, ThreadContext> contexts_;
+};
+
+// A static evaluation of a Durak position, the kind of leaf scorer
+// algorithms::DepthLimitedRolloutEvaluator expects: a heuristic margin built
+// from the trump-count difference and the hand-size differential, squashed
+// into [-1, 1]. The hand differential is weighted up as the deck empties —
+// while cards are still drawn a big hand refills anyway, but once drawing
+// stops every extra card must be shed past the opponent's defense. Terminal
+// states return their exact returns.
+//
+// Only the base "durak" game is supported. The evaluator is stateless, so
+// one instance can serve any number of search threads.
+class DurakStaticEvaluator : public algorithms::Evaluator {
+ public:
+  DurakStaticEvaluator() = default;
+
+  // Returns {v, -v} with v the heuristic value for player 0.
+  std::vector<double> Evaluate(const State& state) override;
+
+  // Returns equal probability for each action (chance nodes keep their own
+  // distribution), matching RandomRolloutEvaluator.
+  ActionsAndProbs Prior(const State& state) override;
+};
+
+}  // namespace durak
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_GAMES_DURAK_MCTS_EVALUATOR_H_
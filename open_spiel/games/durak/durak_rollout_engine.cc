@@ -0,0 +1,312 @@
+// Copyright 2025
+// C++ Durak implementation for OpenSpiel
+//
+// durak_rollout_engine.cc: batched struct-of-arrays playout engine.
+
+#include "open_spiel/games/durak/durak_rollout_engine.h"
+
+#include <numeric>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace durak {
+namespace {
+
+constexpr uint8_t kPhaseAttack = static_cast<uint8_t>(RoundPhase::kAttack);
+constexpr uint8_t kPhaseDefense = static_cast<uint8_t>(RoundPhase::kDefense);
+constexpr uint8_t kPhaseAdditional =
+    static_cast<uint8_t>(RoundPhase::kAdditional);
+
+}  // namespace
+
+DurakRolloutEngine::DurakRolloutEngine(int batch_size, uint64_t seed)
+    : batch_size_(batch_size),
+      rng_state_(seed == 0 ? 0x9E3779B97F4A7C15ULL : seed),
+      deck_(batch_size),
+      deck_pos_(batch_size, 0),
+      hands0_(batch_size, 0),
+      hands1_(batch_size, 0),
+      discard_(batch_size, 0),
+      trump_suit_(batch_size, -1),
+      phase_(batch_size, kPhaseAttack),
+      attacker_(batch_size, 0),
+      table_(batch_size),
+      table_len_(batch_size, 0),
+      done_(batch_size, 1),
+      returns0_(batch_size, 0.0) {
+  SPIEL_CHECK_GT(batch_size, 0);
+}
+
+uint64_t DurakRolloutEngine::NextRandom() {
+  // xorshift64*: tiny state, good enough for playouts, far cheaper than
+  // std::mt19937.
+  uint64_t x = rng_state_;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  rng_state_ = x;
+  return x * 0x2545F4914F6CDD1DULL;
+}
+
+void DurakRolloutEngine::ResetRandomDeals() {
+  for (int i = 0; i < batch_size_; ++i) {
+    auto& deck = deck_[i];
+    for (int c = 0; c < kNumCards; ++c) deck[c] = c;
+    for (int k = 0; k < kNumCards - 1; ++k) {
+      int j = k + NextRandom() % (kNumCards - k);
+      std::swap(deck[k], deck[j]);
+    }
+    hands0_[i] = 0;
+    hands1_[i] = 0;
+    for (int c = 0; c < kCardsPerPlayer * kNumPlayers; ++c) {
+      CardSet bit = CardBit(deck[c]);
+      if (c % kNumPlayers == 0) {
+        hands0_[i] |= bit;
+      } else {
+        hands1_[i] |= bit;
+      }
+    }
+    deck_pos_[i] = kCardsPerPlayer * kNumPlayers;
+    discard_[i] = 0;
+    trump_suit_[i] = SuitOf(deck[kNumCards - 1]);
+    table_len_[i] = 0;
+    phase_[i] = kPhaseAttack;
+    done_[i] = 0;
+    returns0_[i] = 0.0;
+    DecideFirstAttacker(i);
+  }
+}
+
+void DurakRolloutEngine::ResetFrom(const DurakState& state) {
+  SPIEL_CHECK_TRUE(state.phase_ != RoundPhase::kChance);
+  for (int i = 0; i < batch_size_; ++i) {
+    for (int c = 0; c < kNumCards; ++c) deck_[i][c] = state.deck_[c];
+    deck_pos_[i] = state.deck_pos_;
+    hands0_[i] = state.hands_[0];
+    hands1_[i] = state.hands_[1];
+    discard_[i] = state.discard_;
+    trump_suit_[i] = state.trump_suit_;
+    phase_[i] = static_cast<uint8_t>(state.phase_);
+    attacker_[i] = state.attacker_;
+    table_len_[i] = state.table_cards_.size();
+    for (int k = 0; k < table_len_[i]; ++k) {
+      table_[i][2 * k] = state.table_cards_[k].first;
+      table_[i][2 * k + 1] = state.table_cards_[k].second;
+    }
+    done_[i] = state.game_over_ ? 1 : 0;
+    returns0_[i] = 0.0;
+    if (done_[i]) RecordReturns(i);
+  }
+}
+
+double DurakRolloutEngine::RunUniformRandom(Player player) {
+  // Round-robin passes over the batch: every unfinished slot advances one
+  // move per pass, keeping the per-slot arrays hot in cache.
+  int active = 0;
+  for (int i = 0; i < batch_size_; ++i) active += done_[i] ? 0 : 1;
+  while (active > 0) {
+    for (int i = 0; i < batch_size_; ++i) {
+      if (!done_[i] && !StepRandom(i)) --active;
+    }
+  }
+  double total = std::accumulate(returns0_.begin(), returns0_.end(), 0.0);
+  double mean0 = total / batch_size_;
+  return player == 0 ? mean0 : -mean0;
+}
+
+bool DurakRolloutEngine::StepRandom(int i) {
+  CardSet& att_hand = attacker_[i] == 0 ? hands0_[i] : hands1_[i];
+  CardSet& def_hand = attacker_[i] == 0 ? hands1_[i] : hands0_[i];
+  auto& table = table_[i];
+  int table_len = table_len_[i];
+
+  // Generate legal moves into a stack buffer (mirrors
+  // DurakState::LegalActions).
+  Action moves[kNumCards + 3];
+  int num_moves = 0;
+  if (phase_[i] == kPhaseAttack || phase_[i] == kPhaseAdditional) {
+    if (table_len == 0) {
+      for (CardSet m = att_hand; m != 0; m &= m - 1) {
+        moves[num_moves++] = __builtin_ctzll(m);
+      }
+    } else if (table_len < kCardsPerPlayer && def_hand != 0) {
+      uint32_t ranks_on_table = 0;
+      for (int k = 0; k < table_len; ++k) {
+        ranks_on_table |= uint32_t{1} << RankOf(table[2 * k]);
+        if (table[2 * k + 1] >= 0) {
+          ranks_on_table |= uint32_t{1} << RankOf(table[2 * k + 1]);
+        }
+      }
+      for (CardSet m = att_hand; m != 0; m &= m - 1) {
+        int c = __builtin_ctzll(m);
+        if ((ranks_on_table >> RankOf(c)) & 1) moves[num_moves++] = c;
+      }
+    }
+    if (table_len > 0) moves[num_moves++] = kExtraActionFinishAttack;
+  } else {  // defense
+    int earliest_uncovered = -1;
+    for (int k = 0; k < table_len; ++k) {
+      if (table[2 * k + 1] < 0) {
+        earliest_uncovered = k;
+        break;
+      }
+    }
+    if (earliest_uncovered < 0) {
+      moves[num_moves++] = kExtraActionFinishDefense;
+    } else {
+      moves[num_moves++] = kExtraActionTakeCards;
+      int att_card = table[2 * earliest_uncovered];
+      for (CardSet m = def_hand & kBeatsTable[trump_suit_[i]][att_card];
+           m != 0; m &= m - 1) {
+        moves[num_moves++] = __builtin_ctzll(m);
+      }
+    }
+  }
+
+  if (num_moves == 0) {
+    // Should not happen with legal rule flow; terminate the slot defensively.
+    done_[i] = 1;
+    RecordReturns(i);
+    return false;
+  }
+
+  Action move = moves[NextRandom() % num_moves];
+
+  // Apply the move (mirrors DurakState::DoApplyAction).
+  if (move == kExtraActionTakeCards) {
+    DefenderTakesCards(i);
+  } else if (move == kExtraActionFinishAttack) {
+    phase_[i] = kPhaseDefense;
+  } else if (move == kExtraActionFinishDefense) {
+    DefenderFinishesDefense(i);
+  } else if (phase_[i] == kPhaseAttack || phase_[i] == kPhaseAdditional) {
+    att_hand &= ~CardBit(move);
+    table[2 * table_len] = move;
+    table[2 * table_len + 1] = -1;
+    ++table_len_[i];
+    phase_[i] = kPhaseAttack;
+  } else {
+    for (int k = 0; k < table_len; ++k) {
+      if (table[2 * k + 1] < 0) {
+        table[2 * k + 1] = move;
+        break;
+      }
+    }
+    def_hand &= ~CardBit(move);
+    bool all_covered = true;
+    for (int k = 0; k < table_len; ++k) {
+      if (table[2 * k + 1] < 0) {
+        all_covered = false;
+        break;
+      }
+    }
+    if (all_covered) phase_[i] = kPhaseAdditional;
+  }
+
+  CheckGameOver(i);
+  if (done_[i]) {
+    RecordReturns(i);
+    return false;
+  }
+  return true;
+}
+
+void DurakRolloutEngine::DecideFirstAttacker(int i) {
+  int lowest_trump_rank = -1;
+  int who = 0;
+  const CardSet hands[2] = {hands0_[i], hands1_[i]};
+  for (int p = 0; p < kNumPlayers; ++p) {
+    for (CardSet m = hands[p]; m != 0; m &= m - 1) {
+      int c = __builtin_ctzll(m);
+      if (SuitOf(c) == trump_suit_[i] &&
+          (lowest_trump_rank < 0 || RankOf(c) < lowest_trump_rank)) {
+        lowest_trump_rank = RankOf(c);
+        who = p;
+      }
+    }
+  }
+  attacker_[i] = who;
+}
+
+void DurakRolloutEngine::DefenderTakesCards(int i) {
+  CardSet& def_hand = attacker_[i] == 0 ? hands1_[i] : hands0_[i];
+  for (int k = 0; k < table_len_[i]; ++k) {
+    def_hand |= CardBit(table_[i][2 * k]);
+    if (table_[i][2 * k + 1] >= 0) def_hand |= CardBit(table_[i][2 * k + 1]);
+  }
+  table_len_[i] = 0;
+  phase_[i] = kPhaseAttack;
+  RefillHands(i);
+}
+
+void DurakRolloutEngine::DefenderFinishesDefense(int i) {
+  bool uncovered = false;
+  for (int k = 0; k < table_len_[i]; ++k) {
+    if (table_[i][2 * k + 1] < 0) {
+      uncovered = true;
+      break;
+    }
+  }
+  if (uncovered) {
+    DefenderTakesCards(i);
+    return;
+  }
+  for (int k = 0; k < table_len_[i]; ++k) {
+    discard_[i] |= CardBit(table_[i][2 * k]);
+    if (table_[i][2 * k + 1] >= 0) discard_[i] |= CardBit(table_[i][2 * k + 1]);
+  }
+  table_len_[i] = 0;
+  attacker_[i] = 1 - attacker_[i];
+  RefillHands(i);
+  phase_[i] = kPhaseAttack;
+}
+
+void DurakRolloutEngine::RefillHands(int i) {
+  CardSet* order[2] = {attacker_[i] == 0 ? &hands0_[i] : &hands1_[i],
+                       attacker_[i] == 0 ? &hands1_[i] : &hands0_[i]};
+  while (deck_pos_[i] < kNumCards) {
+    bool all_full = true;
+    for (CardSet* hand : order) {
+      if (CardSetSize(*hand) < kCardsPerPlayer && deck_pos_[i] < kNumCards) {
+        *hand |= CardBit(deck_[i][deck_pos_[i]]);
+        ++deck_pos_[i];
+      }
+    }
+    for (CardSet* hand : order) {
+      if (CardSetSize(*hand) < kCardsPerPlayer) all_full = false;
+    }
+    if (all_full) break;
+  }
+}
+
+void DurakRolloutEngine::CheckGameOver(int i) {
+  const bool p0_empty = (hands0_[i] == 0);
+  const bool p1_empty = (hands1_[i] == 0);
+  const bool deck_empty = (deck_pos_[i] >= kNumCards);
+  if ((p0_empty || p1_empty) && deck_empty) {
+    done_[i] = 1;
+    return;
+  }
+  if (p0_empty && p1_empty) RefillHands(i);
+}
+
+void DurakRolloutEngine::RecordReturns(int i) {
+  const bool p0_has = (hands0_[i] != 0);
+  const bool p1_has = (hands1_[i] != 0);
+  if (p0_has == p1_has) {
+    // Both hold cards (truncated slot), or neither: neither-with-empty-deck
+    // means the last attacker wins, matching DurakState::Returns.
+    if (!p0_has && deck_pos_[i] >= kNumCards) {
+      returns0_[i] = attacker_[i] == 0 ? 1.0 : -1.0;
+    } else {
+      returns0_[i] = 0.0;
+    }
+    return;
+  }
+  // Exactly one player still holds cards: that player is the durak.
+  returns0_[i] = p0_has ? -1.0 : 1.0;
+}
+
+}  // namespace durak
+}  // namespace open_spiel
@@ -0,0 +1,385 @@
+#include "open_spiel/games/durak/durak_tablebase.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace durak {
+namespace {
+
+constexpr char kMagic[8] = {'D', 'U', 'R', 'A', 'K', 'T', 'B', '\0'};
+constexpr uint32_t kVersion = 1;
+
+// Fixed-size file head; the packed 2-bit values follow. Host-endian, like
+// the binary state snapshots.
+struct TablebaseHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t max_cards_per_side;
+  uint64_t num_entries;
+};
+
+uint64_t Choose(int n, int k) {
+  if (k < 0 || k > n) return 0;
+  static const auto table = [] {
+    std::array<std::array<uint64_t, kNumCards + 1>, kNumCards + 1> t = {};
+    for (int i = 0; i <= kNumCards; ++i) {
+      t[i][0] = 1;
+      for (int j = 1; j <= i; ++j) {
+        t[i][j] = t[i - 1][j - 1] + (j <= i - 1 ? t[i - 1][j] : 0);
+      }
+    }
+    return t;
+  }();
+  return table[n][k];
+}
+
+// Colexicographic rank of `cards` among all card sets of the same size.
+uint64_t ColexRank(CardSet cards) {
+  uint64_t rank = 0;
+  int i = 0;
+  for (CardSet m = cards; m != 0; m &= m - 1) {
+    rank += Choose(__builtin_ctzll(m), ++i);
+  }
+  return rank;
+}
+
+// Colexicographic rank of `cards` among the same-size subsets of the
+// complement of `excluded` (the cards are renumbered consecutively,
+// skipping the excluded ones).
+uint64_t RankInComplement(CardSet cards, CardSet excluded) {
+  uint64_t rank = 0;
+  int i = 0;
+  for (CardSet m = cards; m != 0; m &= m - 1) {
+    const int card = __builtin_ctzll(m);
+    const int pos = CardSetSize((CardBit(card) - 1) & ~excluded);
+    rank += Choose(pos, ++i);
+  }
+  return rank;
+}
+
+// Entries per (attacker size, defender size) block, for one trump suit.
+uint64_t BlockSize(int a, int b) {
+  return Choose(kNumCards, a) * Choose(kNumCards - a, b);
+}
+
+uint64_t NumEntries(int max_cards_per_side) {
+  uint64_t total = 0;
+  for (int a = 1; a <= max_cards_per_side; ++a) {
+    for (int b = 1; b <= max_cards_per_side; ++b) {
+      total += BlockSize(a, b);
+    }
+  }
+  return 4 * total;  // One copy per trump suit.
+}
+
+uint64_t EntryIndex(int trump_suit, CardSet attacker_hand,
+                    CardSet defender_hand, int max_cards_per_side) {
+  const int a = CardSetSize(attacker_hand);
+  const int b = CardSetSize(defender_hand);
+  uint64_t offset = trump_suit * (NumEntries(max_cards_per_side) / 4);
+  for (int i = 1; i <= max_cards_per_side; ++i) {
+    for (int j = 1; j <= max_cards_per_side; ++j) {
+      if (i == a && j == b) {
+        return offset + ColexRank(attacker_hand) * Choose(kNumCards - a, b) +
+               RankInComplement(defender_hand, attacker_hand);
+      }
+      offset += BlockSize(i, j);
+    }
+  }
+  SpielFatalError("DurakTablebase: hand sizes outside the table");
+}
+
+void EncodeValue(std::vector<uint8_t>* packed, uint64_t index, int8_t value) {
+  (*packed)[index >> 2] |= static_cast<uint8_t>(value + 1)
+                           << ((index & 3) * 2);
+}
+
+int8_t DecodeValue(const uint8_t* packed, uint64_t index) {
+  return static_cast<int8_t>((packed[index >> 2] >> ((index & 3) * 2)) & 3) -
+         1;
+}
+
+// Calls fn(mask) for every size-k subset of the cards in `pool`.
+template <class Fn>
+void ForEachSubsetOfSize(CardSet pool, int k, Fn fn) {
+  std::vector<int> cards;
+  for (CardSet m = pool; m != 0; m &= m - 1) {
+    cards.push_back(__builtin_ctzll(m));
+  }
+  const int n = static_cast<int>(cards.size());
+  if (k > n) return;
+  std::vector<int> idx(k);
+  std::iota(idx.begin(), idx.end(), 0);
+  while (true) {
+    CardSet subset = 0;
+    for (int i : idx) subset |= CardBit(cards[i]);
+    fn(subset);
+    int i = k - 1;
+    while (i >= 0 && idx[i] == n - k + i) --i;
+    if (i < 0) break;
+    ++idx[i];
+    for (int j = i + 1; j < k; ++j) idx[j] = idx[j - 1] + 1;
+  }
+}
+
+}  // namespace
+
+// Transient build state: the table under construction plus a memo for the
+// positions the table does not store (mid-trick, oversized hands).
+struct DurakTablebase::BuildContext {
+  int max_cards_per_side;
+  std::vector<uint8_t>* packed;
+  std::vector<bool>* solved;
+  absl::flat_hash_map<std::string, int8_t> memo;
+};
+
+namespace {
+
+// Compact memo key: the full position minus the (empty) deck and the move
+// counter, so transpositions reached at different depths share an entry.
+std::string PositionKey(const CardSet* hands, RoundPhase phase,
+                        Player attacker,
+                        const std::vector<std::pair<int, int>>& table_cards) {
+  std::string key;
+  key.reserve(2 * sizeof(CardSet) + 2 + 2 * table_cards.size());
+  key.append(reinterpret_cast<const char*>(hands), 2 * sizeof(CardSet));
+  key.push_back(static_cast<char>(phase));
+  key.push_back(static_cast<char>(attacker));
+  for (const auto& [attack_card, defense_card] : table_cards) {
+    key.push_back(static_cast<char>(attack_card));
+    key.push_back(static_cast<char>(defense_card));
+  }
+  return key;
+}
+
+}  // namespace
+
+void DurakTablebase::SetupEndgame(DurakState* state, int trump_suit,
+                                  CardSet attacker_hand,
+                                  CardSet defender_hand) {
+  SPIEL_CHECK_GE(trump_suit, 0);
+  SPIEL_CHECK_LT(trump_suit, 4);
+  SPIEL_CHECK_EQ(attacker_hand & defender_hand, CardSet{0});
+  const CardSet all_cards = (CardSet{1} << kNumCards) - 1;
+  state->deck_.clear();
+  state->deck_pos_ = 0;
+  state->cards_dealt_ = kCardsPerPlayer * kNumPlayers;
+  state->hands_[0] = attacker_hand;
+  state->hands_[1] = defender_hand;
+  state->table_cards_.clear();
+  state->discard_ = all_cards & ~(attacker_hand | defender_hand);
+  state->trump_suit_ = trump_suit;
+  // The concrete trump card only matters for observations; use the lowest
+  // card of the suit.
+  state->trump_card_ = trump_suit * 9;
+  state->attacker_ = 0;
+  state->defender_ = 1;
+  state->phase_ = RoundPhase::kAttack;
+  state->round_starter_ = 0;
+  state->game_over_ = false;
+  state->history_.clear();
+  state->move_number_ = 0;
+  state->tensor_cache_valid_ = {false, false};
+  state->InvalidateLegalActionsCache();
+}
+
+std::unique_ptr<State> DurakTablebase::MakeEndgameState(
+    const std::shared_ptr<const Game>& game, int trump_suit,
+    CardSet attacker_hand, CardSet defender_hand) {
+  SPIEL_CHECK_EQ(game->GetType().short_name, "durak");
+  std::unique_ptr<State> state = game->NewInitialState();
+  SetupEndgame(down_cast<DurakState*>(state.get()), trump_suit, attacker_hand,
+               defender_hand);
+  return state;
+}
+
+int8_t DurakTablebase::SolvePosition(const DurakState& state,
+                                     BuildContext* ctx) {
+  if (state.game_over_) {
+    const double value = state.Returns()[0];
+    return value > 0 ? 1 : (value < 0 ? -1 : 0);
+  }
+
+  // Trick-start positions inside the table were solved earlier (the build
+  // order follows the dependency structure); the one being solved right now
+  // is still unmarked and falls through to expansion.
+  if (state.table_cards_.empty() && state.phase_ == RoundPhase::kAttack) {
+    const CardSet attacker_hand = state.hands_[state.attacker_];
+    const CardSet defender_hand = state.hands_[state.defender_];
+    const int a = CardSetSize(attacker_hand);
+    const int b = CardSetSize(defender_hand);
+    if (a >= 1 && a <= ctx->max_cards_per_side && b >= 1 &&
+        b <= ctx->max_cards_per_side) {
+      const uint64_t index = EntryIndex(state.trump_suit_, attacker_hand,
+                                        defender_hand,
+                                        ctx->max_cards_per_side);
+      if ((*ctx->solved)[index]) {
+        const int8_t attacker_value = DecodeValue(ctx->packed->data(), index);
+        return state.attacker_ == 0 ? attacker_value : -attacker_value;
+      }
+    }
+  }
+
+  std::string key = PositionKey(state.hands_.data(), state.phase_,
+                                state.attacker_, state.table_cards_);
+  auto it = ctx->memo.find(key);
+  if (it != ctx->memo.end()) return it->second;
+
+  const Player player = state.CurrentPlayer();
+  int8_t best = player == 0 ? -1 : 1;
+  for (Action action : state.LegalActions()) {
+    std::unique_ptr<State> child = state.Clone();
+    child->ApplyAction(action);
+    const int8_t value =
+        SolvePosition(*down_cast<const DurakState*>(child.get()), ctx);
+    if (player == 0) {
+      best = std::max(best, value);
+      if (best == 1) break;
+    } else {
+      best = std::min(best, value);
+      if (best == -1) break;
+    }
+  }
+  ctx->memo.emplace(std::move(key), best);
+  return best;
+}
+
+void DurakTablebase::Build(const std::string& path, int max_cards_per_side) {
+  SPIEL_CHECK_GE(max_cards_per_side, 1);
+  SPIEL_CHECK_LE(max_cards_per_side, kCardsPerPlayer);
+  std::shared_ptr<const Game> game = LoadGame("durak");
+
+  const uint64_t num_entries = NumEntries(max_cards_per_side);
+  std::vector<uint8_t> packed((num_entries + 3) / 4, 0);
+  std::vector<bool> solved(num_entries, false);
+  BuildContext ctx{max_cards_per_side, &packed, &solved, {}};
+
+  const CardSet all_cards = (CardSet{1} << kNumCards) - 1;
+  std::unique_ptr<State> scratch = game->NewInitialState();
+  DurakState* state = down_cast<DurakState*>(scratch.get());
+
+  for (int trump_suit = 0; trump_suit < 4; ++trump_suit) {
+    // Increasing total, then increasing attacker size: a trick either
+    // discards cards (smaller total) or moves cards from the attacker to
+    // the defender (same total, smaller attacker hand), so every stored
+    // successor is solved before it is looked up.
+    for (int total = 2; total <= 2 * max_cards_per_side; ++total) {
+      const int a_begin = std::max(1, total - max_cards_per_side);
+      const int a_end = std::min(max_cards_per_side, total - 1);
+      for (int a = a_begin; a <= a_end; ++a) {
+        const int b = total - a;
+        ctx.memo.clear();
+        ForEachSubsetOfSize(all_cards, a, [&](CardSet attacker_hand) {
+          ForEachSubsetOfSize(
+              all_cards & ~attacker_hand, b, [&](CardSet defender_hand) {
+                SetupEndgame(state, trump_suit, attacker_hand, defender_hand);
+                const int8_t value = SolvePosition(*state, &ctx);
+                const uint64_t index = EntryIndex(
+                    trump_suit, attacker_hand, defender_hand,
+                    max_cards_per_side);
+                EncodeValue(&packed, index, value);
+                solved[index] = true;
+              });
+        });
+      }
+    }
+  }
+
+  TablebaseHeader header = {};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.max_cards_per_side = max_cards_per_side;
+  header.num_entries = num_entries;
+
+  file::File out(path, "wb");
+  out.Write(absl::string_view(reinterpret_cast<const char*>(&header),
+                              sizeof(header)));
+  out.Write(absl::string_view(reinterpret_cast<const char*>(packed.data()),
+                              packed.size()));
+}
+
+std::unique_ptr<DurakTablebase> DurakTablebase::Open(const std::string& path) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    SpielFatalError(absl::StrCat("DurakTablebase: cannot open ", path));
+  }
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    SpielFatalError(absl::StrCat("DurakTablebase: cannot stat ", path));
+  }
+  const uint64_t size = static_cast<uint64_t>(file_stat.st_size);
+  SPIEL_CHECK_GE(size, sizeof(TablebaseHeader));
+
+  void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (mapping == MAP_FAILED) {
+    ::close(fd);
+    SpielFatalError(absl::StrCat("DurakTablebase: cannot mmap ", path));
+  }
+
+  TablebaseHeader header;
+  std::memcpy(&header, mapping, sizeof(header));
+  SPIEL_CHECK_EQ(std::memcmp(header.magic, kMagic, sizeof(kMagic)), 0);
+  SPIEL_CHECK_EQ(header.version, kVersion);
+  SPIEL_CHECK_EQ(header.num_entries,
+                 NumEntries(header.max_cards_per_side));
+  SPIEL_CHECK_EQ(size,
+                 sizeof(header) + (header.num_entries + 3) / 4);
+
+  return std::unique_ptr<DurakTablebase>(new DurakTablebase(
+      fd, mapping, size, header.max_cards_per_side));
+}
+
+DurakTablebase::DurakTablebase(int fd, void* mapping, uint64_t mapped_size,
+                               int max_cards_per_side)
+    : max_cards_per_side_(max_cards_per_side),
+      fd_(fd),
+      mapping_(mapping),
+      mapped_size_(mapped_size),
+      values_(reinterpret_cast<const uint8_t*>(mapping) +
+              sizeof(TablebaseHeader)) {}
+
+DurakTablebase::~DurakTablebase() {
+  ::munmap(mapping_, mapped_size_);
+  ::close(fd_);
+}
+
+absl::optional<double> DurakTablebase::Probe(const DurakState& state) const {
+  if (state.game_over_ || state.phase_ != RoundPhase::kAttack ||
+      !state.table_cards_.empty() || state.trump_suit_ < 0 ||
+      state.deck_pos_ < static_cast<int>(state.deck_.size())) {
+    return absl::nullopt;
+  }
+  const CardSet attacker_hand = state.hands_[state.attacker_];
+  const CardSet defender_hand = state.hands_[state.defender_];
+  const int a = CardSetSize(attacker_hand);
+  const int b = CardSetSize(defender_hand);
+  if (a < 1 || a > max_cards_per_side_ || b < 1 || b > max_cards_per_side_) {
+    return absl::nullopt;
+  }
+  const int8_t attacker_value = DecodeValue(
+      values_, EntryIndex(state.trump_suit_, attacker_hand, defender_hand,
+                          max_cards_per_side_));
+  return static_cast<double>(state.attacker_ == 0 ? attacker_value
+                                                  : -attacker_value);
+}
+
+}  // namespace durak
+}  // namespace open_spiel
@@ -0,0 +1,88 @@
+#ifndef OPEN_SPIEL_GAMES_DURAK_TABLEBASE_H_
+#define OPEN_SPIEL_GAMES_DURAK_TABLEBASE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/games/durak/durak.h"
+
+namespace open_spiel {
+namespace durak {
+
+// An exact endgame tablebase for Durak.
+//
+// Once the deck is empty, Durak is a perfect-information game, and positions
+// with few cards per hand are small enough to solve exhaustively. The table
+// covers every deck-empty position at the start of a trick (empty table,
+// attack phase) with between 1 and max_cards_per_side cards in each hand,
+// for all four trump suits. A position is keyed by the packed hand masks and
+// the trump suit; its value is the game-theoretic outcome for the attacker
+// (+1 win / 0 draw / -1 loss), stored as 2 bits per entry.
+//
+// Build() writes the table to a file; Open() maps that file read-only into
+// memory, so probes are two loads into page cache shared across processes
+// and a served tree search can use a multi-gigabyte table without owning it.
+// Evaluators fall back to rollouts whenever Probe() returns nullopt
+// (mid-trick positions, deck not empty, hands larger than the table).
+class DurakTablebase {
+ public:
+  // Solves all covered positions and writes the table to `path`. Positions
+  // are processed in order of increasing total card count (then increasing
+  // attacker hand size), which matches the dependency structure of the
+  // game: a trick either discards cards or moves cards from the attacker to
+  // the defender, so every successor trick-start is solved before it is
+  // needed. Sub-positions outside the table (e.g. a defender holding more
+  // than max_cards_per_side after a pickup) are solved transiently through
+  // a memo keyed by the packed position.
+  static void Build(const std::string& path, int max_cards_per_side);
+
+  // Maps an existing tablebase file read-only into memory. Dies if the file
+  // cannot be opened or is not a valid tablebase.
+  static std::unique_ptr<DurakTablebase> Open(const std::string& path);
+
+  ~DurakTablebase();
+  DurakTablebase(const DurakTablebase&) = delete;
+  DurakTablebase& operator=(const DurakTablebase&) = delete;
+
+  // Exact value of `state` for player 0 (+1 / 0 / -1), or nullopt when the
+  // position is outside the table.
+  absl::optional<double> Probe(const DurakState& state) const;
+
+  int max_cards_per_side() const { return max_cards_per_side_; }
+
+  // Constructs a deck-empty trick-start position with the given hands
+  // (attacker is player 0). All cards outside the two hands are in the
+  // discard pile. Exposed for analysis tools and tests.
+  static std::unique_ptr<State> MakeEndgameState(
+      const std::shared_ptr<const Game>& game, int trump_suit,
+      CardSet attacker_hand, CardSet defender_hand);
+
+ private:
+  struct BuildContext;
+
+  DurakTablebase(int fd, void* mapping, uint64_t mapped_size,
+                 int max_cards_per_side);
+
+  // Overwrites `state` with the given endgame position.
+  static void SetupEndgame(DurakState* state, int trump_suit,
+                           CardSet attacker_hand, CardSet defender_hand);
+
+  // Memoized depth-first solve of an arbitrary deck-empty position,
+  // consulting the already-built part of the table at trick starts.
+  // Returns the value for player 0.
+  static int8_t SolvePosition(const DurakState& state, BuildContext* ctx);
+
+  int max_cards_per_side_;
+  int fd_;
+  void* mapping_;
+  uint64_t mapped_size_;
+  const uint8_t* values_;  // Packed 2-bit entries, just past the header.
+};
+
+}  // namespace durak
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_GAMES_DURAK_TABLEBASE_H_
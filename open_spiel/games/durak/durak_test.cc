@@ -1,121 +1,889 @@
-/*
- * durak_test.cc
- *
- * C++ tests for Durak in OpenSpiel.
- */
-
-#include "open_spiel/games/durak/durak.h"
-
-// Standard OpenSpiel includes:
-#include "open_spiel/algorithms/get_all_states.h"
-#include "open_spiel/policy.h"
-#include "open_spiel/spiel.h"
-#include "open_spiel/spiel_utils.h"
-#include "open_spiel/tests/basic_tests.h"  // For RandomSimTest, etc.
-
-namespace open_spiel {
-namespace durak {
-namespace {
-
-// A helper to test that serialization & deserialization yield an equivalent
-// game and state. This is what 'TestSerializeDeserialize' used to do in some
-// branches of OpenSpiel.
-void MySerializeDeserializeTest(const Game& game, const State& state) {
-  // Serialize the game & current state
-  std::string serialized = SerializeGameAndState(game, state);
-
-  // Deserialize to a new (game, state) pair
-  auto game_and_state = DeserializeGameAndState(serialized);
-
-  // Compare the string representations to ensure equality
-  SPIEL_CHECK_EQ(game.ToString(), game_and_state.first->ToString());
-  SPIEL_CHECK_EQ(state.ToString(), game_and_state.second->ToString());
-}
-
-// ----------------------------------------------------------------------------
-// Basic tests
-// ----------------------------------------------------------------------------
-
-void BasicDurakTests() {
-  // 1) LoadGameTest checks that we can load and clone the game, etc.
-  testing::LoadGameTest("durak");
-
-  // 2) Check chance outcomes are valid for the initial dealing & trump reveal.
-  testing::ChanceOutcomesTest(*LoadGame("durak"));
-
-  // 3) RandomSimTest does random rollouts of entire games to ensure we never
-  //    crash or produce invalid states.
-  testing::RandomSimTest(*LoadGame("durak"), /*num_sims=*/50);
-
-  // For demonstration, we create a custom observer with some IIG settings:
-  auto game = LoadGame("durak");
-
-  IIGObservationType iig_obs_type;
-  iig_obs_type.public_info = true;
-  iig_obs_type.perfect_recall = false;
-  iig_obs_type.private_info = PrivateInfoType::kSinglePlayer;
-
-  auto observer = game->MakeObserver(iig_obs_type, /*params=*/{});
-  testing::RandomSimTestCustomObserver(*game, observer);
-}
-
-// ----------------------------------------------------------------------------
-// Test serialization / deserialization
-// ----------------------------------------------------------------------------
-
-void SerializeDeserializeTest() {
-  std::shared_ptr<const Game> game = LoadGame("durak");
-  std::unique_ptr<State> state = game->NewInitialState();
-
-  // Let's advance the state through any forced chance actions (dealing)
-  while (!state->IsTerminal() && state->CurrentPlayer() == kChancePlayerId) {
-    std::vector<std::pair<Action, double>> outcomes = state->ChanceOutcomes();
-    SPIEL_CHECK_EQ(outcomes.size(), 1);  // we expect exactly 1 forced outcome
-    state->ApplyAction(outcomes[0].first);
-  }
-
-  // Then let the current player (if not terminal) take one action.
-  if (!state->IsTerminal()) {
-    std::vector<Action> legal_actions = state->LegalActions();
-    if (!legal_actions.empty()) {
-      state->ApplyAction(legal_actions[0]);  // pick the first, arbitrary
-    }
-  }
-
-  // Now we do our custom check for serialization & deserialization:
-  MySerializeDeserializeTest(*game, *state);
-}
-
-// ----------------------------------------------------------------------------
-// (Optional) CountStatesTest: enumerates all reachable states up to infinite depth.
-// ----------------------------------------------------------------------------
-
-void CountStatesTest() {
-  std::shared_ptr<const Game> game = LoadGame("durak");
-
-  // Example to get all states without a depth limit:
-  auto states = algorithms::GetAllStates(
-      *game,
-      /*depth_limit=*/-1,
-      /*include_terminals=*/true,
-      /*include_chance_states=*/true);
-
-  // For Durak, the state space can be large. We just show it completes:
-  std::cout << "Number of reachable states: " << states.size() << std::endl;
-}
-
-// ----------------------------------------------------------------------------
-// Main test driver
-// ----------------------------------------------------------------------------
-
-}  // namespace
-}  // namespace durak
-}  // namespace open_spiel
-
-int main(int argc, char** argv) {
-  open_spiel::durak::BasicDurakTests();
-  open_spiel::durak::SerializeDeserializeTest();
-  // Runs for too long, commented out for now
-  // open_spiel::durak::CountStatesTest();
-  return 0;
-}
+/*
+ * durak_test.cc
+ *
+ * C++ tests for Durak in OpenSpiel.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+
+#include "open_spiel/games/durak/durak.h"
+#include "open_spiel/games/durak/durak_belief_tracker.h"
+#include "open_spiel/games/durak/durak_mcts_evaluator.h"
+#include "open_spiel/games/durak/durak_tablebase.h"
+
+// Standard OpenSpiel includes:
+#include "open_spiel/algorithms/get_all_states.h"
+#include "open_spiel/algorithms/mcts.h"
+#include "open_spiel/policy.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/tests/basic_tests.h"  // For RandomSimTest, etc.
+#include "open_spiel/utils/file.h"
+
+namespace open_spiel {
+namespace durak {
+namespace {
+
+// A helper to test that serialization & deserialization yield an equivalent
+// game and state. This is what 'TestSerializeDeserialize' used to do in some
+// branches of OpenSpiel.
+void MySerializeDeserializeTest(const Game& game, const State& state) {
+  // Serialize the game & current state
+  std::string serialized = SerializeGameAndState(game, state);
+
+  // Deserialize to a new (game, state) pair
+  auto game_and_state = DeserializeGameAndState(serialized);
+
+  // Compare the string representations to ensure equality
+  SPIEL_CHECK_EQ(game.ToString(), game_and_state.first->ToString());
+  SPIEL_CHECK_EQ(state.ToString(), game_and_state.second->ToString());
+}
+
+// ----------------------------------------------------------------------------
+// Basic tests
+// ----------------------------------------------------------------------------
+
+void BasicDurakTests() {
+  // 1) LoadGameTest checks that we can load and clone the game, etc.
+  testing::LoadGameTest("durak");
+
+  // 2) Check chance outcomes are valid for the initial dealing & trump reveal.
+  testing::ChanceOutcomesTest(*LoadGame("durak"));
+
+  // 3) RandomSimTest does random rollouts of entire games to ensure we never
+  //    crash or produce invalid states.
+  testing::RandomSimTest(*LoadGame("durak"), /*num_sims=*/50);
+
+  // For demonstration, we create a custom observer with some IIG settings:
+  auto game = LoadGame("durak");
+
+  IIGObservationType iig_obs_type;
+  iig_obs_type.public_info = true;
+  iig_obs_type.perfect_recall = false;
+  iig_obs_type.private_info = PrivateInfoType::kSinglePlayer;
+
+  auto observer = game->MakeObserver(iig_obs_type, /*params=*/{});
+  testing::RandomSimTestCustomObserver(*game, observer);
+}
+
+// ----------------------------------------------------------------------------
+// Deck-size variants (see DurakDeck in durak.h)
+// ----------------------------------------------------------------------------
+
+void DeckVariantsTest() {
+  // The 24- and 52-card variants instantiate the same templated logic over
+  // different deck geometry; run them through the same basic gauntlet.
+  for (const char* name : {"durak_short", "durak52"}) {
+    testing::LoadGameTest(name);
+    testing::RandomSimTest(*LoadGame(name), /*num_sims=*/10);
+  }
+
+  // Spot-check the derived compile-time constants.
+  std::shared_ptr<const Game> short_game = LoadGame("durak_short");
+  SPIEL_CHECK_EQ(short_game->NumDistinctActions(), 24 + 3);
+  SPIEL_CHECK_EQ(short_game->ObservationTensorShape()[0], 13 + 4 * 24);
+  std::shared_ptr<const Game> big_game = LoadGame("durak52");
+  SPIEL_CHECK_EQ(big_game->NumDistinctActions(), 52 + 3);
+  SPIEL_CHECK_EQ(big_game->ObservationTensorShape()[0], 13 + 4 * 52);
+
+  // The short deck drops the low ranks, the 52-card deck keeps them all:
+  // card 0 is the lowest spade of each deck.
+  SPIEL_CHECK_EQ(DurakDeck<6>::CardToString(0), std::string("9♠"));
+  SPIEL_CHECK_EQ(DurakDeck<13>::CardToString(0), std::string("2♠"));
+  SPIEL_CHECK_EQ(CardToString(0), std::string("6♠"));
+
+  // A trump beats every card of another suit in any deck; a higher rank of
+  // the same suit beats a lower one.
+  SPIEL_CHECK_TRUE(DurakDeck<6>::kBeatsTable[0][6] & CardBit(0));
+  SPIEL_CHECK_TRUE(DurakDeck<13>::kBeatsTable[0][0] & CardBit(1));
+}
+
+// ----------------------------------------------------------------------------
+// Test serialization / deserialization
+// ----------------------------------------------------------------------------
+
+void SerializeDeserializeTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  std::unique_ptr<State> state = game->NewInitialState();
+
+  // Let's advance the state through any forced chance actions (dealing)
+  while (!state->IsTerminal() && state->CurrentPlayer() == kChancePlayerId) {
+    std::vector<std::pair<Action, double>> outcomes = state->ChanceOutcomes();
+    SPIEL_CHECK_EQ(outcomes.size(), 1);  // we expect exactly 1 forced outcome
+    state->ApplyAction(outcomes[0].first);
+  }
+
+  // Then let the current player (if not terminal) take one action.
+  if (!state->IsTerminal()) {
+    std::vector<Action> legal_actions = state->LegalActions();
+    if (!legal_actions.empty()) {
+      state->ApplyAction(legal_actions[0]);  // pick the first, arbitrary
+    }
+  }
+
+  // Now we do our custom check for serialization & deserialization:
+  MySerializeDeserializeTest(*game, *state);
+}
+
+// ----------------------------------------------------------------------------
+// Binary serialization: restores the concrete state without history replay.
+// ----------------------------------------------------------------------------
+
+void BinarySerializeDeserializeTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  SPIEL_CHECK_TRUE(game->ProvidesBinaryStateSerialization());
+
+  // Walk a game a fair way in so the snapshot covers a mid-game state with
+  // cards on the table and in the discard pile.
+  std::unique_ptr<State> state = game->NewInitialState();
+  std::mt19937 rng(7517);
+  for (int step = 0; step < 40 && !state->IsTerminal(); ++step) {
+    if (state->IsChanceNode()) {
+      state->ApplyAction(state->ChanceOutcomes()[0].first);
+    } else {
+      std::vector<Action> legal_actions = state->LegalActions();
+      state->ApplyAction(legal_actions[rng() % legal_actions.size()]);
+    }
+  }
+
+  std::string serialized = SerializeGameAndStateBinary(*game, *state);
+  auto game_and_state = DeserializeGameAndStateBinary(serialized);
+  State* restored = game_and_state.second.get();
+  SPIEL_CHECK_EQ(game->ToString(), game_and_state.first->ToString());
+  SPIEL_CHECK_EQ(state->ToString(), restored->ToString());
+  SPIEL_CHECK_EQ(state->CurrentPlayer(), restored->CurrentPlayer());
+  SPIEL_CHECK_EQ(state->MoveNumber(), restored->MoveNumber());
+  SPIEL_CHECK_TRUE(state->LegalActions() == restored->LegalActions());
+  if (!state->IsTerminal() && !state->IsChanceNode()) {
+    for (Player p = 0; p < game->NumPlayers(); ++p) {
+      std::vector<float> expected(game->ObservationTensorSize());
+      std::vector<float> actual(game->ObservationTensorSize());
+      state->ObservationTensor(p, absl::MakeSpan(expected));
+      restored->ObservationTensor(p, absl::MakeSpan(actual));
+      SPIEL_CHECK_TRUE(expected == actual);
+    }
+  }
+
+  // Play the restored state forward: it must behave like the original.
+  while (!restored->IsTerminal()) {
+    if (restored->IsChanceNode()) {
+      restored->ApplyAction(restored->ChanceOutcomes()[0].first);
+    } else {
+      restored->ApplyAction(restored->LegalActions()[0]);
+    }
+  }
+
+  // A game without binary support falls back to history replay.
+  std::shared_ptr<const Game> kuhn = LoadGame("kuhn_poker");
+  SPIEL_CHECK_FALSE(kuhn->ProvidesBinaryStateSerialization());
+  std::unique_ptr<State> kuhn_state = kuhn->NewInitialState();
+  kuhn_state->ApplyAction(kuhn_state->LegalActions()[0]);
+  auto kuhn_restored = DeserializeGameAndStateBinary(
+      SerializeGameAndStateBinary(*kuhn, *kuhn_state));
+  SPIEL_CHECK_EQ(kuhn_state->ToString(), kuhn_restored.second->ToString());
+}
+
+// ----------------------------------------------------------------------------
+// Byte observations must agree with the float tensor at every state.
+// ----------------------------------------------------------------------------
+
+void ObservationBitsTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  SPIEL_CHECK_TRUE(game->ProvidesObservationBits());
+  std::unique_ptr<State> state = game->NewInitialState();
+  std::mt19937 rng(991);
+  int checked = 0;
+  while (!state->IsTerminal()) {
+    if (state->IsChanceNode()) {
+      state->ApplyAction(state->ChanceOutcomes()[0].first);
+      continue;
+    }
+    for (Player p = 0; p < game->NumPlayers(); ++p) {
+      std::vector<float> tensor(game->ObservationTensorSize());
+      std::vector<uint8_t> bits(game->ObservationTensorSize());
+      state->ObservationTensor(p, absl::MakeSpan(tensor));
+      state->ObservationBits(p, absl::MakeSpan(bits));
+      int rescaled = 0;
+      for (int i = 0; i < static_cast<int>(tensor.size()); ++i) {
+        if (tensor[i] == static_cast<float>(bits[i])) continue;
+        // The deck-size entry is normalized in the float tensor and raw in
+        // the byte encoding; every other entry must match exactly.
+        SPIEL_CHECK_FLOAT_EQ(tensor[i],
+                             static_cast<float>(bits[i]) / kNumCards);
+        ++rescaled;
+      }
+      SPIEL_CHECK_LE(rescaled, 1);
+    }
+    ++checked;
+    std::vector<Action> legal_actions = state->LegalActions();
+    state->ApplyAction(legal_actions[rng() % legal_actions.size()]);
+  }
+  SPIEL_CHECK_GT(checked, 0);
+}
+
+// ----------------------------------------------------------------------------
+// Compact engineered-feature observer (see DurakCompactObserverT)
+// ----------------------------------------------------------------------------
+
+void CompactObserverTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  auto observer = game->MakeObserver(
+      absl::nullopt, {{"compact", GameParameter(true)}});
+  testing::RandomSimTestCustomObserver(*game, observer);
+
+  // Walk a game and cross-check the engineered features against the state.
+  std::unique_ptr<State> state = game->NewInitialState();
+  std::mt19937 rng(417);
+  int checked = 0;
+  while (!state->IsTerminal()) {
+    if (state->IsChanceNode()) {
+      state->ApplyAction(state->ChanceOutcomes()[0].first);
+      continue;
+    }
+    const auto& durak_state = down_cast<const DurakState&>(*state);
+    for (Player p = 0; p < game->NumPlayers(); ++p) {
+      std::vector<float> values(kCompactTensorSize);
+      durak_state.CompactObservationTensor(p, absl::MakeSpan(values));
+      // Observer, trump suit and phase one-hots each sum to one (the trump
+      // is revealed before the first decision node).
+      SPIEL_CHECK_FLOAT_EQ(values[0] + values[1], 1.f);
+      SPIEL_CHECK_FLOAT_EQ(values[2] + values[3] + values[4] + values[5], 1.f);
+      SPIEL_CHECK_FLOAT_EQ(values[6] + values[7] + values[8] + values[9], 1.f);
+      // Suit counts recompose the hand size, under the two normalizations.
+      float suit_sum = 0.f;
+      for (int suit = 0; suit < 4; ++suit) suit_sum += values[15 + suit];
+      SPIEL_CHECK_FLOAT_EQ(suit_sum * kNumRanks, values[25] * kNumCards);
+      // Table counts: attacks = covered + uncovered, bounded by the table.
+      SPIEL_CHECK_FLOAT_EQ(values[28], values[29] + values[30]);
+      // Everything is a normalized quantity or an indicator.
+      for (float v : values) {
+        SPIEL_CHECK_GE(v, 0.f);
+        SPIEL_CHECK_LE(v, 1.f);
+      }
+    }
+    ++checked;
+    std::vector<Action> legal_actions = state->LegalActions();
+    state->ApplyAction(legal_actions[rng() % legal_actions.size()]);
+  }
+  SPIEL_CHECK_GT(checked, 0);
+}
+
+// ----------------------------------------------------------------------------
+// SuitAugmentationTest: relabeling the non-trump suits keeps the
+// observation consistent and maps actions/policy along.
+// ----------------------------------------------------------------------------
+
+void SuitAugmentationTest() {
+  // The helper resolves the deck geometry from the registered short names.
+  SPIEL_CHECK_EQ(SuitAugmentationRanks("durak"), 9);
+  SPIEL_CHECK_EQ(SuitAugmentationRanks("durak_short"), 6);
+  SPIEL_CHECK_EQ(SuitAugmentationRanks("durak52"), 13);
+  SPIEL_CHECK_EQ(SuitAugmentationRanks("durak_with_transfers"), 9);
+  SPIEL_CHECK_EQ(SuitAugmentationRanks("kuhn_poker"), 0);
+
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  std::unique_ptr<State> state = game->NewInitialState();
+  std::mt19937 rng(733);
+  int checked = 0;
+  while (!state->IsTerminal()) {
+    if (state->IsChanceNode()) {
+      state->ApplyAction(state->ChanceOutcomes()[0].first);
+      continue;
+    }
+    Player player = state->CurrentPlayer();
+    std::vector<float> original(game->ObservationTensorSize());
+    state->ObservationTensor(player, absl::MakeSpan(original));
+    std::vector<Action> legal_actions = state->LegalActions();
+    ActionsAndProbs policy;
+    for (Action a : legal_actions) {
+      policy.push_back({a, 1.0 / legal_actions.size()});
+    }
+
+    std::vector<float> augmented = original;
+    std::vector<Action> mapped_actions = legal_actions;
+    ActionsAndProbs mapped_policy = policy;
+    AugmentWithSuitPermutation(kNumRanks, absl::MakeSpan(augmented),
+                               &mapped_actions, &mapped_policy, &rng);
+
+    // The scalar head (player, trump suit, phase, ...) is untouched, and
+    // the trump suit's rank block stays in place in every card plane.
+    for (int i = 0; i < 13; ++i) {
+      SPIEL_CHECK_FLOAT_EQ(augmented[i], original[i]);
+    }
+    int trump_suit = -1;
+    for (int suit = 0; suit < 4; ++suit) {
+      if (original[2 + suit] != 0) trump_suit = suit;
+    }
+    SPIEL_CHECK_GE(trump_suit, 0);
+    for (int plane = 0; plane < 4; ++plane) {
+      float original_count = 0.f;
+      float augmented_count = 0.f;
+      for (int card = 0; card < kNumCards; ++card) {
+        original_count += original[13 + plane * kNumCards + card];
+        augmented_count += augmented[13 + plane * kNumCards + card];
+      }
+      // Relabeling only moves bits between suit blocks.
+      SPIEL_CHECK_FLOAT_EQ(original_count, augmented_count);
+      for (int rank = 0; rank < kNumRanks; ++rank) {
+        int card = trump_suit * kNumRanks + rank;
+        SPIEL_CHECK_FLOAT_EQ(augmented[13 + plane * kNumCards + card],
+                             original[13 + plane * kNumCards + card]);
+      }
+    }
+    // Actions stay sorted and distinct; the non-card actions keep their
+    // ids; the policy follows the same relabeling (uniform here, so the
+    // probabilities per entry are unchanged).
+    SPIEL_CHECK_EQ(mapped_actions.size(), legal_actions.size());
+    SPIEL_CHECK_TRUE(
+        std::is_sorted(mapped_actions.begin(), mapped_actions.end()));
+    for (Action a : legal_actions) {
+      if (a >= kNumCards) {
+        SPIEL_CHECK_TRUE(std::find(mapped_actions.begin(),
+                                   mapped_actions.end(),
+                                   a) != mapped_actions.end());
+      }
+    }
+    SPIEL_CHECK_EQ(mapped_policy.size(), policy.size());
+    for (int i = 0; i < mapped_policy.size(); ++i) {
+      SPIEL_CHECK_EQ(mapped_policy[i].first, mapped_actions[i]);
+      SPIEL_CHECK_FLOAT_EQ(mapped_policy[i].second,
+                           1.0 / legal_actions.size());
+    }
+    ++checked;
+    state->ApplyAction(legal_actions[rng() % legal_actions.size()]);
+  }
+  SPIEL_CHECK_GT(checked, 0);
+
+  // Without a revealed trump the symmetry is undefined: the helper must
+  // leave everything alone.
+  std::vector<float> blank(13 + 4 * kNumCards, 0.f);
+  blank[13 + 5] = 1.f;
+  std::vector<Action> actions = {3, 5};
+  ActionsAndProbs probs = {{3, 0.5}, {5, 0.5}};
+  AugmentWithSuitPermutation(kNumRanks, absl::MakeSpan(blank), &actions,
+                             &probs, &rng);
+  SPIEL_CHECK_FLOAT_EQ(blank[13 + 5], 1.f);
+  SPIEL_CHECK_EQ(actions[0], 3);
+  SPIEL_CHECK_EQ(probs[1].first, 5);
+}
+
+// ----------------------------------------------------------------------------
+// (Optional) CountStatesTest: enumerates all reachable states up to infinite depth.
+// ----------------------------------------------------------------------------
+
+void CountStatesTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+
+  // Example to get all states without a depth limit:
+  auto states = algorithms::GetAllStates(
+      *game,
+      /*depth_limit=*/-1,
+      /*include_terminals=*/true,
+      /*include_chance_states=*/true);
+
+  // For Durak, the state space can be large. We just show it completes:
+  std::cout << "Number of reachable states: " << states.size() << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+// RolloutEvaluatorMCTSTest: the batched rollout evaluator drives MCTSBot.
+// ----------------------------------------------------------------------------
+
+void RolloutEvaluatorMCTSTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  auto evaluator = std::make_shared<DurakRolloutEvaluator>(
+      /*n_rollouts=*/32, /*seed=*/7);
+
+  // Leaf values are antisymmetric (the game is zero-sum).
+  std::mt19937 rng(1234);
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (state->IsChanceNode()) {
+    state->ApplyAction(SampleAction(state->ChanceOutcomes(), rng).first);
+  }
+  std::vector<double> values = evaluator->Evaluate(*state);
+  SPIEL_CHECK_EQ(values.size(), 2);
+  SPIEL_CHECK_FLOAT_EQ(values[0] + values[1], 0.0);
+  SPIEL_CHECK_GE(values[0], game->MinUtility());
+  SPIEL_CHECK_LE(values[0], game->MaxUtility());
+
+  // A full game between two bots sharing the evaluator completes and is
+  // zero-sum.
+  algorithms::MCTSBot bot0(*game, evaluator, /*uct_c=*/2,
+                           /*max_simulations=*/50, /*max_memory_mb=*/10,
+                           /*solve=*/false, /*seed=*/42, /*verbose=*/false);
+  algorithms::MCTSBot bot1(*game, evaluator, /*uct_c=*/2,
+                           /*max_simulations=*/50, /*max_memory_mb=*/10,
+                           /*solve=*/false, /*seed=*/43, /*verbose=*/false);
+  state = game->NewInitialState();
+  while (!state->IsTerminal()) {
+    if (state->IsChanceNode()) {
+      state->ApplyAction(SampleAction(state->ChanceOutcomes(), rng).first);
+    } else if (state->CurrentPlayer() == 0) {
+      state->ApplyAction(bot0.Step(*state));
+    } else {
+      state->ApplyAction(bot1.Step(*state));
+    }
+  }
+  std::vector<double> returns = state->Returns();
+  SPIEL_CHECK_FLOAT_EQ(returns[0] + returns[1], 0.0);
+}
+
+// ----------------------------------------------------------------------------
+// StaticEvaluatorTest: depth-limited rollouts with the static leaf scorer.
+// ----------------------------------------------------------------------------
+
+void StaticEvaluatorTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  auto static_eval = std::make_shared<DurakStaticEvaluator>();
+
+  // Static values are antisymmetric and inside the utility range.
+  std::mt19937 rng(99);
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (state->IsChanceNode()) {
+    state->ApplyAction(SampleAction(state->ChanceOutcomes(), rng).first);
+  }
+  std::vector<double> values = static_eval->Evaluate(*state);
+  SPIEL_CHECK_EQ(values.size(), 2);
+  SPIEL_CHECK_FLOAT_EQ(values[0] + values[1], 0.0);
+  SPIEL_CHECK_GT(values[0], game->MinUtility());
+  SPIEL_CHECK_LT(values[0], game->MaxUtility());
+
+  // Depth-limited rollouts scored by the static evaluation drive a full
+  // MCTS game to completion.
+  auto evaluator = std::make_shared<algorithms::DepthLimitedRolloutEvaluator>(
+      /*n_rollouts=*/8, /*max_rollout_length=*/10, static_eval, /*seed=*/7);
+  algorithms::MCTSBot bot0(*game, evaluator, /*uct_c=*/2,
+                           /*max_simulations=*/50, /*max_memory_mb=*/10,
+                           /*solve=*/false, /*seed=*/42, /*verbose=*/false);
+  algorithms::MCTSBot bot1(*game, evaluator, /*uct_c=*/2,
+                           /*max_simulations=*/50, /*max_memory_mb=*/10,
+                           /*solve=*/false, /*seed=*/43, /*verbose=*/false);
+  state = game->NewInitialState();
+  while (!state->IsTerminal()) {
+    if (state->IsChanceNode()) {
+      state->ApplyAction(SampleAction(state->ChanceOutcomes(), rng).first);
+    } else if (state->CurrentPlayer() == 0) {
+      state->ApplyAction(bot0.Step(*state));
+    } else {
+      state->ApplyAction(bot1.Step(*state));
+    }
+  }
+  std::vector<double> returns = state->Returns();
+  SPIEL_CHECK_FLOAT_EQ(returns[0] + returns[1], 0.0);
+
+  // Terminal positions are scored exactly.
+  values = static_eval->Evaluate(*state);
+  SPIEL_CHECK_FLOAT_EQ(values[0], returns[0]);
+  SPIEL_CHECK_FLOAT_EQ(values[1], returns[1]);
+}
+
+// ----------------------------------------------------------------------------
+// BeliefTrackerTest: the particle filter never contradicts the true hand.
+// ----------------------------------------------------------------------------
+
+// Reads a player's true hand out of their own observation tensor (entries
+// [49, 85) are the hand multi-hot; see the layout comment in durak.h).
+CardSet HandFromObservation(const State& state, Player player) {
+  std::vector<float> tensor(kTensorSize);
+  state.ObservationTensor(player, absl::MakeSpan(tensor));
+  CardSet hand = 0;
+  for (int c = 0; c < kNumCards; ++c) {
+    if (tensor[49 + c] > 0.5f) hand |= CardBit(c);
+  }
+  return hand;
+}
+
+void BeliefTrackerTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  std::mt19937 rng(4242);
+  for (int trial = 0; trial < 4; ++trial) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    while (state->IsChanceNode()) {
+      state->ApplyAction(state->ChanceOutcomes()[0].first);
+    }
+    const Player observer = trial % 2;
+    const Player opponent = 1 - observer;
+    DurakState* durak_state = down_cast<DurakState*>(state.get());
+    DurakBeliefTracker tracker(/*num_particles=*/256, /*seed=*/17 + trial);
+    tracker.ResetFrom(*durak_state, observer);
+
+    int moves = 0;
+    while (!state->IsTerminal()) {
+      std::vector<Action> legal_actions = state->LegalActions();
+      Action action = legal_actions[rng() % legal_actions.size()];
+      std::unique_ptr<State> next = state->Child(action);
+      DurakState* next_durak = down_cast<DurakState*>(next.get());
+      tracker.ObserveTransition(*durak_state, action, *next_durak);
+      state = std::move(next);
+      durak_state = next_durak;
+      ++moves;
+      if (state->IsTerminal()) break;
+
+      // The public constraints must bracket the true opponent hand:
+      // known cards are held, and nothing is held outside known + unseen.
+      const CardSet truth = HandFromObservation(*state, opponent);
+      const CardSet known = tracker.known_opponent_cards();
+      const CardSet pool = tracker.unseen_pool();
+      SPIEL_CHECK_EQ(CardSetSize(truth), tracker.opponent_hand_size());
+      SPIEL_CHECK_EQ(truth & known, known);
+      SPIEL_CHECK_EQ(truth & ~(pool | known), CardSet{0});
+
+      // Every live particle is a well-formed hypothesis.
+      double total_weight = 0;
+      for (int i = 0; i < tracker.num_particles(); ++i) {
+        const double weight = tracker.weights()[i];
+        total_weight += weight;
+        if (weight == 0) continue;
+        const CardSet hand = tracker.particles()[i];
+        SPIEL_CHECK_EQ(CardSetSize(hand), tracker.opponent_hand_size());
+        SPIEL_CHECK_EQ(hand & known, known);
+        SPIEL_CHECK_EQ(hand & ~(pool | known), CardSet{0});
+      }
+      SPIEL_CHECK_GT(total_weight, 0);
+
+      // Determinization must preserve the observer's view, and the
+      // determinized state must be playable.
+      if (moves == 10) {
+        std::unique_ptr<State> det = state->Clone();
+        tracker.DeterminizeInto(down_cast<DurakState*>(det.get()));
+        SPIEL_CHECK_EQ(det->ObservationString(observer),
+                       state->ObservationString(observer));
+        while (!det->IsTerminal()) {
+          std::vector<Action> det_actions = det->LegalActions();
+          det->ApplyAction(det_actions[rng() % det_actions.size()]);
+        }
+      }
+    }
+  }
+}
+
+// ----------------------------------------------------------------------------
+// TablebaseTest: probed values match a direct minimax over the public API.
+// ----------------------------------------------------------------------------
+
+// Game value for player 0 of a perfect-information position (+1 / 0 / -1).
+int8_t BruteForceValue(const State& state) {
+  if (state.IsTerminal()) {
+    const double value = state.Returns()[0];
+    return value > 0 ? 1 : (value < 0 ? -1 : 0);
+  }
+  const Player player = state.CurrentPlayer();
+  int8_t best = player == 0 ? -1 : 1;
+  for (Action action : state.LegalActions()) {
+    const int8_t value = BruteForceValue(*state.Child(action));
+    best = player == 0 ? std::max(best, value) : std::min(best, value);
+  }
+  return best;
+}
+
+void TablebaseTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  const std::string path = file::GetTmpDir() + "/durak_tablebase_test.tb";
+  DurakTablebase::Build(path, /*max_cards_per_side=*/1);
+
+  std::unique_ptr<DurakTablebase> tablebase = DurakTablebase::Open(path);
+  SPIEL_CHECK_EQ(tablebase->max_cards_per_side(), 1);
+
+  for (int trump_suit = 0; trump_suit < 4; ++trump_suit) {
+    for (int attack_card = 0; attack_card < kNumCards; ++attack_card) {
+      for (int defense_card = 0; defense_card < kNumCards; ++defense_card) {
+        if (defense_card == attack_card) continue;
+        std::unique_ptr<State> state = DurakTablebase::MakeEndgameState(
+            game, trump_suit, CardBit(attack_card), CardBit(defense_card));
+        absl::optional<double> probed =
+            tablebase->Probe(*down_cast<const DurakState*>(state.get()));
+        SPIEL_CHECK_TRUE(probed.has_value());
+        SPIEL_CHECK_EQ(static_cast<int8_t>(*probed), BruteForceValue(*state));
+      }
+    }
+  }
+
+  // Positions outside the table fall through to rollouts: a fresh deal has a
+  // full deck and six-card hands.
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (state->IsChanceNode()) {
+    state->ApplyAction(state->ChanceOutcomes()[0].first);
+  }
+  SPIEL_CHECK_FALSE(
+      tablebase->Probe(*down_cast<const DurakState*>(state.get()))
+          .has_value());
+
+  // The tablebase-backed evaluator returns the exact value at covered leaves.
+  DurakRolloutEvaluator evaluator(/*n_rollouts=*/1, /*seed=*/5,
+                                  std::move(tablebase));
+  std::unique_ptr<State> endgame = DurakTablebase::MakeEndgameState(
+      game, /*trump_suit=*/0, CardBit(8), CardBit(0));
+  std::vector<double> values = evaluator.Evaluate(*endgame);
+  SPIEL_CHECK_EQ(values[0], BruteForceValue(*endgame));
+  SPIEL_CHECK_FLOAT_EQ(values[0] + values[1], 0.0);
+
+  file::Remove(path);
+}
+
+// ----------------------------------------------------------------------------
+// CanonicalInfoStateTest: suit-isomorphic states share a key, others do not.
+// ----------------------------------------------------------------------------
+
+void CanonicalInfoStateTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  // Suits: 0 = trump here, clubs = cards 9..17, hearts = cards 27..35.
+  // Swapping clubs and hearts everywhere is a suit isomorphism.
+  std::unique_ptr<State> a = DurakTablebase::MakeEndgameState(
+      game, /*trump_suit=*/0, CardBit(9) | CardBit(13), CardBit(19));
+  std::unique_ptr<State> b = DurakTablebase::MakeEndgameState(
+      game, /*trump_suit=*/0, CardBit(27) | CardBit(31), CardBit(19));
+  const DurakState* state_a = down_cast<const DurakState*>(a.get());
+  const DurakState* state_b = down_cast<const DurakState*>(b.get());
+  SPIEL_CHECK_EQ(state_a->CanonicalInfoStateString(0),
+                 state_b->CanonicalInfoStateString(0));
+  SPIEL_CHECK_EQ(state_a->CanonicalInfoStateString(1),
+                 state_b->CanonicalInfoStateString(1));
+  // Legal actions of merged infostates must align position by position:
+  // both lists are ascending, and the relabeling preserves hand order.
+  SPIEL_CHECK_EQ(a->LegalActions().size(), b->LegalActions().size());
+
+  // Changing a rank (not just a suit name) changes the key.
+  std::unique_ptr<State> c = DurakTablebase::MakeEndgameState(
+      game, /*trump_suit=*/0, CardBit(10) | CardBit(13), CardBit(19));
+  SPIEL_CHECK_NE(state_a->CanonicalInfoStateString(0),
+                 down_cast<const DurakState*>(c.get())
+                     ->CanonicalInfoStateString(0));
+
+  // A different trump suit with hands relabeled accordingly also merges.
+  std::unique_ptr<State> d = DurakTablebase::MakeEndgameState(
+      game, /*trump_suit=*/1, CardBit(0) | CardBit(4), CardBit(19));
+  std::unique_ptr<State> e = DurakTablebase::MakeEndgameState(
+      game, /*trump_suit=*/0, CardBit(9) | CardBit(13), CardBit(19));
+  SPIEL_CHECK_EQ(down_cast<const DurakState*>(d.get())
+                     ->CanonicalInfoStateString(0),
+                 down_cast<const DurakState*>(e.get())
+                     ->CanonicalInfoStateString(0));
+}
+
+// ----------------------------------------------------------------------------
+// ResampleFromInfostateTest: native determinization preserves the observer's
+// view and produces playable states.
+// ----------------------------------------------------------------------------
+
+void ResampleFromInfostateTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  std::mt19937 mt(91);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::function<double()> rng = [&]() { return dist(mt); };
+  for (int trial = 0; trial < 4; ++trial) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    while (state->IsChanceNode()) {
+      state->ApplyAction(state->ChanceOutcomes()[0].first);
+    }
+    int moves = 0;
+    while (!state->IsTerminal() && moves < 30) {
+      std::vector<Action> legal_actions = state->LegalActions();
+      state->ApplyAction(legal_actions[mt() % legal_actions.size()]);
+      ++moves;
+      if (state->IsTerminal()) break;
+
+      for (Player observer = 0; observer < kNumPlayers; ++observer) {
+        const Player opponent = 1 - observer;
+        std::unique_ptr<State> sample =
+            state->ResampleFromInfostate(observer, rng);
+        // The observer's infostate (their observation) is held constant.
+        SPIEL_CHECK_EQ(sample->InformationStateString(observer),
+                       state->InformationStateString(observer));
+        // The opponent's hand keeps its size and never overlaps anything
+        // the observer can see.
+        const CardSet own = HandFromObservation(*state, observer);
+        const CardSet opp_before = HandFromObservation(*state, opponent);
+        const CardSet opp_after = HandFromObservation(*sample, opponent);
+        SPIEL_CHECK_EQ(CardSetSize(opp_after), CardSetSize(opp_before));
+        SPIEL_CHECK_EQ(opp_after & own, CardSet{0});
+        // The sampled state plays out to a terminal without issue.
+        if (moves == 10) {
+          std::unique_ptr<State> playout = sample->Clone();
+          while (!playout->IsTerminal()) {
+            std::vector<Action> playout_actions = playout->LegalActions();
+            playout->ApplyAction(
+                playout_actions[mt() % playout_actions.size()]);
+          }
+        }
+      }
+    }
+  }
+}
+
+// ----------------------------------------------------------------------------
+// InformationStateHashTest: the allocation-free hash keeps the
+// InformationStateString contract — equal strings hash equally, and
+// distinct strings never collide across a sizeable sample of states.
+// ----------------------------------------------------------------------------
+
+void InformationStateHashTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  std::mt19937 mt(56);
+  std::map<std::string, uint64_t> string_to_hash;
+  std::map<uint64_t, std::string> hash_to_string;
+  for (int episode = 0; episode < 25; ++episode) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    while (!state->IsTerminal()) {
+      if (state->IsChanceNode()) {
+        std::vector<std::pair<Action, double>> outcomes =
+            state->ChanceOutcomes();
+        state->ApplyAction(outcomes[mt() % outcomes.size()].first);
+        continue;
+      }
+      for (Player player = 0; player < kNumPlayers; ++player) {
+        const std::string info = state->InformationStateString(player);
+        const uint64_t hash = state->InformationStateHash(player);
+        auto [it, inserted] = string_to_hash.emplace(info, hash);
+        SPIEL_CHECK_EQ(it->second, hash);
+        auto [hash_it, hash_inserted] = hash_to_string.emplace(hash, info);
+        SPIEL_CHECK_EQ(hash_it->second, info);
+      }
+      std::vector<Action> legal_actions = state->LegalActions();
+      state->ApplyAction(legal_actions[mt() % legal_actions.size()]);
+    }
+  }
+  SPIEL_CHECK_GT(string_to_hash.size(), 100);
+}
+
+// ----------------------------------------------------------------------------
+// PublicStateIdTest: the id depends only on public information — it is
+// invariant under resampling of the players' private cards — and it tracks
+// the public state as the game advances.
+// ----------------------------------------------------------------------------
+
+void PublicStateIdTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak");
+  std::mt19937 mt(117);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::function<double()> rng = [&]() { return dist(mt); };
+  int distinct_ids = 0;
+  for (int episode = 0; episode < 10; ++episode) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    while (state->IsChanceNode()) {
+      std::vector<std::pair<Action, double>> outcomes =
+          state->ChanceOutcomes();
+      state->ApplyAction(outcomes[mt() % outcomes.size()].first);
+    }
+    uint64_t previous_id = 0;
+    bool have_previous = false;
+    while (!state->IsTerminal()) {
+      const auto& durak_state = static_cast<const DurakState&>(*state);
+      const uint64_t id = durak_state.PublicStateId();
+      if (!have_previous || id != previous_id) ++distinct_ids;
+      previous_id = id;
+      have_previous = true;
+
+      // Resampling the opponents' private cards keeps the public state, so
+      // the id must not move.
+      for (Player observer = 0; observer < kNumPlayers; ++observer) {
+        std::unique_ptr<State> sample =
+            state->ResampleFromInfostate(observer, rng);
+        SPIEL_CHECK_EQ(
+            static_cast<const DurakState&>(*sample).PublicStateId(), id);
+      }
+
+      std::vector<Action> legal_actions = state->LegalActions();
+      state->ApplyAction(legal_actions[mt() % legal_actions.size()]);
+    }
+  }
+  // Ids track the advancing public state rather than collapsing together.
+  SPIEL_CHECK_GT(distinct_ids, 50);
+}
+
+// ----------------------------------------------------------------------------
+// SampledDealTest: the composite deal reaches the same position as the
+// explicit card-by-card chance walk.
+// ----------------------------------------------------------------------------
+
+void SampledDealTest() {
+  std::shared_ptr<const Game> sampled =
+      LoadGame("durak(sampled_deal=true,rng_seed=77)");
+  SPIEL_CHECK_TRUE(sampled->GetType().chance_mode ==
+                   GameType::ChanceMode::kSampledStochastic);
+  std::shared_ptr<const Game> explicit_game = LoadGame("durak(rng_seed=77)");
+
+  // One composite outcome collapses the ~13-node explicit deal.
+  std::unique_ptr<State> state = sampled->NewInitialState();
+  SPIEL_CHECK_TRUE(state->IsChanceNode());
+  std::vector<std::pair<Action, double>> outcomes = state->ChanceOutcomes();
+  SPIEL_CHECK_EQ(outcomes.size(), 1);
+  state->ApplyAction(outcomes[0].first);
+  SPIEL_CHECK_FALSE(state->IsChanceNode());
+
+  std::unique_ptr<State> reference = explicit_game->NewInitialState();
+  while (reference->IsChanceNode()) {
+    reference->ApplyAction(reference->ChanceOutcomes()[0].first);
+  }
+  SPIEL_CHECK_EQ(state->ToString(), reference->ToString());
+
+  // The collapsed game plays out normally.
+  std::mt19937 mt(7);
+  while (!state->IsTerminal()) {
+    std::vector<Action> legal_actions = state->LegalActions();
+    state->ApplyAction(legal_actions[mt() % legal_actions.size()]);
+  }
+}
+
+// ----------------------------------------------------------------------------
+// ReturnsIntoTest: the allocation-free override agrees with Returns() at
+// every step of a random playout, including the terminal.
+// ----------------------------------------------------------------------------
+
+void ReturnsIntoTest() {
+  std::shared_ptr<const Game> game = LoadGame("durak(rng_seed=11)");
+  std::mt19937 mt(11);
+  std::array<double, 2> buffer;
+  for (int episode = 0; episode < 5; ++episode) {
+    std::unique_ptr<State> state = game->NewInitialState();
+    while (!state->IsTerminal()) {
+      if (!state->IsChanceNode()) {
+        state->ReturnsInto(absl::MakeSpan(buffer));
+        std::vector<double> expected = state->Returns();
+        SPIEL_CHECK_EQ(buffer[0], expected[0]);
+        SPIEL_CHECK_EQ(buffer[1], expected[1]);
+      }
+      std::vector<Action> legal_actions = state->LegalActions();
+      state->ApplyAction(legal_actions[mt() % legal_actions.size()]);
+    }
+    state->ReturnsInto(absl::MakeSpan(buffer));
+    std::vector<double> expected = state->Returns();
+    SPIEL_CHECK_EQ(buffer[0], expected[0]);
+    SPIEL_CHECK_EQ(buffer[1], expected[1]);
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Main test driver
+// ----------------------------------------------------------------------------
+
+}  // namespace
+}  // namespace durak
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::durak::BasicDurakTests();
+  open_spiel::durak::DeckVariantsTest();
+  open_spiel::durak::SerializeDeserializeTest();
+  open_spiel::durak::BinarySerializeDeserializeTest();
+  open_spiel::durak::ObservationBitsTest();
+  open_spiel::durak::CompactObserverTest();
+  open_spiel::durak::SuitAugmentationTest();
+  open_spiel::durak::RolloutEvaluatorMCTSTest();
+  open_spiel::durak::StaticEvaluatorTest();
+  open_spiel::durak::BeliefTrackerTest();
+  open_spiel::durak::TablebaseTest();
+  open_spiel::durak::CanonicalInfoStateTest();
+  open_spiel::durak::ResampleFromInfostateTest();
+  open_spiel::durak::InformationStateHashTest();
+  open_spiel::durak::PublicStateIdTest();
+  open_spiel::durak::SampledDealTest();
+  open_spiel::durak::ReturnsIntoTest();
+  // Runs for too long, commented out for now
+  // open_spiel::durak::CountStatesTest();
+  return 0;
+}
@@ -48,7 +48,7 @@ inline std::string CardToString(int card) {
 }
 
 // Implement deck shuffling.
-void ShuffleDeck(std::mt19937* rng, std::vector<int>& deck, int begin, int end);
+void ShuffleDeck(FastRng* rng, std::vector<int>& deck, int begin, int end);
 
 // Forward declarations
 class DurakWithTransfersGame;
@@ -84,6 +84,16 @@ class DurakWithTransfersState : public State {
   // Observations
   std::string InformationStateString(Player player) const override;
   std::string ObservationString(Player player) const override;
+
+  // Canonical key of the player's information state, invariant under the
+  // symmetries ObservationString spuriously distinguishes: the table pairs
+  // are sorted (their placement order carries no strategic information) and
+  // the three non-trump suits are relabeled into a canonical order computed
+  // from the player's hand and the table, so suit-isomorphic states share
+  // one key. Solvers keying their tables on this string (through the
+  // observer's "canonical" parameter, see MakeObserver) merge the
+  // equivalent infostates into a single entry.
+  std::string CanonicalPublicStateKey(Player player) const;
   void InformationStateTensor(Player player,
                               absl::Span<float> values) const override;
   void ObservationTensor(Player player,
@@ -111,6 +121,10 @@ class DurakWithTransfersState : public State {
   void CheckGameOver();
   void DefenderTransfers();
 
+  // Snapshots everything UndoAction needs to restore the state preceding
+  // `move`. Called at the top of DoApplyAction.
+  void PushUndoRecord(Action move);
+
   // Game state
   std::vector<int> deck_;
   std::array<std::vector<int>, kNumPlayers> hands_;
@@ -144,6 +158,37 @@ class DurakWithTransfersState : public State {
 
   // Game over flag
   bool game_over_ = false;
+
+  // One record per applied action, enabling O(delta) incremental undo
+  // instead of replaying the whole history. All storage is fixed-size, so
+  // pushing a record allocates nothing once the stack's capacity is warm.
+  //
+  // Cards only ever *leave* a hand by a single erase (recorded as
+  // erased_player/hand_index) and only ever *enter* a hand or the discard
+  // pile by push_back, so undo pops each container back to its recorded size
+  // and re-inserts the erased card at its original position. The table is
+  // bounded by kCardsPerPlayer pairs and is snapshotted whole.
+  struct UndoRecord {
+    Action action;
+    Action prev_last_action;
+    RoundPhase prev_phase;
+    Player prev_attacker;
+    Player prev_defender;
+    Player prev_round_starter;
+    int prev_trump_suit;
+    int prev_trump_card;
+    int prev_cards_dealt;
+    int prev_deck_pos;
+    bool prev_game_over;
+    std::array<int, kNumPlayers> hand_sizes_before;
+    int discard_size_before;
+    // Which hand lost a card to this move, and from which index (-1: none).
+    Player erased_player = -1;
+    int hand_index = -1;
+    int prev_table_len;
+    std::array<std::pair<int, int>, kCardsPerPlayer> prev_table;
+  };
+  std::vector<UndoRecord> undo_stack_;
 };
 
 // -----------------------------------------------------------------------------
@@ -185,7 +230,9 @@ class DurakWithTransfersGame : public Game {
 
 class DurakWithTransfersObserver : public Observer {
  public:
-  explicit DurakWithTransfersObserver(IIGObservationType iig_obs_type);
+  // With `canonical` set, StringFrom returns CanonicalPublicStateKey instead
+  // of ObservationString (requested via the "canonical" observer parameter).
+  DurakWithTransfersObserver(IIGObservationType iig_obs_type, bool canonical);
 
   void WriteTensor(const State& observed_state, int player,
                    Allocator* allocator) const override;
@@ -195,6 +242,7 @@ class DurakWithTransfersObserver : public Observer {
 
  private:
   IIGObservationType iig_obs_type_;
+  bool canonical_;
 };
 
 }  // namespace durak_with_transfers
@@ -15,6 +15,7 @@
 #include "open_spiel/games/efg_game/efg_game.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
@@ -25,6 +26,7 @@
 #include "open_spiel/abseil-cpp/absl/strings/numbers.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/utils/file.h"
@@ -51,7 +53,8 @@ const GameType kGameType{/*short_name=*/"efg_game",
                          /*provides_observation_string=*/true,
                          /*provides_observation_tensor=*/false,
                          /*parameter_specification=*/
-                         {{"filename", GameParameter(std::string(""))}},
+                         {{"filename", GameParameter(std::string(""))},
+                          {"binary_cache", GameParameter(false)}},
                          /*default_loadable=*/false};
 
 std::shared_ptr<const Game> Factory(const GameParameters& params) {
@@ -280,7 +283,8 @@ std::vector<int> EFGGame::InformationStateTensorShape() const {
 EFGGame::EFGGame(const GameParameters& params)
     : Game(kGameType, params),
       filename_(ParameterValue<std::string>("filename")),
-      string_data_(file::ReadContentsFromFile(filename_, "r")),
+      mapped_file_(file::MappedFile(filename_)),
+      data_(mapped_file_->view()),
       pos_(0),
       num_chance_nodes_(0),
       max_actions_(0),
@@ -289,15 +293,25 @@ EFGGame::EFGGame(const GameParameters& params)
       identical_payoffs_(true),
       general_sum_(true),
       perfect_information_(true) {
-  SPIEL_CHECK_GT(string_data_.size(), 0);
+  SPIEL_CHECK_GT(data_.size(), 0);
 
-  // Now parse the string data into a data structure.
-  ParseGame();
+  if (ParameterValue<bool>("binary_cache")) {
+    const std::string cache_filename = filename_ + ".bin";
+    if (file::Exists(cache_filename) && LoadBinaryCache(cache_filename)) {
+      FinalizeGameType();
+      return;
+    }
+    ParseGame();
+    SaveBinaryCache(cache_filename);
+  } else {
+    ParseGame();
+  }
 }
 
 EFGGame::EFGGame(const std::string& data)
     : Game(kGameType, {}),
       string_data_(data),
+      data_(string_data_),
       pos_(0),
       num_chance_nodes_(0),
       max_actions_(0),
@@ -321,9 +335,10 @@ bool EFGGame::IsNodeToken(char c) const {
   return (c == 'c' || c == 'p' || c == 't');
 }
 
-std::unique_ptr<Node> EFGGame::NewNode() const {
-  std::unique_ptr<Node> new_node = std::make_unique<Node>();
-  new_node->id = nodes_.size();
+Node* EFGGame::NewNode() {
+  nodes_.emplace_back();
+  Node* new_node = &nodes_.back();
+  new_node->id = nodes_.size() - 1;
   return new_node;
 }
 
@@ -360,10 +375,10 @@ std::unique_ptr<Node> EFGGame::NewNode() const {
       __FILE__, ":", __LINE__, " CHECK_FALSE(", #x, ")\n",       \
       " while parsing line #", line_, ":\n", GetLine(line_)))
 
-bool EFGGame::ParseDoubleValue(const std::string& str, double* value) const {
+bool EFGGame::ParseDoubleValue(absl::string_view str, double* value) const {
   if (absl::StrContains(str, '/')) {
     // Check for rational number of the form X/Y
-    std::vector<std::string> parts = absl::StrSplit(str, '/');
+    std::vector<absl::string_view> parts = absl::StrSplit(str, '/');
     SPIEL_EFG_PARSE_CHECK_EQ(parts.size(), 2);
     int numerator = 0, denominator = 0;
     bool success = absl::SimpleAtoi(parts[0], &numerator);
@@ -384,30 +399,33 @@ bool EFGGame::ParseDoubleValue(const std::string& str, double* value) const {
 }
 
 
-std::string EFGGame::NextPayoffToken() {
-  std::string str = "";
+// Tokens are views into the mmap'ed (or string-owned) text; nothing is
+// copied until a token is stored into a Node.
+
+absl::string_view EFGGame::NextPayoffToken() {
+  const int64_t start = pos_;
   bool seen_comma = false;
 
   while (true) {
     // Check stopping condition:
-    if (pos_ >= string_data_.length() ||
-        string_data_.at(pos_) == ',' ||
-        IsWhiteSpace(string_data_.at(pos_))) {
+    if (pos_ >= data_.length() ||
+        data_.at(pos_) == ',' ||
+        IsWhiteSpace(data_.at(pos_))) {
       break;
     }
 
-    str.push_back(string_data_.at(pos_));
     AdvancePosition();
   }
+  absl::string_view str = data_.substr(start, pos_ - start);
 
   // Advance the position to the next token.
-  while (pos_ < string_data_.length()) {
-    if (!seen_comma && string_data_.at(pos_) == ',') {
+  while (pos_ < data_.length()) {
+    if (!seen_comma && data_.at(pos_) == ',') {
       seen_comma = true;
       AdvancePosition();
       continue;
     }
-    if (!IsWhiteSpace(string_data_.at(pos_))) {
+    if (!IsWhiteSpace(data_.at(pos_))) {
       break;
     }
     AdvancePosition();
@@ -416,34 +434,34 @@ std::string EFGGame::NextPayoffToken() {
   return str;
 }
 
-std::string EFGGame::NextToken() {
-  std::string str = "";
+absl::string_view EFGGame::NextToken() {
   bool reading_quoted_string = false;
 
-  if (string_data_.at(pos_) == '"') {
+  if (data_.at(pos_) == '"') {
     reading_quoted_string = true;
     AdvancePosition();
   }
+  const int64_t start = pos_;
 
   while (true) {
     // Check stopping condition:
-    if (pos_ >= string_data_.length() ||
-        (reading_quoted_string && string_data_.at(pos_) == '"') ||
-        (!reading_quoted_string && IsWhiteSpace(string_data_.at(pos_)))) {
+    if (pos_ >= data_.length() ||
+        (reading_quoted_string && data_.at(pos_) == '"') ||
+        (!reading_quoted_string && IsWhiteSpace(data_.at(pos_)))) {
       break;
     }
 
-    str.push_back(string_data_.at(pos_));
     AdvancePosition();
   }
+  absl::string_view str = data_.substr(start, pos_ - start);
 
   if (reading_quoted_string) {
-    SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
+    SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
   }
   AdvancePosition();
 
   // Advance the position to the next token.
-  while (pos_ < string_data_.length() && IsWhiteSpace(string_data_.at(pos_))) {
+  while (pos_ < data_.length() && IsWhiteSpace(data_.at(pos_))) {
     AdvancePosition();
   }
 
@@ -452,19 +470,19 @@ std::string EFGGame::NextToken() {
 
 void EFGGame::AdvancePosition() {
   pos_++;
-  if (string_data_[pos_] == '\n') line_++;
+  if (pos_ < data_.length() && data_[pos_] == '\n') line_++;
 }
 
 std::string EFGGame::GetLine(int line) const {
   SPIEL_CHECK_GE(line, 1);
 
   int cur_line = 1;
-  int pos = 0;
-  int len = string_data_.size();
+  int64_t pos = 0;
+  int64_t len = data_.size();
   std::string buf;
   do {
-    if (cur_line == line) buf.push_back(string_data_[pos]);
-    if (string_data_[pos] == '\n') cur_line++;
+    if (cur_line == line) buf.push_back(data_[pos]);
+    if (data_[pos] == '\n') cur_line++;
     pos++;
   } while (cur_line != line + 1 && pos < len);
 
@@ -508,28 +526,28 @@ t "" 16 "Outcome 16" { 10.000000 0.000000 }
 void EFGGame::ParsePrologue() {
   // Parse the first part of the header "EFG 2 R "
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "EFG");
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "2");
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "R");
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
-  name_ = NextToken();
-  std::string token = NextToken();
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
+  name_ = std::string(NextToken());
+  absl::string_view token = NextToken();
   SPIEL_EFG_PARSE_CHECK_TRUE(token == "{");
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
   token = NextToken();
   while (token != "}") {
-    player_names_.push_back(token);
+    player_names_.push_back(std::string(token));
     token = NextToken();
   }
   num_players_ = player_names_.size();
   infoset_num_to_states_count_.resize(num_players_, {});
-  if (string_data_.at(pos_) == '"') {
-    description_ = NextToken();
+  if (data_.at(pos_) == '"') {
+    description_ = std::string(NextToken());
   }
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
-  SPIEL_EFG_PARSE_CHECK_TRUE(IsNodeToken(string_data_.at(pos_)));
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
+  SPIEL_EFG_PARSE_CHECK_TRUE(IsNodeToken(data_.at(pos_)));
 }
 
 void EFGGame::ParseChanceNode(Node* parent, Node* child, int depth) {
@@ -547,22 +565,21 @@ void EFGGame::ParseChanceNode(Node* parent, Node* child, int depth) {
   max_depth_ = std::max(max_depth_, depth);
   child->type = NodeType::kChance;
   child->parent = parent;
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
-  child->name = NextToken();
-  SPIEL_EFG_PARSE_CHECK_FALSE(string_data_.at(pos_) == '"');
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
+  child->name = std::string(NextToken());
+  SPIEL_EFG_PARSE_CHECK_FALSE(data_.at(pos_) == '"');
   SPIEL_EFG_PARSE_CHECK_TRUE(
       absl::SimpleAtoi(NextToken(), &child->infoset_number));
-  if (string_data_.at(pos_) == '"') {
-    child->infoset_name = NextToken();
+  if (data_.at(pos_) == '"') {
+    child->infoset_name = std::string(NextToken());
   }
   // I do not understand how the list of children can be optional.
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "{");
   int chance_outcomes = 0;
   double prob_sum = 0.0;
-  while (string_data_.at(pos_) == '"') {
-    std::string action_str = NextToken();
-    child->actions.push_back(action_str);
-    Action action = AddOrGetChanceOutcome(action_str);
+  while (data_.at(pos_) == '"') {
+    child->actions.push_back(std::string(NextToken()));
+    Action action = AddOrGetChanceOutcome(child->actions.back());
     child->action_ids.push_back(action);
     double prob = -1;
     SPIEL_EFG_PARSE_CHECK_TRUE(ParseDoubleValue(NextToken(), &prob));
@@ -570,8 +587,7 @@ void EFGGame::ParseChanceNode(Node* parent, Node* child, int depth) {
     SPIEL_EFG_PARSE_CHECK_LE(prob, 1.0);
     prob_sum += prob;
     child->probs.push_back(prob);
-    nodes_.push_back(NewNode());
-    child->children.push_back(nodes_.back().get());
+    child->children.push_back(NewNode());
     chance_outcomes++;
   }
   SPIEL_EFG_PARSE_CHECK_GT(child->actions.size(), 0);
@@ -603,7 +619,7 @@ void EFGGame::UpdateAndCheckInfosetMaps(const Node* node) {
             "Inconsistent infoset (player, num) -> name: ",
             static_cast<int>(player), ",", node->infoset_number, " ",
             node->infoset_name, " ", iter1->second, "\nfilename: ", filename_,
-            "\nstring data:\n", string_data_));
+            "\nstring data:\n", data_));
       }
     } else {
       std::pair<Player, int> key = {player, node->infoset_number};
@@ -632,9 +648,9 @@ void EFGGame::ParsePlayerNode(Node* parent, Node* child, int depth) {
   max_depth_ = std::max(max_depth_, depth);
   child->type = NodeType::kPlayer;
   child->parent = parent;
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
-  child->name = NextToken();
-  SPIEL_EFG_PARSE_CHECK_FALSE(string_data_.at(pos_) == '"');
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
+  child->name = std::string(NextToken());
+  SPIEL_EFG_PARSE_CHECK_FALSE(data_.at(pos_) == '"');
   SPIEL_EFG_PARSE_CHECK_TRUE(
       absl::SimpleAtoi(NextToken(), &child->player_number));
   SPIEL_EFG_PARSE_CHECK_TRUE(
@@ -646,20 +662,18 @@ void EFGGame::ParsePlayerNode(Node* parent, Node* child, int depth) {
     perfect_information_ = false;
   }
   child->infoset_name = "";
-  if (string_data_.at(pos_) == '"') {
-    child->infoset_name = NextToken();
+  if (data_.at(pos_) == '"') {
+    child->infoset_name = std::string(NextToken());
   }
   UpdateAndCheckInfosetMaps(child);
   // Do not understand how the list of actions can be optional.
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "{");
   int actions = 0;
-  while (string_data_.at(pos_) == '"') {
-    std::string action_str = NextToken();
-    child->actions.push_back(action_str);
-    Action action = AddOrGetAction(action_str);
+  while (data_.at(pos_) == '"') {
+    child->actions.push_back(std::string(NextToken()));
+    Action action = AddOrGetAction(child->actions.back());
     child->action_ids.push_back(action);
-    nodes_.push_back(NewNode());
-    child->children.push_back(nodes_.back().get());
+    child->children.push_back(NewNode());
     actions++;
   }
   SPIEL_EFG_PARSE_CHECK_GT(child->actions.size(), 0);
@@ -687,19 +701,19 @@ void EFGGame::ParseTerminalNode(Node* parent, Node* child, int depth) {
   max_depth_ = std::max(max_depth_, depth);
   child->type = NodeType::kTerminal;
   child->parent = parent;
-  SPIEL_EFG_PARSE_CHECK_EQ(string_data_.at(pos_), '"');
-  child->name = NextToken();
+  SPIEL_EFG_PARSE_CHECK_EQ(data_.at(pos_), '"');
+  child->name = std::string(NextToken());
   SPIEL_EFG_PARSE_CHECK_TRUE(
       absl::SimpleAtoi(NextToken(), &child->outcome_number));
-  if (string_data_.at(pos_) == '"') {
-    child->outcome_name = NextToken();
+  if (data_.at(pos_) == '"') {
+    child->outcome_name = std::string(NextToken());
   }
   SPIEL_EFG_PARSE_CHECK_TRUE(NextToken() == "{");
 
   int idx = 0;
   double util_sum = 0;
   bool identical = true;
-  while (string_data_.at(pos_) != '}') {
+  while (data_.at(pos_) != '}') {
     double utility = 0;
     SPIEL_EFG_PARSE_CHECK_TRUE(ParseDoubleValue(NextPayoffToken(), &utility));
     child->payoffs.push_back(utility);
@@ -744,7 +758,7 @@ void EFGGame::ParseTerminalNode(Node* parent, Node* child, int depth) {
 }
 
 void EFGGame::RecParseSubtree(Node* parent, Node* child, int depth) {
-  switch (string_data_.at(pos_)) {
+  switch (data_.at(pos_)) {
     case 'c':
       ParseChanceNode(parent, child, depth);
       break;
@@ -756,7 +770,7 @@ void EFGGame::RecParseSubtree(Node* parent, Node* child, int depth) {
       break;
     default:
       SpielFatalError(absl::StrCat("Unexpected character at pos ", pos_, ": ",
-                                   string_data_.substr(pos_, 1)));
+                                   data_.substr(pos_, 1)));
   }
 }
 
@@ -794,16 +808,20 @@ std::string EFGGame::GetInformationStateStringByNumber(Player player,
 
 void EFGGame::ParseGame() {
   // Skip any initial whitespace.
-  while (pos_ < string_data_.length() && IsWhiteSpace(string_data_.at(pos_))) {
+  while (pos_ < data_.length() && IsWhiteSpace(data_.at(pos_))) {
     AdvancePosition();
   }
-  SPIEL_EFG_PARSE_CHECK_LT(pos_, string_data_.length());
+  SPIEL_EFG_PARSE_CHECK_LT(pos_, data_.length());
 
   ParsePrologue();
-  nodes_.push_back(NewNode());
-  RecParseSubtree(nullptr, nodes_[0].get(), 0);
-  SPIEL_EFG_PARSE_CHECK_GE(pos_, string_data_.length());
+  Node* root = NewNode();
+  RecParseSubtree(nullptr, root, 0);
+  SPIEL_EFG_PARSE_CHECK_GE(pos_, data_.length());
+
+  FinalizeGameType();
+}
 
+void EFGGame::FinalizeGameType() {
   // Modify the game type.
   if (num_chance_nodes_ > 0) {
     game_type_.chance_mode = GameType::ChanceMode::kExplicitStochastic;
@@ -843,6 +861,264 @@ void EFGGame::ParseGame() {
   }
 }
 
+namespace {
+
+// Pre-parsed cache layout: an 8-byte magic, the source .efg's size (the
+// staleness check), the game-level metadata, then the node table with
+// children stored as node indices. Integers are host order; the cache is a
+// local artifact next to its .efg, not an interchange format.
+constexpr char kCacheMagic[8] = {'O', 'S', 'E', 'F', 'G', 'C', '0', '1'};
+
+template <typename T>
+void WritePod(file::File* file, const T& value) {
+  file->Write(
+      absl::string_view(reinterpret_cast<const char*>(&value), sizeof(T)));
+}
+
+void WriteString(file::File* file, const std::string& str) {
+  WritePod<int64_t>(file, str.size());
+  file->Write(str);
+}
+
+template <typename T>
+void WritePodVector(file::File* file, const std::vector<T>& values) {
+  WritePod<int64_t>(file, values.size());
+  file->Write(absl::string_view(reinterpret_cast<const char*>(values.data()),
+                                values.size() * sizeof(T)));
+}
+
+// The mapping guarantees no alignment, so all reads go through memcpy.
+template <typename T>
+T ReadPod(absl::string_view data, int64_t* offset) {
+  SPIEL_CHECK_LE(*offset + static_cast<int64_t>(sizeof(T)),
+                 static_cast<int64_t>(data.size()));
+  T value;
+  std::memcpy(&value, data.data() + *offset, sizeof(T));
+  *offset += sizeof(T);
+  return value;
+}
+
+std::string ReadString(absl::string_view data, int64_t* offset) {
+  int64_t size = ReadPod<int64_t>(data, offset);
+  SPIEL_CHECK_GE(size, 0);
+  SPIEL_CHECK_LE(*offset + size, static_cast<int64_t>(data.size()));
+  std::string str(data.data() + *offset, size);
+  *offset += size;
+  return str;
+}
+
+template <typename T>
+std::vector<T> ReadPodVector(absl::string_view data, int64_t* offset) {
+  int64_t size = ReadPod<int64_t>(data, offset);
+  SPIEL_CHECK_GE(size, 0);
+  SPIEL_CHECK_LE(*offset + size * static_cast<int64_t>(sizeof(T)),
+                 static_cast<int64_t>(data.size()));
+  std::vector<T> values(size);
+  std::memcpy(values.data(), data.data() + *offset, size * sizeof(T));
+  *offset += size * sizeof(T);
+  return values;
+}
+
+}  // namespace
+
+void EFGGame::SaveBinaryCache(const std::string& cache_filename) const {
+  file::File file(cache_filename, "wb");
+  file.Write(absl::string_view(kCacheMagic, sizeof(kCacheMagic)));
+  WritePod<int64_t>(&file, static_cast<int64_t>(data_.size()));
+
+  WriteString(&file, name_);
+  WriteString(&file, description_);
+  WritePod<int32_t>(&file, num_players_);
+  for (const std::string& player_name : player_names_) {
+    WriteString(&file, player_name);
+  }
+  WritePod<int32_t>(&file, num_chance_nodes_);
+  WritePod<int32_t>(&file, max_actions_);
+  WritePod<int32_t>(&file, max_depth_);
+  WritePod<uint8_t>(&file, constant_sum_);
+  WritePod<uint8_t>(&file, identical_payoffs_);
+  WritePod<uint8_t>(&file, general_sum_);
+  WritePod<uint8_t>(&file, perfect_information_);
+  auto write_optional = [&file](const absl::optional<double>& value) {
+    WritePod<uint8_t>(&file, value.has_value());
+    WritePod<double>(&file, value.value_or(0));
+  };
+  write_optional(util_sum_);
+  write_optional(min_util_);
+  write_optional(max_util_);
+
+  WritePod<int64_t>(&file, action_ids_.size());
+  for (const auto& [label, action] : action_ids_) {
+    WriteString(&file, label);
+    WritePod<int64_t>(&file, action);
+  }
+  WritePod<int64_t>(&file, chance_action_ids_.size());
+  for (const auto& [label, action] : chance_action_ids_) {
+    WriteString(&file, label);
+    WritePod<int64_t>(&file, action);
+  }
+  for (Player p = 0; p < num_players_; ++p) {
+    WritePod<int64_t>(&file, infoset_num_to_states_count_[p].size());
+    for (const auto& [number, count] : infoset_num_to_states_count_[p]) {
+      WritePod<int32_t>(&file, number);
+      WritePod<int32_t>(&file, count);
+    }
+  }
+  WritePod<int64_t>(&file, infoset_player_num_to_name_.size());
+  for (const auto& [key, infoset_name] : infoset_player_num_to_name_) {
+    WritePod<int32_t>(&file, key.first);
+    WritePod<int32_t>(&file, key.second);
+    WriteString(&file, infoset_name);
+  }
+  WritePod<int64_t>(&file, infoset_name_to_player_num_.size());
+  for (const auto& [infoset_name, key] : infoset_name_to_player_num_) {
+    WriteString(&file, infoset_name);
+    WritePod<int32_t>(&file, key.first);
+    WritePod<int32_t>(&file, key.second);
+  }
+
+  WritePod<int64_t>(&file, static_cast<int64_t>(nodes_.size()));
+  for (const Node& node : nodes_) {
+    WritePod<uint8_t>(&file, static_cast<uint8_t>(node.type));
+    WriteString(&file, node.name);
+    WritePod<int32_t>(&file, node.infoset_number);
+    WritePod<int32_t>(&file, node.player_number);
+    WriteString(&file, node.infoset_name);
+    WriteString(&file, node.outcome_name);
+    WritePod<int32_t>(&file, node.outcome_number);
+    WritePod<int64_t>(&file, node.actions.size());
+    for (const std::string& action : node.actions) {
+      WriteString(&file, action);
+    }
+    WritePodVector(&file, node.action_ids);
+    std::vector<int64_t> child_ids;
+    child_ids.reserve(node.children.size());
+    for (const Node* child : node.children) {
+      child_ids.push_back(child->id);
+    }
+    WritePodVector(&file, child_ids);
+    WritePodVector(&file, node.probs);
+    WritePodVector(&file, node.payoffs);
+  }
+  file.Flush();
+}
+
+bool EFGGame::LoadBinaryCache(const std::string& cache_filename) {
+  file::MappedFile cache(cache_filename);
+  absl::string_view data = cache.view();
+  if (data.size() < sizeof(kCacheMagic) + sizeof(int64_t)) {
+    return false;
+  }
+  if (std::memcmp(data.data(), kCacheMagic, sizeof(kCacheMagic)) != 0) {
+    return false;
+  }
+  int64_t offset = sizeof(kCacheMagic);
+  if (ReadPod<int64_t>(data, &offset) != static_cast<int64_t>(data_.size())) {
+    return false;  // Stale: built from a source file of a different size.
+  }
+
+  name_ = ReadString(data, &offset);
+  description_ = ReadString(data, &offset);
+  num_players_ = ReadPod<int32_t>(data, &offset);
+  SPIEL_CHECK_GT(num_players_, 0);
+  player_names_.clear();
+  player_names_.reserve(num_players_);
+  for (int p = 0; p < num_players_; ++p) {
+    player_names_.push_back(ReadString(data, &offset));
+  }
+  num_chance_nodes_ = ReadPod<int32_t>(data, &offset);
+  max_actions_ = ReadPod<int32_t>(data, &offset);
+  max_depth_ = ReadPod<int32_t>(data, &offset);
+  constant_sum_ = ReadPod<uint8_t>(data, &offset) != 0;
+  identical_payoffs_ = ReadPod<uint8_t>(data, &offset) != 0;
+  general_sum_ = ReadPod<uint8_t>(data, &offset) != 0;
+  perfect_information_ = ReadPod<uint8_t>(data, &offset) != 0;
+  auto read_optional = [&data, &offset]() -> absl::optional<double> {
+    bool has_value = ReadPod<uint8_t>(data, &offset) != 0;
+    double value = ReadPod<double>(data, &offset);
+    if (has_value) return value;
+    return absl::nullopt;
+  };
+  util_sum_ = read_optional();
+  min_util_ = read_optional();
+  max_util_ = read_optional();
+
+  int64_t num_actions = ReadPod<int64_t>(data, &offset);
+  action_ids_.clear();
+  action_ids_.reserve(num_actions);
+  for (int64_t i = 0; i < num_actions; ++i) {
+    std::string label = ReadString(data, &offset);
+    action_ids_[label] = ReadPod<int64_t>(data, &offset);
+  }
+  int64_t num_chance_actions = ReadPod<int64_t>(data, &offset);
+  chance_action_ids_.clear();
+  chance_action_ids_.reserve(num_chance_actions);
+  for (int64_t i = 0; i < num_chance_actions; ++i) {
+    std::string label = ReadString(data, &offset);
+    chance_action_ids_[label] = ReadPod<int64_t>(data, &offset);
+  }
+  infoset_num_to_states_count_.assign(num_players_, {});
+  for (Player p = 0; p < num_players_; ++p) {
+    int64_t num_infosets = ReadPod<int64_t>(data, &offset);
+    infoset_num_to_states_count_[p].reserve(num_infosets);
+    for (int64_t i = 0; i < num_infosets; ++i) {
+      int32_t number = ReadPod<int32_t>(data, &offset);
+      infoset_num_to_states_count_[p][number] = ReadPod<int32_t>(data, &offset);
+    }
+  }
+  int64_t num_names = ReadPod<int64_t>(data, &offset);
+  infoset_player_num_to_name_.clear();
+  infoset_player_num_to_name_.reserve(num_names);
+  for (int64_t i = 0; i < num_names; ++i) {
+    Player player = ReadPod<int32_t>(data, &offset);
+    int number = ReadPod<int32_t>(data, &offset);
+    infoset_player_num_to_name_[{player, number}] = ReadString(data, &offset);
+  }
+  num_names = ReadPod<int64_t>(data, &offset);
+  infoset_name_to_player_num_.clear();
+  infoset_name_to_player_num_.reserve(num_names);
+  for (int64_t i = 0; i < num_names; ++i) {
+    std::string infoset_name = ReadString(data, &offset);
+    Player player = ReadPod<int32_t>(data, &offset);
+    int number = ReadPod<int32_t>(data, &offset);
+    infoset_name_to_player_num_[infoset_name] = {player, number};
+  }
+
+  int64_t num_nodes = ReadPod<int64_t>(data, &offset);
+  SPIEL_CHECK_GT(num_nodes, 0);
+  nodes_.clear();
+  nodes_.resize(num_nodes);  // All nodes exist before children are linked.
+  for (int64_t i = 0; i < num_nodes; ++i) {
+    Node& node = nodes_[i];
+    node.id = i;
+    node.type = static_cast<NodeType>(ReadPod<uint8_t>(data, &offset));
+    node.name = ReadString(data, &offset);
+    node.infoset_number = ReadPod<int32_t>(data, &offset);
+    node.player_number = ReadPod<int32_t>(data, &offset);
+    node.infoset_name = ReadString(data, &offset);
+    node.outcome_name = ReadString(data, &offset);
+    node.outcome_number = ReadPod<int32_t>(data, &offset);
+    int64_t node_actions = ReadPod<int64_t>(data, &offset);
+    node.actions.reserve(node_actions);
+    for (int64_t a = 0; a < node_actions; ++a) {
+      node.actions.push_back(ReadString(data, &offset));
+    }
+    node.action_ids = ReadPodVector<Action>(data, &offset);
+    std::vector<int64_t> child_ids = ReadPodVector<int64_t>(data, &offset);
+    node.children.reserve(child_ids.size());
+    for (int64_t child_id : child_ids) {
+      SPIEL_CHECK_GE(child_id, 0);
+      SPIEL_CHECK_LT(child_id, num_nodes);
+      node.children.push_back(&nodes_[child_id]);
+      nodes_[child_id].parent = &node;
+    }
+    node.probs = ReadPodVector<double>(data, &offset);
+    node.payoffs = ReadPodVector<double>(data, &offset);
+  }
+  SPIEL_CHECK_EQ(offset, static_cast<int64_t>(data.size()));
+  return true;
+}
+
 TabularPolicy EFGGameTabularPolicy(
     std::shared_ptr<const Game> game,
     const absl::flat_hash_map<std::pair<Player, std::string>,
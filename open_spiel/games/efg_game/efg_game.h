@@ -15,22 +15,36 @@
 #ifndef OPEN_SPIEL_GAMES_EFG_GAME_H_
 #define OPEN_SPIEL_GAMES_EFG_GAME_H_
 
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/game_parameters.h"
 #include "open_spiel/policy.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
 
 // A parser for the .efg format used by Gambit:
 // http://www.gambit-project.org/gambit14/formats.html
 //
 // Parameters:
-//       "filename"   string     name of a file containing the data
+//       "filename"      string   name of a file containing the data
+//       "binary_cache"  bool     maintain a pre-parsed cache next to the
+//                                .efg file (default: false)
+//
+// Files are mmap'ed and tokenized in place, so loading is a single pass that
+// never holds a second copy of the text. With binary_cache=true, the parsed
+// tree is additionally written to "<filename>.bin" after the first load and
+// subsequent loads read that file directly, skipping the text parse entirely.
+// The cache records the source file's size and is re-built when it no longer
+// matches; delete the .bin after editing an .efg in a way that preserves its
+// size, or if it is ever truncated mid-write.
 //
 // Note: not the full EFG is supported as stated on that page. In particular:
 //   - Payoffs / outcomes at non-terminal nodes are not supported
@@ -111,7 +125,7 @@ class EFGGame : public Game {
   explicit EFGGame(const std::string& data);
   std::unique_ptr<State> NewInitialState() const override {
     return std::unique_ptr<State>(
-        new EFGState(shared_from_this(), nodes_[0].get()));
+        new EFGState(shared_from_this(), &nodes_.front()));
   }
 
   int MaxChanceOutcomes() const override;
@@ -177,14 +191,14 @@ class EFGGame : public Game {
   }
 
  private:
-  std::unique_ptr<Node> NewNode() const;
+  Node* NewNode();
   void ParseGame();
   void ParsePrologue();
-  std::string NextPayoffToken();
-  std::string NextToken();
+  absl::string_view NextPayoffToken();
+  absl::string_view NextToken();
   void AdvancePosition();
   std::string GetLine(int line) const;
-  bool ParseDoubleValue(const std::string& str, double* value) const;
+  bool ParseDoubleValue(absl::string_view str, double* value) const;
   bool IsWhiteSpace(char c) const;
   bool IsNodeToken(char c) const;
   void UpdateAndCheckInfosetMaps(const Node* node);
@@ -192,13 +206,23 @@ class EFGGame : public Game {
   void ParsePlayerNode(Node* parent, Node* child, int depth);
   void ParseTerminalNode(Node* parent, Node* child, int depth);
   void RecParseSubtree(Node* parent, Node* child, int depth);
+  void FinalizeGameType();
+  // Pre-parsed cache: returns false when the cache is missing or was built
+  // from a source file of a different size (stale).
+  bool LoadBinaryCache(const std::string& cache_filename);
+  void SaveBinaryCache(const std::string& cache_filename) const;
   std::string PrettyTree(const Node* node, const std::string& indent) const;
 
   std::string filename_;
+  // The text is either mmap'ed from filename_ or owned by string_data_ (when
+  // loaded from a string); data_ views whichever holds it.
+  absl::optional<file::MappedFile> mapped_file_;
   std::string string_data_;
-  int pos_;
+  absl::string_view data_;
+  int64_t pos_;
   int line_ = 1;
-  std::vector<std::unique_ptr<Node>> nodes_;
+  // Chunk-allocated arena; Node pointers stay stable as the deque grows.
+  std::deque<Node> nodes_;
   std::string name_;
   std::string description_;
   std::vector<std::string> player_names_;
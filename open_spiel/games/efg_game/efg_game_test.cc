@@ -22,6 +22,7 @@
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/tests/basic_tests.h"
+#include "open_spiel/utils/file.h"
 #include "open_spiel/utils/init.h"
 
 namespace open_spiel {
@@ -142,6 +143,42 @@ void EFGGameSimTestsKuhnFromFile() {
   }
 }
 
+void EFGGameBinaryCacheRoundTrip() {
+  absl::optional<std::string> file = FindFile(kKuhnFilename, 2);
+  if (file == absl::nullopt) return;
+  // Copy into tmp so the cache is written somewhere disposable.
+  std::string efg_filename = file::GetTmpDir() + "/efg_cache_test.efg";
+  std::string cache_filename = efg_filename + ".bin";
+  file::WriteContentsToFile(efg_filename, "w",
+                            file::ReadContentsFromFile(file.value(), "r"));
+  if (file::Exists(cache_filename)) file::Remove(cache_filename);
+
+  // First load parses the text and writes the cache.
+  std::shared_ptr<const Game> parsed =
+      LoadGame("efg_game", {{"filename", GameParameter(efg_filename)},
+                            {"binary_cache", GameParameter(true)}});
+  SPIEL_CHECK_TRUE(file::Exists(cache_filename));
+
+  // Second load reads the cache; the game must be indistinguishable.
+  std::shared_ptr<const Game> cached =
+      LoadGame("efg_game", {{"filename", GameParameter(efg_filename)},
+                            {"binary_cache", GameParameter(true)}});
+  SPIEL_CHECK_EQ(parsed->GetType().utility, cached->GetType().utility);
+  SPIEL_CHECK_EQ(parsed->GetType().information, cached->GetType().information);
+  SPIEL_CHECK_EQ(parsed->GetType().chance_mode, cached->GetType().chance_mode);
+  SPIEL_CHECK_EQ(parsed->NumDistinctActions(), cached->NumDistinctActions());
+  SPIEL_CHECK_EQ(parsed->MaxChanceOutcomes(), cached->MaxChanceOutcomes());
+  SPIEL_CHECK_EQ(parsed->MaxGameLength(), cached->MaxGameLength());
+  SPIEL_CHECK_TRUE(Near(parsed->MinUtility(), cached->MinUtility()));
+  SPIEL_CHECK_TRUE(Near(parsed->MaxUtility(), cached->MaxUtility()));
+  SPIEL_CHECK_EQ(parsed->NewInitialState()->ToString(),
+                 cached->NewInitialState()->ToString());
+  testing::RandomSimTest(*cached, 10);
+
+  file::Remove(cache_filename);
+  file::Remove(efg_filename);
+}
+
 void EFGGameSimTestsLeducFromFile() {
   absl::optional<std::string> file = FindFile(kLeducFilename, 2);
   if (file != absl::nullopt) {
@@ -212,6 +249,7 @@ int main(int argc, char** argv) {
   open_spiel::efg_game::EFGGameCommasFromFile();
   open_spiel::efg_game::EFGGameSimTestsSampleFromFile();
   open_spiel::efg_game::EFGGameSimTestsKuhnFromFile();
+  open_spiel::efg_game::EFGGameBinaryCacheRoundTrip();
   open_spiel::efg_game::EFGGameSimTestsLeducFromFile();
   open_spiel::efg_game::EFGGameSimTestsSignalingFromData();
   open_spiel::efg_game::EFGGameSimTestsSignalingFromFile();
@@ -14,6 +14,10 @@
 
 #include "open_spiel/games/gin_rummy/gin_rummy.h"
 
+#include <algorithm>
+#include <random>
+#include <set>
+
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
 #include "open_spiel/games/gin_rummy/gin_rummy_utils.h"
 #include "open_spiel/observer.h"
@@ -128,6 +132,64 @@ void MeldTests() {
   SPIEL_CHECK_EQ(deadwood, 3);
 }
 
+// Cross-checks the bitmask meld tables against the combinatorial meld group
+// enumeration they replaced.
+void MeldTableTests() {
+  GinRummyUtils utils = GinRummyUtils(kDefaultNumRanks, kDefaultNumSuits,
+                                      kDefaultHandSize);
+  // Best melded value over all meld groups, computed by enumeration.
+  auto enumerated_best = [&utils](const std::vector<int> &hand) {
+    int best = 0;
+    for (const auto &meld_group : utils.AllMeldGroups(hand)) {
+      best = std::max(best, utils.TotalCardValue(meld_group));
+    }
+    return best;
+  };
+  std::vector<int> deck;
+  for (int i = 0; i < utils.num_cards; ++i) deck.push_back(i);
+  std::mt19937 rng(2375);
+  for (int trial = 0; trial < 25; ++trial) {
+    std::shuffle(deck.begin(), deck.end(), rng);
+    // A dealt hand and a hand holding a freshly drawn card.
+    std::vector<int> hand(deck.begin(), deck.begin() + kDefaultHandSize);
+    std::vector<int> drawn_hand(deck.begin(),
+                                deck.begin() + kDefaultHandSize + 1);
+    int best_value = enumerated_best(hand);
+    SPIEL_CHECK_EQ(utils.BestMeldedValue(utils.CardsToMask(hand)), best_value);
+    SPIEL_CHECK_EQ(utils.MinDeadwood(hand),
+                   utils.TotalCardValue(hand) - best_value);
+    // BestMeldGroup must achieve the best value using melds from the hand.
+    std::vector<std::vector<int>> meld_group = utils.BestMeldGroup(hand);
+    SPIEL_CHECK_EQ(utils.TotalCardValue(meld_group), best_value);
+    for (const auto &meld : meld_group) {
+      SPIEL_CHECK_EQ(utils.meld_to_int.count(meld), 1);
+    }
+    // An 11 card hand discards the card minimizing the remaining deadwood.
+    int min_deadwood = utils.TotalCardValue(drawn_hand);
+    for (int i = 0; i < drawn_hand.size(); ++i) {
+      std::vector<int> remaining = drawn_hand;
+      remaining.erase(remaining.begin() + i);
+      min_deadwood = std::min(min_deadwood, utils.TotalCardValue(remaining) -
+                                                enumerated_best(remaining));
+    }
+    SPIEL_CHECK_EQ(utils.MinDeadwood(drawn_hand), min_deadwood);
+    // Legal melds agree with the definition over enumerated meld groups.
+    const int knock_card = 10;
+    std::set<int> expected_melds;
+    int total_hand_value = utils.TotalCardValue(drawn_hand);
+    for (const auto &meld_group : utils.AllMeldGroups(drawn_hand)) {
+      if (total_hand_value - utils.TotalCardValue(meld_group) <= knock_card) {
+        for (const auto &meld : meld_group) {
+          expected_melds.insert(utils.meld_to_int.at(meld));
+        }
+      }
+    }
+    SPIEL_CHECK_EQ(
+        utils.LegalMelds(drawn_hand, knock_card),
+        std::vector<int>(expected_melds.begin(), expected_melds.end()));
+  }
+}
+
 // An extremely rare situation, but one that does arise in actual gameplay.
 // Tests both layoff and undercut functionality.
 void GameplayTest1() {
@@ -597,6 +659,7 @@ void DeckSizeTests() {
 int main(int argc, char** argv) {
   open_spiel::gin_rummy::BasicGameTests();
   open_spiel::gin_rummy::MeldTests();
+  open_spiel::gin_rummy::MeldTableTests();
   open_spiel::gin_rummy::GameplayTest1();
   open_spiel::gin_rummy::GameplayTest2();
   open_spiel::gin_rummy::GameplayTest3();
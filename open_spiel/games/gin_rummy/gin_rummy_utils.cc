@@ -15,14 +15,40 @@
 #include "open_spiel/games/gin_rummy/gin_rummy_utils.h"
 
 #include <algorithm>
+#include <map>
+#include <memory>
 #include <set>
 #include <utility>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 #include "open_spiel/spiel.h"
 
 namespace open_spiel {
 namespace gin_rummy {
+namespace {
+
+// Upper bound on the number of cached hand masks. At ~64 bytes per entry
+// this caps the cache at a few tens of MB.
+constexpr int kMeldedValueCacheSize = 1 << 18;
+
+// Returns the melded value cache for the given deck, creating it on first
+// use. All utils instances built for the same deck share one cache, so the
+// table of evaluated hands is built once per process and shared.
+std::shared_ptr<LRUCache<uint64_t, int>> SharedMeldedValueCache(int num_ranks,
+                                                               int num_suits) {
+  static absl::Mutex mutex;
+  static auto *caches = new std::map<std::pair<int, int>,
+                                     std::shared_ptr<LRUCache<uint64_t, int>>>;
+  absl::MutexLock lock(&mutex);
+  auto &cache = (*caches)[{num_ranks, num_suits}];
+  if (cache == nullptr) {
+    cache = std::make_shared<LRUCache<uint64_t, int>>(kMeldedValueCacheSize);
+  }
+  return cache;
+}
+
+}  // namespace
 
 GinRummyUtils::GinRummyUtils(int num_ranks, int num_suits, int hand_size) :
       num_ranks(num_ranks),
@@ -32,7 +58,9 @@ GinRummyUtils::GinRummyUtils(int num_ranks, int num_suits, int hand_size) :
       suit_comp(SuitComparator(num_ranks)),
       rank_comp(RankComparator(num_ranks)),
       int_to_meld(BuildIntToMeldMap()),
-      meld_to_int(BuildMeldToIntMap()) {
+      meld_to_int(BuildMeldToIntMap()),
+      meld_entries(BuildMeldEntries()),
+      melded_value_cache(SharedMeldedValueCache(num_ranks, num_suits)) {
 }
 
 int GinRummyUtils::CardSuit(int card) const { return card / num_ranks; }
@@ -298,18 +326,72 @@ VecVecVecInt GinRummyUtils::AllMeldGroups(const VecInt &cards) const {
   return all_meld_groups;
 }
 
+uint64_t GinRummyUtils::CardsToMask(const VecInt &cards) const {
+  uint64_t mask = 0;
+  for (int card : cards) mask |= uint64_t{1} << card;
+  return mask;
+}
+
+// Maximum total card value that can be arranged into melds, i.e. the hand
+// value minus the minimum deadwood. Cached by hand mask; on a miss the
+// search below runs over the precomputed meld table.
+int GinRummyUtils::BestMeldedValue(uint64_t hand_mask) const {
+  absl::optional<const int> cached = melded_value_cache->Get(hand_mask);
+  if (cached.has_value()) return *cached;
+  // Candidate melds are those formed entirely from cards in the hand.
+  std::vector<int> candidates;
+  for (int i = 0; i < meld_entries.size(); ++i) {
+    if ((meld_entries[i].mask & hand_mask) == meld_entries[i].mask) {
+      candidates.push_back(i);
+    }
+  }
+  absl::flat_hash_map<uint64_t, int> memo;
+  int value = BestMeldedValueSearch(hand_mask, candidates, &memo);
+  melded_value_cache->Set(hand_mask, value);
+  return value;
+}
+
+// Depth first search over subsets of candidate melds. The memo is keyed on
+// the remaining card mask, so overlapping meld groups are only explored once.
+int GinRummyUtils::BestMeldedValueSearch(
+    uint64_t mask, const std::vector<int> &candidates,
+    absl::flat_hash_map<uint64_t, int> *memo) const {
+  auto iter = memo->find(mask);
+  if (iter != memo->end()) return iter->second;
+  int best_value = 0;
+  for (int i : candidates) {
+    const MeldEntry &entry = meld_entries[i];
+    if ((entry.mask & mask) != entry.mask) continue;
+    best_value = std::max(
+        best_value, entry.value + BestMeldedValueSearch(mask ^ entry.mask,
+                                                        candidates, memo));
+  }
+  (*memo)[mask] = best_value;
+  return best_value;
+}
+
 // "Best" means any meld group that achieves the lowest possible deadwood
 // count for the given cards. In general this is non-unique.
 VecVecInt GinRummyUtils::BestMeldGroup(const VecInt &cards) const {
-  int best_meld_group_total_value = 0;
   VecVecInt best_meld_group;
-  VecVecVecInt all_meld_groups = AllMeldGroups(cards);
-  for (const auto &meld_group : all_meld_groups) {
-    int meld_group_total_value = TotalCardValue(meld_group);
-    if (meld_group_total_value > best_meld_group_total_value) {
-      best_meld_group_total_value = meld_group_total_value;
-      best_meld_group = meld_group;
+  uint64_t mask = CardsToMask(cards);
+  int remaining_value = BestMeldedValue(mask);
+  // Peel off one meld at a time, keeping only melds consistent with the
+  // best achievable value of the cards that remain.
+  while (remaining_value > 0) {
+    bool found = false;
+    for (const MeldEntry &entry : meld_entries) {
+      if ((entry.mask & mask) != entry.mask) continue;
+      if (entry.value + BestMeldedValue(mask ^ entry.mask) ==
+          remaining_value) {
+        best_meld_group.push_back(entry.cards);
+        mask ^= entry.mask;
+        remaining_value -= entry.value;
+        found = true;
+        break;
+      }
     }
+    SPIEL_CHECK_TRUE(found);
   }
   return best_meld_group;
 }
@@ -322,23 +404,20 @@ int GinRummyUtils::MinDeadwood(VecInt hand, absl::optional<int> card) const {
 
 // Minimum deadwood count over all meld groups.
 int GinRummyUtils::MinDeadwood(const VecInt &hand) const {
-  VecInt deadwood = hand;
-  VecVecInt best_melds = BestMeldGroup(hand);
-
-  for (const auto &meld : best_melds) {
-    for (auto card : meld) {
-      deadwood.erase(std::remove(deadwood.begin(), deadwood.end(), card),
-                     deadwood.end());
-    }
-  }
-  // If we have just drawn a card, we can discard the one worth the most points.
-  if (hand.size() == hand_size + 1 && !deadwood.empty()) {
-    absl::c_sort(deadwood, rank_comp);
-    deadwood.pop_back();
-  }
-  int deadwood_total = 0;
-  for (int card : deadwood) deadwood_total += CardValue(card);
-  return deadwood_total;
+  uint64_t hand_mask = CardsToMask(hand);
+  int total_hand_value = TotalCardValue(hand);
+  if (hand.size() != hand_size + 1) {
+    return total_hand_value - BestMeldedValue(hand_mask);
+  }
+  // If we have just drawn a card, we can discard the one worth the most
+  // points, so take the minimum over all possible discards.
+  int min_deadwood = total_hand_value;
+  for (int card : hand) {
+    int deadwood = total_hand_value - CardValue(card) -
+                   BestMeldedValue(hand_mask ^ (uint64_t{1} << card));
+    min_deadwood = std::min(min_deadwood, deadwood);
+  }
+  return min_deadwood;
 }
 
 // Returns the unique card that can be layed off on a given 3-card rank meld.
@@ -374,15 +453,16 @@ VecInt GinRummyUtils::SuitMeldLayoffs(const VecInt &meld) const {
 // Returns vector of meld_ids (see MeldToInt).
 VecInt GinRummyUtils::LegalMelds(const VecInt &hand, int knock_card) const {
   int total_hand_value = TotalCardValue(hand);
+  uint64_t hand_mask = CardsToMask(hand);
   std::set<int> meld_set;
-  VecInt hand_(hand);
-  VecVecVecInt all_meld_groups = AllMeldGroups(hand_);
-  for (const auto &meld_group : all_meld_groups) {
-    int meld_group_total_value = TotalCardValue(meld_group);
-    if (total_hand_value - meld_group_total_value <= knock_card) {
-      for (const auto &meld : meld_group) {
-        meld_set.insert(meld_to_int.at(meld));
-      }
+  // A meld is legal iff some meld group containing it leaves at most
+  // knock_card deadwood, i.e. the meld's value plus the best melded value of
+  // the remaining cards reaches the required total.
+  for (const MeldEntry &entry : meld_entries) {
+    if ((entry.mask & hand_mask) != entry.mask) continue;
+    if (total_hand_value - entry.value -
+            BestMeldedValue(hand_mask ^ entry.mask) <= knock_card) {
+      meld_set.insert(entry.id);
     }
   }
   return VecInt(meld_set.begin(), meld_set.end());
@@ -462,6 +542,24 @@ std::map<int, VecInt> GinRummyUtils::BuildIntToMeldMap() const {
   return rv;
 }
 
+// Builds the bitmask meld table from meld_to_int. Only melds that can
+// actually be formed from the deck appear; their ids are still the canonical
+// 52-card ids.
+std::vector<MeldEntry> GinRummyUtils::BuildMeldEntries() const {
+  SPIEL_CHECK_LE(num_cards, 64);  // Card masks are stored in a uint64_t.
+  std::vector<MeldEntry> entries;
+  entries.reserve(meld_to_int.size());
+  for (const auto &meld_and_id : meld_to_int) {
+    MeldEntry entry;
+    entry.mask = CardsToMask(meld_and_id.first);
+    entry.value = TotalCardValue(meld_and_id.first);
+    entry.id = meld_and_id.second;
+    entry.cards = meld_and_id.first;
+    entries.push_back(entry);
+  }
+  return entries;
+}
+
 // Defines a mapping from melds to ints.
 // There are 185 distinct melds in total, 65 rank melds and 120 suit melds.
 // Rank melds are ordered by ascending rank. For each rank, there are 5 melds.
@@ -15,11 +15,15 @@
 #ifndef OPEN_SPIEL_GAMES_GIN_RUMMY_UTILS_H_
 #define OPEN_SPIEL_GAMES_GIN_RUMMY_UTILS_H_
 
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
 #include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/utils/lru_cache.h"
 
 namespace open_spiel {
 namespace gin_rummy {
@@ -53,6 +57,15 @@ struct RankComparator {
 };
 
 
+// Precomputed per-meld lookup data. One entry per meld that can be formed
+// from the deck, in meld_to_int key order.
+struct MeldEntry {
+  uint64_t mask;  // Bitmask over card ints (bit i set <=> card i in meld).
+  int value;      // Sum of the card values in the meld.
+  int id;         // Canonical meld id (see MeldToInt).
+  VecInt cards;   // The meld itself, usable as a key into meld_to_int.
+};
+
 struct GinRummyUtils {
   GinRummyUtils(int num_ranks, int num_suits, int hand_size);
 
@@ -68,6 +81,16 @@ struct GinRummyUtils {
   const std::map<int, VecInt> int_to_meld;
   const std::map<VecInt, int> meld_to_int;
 
+  // Bitmask meld table, built once per deck in the constructor. Hand
+  // evaluation tests card bitmasks against these entries instead of
+  // re-enumerating meld groups combinatorially.
+  const std::vector<MeldEntry> meld_entries;
+
+  // Maps a hand mask to the best total card value meldable from it. Shared
+  // by every utils instance built for the same deck, so repeated hand
+  // evaluations across states and bots reduce to a cache lookup.
+  const std::shared_ptr<LRUCache<uint64_t, int>> melded_value_cache;
+
   std::string CardString(absl::optional<int> card) const;
   std::string HandToString(const VecInt &cards) const;
 
@@ -99,6 +122,12 @@ struct GinRummyUtils {
 
   VecVecVecInt AllMeldGroups(const VecInt &cards) const;
 
+  uint64_t CardsToMask(const VecInt &cards) const;
+
+  int BestMeldedValue(uint64_t hand_mask) const;
+  int BestMeldedValueSearch(uint64_t mask, const std::vector<int> &candidates,
+                            absl::flat_hash_map<uint64_t, int> *memo) const;
+
   VecVecInt BestMeldGroup(const VecInt &cards) const;
 
   int MinDeadwood(VecInt hand, absl::optional<int> card) const;
@@ -117,6 +146,7 @@ struct GinRummyUtils {
 
   std::map<VecInt, int> BuildMeldToIntMap() const;
   std::map<int, VecInt> BuildIntToMeldMap() const;
+  std::vector<MeldEntry> BuildMeldEntries() const;
 };
 
 }  // namespace gin_rummy
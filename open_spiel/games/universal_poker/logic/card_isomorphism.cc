@@ -0,0 +1,93 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/games/universal_poker/logic/card_isomorphism.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "open_spiel/utils/lru_cache.h"
+
+namespace open_spiel {
+namespace universal_poker {
+namespace logic {
+namespace {
+
+// Sized so that the full reachable set of canonical boards in typical
+// abstractions stays resident; ~16 bytes per entry.
+constexpr int kRankCacheSize = 1 << 20;
+
+// All games share one cache: entries are keyed by the canonical 64-bit
+// Cardset word, which already encodes the deck layout.
+LRUCache<uint64_t, int>* RankCardsCache() {
+  static LRUCache<uint64_t, int>* cache =
+      new LRUCache<uint64_t, int>(kRankCacheSize);
+  return cache;
+}
+
+}  // namespace
+
+SuitPermutation CanonicalSuitPermutation(const CardSet& primary,
+                                         const CardSet& secondary) {
+  std::array<int, kMaxSuits> order = {0, 1, 2, 3};
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    if (primary.cs.bySuit[a] != primary.cs.bySuit[b]) {
+      return primary.cs.bySuit[a] > primary.cs.bySuit[b];
+    }
+    return secondary.cs.bySuit[a] > secondary.cs.bySuit[b];
+  });
+  SuitPermutation perm;
+  for (int i = 0; i < kMaxSuits; ++i) perm[order[i]] = i;
+  return perm;
+}
+
+CardSet ApplySuitPermutation(const CardSet& cards,
+                             const SuitPermutation& perm) {
+  CardSet permuted;
+  for (int s = 0; s < kMaxSuits; ++s) {
+    permuted.cs.bySuit[perm[s]] = cards.cs.bySuit[s];
+  }
+  return permuted;
+}
+
+CardSet CanonicalizeSuits(const CardSet& cards) {
+  return ApplySuitPermutation(cards,
+                              CanonicalSuitPermutation(cards, CardSet()));
+}
+
+std::pair<CardSet, CardSet> CanonicalizeSuits(const CardSet& hole,
+                                              const CardSet& board) {
+  SuitPermutation perm = CanonicalSuitPermutation(hole, board);
+  return {ApplySuitPermutation(hole, perm),
+          ApplySuitPermutation(board, perm)};
+}
+
+int CachedRankCards(const CardSet& cards) {
+  const uint64_t key = CanonicalizeSuits(cards).cs.cards;
+  LRUCache<uint64_t, int>* cache = RankCardsCache();
+  absl::optional<const int> cached = cache->Get(key);
+  if (cached) return *cached;
+  // Rank the canonical form rather than the input: the ACPC tables give equal
+  // ranks either way, and doing so keeps the cached value independent of
+  // which class member happened to miss first.
+  CardSet canonical;
+  canonical.cs.cards = key;
+  int rank = canonical.RankCards();
+  cache->Set(key, rank);
+  return rank;
+}
+
+}  // namespace logic
+}  // namespace universal_poker
+}  // namespace open_spiel
@@ -0,0 +1,68 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_GAMES_UNIVERSAL_POKER_LOGIC_CARD_ISOMORPHISM_H_
+#define OPEN_SPIEL_GAMES_UNIVERSAL_POKER_LOGIC_CARD_ISOMORPHISM_H_
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "open_spiel/games/universal_poker/logic/card_set.h"
+
+// Suit-isomorphism canonicalization for poker card sets. Relabeling the suits
+// of a deal changes neither its hand rankings nor its strategic content, so
+// deals that differ only by a suit permutation can share infostate buckets
+// and hand evaluations. Canonicalization picks one representative per
+// isomorphism class: the suits are reordered so that their 16-bit rank masks
+// are non-increasing (hole cards first, board cards breaking ties for the
+// joint form). Two deals are suit-isomorphic iff their canonical forms are
+// equal.
+
+namespace open_spiel {
+namespace universal_poker {
+namespace logic {
+
+// A suit relabeling: perm[original_suit] is the suit it maps to.
+using SuitPermutation = std::array<uint8_t, kMaxSuits>;
+
+// Returns the permutation that canonicalizes `primary`, using `secondary` to
+// break ties between suits with equal masks in `primary`. Suits tied in both
+// sets keep their relative order; any such tie is harmless because the tied
+// suits are indistinguishable in both sets.
+SuitPermutation CanonicalSuitPermutation(const CardSet& primary,
+                                         const CardSet& secondary);
+
+// Returns `cards` with every card's suit relabeled by `perm`.
+CardSet ApplySuitPermutation(const CardSet& cards, const SuitPermutation& perm);
+
+// Canonicalizes a single card set.
+CardSet CanonicalizeSuits(const CardSet& cards);
+
+// Jointly canonicalizes a (hole, board) pair under one shared permutation,
+// which is what infostate bucketing needs: the pair is the representative of
+// all deals reachable from it by relabeling suits.
+std::pair<CardSet, CardSet> CanonicalizeSuits(const CardSet& hole,
+                                              const CardSet& board);
+
+// RankCards memoized on the canonical form, in a cache shared by all callers
+// (thread-safe). Since the ACPC ranking is suit-permutation invariant, one
+// entry serves every isomorphic combination.
+int CachedRankCards(const CardSet& cards);
+
+}  // namespace logic
+}  // namespace universal_poker
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_GAMES_UNIVERSAL_POKER_LOGIC_CARD_ISOMORPHISM_H_
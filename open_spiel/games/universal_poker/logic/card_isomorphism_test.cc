@@ -0,0 +1,90 @@
+// Copyright 2019 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/games/universal_poker/logic/card_isomorphism.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/games/universal_poker/logic/card_set.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace universal_poker {
+namespace logic {
+
+// Every suit relabeling of a set must land on the same canonical form, and
+// that form must be a member of the class (same ranks per card count).
+void CanonicalInvarianceTests() {
+  std::mt19937 rng(2375);
+  CardSet deck(/*num_suits=*/4, /*num_ranks=*/13);
+  std::vector<uint8_t> cards = deck.ToCardArray();
+  for (int trial = 0; trial < 50; ++trial) {
+    std::shuffle(cards.begin(), cards.end(), rng);
+    CardSet hole, board;
+    for (int i = 0; i < 2; ++i) hole.AddCard(cards[i]);
+    for (int i = 2; i < 7; ++i) board.AddCard(cards[i]);
+
+    std::pair<CardSet, CardSet> canonical = CanonicalizeSuits(hole, board);
+    SuitPermutation perm = {0, 1, 2, 3};
+    do {
+      CardSet permuted_hole = ApplySuitPermutation(hole, perm);
+      CardSet permuted_board = ApplySuitPermutation(board, perm);
+      std::pair<CardSet, CardSet> permuted_canonical =
+          CanonicalizeSuits(permuted_hole, permuted_board);
+      SPIEL_CHECK_EQ(permuted_canonical.first.cs.cards,
+                     canonical.first.cs.cards);
+      SPIEL_CHECK_EQ(permuted_canonical.second.cs.cards,
+                     canonical.second.cs.cards);
+      // Single-set canonicalization is invariant too.
+      SPIEL_CHECK_EQ(CanonicalizeSuits(permuted_board).cs.cards,
+                     CanonicalizeSuits(board).cs.cards);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+
+    SPIEL_CHECK_EQ(canonical.first.NumCards(), hole.NumCards());
+    SPIEL_CHECK_EQ(canonical.second.NumCards(), board.NumCards());
+  }
+}
+
+// The cached rank must match a direct evaluation, for the set itself and for
+// every suit relabeling of it (they share one cache entry).
+void CachedRankCardsTests() {
+  std::mt19937 rng(17);
+  CardSet deck(/*num_suits=*/4, /*num_ranks=*/13);
+  std::vector<uint8_t> cards = deck.ToCardArray();
+  for (int trial = 0; trial < 20; ++trial) {
+    std::shuffle(cards.begin(), cards.end(), rng);
+    CardSet hand;
+    for (int i = 0; i < 7; ++i) hand.AddCard(cards[i]);
+
+    int direct_rank = hand.RankCards();
+    SPIEL_CHECK_EQ(CachedRankCards(hand), direct_rank);
+    SuitPermutation perm = {0, 1, 2, 3};
+    do {
+      SPIEL_CHECK_EQ(CachedRankCards(ApplySuitPermutation(hand, perm)),
+                     direct_rank);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+  }
+}
+
+}  // namespace logic
+}  // namespace universal_poker
+}  // namespace open_spiel
+
+int main(int argc, char **argv) {
+  open_spiel::universal_poker::logic::CanonicalInvarianceTests();
+  open_spiel::universal_poker::logic::CachedRankCardsTests();
+}
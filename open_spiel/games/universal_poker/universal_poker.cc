@@ -20,6 +20,7 @@
 #include <array>
 #include <cstdint>
 #include <random>
+#include <tuple>
 #include <utility>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
@@ -29,6 +30,7 @@
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
 #include "open_spiel/games/universal_poker/acpc/project_acpc_server/game.h"
 #include "open_spiel/game_parameters.h"
+#include "open_spiel/games/universal_poker/logic/card_isomorphism.h"
 #include "open_spiel/games/universal_poker/logic/card_set.h"
 #include "open_spiel/games/universal_poker/logic/gamedef.h"
 #include "open_spiel/spiel.h"
@@ -171,6 +173,11 @@ const GameType kGameType{
         // "fcpa" for fold, check/call, bet pot and all in (default).
         // Use "fullgame" for the unabstracted game.
         {"bettingAbstraction", GameParameter(std::string("fcpa"))},
+        // Canonicalize the hole/board cards in InformationStateString under
+        // suit isomorphism, so tabular algorithms (e.g. MCCFR) merge deals
+        // that differ only by a suit relabeling. Lossless for equilibrium
+        // computation; off by default since it changes the infostate strings.
+        {"suitIsomorphism", GameParameter(false)},
 
         // ------------------------------------------------------------------------
         // Following parameters are used to specify specific subgame.
@@ -218,7 +225,9 @@ UniversalPokerState::UniversalPokerState(std::shared_ptr<const Game> game)
       cur_player_(kChancePlayerId),
       possibleActions_(ACTION_DEAL),
       betting_abstraction_(static_cast<const UniversalPokerGame *>(game.get())
-                               ->betting_abstraction()) {
+                               ->betting_abstraction()),
+      suit_isomorphism_(static_cast<const UniversalPokerGame *>(game.get())
+                            ->suit_isomorphism()) {
   // -- Optionally apply subgame parameters. -----------------------------------
   // Pot size.
   const int pot_size = game->GetParameters().at("potSize").int_value();
@@ -524,11 +533,19 @@ std::string UniversalPokerState::InformationStateString(Player player) const {
     absl::StrAppend(&sequences, acpc_state_.BettingSequence(r));
   }
 
+  logic::CardSet hole_cards = HoleCards(player);
+  logic::CardSet board_cards = BoardCards();
+  if (suit_isomorphism_) {
+    // Print the canonical representative of the deal's suit-isomorphism
+    // class, merging infostates that differ only by a suit relabeling.
+    std::tie(hole_cards, board_cards) =
+        logic::CanonicalizeSuits(hole_cards, board_cards);
+  }
   return absl::StrFormat(
       "[Round %i][Player: %i][Pot: %i][Money: %s][Private: %s][Public: "
       "%s][Sequences: %s]",
       acpc_state_.GetRound(), CurrentPlayer(), pot, money,
-      HoleCards(player).ToString(), BoardCards().ToString(), sequences);
+      hole_cards.ToString(), board_cards.ToString(), sequences);
 }
 
 std::string UniversalPokerState::ObservationString(Player player) const {
@@ -1012,7 +1029,8 @@ UniversalPokerGame::UniversalPokerGame(const GameParameters &params)
       acpc_game_(gameDesc_),
       potSize_(ParameterValue<int>("potSize")),
       boardCards_(ParameterValue<std::string>("boardCards")),
-      handReaches_(ParameterValue<std::string>("handReaches")) {
+      handReaches_(ParameterValue<std::string>("handReaches")),
+      suit_isomorphism_(ParameterValue<bool>("suitIsomorphism")) {
   std::string betting_abstraction =
       ParameterValue<std::string>("bettingAbstraction");
   if (betting_abstraction == "fc") {
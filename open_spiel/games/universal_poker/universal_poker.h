@@ -194,6 +194,8 @@ class UniversalPokerState : public State {
   std::vector<int> actionSequenceSizings_;
 
   BettingAbstraction betting_abstraction_;
+  // Mirrors UniversalPokerGame::suit_isomorphism().
+  bool suit_isomorphism_;
 
   // Used for custom implementation of subgames.
   std::vector<double> handReaches_;
@@ -223,6 +225,7 @@ class UniversalPokerGame : public Game {
   }
 
   int big_blind() const { return big_blind_; }
+  bool suit_isomorphism() const { return suit_isomorphism_; }
   double MaxCommitment() const;
   const acpc_cpp::ACPCGame *GetACPCGame() const { return &acpc_game_; }
   std::string parseParameters(const GameParameters &map);
@@ -235,6 +238,8 @@ class UniversalPokerGame : public Game {
   const std::string handReaches_;
   absl::optional<int> max_game_length_;
   BettingAbstraction betting_abstraction_ = BettingAbstraction::kFULLGAME;
+  // See the "suitIsomorphism" game parameter.
+  bool suit_isomorphism_ = false;
   int big_blind_;
   int max_stack_size_;
 };
@@ -1000,6 +1000,46 @@ void Bet4ConfusedForHalfPotRegressionTest() {
   SPIEL_CHECK_EQ(state->ActionToString(4), "player=2 move=Bet4");
 }
 
+void TestSuitIsomorphism() {
+  // With suitIsomorphism on, deals differing only by a suit relabeling share
+  // an infostate string; deals differing by rank do not.
+  std::shared_ptr<const Game> game =
+      LoadGame("universal_poker(suitIsomorphism=true)");
+
+  // The default game deals one hole card each; deal action ids index the full
+  // deck in rank-major order (rank * numSuits + suit).
+  std::unique_ptr<State> state_a = game->NewInitialState();
+  state_a->ApplyAction(0);  // P0: lowest rank, first suit.
+  state_a->ApplyAction(8);  // P1: arbitrary other rank.
+
+  std::unique_ptr<State> state_b = game->NewInitialState();
+  state_b->ApplyAction(1);  // P0: same rank, second suit.
+  state_b->ApplyAction(8);
+
+  std::unique_ptr<State> state_c = game->NewInitialState();
+  state_c->ApplyAction(4);  // P0: different rank, first suit.
+  state_c->ApplyAction(8);
+
+  SPIEL_CHECK_EQ(state_a->InformationStateString(0),
+                 state_b->InformationStateString(0));
+  SPIEL_CHECK_NE(state_a->InformationStateString(0),
+                 state_c->InformationStateString(0));
+
+  // Without the parameter, the isomorphic deals stay distinct.
+  std::shared_ptr<const Game> plain_game = LoadGame("universal_poker");
+  std::unique_ptr<State> plain_a = plain_game->NewInitialState();
+  plain_a->ApplyAction(0);
+  plain_a->ApplyAction(8);
+  std::unique_ptr<State> plain_b = plain_game->NewInitialState();
+  plain_b->ApplyAction(1);
+  plain_b->ApplyAction(8);
+  SPIEL_CHECK_NE(plain_a->InformationStateString(0),
+                 plain_b->InformationStateString(0));
+
+  // Full playthroughs stay well-formed under canonicalized infostates.
+  testing::RandomSimTest(*game, 3);
+}
+
 }  // namespace
 }  // namespace universal_poker
 }  // namespace open_spiel
@@ -1037,4 +1077,5 @@ int main(int argc, char **argv) {
   open_spiel::universal_poker::TestFixedPreferenceBots();
   open_spiel::universal_poker::TestTensorsRecordsSizings();
   open_spiel::universal_poker::Bet4ConfusedForHalfPotRegressionTest();
+  open_spiel::universal_poker::TestSuitIsomorphism();
 }
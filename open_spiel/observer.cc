@@ -34,6 +34,22 @@ SpanTensor ContiguousAllocator::Get(absl::string_view name,
   return SpanTensor(SpanTensorInfo(name, shape), buffer);
 }
 
+void Observer::WriteTensorBatch(absl::Span<const State* const> states,
+                                absl::Span<const int> players,
+                                absl::Span<float> batch) const {
+  SPIEL_CHECK_EQ(states.size(), players.size());
+  if (states.empty()) {
+    SPIEL_CHECK_EQ(batch.size(), 0);
+    return;
+  }
+  SPIEL_CHECK_EQ(batch.size() % states.size(), 0);
+  const int row_size = static_cast<int>(batch.size() / states.size());
+  for (int i = 0; i < static_cast<int>(states.size()); ++i) {
+    ContiguousAllocator allocator(batch.subspan(i * row_size, row_size));
+    WriteTensor(*states[i], players[i], &allocator);
+  }
+}
+
 namespace {
 
 class InformationStateObserver : public Observer {
@@ -189,6 +205,22 @@ std::shared_ptr<Observer> Game::MakeObserver(
   }
 }
 
+std::shared_ptr<Observer> Game::GetObserver(
+    absl::optional<IIGObservationType> iig_obs_type) const {
+  absl::MutexLock lock(&mutex_cached_observers_);
+  for (auto& [cached_type, cached_observer] : cached_observers_) {
+    if (cached_type.has_value() == iig_obs_type.has_value() &&
+        (!cached_type.has_value() || *cached_type == *iig_obs_type)) {
+      return cached_observer;
+    }
+  }
+  std::shared_ptr<Observer> observer = MakeObserver(iig_obs_type, {});
+  if (observer != nullptr) {
+    cached_observers_.emplace_back(iig_obs_type, observer);
+  }
+  return observer;
+}
+
 SpanTensor TrackingVectorAllocator::Get(
     absl::string_view name, const absl::InlinedVector<int, 4>& shape) {
   SPIEL_DCHECK_TRUE(IsNameUnique(name));
@@ -212,23 +244,79 @@ bool TrackingVectorAllocator::IsNameUnique(absl::string_view name) const {
   return true;
 }
 
+namespace {
+
+// Serves the spans recorded in an Observation's compiled write plan, in
+// order. Unlike ContiguousAllocator, Get performs no layout work at all: the
+// offset, size and tensor metadata were frozen when the plan was compiled.
+class CompiledAllocator : public Allocator {
+ public:
+  CompiledAllocator(const std::vector<Observation::PlanEntry>* plan,
+                    absl::Span<float> buffer)
+      : plan_(plan), buffer_(buffer), next_(0) {
+    absl::c_fill(buffer_, 0);
+  }
+
+  SpanTensor Get(absl::string_view name,
+                 const absl::InlinedVector<int, 4>& shape) override {
+    SPIEL_DCHECK_LT(next_, plan_->size());
+    const Observation::PlanEntry& entry = (*plan_)[next_++];
+    SPIEL_DCHECK_EQ(entry.info.name(), name);
+    SPIEL_DCHECK_TRUE(entry.info.shape() == shape);
+    return SpanTensor(entry.info, buffer_.subspan(entry.offset, entry.size));
+  }
+
+ private:
+  const std::vector<Observation::PlanEntry>* plan_;
+  absl::Span<float> buffer_;
+  int next_;
+};
+
+}  // namespace
+
 Observation::Observation(const Game& game, std::shared_ptr<Observer> observer)
     : observer_(std::move(observer)) {
+  Reset(game, observer_);
+}
+
+void Observation::Reset(const Game& game, std::shared_ptr<Observer> observer) {
+  observer_ = std::move(observer);
+  tensors_info_.clear();
+  write_plan_.clear();
+  buffer_.clear();  // Keeps capacity; assign below reuses it where it fits.
+
   // Get an observation of the initial state to set up.
   if (HasTensor()) {
     auto state = game.NewInitialState();
     TrackingVectorAllocator allocator;
     observer_->WriteTensor(*state, /*player=*/0, &allocator);
-    buffer_ = allocator.data();
+    buffer_.assign(allocator.data().begin(), allocator.data().end());
     tensors_info_ = allocator.tensors_info();
+
+    // Freeze the layout into the write plan.
+    write_plan_.reserve(tensors_info_.size());
+    int offset = 0;
+    for (const SpanTensorInfo& info : tensors_info_) {
+      const int size = info.size();
+      write_plan_.push_back(PlanEntry{info, offset, size});
+      offset += size;
+    }
   }
 }
 
 void Observation::SetFrom(const State& state, int player) {
-  ContiguousAllocator allocator(absl::MakeSpan(buffer_));
+  CompiledAllocator allocator(&write_plan_, absl::MakeSpan(buffer_));
   observer_->WriteTensor(state, player, &allocator);
 }
 
+void Observation::SetFromBatch(absl::Span<const State* const> states,
+                               absl::Span<const int> players,
+                               absl::Span<float> batch) const {
+  SPIEL_CHECK_EQ(states.size(), players.size());
+  SPIEL_CHECK_EQ(batch.size(), states.size() * buffer_.size());
+  observer_->WriteTensorBatch(states, players, batch);
+}
+
 std::vector<SpanTensor> Observation::tensors() {
   std::vector<SpanTensor> result;
   result.reserve(tensors_info_.size());
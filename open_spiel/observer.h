@@ -330,6 +330,19 @@ class Observer {
   virtual void WriteTensor(const State& state, int player,
                            Allocator* allocator) const = 0;
 
+  // Batch variant: writes the observation of states[i], as seen by
+  // players[i], into row i of `batch`, a single batch-major block of
+  // states.size() rows. Each row holds one full observation — every
+  // component tensor a WriteTensor call would request, concatenated in Get
+  // order — so batch.size() must be states.size() times the observation
+  // size. The base implementation serves each row through a
+  // ContiguousAllocator and calls WriteTensor; observers whose per-state
+  // layout work is significant can override it to hoist that work out of
+  // the loop and fill rows with bulk copies.
+  virtual void WriteTensorBatch(absl::Span<const State* const> states,
+                                absl::Span<const int> players,
+                                absl::Span<float> batch) const;
+
   // Return a string observation. For human-readability or for tabular
   // algorithms on small games.
   virtual std::string StringFrom(const State& state, int player) const = 0;
@@ -349,13 +362,40 @@ class Observer {
 // Holds an Observer and a vector for it to write values into.
 class Observation {
  public:
-  // Create
+  // One entry of the compiled write plan: the tensor metadata plus its
+  // frozen position in the observation buffer.
+  struct PlanEntry {
+    SpanTensorInfo info;
+    int offset;
+    int size;
+  };
+
+  // Create. Compiles the observer's tensor layout once, by writing an
+  // observation of the initial state; subsequent SetFrom calls reuse the
+  // frozen plan and skip all layout logic.
   Observation(const Game& game, std::shared_ptr<Observer> observer);
 
+  // Re-binds this Observation to a (possibly different) observer, re-running
+  // layout discovery but reusing the existing buffer storage where it fits.
+  // Lets long-lived actors keep one Observation across episodes instead of
+  // constructing a fresh one. The game must outlive the next SetFrom call.
+  void Reset(const Game& game, std::shared_ptr<Observer> observer);
+
   // Gets the observation from the State and player and stores it in
   // the internal tensor.
   void SetFrom(const State& state, int player);
 
+  // Batch form of SetFrom for vectorized environments and batched
+  // evaluators: writes the observation of states[i] for players[i] into
+  // row i of `batch`, which must hold states.size() rows of the full
+  // observation size (the sum of the tensors_info() sizes). Bypasses the
+  // internal buffer and forwards to the observer's WriteTensorBatch in a
+  // single call, so observers that override it amortize their layout work
+  // across the whole batch.
+  void SetFromBatch(absl::Span<const State* const> states,
+                    absl::Span<const int> players,
+                    absl::Span<float> batch) const;
+
   // Describes the observation components.
   const std::vector<SpanTensorInfo>& tensors_info() const {
     return tensors_info_;
@@ -404,6 +444,14 @@ class Observation {
   std::shared_ptr<Observer> observer_;
   std::vector<float> buffer_;
   std::vector<SpanTensorInfo> tensors_info_;
+  // Compiled once in the constructor; entry i is what the i-th
+  // allocator->Get call inside the observer's WriteTensor receives. SetFrom
+  // serves these through a plan-backed allocator, so repeated writes do not
+  // rebuild any tensor metadata or recompute any offsets. (Like the previous
+  // ContiguousAllocator path, this assumes the observer requests the same
+  // tensors in the same order for every state; that is verified in debug
+  // builds.)
+  std::vector<PlanEntry> write_plan_;
 };
 
 // Allows to register observers to a game. Usage:
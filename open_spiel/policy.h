@@ -15,6 +15,8 @@
 #ifndef OPEN_SPIEL_POLICY_H_
 #define OPEN_SPIEL_POLICY_H_
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -22,6 +24,7 @@
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/spiel.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/utils/serialization.h"
@@ -310,6 +313,110 @@ class PartialTabularPolicy : public TabularPolicy {
   std::shared_ptr<Policy> fallback_policy_;
 };
 
+// An intern pool mapping infostate strings to dense integer ids. A pool can
+// be shared by several InternedTabularPolicy instances (e.g. one policy per
+// player in a serving layer) so that each infostate string is stored, and
+// its hash computed, once per process rather than once per lookup.
+class PolicyKeyInternPool {
+ public:
+  // Returns the id for this infostate, registering it if it is new.
+  int Intern(const std::string& info_state) {
+    auto iter_and_bool =
+        ids_.insert({info_state, static_cast<int>(ids_.size())});
+    return iter_and_bool.first->second;
+  }
+
+  // Returns the id for this infostate, or -1 if it was never registered.
+  int Lookup(const std::string& info_state) const {
+    auto iter = ids_.find(info_state);
+    return iter == ids_.end() ? -1 : iter->second;
+  }
+
+  int size() const { return ids_.size(); }
+
+ private:
+  std::unordered_map<std::string, int> ids_;
+};
+
+// A tabular policy tuned for high-volume serving. Infostate keys are
+// interned once into a (possibly shared) PolicyKeyInternPool, and the state
+// policies live in one flat arena indexed by key id, so the hot path --
+// StatePolicyById -- is an array lookup returning a span into the arena:
+// no string is built, hashed, or compared, and nothing is allocated.
+// The string-keyed Policy interface still works (one pool lookup plus a
+// copy) for callers that have not been converted to ids.
+//
+// Overwriting an entry with a different number of actions appends a new
+// arena block and abandons the old one, so this is intended for tables that
+// are built (or bulk-imported) once and then served, not for solvers that
+// resize entries every iteration.
+class InternedTabularPolicy : public Policy {
+ public:
+  InternedTabularPolicy() : keys_(std::make_shared<PolicyKeyInternPool>()) {}
+  explicit InternedTabularPolicy(std::shared_ptr<PolicyKeyInternPool> keys)
+      : keys_(std::move(keys)) {}
+  explicit InternedTabularPolicy(const TabularPolicy& policy)
+      : InternedTabularPolicy() {
+    for (const auto& entry : policy.PolicyTable()) {
+      SetStatePolicy(entry.first, entry.second);
+    }
+  }
+
+  void SetStatePolicy(const std::string& info_state,
+                      const ActionsAndProbs& state_policy) {
+    const int id = keys_->Intern(info_state);
+    if (id >= static_cast<int>(entries_.size())) {
+      entries_.resize(keys_->size());
+    }
+    Entry& entry = entries_[id];
+    if (entry.offset >= 0 &&
+        entry.length == static_cast<int>(state_policy.size())) {
+      std::copy(state_policy.begin(), state_policy.end(),
+                arena_.begin() + entry.offset);
+    } else {
+      entry.offset = static_cast<int64_t>(arena_.size());
+      entry.length = static_cast<int>(state_policy.size());
+      arena_.insert(arena_.end(), state_policy.begin(), state_policy.end());
+    }
+  }
+
+  // The id for this infostate, or -1 if absent; cache it at registration
+  // time and serve lookups through StatePolicyById.
+  int KeyId(const std::string& info_state) const {
+    return keys_->Lookup(info_state);
+  }
+
+  // The allocation-free hot path: returns a view into the arena (empty for
+  // unknown ids). The span is invalidated by the next SetStatePolicy call.
+  absl::Span<const std::pair<Action, double>> StatePolicyById(int id) const {
+    if (id < 0 || id >= static_cast<int>(entries_.size()) ||
+        entries_[id].offset < 0) {
+      return {};
+    }
+    return absl::MakeConstSpan(arena_.data() + entries_[id].offset,
+                               entries_[id].length);
+  }
+
+  ActionsAndProbs GetStatePolicy(const std::string& info_state) const override {
+    absl::Span<const std::pair<Action, double>> state_policy =
+        StatePolicyById(keys_->Lookup(info_state));
+    return ActionsAndProbs(state_policy.begin(), state_policy.end());
+  }
+
+  const std::shared_ptr<PolicyKeyInternPool>& keys() const { return keys_; }
+  int size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    int64_t offset = -1;  // Into arena_; -1 when no policy is stored.
+    int length = 0;
+  };
+
+  std::shared_ptr<PolicyKeyInternPool> keys_;
+  std::vector<std::pair<Action, double>> arena_;
+  std::vector<Entry> entries_;  // Indexed by key id.
+};
+
 std::unique_ptr<TabularPolicy> DeserializeTabularPolicy(
     const std::string& serialized, std::string delimiter = "<~>");
 
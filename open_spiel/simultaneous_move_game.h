@@ -111,6 +111,12 @@ class SimMoveState : public State {
   std::string FlatJointActionToString(Action flat_action) const;
 
   // Return a list of legal flat joint actions. See above for details.
+  //
+  // Note that this materializes the full cross-product of the per-player
+  // legal actions, which grows multiplicatively in the number of players.
+  // Algorithms that only need to traverse the joint actions should prefer
+  // ActionView::joint_actions() (see action_view.h), which iterates the
+  // product lazily and also yields the decoded per-player actions.
   std::vector<Action> LegalFlatJointActions() const;
 
   // Apply a flat joint action, updating the state.
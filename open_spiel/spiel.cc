@@ -15,6 +15,7 @@
 #include "open_spiel/spiel.h"
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -35,6 +36,7 @@
 #include "open_spiel/abseil-cpp/absl/strings/str_format.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_join.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 #include "open_spiel/abseil-cpp/absl/types/span.h"
 #include "open_spiel/game_parameters.h"
 #include "open_spiel/spiel_globals.h"
@@ -234,17 +236,51 @@ std::shared_ptr<const Game> DeserializeGame(const std::string& serialized) {
   return game;
 }
 
+namespace {
+// Process-wide cache of loaded games, keyed by the canonical game string
+// (short name plus sorted parameters). Game instances are immutable once
+// created, so repeated loads of the same game -- common in rollout workers
+// that load per task -- can share one instance and skip re-running the
+// factory. Implicitly stochastic games are never cached: their internal RNG
+// is mutated through SetRNGState, so handing out a shared instance would
+// couple independent users.
+struct LoadedGameCache {
+  absl::Mutex mutex;
+  std::map<std::string, std::shared_ptr<const Game>> games;
+};
+
+LoadedGameCache& GetLoadedGameCache() {
+  static LoadedGameCache* cache = new LoadedGameCache();
+  return *cache;
+}
+}  // namespace
+
 std::shared_ptr<const Game> LoadGame(const std::string& game_string) {
   return LoadGame(GameParametersFromString(game_string));
 }
 
 std::shared_ptr<const Game> LoadGame(const std::string& short_name,
                                      const GameParameters& params) {
+  GameParameters params_with_name = params;
+  params_with_name["name"] = GameParameter(short_name);
+  const std::string cache_key = GameParametersToString(params_with_name);
+  LoadedGameCache& cache = GetLoadedGameCache();
+  {
+    absl::MutexLock lock(&cache.mutex);
+    auto it = cache.games.find(cache_key);
+    if (it != cache.games.end()) return it->second;
+  }
+
   std::shared_ptr<const Game> result =
       GameRegisterer::CreateByName(short_name, params);
   if (result == nullptr) {
     SpielFatalError(absl::StrCat("Unable to create game: ", short_name));
   }
+  if (result->GetType().chance_mode !=
+      GameType::ChanceMode::kSampledStochastic) {
+    absl::MutexLock lock(&cache.mutex);
+    cache.games.emplace(cache_key, result);
+  }
   return result;
 }
 
@@ -256,11 +292,7 @@ std::shared_ptr<const Game> LoadGame(GameParameters params) {
   }
   std::string name = it->second.string_value();
   params.erase(it);
-  std::shared_ptr<const Game> result =
-      GameRegisterer::CreateByName(name, params);
-  if (result == nullptr) {
-    SpielFatalError(absl::StrCat("Unable to create game: ", name));
-  }
+  std::shared_ptr<const Game> result = LoadGame(name, params);
   LogUsage();
   return result;
 }
@@ -269,7 +301,28 @@ State::State(std::shared_ptr<const Game> game)
     : game_(game),
       num_distinct_actions_(game->NumDistinctActions()),
       num_players_(game->NumPlayers()),
-      move_number_(0) {}
+      move_number_(0) {
+  if (game_->GetType().provides_bounded_history) {
+    history_.reserve(game_->MaxHistoryLength());
+  }
+}
+
+State::State(const State& other)
+    : game_(other.game_),
+      num_distinct_actions_(other.num_distinct_actions_),
+      num_players_(other.num_players_),
+      move_number_(other.move_number_),
+      track_history_(other.track_history_),
+      cached_legal_actions_(other.cached_legal_actions_),
+      cached_legal_actions_valid_(other.cached_legal_actions_valid_) {
+  // Reserve the full buffer before copying so the copy never reallocates as
+  // further moves are applied to it. PlayerAction is trivially copyable, so
+  // the history copy itself is a single memcpy either way.
+  if (game_->GetType().provides_bounded_history) {
+    history_.reserve(game_->MaxHistoryLength());
+  }
+  history_ = other.history_;
+}
 
 void NormalizePolicy(ActionsAndProbs* policy) {
   const double sum = absl::c_accumulate(
@@ -336,6 +389,16 @@ std::string State::Serialize() const {
   return absl::StrCat(absl::StrJoin(History(), "\n"), "\n");
 }
 
+std::string State::SerializeBinary() const {
+  SpielFatalError(absl::StrCat("SerializeBinary is not implemented for game ",
+                               game_->GetType().short_name, "."));
+}
+
+void State::ObservationBits(Player player, absl::Span<uint8_t> values) const {
+  SpielFatalError(absl::StrCat("ObservationBits is not implemented for game ",
+                               game_->GetType().short_name, "."));
+}
+
 Action State::StringToAction(Player player,
                              const std::string& action_str) const {
   for (const Action action : LegalActions()) {
@@ -351,10 +414,15 @@ void State::ApplyAction(Action action_id) {
 
   // Cannot apply an invalid action.
   SPIEL_CHECK_NE(action_id, kInvalidAction);
-  Player player = CurrentPlayer();
-  DoApplyAction(action_id);
-  history_.push_back({player, action_id});
+  if (track_history_) {
+    Player player = CurrentPlayer();
+    DoApplyAction(action_id);
+    history_.push_back({player, action_id});
+  } else {
+    DoApplyAction(action_id);
+  }
   ++move_number_;
+  InvalidateLegalActionsCache();
 }
 
 void State::ApplyActionWithLegalityCheck(Action action_id) {
@@ -373,11 +441,14 @@ void State::ApplyActions(const std::vector<Action>& actions) {
   // history_ needs to be modified *after* DoApplyActions which could
   // be using it.
   DoApplyActions(actions);
-  history_.reserve(history_.size() + actions.size());
-  for (int player = 0; player < actions.size(); ++player) {
-    history_.push_back({player, actions[player]});
+  if (track_history_) {
+    history_.reserve(history_.size() + actions.size());
+    for (int player = 0; player < actions.size(); ++player) {
+      history_.push_back({player, actions[player]});
+    }
   }
   ++move_number_;
+  InvalidateLegalActionsCache();
 }
 
 void State::ApplyActionsWithLegalityChecks(const std::vector<Action>& actions) {
@@ -394,6 +465,44 @@ void State::ApplyActionsWithLegalityChecks(const std::vector<Action>& actions) {
   ApplyActions(actions);
 }
 
+void State::LegalActions(InlinedActionsVector* actions) const {
+  // Default: forward to the vector-returning implementation. Games with hot
+  // move generation override this to fill `actions` directly.
+  std::vector<Action> legal = LegalActions();
+  actions->assign(legal.begin(), legal.end());
+}
+
+void State::ChanceOutcomesInto(ActionsAndProbs* outcomes) const {
+  // Default: forward to the vector-returning implementation. Games with hot
+  // chance expansion override this to fill `outcomes` directly.
+  *outcomes = ChanceOutcomes();
+}
+
+std::pair<Action, double> State::SampleChanceOutcome(double z) const {
+  SPIEL_CHECK_TRUE(IsChanceNode());
+  SPIEL_CHECK_GE(z, 0);
+  SPIEL_CHECK_LT(z, 1);
+  if (game_->GetType().uniform_chance_outcomes) {
+    InlinedActionsVector outcomes;
+    LegalActions(&outcomes);
+    SPIEL_CHECK_FALSE(outcomes.empty());
+    const int index = static_cast<int>(z * outcomes.size());
+    return {outcomes[index], 1.0 / outcomes.size()};
+  }
+  ActionsAndProbs outcomes;
+  ChanceOutcomesInto(&outcomes);
+  return SampleAction(outcomes, z);
+}
+
+const std::vector<Action>& State::CachedLegalActions() const {
+  if (!game_->GetType().provides_legal_actions_cache ||
+      !cached_legal_actions_valid_) {
+    cached_legal_actions_ = LegalActions();
+    cached_legal_actions_valid_ = true;
+  }
+  return cached_legal_actions_;
+}
+
 std::vector<int> State::LegalActionsMask(Player player) const {
   int length = (player == kChancePlayerId) ? game_->MaxChanceOutcomes()
                                            : num_distinct_actions_;
@@ -451,6 +560,13 @@ std::unique_ptr<State> Game::DeserializeState(const std::string& str) const {
   return state;
 }
 
+std::unique_ptr<State> Game::DeserializeStateBinary(
+    const std::string& str) const {
+  SpielFatalError(
+      absl::StrCat("DeserializeStateBinary is not implemented for game ",
+                   game_type_.short_name, "."));
+}
+
 std::string SerializeGameAndState(const Game& game, const State& state) {
   std::string str = "";
 
@@ -518,6 +634,78 @@ DeserializeGameAndState(const std::string& serialized_state) {
       game, std::move(state));
 }
 
+namespace {
+
+// "OSGAMST1", identifying the SerializeGameAndStateBinary container.
+constexpr uint64_t kGameAndStateBinaryMagic = 0x4F53'4741'4D53'5431;
+
+// State payload codecs in the binary container.
+constexpr uint8_t kStateCodecHistoryText = 0;
+constexpr uint8_t kStateCodecGameBinary = 1;
+
+void AppendSized(const std::string& payload, std::string* out) {
+  const int64_t size = payload.size();
+  out->append(reinterpret_cast<const char*>(&size), sizeof(size));
+  out->append(payload);
+}
+
+std::string ReadSized(const std::string& buffer, int64_t* offset) {
+  SPIEL_CHECK_LE(*offset + static_cast<int64_t>(sizeof(int64_t)),
+                 static_cast<int64_t>(buffer.size()));
+  int64_t size;
+  std::memcpy(&size, buffer.data() + *offset, sizeof(size));
+  *offset += sizeof(size);
+  SPIEL_CHECK_GE(size, 0);
+  SPIEL_CHECK_LE(*offset + size, static_cast<int64_t>(buffer.size()));
+  std::string payload(buffer.data() + *offset, size);
+  *offset += size;
+  return payload;
+}
+
+}  // namespace
+
+std::string SerializeGameAndStateBinary(const Game& game, const State& state) {
+  std::string out;
+  out.append(reinterpret_cast<const char*>(&kGameAndStateBinaryMagic),
+             sizeof(kGameAndStateBinaryMagic));
+  AppendSized(game.Serialize(), &out);
+  const uint8_t codec = game.ProvidesBinaryStateSerialization()
+                            ? kStateCodecGameBinary
+                            : kStateCodecHistoryText;
+  out.push_back(static_cast<char>(codec));
+  AppendSized(
+      codec == kStateCodecGameBinary ? state.SerializeBinary()
+                                     : state.Serialize(),
+      &out);
+  return out;
+}
+
+std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>
+DeserializeGameAndStateBinary(const std::string& serialized) {
+  SPIEL_CHECK_GE(serialized.size(), sizeof(uint64_t));
+  uint64_t magic;
+  std::memcpy(&magic, serialized.data(), sizeof(magic));
+  SPIEL_CHECK_EQ(magic, kGameAndStateBinaryMagic);
+  int64_t offset = sizeof(magic);
+
+  const std::string game_section = ReadSized(serialized, &offset);
+  SPIEL_CHECK_LT(offset, static_cast<int64_t>(serialized.size()));
+  const uint8_t codec = static_cast<uint8_t>(serialized[offset++]);
+  const std::string state_section = ReadSized(serialized, &offset);
+
+  std::shared_ptr<const Game> game = DeserializeGame(game_section);
+  std::unique_ptr<State> state;
+  if (codec == kStateCodecGameBinary) {
+    SPIEL_CHECK_TRUE(game->ProvidesBinaryStateSerialization());
+    state = game->DeserializeStateBinary(state_section);
+  } else {
+    SPIEL_CHECK_EQ(codec, kStateCodecHistoryText);
+    state = game->DeserializeState(state_section);
+  }
+  return std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>(
+      game, std::move(state));
+}
+
 std::ostream& operator<<(std::ostream& stream, GameType::Dynamics value) {
   switch (value) {
     case GameType::Dynamics::kSimultaneous:
@@ -15,6 +15,8 @@
 #ifndef OPEN_SPIEL_SPIEL_H_
 #define OPEN_SPIEL_SPIEL_H_
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -27,6 +29,7 @@
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/random/bit_gen_ref.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_join.h"
 #include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
@@ -142,6 +145,26 @@ struct GameType {
   // distinction between public and private observations.
   bool provides_factored_observation_string = false;
 
+  // Is it safe to cache the result of State::LegalActions() between state
+  // changes? This holds for games whose states only mutate through
+  // ApplyAction(s)/UndoAction. Games that advertise it get a per-state cache
+  // via State::CachedLegalActions(); for all other games that call simply
+  // recomputes. See the comment on CachedLegalActions().
+  bool provides_legal_actions_cache = false;
+
+  // Are all chance nodes uniform distributions over their legal outcomes?
+  // Games that advertise it let samplers pick directly among the legal
+  // outcomes without materializing the (outcome, probability) pairs. See
+  // State::SampleChanceOutcome().
+  bool uniform_chance_outcomes = false;
+
+  // Is Game::MaxHistoryLength() implemented (and cheap)? Games that
+  // advertise it get their history storage preallocated to the full game
+  // length: the buffer is reserved at state construction and again when a
+  // state is copied, so ApplyAction never grows it and the history copy in
+  // Clone() is a single allocation plus memcpy.
+  bool provides_bounded_history = false;
+
   bool provides_information_state() const {
     return provides_information_state_tensor
         || provides_information_state_string;
@@ -197,6 +220,11 @@ std::ostream& operator<<(std::ostream& stream, GameType::RewardModel value);
 // The probability of taking each possible action in a particular info state.
 using ActionsAndProbs = std::vector<std::pair<Action, double>>;
 
+// Action list with inline capacity; 16 covers the branching factor of most
+// states in most games, so filling one avoids the allocator entirely. See
+// State::LegalActions(InlinedActionsVector*).
+using InlinedActionsVector = absl::InlinedVector<Action, 16>;
+
 // We alias this here as we can't import state_distribution.h or we'd have a
 // circular dependency.
 using HistoryDistribution =
@@ -220,7 +248,11 @@ class State {
   // be used as value types and should always be created via a shared pointer.
   // See the documentation of the Game object for further details.
   State(std::shared_ptr<const Game> game);
-  State(const State&) = default;
+  // Member-wise copy, except that for games advertising
+  // GameType::provides_bounded_history the history buffer of the copy is
+  // reserved to Game::MaxHistoryLength() first, so clones handed to search
+  // never reallocate it as further moves are applied.
+  State(const State& other);
 
   // Returns current player. Player numbers start from 0.
   // Negative numbers are for chance (-1) or simultaneous (-2).
@@ -276,6 +308,23 @@ class State {
   // is added.
   virtual std::vector<Action> LegalActions() const = 0;
 
+  // Allocation-avoiding variant of LegalActions(): fills `actions` (cleared
+  // first) instead of returning a fresh heap vector. The inline capacity of
+  // InlinedActionsVector covers the typical branching factor, so the common
+  // case never touches the allocator. The default implementation forwards to
+  // LegalActions(); games with hot move generation can override it to write
+  // the actions directly.
+  virtual void LegalActions(InlinedActionsVector* actions) const;
+
+  // Cached variant of LegalActions() for callers that query legal moves
+  // several times on the same node (tree policies, best response). For games
+  // that set GameType::provides_legal_actions_cache the result is computed at
+  // most once per state change: ApplyAction(s) marks the cache dirty, and
+  // games implementing UndoAction must call InvalidateLegalActionsCache()
+  // there. For games without the capability flag this recomputes on every
+  // call (but still avoids a copy at the call site).
+  const std::vector<Action>& CachedLegalActions() const;
+
   // Returns a vector containing 1 for legal actions and 0 for illegal actions.
   // The length is `game.NumDistinctActions()` for player nodes, and
   // `game.MaxChanceOutcomes()` for chance nodes.
@@ -348,6 +397,17 @@ class State {
   // non-terminal states, and the terminal utility for the final state.
   virtual std::vector<double> Returns() const = 0;
 
+  // Writes Returns() into a caller-provided buffer of size NumPlayers().
+  // Rollout and solver hot paths call this at every terminal with a reused
+  // buffer to avoid a per-call vector allocation. The default bridges to
+  // Returns(); games whose returns are cheap to compute should override it
+  // to fill the span directly.
+  virtual void ReturnsInto(absl::Span<double> returns) const {
+    std::vector<double> r = Returns();
+    SPIEL_CHECK_EQ(returns.size(), r.size());
+    std::copy(r.begin(), r.end(), returns.begin());
+  }
+
   // Returns Reward for one player (see above for definition). If Rewards for
   // multiple players are required it is more efficient to use Rewards() above.
   virtual double PlayerReward(Player player) const {
@@ -427,6 +487,16 @@ class State {
   // number in the transformed game.
   int MoveNumber() const { return move_number_; }
 
+  // Controls whether ApplyAction records into the history. Pure Monte Carlo
+  // rollouts never read the history, so rollout scratch states can disable
+  // tracking to skip the per-move append (and keep their clones cheap, since
+  // the history vector stays short). MoveNumber() still advances. While
+  // tracking is off, History(), FullHistory(), HistoryString(), UndoAction
+  // and state serialization (all of which need the full history) must not be
+  // used. Clones made after disabling inherit the setting.
+  void SetHistoryTracking(bool track) { track_history_ = track; }
+  bool IsHistoryTracking() const { return track_history_; }
+
   // Is this a first state in the game, i.e. the initial state (root node)?
   bool IsInitialState() const { return history_.empty(); }
 
@@ -485,6 +555,23 @@ class State {
     return InformationStateString(CurrentPlayer());
   }
 
+  // A 64-bit hash of the information state, for algorithms that key tables
+  // by infostate and do not need the string itself. The contract follows
+  // InformationStateString: equal infostate strings must produce equal
+  // hashes (including across players, since the strings are unique across
+  // players). Distinct infostates may collide, so callers that cannot
+  // tolerate a collision must verify matches with the string form.
+  //
+  // The default hashes InformationStateString and therefore still allocates;
+  // games with compact internal representations should override this with a
+  // direct, allocation-free computation.
+  virtual uint64_t InformationStateHash(Player player) const {
+    return absl::Hash<std::string>()(InformationStateString(player));
+  }
+  uint64_t InformationStateHash() const {
+    return InformationStateHash(CurrentPlayer());
+  }
+
   // Vector form, useful for neural-net function approximation approaches.
   // The size of the vector must match Game::InformationStateShape()
   // with values in lexicographic order. E.g. for 2x4x3, order would be:
@@ -559,6 +646,17 @@ class State {
   }
   void ObservationTensor(Player player, std::vector<float>* values) const;
 
+  // Compact integer counterpart of ObservationTensor, for games whose
+  // observation entries are small non-negative integers (advertised via
+  // Game::ProvidesObservationBits). The length and layout match
+  // ObservationTensor exactly: binary planes hold 0/1 and counter entries
+  // hold the raw count, so the float tensor is recoverable from the bytes
+  // (by casting, and rescaling any counters) but not vice versa. Storing
+  // observations this way quarters replay-buffer size and memory bandwidth.
+  // The default implementation fails.
+  virtual void ObservationBits(Player player,
+                               absl::Span<uint8_t> values) const;
+
   // Return a copy of this state.
   virtual std::unique_ptr<State> Clone() const = 0;
 
@@ -617,6 +715,20 @@ class State {
     SpielFatalError("ChanceOutcomes unimplemented!");
   }
 
+  // Allocation-avoiding variant of ChanceOutcomes(): fills `outcomes`
+  // (cleared first) instead of returning a fresh heap vector, so traversal
+  // loops can reuse one buffer's capacity across chance nodes. The default
+  // implementation forwards to ChanceOutcomes(); games with hot chance
+  // expansion can override it to write the outcomes directly.
+  virtual void ChanceOutcomesInto(ActionsAndProbs* outcomes) const;
+
+  // Samples a chance outcome at this state from z, which must be in [0, 1).
+  // For games that advertise GameType::uniform_chance_outcomes this picks
+  // directly among the legal outcomes without materializing the
+  // distribution; otherwise it falls back on ChanceOutcomesInto() followed
+  // by SampleAction(). Returns the sampled (outcome, probability) pair.
+  std::pair<Action, double> SampleChanceOutcome(double z) const;
+
   // Lists the valid chance outcomes at the current state.
   // Derived classes may substitute this with a more efficient implementation.
   virtual std::vector<Action> LegalChanceOutcomes() const {
@@ -644,6 +756,13 @@ class State {
   // If overridden, this must be the inverse of Game::DeserializeState.
   virtual std::string Serialize() const;
 
+  // Binary counterpart of Serialize(). Games whose concrete state admits a
+  // compact flat encoding should override this together with
+  // Game::DeserializeStateBinary (and ProvidesBinaryStateSerialization), so
+  // a state can be restored by copying that encoding back in rather than by
+  // replaying its whole action history. The default implementation fails.
+  virtual std::string SerializeBinary() const;
+
   // Resamples a new history from the information state from player_id's view.
   // This resamples a private for the other players, but holds player_id's
   // privates constant, and the public information constant.
@@ -733,6 +852,16 @@ class State {
   // Information that changes over the course of the game.
   std::vector<PlayerAction> history_;
   int move_number_;
+  bool track_history_ = true;  // See SetHistoryTracking.
+
+  // Marks the CachedLegalActions() cache stale. Called automatically by
+  // ApplyAction(s); games that implement UndoAction must call it there.
+  void InvalidateLegalActionsCache() { cached_legal_actions_valid_ = false; }
+
+ private:
+  // Backing storage for CachedLegalActions().
+  mutable std::vector<Action> cached_legal_actions_;
+  mutable bool cached_legal_actions_valid_ = false;
 };
 
 std::ostream& operator<<(std::ostream& stream, const State& state);
@@ -871,6 +1000,20 @@ class Game : public std::enable_shared_from_this<Game> {
   // State::Serialize (i.e. that method should also be overridden).
   virtual std::unique_ptr<State> DeserializeState(const std::string& str) const;
 
+  // True if this game implements State::SerializeBinary and
+  // DeserializeStateBinary below.
+  virtual bool ProvidesBinaryStateSerialization() const { return false; }
+
+  // True if this game implements State::ObservationBits.
+  virtual bool ProvidesObservationBits() const { return false; }
+
+  // Inverse of State::SerializeBinary. Unlike DeserializeState, the state is
+  // restored directly from its encoding, without replaying its history;
+  // History() on the result is therefore generally empty (MoveNumber() is
+  // preserved). The default implementation fails.
+  virtual std::unique_ptr<State> DeserializeStateBinary(
+      const std::string& str) const;
+
   // The maximum length of any one game (in terms of number of decision nodes
   // visited in the game tree). For a simultaneous action game, this is the
   // maximum number of joint decisions. In a turn-based game, this is the
@@ -957,6 +1100,14 @@ class Game : public std::enable_shared_from_this<Game> {
     return absl::StrCat("Action(id=", action_id, ", player=", player, ")");
   }
 
+  // Returns a cached observer for the given observation type with default
+  // parameters, creating it with MakeObserver on first use. Observers are
+  // stateless, so one instance can be shared by any number of threads and
+  // Observations; caching them stops per-episode actor setup from re-running
+  // observer construction. Call MakeObserver directly when passing params.
+  std::shared_ptr<Observer> GetObserver(
+      absl::optional<IIGObservationType> iig_obs_type) const;
+
   // Returns an observer that was registered, based on its name.
   std::shared_ptr<Observer> MakeRegisteredObserver(
       absl::optional<IIGObservationType> iig_obs_type,
@@ -1040,6 +1191,13 @@ class Game : public std::enable_shared_from_this<Game> {
   mutable GameParameters defaulted_parameters_
       ABSL_GUARDED_BY(mutex_defaulted_parameters_);
   mutable absl::Mutex mutex_defaulted_parameters_;
+
+  // Cache for GetObserver. A handful of observation types exist per game, so
+  // a linear scan is fine.
+  mutable std::vector<
+      std::pair<absl::optional<IIGObservationType>, std::shared_ptr<Observer>>>
+      cached_observers_ ABSL_GUARDED_BY(mutex_cached_observers_);
+  mutable absl::Mutex mutex_cached_observers_;
 };
 
 #define CONCAT_(x, y) x##y
@@ -1085,11 +1243,17 @@ std::vector<GameType> RegisteredGameTypes();
 
 std::shared_ptr<const Game> DeserializeGame(const std::string& serialized);
 
-// Returns a new game object from the specified string, which is the short
-// name plus optional parameters, e.g. "go(komi=4.5,board_size=19)"
+// Returns a game object from the specified string, which is the short
+// name plus optional parameters, e.g. "go(komi=4.5,board_size=19)".
+// Loaded games are memoized process-wide by their canonical game string:
+// repeated loads of the same game return a shared instance (games are
+// immutable once created). Implicitly stochastic games are the exception
+// and always get a fresh instance, since their internal RNG state is
+// mutable through SetRNGState.
 std::shared_ptr<const Game> LoadGame(const std::string& game_string);
 
-// Returns a new game object with the specified parameters.
+// Returns a game object with the specified parameters. See above for the
+// memoization behavior.
 std::shared_ptr<const Game> LoadGame(const std::string& short_name,
                                      const GameParameters& params);
 
@@ -1148,6 +1312,21 @@ std::string SerializeGameAndState(const Game& game, const State& state);
 std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>
 DeserializeGameAndState(const std::string& serialized_state);
 
+// Binary counterpart of SerializeGameAndState: a length-prefixed container
+// holding the game's serialization followed by a state payload. When the game
+// provides binary state serialization, the payload is the game's own compact
+// encoding and restoring it is a flat copy; otherwise the payload is the text
+// history fallback and restoring replays the history, exactly as
+// DeserializeState does. Multi-byte fields are host-endian, so the format is
+// intended for checkpoints and worker hand-off between machines of the same
+// architecture, not as an archival format.
+std::string SerializeGameAndStateBinary(const Game& game, const State& state);
+
+// Restores a (game, state) pair written by SerializeGameAndStateBinary. The
+// game must be registered so that it is loadable via LoadGame.
+std::pair<std::shared_ptr<const Game>, std::unique_ptr<State>>
+DeserializeGameAndStateBinary(const std::string& serialized);
+
 // Convert GameTypes from and to strings. Used for serialization of objects
 // that contain them.
 // Note: these are not finished! They will be finished by an external
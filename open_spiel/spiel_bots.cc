@@ -14,6 +14,7 @@
 
 #include "open_spiel/spiel_bots.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <random>
@@ -46,7 +47,19 @@ class UniformRandomBot : public Bot {
 
   void RestartAt(const State&) override {}
   Action Step(const State& state) override {
-    return StepWithPolicy(state).second;
+    if (state.CurrentPlayer() != player_id_) {
+      // Simultaneous-move nodes need the per-player legal actions; take the
+      // policy-building path there.
+      return StepWithPolicy(state).second;
+    }
+    // Plain stepping never materializes a policy: the legal actions are
+    // filled into a reused inlined buffer and one of them is sampled
+    // directly. Callers that want the policy use StepWithPolicy.
+    state.LegalActions(&legal_actions_buffer_);
+    SPIEL_CHECK_FALSE(legal_actions_buffer_.empty());
+    const int selection = absl::uniform_int_distribution<int>(
+        0, legal_actions_buffer_.size() - 1)(rng_);
+    return legal_actions_buffer_[selection];
   }
   bool ProvidesPolicy() override { return true; }
   ActionsAndProbs GetPolicy(const State& state) override {
@@ -77,6 +90,7 @@ class UniformRandomBot : public Bot {
  private:
   const Player player_id_;
   std::mt19937 rng_;
+  InlinedActionsVector legal_actions_buffer_;
 };
 
 // A UniformRandomBot that keeps a copy of the state up to date. This exists
@@ -97,6 +111,12 @@ class StatefulRandomBot : public UniformRandomBot {
     CheckStatesEqual(state, *state_);
     return UniformRandomBot::GetPolicy(*state_);
   }
+  Action Step(const State& state) override {
+    CheckStatesEqual(state, *state_);
+    Action action = UniformRandomBot::Step(*state_);
+    state_->ApplyAction(action);
+    return action;
+  }
   std::pair<ActionsAndProbs, Action> StepWithPolicy(
       const State& state) override {
     std::pair<ActionsAndProbs, Action> ret =
@@ -163,7 +183,19 @@ class FixedActionPreferenceBot : public Bot {
 
   void RestartAt(const State&) override {}
   Action Step(const State& state) override {
-    return StepWithPolicy(state).second;
+    if (state.CurrentPlayer() != player_id_) {
+      return StepWithPolicy(state).second;
+    }
+    // Branching factors are small enough that a linear scan of the reused
+    // buffer beats building a hash set per move.
+    state.LegalActions(&legal_actions_buffer_);
+    for (Action action : actions_) {
+      if (std::find(legal_actions_buffer_.begin(), legal_actions_buffer_.end(),
+                    action) != legal_actions_buffer_.end()) {
+        return action;
+      }
+    }
+    SpielFatalError("No legal actions in action list.");
   }
   bool ProvidesPolicy() override { return true; }
   ActionsAndProbs GetPolicy(const State& state) override {
@@ -193,6 +225,7 @@ class FixedActionPreferenceBot : public Bot {
  private:
   const Player player_id_;
   std::vector<Action> actions_;
+  InlinedActionsVector legal_actions_buffer_;
 };
 
 }  // namespace
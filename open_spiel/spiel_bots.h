@@ -15,6 +15,7 @@
 #ifndef OPEN_SPIEL_SPIEL_BOTS_H_
 #define OPEN_SPIEL_SPIEL_BOTS_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -70,6 +71,21 @@ namespace open_spiel {
 //    return True
 //  def force_action(self, state, action):
 //    ...
+
+// Statistics for a bot's most recent step, for callers that budget per-move
+// latency (e.g. scaling a simulation count to a time target). Collection is
+// opt-in via Bot::SetCollectStepStats(); which counters a bot fills depends
+// on the bot, and counters it does not track stay at zero. MCTSBot and
+// ISMCTSBot report simulations run and search nodes created; PIMCBot reports
+// determinizations searched as simulations and transposition-table hits as
+// cache hits.
+struct BotStepStats {
+  double wall_time_seconds = 0.0;  // Wall time spent inside the search.
+  int64_t simulations = 0;         // Simulations / determinizations run.
+  int64_t nodes_expanded = 0;      // Search nodes created.
+  int64_t cache_hits = 0;          // Evaluation / transposition cache hits.
+};
+
 class Bot {
  public:
   // Constructs a Bot that only supports `Step` and `Restart` (maybe RestartAt).
@@ -182,6 +198,21 @@ class Bot {
   virtual std::unique_ptr<Bot> Clone() {
     SpielFatalError("Clone method not implemented.");
   }
+
+  // Enables or disables per-step statistics collection. Off by default;
+  // while off, instrumented bots pay a single branch per step and
+  // last_step_stats_ is left untouched. Bots without instrumentation ignore
+  // the flag entirely.
+  void SetCollectStepStats(bool collect) { collect_step_stats_ = collect; }
+  bool CollectsStepStats() const { return collect_step_stats_; }
+
+  // Statistics for the most recent Step / StepWithPolicy / GetPolicy call
+  // made while collection was enabled. Zero-initialized before any such call.
+  const BotStepStats& GetLastStepStats() const { return last_step_stats_; }
+
+ protected:
+  bool collect_step_stats_ = false;
+  BotStepStats last_step_stats_;
 };
 
 class BotFactory {
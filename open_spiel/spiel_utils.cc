@@ -19,6 +19,7 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "open_spiel/abseil-cpp/absl/algorithm/container.h"
@@ -180,22 +181,46 @@ bool StrContainsIgnoreCase(const std::string& haystack,
   return (haystack_copy.find(needle_copy) != std::string::npos);
 }
 
-int SamplerFromRng::operator()(absl::Span<const double> probs) {
-  const float cutoff = rng_();
-  float sum = 0.0f;
+void FastRng::Seed(uint64_t seed) {
+  // SplitMix64: fills the state from a single word; recommended by the
+  // xoshiro authors for seeding.
+  uint64_t z = seed;
+  for (int i = 0; i < 4; ++i) {
+    z += 0x9E3779B97F4A7C15ULL;
+    uint64_t x = z;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    s_[i] = x ^ (x >> 31);
+  }
+}
+
+FastRng& ThreadLocalFastRng() {
+  static thread_local FastRng rng(
+      static_cast<uint64_t>(
+          absl::ToInt64Nanoseconds(absl::Now() - absl::UnixEpoch())) ^
+      std::hash<std::thread::id>()(std::this_thread::get_id()));
+  return rng;
+}
+
+int SampleIndexFromProbs(absl::Span<const double> probs, double z) {
+  double sum = 0.0;
   for (int i = 0; i < probs.size(); ++i) {
     sum += probs[i];
-    if (cutoff < sum) {
+    if (z < sum) {
       return i;
     }
   }
 
-  // To be on the safe side, cover case cutoff == 1.0 and sum < 1
+  // To be on the safe side, cover case z == 1.0 and sum < 1
   for (int i = probs.size() - 1; i >= 0; --i) {
     if (probs[i] > 0.0) return i;
   }
 
-  SpielFatalError("SamplerFromRng: not a probability distribution.");
+  SpielFatalError("SampleIndexFromProbs: not a probability distribution.");
+}
+
+int SamplerFromRng::operator()(absl::Span<const double> probs) {
+  return SampleIndexFromProbs(probs, rng_());
 }
 
 }  // namespace open_spiel
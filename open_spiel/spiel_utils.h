@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <random>
 #include <sstream>
@@ -29,6 +30,7 @@
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/numeric/int128.h"
 #include "open_spiel/abseil-cpp/absl/random/uniform_real_distribution.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/time/clock.h"
@@ -385,6 +387,70 @@ class UniformProbabilitySampler {
   const double max_;
 };
 
+// A small, fast pseudo-random generator (xoshiro256++) for hot loops such as
+// rollouts and sampling, where std::mt19937 plus the standard distributions
+// are a measurable cost. Not cryptographically secure. Satisfies the uniform
+// random bit generator requirements, so it can also be passed to std::shuffle
+// and the absl distribution functions.
+class FastRng {
+ public:
+  using result_type = uint64_t;
+
+  explicit FastRng(uint64_t seed = 0x9E3779B97F4A7C15ULL) { Seed(seed); }
+
+  // Resets the state, expanding the seed with SplitMix64 so that nearby seeds
+  // (e.g. seed, seed + 1, ...) still yield decorrelated streams.
+  void Seed(uint64_t seed);
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  uint64_t operator()() {
+    const uint64_t result = Rotl(s_[0] + s_[3], 23) + s_[0];
+    const uint64_t t = s_[1] << 17;
+    s_[2] ^= s_[0];
+    s_[3] ^= s_[1];
+    s_[1] ^= s_[2];
+    s_[0] ^= s_[3];
+    s_[2] ^= t;
+    s_[3] = Rotl(s_[3], 45);
+    return result;
+  }
+
+  // Returns an unbiased integer in [0, range) using Lemire's multiply-shift
+  // method; the rejection branch is almost never taken.
+  uint64_t UniformInt(uint64_t range) {
+    absl::uint128 m = absl::uint128(operator()()) * absl::uint128(range);
+    uint64_t low = absl::Uint128Low64(m);
+    if (low < range) {
+      const uint64_t threshold = -range % range;
+      while (low < threshold) {
+        m = absl::uint128(operator()()) * absl::uint128(range);
+        low = absl::Uint128Low64(m);
+      }
+    }
+    return absl::Uint128High64(m);
+  }
+
+  // Returns a double uniformly distributed in [0, 1).
+  double UniformDouble() { return (operator()() >> 11) * 0x1.0p-53; }
+
+ private:
+  static uint64_t Rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  uint64_t s_[4];
+};
+
+// Returns a generator owned by the calling thread, seeded on first use from
+// the clock and the thread id. Use this where per-call seeding or a shared
+// locked generator would otherwise be needed; for reproducible streams,
+// construct a FastRng with an explicit seed instead.
+FastRng& ThreadLocalFastRng();
+
 // Utility functions intended to be used for casting
 // from a Base class to a Derived subclass.
 // These functions handle various use cases, such as pointers and const
@@ -424,6 +490,14 @@ inline To down_cast(From& f) {
   return *static_cast<ToAsPointer>(&f);
 }
 
+// Returns the index sampled from the distribution in probs by the uniform
+// random number z in [0, 1), walking the cumulative sum. If floating-point
+// rounding leaves z past the accumulated mass, returns the last index with
+// positive probability; exits with an error if there is none. Sampling
+// through this avoids materializing an ActionsAndProbs vector when the
+// probabilities already live in an array.
+int SampleIndexFromProbs(absl::Span<const double> probs, double z);
+
 // Creates a sampler from a std::function<double()> conforming to the
 // probabilities received. absl::discrete_distribution requires a URBG as a
 // source of randomness (as opposed to a std::function<double()>) so cannot
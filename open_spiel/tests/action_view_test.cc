@@ -53,10 +53,57 @@ void TestFlatJointActions() {
   SPIEL_CHECK_EQ(expected_joint_action, 2 * 3 * 2);
 }
 
+void TestJointActions() {
+  ActionView view(/*current_player=*/kSimultaneousPlayerId,
+                  /*legal_actions=*/{{0, 1}, {2, 3, 4}, {}, {5, 6}});
+
+  // The odometer must visit the same joint actions, in the same order, as
+  // decoding each flat id by the radix scheme (player 0 fastest). Players
+  // without legal actions contribute kInvalidAction.
+  int num_visited = 0;
+  for (auto it = view.joint_actions().begin(); it != view.joint_actions().end();
+       ++it) {
+    absl::Span<const Action> joint_action = *it;
+    SPIEL_CHECK_EQ(joint_action.size(), view.num_players());
+    SPIEL_CHECK_EQ(it.flat_action(), num_visited);
+
+    Action flat_action = it.flat_action();
+    for (int pl = 0; pl < view.num_players(); ++pl) {
+      int num_actions = view.num_actions(pl);
+      if (num_actions == 0) {
+        SPIEL_CHECK_EQ(joint_action[pl], kInvalidAction);
+        continue;
+      }
+      SPIEL_CHECK_EQ(joint_action[pl],
+                     view.legal_actions[pl][flat_action % num_actions]);
+      flat_action /= num_actions;
+    }
+    ++num_visited;
+  }
+  SPIEL_CHECK_EQ(num_visited, 2 * 3 * 2);
+}
+
+void TestLegalMasks() {
+  ActionView view(/*current_player=*/kSimultaneousPlayerId,
+                  /*legal_actions=*/{{0, 1}, {2, 3, 4}, {5, 63}});
+
+  SPIEL_CHECK_EQ(view.legal_mask(0), 0b11);
+  SPIEL_CHECK_EQ(view.legal_mask(1), 0b11100);
+  SPIEL_CHECK_EQ(view.legal_mask(2), (uint64_t{1} << 63) | (uint64_t{1} << 5));
+
+  std::vector<uint64_t> masks(view.num_players());
+  view.legal_masks(absl::MakeSpan(masks));
+  for (int pl = 0; pl < view.num_players(); ++pl) {
+    SPIEL_CHECK_EQ(masks[pl], view.legal_mask(pl));
+  }
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::TestFixedActions();
   open_spiel::TestFlatJointActions();
+  open_spiel::TestJointActions();
+  open_spiel::TestLegalMasks();
 }
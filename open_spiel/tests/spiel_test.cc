@@ -65,6 +65,104 @@ void TicTacToeTests() {
   RandomSimTest(*tic_tac_toe, /*num_sims=*/100);
 }
 
+void HistoryTrackingTests() {
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  std::unique_ptr<State> tracked = game->NewInitialState();
+  std::unique_ptr<State> untracked = game->NewInitialState();
+  SPIEL_CHECK_TRUE(untracked->IsHistoryTracking());
+  untracked->SetHistoryTracking(false);
+  SPIEL_CHECK_FALSE(untracked->IsHistoryTracking());
+
+  // The two states play the same moves; only the tracked one records them.
+  while (!tracked->IsTerminal()) {
+    Action action = tracked->LegalActions()[0];
+    tracked->ApplyAction(action);
+    untracked->ApplyAction(action);
+  }
+  SPIEL_CHECK_TRUE(untracked->IsTerminal());
+  SPIEL_CHECK_EQ(tracked->ToString(), untracked->ToString());
+  SPIEL_CHECK_EQ(tracked->Returns(), untracked->Returns());
+  SPIEL_CHECK_EQ(tracked->MoveNumber(), untracked->MoveNumber());
+  SPIEL_CHECK_EQ(static_cast<int>(tracked->History().size()),
+                 tracked->MoveNumber());
+  SPIEL_CHECK_TRUE(untracked->History().empty());
+
+  // Clones inherit the setting.
+  SPIEL_CHECK_FALSE(untracked->Clone()->IsHistoryTracking());
+}
+
+void ObserverCachingTests() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+
+  // Equal observation types share one cached instance.
+  std::shared_ptr<Observer> default_obs = game->GetObserver(kDefaultObsType);
+  SPIEL_CHECK_TRUE(default_obs != nullptr);
+  SPIEL_CHECK_TRUE(default_obs == game->GetObserver(kDefaultObsType));
+  std::shared_ptr<Observer> info_state_obs =
+      game->GetObserver(kInfoStateObsType);
+  SPIEL_CHECK_TRUE(info_state_obs != nullptr);
+  SPIEL_CHECK_TRUE(info_state_obs != default_obs);
+  SPIEL_CHECK_TRUE(game->GetObserver(absl::nullopt) != nullptr);
+
+  // An Observation can be re-bound to another observer, reusing its buffer.
+  Observation observation(*game, default_obs);
+  SPIEL_CHECK_EQ(static_cast<int>(observation.Tensor().size()),
+                 game->ObservationTensorSize());
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (state->IsChanceNode()) {
+    state->ApplyAction(state->ChanceOutcomes()[0].first);
+  }
+  observation.SetFrom(*state, /*player=*/0);
+
+  observation.Reset(*game, info_state_obs);
+  SPIEL_CHECK_EQ(static_cast<int>(observation.Tensor().size()),
+                 game->InformationStateTensorSize());
+  observation.SetFrom(*state, /*player=*/0);
+
+  std::vector<float> expected(game->InformationStateTensorSize());
+  state->InformationStateTensor(0, absl::MakeSpan(expected));
+  std::vector<float> actual(observation.Tensor().begin(),
+                            observation.Tensor().end());
+  SPIEL_CHECK_EQ(actual, expected);
+}
+
+void ObserverBatchWriteTests() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  Observation observation(*game, game->GetObserver(kDefaultObsType));
+
+  // Collect a handful of distinct decision states.
+  std::vector<std::unique_ptr<State>> states;
+  std::unique_ptr<State> state = game->NewInitialState();
+  while (!state->IsTerminal()) {
+    if (!state->IsChanceNode()) states.push_back(state->Clone());
+    state->ApplyAction(state->LegalActions()[0]);
+  }
+  SPIEL_CHECK_GT(states.size(), 1);
+
+  std::vector<const State*> state_ptrs;
+  std::vector<int> players;
+  for (const std::unique_ptr<State>& s : states) {
+    state_ptrs.push_back(s.get());
+    players.push_back(s->CurrentPlayer());
+  }
+
+  // The batch block must match row-by-row what SetFrom writes per state.
+  const int row_size = game->ObservationTensorSize();
+  std::vector<float> batch(states.size() * row_size, -1.f);
+  observation.SetFromBatch(state_ptrs, players, absl::MakeSpan(batch));
+  for (int i = 0; i < static_cast<int>(states.size()); ++i) {
+    observation.SetFrom(*states[i], players[i]);
+    const std::vector<float> expected(observation.Tensor().begin(),
+                                      observation.Tensor().end());
+    const std::vector<float> row(batch.begin() + i * row_size,
+                                 batch.begin() + (i + 1) * row_size);
+    SPIEL_CHECK_EQ(row, expected);
+  }
+
+  // An empty batch is a no-op.
+  observation.SetFromBatch({}, {}, {});
+}
+
 // Dummy game to test flat joint action logic.
 class FlatJointActionTestGame : public SimMoveGame {
  public:
@@ -165,6 +263,49 @@ void PolicyTest() {
   }
 }
 
+void InternedTabularPolicyTest() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  TabularPolicy tabular = GetRandomPolicy(*game);
+  InternedTabularPolicy interned(tabular);
+
+  // String lookups and id lookups must agree with the source table.
+  for (const auto& [info_state, state_policy] : tabular.PolicyTable()) {
+    SPIEL_CHECK_TRUE(StatePoliciesEqual(interned.GetStatePolicy(info_state),
+                                        state_policy, 1e-12));
+    const int id = interned.KeyId(info_state);
+    SPIEL_CHECK_GE(id, 0);
+    absl::Span<const std::pair<Action, double>> by_id =
+        interned.StatePolicyById(id);
+    SPIEL_CHECK_EQ(by_id.size(), state_policy.size());
+    for (int i = 0; i < by_id.size(); ++i) {
+      SPIEL_CHECK_EQ(by_id[i].first, state_policy[i].first);
+      SPIEL_CHECK_EQ(by_id[i].second, state_policy[i].second);
+    }
+  }
+  SPIEL_CHECK_EQ(interned.KeyId("no such infostate"), -1);
+  SPIEL_CHECK_TRUE(interned.StatePolicyById(-1).empty());
+
+  // Two policies sharing one intern pool must assign equal ids to equal
+  // infostate strings.
+  InternedTabularPolicy uniform(interned.keys());
+  for (const auto& [info_state, state_policy] :
+       GetUniformPolicy(*game).PolicyTable()) {
+    uniform.SetStatePolicy(info_state, state_policy);
+    SPIEL_CHECK_EQ(uniform.KeyId(info_state), interned.KeyId(info_state));
+  }
+
+  // In-place overwrite of an entry with the same number of actions.
+  const std::string some_infostate =
+      tabular.PolicyTable().begin()->first;
+  ActionsAndProbs overwritten = interned.GetStatePolicy(some_infostate);
+  for (auto& action_and_prob : overwritten) {
+    action_and_prob.second = 1.0 / overwritten.size();
+  }
+  interned.SetStatePolicy(some_infostate, overwritten);
+  SPIEL_CHECK_TRUE(StatePoliciesEqual(interned.GetStatePolicy(some_infostate),
+                                      overwritten, 1e-12));
+}
+
 void LeducPokerDeserializeTest() {
   // Example Leduc state: player 1 gets the 0th card, player 2 gets the 3rd card
   // and the first two actions are: check, check.
@@ -200,6 +341,50 @@ void LeducPokerDeserializeTest() {
       serialized_game_and_state);
 }
 
+void FastRngTest() {
+  // Identical seeds yield identical streams; nearby seeds differ.
+  FastRng a(1234), b(1234), c(1235);
+  bool differs = false;
+  for (int i = 0; i < 100; ++i) {
+    // Not named `x`: SPIEL_CHECK_OP declares its own `x` internally.
+    uint64_t va = a();
+    SPIEL_CHECK_EQ(va, b());
+    if (va != c()) differs = true;
+  }
+  SPIEL_CHECK_TRUE(differs);
+
+  // Bounded generation stays in range and hits every value of a small range.
+  std::vector<int> counts(7, 0);
+  for (int i = 0; i < 10000; ++i) {
+    uint64_t v = a.UniformInt(7);
+    SPIEL_CHECK_LT(v, 7);
+    ++counts[v];
+  }
+  for (int count : counts) SPIEL_CHECK_GT(count, 0);
+
+  for (int i = 0; i < 10000; ++i) {
+    double d = a.UniformDouble();
+    SPIEL_CHECK_GE(d, 0.0);
+    SPIEL_CHECK_LT(d, 1.0);
+  }
+
+  // The thread-local helper hands back the same generator on each call.
+  FastRng& tl1 = ThreadLocalFastRng();
+  FastRng& tl2 = ThreadLocalFastRng();
+  SPIEL_CHECK_TRUE(&tl1 == &tl2);
+}
+
+void SampleIndexFromProbsTest() {
+  std::vector<double> probs = {0.25, 0.0, 0.5, 0.25};
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.0), 0);
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.3), 2);
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.74), 2);
+  SPIEL_CHECK_EQ(SampleIndexFromProbs(probs, 0.8), 3);
+  // z at the upper boundary of the accumulated mass falls back to the last
+  // index with positive probability.
+  SPIEL_CHECK_EQ(SampleIndexFromProbs({1.0, 0.0}, 1.0), 0);
+}
+
 void GameParametersTest() {
   // Basic types
   SPIEL_CHECK_TRUE(GameParameter(1).has_int_value());
@@ -304,6 +489,35 @@ void GameParametersTest() {
   SPIEL_CHECK_EQ(game2["param"].string_value(), "val");
 }
 
+void CompiledGameParametersTest() {
+  GameParameters params =
+      GameParametersFromString("durak(rng_seed=7,sampled_deal=True)");
+  CompiledGameParameters compiled(params);
+  SPIEL_CHECK_EQ(compiled.NumFields(), 3);
+
+  // Resolve each field once; reads are typed and by id.
+  int name_id = compiled.FieldId("name");
+  int seed_id = compiled.FieldId("rng_seed");
+  int deal_id = compiled.FieldId("sampled_deal");
+  SPIEL_CHECK_NE(name_id, CompiledGameParameters::kInvalidFieldId);
+  SPIEL_CHECK_NE(seed_id, CompiledGameParameters::kInvalidFieldId);
+  SPIEL_CHECK_NE(deal_id, CompiledGameParameters::kInvalidFieldId);
+  SPIEL_CHECK_EQ(compiled.StringValue(name_id), "durak");
+  SPIEL_CHECK_EQ(compiled.IntValue(seed_id), 7);
+  SPIEL_CHECK_TRUE(compiled.BoolValue(deal_id));
+  SPIEL_CHECK_EQ(compiled.FieldName(seed_id), "rng_seed");
+  SPIEL_CHECK_TRUE(compiled.FieldType(deal_id) ==
+                   GameParameter::Type::kBool);
+  SPIEL_CHECK_EQ(compiled.FieldId("absent"),
+                 CompiledGameParameters::kInvalidFieldId);
+
+  // The text form is rendered once (same object every call) and round-trips
+  // to the original map.
+  SPIEL_CHECK_TRUE(&compiled.ToString() == &compiled.ToString());
+  SPIEL_CHECK_EQ(compiled.ToString(), GameParametersToString(params));
+  SPIEL_CHECK_TRUE(GameParametersFromString(compiled.ToString()) == params);
+}
+
 void PolicySerializationTest() {
   // Check empty tabular policy
   auto policy = std::make_unique<TabularPolicy>();
@@ -344,9 +558,16 @@ int main(int argc, char** argv) {
   open_spiel::testing::KuhnTests();
   open_spiel::testing::GameEqualityTests();
   open_spiel::testing::TicTacToeTests();
+  open_spiel::testing::HistoryTrackingTests();
+  open_spiel::testing::ObserverCachingTests();
+  open_spiel::testing::ObserverBatchWriteTests();
   open_spiel::testing::FlatJointactionTest();
   open_spiel::testing::PolicyTest();
+  open_spiel::testing::InternedTabularPolicyTest();
   open_spiel::testing::LeducPokerDeserializeTest();
+  open_spiel::testing::FastRngTest();
+  open_spiel::testing::SampleIndexFromProbsTest();
   open_spiel::testing::GameParametersTest();
+  open_spiel::testing::CompiledGameParametersTest();
   open_spiel::testing::PolicySerializationTest();
 }
@@ -0,0 +1,123 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/vectorized_environment.h"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+void BatchedKuhnEpisodesTest() {
+  std::shared_ptr<const Game> game = LoadGame("kuhn_poker");
+  constexpr int kNumEnvs = 5;
+  VectorizedEnvironment env(game, kNumEnvs, /*seed=*/2375);
+  SPIEL_CHECK_EQ(env.num_envs(), kNumEnvs);
+  SPIEL_CHECK_EQ(env.observation_size(), game->ObservationTensorSize());
+
+  std::mt19937 rng(817);
+  std::vector<float> batch(kNumEnvs * env.observation_size());
+  int episodes_finished = 0;
+  for (int step = 0; step < 200; ++step) {
+    // The presented states are always decision nodes.
+    std::vector<Action> actions;
+    for (int i = 0; i < kNumEnvs; ++i) {
+      const State& state = env.state(i);
+      SPIEL_CHECK_FALSE(state.IsChanceNode());
+      SPIEL_CHECK_FALSE(state.IsTerminal());
+      SPIEL_CHECK_EQ(env.current_player(i), state.CurrentPlayer());
+      std::vector<Action> legal = state.LegalActions();
+      actions.push_back(
+          legal[std::uniform_int_distribution<int>(0, legal.size() - 1)(rng)]);
+    }
+    env.Step(absl::MakeSpan(actions));
+
+    for (int i = 0; i < kNumEnvs; ++i) {
+      const std::vector<double>& rewards = env.rewards(i);
+      SPIEL_CHECK_EQ(rewards.size(), 2);
+      if (env.episode_ended(i)) {
+        ++episodes_finished;
+        // Kuhn is zero-sum and only pays out at the end.
+        SPIEL_CHECK_FLOAT_NEAR(rewards[0] + rewards[1], 0.0, 1e-12);
+        SPIEL_CHECK_GT(std::abs(rewards[0]), 0.0);
+        // Auto-reset: the environment already shows the next episode.
+        SPIEL_CHECK_FALSE(env.state(i).IsTerminal());
+        SPIEL_CHECK_EQ(env.state(i).MoveNumber(), 2);  // After the deal.
+      } else {
+        SPIEL_CHECK_FLOAT_NEAR(rewards[0], 0.0, 1e-12);
+        SPIEL_CHECK_FLOAT_NEAR(rewards[1], 0.0, 1e-12);
+      }
+    }
+
+    // The batch-major block matches per-state observation tensors.
+    env.FillObservations(absl::MakeSpan(batch));
+    for (int i = 0; i < kNumEnvs; ++i) {
+      std::vector<float> single =
+          env.state(i).ObservationTensor(env.current_player(i));
+      for (int j = 0; j < env.observation_size(); ++j) {
+        SPIEL_CHECK_EQ(batch[i * env.observation_size() + j], single[j]);
+      }
+    }
+  }
+  // Kuhn episodes last at most three decisions, so plenty finished.
+  SPIEL_CHECK_GT(episodes_finished, 100);
+
+  // Reset clears rewards and episode-end flags.
+  env.Reset();
+  for (int i = 0; i < kNumEnvs; ++i) {
+    SPIEL_CHECK_FALSE(env.episode_ended(i));
+    SPIEL_CHECK_FLOAT_NEAR(env.rewards(i)[0], 0.0, 1e-12);
+    SPIEL_CHECK_EQ(env.state(i).MoveNumber(), 2);
+  }
+}
+
+void NoChanceGameTest() {
+  // tic_tac_toe has no chance nodes at all; stepping must still work and
+  // auto-reset to move number zero.
+  std::shared_ptr<const Game> game = LoadGame("tic_tac_toe");
+  VectorizedEnvironment env(game, /*num_envs=*/3, /*seed=*/41);
+  std::mt19937 rng(99);
+  int episodes_finished = 0;
+  for (int step = 0; step < 60; ++step) {
+    std::vector<Action> actions;
+    for (int i = 0; i < env.num_envs(); ++i) {
+      std::vector<Action> legal = env.state(i).LegalActions();
+      actions.push_back(
+          legal[std::uniform_int_distribution<int>(0, legal.size() - 1)(rng)]);
+    }
+    env.Step(absl::MakeSpan(actions));
+    for (int i = 0; i < env.num_envs(); ++i) {
+      if (env.episode_ended(i)) {
+        ++episodes_finished;
+        SPIEL_CHECK_EQ(env.state(i).MoveNumber(), 0);
+      }
+    }
+  }
+  SPIEL_CHECK_GT(episodes_finished, 0);
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::BatchedKuhnEpisodesTest();
+  open_spiel::NoChanceGameTest();
+}
@@ -0,0 +1,112 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_CARD_SET_H_
+#define OPEN_SPIEL_UTILS_CARD_SET_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace card_set {
+
+// Packed card sets for card games with decks of up to 64 cards.
+//
+// A set of cards (a hand, a discard pile, the remaining deck) is stored as a
+// bitmask: bit c is set iff card c is in the set. Membership tests,
+// insertion/removal, counting and intersection are all single instructions,
+// copying a state is a flat memcpy, and iterating a set touches only the
+// cards actually present instead of scanning the whole deck. Card games
+// that keep hands as std::vector<int> with linear scans can adopt this
+// representation wholesale; the layout helpers below cover the common
+// suit-major card indexing (card = suit * num_ranks + rank).
+
+using CardSet = uint64_t;
+
+// The single-card set {card}.
+inline constexpr CardSet CardBit(int card) { return CardSet{1} << card; }
+
+// The set of all cards 0 <= c < num_cards.
+inline constexpr CardSet FullDeck(int num_cards) {
+  return num_cards >= 64 ? ~CardSet{0} : (CardSet{1} << num_cards) - 1;
+}
+
+inline constexpr bool Contains(CardSet cards, int card) {
+  return (cards & CardBit(card)) != 0;
+}
+
+inline int CardSetSize(CardSet cards) { return __builtin_popcountll(cards); }
+
+// The smallest card in the set. The set must be non-empty.
+inline int LowestCard(CardSet cards) { return __builtin_ctzll(cards); }
+
+// Removes and returns the smallest card in the set, which must be non-empty.
+inline int PopLowestCard(CardSet* cards) {
+  int card = LowestCard(*cards);
+  *cards &= *cards - 1;
+  return card;
+}
+
+// Calls fn(card) for every card in the set, in increasing order.
+template <typename Fn>
+void ForEachCard(CardSet cards, const Fn& fn) {
+  while (cards) {
+    fn(PopLowestCard(&cards));
+  }
+}
+
+inline std::vector<int> CardSetToVector(CardSet cards) {
+  std::vector<int> result;
+  result.reserve(CardSetSize(cards));
+  while (cards) result.push_back(PopLowestCard(&cards));
+  return result;
+}
+
+// Layout helpers for suit-major card indices: card = suit * num_ranks + rank.
+inline constexpr int SuitOf(int card, int num_ranks) {
+  return card / num_ranks;
+}
+inline constexpr int RankOf(int card, int num_ranks) {
+  return card % num_ranks;
+}
+
+// All cards of the given suit / rank.
+inline constexpr CardSet SuitMask(int suit, int num_ranks) {
+  return FullDeck(num_ranks) << (suit * num_ranks);
+}
+inline constexpr CardSet RankMask(int rank, int num_ranks, int num_suits) {
+  CardSet mask = 0;
+  for (int suit = 0; suit < num_suits; ++suit) {
+    mask |= CardBit(suit * num_ranks + rank);
+  }
+  return mask;
+}
+
+// Fisher-Yates shuffle of deck[begin, end). Used for fast dealing in
+// rollouts, where std::shuffle's generic machinery shows up in profiles.
+inline void ShuffleDeck(FastRng* rng, std::vector<int>& deck, int begin,
+                        int end) {
+  for (int i = begin; i < end - 1; ++i) {
+    int j = i + static_cast<int>(rng->UniformInt(end - i));
+    std::swap(deck[i], deck[j]);
+  }
+}
+
+}  // namespace card_set
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_CARD_SET_H_
@@ -0,0 +1,110 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/card_set.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace card_set {
+namespace {
+
+void TestBasicOps() {
+  CardSet cards = 0;
+  SPIEL_CHECK_EQ(CardSetSize(cards), 0);
+
+  cards |= CardBit(0);
+  cards |= CardBit(17);
+  cards |= CardBit(63);
+  SPIEL_CHECK_EQ(CardSetSize(cards), 3);
+  SPIEL_CHECK_TRUE(Contains(cards, 17));
+  SPIEL_CHECK_FALSE(Contains(cards, 18));
+  SPIEL_CHECK_EQ(LowestCard(cards), 0);
+
+  cards &= ~CardBit(0);
+  SPIEL_CHECK_EQ(LowestCard(cards), 17);
+  SPIEL_CHECK_EQ(PopLowestCard(&cards), 17);
+  SPIEL_CHECK_EQ(cards, CardBit(63));
+
+  SPIEL_CHECK_EQ(FullDeck(0), 0);
+  SPIEL_CHECK_EQ(CardSetSize(FullDeck(36)), 36);
+  SPIEL_CHECK_EQ(CardSetSize(FullDeck(52)), 52);
+  SPIEL_CHECK_EQ(FullDeck(64), ~CardSet{0});
+}
+
+void TestIteration() {
+  const std::vector<int> expected = {3, 7, 21, 35, 51};
+  CardSet cards = 0;
+  for (int card : expected) cards |= CardBit(card);
+
+  SPIEL_CHECK_EQ(CardSetToVector(cards), expected);
+
+  std::vector<int> visited;
+  ForEachCard(cards, [&visited](int card) { visited.push_back(card); });
+  SPIEL_CHECK_EQ(visited, expected);
+}
+
+void TestLayoutHelpers() {
+  // A 36-card deck: 4 suits of 9 ranks, suit-major.
+  constexpr int kNumRanks = 9;
+  constexpr int kNumSuits = 4;
+  SPIEL_CHECK_EQ(SuitOf(0, kNumRanks), 0);
+  SPIEL_CHECK_EQ(RankOf(0, kNumRanks), 0);
+  SPIEL_CHECK_EQ(SuitOf(35, kNumRanks), 3);
+  SPIEL_CHECK_EQ(RankOf(35, kNumRanks), 8);
+
+  for (int suit = 0; suit < kNumSuits; ++suit) {
+    CardSet mask = SuitMask(suit, kNumRanks);
+    SPIEL_CHECK_EQ(CardSetSize(mask), kNumRanks);
+    ForEachCard(mask, [suit](int card) {
+      SPIEL_CHECK_EQ(SuitOf(card, kNumRanks), suit);
+    });
+  }
+  for (int rank = 0; rank < kNumRanks; ++rank) {
+    CardSet mask = RankMask(rank, kNumRanks, kNumSuits);
+    SPIEL_CHECK_EQ(CardSetSize(mask), kNumSuits);
+    ForEachCard(mask, [rank](int card) {
+      SPIEL_CHECK_EQ(RankOf(card, kNumRanks), rank);
+    });
+  }
+}
+
+void TestShuffleDeck() {
+  FastRng rng(1234);
+  std::vector<int> deck;
+  for (int i = 0; i < 52; ++i) deck.push_back(i);
+  ShuffleDeck(&rng, deck, 0, static_cast<int>(deck.size()));
+  // Still a permutation of the full deck.
+  std::vector<int> sorted = deck;
+  std::sort(sorted.begin(), sorted.end());
+  for (int i = 0; i < 52; ++i) SPIEL_CHECK_EQ(sorted[i], i);
+  // Partial shuffles leave the prefix untouched.
+  std::vector<int> deck2 = sorted;
+  ShuffleDeck(&rng, deck2, 10, static_cast<int>(deck2.size()));
+  for (int i = 0; i < 10; ++i) SPIEL_CHECK_EQ(deck2[i], i);
+}
+
+}  // namespace
+}  // namespace card_set
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::card_set::TestBasicOps();
+  open_spiel::card_set::TestIteration();
+  open_spiel::card_set::TestLayoutHelpers();
+  open_spiel::card_set::TestShuffleDeck();
+}
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <iterator>
 #include <numeric>
@@ -160,6 +161,70 @@ std::vector<T> UnrankPermutation(const std::vector<T>& v, int k) {
   return perm;
 }
 
+// Combinatorial ranking. ColexRank maps a bitmask with k set bits to its
+// dense index in {0, ..., Binomial(n, k) - 1} under the colexicographic
+// order (masks compared as integers), and ColexUnrank inverts it. This is a
+// perfect index for fixed-size card sets, e.g. "k cards out of 36", so
+// tables over hands can be flat arrays instead of hash maps. Both run in a
+// few table lookups per set bit.
+
+namespace internal {
+
+inline constexpr int kBinomialMaxN = 64;
+
+// Pascal's triangle, computed at compile time. All entries for n <= 64 fit
+// in a uint64_t (the largest is Binomial(64, 32) ~ 1.8e18).
+struct BinomialTable {
+  uint64_t c[kBinomialMaxN + 1][kBinomialMaxN + 1] = {};
+  constexpr BinomialTable() {
+    for (int n = 0; n <= kBinomialMaxN; ++n) {
+      c[n][0] = 1;
+      for (int k = 1; k <= n; ++k) {
+        c[n][k] = c[n - 1][k - 1] + c[n - 1][k];
+      }
+    }
+  }
+};
+
+inline constexpr BinomialTable kBinomialTable{};
+
+}  // namespace internal
+
+// n choose k, from a compile-time table; 0 outside 0 <= k <= n <= 64.
+constexpr uint64_t Binomial(int n, int k) {
+  return (k < 0 || k > n || n > internal::kBinomialMaxN)
+             ? 0
+             : internal::kBinomialTable.c[n][k];
+}
+
+// Colex rank of `mask` among all masks with the same number of set bits:
+// rank = sum over set bits of Binomial(bit_position, j) where j counts set
+// bits from the lowest (1-based).
+constexpr uint64_t ColexRank(uint64_t mask) {
+  uint64_t rank = 0;
+  int j = 0;
+  for (; mask != 0; mask &= mask - 1) {
+    rank += Binomial(__builtin_ctzll(mask), ++j);
+  }
+  return rank;
+}
+
+// Inverse of ColexRank for masks with exactly k set bits: greedily places
+// the highest bit first, taking the largest position i with
+// Binomial(i, j) <= remaining rank.
+constexpr uint64_t ColexUnrank(uint64_t rank, int k) {
+  uint64_t mask = 0;
+  for (int j = k; j > 0; --j) {
+    int i = j - 1;
+    while (i + 1 < internal::kBinomialMaxN && Binomial(i + 1, j) <= rank) {
+      ++i;
+    }
+    mask |= uint64_t{1} << i;
+    rank -= Binomial(i, j);
+  }
+  return mask;
+}
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_UTILS_COMBINATORICS_H_
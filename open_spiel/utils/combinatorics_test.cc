@@ -14,6 +14,7 @@
 
 #include "open_spiel/utils/combinatorics.h"
 
+#include <cstdint>
 #include <cstdlib>
 #include <string>
 
@@ -92,6 +93,42 @@ void UnrankPermutationTest() {
   }
 }
 
+void TestBinomial() {
+  SPIEL_CHECK_EQ(Binomial(0, 0), 1);
+  SPIEL_CHECK_EQ(Binomial(5, 2), 10);
+  SPIEL_CHECK_EQ(Binomial(36, 6), 1947792);
+  SPIEL_CHECK_EQ(Binomial(64, 32), uint64_t{1832624140942590534});
+  SPIEL_CHECK_EQ(Binomial(3, 5), 0);   // k > n.
+  SPIEL_CHECK_EQ(Binomial(5, -1), 0);  // k < 0.
+
+  // Usable in constant expressions, e.g. as an array size.
+  static_assert(Binomial(6, 3) == 20, "Binomial should be constexpr");
+}
+
+void TestColexRankUnrank() {
+  // Ranks of all 3-subsets of 8 elements are a bijection onto
+  // {0, ..., Binomial(8, 3) - 1}, in increasing mask (colex) order.
+  uint64_t expected_rank = 0;
+  for (uint64_t mask = 0; mask < (1 << 8); ++mask) {
+    if (__builtin_popcountll(mask) != 3) continue;
+    SPIEL_CHECK_EQ(ColexRank(mask), expected_rank);
+    SPIEL_CHECK_EQ(ColexUnrank(expected_rank, 3), mask);
+    ++expected_rank;
+  }
+  SPIEL_CHECK_EQ(expected_rank, Binomial(8, 3));
+
+  // Extremes of a 6-card hand out of 36.
+  uint64_t lowest = (uint64_t{1} << 6) - 1;
+  uint64_t highest = lowest << 30;
+  SPIEL_CHECK_EQ(ColexRank(lowest), 0);
+  SPIEL_CHECK_EQ(ColexRank(highest), Binomial(36, 6) - 1);
+  SPIEL_CHECK_EQ(ColexUnrank(Binomial(36, 6) - 1, 6), highest);
+
+  // The empty set.
+  SPIEL_CHECK_EQ(ColexRank(0), 0);
+  SPIEL_CHECK_EQ(ColexUnrank(0, 0), 0);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -101,4 +138,6 @@ int main(int argc, char** argv) {
   open_spiel::TestPowerSet();
   open_spiel::TestVariationsWithoutRepetition();
   open_spiel::UnrankPermutationTest();
+  open_spiel::TestBinomial();
+  open_spiel::TestColexRankUnrank();
 }
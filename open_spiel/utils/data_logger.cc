@@ -14,6 +14,11 @@
 
 #include "open_spiel/utils/data_logger.h"
 
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
 #include "open_spiel/abseil-cpp/absl/strings/str_format.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_join.h"
 #include "open_spiel/abseil-cpp/absl/time/clock.h"
@@ -50,4 +55,225 @@ void DataLoggerJsonLines::Flush() { fd_.Flush(); }
 
 DataLoggerJsonLines::~DataLoggerJsonLines() { Flush(); }
 
+namespace {
+
+// Binary record encoding: each record is framed as a varint byte length
+// followed by a tagged value. Integers (and all lengths) are varint-packed,
+// with zigzag encoding for signed values; doubles are 8 raw little-endian
+// bytes.
+enum BinaryTag : uint8_t {
+  kTagNull = 0,
+  kTagFalse = 1,
+  kTagTrue = 2,
+  kTagInt = 3,
+  kTagDouble = 4,
+  kTagString = 5,
+  kTagArray = 6,
+  kTagObject = 7,
+};
+
+void AppendVarint(uint64_t value, std::string* out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+uint64_t ZigZagEncode(int64_t v) {
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+int64_t ZigZagDecode(uint64_t v) {
+  return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+}
+
+void AppendValue(const json::Value& value, std::string* out);
+
+void AppendObject(const json::Object& obj, std::string* out) {
+  out->push_back(kTagObject);
+  AppendVarint(obj.size(), out);
+  for (const auto& [key, value] : obj) {
+    AppendVarint(key.size(), out);
+    out->append(key);
+    AppendValue(value, out);
+  }
+}
+
+void AppendValue(const json::Value& value, std::string* out) {
+  if (value.IsNull()) {
+    out->push_back(kTagNull);
+  } else if (value.IsBool()) {
+    out->push_back(value.GetBool() ? kTagTrue : kTagFalse);
+  } else if (value.IsInt()) {
+    out->push_back(kTagInt);
+    AppendVarint(ZigZagEncode(value.GetInt()), out);
+  } else if (value.IsDouble()) {
+    out->push_back(kTagDouble);
+    double d = value.GetDouble();
+    char buf[sizeof(double)];
+    std::memcpy(buf, &d, sizeof(double));
+    out->append(buf, sizeof(double));
+  } else if (value.IsString()) {
+    const std::string& str = value.GetString();
+    out->push_back(kTagString);
+    AppendVarint(str.size(), out);
+    out->append(str);
+  } else if (value.IsArray()) {
+    const json::Array& array = value.GetArray();
+    out->push_back(kTagArray);
+    AppendVarint(array.size(), out);
+    for (const json::Value& element : array) {
+      AppendValue(element, out);
+    }
+  } else {
+    AppendObject(value.GetObject(), out);
+  }
+}
+
+std::string SerializeRecord(const json::Object& record) {
+  std::string payload;
+  AppendObject(record, &payload);
+  std::string framed;
+  AppendVarint(payload.size(), &framed);
+  framed += payload;
+  return framed;
+}
+
+uint64_t ReadVarint(absl::string_view data, size_t* pos) {
+  uint64_t value = 0;
+  int shift = 0;
+  while (true) {
+    if (*pos >= data.size()) SpielFatalError("Truncated varint in binary log");
+    uint8_t byte = static_cast<uint8_t>(data[(*pos)++]);
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) return value;
+    shift += 7;
+    if (shift >= 64) SpielFatalError("Oversized varint in binary log");
+  }
+}
+
+std::string ReadBytes(absl::string_view data, size_t* pos, uint64_t count) {
+  if (data.size() - *pos < count) {
+    SpielFatalError("Truncated value in binary log");
+  }
+  std::string out(data.substr(*pos, count));
+  *pos += count;
+  return out;
+}
+
+json::Value ReadValue(absl::string_view data, size_t* pos) {
+  if (*pos >= data.size()) SpielFatalError("Truncated value in binary log");
+  uint8_t tag = static_cast<uint8_t>(data[(*pos)++]);
+  switch (tag) {
+    case kTagNull:
+      return json::Null();
+    case kTagFalse:
+      return false;
+    case kTagTrue:
+      return true;
+    case kTagInt:
+      return ZigZagDecode(ReadVarint(data, pos));
+    case kTagDouble: {
+      std::string raw = ReadBytes(data, pos, sizeof(double));
+      double d;
+      std::memcpy(&d, raw.data(), sizeof(double));
+      return d;
+    }
+    case kTagString:
+      return ReadBytes(data, pos, ReadVarint(data, pos));
+    case kTagArray: {
+      uint64_t count = ReadVarint(data, pos);
+      json::Array array;
+      array.reserve(count);
+      for (uint64_t i = 0; i < count; ++i) {
+        array.push_back(ReadValue(data, pos));
+      }
+      return array;
+    }
+    case kTagObject: {
+      uint64_t count = ReadVarint(data, pos);
+      json::Object obj;
+      for (uint64_t i = 0; i < count; ++i) {
+        std::string key = ReadBytes(data, pos, ReadVarint(data, pos));
+        obj.emplace(std::move(key), ReadValue(data, pos));
+      }
+      return obj;
+    }
+    default:
+      SpielFatalError("Unknown tag in binary log");
+  }
+}
+
+}  // namespace
+
+DataLoggerBinary::DataLoggerBinary(const std::string& path,
+                                   const std::string& name, int max_queue_size,
+                                   absl::Time start_time)
+    : fd_(absl::StrFormat("%s/%s.binlog", path, name), "w"),
+      start_time_(start_time),
+      queue_(max_queue_size),
+      writer_([this]() { WriteLoop(); }) {}
+
+void DataLoggerBinary::Write(DataLogger::Record record) {
+  static absl::TimeZone utc = absl::UTCTimeZone();
+  absl::Time now = absl::Now();
+  record.insert({
+      {"time_str", absl::FormatTime("%Y-%m-%d %H:%M:%E6S %z", now, utc)},
+      {"time_abs", absl::ToUnixMicros(now) / 1000000.},
+      {"time_rel", absl::ToDoubleSeconds(now - start_time_)},
+  });
+  if (queue_.Push(SerializeRecord(record))) {
+    ++pushed_;
+  }
+}
+
+void DataLoggerBinary::WriteLoop() {
+  while (absl::optional<std::string> record = queue_.Pop()) {
+    {
+      absl::MutexLock lock(&fd_mutex_);
+      fd_.Write(*record);
+    }
+    ++written_;
+  }
+}
+
+void DataLoggerBinary::Flush() {
+  // Wait for everything queued before this call to hit the writer thread,
+  // then flush the file itself.
+  int64_t target = pushed_;
+  while (written_ < target) {
+    absl::SleepFor(absl::Milliseconds(1));
+  }
+  absl::MutexLock lock(&fd_mutex_);
+  fd_.Flush();
+}
+
+DataLoggerBinary::~DataLoggerBinary() {
+  queue_.BlockNewValues();
+  writer_.join();
+  fd_.Flush();
+}
+
+void ConvertBinaryLogToJsonLines(const std::string& binary_path,
+                                 const std::string& jsonl_path) {
+  std::string contents = file::ReadContentsFromFile(binary_path, "r");
+  file::File out(jsonl_path, "w");
+  absl::string_view data(contents);
+  size_t pos = 0;
+  while (pos < data.size()) {
+    uint64_t length = ReadVarint(data, &pos);
+    size_t record_end = pos + length;
+    if (record_end > data.size()) {
+      SpielFatalError("Truncated record in binary log");
+    }
+    json::Value record = ReadValue(data, &pos);
+    if (pos != record_end || !record.IsObject()) {
+      SpielFatalError("Malformed record in binary log");
+    }
+    out.Write(json::ToString(record.GetObject()));
+    out.Write("\n");
+  }
+}
+
 }  // namespace open_spiel
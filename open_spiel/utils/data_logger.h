@@ -15,13 +15,18 @@
 #ifndef OPEN_SPIEL_UTILS_DATA_LOGGER_H_
 #define OPEN_SPIEL_UTILS_DATA_LOGGER_H_
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 #include "open_spiel/abseil-cpp/absl/time/time.h"
 #include "open_spiel/utils/file.h"
 #include "open_spiel/utils/json.h"
+#include "open_spiel/utils/thread.h"
+#include "open_spiel/utils/threaded_queue.h"
 
 namespace open_spiel {
 
@@ -58,6 +63,44 @@ class DataLoggerJsonLines : public DataLogger {
   absl::Time start_time_;
 };
 
+// Writes a compact binary record stream to "<path>/<name>.binlog". Each
+// record is a length-prefixed, varint-packed encoding of the json object,
+// serialized on the calling thread but written to disk by a background
+// thread, so Write() never blocks on file I/O. Use
+// ConvertBinaryLogToJsonLines below for offline export.
+class DataLoggerBinary : public DataLogger {
+ public:
+  explicit DataLoggerBinary(const std::string& path, const std::string& name,
+                            int max_queue_size = 1024,
+                            absl::Time start_time = absl::Now());
+  ~DataLoggerBinary() override;
+
+  // The binary logger owns a writer thread, so it is neither copyable nor
+  // movable.
+  DataLoggerBinary(const DataLoggerBinary&) = delete;
+  DataLoggerBinary& operator=(const DataLoggerBinary&) = delete;
+
+  void Write(Record record) override;
+  // Blocks until everything written so far has reached the file.
+  void Flush() override;
+
+ private:
+  void WriteLoop();
+
+  file::File fd_;
+  absl::Time start_time_;
+  absl::Mutex fd_mutex_;
+  std::atomic<int64_t> pushed_{0};
+  std::atomic<int64_t> written_{0};
+  ThreadedQueue<std::string> queue_;
+  Thread writer_;  // Keep last: the write loop uses the members above.
+};
+
+// Decodes a binary log written by DataLoggerBinary and rewrites it in
+// http://jsonlines.org/ format for offline analysis.
+void ConvertBinaryLogToJsonLines(const std::string& binary_path,
+                                 const std::string& jsonl_path);
+
 class DataLoggerNoop : public DataLogger {
  public:
   ~DataLoggerNoop() override = default;
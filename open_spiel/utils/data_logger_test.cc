@@ -71,9 +71,60 @@ void TestDataLogger() {
   SPIEL_CHECK_TRUE(file::Remove(dir));
 }
 
+void TestDataLoggerBinary() {
+  std::string val = std::to_string(std::rand());  // NOLINT
+  std::string tmp_dir = file::GetTmpDir();
+  std::string dir = tmp_dir + "/open_spiel-test-" + val;
+  std::string binary_filename = dir + "/binary-test.binlog";
+  std::string jsonl_filename = dir + "/binary-test.jsonl";
+
+  SPIEL_CHECK_TRUE(file::Mkdir(dir));
+
+  {
+    DataLoggerBinary logger(dir, "binary-test");
+    logger.Write({{"step", 1},
+                  {"avg", 1.5},
+                  {"name", "first"},
+                  {"values", json::Array({1, 2, 3})}});
+    logger.Write({{"step", 2}, {"avg", 2.5}, {"done", true}});
+    logger.Flush();
+    SPIEL_CHECK_TRUE(file::Exists(binary_filename));
+  }
+
+  ConvertBinaryLogToJsonLines(binary_filename, jsonl_filename);
+
+  {
+    file::File f(jsonl_filename, "r");
+    std::vector<std::string> lines = absl::StrSplit(f.ReadContents(), '\n');
+    SPIEL_CHECK_EQ(lines.size(), 3);
+    SPIEL_CHECK_EQ(lines[2], "");
+
+    json::Object obj1 = json::FromString(lines[0])->GetObject();
+    SPIEL_CHECK_EQ(obj1["step"], 1);
+    SPIEL_CHECK_EQ(obj1["avg"], 1.5);
+    SPIEL_CHECK_EQ(obj1["name"], "first");
+    SPIEL_CHECK_EQ(obj1["values"], json::Array({1, 2, 3}));
+    SPIEL_CHECK_TRUE(obj1["time_str"].IsString());
+    SPIEL_CHECK_TRUE(obj1["time_abs"].IsDouble());
+    SPIEL_CHECK_GT(obj1["time_abs"].GetDouble(), 1'500'000'000);  // July 2017
+
+    json::Object obj2 = json::FromString(lines[1])->GetObject();
+    SPIEL_CHECK_EQ(obj2["step"], 2);
+    SPIEL_CHECK_EQ(obj2["avg"], 2.5);
+    SPIEL_CHECK_EQ(obj2["done"], true);
+
+    SPIEL_CHECK_LE(obj1["time_abs"].GetDouble(), obj2["time_abs"].GetDouble());
+  }
+
+  SPIEL_CHECK_TRUE(file::Remove(binary_filename));
+  SPIEL_CHECK_TRUE(file::Remove(jsonl_filename));
+  SPIEL_CHECK_TRUE(file::Remove(dir));
+}
+
 }  // namespace
 }  // namespace open_spiel
 
 int main(int argc, char** argv) {
   open_spiel::TestDataLogger();
+  open_spiel::TestDataLoggerBinary();
 }
@@ -28,12 +28,16 @@
 #define unlink(file) _unlink(file)
 #define rmdir(dir) _rmdir(dir)
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <string>
+#include <utility>
 
 #include "open_spiel/spiel_utils.h"
 
@@ -88,6 +92,151 @@ std::int64_t File::Length() {
   return length;
 }
 
+MappedFile::MappedFile(const std::string& filename) {
+#ifndef _WIN32
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    SpielFatalError("MappedFile: failed to open " + filename);
+  }
+  struct stat info;
+  SPIEL_CHECK_EQ(fstat(fd, &info), 0);
+  size_ = info.st_size;
+  if (size_ > 0) {
+    void* mapping = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);  // The mapping keeps the file alive.
+    if (mapping == MAP_FAILED) {
+      SpielFatalError("MappedFile: mmap failed for " + filename);
+    }
+    data_ = static_cast<const char*>(mapping);
+    mapped_ = true;
+  } else {
+    close(fd);
+    data_ = fallback_.data();  // Empty but valid view.
+  }
+#else
+  fallback_ = ReadContentsFromFile(filename, "rb");
+  data_ = fallback_.data();
+  size_ = fallback_.size();
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (mapped_) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& other)
+    : data_(other.data_),
+      size_(other.size_),
+      mapped_(other.mapped_),
+      fallback_(std::move(other.fallback_)) {
+  if (!mapped_) data_ = fallback_.data();  // The string's buffer may move.
+  other.data_ = nullptr;
+  other.size_ = 0;
+  other.mapped_ = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) {
+#ifndef _WIN32
+  if (mapped_) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+#endif
+  data_ = other.data_;
+  size_ = other.size_;
+  mapped_ = other.mapped_;
+  fallback_ = std::move(other.fallback_);
+  if (!mapped_) data_ = fallback_.data();
+  other.data_ = nullptr;
+  other.size_ = 0;
+  other.mapped_ = false;
+  return *this;
+}
+
+BufferedReader::BufferedReader(File file, std::int64_t buffer_size)
+    : file_(std::move(file)),
+      buffer_size_(std::max<std::int64_t>(buffer_size, 1)) {}
+
+void BufferedReader::Fill() {
+  if (eof_) return;
+  if (pos_ > 0) {  // Drop already-consumed bytes before reading more.
+    buffer_.erase(0, pos_);
+    pos_ = 0;
+  }
+  std::string chunk = file_.Read(buffer_size_);
+  if (chunk.empty()) {
+    eof_ = true;
+  } else {
+    buffer_ += chunk;
+  }
+}
+
+std::string BufferedReader::Read(std::int64_t count) {
+  while (!eof_ &&
+         static_cast<std::int64_t>(buffer_.size() - pos_) < count) {
+    Fill();
+  }
+  std::int64_t take =
+      std::min<std::int64_t>(count, buffer_.size() - pos_);
+  std::string out = buffer_.substr(pos_, take);
+  pos_ += take;
+  return out;
+}
+
+absl::optional<std::string> BufferedReader::ReadLine() {
+  while (true) {
+    size_t newline = buffer_.find('\n', pos_);
+    if (newline != std::string::npos) {
+      std::string line = buffer_.substr(pos_, newline - pos_);
+      pos_ = newline + 1;
+      return line;
+    }
+    if (eof_) {
+      if (pos_ >= buffer_.size()) return absl::nullopt;
+      std::string line = buffer_.substr(pos_);  // Last line, no newline.
+      pos_ = buffer_.size();
+      return line;
+    }
+    Fill();
+  }
+}
+
+bool BufferedReader::AtEnd() {
+  if (pos_ < buffer_.size()) return false;
+  Fill();
+  return eof_ && pos_ >= buffer_.size();
+}
+
+BufferedWriter::BufferedWriter(File file, std::int64_t buffer_size)
+    : file_(std::move(file)),
+      buffer_size_(std::max<std::int64_t>(buffer_size, 1)) {
+  buffer_.reserve(buffer_size_);
+}
+
+BufferedWriter::~BufferedWriter() { Flush(); }
+
+bool BufferedWriter::Write(absl::string_view str) {
+  if (buffer_.size() + str.size() > buffer_size_ && !Flush()) {
+    return false;
+  }
+  if (str.size() >= buffer_size_) {
+    return file_.Write(str);  // Too big to buffer; write it through.
+  }
+  buffer_.append(str.data(), str.size());
+  return true;
+}
+
+bool BufferedWriter::Flush() {
+  if (!buffer_.empty()) {
+    if (!file_.Write(buffer_)) return false;
+    buffer_.clear();
+  }
+  return file_.Flush();
+}
+
 std::string ReadContentsFromFile(const std::string& filename,
                                  const std::string& mode) {
   File f(filename, mode);
@@ -20,6 +20,7 @@
 #include <string>
 
 #include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
 
 namespace open_spiel::file {
 
@@ -55,6 +56,80 @@ class File {
   std::unique_ptr<FileImpl> fd_;
 };
 
+// A read-only view of a whole file. On POSIX the file is mmap'ed: opening is
+// O(1) regardless of size, pages are faulted in on demand, and concurrent
+// readers share the page cache instead of each holding a private copy. On
+// Windows the file is read into memory instead. The view stays valid for the
+// lifetime of this object. Dies if the file can't be opened.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  // Move only.
+  MappedFile(MappedFile&& other);
+  MappedFile& operator=(MappedFile&& other);
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* data() const { return data_; }
+  std::int64_t size() const { return size_; }
+  absl::string_view view() const {
+    return absl::string_view(data_, static_cast<size_t>(size_));
+  }
+
+ private:
+  const char* data_ = nullptr;
+  std::int64_t size_ = 0;
+  bool mapped_ = false;   // True when data_ points into an mmap region.
+  std::string fallback_;  // Holds the bytes when not mmap'ed.
+};
+
+// Sequential reader over a File with a fixed-size readahead buffer, for
+// streaming through large files without loading them whole or issuing one
+// stdio call per small read.
+class BufferedReader {
+ public:
+  explicit BufferedReader(File file, std::int64_t buffer_size = 1 << 20);
+
+  // Returns up to count bytes; fewer only at the end of the file.
+  std::string Read(std::int64_t count);
+  // The next '\n'-terminated line, without the newline; nullopt at the end.
+  absl::optional<std::string> ReadLine();
+  bool AtEnd();
+
+ private:
+  void Fill();  // Read the next buffer_size_ bytes from the file.
+
+  File file_;
+  std::int64_t buffer_size_;
+  std::string buffer_;
+  size_t pos_ = 0;
+  bool eof_ = false;
+};
+
+// Sequential writer that batches small Write()s into buffer-sized file
+// writes. Writes at least buffer_size bytes long bypass the buffer.
+class BufferedWriter {
+ public:
+  explicit BufferedWriter(File file, std::int64_t buffer_size = 1 << 20);
+  ~BufferedWriter();  // Flushes.
+
+  // Move only (like File).
+  BufferedWriter(BufferedWriter&& other) = default;
+  BufferedWriter& operator=(BufferedWriter&& other) = default;
+  BufferedWriter(const BufferedWriter&) = delete;
+  BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+  bool Write(absl::string_view str);
+  bool Flush();
+
+ private:
+  File file_;
+  size_t buffer_size_;
+  std::string buffer_;
+};
+
 // Reads the file at filename to a string. Dies if this doesn't succeed.
 std::string ReadContentsFromFile(const std::string& filename,
                                  const std::string& mode);
@@ -16,7 +16,9 @@
 
 #include <cstdlib>
 #include <string>
+#include <utility>
 
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
 #include "open_spiel/spiel_utils.h"
 
 namespace open_spiel::file {
@@ -87,9 +89,80 @@ void TestFile() {
   SPIEL_CHECK_FALSE(Exists(dir));
 }
 
+void TestMappedFile() {
+  std::string val = std::to_string(std::rand());  // NOLINT
+  std::string dir = file::GetTmpDir() + "/open_spiel-test-" + val;
+  std::string filename = dir + "/mapped-file.txt";
+  SPIEL_CHECK_TRUE(Mkdir(dir));
+
+  std::string expected = "hello mapped world " + val;
+  WriteContentsToFile(filename, "w", expected);
+
+  {
+    MappedFile mapped(filename);
+    SPIEL_CHECK_EQ(mapped.size(), expected.size());
+    SPIEL_CHECK_EQ(mapped.view(), expected);
+    SPIEL_CHECK_EQ(std::string(mapped.data() + 6, 6), "mapped");
+
+    // Move constructor/assignment keep the view valid.
+    MappedFile moved = std::move(mapped);
+    SPIEL_CHECK_EQ(moved.view(), expected);
+  }
+
+  // An empty file maps to an empty but valid view.
+  std::string empty_filename = dir + "/empty.txt";
+  WriteContentsToFile(empty_filename, "w", "");
+  {
+    MappedFile mapped(empty_filename);
+    SPIEL_CHECK_EQ(mapped.size(), 0);
+    SPIEL_CHECK_TRUE(mapped.view().empty());
+  }
+
+  SPIEL_CHECK_TRUE(Remove(empty_filename));
+  SPIEL_CHECK_TRUE(Remove(filename));
+  SPIEL_CHECK_TRUE(Remove(dir));
+}
+
+void TestBufferedReaderWriter() {
+  std::string val = std::to_string(std::rand());  // NOLINT
+  std::string dir = file::GetTmpDir() + "/open_spiel-test-" + val;
+  std::string filename = dir + "/buffered.txt";
+  SPIEL_CHECK_TRUE(Mkdir(dir));
+
+  constexpr int kLines = 100;
+  {
+    // A tiny buffer forces several flushes; big writes pass through.
+    BufferedWriter writer(File(filename, "w"), /*buffer_size=*/64);
+    for (int i = 0; i < kLines; ++i) {
+      SPIEL_CHECK_TRUE(writer.Write("line " + std::to_string(i) + "\n"));
+    }
+    SPIEL_CHECK_TRUE(writer.Write(std::string(1000, 'x') + "\n"));
+    // The destructor flushes the remainder.
+  }
+
+  {
+    BufferedReader reader(File(filename, "r"), /*buffer_size=*/64);
+    for (int i = 0; i < kLines; ++i) {
+      absl::optional<std::string> line = reader.ReadLine();
+      SPIEL_CHECK_TRUE(line.has_value());
+      SPIEL_CHECK_EQ(*line, "line " + std::to_string(i));
+    }
+    SPIEL_CHECK_FALSE(reader.AtEnd());
+    SPIEL_CHECK_EQ(reader.Read(1000), std::string(1000, 'x'));
+    SPIEL_CHECK_EQ(reader.Read(10), "\n");  // Short read at end of file.
+    SPIEL_CHECK_TRUE(reader.AtEnd());
+    SPIEL_CHECK_FALSE(reader.ReadLine().has_value());
+  }
+
+  SPIEL_CHECK_TRUE(Remove(filename));
+  SPIEL_CHECK_TRUE(Remove(dir));
+}
+
 }  // namespace
 }  // namespace open_spiel::file
 
 int main(int argc, char** argv) {
   open_spiel::file::TestFile();
+  open_spiel::file::TestMappedFile();
+  open_spiel::file::TestBufferedReaderWriter();
 }
@@ -0,0 +1,425 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/json_fast.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "open_spiel/abseil-cpp/absl/strings/match.h"
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel::json {
+
+namespace {
+
+void SkipWhitespace(absl::string_view* str) {
+  while (!str->empty()) {
+    switch (str->front()) {
+      case ' ':
+      case '\n':
+      case '\r':
+      case '\t':
+        str->remove_prefix(1);
+        break;
+      default:
+        return;
+    }
+  }
+}
+
+}  // namespace
+
+bool FlatJson::Fail(absl::string_view message, absl::string_view at) {
+  error_ = absl::StrCat(
+      message, " at: ",
+      at.substr(0, std::min<size_t>(30, at.size())));
+  return false;
+}
+
+bool FlatJson::ParseString(absl::string_view* str, uint32_t* begin,
+                           uint32_t* end, bool* in_scratch) {
+  if (str->empty() || str->front() != '"') {
+    return Fail("Expected '\"'", *str);
+  }
+  str->remove_prefix(1);
+  // Fast path: no escapes, so the payload is a view into the input.
+  size_t i = 0;
+  for (; i < str->size(); ++i) {
+    const char c = (*str)[i];
+    if (c == '"') {
+      *begin = static_cast<uint32_t>(str->data() - input_begin_);
+      *end = *begin + static_cast<uint32_t>(i);
+      *in_scratch = false;
+      str->remove_prefix(i + 1);
+      return true;
+    }
+    if (c == '\\') break;
+  }
+  if (i == str->size()) {
+    return Fail("Unfinished string", *str);
+  }
+  // Slow path: unescape once into scratch_, whose offsets stay stable as it
+  // grows.
+  const uint32_t out_begin = static_cast<uint32_t>(scratch_.size());
+  scratch_.append(str->data(), i);
+  bool escape = false;
+  for (; i < str->size(); ++i) {
+    const char c = (*str)[i];
+    if (escape) {
+      switch (c) {
+        case 'b': scratch_.push_back('\b'); break;
+        case 'f': scratch_.push_back('\f'); break;
+        case 'n': scratch_.push_back('\n'); break;
+        case 'r': scratch_.push_back('\r'); break;
+        case 't': scratch_.push_back('\t'); break;
+        default: scratch_.push_back(c); break;
+      }
+      escape = false;
+    } else if (c == '\\') {
+      escape = true;
+    } else if (c == '"') {
+      *begin = out_begin;
+      *end = static_cast<uint32_t>(scratch_.size());
+      *in_scratch = true;
+      str->remove_prefix(i + 1);
+      return true;
+    } else {
+      scratch_.push_back(c);
+    }
+  }
+  return Fail("Unfinished string", *str);
+}
+
+absl::optional<uint32_t> FlatJson::ParseContainer(absl::string_view* str,
+                                                  char close) {
+  str->remove_prefix(1);  // The caller matched the opening bracket.
+  const uint32_t index = static_cast<uint32_t>(nodes_.size());
+  {
+    Node node;
+    node.type = close == '}' ? Type::kObject : Type::kArray;
+    nodes_.push_back(node);
+  }
+  uint32_t num_children = 0;
+  bool first = true;
+  while (true) {
+    SkipWhitespace(str);
+    if (str->empty()) {
+      Fail(close == '}' ? "Unfinished object" : "Unfinished array", *str);
+      return absl::nullopt;
+    }
+    if (str->front() == close) {
+      str->remove_prefix(1);
+      break;
+    }
+    if (!first) {
+      if (str->front() != ',') {
+        Fail("Expected ','", *str);
+        return absl::nullopt;
+      }
+      str->remove_prefix(1);
+      SkipWhitespace(str);
+    }
+    first = false;
+    uint32_t key_begin = 0, key_end = 0;
+    bool key_in_scratch = false;
+    if (close == '}') {
+      if (!ParseString(str, &key_begin, &key_end, &key_in_scratch)) {
+        return absl::nullopt;
+      }
+      SkipWhitespace(str);
+      if (str->empty() || str->front() != ':') {
+        Fail("Expected ':'", *str);
+        return absl::nullopt;
+      }
+      str->remove_prefix(1);
+    }
+    absl::optional<uint32_t> child = ParseValue(str);
+    if (!child) {
+      return absl::nullopt;
+    }
+    if (close == '}') {
+      Node& child_node = nodes_[*child];
+      child_node.key_begin = key_begin;
+      child_node.key_end = key_end;
+      child_node.key_in_scratch = key_in_scratch;
+    }
+    ++num_children;
+  }
+  nodes_[index].num_children = num_children;
+  nodes_[index].next = static_cast<uint32_t>(nodes_.size());
+  return index;
+}
+
+absl::optional<uint32_t> FlatJson::ParseValue(absl::string_view* str) {
+  SkipWhitespace(str);
+  if (str->empty()) {
+    Fail("Unexpected end of input", *str);
+    return absl::nullopt;
+  }
+  Node node;
+  switch (str->front()) {
+    case '{': return ParseContainer(str, '}');
+    case '[': return ParseContainer(str, ']');
+    case '"': {
+      node.type = Type::kString;
+      if (!ParseString(str, &node.str_begin, &node.str_end,
+                       &node.str_in_scratch)) {
+        return absl::nullopt;
+      }
+      break;
+    }
+    case 'n':
+      if (!absl::StartsWith(*str, "null")) {
+        Fail("Invalid constant", *str);
+        return absl::nullopt;
+      }
+      str->remove_prefix(4);
+      node.type = Type::kNull;
+      break;
+    case 't':
+      if (!absl::StartsWith(*str, "true")) {
+        Fail("Invalid constant", *str);
+        return absl::nullopt;
+      }
+      str->remove_prefix(4);
+      node.type = Type::kBool;
+      node.bool_value = true;
+      break;
+    case 'f':
+      if (!absl::StartsWith(*str, "false")) {
+        Fail("Invalid constant", *str);
+        return absl::nullopt;
+      }
+      str->remove_prefix(5);
+      node.type = Type::kBool;
+      node.bool_value = false;
+      break;
+    default: {
+      // Same int-vs-double split as json.cc's ParseNumber.
+      const size_t valid_double =
+          std::min(str->find_first_not_of("-+.0123456789eE"), str->size());
+      const size_t valid_int =
+          std::min(str->find_first_not_of("-0123456789"), str->size());
+      if (valid_double == 0) {
+        Fail("Unexpected character", *str);
+        return absl::nullopt;
+      }
+      if (valid_double == valid_int) {
+        int64_t v;
+        if (!absl::SimpleAtoi(str->substr(0, valid_int), &v)) {
+          Fail("Invalid number", *str);
+          return absl::nullopt;
+        }
+        node.type = Type::kInt;
+        node.int_value = v;
+        str->remove_prefix(valid_int);
+      } else {
+        double v;
+        if (!absl::SimpleAtod(str->substr(0, valid_double), &v)) {
+          Fail("Invalid number", *str);
+          return absl::nullopt;
+        }
+        node.type = Type::kDouble;
+        node.double_value = v;
+        str->remove_prefix(valid_double);
+      }
+      break;
+    }
+  }
+  const uint32_t index = static_cast<uint32_t>(nodes_.size());
+  node.next = index + 1;
+  nodes_.push_back(node);
+  return index;
+}
+
+bool FlatJson::Parse(absl::string_view str) {
+  nodes_.clear();
+  scratch_.clear();
+  error_.clear();
+  input_begin_ = str.data();
+  absl::string_view remainder = str;
+  absl::optional<uint32_t> root = ParseValue(&remainder);
+  if (root) {
+    SkipWhitespace(&remainder);
+    if (!remainder.empty()) {
+      Fail("Trailing characters", remainder);
+      root = absl::nullopt;
+    }
+  }
+  if (!root) {
+    nodes_.clear();  // A failed document has no root.
+    return false;
+  }
+  return true;
+}
+
+FlatJson::Ref FlatJson::root() const {
+  if (nodes_.empty()) {
+    return Ref();
+  }
+  return Ref(this, 0, static_cast<uint32_t>(nodes_.size()));
+}
+
+absl::string_view FlatJson::StringRange(uint32_t begin, uint32_t end,
+                                        bool in_scratch) const {
+  if (begin == end) {
+    return absl::string_view();
+  }
+  const char* base = in_scratch ? scratch_.data() : input_begin_;
+  return absl::string_view(base + begin, end - begin);
+}
+
+FlatJson::Type FlatJson::Ref::type() const {
+  if (doc_ == nullptr) {
+    SpielFatalError("FlatJson::Ref: dereferencing an invalid Ref.");
+  }
+  return doc_->nodes_[index_].type;
+}
+
+bool FlatJson::Ref::GetBool() const {
+  if (!IsBool()) SpielFatalError("FlatJson::Ref: value is not a bool.");
+  return doc_->nodes_[index_].bool_value;
+}
+
+int64_t FlatJson::Ref::GetInt() const {
+  if (!IsInt()) SpielFatalError("FlatJson::Ref: value is not an int.");
+  return doc_->nodes_[index_].int_value;
+}
+
+double FlatJson::Ref::GetDouble() const {
+  if (!IsDouble()) SpielFatalError("FlatJson::Ref: value is not a double.");
+  return doc_->nodes_[index_].double_value;
+}
+
+double FlatJson::Ref::GetNumber() const {
+  if (IsInt()) return static_cast<double>(doc_->nodes_[index_].int_value);
+  if (IsDouble()) return doc_->nodes_[index_].double_value;
+  SpielFatalError("FlatJson::Ref: value is not a number.");
+}
+
+absl::string_view FlatJson::Ref::GetString() const {
+  if (!IsString()) SpielFatalError("FlatJson::Ref: value is not a string.");
+  const Node& node = doc_->nodes_[index_];
+  return doc_->StringRange(node.str_begin, node.str_end, node.str_in_scratch);
+}
+
+int FlatJson::Ref::size() const {
+  if (!IsArray() && !IsObject()) {
+    SpielFatalError("FlatJson::Ref: value is not an array or object.");
+  }
+  return static_cast<int>(doc_->nodes_[index_].num_children);
+}
+
+FlatJson::Ref FlatJson::Ref::FirstChild() const {
+  if (!IsArray() && !IsObject()) {
+    return Ref();
+  }
+  const Node& node = doc_->nodes_[index_];
+  if (node.num_children == 0) {
+    return Ref();
+  }
+  return Ref(doc_, index_ + 1, node.next);
+}
+
+FlatJson::Ref FlatJson::Ref::NextSibling() const {
+  if (doc_ == nullptr) {
+    return Ref();
+  }
+  const uint32_t next = doc_->nodes_[index_].next;
+  if (next >= end_) {
+    return Ref();
+  }
+  return Ref(doc_, next, end_);
+}
+
+FlatJson::Ref FlatJson::Ref::operator[](int i) const {
+  if (!IsArray()) SpielFatalError("FlatJson::Ref: value is not an array.");
+  Ref child = FirstChild();
+  for (; child && i > 0; --i) {
+    child = child.NextSibling();
+  }
+  return child;
+}
+
+FlatJson::Ref FlatJson::Ref::operator[](absl::string_view key) const {
+  if (!IsObject()) SpielFatalError("FlatJson::Ref: value is not an object.");
+  for (Ref child = FirstChild(); child; child = child.NextSibling()) {
+    if (child.key() == key) {
+      return child;
+    }
+  }
+  return Ref();
+}
+
+absl::string_view FlatJson::Ref::key() const {
+  if (doc_ == nullptr) {
+    return absl::string_view();
+  }
+  const Node& node = doc_->nodes_[index_];
+  return doc_->StringRange(node.key_begin, node.key_end, node.key_in_scratch);
+}
+
+Value FlatJson::Ref::ToValue() const {
+  switch (type()) {
+    case Type::kNull: return Null();
+    case Type::kBool: return GetBool();
+    case Type::kInt: return GetInt();
+    case Type::kDouble: return GetDouble();
+    case Type::kString: return std::string(GetString());
+    case Type::kArray: {
+      Array out;
+      out.reserve(size());
+      for (Ref child = FirstChild(); child; child = child.NextSibling()) {
+        out.push_back(child.ToValue());
+      }
+      return out;
+    }
+    case Type::kObject: {
+      Object out;
+      for (Ref child = FirstChild(); child; child = child.NextSibling()) {
+        out.emplace(std::string(child.key()), child.ToValue());
+      }
+      return out;
+    }
+  }
+  SpielFatalError("FlatJson::Ref::ToValue is missing a type.");
+}
+
+JsonLinesReader::JsonLinesReader(const std::string& filename,
+                                 std::int64_t buffer_size)
+    : reader_(file::File(filename, "r"), buffer_size), filename_(filename) {}
+
+const FlatJson* JsonLinesReader::Next() {
+  while (absl::optional<std::string> line = reader_.ReadLine()) {
+    ++line_number_;
+    if (line->find_first_not_of(" \t\r") == std::string::npos) {
+      continue;  // Blank line, e.g. a trailing newline at the end.
+    }
+    line_ = *std::move(line);
+    if (!record_.Parse(line_)) {
+      SpielFatalError(absl::StrCat("JsonLinesReader: ", filename_, ":",
+                                   line_number_, ": ", record_.error()));
+    }
+    return &record_;
+  }
+  return nullptr;
+}
+
+}  // namespace open_spiel::json
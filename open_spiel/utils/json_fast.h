@@ -0,0 +1,188 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_JSON_FAST_H_
+#define OPEN_SPIEL_UTILS_JSON_FAST_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+#include "open_spiel/utils/file.h"
+#include "open_spiel/utils/json.h"
+
+namespace open_spiel::json {
+
+// A fast, read-only JSON parser for bulk log analysis, e.g. the jsonl files
+// written by DataLoggerJsonLines. Unlike json::FromString, which builds a
+// std::map-based json::Object tree with a heap allocation per node, FlatJson
+// parses into a single flat vector of nodes owned by the document. Strings
+// are string_views into the input buffer (escaped strings are unescaped once
+// into a document-owned side buffer), object members are looked up by linear
+// scan over the member nodes, and reparsing into the same document reuses its
+// storage, so a steady-state jsonl scan does no per-record allocation.
+//
+// The document refers into the input buffer: the buffer must outlive the
+// document, and reparsing invalidates all Refs into it.
+class FlatJson {
+ public:
+  enum class Type : uint8_t {
+    kNull,
+    kBool,
+    kInt,
+    kDouble,
+    kString,
+    kArray,
+    kObject,
+  };
+
+  // A cheap handle to one value in the document (an index into the node
+  // vector). Invalid Refs (missing object key, index out of range, end of
+  // iteration) are falsy; the getters check the type and die on a mismatch,
+  // matching json::Value.
+  class Ref {
+   public:
+    explicit operator bool() const { return doc_ != nullptr; }
+
+    Type type() const;
+    bool IsNull() const { return *this && type() == Type::kNull; }
+    bool IsBool() const { return *this && type() == Type::kBool; }
+    bool IsInt() const { return *this && type() == Type::kInt; }
+    bool IsDouble() const { return *this && type() == Type::kDouble; }
+    bool IsNumber() const { return IsInt() || IsDouble(); }
+    bool IsString() const { return *this && type() == Type::kString; }
+    bool IsArray() const { return *this && type() == Type::kArray; }
+    bool IsObject() const { return *this && type() == Type::kObject; }
+
+    bool GetBool() const;
+    int64_t GetInt() const;
+    double GetDouble() const;
+    // Either an int or a double, as a double.
+    double GetNumber() const;
+    // A view into the input buffer, or into the document's side buffer if
+    // the string contained escapes.
+    absl::string_view GetString() const;
+
+    // Number of elements (array) or members (object).
+    int size() const;
+    // Array element by position; an invalid Ref when out of range.
+    Ref operator[](int i) const;
+    // Object member by key (linear scan); an invalid Ref when absent.
+    Ref operator[](absl::string_view key) const;
+    // This value's key within its parent object; empty for array elements
+    // and the root.
+    absl::string_view key() const;
+
+    // Child iteration over arrays and objects, in input order:
+    //   for (Ref v = r.FirstChild(); v; v = v.NextSibling()) ...
+    Ref FirstChild() const;
+    Ref NextSibling() const;
+
+    // Deep-converts to the std::map-based json::Value, for callers that
+    // need to keep or mutate a record beyond the next Parse.
+    Value ToValue() const;
+
+   private:
+    friend class FlatJson;
+    Ref() = default;
+    Ref(const FlatJson* doc, uint32_t index, uint32_t end)
+        : doc_(doc), index_(index), end_(end) {}
+
+    const FlatJson* doc_ = nullptr;
+    uint32_t index_ = 0;
+    uint32_t end_ = 0;  // One past the sibling range, for NextSibling.
+  };
+
+  FlatJson() = default;
+
+  // FlatJson is move only (Refs hold a pointer to the document).
+  FlatJson(FlatJson&& other) = default;
+  FlatJson& operator=(FlatJson&& other) = default;
+  FlatJson(const FlatJson&) = delete;
+  FlatJson& operator=(const FlatJson&) = delete;
+
+  // Parses str, reusing this document's storage. Returns false on malformed
+  // input (trailing garbage included), with a description in error(). The
+  // document keeps views into str until the next Parse.
+  bool Parse(absl::string_view str);
+
+  // The parsed top-level value; invalid before the first successful Parse.
+  Ref root() const;
+
+  // A description of the last Parse failure; empty after a success.
+  const std::string& error() const { return error_; }
+
+ private:
+  struct Node {
+    Type type = Type::kNull;
+    // Strings/keys live in the input buffer unless unescaping copied them
+    // into scratch_.
+    bool str_in_scratch = false;
+    bool key_in_scratch = false;
+    union {
+      bool bool_value;
+      int64_t int_value = 0;
+      double double_value;
+    };
+    uint32_t str_begin = 0, str_end = 0;  // String payload range.
+    uint32_t key_begin = 0, key_end = 0;  // Key range (object members).
+    uint32_t num_children = 0;
+    uint32_t next = 0;  // Index one past this node's subtree.
+  };
+
+  absl::string_view StringRange(uint32_t begin, uint32_t end,
+                                bool in_scratch) const;
+  // Recursive descent over *str, appending to nodes_. Returns the new
+  // node's index, or nullopt after recording error_.
+  absl::optional<uint32_t> ParseValue(absl::string_view* str);
+  absl::optional<uint32_t> ParseContainer(absl::string_view* str, char close);
+  // Parses a quoted string into a (begin, end, in_scratch) range.
+  bool ParseString(absl::string_view* str, uint32_t* begin, uint32_t* end,
+                   bool* in_scratch);
+  bool Fail(absl::string_view message, absl::string_view at);
+
+  std::vector<Node> nodes_;
+  std::string scratch_;  // Unescaped string payloads; offsets are stable.
+  const char* input_begin_ = nullptr;
+  std::string error_;
+};
+
+// Streams the records of a jsonl file through a single reused FlatJson, so
+// reading a multi-gigabyte actor log allocates a handful of buffers total.
+// Blank lines are skipped; a malformed line dies with its line number.
+class JsonLinesReader {
+ public:
+  explicit JsonLinesReader(const std::string& filename,
+                           std::int64_t buffer_size = 1 << 20);
+
+  // The next record, or nullptr at the end of the file. The returned
+  // document (and all Refs into it) is valid until the next call.
+  const FlatJson* Next();
+
+  // 1-based line number of the record Next() last returned.
+  std::int64_t line_number() const { return line_number_; }
+
+ private:
+  file::BufferedReader reader_;
+  FlatJson record_;
+  std::string line_;  // The record_ document views into this.
+  std::string filename_;
+  std::int64_t line_number_ = 0;
+};
+
+}  // namespace open_spiel::json
+
+#endif  // OPEN_SPIEL_UTILS_JSON_FAST_H_
@@ -0,0 +1,163 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/json_fast.h"
+
+#include <cstdlib>
+#include <string>
+
+#include "open_spiel/spiel_utils.h"
+#include "open_spiel/utils/file.h"
+#include "open_spiel/utils/json.h"
+
+namespace open_spiel::json {
+namespace {
+
+void TestScalars() {
+  FlatJson doc;
+
+  SPIEL_CHECK_FALSE(doc.root());
+
+  SPIEL_CHECK_TRUE(doc.Parse("null"));
+  SPIEL_CHECK_TRUE(doc.root().IsNull());
+
+  SPIEL_CHECK_TRUE(doc.Parse("true"));
+  SPIEL_CHECK_TRUE(doc.root().IsBool());
+  SPIEL_CHECK_EQ(doc.root().GetBool(), true);
+
+  SPIEL_CHECK_TRUE(doc.Parse("false"));
+  SPIEL_CHECK_EQ(doc.root().GetBool(), false);
+
+  SPIEL_CHECK_TRUE(doc.Parse("-163546"));
+  SPIEL_CHECK_TRUE(doc.root().IsInt());
+  SPIEL_CHECK_TRUE(doc.root().IsNumber());
+  SPIEL_CHECK_EQ(doc.root().GetInt(), -163546);
+  SPIEL_CHECK_EQ(doc.root().GetNumber(), -163546.0);
+
+  SPIEL_CHECK_TRUE(doc.Parse("2.5"));
+  SPIEL_CHECK_TRUE(doc.root().IsDouble());
+  SPIEL_CHECK_EQ(doc.root().GetDouble(), 2.5);
+
+  SPIEL_CHECK_TRUE(doc.Parse("\"asdf\""));
+  SPIEL_CHECK_TRUE(doc.root().IsString());
+  SPIEL_CHECK_EQ(doc.root().GetString(), "asdf");
+
+  // Escapes take the unescaping path.
+  SPIEL_CHECK_TRUE(doc.Parse(R"("say \"hi\"\n\tok")"));
+  SPIEL_CHECK_EQ(doc.root().GetString(), "say \"hi\"\n\tok");
+}
+
+void TestContainers() {
+  FlatJson doc;
+
+  SPIEL_CHECK_TRUE(doc.Parse(" [1, null, \"asdf\", [2.5, 3]] "));
+  FlatJson::Ref root = doc.root();
+  SPIEL_CHECK_TRUE(root.IsArray());
+  SPIEL_CHECK_EQ(root.size(), 4);
+  SPIEL_CHECK_EQ(root[0].GetInt(), 1);
+  SPIEL_CHECK_TRUE(root[1].IsNull());
+  SPIEL_CHECK_EQ(root[2].GetString(), "asdf");
+  SPIEL_CHECK_EQ(root[3].size(), 2);
+  SPIEL_CHECK_EQ(root[3][0].GetDouble(), 2.5);
+  SPIEL_CHECK_EQ(root[3][1].GetInt(), 3);
+  SPIEL_CHECK_FALSE(root[4]);
+
+  int count = 0;
+  for (FlatJson::Ref v = root.FirstChild(); v; v = v.NextSibling()) {
+    ++count;
+  }
+  SPIEL_CHECK_EQ(count, 4);
+
+  SPIEL_CHECK_TRUE(
+      doc.Parse(R"({"asdf": {"bar": 6}, "foo": [1, 2, 3], "s": "x"})"));
+  root = doc.root();
+  SPIEL_CHECK_TRUE(root.IsObject());
+  SPIEL_CHECK_EQ(root.size(), 3);
+  SPIEL_CHECK_EQ(root["asdf"]["bar"].GetInt(), 6);
+  SPIEL_CHECK_EQ(root["foo"].size(), 3);
+  SPIEL_CHECK_EQ(root["foo"][2].GetInt(), 3);
+  SPIEL_CHECK_EQ(root["s"].GetString(), "x");
+  SPIEL_CHECK_FALSE(root["missing"]);
+  SPIEL_CHECK_EQ(root.FirstChild().key(), "asdf");
+  SPIEL_CHECK_EQ(root.FirstChild().NextSibling().key(), "foo");
+}
+
+void TestMatchesSlowParser() {
+  // The flat document must deep-convert to exactly what json::FromString
+  // builds, empty containers and nesting included.
+  const std::string input =
+      R"({"game": "durak", "step": 12, "returns": [1.5, -1.5],)"
+      R"( "legal": [], "meta": {"ok": true, "note": "a\tb"}})";
+  FlatJson doc;
+  SPIEL_CHECK_TRUE(doc.Parse(input));
+  absl::optional<Value> slow = FromString(input);
+  SPIEL_CHECK_TRUE(slow);
+  SPIEL_CHECK_TRUE(doc.root().ToValue() == *slow);
+}
+
+void TestParseErrors() {
+  FlatJson doc;
+  SPIEL_CHECK_FALSE(doc.Parse(""));
+  SPIEL_CHECK_FALSE(doc.Parse("[1, 2"));
+  SPIEL_CHECK_FALSE(doc.Parse("{\"a\": }"));
+  SPIEL_CHECK_FALSE(doc.Parse("\"unfinished"));
+  SPIEL_CHECK_FALSE(doc.Parse("1 trailing"));
+  SPIEL_CHECK_FALSE(doc.error().empty());
+  // A failed parse leaves no root; a later parse recovers.
+  SPIEL_CHECK_FALSE(doc.root());
+  SPIEL_CHECK_TRUE(doc.Parse("[1]"));
+  SPIEL_CHECK_TRUE(doc.error().empty());
+  SPIEL_CHECK_EQ(doc.root()[0].GetInt(), 1);
+}
+
+void TestJsonLinesReader() {
+  std::string val = std::to_string(std::rand());  // NOLINT
+  std::string dir = file::GetTmpDir() + "/open_spiel-test-" + val;
+  std::string filename = dir + "/test.jsonl";
+  SPIEL_CHECK_TRUE(file::Mkdir(dir));
+
+  file::WriteContentsToFile(filename, "w",
+                            "{\"step\": 0, \"value\": 1.5}\n"
+                            "\n"
+                            "{\"step\": 1, \"value\": -0.5}\n");
+
+  JsonLinesReader reader(filename, /*buffer_size=*/16);
+  const FlatJson* record = reader.Next();
+  SPIEL_CHECK_TRUE(record != nullptr);
+  SPIEL_CHECK_EQ(reader.line_number(), 1);
+  SPIEL_CHECK_EQ(record->root()["step"].GetInt(), 0);
+  SPIEL_CHECK_EQ(record->root()["value"].GetDouble(), 1.5);
+
+  record = reader.Next();  // The blank line is skipped.
+  SPIEL_CHECK_TRUE(record != nullptr);
+  SPIEL_CHECK_EQ(reader.line_number(), 3);
+  SPIEL_CHECK_EQ(record->root()["step"].GetInt(), 1);
+  SPIEL_CHECK_EQ(record->root()["value"].GetDouble(), -0.5);
+
+  SPIEL_CHECK_TRUE(reader.Next() == nullptr);
+
+  SPIEL_CHECK_TRUE(file::Remove(filename));
+  SPIEL_CHECK_TRUE(file::Remove(dir));
+}
+
+}  // namespace
+}  // namespace open_spiel::json
+
+int main(int argc, char** argv) {
+  open_spiel::json::TestScalars();
+  open_spiel::json::TestContainers();
+  open_spiel::json::TestMatchesSlowParser();
+  open_spiel::json::TestParseErrors();
+  open_spiel::json::TestJsonLinesReader();
+}
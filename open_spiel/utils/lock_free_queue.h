@@ -0,0 +1,234 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_LOCK_FREE_QUEUE_H_
+#define OPEN_SPIEL_UTILS_LOCK_FREE_QUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+#include "open_spiel/abseil-cpp/absl/types/optional.h"
+
+namespace open_spiel {
+
+// A bounded multi-producer multi-consumer queue with the same interface and
+// timeout semantics as ThreadedQueue, built on a ring buffer of sequenced
+// cells (Vyukov's bounded MPMC scheme). Push/Pop on a non-full/non-empty
+// queue are a single compare-and-swap with no lock, so producers and
+// consumers don't serialize on a mutex; the mutex and condition variables are
+// used only to park a caller when the queue is full (Push) or empty (Pop).
+//
+// The capacity is rounded up to the next power of two.
+template <class T>
+class LockFreeQueue {
+ public:
+  explicit LockFreeQueue(int max_size)
+      : capacity_(NextPowerOfTwo(std::max(max_size, 1))),
+        mask_(capacity_ - 1),
+        cells_(capacity_) {
+    for (uint64_t i = 0; i < capacity_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // Neither movable nor copyable: cells hold atomics and callers may be
+  // blocked inside member functions.
+  LockFreeQueue(const LockFreeQueue&) = delete;
+  LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+  // Add an element to the queue.
+  bool Push(const T& value) { return Push(value, absl::InfiniteFuture()); }
+  bool Push(const T& value, absl::Duration wait) {
+    return Push(value, absl::Now() + wait);
+  }
+  bool Push(const T& value, absl::Time deadline) {
+    while (true) {
+      if (block_new_values_.load(std::memory_order_acquire)) {
+        return false;
+      }
+      if (TryPush(value)) {
+        WakeWaiters(&not_empty_cv_, &waiting_poppers_);
+        return true;
+      }
+      if (!WaitWhileFull(deadline)) {
+        return false;
+      }
+    }
+  }
+
+  absl::optional<T> Pop() { return Pop(absl::InfiniteFuture()); }
+  absl::optional<T> Pop(absl::Duration wait) { return Pop(absl::Now() + wait); }
+  absl::optional<T> Pop(absl::Time deadline) {
+    while (true) {
+      absl::optional<T> value = TryPop();
+      if (value.has_value()) {
+        WakeWaiters(&not_full_cv_, &waiting_pushers_);
+        return value;
+      }
+      if (block_new_values_.load(std::memory_order_acquire) ||
+          !WaitWhileEmpty(deadline)) {
+        return absl::nullopt;
+      }
+    }
+  }
+
+  bool Empty() { return Size() == 0; }
+
+  void Clear() {
+    while (TryPop().has_value()) {
+    }
+    WakeWaiters(&not_full_cv_, &waiting_pushers_);
+  }
+
+  int Size() {
+    uint64_t tail = dequeue_pos_.load(std::memory_order_acquire);
+    uint64_t head = enqueue_pos_.load(std::memory_order_acquire);
+    return head >= tail ? static_cast<int>(head - tail) : 0;
+  }
+
+  // Causes pushing new values to fail. Useful for shutting down the queue.
+  void BlockNewValues() {
+    block_new_values_.store(true, std::memory_order_release);
+    absl::MutexLock lock(&m_);
+    not_full_cv_.SignalAll();
+    not_empty_cv_.SignalAll();
+  }
+
+ private:
+  struct Cell {
+    std::atomic<uint64_t> sequence;
+    // Stored as optional so T need not be default constructible.
+    absl::optional<T> value;
+  };
+
+  static uint64_t NextPowerOfTwo(int n) {
+    uint64_t power = 1;
+    while (power < static_cast<uint64_t>(n)) power <<= 1;
+    return power;
+  }
+
+  // One lock-free push attempt; fails only when the queue is full.
+  bool TryPush(const T& value) {
+    uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Cell& cell = cells_[pos & mask_];
+      uint64_t seq = cell.sequence.load(std::memory_order_acquire);
+      int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          cell.value = value;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // Full.
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // One lock-free pop attempt; fails only when the queue is empty.
+  absl::optional<T> TryPop() {
+    uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Cell& cell = cells_[pos & mask_];
+      uint64_t seq = cell.sequence.load(std::memory_order_acquire);
+      int64_t diff =
+          static_cast<int64_t>(seq) - static_cast<int64_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          absl::optional<T> value = std::move(cell.value);
+          cell.value.reset();
+          cell.sequence.store(pos + capacity_, std::memory_order_release);
+          return value;
+        }
+      } else if (diff < 0) {
+        return absl::nullopt;  // Empty.
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Parks until the queue might have space. Returns false on timeout or
+  // shutdown. Registering as a waiter and re-checking under the lock pairs
+  // with WakeWaiters locking before signalling, so no wakeup can be missed.
+  bool WaitWhileFull(absl::Time deadline) {
+    absl::MutexLock lock(&m_);
+    ++waiting_pushers_;
+    bool ok = true;
+    while (Size() >= static_cast<int>(capacity_)) {
+      if (absl::Now() > deadline ||
+          block_new_values_.load(std::memory_order_acquire)) {
+        ok = false;
+        break;
+      }
+      not_full_cv_.WaitWithDeadline(&m_, deadline);
+    }
+    --waiting_pushers_;
+    return ok;
+  }
+
+  // Parks until the queue might have an element. Returns false on timeout or
+  // shutdown.
+  bool WaitWhileEmpty(absl::Time deadline) {
+    absl::MutexLock lock(&m_);
+    ++waiting_poppers_;
+    bool ok = true;
+    while (Size() == 0) {
+      if (absl::Now() > deadline ||
+          block_new_values_.load(std::memory_order_acquire)) {
+        ok = false;
+        break;
+      }
+      not_empty_cv_.WaitWithDeadline(&m_, deadline);
+    }
+    --waiting_poppers_;
+    return ok;
+  }
+
+  void WakeWaiters(absl::CondVar* cv, const std::atomic<int>* waiter_count) {
+    // Only take the lock when somebody is actually parked.
+    if (waiter_count->load(std::memory_order_acquire) > 0) {
+      absl::MutexLock lock(&m_);
+      cv->SignalAll();
+    }
+  }
+
+  const uint64_t capacity_;
+  const uint64_t mask_;
+  std::vector<Cell> cells_;
+  std::atomic<uint64_t> enqueue_pos_{0};
+  std::atomic<uint64_t> dequeue_pos_{0};
+  std::atomic<bool> block_new_values_{false};
+
+  absl::Mutex m_;
+  absl::CondVar not_full_cv_;
+  absl::CondVar not_empty_cv_;
+  std::atomic<int> waiting_pushers_{0};  // Modified only under m_.
+  std::atomic<int> waiting_poppers_{0};  // Modified only under m_.
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_LOCK_FREE_QUEUE_H_
@@ -16,8 +16,11 @@
 #define OPEN_SPIEL_UTILS_LRU_CACHE_H_
 
 #include <list>
+#include <memory>
+#include <vector>
 
 #include "open_spiel/abseil-cpp/absl/container/flat_hash_map.h"
+#include "open_spiel/abseil-cpp/absl/hash/hash.h"
 #include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
 
 namespace open_spiel {
@@ -25,6 +28,7 @@ namespace open_spiel {
 struct LRUCacheInfo {
   int64_t hits = 0;
   int64_t misses = 0;
+  int64_t evictions = 0;
   int size = 0;
   int max_size = 0;
 
@@ -39,6 +43,7 @@ struct LRUCacheInfo {
   void operator+=(const LRUCacheInfo& o) {
     hits += o.hits;
     misses += o.misses;
+    evictions += o.evictions;
     size += o.size;
     max_size += o.max_size;
   }
@@ -54,7 +59,7 @@ class LRUCache {  // Least Recently Used Cache.
   // - Use atomics for hits/misses to shorten lock times.
   // - Embed the list directly into the map value to avoid extra indirection.
  public:
-  explicit LRUCache(int max_size) : hits_(0), misses_(0) {
+  explicit LRUCache(int max_size) : hits_(0), misses_(0), evictions_(0) {
     SetMaxSize(max_size);
   }
 
@@ -77,6 +82,7 @@ class LRUCache {  // Least Recently Used Cache.
     map_.clear();
     hits_ = 0;
     misses_ = 0;
+    evictions_ = 0;
   }
 
   void Set(const K& key, const V& value) {
@@ -86,6 +92,7 @@ class LRUCache {  // Least Recently Used Cache.
       if (map_.size() >= max_size_) {  // Make space if needed.
         map_.erase(order_.back());
         order_.pop_back();
+        evictions_ += 1;
       }
       order_.push_front(key);
       map_[key] = Entry{value, order_.begin()};
@@ -113,8 +120,8 @@ class LRUCache {  // Least Recently Used Cache.
 
   LRUCacheInfo Info() {
     absl::MutexLock lock(&m_);
-    return LRUCacheInfo{hits_, misses_, static_cast<int>(map_.size()),
-                        max_size_};
+    return LRUCacheInfo{hits_, misses_, evictions_,
+                        static_cast<int>(map_.size()), max_size_};
   }
 
  private:
@@ -125,12 +132,72 @@ class LRUCache {  // Least Recently Used Cache.
 
   int64_t hits_;
   int64_t misses_;
+  int64_t evictions_;
   int max_size_;
   std::list<K> order_;
   absl::flat_hash_map<K, Entry> map_;
   absl::Mutex m_;
 };
 
+// An LRU cache sharded by key hash. Each shard is an independent LRUCache
+// with its own lock and recency order, so concurrent callers touching
+// different keys rarely contend. Eviction is per shard, which approximates
+// global LRU as long as the hash spreads keys evenly. The capacity is split
+// across shards (each shard still enforces the LRUCache minimum of 4).
+template <typename K, typename V>
+class ShardedLRUCache {
+ public:
+  ShardedLRUCache(int max_size, int num_shards) {
+    num_shards = std::max(num_shards, 1);
+    shards_.reserve(num_shards);
+    for (int i = 0; i < num_shards; ++i) {
+      shards_.push_back(
+          std::make_unique<LRUCache<K, V>>(max_size / num_shards));
+    }
+  }
+
+  // Move only, not copyable.
+  ShardedLRUCache(ShardedLRUCache&& other) = default;
+  ShardedLRUCache& operator=(ShardedLRUCache&& other) = default;
+  ShardedLRUCache(const ShardedLRUCache&) = delete;
+  ShardedLRUCache& operator=(const ShardedLRUCache&) = delete;
+
+  int NumShards() const { return shards_.size(); }
+
+  void SetMaxSize(int max_size) {
+    for (auto& shard : shards_) {
+      shard->SetMaxSize(max_size / static_cast<int>(shards_.size()));
+    }
+  }
+
+  int Size() {
+    int size = 0;
+    for (auto& shard : shards_) size += shard->Size();
+    return size;
+  }
+
+  void Clear() {
+    for (auto& shard : shards_) shard->Clear();
+  }
+
+  void Set(const K& key, const V& value) { Shard(key).Set(key, value); }
+
+  absl::optional<const V> Get(const K& key) { return Shard(key).Get(key); }
+
+  LRUCacheInfo Info() {
+    LRUCacheInfo info;
+    for (auto& shard : shards_) info += shard->Info();
+    return info;
+  }
+
+ private:
+  LRUCache<K, V>& Shard(const K& key) {
+    return *shards_[absl::Hash<K>{}(key) % shards_.size()];
+  }
+
+  std::vector<std::unique_ptr<LRUCache<K, V>>> shards_;
+};
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_UTILS_LRU_CACHE_H_
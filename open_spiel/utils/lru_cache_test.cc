@@ -14,6 +14,8 @@
 
 #include "open_spiel/utils/lru_cache.h"
 
+#include <string>
+
 #include "open_spiel/spiel_utils.h"
 
 namespace open_spiel {
@@ -27,6 +29,7 @@ void TestLRUCache() {
   LRUCacheInfo info = cache.Info();
   SPIEL_CHECK_EQ(info.hits, 0);
   SPIEL_CHECK_EQ(info.misses, 0);
+  SPIEL_CHECK_EQ(info.evictions, 0);
   SPIEL_CHECK_EQ(info.size, 0);
   SPIEL_CHECK_EQ(info.max_size, 4);
   SPIEL_CHECK_EQ(info.Usage(), 0);
@@ -67,13 +70,57 @@ void TestLRUCache() {
 
   info = cache.Info();
   SPIEL_CHECK_EQ(info.Usage(), 1);
+  SPIEL_CHECK_EQ(info.evictions, 2);  // 13 and 15.
 
   cache.Clear();
 
   SPIEL_CHECK_FALSE(cache.Get(18));  // evicted
 }
 
+void TestShardedLRUCache() {
+  ShardedLRUCache<int, std::string> cache(32, 4);
+
+  SPIEL_CHECK_EQ(cache.NumShards(), 4);
+  SPIEL_CHECK_EQ(cache.Size(), 0);
+
+  LRUCacheInfo info = cache.Info();
+  SPIEL_CHECK_EQ(info.max_size, 32);
+  SPIEL_CHECK_EQ(info.Total(), 0);
+
+  SPIEL_CHECK_FALSE(cache.Get(1));
+
+  for (int i = 0; i < 16; ++i) {
+    cache.Set(i, std::to_string(i));
+  }
+  SPIEL_CHECK_EQ(cache.Size(), 16);
+
+  for (int i = 0; i < 16; ++i) {
+    absl::optional<const std::string> v = cache.Get(i);
+    SPIEL_CHECK_TRUE(v);
+    SPIEL_CHECK_EQ(*v, std::to_string(i));
+  }
+
+  info = cache.Info();
+  SPIEL_CHECK_EQ(info.hits, 16);
+  SPIEL_CHECK_EQ(info.misses, 1);
+  SPIEL_CHECK_EQ(info.size, 16);
+
+  // Overfill: per-shard eviction keeps the total at capacity.
+  for (int i = 0; i < 100; ++i) {
+    cache.Set(i, std::to_string(i));
+  }
+  SPIEL_CHECK_LE(cache.Size(), 32);
+  SPIEL_CHECK_GT(cache.Info().evictions, 0);
+
+  cache.Clear();
+  SPIEL_CHECK_EQ(cache.Size(), 0);
+  SPIEL_CHECK_FALSE(cache.Get(99));
+}
+
 }  // namespace
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::TestLRUCache(); }
+int main(int argc, char** argv) {
+  open_spiel::TestLRUCache();
+  open_spiel::TestShardedLRUCache();
+}
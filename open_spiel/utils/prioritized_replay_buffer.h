@@ -0,0 +1,259 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_PRIORITIZED_REPLAY_BUFFER_H_
+#define OPEN_SPIEL_UTILS_PRIORITIZED_REPLAY_BUFFER_H_
+
+#include <nop/serializer.h>
+#include <nop/utility/stream_reader.h>
+#include <nop/utility/stream_writer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/str_format.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+
+// A fixed-size replay buffer with prioritized sampling (Schaul et al.,
+// "Prioritized Experience Replay"). Elements are sampled with probability
+// proportional to priority^alpha, where the priority is typically the
+// element's last training loss, so the learner revisits the positions it
+// still gets wrong instead of spreading batches uniformly over the buffer.
+//
+// Priorities live in a sum tree: Add, UpdatePriorities and each sampled
+// element cost O(log max_size). Once full, Add overwrites the oldest element
+// like CircularBuffer. New elements enter at the highest priority seen so
+// far, so everything is trained on at least once before prioritization can
+// starve it. Sampling is stratified with replacement and returns, besides
+// the elements, their slot indices (to address UpdatePriorities after the
+// learn step) and importance weights (total / (size * p))^beta, normalized
+// so the largest weight in the batch is 1. Indices go stale when their slot
+// is overwritten; an update through a stale index just re-prioritizes the
+// newer element, which prioritized replay tolerates by design.
+//
+// Thread safety: all public methods may be called concurrently. The sum
+// tree is guarded by one mutex — its critical sections are a few dozen
+// arithmetic operations — while element payloads are guarded by striped
+// locks, so the expensive part of concurrent Adds (copying observation
+// vectors) proceeds in parallel. T must be default-constructible (storage
+// is preallocated so payload slots have stable addresses).
+template <class T>
+class PrioritizedReplayBuffer {
+ public:
+  // One sampled batch; entries correspond index-by-index.
+  struct Batch {
+    std::vector<T> elements;
+    std::vector<int> indices;
+    std::vector<double> weights;
+  };
+
+  explicit PrioritizedReplayBuffer(int max_size, double alpha = 0.6,
+                                   double beta = 0.4, int num_stripes = 16)
+      : max_size_(max_size),
+        alpha_(alpha),
+        beta_(beta),
+        stripes_(num_stripes) {
+    SPIEL_CHECK_GT(max_size, 0);
+    SPIEL_CHECK_GE(alpha, 0);
+    SPIEL_CHECK_GE(beta, 0);
+    SPIEL_CHECK_GT(num_stripes, 0);
+    capacity_ = 1;
+    while (capacity_ < max_size_) capacity_ *= 2;
+    tree_.assign(2 * capacity_, 0.0);
+    data_.resize(max_size_);
+  }
+
+  // Adds one element at the given priority, replacing the oldest once full.
+  void Add(const T& value, double priority) {
+    SPIEL_CHECK_GE(priority, 0);
+    int slot;
+    {
+      std::lock_guard<std::mutex> lock(tree_mutex_);
+      slot = total_added_ % max_size_;
+      total_added_ += 1;
+      // Hide the slot from samplers while the payload is being replaced.
+      SetLeaf(slot, 0.0);
+      max_priority_ = std::max(max_priority_, priority);
+    }
+    {
+      std::lock_guard<std::mutex> lock(StripeFor(slot));
+      data_[slot] = value;
+    }
+    std::lock_guard<std::mutex> lock(tree_mutex_);
+    SetLeaf(slot, std::pow(priority, alpha_));
+  }
+
+  // Adds one element at the highest priority seen so far.
+  void Add(const T& value) {
+    double priority;
+    {
+      std::lock_guard<std::mutex> lock(tree_mutex_);
+      priority = max_priority_;
+    }
+    Add(value, priority);
+  }
+
+  // Returns `num` elements sampled with replacement proportional to
+  // priority^alpha, stratified over the priority mass.
+  Batch Sample(std::mt19937* rng, int num) {
+    Batch batch;
+    batch.elements.reserve(num);
+    batch.indices.reserve(num);
+    batch.weights.reserve(num);
+    {
+      std::lock_guard<std::mutex> lock(tree_mutex_);
+      const double total = tree_[1];
+      SPIEL_CHECK_GT(total, 0);
+      const int size = Size();
+      std::uniform_real_distribution<double> uniform(0.0, 1.0);
+      for (int k = 0; k < num; ++k) {
+        const double u = (k + uniform(*rng)) / num * total;
+        const int slot = SampleLeaf(u);
+        batch.indices.push_back(slot);
+        // The descent can only land on a zero-mass leaf through the drift
+        // clamp in SampleLeaf; the floor keeps the weight finite then.
+        const double mass = std::max(tree_[capacity_ + slot], 1e-12);
+        batch.weights.push_back(std::pow(total / (size * mass), beta_));
+      }
+    }
+    const double max_weight =
+        *std::max_element(batch.weights.begin(), batch.weights.end());
+    for (double& weight : batch.weights) weight /= max_weight;
+    for (const int slot : batch.indices) {
+      std::lock_guard<std::mutex> lock(StripeFor(slot));
+      batch.elements.push_back(data_[slot]);
+    }
+    return batch;
+  }
+
+  // Re-prioritizes the given slots, typically with the per-element losses of
+  // the batch just learned from. Spans must have equal length.
+  void UpdatePriorities(absl::Span<const int> indices,
+                        absl::Span<const double> priorities) {
+    SPIEL_CHECK_EQ(indices.size(), priorities.size());
+    std::lock_guard<std::mutex> lock(tree_mutex_);
+    for (int i = 0; i < indices.size(); ++i) {
+      SPIEL_CHECK_GE(priorities[i], 0);
+      SetLeaf(indices[i], std::pow(priorities[i], alpha_));
+      max_priority_ = std::max(max_priority_, priorities[i]);
+    }
+  }
+
+  // How many elements are in the buffer.
+  int Size() const {
+    return static_cast<int>(std::min<int64_t>(total_added_, max_size_));
+  }
+
+  bool Empty() const { return total_added_ == 0; }
+
+  // How many elements have ever been added to the buffer.
+  int64_t TotalAdded() const { return total_added_; }
+
+  // Serialize the buffer (elements and priority masses) to a file. Not
+  // concurrent with Add/UpdatePriorities.
+  void SaveBuffer(const std::string& path) const {
+    nop::Serializer<nop::StreamWriter<std::ofstream>> serializer{path};
+    serializer.Write(max_size_);
+    serializer.Write(total_added_);
+    serializer.Write(data_);
+    std::vector<double> leaves(tree_.begin() + capacity_,
+                               tree_.begin() + capacity_ + max_size_);
+    serializer.Write(leaves);
+  }
+
+  // Populate the buffer with data from a saved buffer's file.
+  void LoadBuffer(const std::string& path) {
+    nop::Deserializer<nop::StreamReader<std::ifstream>> deserializer{path};
+    int max_size;
+    deserializer.Read(&max_size);
+    if (max_size != max_size_) {
+      SpielFatalError(absl::StrFormat("Cannot load data from a buffer with max"
+                                      "size %d into a buffer with max size %d.",
+                                      max_size, max_size_));
+    }
+    deserializer.Read(&total_added_);
+    deserializer.Read(&data_);
+    std::vector<double> leaves;
+    deserializer.Read(&leaves);
+    std::lock_guard<std::mutex> lock(tree_mutex_);
+    for (int slot = 0; slot < leaves.size(); ++slot) {
+      SetLeaf(slot, leaves[slot]);
+      // Leaves store priority^alpha; recover the raw priority (with alpha
+      // = 0 every mass is 1 and the default maximum already covers it).
+      if (alpha_ > 0) {
+        max_priority_ =
+            std::max(max_priority_, std::pow(leaves[slot], 1.0 / alpha_));
+      }
+    }
+  }
+
+ private:
+  // Sets leaf `slot` to priority mass `value` and refreshes the partial sums
+  // above it. Caller holds tree_mutex_.
+  void SetLeaf(int slot, double value) {
+    int node = capacity_ + slot;
+    tree_[node] = value;
+    for (node /= 2; node >= 1; node /= 2) {
+      tree_[node] = tree_[2 * node] + tree_[2 * node + 1];
+    }
+  }
+
+  // Descends from the root to the leaf whose prefix-sum interval contains
+  // `u` in [0, tree_[1]). Caller holds tree_mutex_.
+  int SampleLeaf(double u) const {
+    int node = 1;
+    while (node < capacity_) {
+      const int left = 2 * node;
+      if (u < tree_[left]) {
+        node = left;
+      } else {
+        u -= tree_[left];
+        node = left + 1;
+      }
+    }
+    // Floating-point drift in the partial sums can spill past the last live
+    // leaf; clamp back into range.
+    return std::min(node - capacity_, Size() - 1);
+  }
+
+  std::mutex& StripeFor(int slot) {
+    return stripes_[slot % stripes_.size()];
+  }
+
+  const int max_size_;
+  const double alpha_;
+  const double beta_;
+  int capacity_;  // max_size_ rounded up to a power of two.
+  int64_t total_added_ = 0;
+  double max_priority_ = 1.0;
+  // Binary-heap layout: tree_[1] is the total mass, leaves are at
+  // [capacity_, capacity_ + max_size_).
+  std::vector<double> tree_;
+  std::vector<T> data_;
+  mutable std::mutex tree_mutex_;
+  mutable std::vector<std::mutex> stripes_;
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_PRIORITIZED_REPLAY_BUFFER_H_
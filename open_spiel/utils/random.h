@@ -15,6 +15,9 @@
 #ifndef OPEN_SPIEL_UTILS_RANDOM_H_
 #define OPEN_SPIEL_UTILS_RANDOM_H_
 
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <random>
 #include <utility>
 #include <vector>
@@ -63,6 +66,91 @@ class RandomFixedSequence : public Random {
   double RandomUniform() final;
 };
 
+// A counter-based generator (Philox 4x32-10; Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3", SC'11). Every output is a pure function of
+// (seed, stream, counter): there is no evolving hidden state, so streams can
+// be split by id and positioned by counter, and a parallel run that assigns
+// stream ids by work item (e.g. one per iteration) produces bit-identical
+// draws regardless of how the items are scheduled across threads. Distinct
+// stream ids yield independent streams under the same seed. Satisfies
+// UniformRandomBitGenerator, so it composes with absl::Uniform etc.
+class CounterRng {
+ public:
+  using result_type = uint64_t;
+
+  CounterRng(uint64_t seed, uint64_t stream)
+      : key0_(static_cast<uint32_t>(seed)),
+        key1_(static_cast<uint32_t>(seed >> 32)),
+        stream_lo_(static_cast<uint32_t>(stream)),
+        stream_hi_(static_cast<uint32_t>(stream >> 32)) {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  // Each 4x32 block yields two 64-bit outputs; the second is buffered.
+  uint64_t operator()() {
+    if (have_buffered_) {
+      have_buffered_ = false;
+      return buffered_;
+    }
+    std::array<uint32_t, 4> ctr = {static_cast<uint32_t>(counter_),
+                                   static_cast<uint32_t>(counter_ >> 32),
+                                   stream_lo_, stream_hi_};
+    ++counter_;
+    Block(&ctr);
+    buffered_ = ctr[2] | (uint64_t{ctr[3]} << 32);
+    have_buffered_ = true;
+    return ctr[0] | (uint64_t{ctr[1]} << 32);
+  }
+
+  // Returns a double uniformly distributed in [0, 1).
+  double UniformDouble() { return (operator()() >> 11) * 0x1.0p-53; }
+
+  // Repositions the stream; SetCounter(0) replays it from the start.
+  void SetCounter(uint64_t counter) {
+    counter_ = counter;
+    have_buffered_ = false;
+  }
+  // The index of the next block to be generated.
+  uint64_t counter() const { return counter_; }
+
+ private:
+  // The Philox multipliers and the Weyl key schedule constants.
+  static constexpr uint32_t kMult0 = 0xD2511F53;
+  static constexpr uint32_t kMult1 = 0xCD9E8D57;
+  static constexpr uint32_t kWeyl0 = 0x9E3779B9;
+  static constexpr uint32_t kWeyl1 = 0xBB67AE85;
+
+  static void Round(uint32_t k0, uint32_t k1, std::array<uint32_t, 4>* c) {
+    const uint64_t p0 = uint64_t{kMult0} * (*c)[0];
+    const uint64_t p1 = uint64_t{kMult1} * (*c)[2];
+    *c = {static_cast<uint32_t>(p1 >> 32) ^ (*c)[1] ^ k0,
+          static_cast<uint32_t>(p1),
+          static_cast<uint32_t>(p0 >> 32) ^ (*c)[3] ^ k1,
+          static_cast<uint32_t>(p0)};
+  }
+
+  void Block(std::array<uint32_t, 4>* c) const {
+    uint32_t k0 = key0_;
+    uint32_t k1 = key1_;
+    for (int round = 0; round < 10; ++round) {
+      Round(k0, k1, c);
+      k0 += kWeyl0;
+      k1 += kWeyl1;
+    }
+  }
+
+  const uint32_t key0_;
+  const uint32_t key1_;
+  const uint32_t stream_lo_;
+  const uint32_t stream_hi_;
+  uint64_t counter_ = 0;
+  uint64_t buffered_ = 0;
+  bool have_buffered_ = false;
+};
+
 }  // namespace open_spiel
 
 #endif  // OPEN_SPIEL_UTILS_RANDOM_H_
@@ -20,14 +20,20 @@
 #include <nop/utility/stream_writer.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
+#include <memory>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
 #include "open_spiel/abseil-cpp/absl/strings/str_format.h"
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/utils/circular_buffer.h"
+#include "open_spiel/utils/file.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 
@@ -38,6 +44,8 @@ class SerializableCircularBuffer : public CircularBuffer<T> {
   explicit SerializableCircularBuffer(int max_size)
       : CircularBuffer<T>(max_size) {}
 
+  ~SerializableCircularBuffer() { FlushCheckpoint(); }
+
   // Serialize the data of the buffer to a file.
   void SaveBuffer(const std::string& path) const {
     nop::Serializer<nop::StreamWriter<std::ofstream>> serializer{path};
@@ -63,6 +71,156 @@ class SerializableCircularBuffer : public CircularBuffer<T> {
     deserializer.Read(&(this->total_added_));
     deserializer.Read(&(this->data_));
   }
+
+  // Incremental checkpointing. SaveBuffer rewrites the whole buffer in one
+  // blocking pass, which stalls training for large replay buffers.
+  // SaveCheckpoint instead persists only the slots written since the last
+  // call — Add fills slots in total_added_ order, so the delta is the slot
+  // range [saved_total, total_added) — as a numbered delta file next to the
+  // base file, and does the file write on a background thread. The caller
+  // only pays to copy the delta out of the buffer; once the entire buffer
+  // has turned over since the base was written, accumulated deltas would
+  // cost as much as a snapshot, so the base is refreshed (also in the
+  // background) and the deltas are deleted.
+  //
+  // The buffer must not be mutated while SaveCheckpoint or FlushCheckpoint
+  // is executing, but Add/Sample are safe while the background write runs:
+  // it works on a copy. Each call joins the previous write first.
+  void SaveCheckpoint(const std::string& path) {
+    FlushCheckpoint();
+    if (path != checkpoint_path_) {
+      // A new destination gets a fresh base.
+      checkpoint_path_ = path;
+      base_total_ = -1;
+      num_deltas_ = 0;
+    }
+    const int64_t total = this->total_added_;
+    if (base_total_ < 0 || total - base_total_ >= this->max_size_) {
+      // Write a full base and retire any delta files it supersedes.
+      auto snapshot = std::make_shared<std::vector<T>>(this->data_);
+      const int max_size = this->max_size_;
+      const int old_deltas = num_deltas_;
+      save_thread_ = std::make_unique<Thread>(
+          [path, snapshot, total, max_size, old_deltas]() {
+            {
+              nop::Serializer<nop::StreamWriter<std::ofstream>> serializer{
+                  path};
+              serializer.Write(max_size);
+              serializer.Write(total);
+              serializer.Write(*snapshot);
+            }
+            for (int n = 1; n <= old_deltas; ++n) {
+              file::Remove(DeltaPath(path, n));
+            }
+          });
+      base_total_ = total;
+      saved_total_ = total;
+      num_deltas_ = 0;
+      return;
+    }
+    if (total == saved_total_) {
+      return;  // Nothing new since the last checkpoint.
+    }
+    // total - saved_total_ < max_size_, so each slot appears at most once
+    // and holds the entry added at that ordinal.
+    auto entries = std::make_shared<std::vector<T>>();
+    entries->reserve(total - saved_total_);
+    for (int64_t k = saved_total_; k < total; ++k) {
+      entries->push_back(this->data_[k % this->max_size_]);
+    }
+    const std::string delta_path = DeltaPath(path, num_deltas_ + 1);
+    const int max_size = this->max_size_;
+    const int64_t begin_total = saved_total_;
+    save_thread_ = std::make_unique<Thread>(
+        [delta_path, entries, max_size, begin_total, total]() {
+          nop::Serializer<nop::StreamWriter<std::ofstream>> serializer{
+              delta_path};
+          serializer.Write(max_size);
+          serializer.Write(begin_total);
+          serializer.Write(total);
+          serializer.Write(*entries);
+        });
+    saved_total_ = total;
+    ++num_deltas_;
+  }
+
+  // Wait for an in-flight background checkpoint write to land. Call before
+  // reading the files elsewhere or letting the process exit mid-write (the
+  // destructor also flushes).
+  void FlushCheckpoint() {
+    if (save_thread_ != nullptr) {
+      save_thread_->join();
+      save_thread_.reset();
+    }
+  }
+
+  // Restore from a base file plus any delta files SaveCheckpoint left next
+  // to it, replaying the deltas in order. The result is then compacted: the
+  // folded-in state is rewritten as a fresh base and the delta files are
+  // deleted, so a later SaveCheckpoint to the same path resumes cheaply.
+  void LoadCheckpoint(const std::string& path) {
+    FlushCheckpoint();
+    LoadBuffer(path);
+    int num_deltas = 0;
+    while (file::Exists(DeltaPath(path, num_deltas + 1))) {
+      const std::string delta_path = DeltaPath(path, ++num_deltas);
+      nop::Deserializer<nop::StreamReader<std::ifstream>> deserializer{
+          delta_path};
+      int max_size;
+      deserializer.Read(&max_size);
+      if (max_size != this->max_size_) {
+        SpielFatalError(absl::StrFormat(
+            "Cannot load data from a buffer with max"
+            "size %d into a buffer with max size %d.",
+            max_size, this->max_size_));
+      }
+      int64_t begin_total, end_total;
+      deserializer.Read(&begin_total);
+      deserializer.Read(&end_total);
+      if (begin_total != this->total_added_) {
+        SpielFatalError(absl::StrFormat(
+            "Delta file %s starts at entry %d but the checkpoint so far "
+            "covers %d entries; a delta file is missing or out of order.",
+            delta_path, begin_total, this->total_added_));
+      }
+      std::vector<T> entries;
+      deserializer.Read(&entries);
+      SPIEL_CHECK_EQ(static_cast<int64_t>(entries.size()),
+                     end_total - begin_total);
+      for (int64_t k = begin_total; k < end_total; ++k) {
+        const int slot = k % this->max_size_;
+        if (slot == static_cast<int>(this->data_.size())) {
+          this->data_.push_back(std::move(entries[k - begin_total]));
+        } else {
+          this->data_[slot] = std::move(entries[k - begin_total]);
+        }
+      }
+      this->total_added_ = end_total;
+    }
+    if (num_deltas > 0) {
+      // Compact: fold the deltas into a fresh base.
+      SaveBuffer(path);
+      for (int n = 1; n <= num_deltas; ++n) {
+        file::Remove(DeltaPath(path, n));
+      }
+    }
+    checkpoint_path_ = path;
+    base_total_ = this->total_added_;
+    saved_total_ = this->total_added_;
+    num_deltas_ = 0;
+  }
+
+ private:
+  static std::string DeltaPath(const std::string& path, int n) {
+    return absl::StrCat(path, ".delta-", n);
+  }
+
+  // Checkpoint bookkeeping; not part of the serialized state.
+  std::string checkpoint_path_;
+  int64_t base_total_ = -1;   // total_added_ when the base was written.
+  int64_t saved_total_ = 0;   // Entries covered by the base plus deltas.
+  int num_deltas_ = 0;
+  std::unique_ptr<Thread> save_thread_;
 };
 }  // namespace open_spiel
 
@@ -30,6 +30,7 @@ namespace {
 
 const char* kSimpleSerializationFilename = "simple_buffer_data.nop";
 const char* kComplexSerializationFilename = "complex_buffer_data.nop";
+const char* kIncrementalSerializationFilename = "incremental_buffer_data.nop";
 
 struct TestStruct {
   std::vector<Action> action_vector;
@@ -146,6 +147,61 @@ void TestComplexSerializableCircularBufferSerialization() {
   SPIEL_CHECK_TRUE(file::Remove(filename));
 }
 
+void TestIncrementalCheckpointing() {
+  std::string filename =
+      file::GetTmpDir() + "/" + kIncrementalSerializationFilename;
+  std::string delta1 = filename + ".delta-1";
+  std::string delta2 = filename + ".delta-2";
+
+  // The first checkpoint is a full base, later ones are delta files.
+  SerializableCircularBuffer<int> original_buffer(4);
+  original_buffer.Add(1);
+  original_buffer.Add(2);
+  original_buffer.Add(3);
+  original_buffer.SaveCheckpoint(filename);
+  original_buffer.FlushCheckpoint();
+  SPIEL_CHECK_TRUE(file::Exists(filename));
+  SPIEL_CHECK_FALSE(file::Exists(delta1));
+
+  original_buffer.Add(4);
+  original_buffer.Add(5);  // Overwrites 1.
+  original_buffer.SaveCheckpoint(filename);
+  original_buffer.Add(6);  // Overwrites 2.
+  original_buffer.SaveCheckpoint(filename);
+  original_buffer.FlushCheckpoint();
+  SPIEL_CHECK_TRUE(file::Exists(delta1));
+  SPIEL_CHECK_TRUE(file::Exists(delta2));
+
+  // Loading replays the deltas over the base, then compacts them away.
+  SerializableCircularBuffer<int> new_buffer(4);
+  new_buffer.LoadCheckpoint(filename);
+  SPIEL_CHECK_EQ(original_buffer.TotalAdded(), new_buffer.TotalAdded());
+  SPIEL_CHECK_TRUE(original_buffer.Data() == new_buffer.Data());
+  SPIEL_CHECK_FALSE(file::Exists(delta1));
+  SPIEL_CHECK_FALSE(file::Exists(delta2));
+
+  // The compacted file is a plain full buffer.
+  SerializableCircularBuffer<int> plain_buffer(4);
+  plain_buffer.LoadBuffer(filename);
+  SPIEL_CHECK_TRUE(original_buffer.Data() == plain_buffer.Data());
+
+  // Once the whole buffer has turned over since the base, the next
+  // checkpoint refreshes the base instead of adding a fourth delta.
+  new_buffer.Add(7);
+  new_buffer.Add(8);
+  new_buffer.Add(9);
+  new_buffer.Add(10);
+  new_buffer.SaveCheckpoint(filename);
+  new_buffer.FlushCheckpoint();
+  SPIEL_CHECK_FALSE(file::Exists(delta1));
+  SerializableCircularBuffer<int> final_buffer(4);
+  final_buffer.LoadCheckpoint(filename);
+  SPIEL_CHECK_EQ(final_buffer.TotalAdded(), 10);
+  SPIEL_CHECK_TRUE(final_buffer.Data() == new_buffer.Data());
+
+  SPIEL_CHECK_TRUE(file::Remove(filename));
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -154,4 +210,5 @@ int main(int argc, char** argv) {
   open_spiel::TestSerializableCircularBuffer();
   open_spiel::TestSimpleSerializableCircularBufferSerialization();
   open_spiel::TestComplexSerializableCircularBufferSerialization();
+  open_spiel::TestIncrementalCheckpointing();
 }
@@ -16,6 +16,7 @@
 #define OPEN_SPIEL_UTILS_STATS_H_
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <limits>
@@ -81,6 +82,8 @@ class BasicStats {
   }
 
  private:
+  friend class AtomicBasicStats;
+
   int64_t num_;
   double min_;
   double max_;
@@ -88,6 +91,72 @@ class BasicStats {
   double sum_sq_;
 };
 
+// BasicStats with lock-free recording, safe to Add() from many threads at
+// once. Snapshot() returns a plain BasicStats, so per-thread or per-component
+// instances merge with the existing operator+=. A snapshot taken while other
+// threads are adding may mix in a partially recorded value (each field is
+// atomic, the five together are not), which is fine for monitoring.
+class AtomicBasicStats {
+ public:
+  AtomicBasicStats() { Reset(); }
+
+  void Reset() {
+    num_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<double>::max(), std::memory_order_relaxed);
+    max_.store(std::numeric_limits<double>::min(), std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    sum_sq_.store(0, std::memory_order_relaxed);
+  }
+
+  void Add(double val) {
+    AtomicMin(&min_, val);
+    AtomicMax(&max_, val);
+    AtomicAdd(&sum_, val);
+    AtomicAdd(&sum_sq_, val * val);
+    num_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  int64_t Num() const { return num_.load(std::memory_order_relaxed); }
+
+  BasicStats Snapshot() const {
+    BasicStats out;
+    out.num_ = num_.load(std::memory_order_relaxed);
+    out.min_ = min_.load(std::memory_order_relaxed);
+    out.max_ = max_.load(std::memory_order_relaxed);
+    out.sum_ = sum_.load(std::memory_order_relaxed);
+    out.sum_sq_ = sum_sq_.load(std::memory_order_relaxed);
+    return out;
+  }
+
+  json::Object ToJson() const { return Snapshot().ToJson(); }
+
+ private:
+  static void AtomicAdd(std::atomic<double>* target, double val) {
+    double old = target->load(std::memory_order_relaxed);
+    while (!target->compare_exchange_weak(old, old + val,
+                                          std::memory_order_relaxed)) {
+    }
+  }
+  static void AtomicMin(std::atomic<double>* target, double val) {
+    double old = target->load(std::memory_order_relaxed);
+    while (val < old && !target->compare_exchange_weak(
+                            old, val, std::memory_order_relaxed)) {
+    }
+  }
+  static void AtomicMax(std::atomic<double>* target, double val) {
+    double old = target->load(std::memory_order_relaxed);
+    while (val > old && !target->compare_exchange_weak(
+                            old, val, std::memory_order_relaxed)) {
+    }
+  }
+
+  std::atomic<int64_t> num_;
+  std::atomic<double> min_;
+  std::atomic<double> max_;
+  std::atomic<double> sum_;
+  std::atomic<double> sum_sq_;
+};
+
 // Track the occurrences for `count` buckets. You need to decide how to map your
 // data into the buckets. Mainly useful for scalar values.
 class HistogramNumbered {
@@ -104,6 +173,116 @@ class HistogramNumbered {
   std::vector<int> counts_;
 };
 
+// Mergeable snapshot of an AtomicLogHistogram: per-bucket counts plus each
+// bucket's lower bound, so per-actor snapshots can be summed before printing.
+struct LogHistogramSnapshot {
+  std::vector<int64_t> counts;
+  std::vector<double> bounds;
+
+  LogHistogramSnapshot& operator+=(const LogHistogramSnapshot& o) {
+    if (counts.empty()) {
+      *this = o;
+    } else {
+      for (int i = 0; i < counts.size() && i < o.counts.size(); ++i) {
+        counts[i] += o.counts[i];
+      }
+    }
+    return *this;
+  }
+
+  int64_t Total() const {
+    int64_t total = 0;
+    for (int64_t c : counts) total += c;
+    return total;
+  }
+
+  // Smallest bucket lower bound such that at least `fraction` of the recorded
+  // values fall at or below that bucket. Handy for p50/p99 of latencies.
+  double Quantile(double fraction) const {
+    int64_t threshold = static_cast<int64_t>(std::ceil(fraction * Total()));
+    int64_t seen = 0;
+    for (int i = 0; i < counts.size(); ++i) {
+      seen += counts[i];
+      if (seen >= threshold) return bounds[i];
+    }
+    return bounds.empty() ? 0 : bounds.back();
+  }
+
+  json::Object ToJson() const {
+    return {
+        {"counts", json::CastToArray(counts)},
+        {"bounds", json::CastToArray(bounds)},
+    };
+  }
+};
+
+// A log-bucketed histogram with lock-free recording: values land in power-of-
+// two octaves starting at min_value, each split into linear sub-buckets (in
+// the style of HDR histograms), so a fixed small bucket count covers many
+// orders of magnitude of latency at a constant relative precision. Add() is
+// one relaxed fetch_add, safe from any number of threads.
+class AtomicLogHistogram {
+ public:
+  // Buckets: one underflow bucket for values <= min_value, then num_octaves
+  // doublings each split into sub_buckets; values beyond the top octave
+  // saturate into the last bucket.
+  AtomicLogHistogram(double min_value, int num_octaves, int sub_buckets = 4)
+      : min_value_(min_value),
+        num_octaves_(num_octaves),
+        sub_buckets_(sub_buckets),
+        counts_(1 + num_octaves * sub_buckets) {}
+
+  void Add(double val) {
+    counts_[BucketFor(val)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Reset() {
+    for (std::atomic<int64_t>& count : counts_) {
+      count.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  int NumBuckets() const { return static_cast<int>(counts_.size()); }
+
+  // Inclusive lower bound of the values mapped to the given bucket.
+  double BucketLowerBound(int bucket) const {
+    if (bucket <= 0) return 0;
+    int octave = (bucket - 1) / sub_buckets_;
+    int sub = (bucket - 1) % sub_buckets_;
+    double lower = min_value_ * std::exp2(octave);
+    return lower + lower * sub / sub_buckets_;
+  }
+
+  LogHistogramSnapshot Snapshot() const {
+    LogHistogramSnapshot out;
+    out.counts.reserve(counts_.size());
+    out.bounds.reserve(counts_.size());
+    for (int i = 0; i < counts_.size(); ++i) {
+      out.counts.push_back(counts_[i].load(std::memory_order_relaxed));
+      out.bounds.push_back(BucketLowerBound(i));
+    }
+    return out;
+  }
+
+  json::Object ToJson() const { return Snapshot().ToJson(); }
+
+ private:
+  int BucketFor(double val) const {
+    if (!(val > min_value_)) return 0;  // Also catches NaN and negatives.
+    int octave = static_cast<int>(std::log2(val / min_value_));
+    if (octave >= num_octaves_) return NumBuckets() - 1;
+    double lower = min_value_ * std::exp2(octave);
+    int sub = static_cast<int>((val - lower) / lower * sub_buckets_);
+    sub = std::min(sub, sub_buckets_ - 1);
+    return 1 + octave * sub_buckets_ + sub;
+  }
+
+  const double min_value_;
+  const int num_octaves_;
+  const int sub_buckets_;
+  std::vector<std::atomic<int64_t>> counts_;
+};
+
 // Same as HistogramNumbered, but each bucket has a name associated with it
 // and is returned in the json output. Mainly useful for categorical values.
 class HistogramNamed {
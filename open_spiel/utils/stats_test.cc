@@ -14,8 +14,11 @@
 
 #include "open_spiel/utils/stats.h"
 
+#include <vector>
+
 #include "open_spiel/spiel_utils.h"
 #include "open_spiel/utils/json.h"
+#include "open_spiel/utils/thread.h"
 
 namespace open_spiel {
 namespace {
@@ -119,6 +122,80 @@ void TestHistogramNamed() {
   }));
 }
 
+void TestAtomicBasicStats() {
+  AtomicBasicStats stats;
+
+  // Concurrent adds from several threads must all land.
+  constexpr int kNumThreads = 4;
+  constexpr int kAddsPerThread = 10000;
+  std::vector<Thread> threads;
+  threads.reserve(kNumThreads);
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&stats]() {
+      for (int i = 0; i < kAddsPerThread; ++i) {
+        stats.Add(10);
+      }
+    });
+  }
+  for (Thread& thread : threads) thread.join();
+
+  BasicStats snapshot = stats.Snapshot();
+  SPIEL_CHECK_EQ(snapshot.Num(), kNumThreads * kAddsPerThread);
+  SPIEL_CHECK_EQ(snapshot.Min(), 10);
+  SPIEL_CHECK_EQ(snapshot.Max(), 10);
+  SPIEL_CHECK_FLOAT_EQ(snapshot.Avg(), 10);
+
+  // Snapshots merge with plain BasicStats.
+  AtomicBasicStats other;
+  other.Add(30);
+  snapshot += other.Snapshot();
+  SPIEL_CHECK_EQ(snapshot.Num(), kNumThreads * kAddsPerThread + 1);
+  SPIEL_CHECK_EQ(snapshot.Max(), 30);
+
+  stats.Reset();
+  SPIEL_CHECK_EQ(stats.Num(), 0);
+  SPIEL_CHECK_EQ(stats.Snapshot().Min(), 0);
+}
+
+void TestAtomicLogHistogram() {
+  // Octaves starting at 1: [0,1], (1,1.5], (1.5,2], (2,3], (3,4], (4,6], ...
+  AtomicLogHistogram hist(1.0, 10, /*sub_buckets=*/2);
+  SPIEL_CHECK_EQ(hist.NumBuckets(), 21);
+  SPIEL_CHECK_EQ(hist.BucketLowerBound(0), 0);
+  SPIEL_CHECK_EQ(hist.BucketLowerBound(1), 1.0);
+  SPIEL_CHECK_EQ(hist.BucketLowerBound(2), 1.5);
+  SPIEL_CHECK_EQ(hist.BucketLowerBound(3), 2.0);
+  SPIEL_CHECK_EQ(hist.BucketLowerBound(4), 3.0);
+
+  hist.Add(0.5);   // Underflow bucket.
+  hist.Add(1.2);   // Bucket 1.
+  hist.Add(1.7);   // Bucket 2.
+  hist.Add(3.5);   // Bucket 4.
+  hist.Add(1e9);   // Beyond the top octave: saturates into the last bucket.
+
+  LogHistogramSnapshot snapshot = hist.Snapshot();
+  SPIEL_CHECK_EQ(snapshot.Total(), 5);
+  SPIEL_CHECK_EQ(snapshot.counts[0], 1);
+  SPIEL_CHECK_EQ(snapshot.counts[1], 1);
+  SPIEL_CHECK_EQ(snapshot.counts[2], 1);
+  SPIEL_CHECK_EQ(snapshot.counts[4], 1);
+  SPIEL_CHECK_EQ(snapshot.counts[20], 1);
+
+  // Mergeable across instances.
+  AtomicLogHistogram other(1.0, 10, /*sub_buckets=*/2);
+  other.Add(1.2);
+  snapshot += other.Snapshot();
+  SPIEL_CHECK_EQ(snapshot.Total(), 6);
+  SPIEL_CHECK_EQ(snapshot.counts[1], 2);
+
+  // Quantile returns a bucket lower bound.
+  SPIEL_CHECK_EQ(snapshot.Quantile(0.5), 1.0);
+  SPIEL_CHECK_EQ(snapshot.Quantile(1.0), hist.BucketLowerBound(20));
+
+  hist.Reset();
+  SPIEL_CHECK_EQ(hist.Snapshot().Total(), 0);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -127,4 +204,6 @@ int main(int argc, char** argv) {
   open_spiel::TestHistogramNumbered();
   open_spiel::TestHistogramTooLarge();
   open_spiel::TestHistogramNamed();
+  open_spiel::TestAtomicBasicStats();
+  open_spiel::TestAtomicLogHistogram();
 }
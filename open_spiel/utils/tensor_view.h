@@ -16,6 +16,7 @@
 #define OPEN_SPIEL_UTILS_TENSOR_VIEW_H_
 
 #include <algorithm>
+#include <cstdint>
 #include <numeric>
 #include <vector>
 
@@ -24,6 +25,18 @@
 
 namespace open_spiel {
 
+// Set plane[i] = 1 for each set bit i of mask, leaving other entries alone.
+// One bit-scan per set bit, so sparse masks (a hand of cards in a 36- or
+// 64-entry plane) cost far less than writing every entry.
+template <typename T>
+void SetBitsFromMask(absl::Span<T> plane, uint64_t mask) {
+  SPIEL_DCHECK_TRUE(mask == 0 || 64 - __builtin_clzll(mask) <=
+                                     static_cast<int>(plane.size()));
+  for (; mask != 0; mask &= mask - 1) {
+    plane[__builtin_ctzll(mask)] = 1;
+  }
+}
+
 // Treat a `absl::Span<float>` as a tensor of fixed shape. The rank (number of
 // dimensions) must be known at compile time, though the actual sizes of the
 // dimensions can be supplied at construction time. It then lets you index into
@@ -45,6 +58,26 @@ class TensorView {
 
   void clear() { std::fill(values_.begin(), values_.end(), 0.0); }
 
+  // Number of elements in one slice of the leading dimension.
+  constexpr int plane_size() const {
+    return std::accumulate(shape_.begin() + 1, shape_.end(), 1,
+                           std::multiplies<int>());
+  }
+
+  // The contiguous elements of slice `plane` of the leading dimension.
+  // Bulk writes through the span (std::fill, SetBitsFromMask) compile to
+  // vectorized code, unlike per-element operator[] indexing.
+  absl::Span<float> Plane(int plane) {
+    return values_.subspan(plane * plane_size(), plane_size());
+  }
+
+  // Set every element of slice `plane` of the leading dimension.
+  void FillPlane(int plane, float value) {
+    absl::Span<float> span = Plane(plane);
+    std::fill(span.begin(), span.end(), value);
+  }
+  void ClearPlane(int plane) { FillPlane(plane, 0.0); }
+
   constexpr int index(const std::array<int, Rank>& args) const {
     int ind = 0;
     for (int i = 0; i < Rank; ++i) {
@@ -15,6 +15,7 @@
 #include "open_spiel/utils/tensor_view.h"
 
 #include <array>
+#include <cstdint>
 #include <vector>
 
 #include "open_spiel/spiel_utils.h"
@@ -135,7 +136,53 @@ void TestTensorView() {
   }
 }
 
+void TestTensorViewPlanes() {
+  std::vector<float> values(24);
+  TensorView<3> view(absl::MakeSpan(values), {4, 2, 3}, true);
+  SPIEL_CHECK_EQ(view.plane_size(), 6);
+
+  view.FillPlane(1, 1.0);
+  view.FillPlane(3, 0.5);
+  for (int i = 0; i < values.size(); ++i) {
+    float expected = i < 6 ? 0 : i < 12 ? 1.0 : i < 18 ? 0 : 0.5;
+    SPIEL_CHECK_EQ(values[i], expected);
+  }
+
+  view.ClearPlane(1);
+  for (int i = 6; i < 12; ++i) {
+    SPIEL_CHECK_EQ(values[i], 0);
+  }
+
+  absl::Span<float> plane = view.Plane(2);
+  SPIEL_CHECK_EQ(plane.size(), 6);
+  SPIEL_CHECK_EQ(plane.data(), values.data() + 12);
+}
+
+void TestSetBitsFromMask() {
+  std::vector<float> plane(36, 0);
+  SetBitsFromMask(absl::MakeSpan(plane), (uint64_t{1} << 35) | 0b1010);
+  for (int i = 0; i < plane.size(); ++i) {
+    float expected = (i == 1 || i == 3 || i == 35) ? 1 : 0;
+    SPIEL_CHECK_EQ(plane[i], expected);
+  }
+
+  // Only sets bits; existing entries are untouched.
+  SetBitsFromMask(absl::MakeSpan(plane), 0b0001);
+  SPIEL_CHECK_EQ(plane[0], 1);
+  SPIEL_CHECK_EQ(plane[1], 1);
+
+  // Works for non-float planes too.
+  std::vector<uint8_t> bits(8, 0);
+  SetBitsFromMask(absl::MakeSpan(bits), 0b10000001);
+  SPIEL_CHECK_EQ(bits[0], 1);
+  SPIEL_CHECK_EQ(bits[7], 1);
+}
+
 }  // namespace
 }  // namespace open_spiel
 
-int main(int argc, char** argv) { open_spiel::TestTensorView(); }
+int main(int argc, char** argv) {
+  open_spiel::TestTensorView();
+  open_spiel::TestTensorViewPlanes();
+  open_spiel::TestSetBitsFromMask();
+}
@@ -14,7 +14,19 @@
 
 #include "open_spiel/utils/thread.h"
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <thread>  // NOLINT
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/numbers.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_cat.h"
+#include "open_spiel/abseil-cpp/absl/strings/str_split.h"
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
+#include "open_spiel/spiel_utils.h"
 
 namespace open_spiel {
 
@@ -32,4 +44,48 @@ Thread& Thread::operator=(Thread&& other) = default;
 
 void Thread::join() { thread_->join(); }
 
+std::vector<int> ParseCpuList(absl::string_view spec) {
+  std::vector<int> cpus;
+  if (spec.empty()) {
+    return cpus;
+  }
+  for (absl::string_view range : absl::StrSplit(spec, ',')) {
+    const size_t dash = range.find('-');
+    int first, last;
+    if (dash == absl::string_view::npos) {
+      if (!absl::SimpleAtoi(range, &first)) {
+        SpielFatalError(absl::StrCat("Invalid cpu list: ", spec));
+      }
+      last = first;
+    } else if (!absl::SimpleAtoi(range.substr(0, dash), &first) ||
+               !absl::SimpleAtoi(range.substr(dash + 1), &last) ||
+               last < first) {
+      SpielFatalError(absl::StrCat("Invalid cpu list: ", spec));
+    }
+    if (first < 0) {
+      SpielFatalError(absl::StrCat("Invalid cpu list: ", spec));
+    }
+    for (int cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+bool PinThisThreadToCpus(const std::vector<int>& cpus) {
+  if (cpus.empty()) {
+    return false;
+  }
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const int cpu : cpus) {
+    CPU_SET(cpu, &cpu_set);
+  }
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+  return false;
+#endif
+}
+
 }  // namespace open_spiel
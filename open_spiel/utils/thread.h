@@ -18,6 +18,9 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/strings/string_view.h"
 
 namespace open_spiel {
 
@@ -42,6 +45,17 @@ class Thread {
   std::unique_ptr<ThreadImpl> thread_;
 };
 
+// Parse a taskset-style cpu list, e.g. "0-15,32,34-35", into cpu ids.
+// An empty spec parses to an empty list; dies on malformed input.
+std::vector<int> ParseCpuList(absl::string_view spec);
+
+// Pin the calling thread to the given cpus. Threads it creates afterwards
+// inherit the mask, and with the kernel's first-touch policy, memory the
+// pinned thread allocates and first writes lands on its local NUMA node.
+// Returns false (doing nothing) for an empty list or on platforms without
+// affinity support; returns true once the mask is applied.
+bool PinThisThreadToCpus(const std::vector<int>& cpus);
+
 // A token for whether a thread has been requested to stop.
 class StopToken {
  public:
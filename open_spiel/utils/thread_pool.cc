@@ -0,0 +1,171 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/thread_pool.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/abseil-cpp/absl/time/clock.h"
+#include "open_spiel/abseil-cpp/absl/time/time.h"
+
+namespace open_spiel {
+namespace {
+
+// Which pool (if any) the current thread is a worker of, and its index.
+// Lets Schedule() push onto the worker's own deque and lets ParallelFor
+// helpers run on the right queues when nested.
+thread_local ThreadPool* current_pool = nullptr;
+thread_local int current_worker = -1;
+
+}  // namespace
+
+ThreadPool::ThreadPool(int num_threads) {
+  num_threads = std::max(num_threads, 0);
+  queues_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
+  workers_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    workers_.emplace_back([this, i]() { WorkerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  shutdown_.store(true, std::memory_order_release);
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::Schedule(std::function<void()> fn) {
+  if (workers_.empty()) {  // No workers: degrade to synchronous execution.
+    fn();
+    return;
+  }
+  if (current_pool == this) {  // Called from inside a task: keep it local.
+    WorkerQueue& queue = *queues_[current_worker];
+    absl::MutexLock lock(&queue.m);
+    queue.tasks.push_back(std::move(fn));
+  } else {
+    absl::MutexLock lock(&shared_m_);
+    shared_tasks_.push_back(std::move(fn));
+  }
+}
+
+void ThreadPool::ParallelFor(int64_t begin, int64_t end,
+                             const std::function<void(int64_t)>& fn) {
+  int64_t total = end - begin;
+  if (total <= 0) return;
+  if (total == 1 || workers_.empty()) {
+    for (int64_t i = begin; i < end; ++i) fn(i);
+    return;
+  }
+
+  struct SharedState {
+    std::atomic<int64_t> next;
+    int64_t end;
+    int64_t total;
+    std::function<void(int64_t)> fn;
+    absl::Mutex m;
+    int64_t completed = 0;  // Guarded by m.
+  };
+  auto state = std::make_shared<SharedState>();
+  state->next.store(begin, std::memory_order_relaxed);
+  state->end = end;
+  state->total = total;
+  state->fn = fn;
+
+  // Each helper (and the caller) claims indices from the shared counter until
+  // the range is exhausted, then reports how many items it completed. The
+  // caller drains the counter itself, so completion never depends on a helper
+  // being scheduled -- helpers only speed things up, which is what makes
+  // nested calls from busy workers safe.
+  auto work = [state]() {
+    int64_t done = 0;
+    int64_t i;
+    while ((i = state->next.fetch_add(1, std::memory_order_relaxed)) <
+           state->end) {
+      state->fn(i);
+      ++done;
+    }
+    absl::MutexLock lock(&state->m);
+    state->completed += done;
+  };
+
+  int num_helpers =
+      std::min<int64_t>(static_cast<int64_t>(workers_.size()), total - 1);
+  for (int i = 0; i < num_helpers; ++i) {
+    Schedule(work);
+  }
+  work();
+
+  // Wait for the items claimed by helpers that are still in flight. Helpers
+  // report under state->m, which re-evaluates the condition.
+  absl::MutexLock lock(&state->m);
+  state->m.Await(absl::Condition(
+      +[](SharedState* s) { return s->completed == s->total; }, state.get()));
+}
+
+void ThreadPool::WorkerLoop(int worker_index) {
+  current_pool = this;
+  current_worker = worker_index;
+  while (true) {
+    std::function<void()> task;
+    if (GetTask(worker_index, &task)) {
+      task();
+    } else if (shutdown_.load(std::memory_order_acquire)) {
+      return;
+    } else {
+      absl::SleepFor(absl::Microseconds(100));
+    }
+  }
+}
+
+bool ThreadPool::GetTask(int worker_index, std::function<void()>* task) {
+  {  // Own queue, newest first.
+    WorkerQueue& queue = *queues_[worker_index];
+    absl::MutexLock lock(&queue.m);
+    if (!queue.tasks.empty()) {
+      *task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      return true;
+    }
+  }
+  // Steal from the other workers, oldest first.
+  for (int offset = 1; offset < static_cast<int>(queues_.size()); ++offset) {
+    WorkerQueue& queue =
+        *queues_[(worker_index + offset) % queues_.size()];
+    absl::MutexLock lock(&queue.m);
+    if (!queue.tasks.empty()) {
+      *task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      return true;
+    }
+  }
+  {  // The shared queue of external submissions.
+    absl::MutexLock lock(&shared_m_);
+    if (!shared_tasks_.empty()) {
+      *task = std::move(shared_tasks_.front());
+      shared_tasks_.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace open_spiel
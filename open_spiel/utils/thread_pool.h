@@ -0,0 +1,80 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_UTILS_THREAD_POOL_H_
+#define OPEN_SPIEL_UTILS_THREAD_POOL_H_
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/synchronization/mutex.h"
+#include "open_spiel/utils/thread.h"
+
+namespace open_spiel {
+
+// A work-stealing thread pool for the parallel algorithm modes. Each worker
+// owns a deque: it pushes and pops its own tasks at the back, and idle
+// workers steal from the front of other workers' deques, so subtasks spawned
+// inside a task stay mostly on the spawning worker while load still spreads.
+// External callers submit through a shared queue.
+//
+// Tasks may themselves call Schedule() and ParallelFor(): ParallelFor's
+// caller always participates in executing its own range, so nested use from
+// inside a task cannot deadlock even when every worker is busy.
+class ThreadPool {
+ public:
+  // Creates num_threads workers. With num_threads <= 0 the pool has no
+  // workers and everything runs on the calling thread.
+  explicit ThreadPool(int num_threads);
+  ~ThreadPool();  // Finishes already-submitted tasks, then joins.
+
+  // Not copyable or movable: workers hold a pointer back to the pool.
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  int NumThreads() const { return static_cast<int>(workers_.size()); }
+
+  // Runs fn on some worker (or inline if the pool has no workers).
+  void Schedule(std::function<void()> fn);
+
+  // Calls fn(i) for every i in [begin, end), spread over the workers, and
+  // blocks until all calls finished. The calling thread executes items too.
+  void ParallelFor(int64_t begin, int64_t end,
+                   const std::function<void(int64_t)>& fn);
+
+ private:
+  struct WorkerQueue {
+    absl::Mutex m;
+    std::deque<std::function<void()>> tasks;  // Guarded by m.
+  };
+
+  void WorkerLoop(int worker_index);
+  // Pops a task: own queue from the back, then steal from other workers'
+  // fronts, then the shared queue. Returns false if nothing was found.
+  bool GetTask(int worker_index, std::function<void()>* task);
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  absl::Mutex shared_m_;
+  std::deque<std::function<void()>> shared_tasks_;  // Guarded by shared_m_.
+  std::atomic<bool> shutdown_{false};
+  std::vector<Thread> workers_;  // Keep last: workers use the members above.
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_UTILS_THREAD_POOL_H_
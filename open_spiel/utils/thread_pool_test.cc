@@ -0,0 +1,91 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/utils/thread_pool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+namespace {
+
+void TestSchedule() {
+  std::atomic<int> count{0};
+  {
+    ThreadPool pool(4);
+    SPIEL_CHECK_EQ(pool.NumThreads(), 4);
+    for (int i = 0; i < 100; ++i) {
+      pool.Schedule([&count]() { ++count; });
+    }
+    // The destructor finishes everything already submitted.
+  }
+  SPIEL_CHECK_EQ(count.load(), 100);
+}
+
+void TestParallelFor() {
+  ThreadPool pool(4);
+  constexpr int64_t kNum = 10000;
+  std::vector<int> hits(kNum, 0);
+  std::atomic<int64_t> sum{0};
+  pool.ParallelFor(0, kNum, [&](int64_t i) {
+    ++hits[i];
+    sum += i;
+  });
+  for (int64_t i = 0; i < kNum; ++i) {
+    SPIEL_CHECK_EQ(hits[i], 1);
+  }
+  SPIEL_CHECK_EQ(sum.load(), kNum * (kNum - 1) / 2);
+
+  // Empty and single-element ranges.
+  pool.ParallelFor(3, 3, [](int64_t) { SpielFatalError("Unreachable"); });
+  int single = 0;
+  pool.ParallelFor(7, 8, [&single](int64_t i) { single = i; });
+  SPIEL_CHECK_EQ(single, 7);
+}
+
+void TestNestedParallelFor() {
+  ThreadPool pool(3);
+  constexpr int64_t kOuter = 16;
+  constexpr int64_t kInner = 64;
+  std::atomic<int64_t> count{0};
+  // Tasks calling ParallelFor from inside the pool must not deadlock even
+  // though every worker can be busy with an outer item.
+  pool.ParallelFor(0, kOuter, [&](int64_t) {
+    pool.ParallelFor(0, kInner, [&](int64_t) { ++count; });
+  });
+  SPIEL_CHECK_EQ(count.load(), kOuter * kInner);
+}
+
+void TestNoWorkers() {
+  ThreadPool pool(0);
+  SPIEL_CHECK_EQ(pool.NumThreads(), 0);
+  int count = 0;
+  pool.Schedule([&count]() { ++count; });
+  SPIEL_CHECK_EQ(count, 1);  // Ran inline.
+  pool.ParallelFor(0, 10, [&count](int64_t) { ++count; });
+  SPIEL_CHECK_EQ(count, 11);
+}
+
+}  // namespace
+}  // namespace open_spiel
+
+int main(int argc, char** argv) {
+  open_spiel::TestSchedule();
+  open_spiel::TestParallelFor();
+  open_spiel::TestNestedParallelFor();
+  open_spiel::TestNoWorkers();
+}
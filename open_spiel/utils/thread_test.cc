@@ -14,6 +14,8 @@
 
 #include "open_spiel/utils/thread.h"
 
+#include <vector>
+
 #include "open_spiel/spiel_utils.h"
 
 namespace open_spiel {
@@ -42,6 +44,22 @@ void TestThreadMoveAssign() {
   SPIEL_CHECK_EQ(value, 2);
 }
 
+void TestParseCpuList() {
+  SPIEL_CHECK_TRUE(ParseCpuList("").empty());
+  SPIEL_CHECK_TRUE(ParseCpuList("5") == std::vector<int>({5}));
+  SPIEL_CHECK_TRUE(ParseCpuList("0-3") == std::vector<int>({0, 1, 2, 3}));
+  SPIEL_CHECK_TRUE(ParseCpuList("0-2,7,9-10") ==
+                   std::vector<int>({0, 1, 2, 7, 9, 10}));
+}
+
+void TestPinThisThreadToCpus() {
+  SPIEL_CHECK_FALSE(PinThisThreadToCpus({}));
+  // Pinning to cpu 0 from inside a thread must not affect the caller; the
+  // return value depends on the platform, so only check it doesn't crash.
+  Thread thread([]() { PinThisThreadToCpus({0}); });
+  thread.join();
+}
+
 }  // namespace
 }  // namespace open_spiel
 
@@ -49,4 +67,6 @@ int main(int argc, char** argv) {
   open_spiel::TestThread();
   open_spiel::TestThreadMove();
   open_spiel::TestThreadMoveAssign();
+  open_spiel::TestParseCpuList();
+  open_spiel::TestPinThisThreadToCpus();
 }
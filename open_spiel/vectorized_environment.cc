@@ -0,0 +1,120 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "open_spiel/vectorized_environment.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/algorithm/container.h"
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+#include "open_spiel/spiel.h"
+#include "open_spiel/spiel_utils.h"
+
+namespace open_spiel {
+
+VectorizedEnvironment::VectorizedEnvironment(std::shared_ptr<const Game> game,
+                                             int num_envs, int seed)
+    : game_(std::move(game)),
+      observation_size_(game_->ObservationTensorSize()),
+      rng_(seed),
+      uniform_(0.0, 1.0) {
+  SPIEL_CHECK_GE(num_envs, 1);
+  const GameType& type = game_->GetType();
+  SPIEL_CHECK_EQ(type.dynamics, GameType::Dynamics::kSequential);
+  SPIEL_CHECK_TRUE(type.chance_mode == GameType::ChanceMode::kDeterministic ||
+                   type.chance_mode ==
+                       GameType::ChanceMode::kExplicitStochastic);
+  SPIEL_CHECK_TRUE(type.provides_observation_tensor);
+
+  states_.resize(num_envs);
+  rewards_.assign(num_envs, std::vector<double>(game_->NumPlayers(), 0.0));
+  episode_ended_.assign(num_envs, false);
+  Reset();
+}
+
+void VectorizedEnvironment::SampleChance(State* state) {
+  while (state->IsChanceNode()) {
+    state->ApplyAction(state->SampleChanceOutcome(uniform_(rng_)).first);
+  }
+}
+
+std::unique_ptr<State> VectorizedEnvironment::NewEpisode() {
+  std::unique_ptr<State> state = game_->NewInitialState();
+  SampleChance(state.get());
+  // A game over at the first decision node would make auto-reset loop.
+  SPIEL_CHECK_FALSE(state->IsTerminal());
+  return state;
+}
+
+void VectorizedEnvironment::Reset() {
+  for (int i = 0; i < num_envs(); ++i) {
+    states_[i] = NewEpisode();
+    absl::c_fill(rewards_[i], 0.0);
+    episode_ended_[i] = false;
+  }
+}
+
+void VectorizedEnvironment::Step(absl::Span<const Action> actions) {
+  SPIEL_CHECK_EQ(actions.size(), num_envs());
+  for (int i = 0; i < num_envs(); ++i) {
+    State* state = states_[i].get();
+    SPIEL_DCHECK_TRUE(absl::c_linear_search(state->LegalActions(),
+                                            actions[i]));
+    // Rewards are reported as the change in cumulative returns over the
+    // whole transition, including any chance nodes crossed.
+    std::vector<double> before = state->Returns();
+    state->ApplyAction(actions[i]);
+    SampleChance(state);
+    std::vector<double> after = state->Returns();
+    for (int p = 0; p < game_->NumPlayers(); ++p) {
+      rewards_[i][p] = after[p] - before[p];
+    }
+    episode_ended_[i] = state->IsTerminal();
+    if (episode_ended_[i]) {
+      states_[i] = NewEpisode();
+    }
+  }
+}
+
+const State& VectorizedEnvironment::state(int env) const {
+  SPIEL_CHECK_GE(env, 0);
+  SPIEL_CHECK_LT(env, num_envs());
+  return *states_[env];
+}
+
+const std::vector<double>& VectorizedEnvironment::rewards(int env) const {
+  SPIEL_CHECK_GE(env, 0);
+  SPIEL_CHECK_LT(env, num_envs());
+  return rewards_[env];
+}
+
+bool VectorizedEnvironment::episode_ended(int env) const {
+  SPIEL_CHECK_GE(env, 0);
+  SPIEL_CHECK_LT(env, num_envs());
+  return episode_ended_[env];
+}
+
+void VectorizedEnvironment::FillObservations(absl::Span<float> buffer) const {
+  SPIEL_CHECK_EQ(buffer.size(), num_envs() * observation_size_);
+  for (int i = 0; i < num_envs(); ++i) {
+    const State& state = *states_[i];
+    state.ObservationTensor(state.CurrentPlayer(),
+                            buffer.subspan(i * observation_size_,
+                                           observation_size_));
+  }
+}
+
+}  // namespace open_spiel
@@ -0,0 +1,94 @@
+// Copyright 2021 DeepMind Technologies Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPEN_SPIEL_VECTORIZED_ENVIRONMENT_H_
+#define OPEN_SPIEL_VECTORIZED_ENVIRONMENT_H_
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "open_spiel/abseil-cpp/absl/types/span.h"
+#include "open_spiel/spiel.h"
+
+// A batch of independent episodes of one sequential game, stepped in
+// lockstep for RL training. Chance nodes are sampled internally from a
+// seeded generator, so the states presented to the caller are always
+// decision nodes, and finished episodes are reset automatically: after a
+// Step() that ends episode i, episode_ended(i) is true, rewards(i) holds
+// the final transition's returns, and the environment already shows the
+// first decision node of the next episode (gym-style auto-reset).
+//
+// Observations for the whole batch are written batch-major into one
+// caller-provided contiguous block, so a training loop crosses into the
+// library once per step rather than once per state.
+
+namespace open_spiel {
+
+class VectorizedEnvironment {
+ public:
+  // The game must be sequential (use the turn_based_simultaneous_game
+  // transform for simultaneous-move games).
+  VectorizedEnvironment(std::shared_ptr<const Game> game, int num_envs,
+                        int seed);
+
+  int num_envs() const { return states_.size(); }
+  int observation_size() const { return observation_size_; }
+  const Game& game() const { return *game_; }
+
+  // Restarts every episode from the initial state, clearing rewards and
+  // episode-end flags.
+  void Reset();
+
+  // Applies actions[i] to episode i (one entry per environment), then
+  // samples any chance nodes that follow. Episodes that reach a terminal
+  // state are reset in place as described above.
+  void Step(absl::Span<const Action> actions);
+
+  // Read access to episode i, e.g. for legal-action masks. Never a chance
+  // node, and never terminal (auto-reset runs inside Step).
+  const State& state(int env) const;
+  Player current_player(int env) const { return state(env).CurrentPlayer(); }
+
+  // Results of the most recent Step() for episode i: the returns
+  // accumulated by that step (all players), and whether it ended the
+  // episode. Both are zeroed by Reset().
+  const std::vector<double>& rewards(int env) const;
+  bool episode_ended(int env) const;
+
+  // Writes the current player's observation tensor for every episode into
+  // `buffer`, batch-major: episode i occupies
+  // [i * observation_size(), (i + 1) * observation_size()).
+  // The buffer size must be exactly num_envs() * observation_size().
+  void FillObservations(absl::Span<float> buffer) const;
+
+ private:
+  // Advances `state` through any chance nodes.
+  void SampleChance(State* state);
+  // Fresh initial state advanced to the first decision node.
+  std::unique_ptr<State> NewEpisode();
+
+  std::shared_ptr<const Game> game_;
+  const int observation_size_;
+  std::mt19937 rng_;
+  std::uniform_real_distribution<double> uniform_;
+
+  std::vector<std::unique_ptr<State>> states_;
+  std::vector<std::vector<double>> rewards_;
+  std::vector<bool> episode_ended_;
+};
+
+}  // namespace open_spiel
+
+#endif  // OPEN_SPIEL_VECTORIZED_ENVIRONMENT_H_